@@ -120,6 +120,12 @@ DS2482S - I2C TO 1-WIRE CONVERTER
 		/** When waiting in loops, we need a program loop timeout value */
 		#define C_LOCALDEF__LCCM641__MAX_TIMEOUT_LOOPS						(100000U)
 
+		/** Run 1-Wire transactions from vDS2482S__Process() instead of busy waiting */
+		#define C_LOCALDEF__LCCM641__ENABLE_ASYNC							(1U)
+
+		/** 10ms ticks before an async 1-Wire op is declared hung */
+		#define C_LOCALDEF__LCCM641__ASYNC_TIMEOUT_TICKS					(3U)
+
 		// I2C MACROS
 		#define M_LOCALDEF__LCCM641__I2C_RX_REG(device, reg)				s16RM4_I2C_USER__RxReg(device, reg)
 		#define M_LOCALDEF__LCCM641__I2C_TX_REG(device, reg)				s16RM4_I2C_USER__TxReg(device, reg)
@@ -157,6 +163,13 @@ DS18B20 - 1-Wire Temperature Sensor
 		 */
 		#define C_LOCALDEF__LCCM644__USE_10MS_ISR							(1U)
 
+		/** Convert and read through the LCCM641 async engine, needs the 10ms ISR */
+		#define C_LOCALDEF__LCCM644__USE_ASYNC								(1U)
+
+		/** Call C_LOCALDEF__LCCM644__TEMP_CALLBACK(index) as each new reading is stored */
+		#define C_LOCALDEF__LCCM644__ENABLE_TEMP_CALLBACK					(1U)
+		#define C_LOCALDEF__LCCM644__TEMP_CALLBACK(index)				vPWRNODE_BATTTEMP_STATS__Update(index)
+
 		//connectivity options
 		//1-Wire software library
 		#define C_LOCALDEF__LCCM644__CONNECT_LCCM236						(0U)
@@ -247,7 +260,7 @@ BQ76PL536A - BMS DRIVER
 
 
 		/** Testing Options */
-		#define C_LOCALDEF__LCCM715__ENABLE_TEST_SPEC						(0U)
+		#define C_LOCALDEF__LCCM715__ENABLE_TEST_SPEC						(1U)
 
 		/** Main include file */
 		#include <MULTICORE/LCCM715__MULTICORE__BQ76PL536A/bq76.h>
@@ -261,7 +274,7 @@ RLOOP - POWER NODE CORE
 	#if C_LOCALDEF__LCCM653__ENABLE_THIS_MODULE == 1U
 
 		/** Enable the battery temperature measurement system */
-		#define C_LOCALDEF__LCCM653__ENABLE_BATT_TEMP						(0U)
+		#define C_LOCALDEF__LCCM653__ENABLE_BATT_TEMP						(1U)
 
 		/** Enable or disable battery temp search */
 		#define C_LOCALDEF__LCCM653__ENABLE_BATT_TEMP_SEARCH				(0U)
@@ -296,7 +309,7 @@ RLOOP - POWER NODE CORE
 
 
 		/** Testing Options */
-		#define C_LOCALDEF__LCCM653__ENABLE_TEST_SPEC						(0U)
+		#define C_LOCALDEF__LCCM653__ENABLE_TEST_SPEC						(1U)
 		
 		/** Main include file */
 		#include <LCCM653__RLOOP__POWER_CORE/power_core.h>
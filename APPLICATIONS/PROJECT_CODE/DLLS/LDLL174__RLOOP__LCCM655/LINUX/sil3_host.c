@@ -0,0 +1,945 @@
+//(C) SIL3 P/L
+//Linux host stand ins for the SIL3 modules in LDLL174__RLOOP__LCCM655_SIL3.lib
+//
+//The prebuilt lib only links on WIN32, the sources of these modules are not
+//part of this tree. The CMake host build links this file instead so the FCU
+//runs headless. The numerical, CRC, fault tree and EEPROM parameter modules
+//behave as the lib does, the peripheral drivers (ethernet, safe UDP, SC16,
+//Modbus, stepper drive, MMA8451, MCP23S17) are idle devices that never fault.
+#include <localdef.h>
+#ifdef WIN32
+#ifndef _WIN32
+
+#include <math.h>
+#include <string.h>
+#include <sys/mman.h>
+
+#include <MULTICORE/LCCM012__MULTICORE__SOFTWARE_CRC/software_crc.h>
+#include <MULTICORE/LCCM118__MULTICORE__NUMERICAL/numerical.h>
+#include <MULTICORE/LCCM121__MULTICORE__MCP23S17/mcp23s17.h>
+#include <MULTICORE/LCCM188__MULTICORE__EEPROM_PARAMS/eeprom_params.h>
+#include <MULTICORE/LCCM231__MULTICORE__STEPPER_DRIVE/stepper_drive.h>
+#include <MULTICORE/LCCM284__MULTICORE__FAULT_TREE/fault_tree.h>
+#include <MULTICORE/LCCM325__MULTICORE__802_3/eth.h>
+#include <MULTICORE/LCCM418__MULTICORE__MMA8451/mma8451.h>
+#include <MULTICORE/LCCM487__MULTICORE__SC16IS741/sc16.h>
+#include <MULTICORE/LCCM528__MULTICORE__SAFE_UDP/safe_udp.h>
+#include <MULTICORE/LCCM690__MULTICORE__MODBUS/modbus.h>
+#include <RM4/LCCM124__RM4__RTI/rm4_rti.h>
+#include <RM4/LCCM663__RM4__CPU_LOAD/rm4_cpuload.h>
+
+//number of 32 bit EEPROM parameters we hold in RAM
+#define C_SIL3_HOST__EEPARAM_SIZE						(256U)
+
+//number of ethernet tx buffers
+#define C_SIL3_HOST__ETH_NUM_BUFFERS					(4U)
+
+//each buffer is the largest ethernet frame
+#define C_SIL3_HOST__ETH_BUFFER_SIZE					(1536U)
+
+//safe UDP header, type, length and sequence ahead of the payload
+#define C_SIL3_HOST__SAFEUDP_HEADER_SIZE				(8U)
+
+//RTI counter 1, the simulated clock writes this
+Luint64 u64RTI_WIN32__Counter1;
+
+//CCITT polynomial 0x1021, built on first use
+static Luint16 u16SIL3_HOST__CRCTable[256];
+static Luint8 u8SIL3_HOST__CRCTableReady = 0U;
+
+//EEPROM parameters, native 32 bit values
+static Luint32 u32SIL3_HOST__EEParam[C_SIL3_HOST__EEPARAM_SIZE];
+
+//The ethernet layer hands its buffers out as 32 bit addresses, keep them
+//in the low 4GB so the same code works on a 64 bit host
+static Luint8 *pu8SIL3_HOST__EthBuffer = 0;
+
+//one safe UDP frame, the payload goes out straight away
+static Luint8 u8SIL3_HOST__SafeUDPBuffer[C_SIL3_HOST__ETH_BUFFER_SIZE];
+
+//accel read callback from the GUI or runner
+static pSIL3_MMA8451_WIN32__ReadDataCallback_FuncType pSIL3_HOST__MMA8451_ReadData = 0;
+
+//stepper positions, the moves complete as soon as they are asked for
+static Lint32 s32SIL3_HOST__StepPosition[C_LOCALDEF__LCCM231__NUMBER_OF_MOTORS];
+
+
+/*******************************************************************************
+Software CRC (LCCM012)
+*******************************************************************************/
+//CRC16 CCITT, zero seed, same as the bitwise add and finalise
+Luint16 u16SIL3_SWCRC__CRC(const Luint8 *cpu8Data, Luint32 u32Length)
+{
+	Luint32 u32Counter;
+	Luint16 u16CRC;
+	Luint8 u8Bit;
+
+	if(u8SIL3_HOST__CRCTableReady == 0U)
+	{
+		for(u32Counter = 0U; u32Counter < 256U; u32Counter++)
+		{
+			u16CRC = (Luint16)(u32Counter << 8U);
+			for(u8Bit = 0U; u8Bit < 8U; u8Bit++)
+			{
+				if((u16CRC & 0x8000U) != 0U)
+				{
+					u16CRC = (Luint16)((u16CRC << 1U) ^ 0x1021U);
+				}
+				else
+				{
+					u16CRC = (Luint16)(u16CRC << 1U);
+				}
+			}
+			u16SIL3_HOST__CRCTable[u32Counter] = u16CRC;
+		}
+		u8SIL3_HOST__CRCTableReady = 1U;
+	}
+	else
+	{
+		//fall on
+	}
+
+	u16CRC = 0U;
+	for(u32Counter = 0U; u32Counter < u32Length; u32Counter++)
+	{
+		u16CRC = (Luint16)((u16CRC << 8U) ^ u16SIL3_HOST__CRCTable[((u16CRC >> 8U) ^ cpu8Data[u32Counter]) & 0xFFU]);
+	}
+
+	return u16CRC;
+}
+
+
+/*******************************************************************************
+Numerical (LCCM118)
+*******************************************************************************/
+//array conversions are in the native byte order of the CPU
+Luint16 u16SIL3_NUM_CONVERT__Array(const Luint8 *pu8Array)
+{
+	Luint16 u16Value;
+	memcpy(&u16Value, pu8Array, sizeof(u16Value));
+	return u16Value;
+}
+
+Lint16 s16SIL3_NUM_CONVERT__Array(const Luint8 *pu8Array)
+{
+	Lint16 s16Value;
+	memcpy(&s16Value, pu8Array, sizeof(s16Value));
+	return s16Value;
+}
+
+Luint32 u32SIL3_NUM_CONVERT__Array(const Luint8 *pu8Array)
+{
+	Luint32 u32Value;
+	memcpy(&u32Value, pu8Array, sizeof(u32Value));
+	return u32Value;
+}
+
+Lint32 s32SIL3_NUM_CONVERT__Array(const Luint8 *pu8Array)
+{
+	Lint32 s32Value;
+	memcpy(&s32Value, pu8Array, sizeof(s32Value));
+	return s32Value;
+}
+
+Lfloat32 f32SIL3_NUM_CONVERT__Array(const Luint8 *pu8Array)
+{
+	Lfloat32 f32Value;
+	memcpy(&f32Value, pu8Array, sizeof(f32Value));
+	return f32Value;
+}
+
+void vSIL3_NUM_CONVERT__Array_U16(Luint8 *pu8Array, Luint16 u16Value)
+{
+	memcpy(pu8Array, &u16Value, sizeof(u16Value));
+}
+
+void vSIL3_NUM_CONVERT__Array_S16(Luint8 *pu8Array, Lint16 s16Value)
+{
+	memcpy(pu8Array, &s16Value, sizeof(s16Value));
+}
+
+void vSIL3_NUM_CONVERT__Array_U32(Luint8 *pu8Array, Luint32 u32Value)
+{
+	memcpy(pu8Array, &u32Value, sizeof(u32Value));
+}
+
+void vSIL3_NUM_CONVERT__Array_S32(Luint8 *pu8Array, Lint32 s32Value)
+{
+	memcpy(pu8Array, &s32Value, sizeof(s32Value));
+}
+
+void vSIL3_NUM_CONVERT__Array_U64(Luint8 *pu8Array, Luint64 u64Value)
+{
+	memcpy(pu8Array, &u64Value, sizeof(u64Value));
+}
+
+void vSIL3_NUM_CONVERT__Array_F32(Luint8 *pu8Array, Lfloat32 f32Value)
+{
+	memcpy(pu8Array, &f32Value, sizeof(f32Value));
+}
+
+//moving average, when the counter wraps the newest sample goes into slot 0
+Luint16 u16SIL3_NUM_FILTERING__Add_U16(Luint16 u16Sample, Luint16 *pu16AverageCounter, Luint16 u16MaxAverageSize, Luint16 *pu16Array)
+{
+	Luint32 u32Sum;
+	Luint16 u16Counter;
+	Luint16 u16Return;
+
+	if(*pu16AverageCounter < u16MaxAverageSize)
+	{
+		pu16Array[*pu16AverageCounter] = u16Sample;
+		*pu16AverageCounter += 1U;
+	}
+	else
+	{
+		*pu16AverageCounter = 0U;
+		pu16Array[0] = u16Sample;
+	}
+
+	u32Sum = 0U;
+	for(u16Counter = 0U; u16Counter < u16MaxAverageSize; u16Counter++)
+	{
+		u32Sum += pu16Array[u16Counter];
+	}
+
+	if(u16MaxAverageSize > 0U)
+	{
+		u16Return = (Luint16)(u32Sum / u16MaxAverageSize);
+	}
+	else
+	{
+		u16Return = 0U;
+	}
+
+	return u16Return;
+}
+
+Lfloat32 f32SIL3_NUM_FLOAT__ABS(Lfloat32 f32Value)
+{
+	return fabsf(f32Value);
+}
+
+Lfloat32 f32NUMERICAL_Cosine(Lfloat32 f32Radians)
+{
+	return cosf(f32Radians);
+}
+
+Lfloat32 f32NUMERICAL_Asine(Lfloat32 f32Radians)
+{
+	return asinf(f32Radians);
+}
+
+//C = A * B, row major
+void vNUMERICAL_MATRIX__Mult(Luint32 aRows, Luint32 aCols_bRows, Luint32 bCols, Lfloat32 matrixC[], const Lfloat32 matrixA[], const Lfloat32 matrixB[])
+{
+	Luint32 u32Row;
+	Luint32 u32Col;
+	Luint32 u32Inner;
+	Lfloat32 f32Sum;
+
+	for(u32Row = 0U; u32Row < aRows; u32Row++)
+	{
+		for(u32Col = 0U; u32Col < bCols; u32Col++)
+		{
+			f32Sum = 0.0F;
+			for(u32Inner = 0U; u32Inner < aCols_bRows; u32Inner++)
+			{
+				f32Sum += matrixA[(u32Row * aCols_bRows) + u32Inner] * matrixB[(u32Inner * bCols) + u32Col];
+			}
+			matrixC[(u32Row * bCols) + u32Col] = f32Sum;
+		}
+	}
+}
+
+//C = inverse(A) by the adjugate, a singular A gives all zeros
+void vNUMERICAL_MATRIX__Inverse_3X3(Lfloat32 matrixC[9], const Lfloat32 matrixA[9])
+{
+	Lfloat32 f32Det;
+	Luint8 u8Counter;
+
+	matrixC[0] = (matrixA[4] * matrixA[8]) - (matrixA[5] * matrixA[7]);
+	matrixC[1] = (matrixA[2] * matrixA[7]) - (matrixA[1] * matrixA[8]);
+	matrixC[2] = (matrixA[1] * matrixA[5]) - (matrixA[2] * matrixA[4]);
+	matrixC[3] = (matrixA[5] * matrixA[6]) - (matrixA[3] * matrixA[8]);
+	matrixC[4] = (matrixA[0] * matrixA[8]) - (matrixA[2] * matrixA[6]);
+	matrixC[5] = (matrixA[2] * matrixA[3]) - (matrixA[0] * matrixA[5]);
+	matrixC[6] = (matrixA[3] * matrixA[7]) - (matrixA[4] * matrixA[6]);
+	matrixC[7] = (matrixA[1] * matrixA[6]) - (matrixA[0] * matrixA[7]);
+	matrixC[8] = (matrixA[0] * matrixA[4]) - (matrixA[1] * matrixA[3]);
+
+	f32Det = (matrixA[0] * matrixC[0]) + (matrixA[1] * matrixC[3]) + (matrixA[2] * matrixC[6]);
+
+	for(u8Counter = 0U; u8Counter < 9U; u8Counter++)
+	{
+		if(f32Det != 0.0F)
+		{
+			matrixC[u8Counter] /= f32Det;
+		}
+		else
+		{
+			matrixC[u8Counter] = 0.0F;
+		}
+	}
+}
+
+
+/*******************************************************************************
+Fault Tree (LCCM284)
+*******************************************************************************/
+void vSIL3_FAULTTREE__Init(FAULT_TREE__PUBLIC_T *pFaultTree)
+{
+	pFaultTree->u8FaultFlag = 0U;
+	pFaultTree->u32Flags[0] = 0U;
+	pFaultTree->u32Flags[1] = 0U;
+}
+
+void vSIL3_FAULTTREE__Set_Flag(FAULT_TREE__PUBLIC_T *pFaultTree, Luint32 u32FlagIndex)
+{
+	if(u32FlagIndex < 64U)
+	{
+		pFaultTree->u32Flags[u32FlagIndex >> 5U] |= (Luint32)1U << (u32FlagIndex & 31U);
+	}
+	else
+	{
+		//out of range, still a fault
+	}
+	pFaultTree->u8FaultFlag = 1U;
+}
+
+void vSIL3_FAULTTREE__Clear_Flag(FAULT_TREE__PUBLIC_T *pFaultTree, Luint32 u32FlagIndex)
+{
+	if(u32FlagIndex < 64U)
+	{
+		pFaultTree->u32Flags[u32FlagIndex >> 5U] &= ~((Luint32)1U << (u32FlagIndex & 31U));
+	}
+	else
+	{
+		//fall on
+	}
+
+	if((pFaultTree->u32Flags[0] | pFaultTree->u32Flags[1]) == 0U)
+	{
+		pFaultTree->u8FaultFlag = 0U;
+	}
+	else
+	{
+		//fall on
+	}
+}
+
+Luint8 u8SIL3_FAULTTREE__Get_Fault(const FAULT_TREE__PUBLIC_T *pFaultTree, Luint32 u32FlagIndex)
+{
+	Luint8 u8Return;
+
+	if(u32FlagIndex < 64U)
+	{
+		u8Return = (Luint8)((pFaultTree->u32Flags[u32FlagIndex >> 5U] >> (u32FlagIndex & 31U)) & 0x01U);
+	}
+	else
+	{
+		u8Return = 0U;
+	}
+
+	return u8Return;
+}
+
+
+/*******************************************************************************
+EEPROM Parameters (LCCM188)
+*******************************************************************************/
+//the RAM copy starts blank each time the library loads, as a fresh EEPROM
+void vSIL3_EEPARAM__Init(void)
+{
+	//nothing, the parameters live for the life of the process
+}
+
+Luint16 u16SIL3_EEPARAM__Read(Luint16 u16Index)
+{
+	return (Luint16)u32SIL3_EEPARAM__Read(u16Index);
+}
+
+Luint32 u32SIL3_EEPARAM__Read(Luint16 u16Index)
+{
+	Luint32 u32Return;
+
+	if(u16Index < C_SIL3_HOST__EEPARAM_SIZE)
+	{
+		u32Return = u32SIL3_HOST__EEParam[u16Index];
+	}
+	else
+	{
+		u32Return = 0U;
+	}
+
+	return u32Return;
+}
+
+Lint32 s32SIL3_EEPARAM__Read(Luint16 u16Index)
+{
+	return (Lint32)u32SIL3_EEPARAM__Read(u16Index);
+}
+
+Lfloat32 f32SIL3_EEPARAM__Read(Luint16 u16Index)
+{
+	Luint32 u32Value;
+	Lfloat32 f32Value;
+
+	u32Value = u32SIL3_EEPARAM__Read(u16Index);
+	memcpy(&f32Value, &u32Value, sizeof(f32Value));
+	return f32Value;
+}
+
+void vSIL3_EEPARAM__WriteU32(Luint16 u16Index, Luint32 u32Value, E_EEPROM_PARAMS__DELAY_T eDelay)
+{
+	(void)eDelay;
+	if(u16Index < C_SIL3_HOST__EEPARAM_SIZE)
+	{
+		u32SIL3_HOST__EEParam[u16Index] = u32Value;
+	}
+	else
+	{
+		//fall on
+	}
+}
+
+void vSIL3_EEPARAM__WriteU16(Luint16 u16Index, Luint16 u16Value, E_EEPROM_PARAMS__DELAY_T eDelay)
+{
+	vSIL3_EEPARAM__WriteU32(u16Index, (Luint32)u16Value, eDelay);
+}
+
+void vSIL3_EEPARAM__WriteS32(Luint16 u16Index, Lint32 s32Value, E_EEPROM_PARAMS__DELAY_T eDelay)
+{
+	vSIL3_EEPARAM__WriteU32(u16Index, (Luint32)s32Value, eDelay);
+}
+
+void vSIL3_EEPARAM__WriteF32(Luint16 u16Index, Lfloat32 f32Value, E_EEPROM_PARAMS__DELAY_T eDelay)
+{
+	Luint32 u32Value;
+
+	memcpy(&u32Value, &f32Value, sizeof(u32Value));
+	vSIL3_EEPARAM__WriteU32(u16Index, u32Value, eDelay);
+}
+
+//CRC over each parameter from start to end inclusive, MSB first
+static Luint16 u16SIL3_HOST__EEParam_CRC(Luint16 u16StartIndex, Luint16 u16EndIndex)
+{
+	Luint8 u8Array[C_SIL3_HOST__EEPARAM_SIZE * 4U];
+	Luint32 u32Length;
+	Luint32 u32Value;
+	Luint32 u32Index;
+
+	u32Length = 0U;
+	for(u32Index = u16StartIndex; (u32Index <= u16EndIndex) && (u32Index < C_SIL3_HOST__EEPARAM_SIZE); u32Index++)
+	{
+		u32Value = u32SIL3_HOST__EEParam[u32Index];
+		u8Array[u32Length + 0U] = (Luint8)(u32Value >> 24U);
+		u8Array[u32Length + 1U] = (Luint8)(u32Value >> 16U);
+		u8Array[u32Length + 2U] = (Luint8)(u32Value >> 8U);
+		u8Array[u32Length + 3U] = (Luint8)u32Value;
+		u32Length += 4U;
+	}
+
+	return u16SIL3_SWCRC__CRC(u8Array, u32Length);
+}
+
+Luint8 u8SIL3_EEPARAM_CRC__Is_CRC_OK(Luint16 u16StartIndex, Luint16 u16EndIndex, Luint16 u16CRCIndex)
+{
+	Luint8 u8Return;
+
+	if(u16SIL3_HOST__EEParam_CRC(u16StartIndex, u16EndIndex) == u16SIL3_EEPARAM__Read(u16CRCIndex))
+	{
+		u8Return = 1U;
+	}
+	else
+	{
+		u8Return = 0U;
+	}
+
+	return u8Return;
+}
+
+void vSIL3_EEPARAM_CRC__Calculate_And_Store_CRC(Luint16 u16StartIndex, Luint16 u16EndIndex, Luint16 u16CRCIndex)
+{
+	vSIL3_EEPARAM__WriteU16(u16CRCIndex, u16SIL3_HOST__EEParam_CRC(u16StartIndex, u16EndIndex), DELAY_T__IMMEDIATE_WRITE);
+}
+
+
+/*******************************************************************************
+RTI and CPU load (LCCM124, LCCM663)
+*******************************************************************************/
+Luint64 u64RM4_RTI__Get_Counter1(void)
+{
+	return u64RTI_WIN32__Counter1;
+}
+
+void vRM4_CPULOAD__Init(void)
+{
+}
+
+void vRM4_CPULOAD__Process(void)
+{
+}
+
+void vRM4_CPULOAD__While_Entry(void)
+{
+}
+
+void vRM4_CPULOAD__While_Exit(void)
+{
+}
+
+
+/*******************************************************************************
+Ethernet (LCCM325) and Safe UDP (LCCM528)
+*******************************************************************************/
+void vSIL3_ETH__Init(Luint8 * pu8MAC, Luint8 * pu8IP)
+{
+	(void)pu8MAC;
+	(void)pu8IP;
+
+#ifdef MAP_32BIT
+	if(pu8SIL3_HOST__EthBuffer == 0)
+	{
+		void *pMap;
+
+		pMap = mmap(0, C_SIL3_HOST__ETH_NUM_BUFFERS * C_SIL3_HOST__ETH_BUFFER_SIZE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_32BIT, -1, 0);
+		if(pMap != MAP_FAILED)
+		{
+			pu8SIL3_HOST__EthBuffer = (Luint8 *)pMap;
+		}
+		else
+		{
+			//raw ethernet packets will be refused
+		}
+	}
+	else
+	{
+		//fall on
+	}
+#endif
+}
+
+void vSIL3_ETH__Process(void)
+{
+}
+
+Luint8 u8SIL3_ETH_FIFO__Is_Empty(void)
+{
+	return 1U;
+}
+
+//the host has no wire, every push gets buffer 0
+Lint16 s16SIL3_ETH_FIFO__Push(Luint16 u16PacketLength)
+{
+	Lint16 s16Return;
+
+	if((pu8SIL3_HOST__EthBuffer != 0) && (u16PacketLength <= C_SIL3_HOST__ETH_BUFFER_SIZE))
+	{
+		s16Return = 0;
+	}
+	else
+	{
+		s16Return = -1;
+	}
+
+	return s16Return;
+}
+
+Luint32 u32SIL3_ETH_BUFFERDESC__Get_TxBufferPointer(Luint8 u8BufferIndex)
+{
+	Luint32 u32Return;
+
+	if((pu8SIL3_HOST__EthBuffer != 0) && (u8BufferIndex < C_SIL3_HOST__ETH_NUM_BUFFERS))
+	{
+		u32Return = (Luint32)(unsigned long)(pu8SIL3_HOST__EthBuffer + ((Luint32)u8BufferIndex * C_SIL3_HOST__ETH_BUFFER_SIZE));
+	}
+	else
+	{
+		u32Return = 0U;
+	}
+
+	return u32Return;
+}
+
+void vSIL3_ETH_UDP__Transmit(Luint16 u16Length, Luint16 u16SourcePort, Luint16 u16DestPort)
+{
+	(void)u16Length;
+	(void)u16SourcePort;
+	(void)u16DestPort;
+}
+
+void vSIL3_SAFEUDP__Init(void)
+{
+}
+
+void vSIL3_SAFEUDP__Process(void)
+{
+}
+
+void vSIL3_SAFEUDP_RX__UDPPacket(Luint8 *pu8Buffer, Luint16 u16Length, Luint16 u16DestPort)
+{
+	(void)pu8Buffer;
+	(void)u16Length;
+	(void)u16DestPort;
+}
+
+Luint16 s16SIL3_SAFEUDP_TX__PreCommit(Luint16 u16PayloadLength, SAFE_UDP__PACKET_T ePacketType, Luint8 ** pu8Buffer, Luint8 * pu8BufferIndex)
+{
+	Lint16 s16Return;
+
+	(void)ePacketType;
+	if(u16PayloadLength <= (C_SIL3_HOST__ETH_BUFFER_SIZE - C_SIL3_HOST__SAFEUDP_HEADER_SIZE))
+	{
+		*pu8Buffer = &u8SIL3_HOST__SafeUDPBuffer[C_SIL3_HOST__SAFEUDP_HEADER_SIZE];
+		*pu8BufferIndex = 0U;
+		s16Return = 0;
+	}
+	else
+	{
+		s16Return = -1;
+	}
+
+	return (Luint16)s16Return;
+}
+
+void vSIL3_SAFEUDP_TX__Commit(Luint8 u8BufferIndex, Luint16 u16PayloadLength, Luint16 u16SrcPort, Luint16 u16DestPort)
+{
+	(void)u8BufferIndex;
+	(void)u16PayloadLength;
+	(void)u16SrcPort;
+	(void)u16DestPort;
+}
+
+
+/*******************************************************************************
+SC16IS741 UART (LCCM487)
+*******************************************************************************/
+void vSIL3_SC16__Init(Luint8 u8DeviceIndex)
+{
+	(void)u8DeviceIndex;
+}
+
+void vSIL3_SC16__Process(Luint8 u8DeviceIndex)
+{
+	(void)u8DeviceIndex;
+}
+
+void vSIL3_SC16__Tx_U8Array(Luint8 u8DeviceIndex, Luint8 *pu8Data, Luint8 u8ArrayLength)
+{
+	(void)u8DeviceIndex;
+	(void)pu8Data;
+	(void)u8ArrayLength;
+}
+
+Luint32 u32SIL3_SC16__Get_FaultFlags(Luint8 u8DeviceIndex)
+{
+	(void)u8DeviceIndex;
+	return 0U;
+}
+
+Luint8 u8SIL3_SC16_USER__Get_ByteAvail(Luint8 u8DeviceIndex)
+{
+	(void)u8DeviceIndex;
+	return 0U;
+}
+
+Luint8 u8SIL3_SC16_USER__Get_Byte(Luint8 u8DeviceIndex)
+{
+	(void)u8DeviceIndex;
+	return 0U;
+}
+
+void vSIL3_SC16_BAUD__Set_BaudRate(Luint8 u8DeviceIndex, Luint8 u8InputClockFreq, Luint32 u32Baudrate, Luint8 u8Prescalar)
+{
+	(void)u8DeviceIndex;
+	(void)u8InputClockFreq;
+	(void)u32Baudrate;
+	(void)u8Prescalar;
+}
+
+void vSIL3_SC16_BAUD__Set_Stopbits(Luint8 u8DeviceIndex, Luint8 u8StopBit)
+{
+	(void)u8DeviceIndex;
+	(void)u8StopBit;
+}
+
+void vSIL3_SC16_BAUD__Set_Wordlength(Luint8 u8DeviceIndex, Luint8 u8Wordlength)
+{
+	(void)u8DeviceIndex;
+	(void)u8Wordlength;
+}
+
+void vSIL3_SC16_FIFO__Reset_Rx_FIFO(Luint8 u8DeviceIndex, Luint8 u8Reset)
+{
+	(void)u8DeviceIndex;
+	(void)u8Reset;
+}
+
+void vSIL3_SC16_FIFO__Reset_Tx_FIFO(Luint8 u8DeviceIndex, Luint8 u8Reset)
+{
+	(void)u8DeviceIndex;
+	(void)u8Reset;
+}
+
+void vSIL3_SC16_FIFO___Enable_FIFOs(Luint8 u8DeviceIndex, Luint8 u8Enable)
+{
+	(void)u8DeviceIndex;
+	(void)u8Enable;
+}
+
+void vSIL3_SC16_FLOWCONTROL__Enable_Parity(Luint8 u8DeviceIndex, Luint8 u8Enable)
+{
+	(void)u8DeviceIndex;
+	(void)u8Enable;
+}
+
+void vSIL3_SC16_FLOWCONTROL__Set_RxTrigger_Level(Luint8 u8DeviceIndex, Luint8 u8Rxlevel)
+{
+	(void)u8DeviceIndex;
+	(void)u8Rxlevel;
+}
+
+void vSIL3_SC16_INT__Enable_Rx_DataAvalibleInterupt(Luint8 u8DeviceIndex, Luint8 u8Enable)
+{
+	(void)u8DeviceIndex;
+	(void)u8Enable;
+}
+
+
+/*******************************************************************************
+Modbus master (LCCM690)
+*******************************************************************************/
+void vSIL3_MODBUS__Init(void)
+{
+}
+
+void vSIL3_MODBUS__Process(void)
+{
+}
+
+void vSIL3_MODBUS__10MS_Timer(void)
+{
+}
+
+void vSIL3_MODBUS_UART__Rx_U8(Luint8 u8Value)
+{
+	(void)u8Value;
+}
+
+Luint8 u8SIL3_MODBUS_MASTER__Get_IsBusy(void)
+{
+	return 0U;
+}
+
+Lint16 s16SIL3_MODBUS_MASTER__Get_LastErrorCode(void)
+{
+	return 0;
+}
+
+//the request goes nowhere, the slaves never answer
+Lint16 s16SIL3_MODBUS_MASTER_CMD__Slave_Reqest_Read(Luint8 u8SlaveAddx, TE_MODBUS__FUNCTION_CODE eFunction, Luint16 u16StartAddx, Luint16 u16NumRegs)
+{
+	(void)u8SlaveAddx;
+	(void)eFunction;
+	(void)u16StartAddx;
+	(void)u16NumRegs;
+	return 0;
+}
+
+void vSIL3_MODBUS_MASTER_SLAVEREGS__Set_SlaveAddx(Luint8 u8SlaveIndex, Luint8 u8SlaveAddx)
+{
+	(void)u8SlaveIndex;
+	(void)u8SlaveAddx;
+}
+
+void vSIL3_MODBUS_MASTER_SLAVEREGS__Set_RegisterAddx(Luint8 u8SlaveIndex, Luint8 u8RegIndex, Luint16 u16Addx)
+{
+	(void)u8SlaveIndex;
+	(void)u8RegIndex;
+	(void)u16Addx;
+}
+
+void vSIL3_MODBUS_MASTER_SLAVEREGS__Set_RegisterValue_Addx(Luint8 u8SlaveIndex, Luint16 u16RegAddx, Luint16 u16Value)
+{
+	(void)u8SlaveIndex;
+	(void)u16RegAddx;
+	(void)u16Value;
+}
+
+Luint16 u16SIL3_MODBUS_MASTER_SLAVEREGS__Get_RegisterValue_Addx(Luint8 u8SlaveIndex, Luint16 u16RegAddx)
+{
+	(void)u8SlaveIndex;
+	(void)u16RegAddx;
+	return 0U;
+}
+
+
+/*******************************************************************************
+Stepper drive (LCCM231)
+*******************************************************************************/
+void vSIL3_STEPDRIVE__Init(void)
+{
+	memset(s32SIL3_HOST__StepPosition, 0, sizeof(s32SIL3_HOST__StepPosition));
+}
+
+void vSIL3_STEPDRIVE__Process(void)
+{
+}
+
+Luint8 u8SIL3_STEPDRIVE__Get_TaskComplete(void)
+{
+	return 1U;
+}
+
+void vSIL3_STEPDRIVE__Clear_TaskComplete(void)
+{
+}
+
+Luint8 u8SIL3_STEPDRIVE_ACCEL__Get_AllMotorsIdle(void)
+{
+	return 1U;
+}
+
+//moves land straight away at the target
+Lint16 s16SIL3_STEPDRIVE_POSITION__Set_Position(Lint32 * ps32XYZABC_microns, Lint32 * ps32Velocity_microns_sec, Lint32 * ps32Accel_microns_ss, Luint32 u32TaskID)
+{
+	Luint8 u8Counter;
+
+	(void)ps32Velocity_microns_sec;
+	(void)ps32Accel_microns_ss;
+	(void)u32TaskID;
+	for(u8Counter = 0U; u8Counter < C_LOCALDEF__LCCM231__NUMBER_OF_MOTORS; u8Counter++)
+	{
+		s32SIL3_HOST__StepPosition[u8Counter] = ps32XYZABC_microns[u8Counter];
+	}
+
+	return 0;
+}
+
+//the host keeps microns, scaled into the 32 bit result
+Lint32 s32SIL3_STEPDRIVE_POSITION__Get_PositionPicometers(Luint8 u8AxisIndex)
+{
+	Lint32 s32Return;
+
+	if(u8AxisIndex < C_LOCALDEF__LCCM231__NUMBER_OF_MOTORS)
+	{
+		s32Return = s32SIL3_HOST__StepPosition[u8AxisIndex] * 1000;
+	}
+	else
+	{
+		s32Return = 0;
+	}
+
+	return s32Return;
+}
+
+Luint8 u8SIL3_STEPDRIVE_LIMIT__Get_Limit_Interrupt(Luint8 u8MotorIndex)
+{
+	(void)u8MotorIndex;
+	return 0U;
+}
+
+void vSIL3_STEPDRIVE_LIMIT__Limit_ISR(Luint8 u8MotorIndex)
+{
+	(void)u8MotorIndex;
+}
+
+void vSIL3_STEPDRIVE_LIMIT__Clear_Limit_ISR(Luint8 u8MotorIndex)
+{
+	(void)u8MotorIndex;
+}
+
+void vSIL3_STEPDRIVE_ZERO__Set_Zero(Luint8 u8Axis)
+{
+	if(u8Axis < C_LOCALDEF__LCCM231__NUMBER_OF_MOTORS)
+	{
+		s32SIL3_HOST__StepPosition[u8Axis] = 0;
+	}
+	else
+	{
+		//fall on
+	}
+}
+
+void vSIL3_STEPDRIVE_MEM__Set_MicroStepResolution(Luint8 u8MotorIndex, Luint8 u8Value)
+{
+	(void)u8MotorIndex;
+	(void)u8Value;
+}
+
+void vSIL3_STEPDRIVE_MEM__Set_MaxAngularAccel(Luint8 u8MotorIndex, Lint32 s32Value)
+{
+	(void)u8MotorIndex;
+	(void)s32Value;
+}
+
+void vSIL3_STEPDRIVE_MEM__Set_MicronsPerRev(Luint8 u8MotorIndex, Lint32 s32Value)
+{
+	(void)u8MotorIndex;
+	(void)s32Value;
+}
+
+void vSIL3_STEPDRIVE_MEM__Set_MaxRPM(Luint8 u8MotorIndex, Lint32 s32Value)
+{
+	(void)u8MotorIndex;
+	(void)s32Value;
+}
+
+
+/*******************************************************************************
+MMA8451 accel (LCCM418) and MCP23S17 IO (LCCM121)
+*******************************************************************************/
+void vSIL3_MMA8451__Init(Luint8 u8DeviceIndex)
+{
+	(void)u8DeviceIndex;
+}
+
+Luint32 u32SIL3_MMA8451__Get_FaultFlags(Luint8 u8DeviceIndex)
+{
+	(void)u8DeviceIndex;
+	return 0U;
+}
+
+Lint16 s16SIL3_MMA8451_FILTERING__Get_Average(Luint8 u8DeviceIndex, MMA8451__AXIS_E eAxis)
+{
+	(void)u8DeviceIndex;
+	(void)eAxis;
+	return 0;
+}
+
+void vSIL3_MMA8451_ZERO__AutoZero(Luint8 u8DeviceIndex)
+{
+	(void)u8DeviceIndex;
+}
+
+void vSIL3_MMA8451_ZERO__Set_FineZero(Luint8 u8SensorIndex, MMA8451__AXIS_E eAxis)
+{
+	(void)u8SensorIndex;
+	(void)eAxis;
+}
+
+void vSIL3_MMA8451_WIN32__Set_ReadDataCallback(pSIL3_MMA8451_WIN32__ReadDataCallback_FuncType pFunc)
+{
+	pSIL3_HOST__MMA8451_ReadData = pFunc;
+}
+
+void vSIL3_MCP23S17__Init(Luint8 u8DeviceIndex)
+{
+	(void)u8DeviceIndex;
+}
+
+void vSIL3_MCP23S17__Set_PortDirection_Output(Luint8 u8DeviceIndex, MCP23S17__PORT_E ePort)
+{
+	(void)u8DeviceIndex;
+	(void)ePort;
+}
+
+void vSIL3_MCP23S17__Set_Port(Luint8 u8DeviceIndex, MCP23S17__PORT_E ePort, Luint8 u8Value)
+{
+	(void)u8DeviceIndex;
+	(void)ePort;
+	(void)u8Value;
+}
+
+#endif //_WIN32
+#endif //WIN32
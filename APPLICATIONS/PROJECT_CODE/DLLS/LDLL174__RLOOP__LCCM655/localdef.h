@@ -140,6 +140,30 @@ SIL3 - MODBUS MASTER / SLAVE INTERFACE
 	#endif //#if C_LOCALDEF__LCCM690__ENABLE_THIS_MODULE == 1U
 
 
+/*******************************************************************************
+Hyperloop Tube Simulation Model
+*******************************************************************************/
+	#define C_LOCALDEF__LCCM666__ENABLE_THIS_MODULE							(1U)
+	#if C_LOCALDEF__LCCM666__ENABLE_THIS_MODULE == 1U
+
+		/** Testing Options */
+		#define C_LOCALDEF__LCCM666__ENABLE_TEST_SPEC						(0U)
+
+		/** Use Eth */
+		#define C_LOCALDEF__LCCM666__ENABLE_ETHERNET						(0U)
+
+		/** Hand the software track model outputs to the FCU injection paths
+		Times are ns from the start of the run */
+		#define C_LOCALDEF__LCCM666__ENABLE_TRACK_CALLBACKS					(1U)
+		#define C_LOCALDEF__LCCM666__EDGE_CALLBACK(laser, rising, time)		vFCU_WIN32__TrackSim_Edge(laser, rising, time)
+		#define C_LOCALDEF__LCCM666__RANGE_CALLBACK(range, time)			vFCU_WIN32__TrackSim_Range(range, time)
+		#define C_LOCALDEF__LCCM666__ACCEL_CALLBACK(accel, time)			vFCU_WIN32__TrackSim_Accel(accel, time)
+
+		/** Main include file */
+		#include <XILINX/LCCM666__XILINX__SIM_HYPERLOOP/sim_hyperloop.h>
+	#endif //#if C_LOCALDEF__LCCM666__ENABLE_THIS_MODULE == 1U
+
+
 /*******************************************************************************
 RLOOP - FLIGHT CONTROL UNIT - CORE
 *******************************************************************************/
@@ -152,18 +176,27 @@ RLOOP - FLIGHT CONTROL UNIT - CORE
 		/** Data Acqusition System */
 		#define C_LOCALDEF__LCCM655__ENABLE_DAQ								(1U)
 
+		/** Run the main loop tasks from the cooperative scheduler with per task timing */
+		#define C_LOCALDEF__LCCM655__ENABLE_SCHEDULER						(1U)
+
+		/** Named probe execution time profiling of the scheduler tasks and RTI ISRs, needs the scheduler */
+		#define C_LOCALDEF__LCCM655__ENABLE_PROFILE							(1U)
+
 		/** Enable the OptoNCDT laser interface */
-		#define C_LOCALDEF__LCCM655__ENABLE_LASER_OPTONCDT					(0U)
+		#define C_LOCALDEF__LCCM655__ENABLE_LASER_OPTONCDT					(1U)
 
 		/** Enable the Laser contrast sensors */
-		#define C_LOCALDEF__LCCM655__ENABLE_LASER_CONTRAST					(0U)
+		#define C_LOCALDEF__LCCM655__ENABLE_LASER_CONTRAST					(1U)
 
 		/** Laser Distance Unit */
-		#define C_LOCALDEF__LCCM655__ENABLE_LASER_DISTANCE					(0U)
+		#define C_LOCALDEF__LCCM655__ENABLE_LASER_DISTANCE					(1U)
 
 		/** Enable accel subsystem */
 		#define C_LOCALDEF__LCCM655__ENABLE_ACCEL							(1U)
 
+		/** Read the MMA8451s by FIFO burst and run the fixed point filter chain */
+		#define C_LOCALDEF__LCCM655__ENABLE_ACCEL_FIFO						(1U)
+
 		/** Enable the braking subsystems */
 		#define C_LOCALDEF__LCCM655__ENABLE_BRAKES							(1U)
 
@@ -192,7 +225,7 @@ RLOOP - FLIGHT CONTROL UNIT - CORE
 			#define C_LOCALDEF__LCCM655__ENABLE_MAIN_SM							(1U)
 
 			//Pitch/Roll/Yaw
-			#define C_LOCALDEF__LCCM655__ENABLE_FCTL_ORIENTATION				(0U)
+			#define C_LOCALDEF__LCCM655__ENABLE_FCTL_ORIENTATION				(1U)
 
 			//Brake Controller
 			#define C_LOCALDEF__LCCM655__ENABLE_FCTL_BRAKE_CONTROL				(1U)
@@ -224,11 +257,14 @@ RLOOP - FLIGHT CONTROL UNIT - CORE
 			/** Navigation function */
 			#define C_LOCALDEF__LCCM655__ENABLE_FCTL_NAVIGATION 				(1U)
 
+			/** Fuse the nav sensors in the blender */
+			#define C_LOCALDEF__LCCM655__ENABLE_FCTL_BLENDER					(1U)
+
 			/** Control Aux Propulsion */
 			#define C_LOCALDEF__LCCM655__ENABLE_AUX_PROPULSION_CONTROL 			(0U)
 
 			/** Enable PID for the Brakes */
-			#define C_LOCALDEF__LCCM655__ENABLE_BRAKEPID 						(0U)
+			#define C_LOCALDEF__LCCM655__ENABLE_BRAKEPID 						(1U)
 
 			/** Enable fault handling out ethernet */
 			#define C_LOCALDEF__LCCM655__ENABLE_ETHERNET_FAULTS                 (1U)
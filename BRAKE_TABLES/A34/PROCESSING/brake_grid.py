@@ -0,0 +1,156 @@
+#Python 2.7.13
+#Generate the fixed point brake gap grid for the FCU from the per height drag polys
+#Called from go.py, or on its own to regenerate from OUTPUT/COEFFS:
+#example: d:\python27\python.exe brake_grid.py
+#The grid is written straight into the FCU, there is no copy kept here.
+
+import glob
+import math
+import os
+
+#Where the FCU builds the grid from
+GRID_C_FILE = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', '..', '..',
+						   'FIRMWARE', 'PROJECT_CODE', 'LCCM655__RLOOP__FCU_CORE', 'FLIGHT_CONTROLLER', 'BRAKE_PROFILE', 'a34_brake_grid.c')
+
+#The grid, must match fcu_core__defines.h (the C file has safetys)
+#Velocity rows in mm/s, step is a power of 2 so the FCU can shift
+GRID_VELOC_MIN_MMS = 24576
+GRID_VELOC_SHIFT = 11
+GRID_NUM_VELOC = 68
+
+#Drag columns in N
+#The gap changes fastest at low drag (wide gaps), a single 128N step there was up to 10% out on gap.
+#So the first columns are 16N apart, then 128N for the rest. Both steps are powers of 2.
+GRID_FINE_SHIFT = 4
+GRID_NUM_FINE = 32
+GRID_DRAG_SHIFT = 7
+GRID_NUM_DRAG = 108
+
+#Gap range of the A34 data in um
+GRID_GAP_MIN_UM = 2000
+GRID_GAP_MAX_UM = 32000
+
+
+def poly_eval(coeffs, x):
+	#highest power first, same as qr_decomp
+	y = 0.0
+	for idx, coefficient in enumerate(coeffs):
+		power = len(coeffs) - idx - 1
+		y += coefficient * x**power
+	return y
+
+
+def drag_at(coeffs_for_height, veloc_ms, gap_m):
+	#drag force at a velocity and gap
+	#drag is close to exponential with gap so interpolate in log2(gap) between the height polys
+	heights = sorted(coeffs_for_height.keys())
+	drags = [max(poly_eval(coeffs_for_height[h], veloc_ms), 0.0) for h in heights]
+
+	if gap_m <= heights[0]:
+		return drags[0]
+	if gap_m >= heights[-1]:
+		return drags[-1]
+
+	for i in range(0, len(heights) - 1):
+		if gap_m <= heights[i + 1]:
+			l0 = math.log(heights[i], 2)
+			l1 = math.log(heights[i + 1], 2)
+			frac = (math.log(gap_m, 2) - l0) / (l1 - l0)
+			return drags[i] + (drags[i + 1] - drags[i]) * frac
+
+
+def gap_for_drag(coeffs_for_height, veloc_ms, drag_n):
+	#invert drag_at() by bisection, drag falls as the gap opens
+	lo = GRID_GAP_MIN_UM
+	hi = GRID_GAP_MAX_UM
+	if drag_n >= drag_at(coeffs_for_height, veloc_ms, lo / 1000000.0):
+		return lo
+	if drag_n <= drag_at(coeffs_for_height, veloc_ms, hi / 1000000.0):
+		return hi
+	for i in range(0, 40):
+		mid = (lo + hi) / 2.0
+		if drag_at(coeffs_for_height, veloc_ms, mid / 1000000.0) > drag_n:
+			lo = mid
+		else:
+			hi = mid
+	return (lo + hi) / 2.0
+
+
+def col_drag(iDrag):
+	#drag force in N of a grid column, must match the FCU lookup
+	if iDrag < GRID_NUM_FINE:
+		return iDrag << GRID_FINE_SHIFT
+	return (GRID_NUM_FINE << GRID_FINE_SHIFT) + ((iDrag - GRID_NUM_FINE) << GRID_DRAG_SHIFT)
+
+
+def build_grid(coeffs_for_height):
+	grid = []
+	for iVeloc in range(0, GRID_NUM_VELOC):
+		veloc_ms = (GRID_VELOC_MIN_MMS + (iVeloc << GRID_VELOC_SHIFT)) / 1000.0
+		row = []
+		for iDrag in range(0, GRID_NUM_DRAG):
+			gap = int(round(gap_for_drag(coeffs_for_height, veloc_ms, float(col_drag(iDrag)))))
+
+			#the FCU inverse needs every row to be monotonic
+			if len(row) > 0 and gap > row[-1]:
+				gap = row[-1]
+			row.append(gap)
+		grid.append(row)
+	return grid
+
+
+def write_brake_grid(coeffs_for_height, filename):
+	grid = build_grid(coeffs_for_height)
+
+	c_output = "//Generated by BRAKE_TABLES/A34/PROCESSING/brake_grid.py, do not edit\n"
+	c_output += "//I-Beam gap in um for [velocity][drag force]\n"
+	c_output += "//Velocity = {} + (row << {}) mm/s\n".format(GRID_VELOC_MIN_MMS, GRID_VELOC_SHIFT)
+	c_output += "//Drag = (col << {}) N for col < {}, then {} + ((col - {}) << {}) N\n".format(GRID_FINE_SHIFT, GRID_NUM_FINE, GRID_NUM_FINE << GRID_FINE_SHIFT, GRID_NUM_FINE, GRID_DRAG_SHIFT)
+	c_output += "#include \"../../fcu_core.h\"\n"
+	c_output += "#if C_LOCALDEF__LCCM655__ENABLE_THIS_MODULE == 1U\n"
+	c_output += "#if C_LOCALDEF__LCCM655__ENABLE_FLIGHT_CONTROL == 1U\n"
+	c_output += "#if C_LOCALDEF__LCCM655__ENABLE_FCTL_BRAKE_CONTROL == 1U\n\n"
+
+	#the grid has to match what the FCU thinks it is
+	checks = [('C_FCU__BRAKES__GRID_VELOC_MIN_MMS', GRID_VELOC_MIN_MMS),
+			  ('C_FCU__BRAKES__GRID_VELOC_SHIFT', GRID_VELOC_SHIFT),
+			  ('C_FCU__BRAKES__GRID_NUM_VELOC', GRID_NUM_VELOC),
+			  ('C_FCU__BRAKES__GRID_FINE_SHIFT', GRID_FINE_SHIFT),
+			  ('C_FCU__BRAKES__GRID_NUM_FINE', GRID_NUM_FINE),
+			  ('C_FCU__BRAKES__GRID_DRAG_SHIFT', GRID_DRAG_SHIFT),
+			  ('C_FCU__BRAKES__GRID_NUM_DRAG', GRID_NUM_DRAG)]
+	for name, value in checks:
+		c_output += "#if {} != {}U\n\t#error\n#endif\n".format(name, value)
+
+	c_output += "\n#ifndef WIN32\n"
+	c_output += "const Luint16 u16A34_BrakeGrid[] = {\n"
+	c_output += "#else\n"
+	c_output += "Luint16 u16A34_BrakeGrid[] = {\n"
+	c_output += "#endif\n"
+
+	rows = []
+	for row in grid:
+		rows.append(", ".join(str(x) for x in row))
+	c_output += ",\n".join(rows)
+	c_output += "};\n\n"
+
+	c_output += "#endif //C_LOCALDEF__LCCM655__ENABLE_FCTL_BRAKE_CONTROL\n"
+	c_output += "#endif //C_LOCALDEF__LCCM655__ENABLE_FLIGHT_CONTROL\n"
+	c_output += "#endif //C_LOCALDEF__LCCM655__ENABLE_THIS_MODULE\n"
+
+	with open(filename, 'w') as c_file:
+		c_file.write(c_output)
+
+
+def load_coeffs(folder):
+	#reload the polys saved by go.py
+	coeffs_for_height = {}
+	for filename in glob.glob(os.path.join(folder, 'coeffs_*.csv')):
+		height = float(os.path.basename(filename)[len('coeffs_'):-len('.csv')])
+		with open(filename, 'r') as coeff_file:
+			coeffs_for_height[height] = [float(x) for x in coeff_file.read().split()]
+	return coeffs_for_height
+
+
+if __name__ == '__main__':
+	write_brake_grid(load_coeffs('OUTPUT/COEFFS'), GRID_C_FILE)
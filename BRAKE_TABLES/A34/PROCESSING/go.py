@@ -19,6 +19,7 @@ import numpy as np
 import csv
 import pprint
 from qr import qr_decomp
+from brake_grid import write_brake_grid, GRID_C_FILE
 
 #get command line for the a34data.csv
 m_parse = argparse.ArgumentParser()
@@ -84,6 +85,9 @@ poly_degree = m_args.polyorder
 #velocity tables
 veloc_tables_for_height = {}
 
+#the drag poly for each height, used for the fixed point grid
+coeffs_for_height = {}
+
 #go through each height and compute the QR decomposition of each veloc vs drag for each height array
 for iHeight in m_unique_heights:
 
@@ -158,6 +162,7 @@ for iHeight in m_unique_heights:
 	#compute detailed data tables at say 1m/s veloc increments.
 	newname = 'OUTPUT/COEFFS/{}{:f}.csv'.format('coeffs_', iHeight)
 	np.savetxt(newname, matrixP)
+	coeffs_for_height[iHeight] = matrixP
 	
 	#create a folder for the VELOC Tables
 	#the VELOC tables are a table from 0 to 160m/s producing a brake force
@@ -310,3 +315,5 @@ c_output += "};\n"
 with open('a34_brake_table.c', 'w') as c_file:
    c_file.write(c_output)
 
+#the fixed point grid for the FCU lookup, written straight into FLIGHT_CONTROLLER/BRAKE_PROFILE
+write_brake_grid(coeffs_for_height, GRID_C_FILE)
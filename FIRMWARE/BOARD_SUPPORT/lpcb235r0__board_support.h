@@ -225,7 +225,8 @@ RM4 GIO MODULE
 			#define GIOA_PIN_6_ISR()										vRM4_GIO_ISR__DefaultRoutine() /*vSIL3_MMA8451__ISR(0U)*/
 			#define GIOA_PIN_7_ISR()										vRM4_GIO_ISR__DefaultRoutine() /*vSIL3_MMA8451__ISR(1U)*/
 
-			#define GIOB_PIN_0_ISR()										vSIL3_SC16_INT__Handle_ISR(6U)
+			//laser distance, timestamp the RX before the driver runs
+			#define GIOB_PIN_0_ISR()										(vFCU_LASERDIST__RX_ISR(), vSIL3_SC16_INT__Handle_ISR(6U))
 			#define GIOB_PIN_1_ISR()										vSIL3_SC16_INT__Handle_ISR(3U)
 			#define GIOB_PIN_2_ISR()										vRM4_GIO_ISR__DefaultRoutine()
 			#define GIOB_PIN_3_ISR()										vSIL3_SC16_INT__Handle_ISR(4U)
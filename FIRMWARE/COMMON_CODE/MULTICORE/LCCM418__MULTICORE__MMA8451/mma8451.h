@@ -29,7 +29,7 @@
 	#include <MULTICORE/LCCM418__MULTICORE__MMA8451/mma8451__register_defs.h>
 	#include <MULTICORE/LCCM418__MULTICORE__MMA8451/mma8541__fault_flags.h>
 	#include <MULTICORE/LCCM418__MULTICORE__MMA8451/mma8451__types.h>
-	#include <multicore/lccm284__multicore__fault_tree/fault_tree__public.h>
+	#include <MULTICORE/LCCM284__MULTICORE__FAULT_TREE/fault_tree__public.h>
 
 
 
@@ -39,6 +39,10 @@
         ////////////////////////////////////////////////
         SAFE_UDP__LCCM662__DAQ_STREAMING_CONTROL = 0x1200U,
 
+        //multi channel packed frames, and the schema to decode them
+        SAFE_UDP__LCCM662__DAQ_PACKED_FRAME = 0x1201U,
+        SAFE_UDP__LCCM662__DAQ_PACKED_SCHEMA = 0x1202U,
+
         //support 64 streams
         SAFE_UDP__LCCM662__DAQ_DATA_PACKET_START = 0x1210U,
         SAFE_UDP__LCCM662__DAQ_DATA_PACKET_END = 0x1290U,
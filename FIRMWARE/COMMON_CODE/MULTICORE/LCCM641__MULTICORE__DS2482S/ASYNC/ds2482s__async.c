@@ -0,0 +1,477 @@
+/**
+ * @file		DS2482S__ASYNC.C
+ * @brief		Non blocking 1-Wire transaction engine
+ * @author		Lachlan Grogan
+ * @copyright	This file contains proprietary and confidential information of
+ *				SIL3 Pty. Ltd. (ACN 123 529 064). This code may be distributed
+ *				under a license from SIL3 Pty. Ltd., and may be used, copied
+ *				and/or disclosed only pursuant to the terms of that license agreement.
+ *				This copyright notice must be retained as part of this file at all times.
+ * @copyright	This file is copyright SIL3 Pty. Ltd. 2003-2016, All Rights Reserved.
+ * @st_fileID	LCCM641R0.FILE.010
+ */
+/**
+ * @addtogroup MULTICORE
+ * @{ */
+/**
+ * @addtogroup DS2482S
+ * @ingroup MULTICORE
+ * @{ */
+/**
+ * @addtogroup DS2482S__ASYNC
+ * @ingroup DS2482S
+ * @{ */
+
+#include "../ds2482s.h"
+#if C_LOCALDEF__LCCM641__ENABLE_THIS_MODULE == 1U
+#if C_LOCALDEF__LCCM641__ENABLE_ASYNC == 1U
+
+/*lint -e934*/
+//Note 934: Taking address of near auto variable [MISRA 2004 Rule 1.2]
+
+extern struct _strDS2482S sDS2482S;
+
+//locals
+static void vDS2482S_ASYNC__Issue(Luint8 u8DeviceIndex);
+static void vDS2482S_ASYNC__Wait_Busy(Luint8 u8DeviceIndex);
+static void vDS2482S_ASYNC__Read_Data(Luint8 u8DeviceIndex);
+static void vDS2482S_ASYNC__Next_Op(Luint8 u8DeviceIndex);
+
+/***************************************************************************//**
+ * @brief
+ * Init the async transaction engine
+ *
+ * @st_funcMD5		085D64EA857C19112F473680C9315924
+ * @st_funcID		LCCM641R0.FILE.010.FUNC.001
+ */
+void vDS2482S_ASYNC__Init(void)
+{
+	Luint8 u8Counter;
+
+	sDS2482S.u32ISR_Ticks = 0U;
+	for(u8Counter = 0U; u8Counter < C_LOCALDEF__LCCM641__NUM_DEVICS; u8Counter++)
+	{
+		sDS2482S.sAsync[u8Counter].eState = DS2482S_ASYNC_STATE__IDLE;
+		sDS2482S.sAsync[u8Counter].u8NumOps = 0U;
+		sDS2482S.sAsync[u8Counter].u8OpIndex = 0U;
+		sDS2482S.sAsync[u8Counter].u32Issue_Ticks = 0U;
+		sDS2482S.sAsync[u8Counter].s16Result = 0;
+		sDS2482S.sAsync[u8Counter].u32TimeoutCount = 0U;
+	}
+}
+
+/***************************************************************************//**
+ * @brief
+ * Step every device's transaction once.
+ *
+ * @note
+ * Each step is at most one command write or one status read on the I2C (two
+ * for fetching a read byte), the 1-Wire time itself is never waited on. The
+ * devices are independent so all of the 1-Wire channels run in parallel.
+ *
+ * @st_funcMD5		6103C1A38843DF891836EC812A68A60D
+ * @st_funcID		LCCM641R0.FILE.010.FUNC.002
+ */
+void vDS2482S_ASYNC__Process(void)
+{
+	Luint8 u8Counter;
+
+	for(u8Counter = 0U; u8Counter < C_LOCALDEF__LCCM641__NUM_DEVICS; u8Counter++)
+	{
+		switch(sDS2482S.sAsync[u8Counter].eState)
+		{
+			case DS2482S_ASYNC_STATE__IDLE:
+				//nothing queued
+				break;
+
+			case DS2482S_ASYNC_STATE__ISSUE:
+				vDS2482S_ASYNC__Issue(u8Counter);
+				break;
+
+			case DS2482S_ASYNC_STATE__WAIT_BUSY:
+				vDS2482S_ASYNC__Wait_Busy(u8Counter);
+				break;
+
+			case DS2482S_ASYNC_STATE__READ_DATA:
+				vDS2482S_ASYNC__Read_Data(u8Counter);
+				break;
+
+			case DS2482S_ASYNC_STATE__DONE:
+				//wait for the user to collect the result
+				break;
+
+			default:
+				//should not get here
+				sDS2482S.sAsync[u8Counter].eState = DS2482S_ASYNC_STATE__IDLE;
+				break;
+
+		}//switch(sDS2482S.sAsync[u8Counter].eState)
+	}
+}
+
+/***************************************************************************//**
+ * @brief
+ * 10ms tick for the op timeouts
+ *
+ * @st_funcMD5		D902583F4E0076F78AFE9EE33B6C29C2
+ * @st_funcID		LCCM641R0.FILE.010.FUNC.003
+ */
+void vDS2482S_ASYNC__10MS_ISR(void)
+{
+	sDS2482S.u32ISR_Ticks++;
+}
+
+/***************************************************************************//**
+ * @brief
+ * Start building a new transaction on a device
+ *
+ * @param[in]		u8DeviceIndex			The device index on the I2C
+ * @return			0 = success\n
+ *					-1 = a transaction is still running
+ * @st_funcMD5		60BCB43CF2B2DBDE96C5D181982EF734
+ * @st_funcID		LCCM641R0.FILE.010.FUNC.004
+ */
+Lint16 s16DS2482S_ASYNC__Begin(Luint8 u8DeviceIndex)
+{
+	Lint16 s16Return;
+
+	if((sDS2482S.sAsync[u8DeviceIndex].eState == DS2482S_ASYNC_STATE__IDLE) ||
+		(sDS2482S.sAsync[u8DeviceIndex].eState == DS2482S_ASYNC_STATE__DONE))
+	{
+		sDS2482S.sAsync[u8DeviceIndex].eState = DS2482S_ASYNC_STATE__IDLE;
+		sDS2482S.sAsync[u8DeviceIndex].u8NumOps = 0U;
+		sDS2482S.sAsync[u8DeviceIndex].u8OpIndex = 0U;
+		sDS2482S.sAsync[u8DeviceIndex].s16Result = 0;
+		s16Return = 0;
+	}
+	else
+	{
+		//busy
+		s16Return = -1;
+	}
+
+	return s16Return;
+}
+
+/***************************************************************************//**
+ * @brief
+ * Queue an op on the transaction being built
+ *
+ * @param[in]		u8Data					Byte to write, ignored for reset and read
+ * @param[in]		eOp						The 1-Wire op
+ * @param[in]		u8DeviceIndex			The device index on the I2C
+ * @return			0 = success\n
+ *					-1 = the op list is full
+ * @st_funcMD5		3FB08EF7FAD235E8F07B96D4AEB4EBD2
+ * @st_funcID		LCCM641R0.FILE.010.FUNC.005
+ */
+Lint16 s16DS2482S_ASYNC__Add_Op(Luint8 u8DeviceIndex, E_DS2482S_ASYNC_OP_T eOp, Luint8 u8Data)
+{
+	Lint16 s16Return;
+	Luint8 u8Index;
+
+	u8Index = sDS2482S.sAsync[u8DeviceIndex].u8NumOps;
+	if(u8Index < C_DS2482S__ASYNC_MAX_OPS)
+	{
+		sDS2482S.sAsync[u8DeviceIndex].eOp[u8Index] = eOp;
+		sDS2482S.sAsync[u8DeviceIndex].u8Data[u8Index] = u8Data;
+		sDS2482S.sAsync[u8DeviceIndex].u8NumOps++;
+		s16Return = 0;
+	}
+	else
+	{
+		s16Return = -1;
+	}
+
+	return s16Return;
+}
+
+/***************************************************************************//**
+ * @brief
+ * Queue a match ROM, same as s16DS2482S_1WIRE__SelectDevice()
+ *
+ * @param[in]		*pu8Addx				8 byte ROM ID
+ * @param[in]		u8DeviceIndex			The device index on the I2C
+ * @return			0 = success\n
+ *					-1 = the op list is full
+ * @st_funcMD5		98AD7E2F32FC094B9D4C8BABD59F3000
+ * @st_funcID		LCCM641R0.FILE.010.FUNC.006
+ */
+Lint16 s16DS2482S_ASYNC__Add_Select(Luint8 u8DeviceIndex, const Luint8 *pu8Addx)
+{
+	Lint16 s16Return;
+	Luint8 u8Counter;
+
+	//match ROM
+	s16Return = s16DS2482S_ASYNC__Add_Op(u8DeviceIndex, DS2482S_ASYNC_OP__WRITE_BYTE, 0x55U);
+	for(u8Counter = 0U; u8Counter < 8U; u8Counter++)
+	{
+		if(s16Return >= 0)
+		{
+			s16Return = s16DS2482S_ASYNC__Add_Op(u8DeviceIndex, DS2482S_ASYNC_OP__WRITE_BYTE, pu8Addx[u8Counter]);
+		}
+		else
+		{
+			//fall on with the error
+		}
+	}
+
+	return s16Return;
+}
+
+/***************************************************************************//**
+ * @brief
+ * Hand the built transaction to the engine
+ *
+ * @param[in]		u8DeviceIndex			The device index on the I2C
+ * @st_funcMD5		CB8DA961698DAFFC74FCE56339D5E35E
+ * @st_funcID		LCCM641R0.FILE.010.FUNC.007
+ */
+void vDS2482S_ASYNC__Start(Luint8 u8DeviceIndex)
+{
+	if(sDS2482S.sAsync[u8DeviceIndex].eState == DS2482S_ASYNC_STATE__IDLE)
+	{
+		if(sDS2482S.sAsync[u8DeviceIndex].u8NumOps > 0U)
+		{
+			sDS2482S.sAsync[u8DeviceIndex].eState = DS2482S_ASYNC_STATE__ISSUE;
+		}
+		else
+		{
+			//nothing to do
+			sDS2482S.sAsync[u8DeviceIndex].eState = DS2482S_ASYNC_STATE__DONE;
+		}
+	}
+	else
+	{
+		//not built with Begin()
+	}
+}
+
+/***************************************************************************//**
+ * @brief
+ * Is a transaction still running on the device?
+ *
+ * @param[in]		u8DeviceIndex			The device index on the I2C
+ * @return			1 = busy\n
+ *					0 = idle or done
+ * @st_funcMD5		1A0559FF5A19EF34F8185ACF9F797FA0
+ * @st_funcID		LCCM641R0.FILE.010.FUNC.008
+ */
+Luint8 u8DS2482S_ASYNC__Is_Busy(Luint8 u8DeviceIndex)
+{
+	Luint8 u8Return;
+
+	if((sDS2482S.sAsync[u8DeviceIndex].eState == DS2482S_ASYNC_STATE__IDLE) ||
+		(sDS2482S.sAsync[u8DeviceIndex].eState == DS2482S_ASYNC_STATE__DONE))
+	{
+		u8Return = 0U;
+	}
+	else
+	{
+		u8Return = 1U;
+	}
+
+	return u8Return;
+}
+
+/***************************************************************************//**
+ * @brief
+ * Result of the last transaction
+ *
+ * @param[in]		u8DeviceIndex			The device index on the I2C
+ * @return			0 = success\n
+ *					-1 = I2C fault or timeout\n
+ *					-10 = bus short\n
+ *					-11 = no presence pulse
+ * @st_funcMD5		32B649D44D0CFE62EE8BF25F7B28CCD2
+ * @st_funcID		LCCM641R0.FILE.010.FUNC.009
+ */
+Lint16 s16DS2482S_ASYNC__Get_Result(Luint8 u8DeviceIndex)
+{
+	return sDS2482S.sAsync[u8DeviceIndex].s16Result;
+}
+
+/***************************************************************************//**
+ * @brief
+ * Get the byte read back by a read op
+ *
+ * @param[in]		u8OpIndex				Index of the op in the order it was added
+ * @param[in]		u8DeviceIndex			The device index on the I2C
+ * @st_funcMD5		0B619EB699D7B2BA86B18483B875B3AA
+ * @st_funcID		LCCM641R0.FILE.010.FUNC.010
+ */
+Luint8 u8DS2482S_ASYNC__Get_Data(Luint8 u8DeviceIndex, Luint8 u8OpIndex)
+{
+	Luint8 u8Return;
+
+	if(u8OpIndex < C_DS2482S__ASYNC_MAX_OPS)
+	{
+		u8Return = sDS2482S.sAsync[u8DeviceIndex].u8Data[u8OpIndex];
+	}
+	else
+	{
+		u8Return = 0U;
+	}
+
+	return u8Return;
+}
+
+//send the command for the current op, the read pointer is left on the status register
+static void vDS2482S_ASYNC__Issue(Luint8 u8DeviceIndex)
+{
+	Lint16 s16Return;
+	Luint8 u8Index;
+
+	u8Index = sDS2482S.sAsync[u8DeviceIndex].u8OpIndex;
+	switch(sDS2482S.sAsync[u8DeviceIndex].eOp[u8Index])
+	{
+		case DS2482S_ASYNC_OP__RESET:
+			s16Return = s16DS2482S_LOWLEVEL__TxReg(u8DeviceIndex, DS2482_REGS__COMMAND_1_WIRE_RESET);
+			break;
+
+		case DS2482S_ASYNC_OP__WRITE_BYTE:
+			s16Return = s16DS2482S_LOWLEVEL__WriteReg(u8DeviceIndex, DS2482_REGS__COMMAND_1_WIRE_WRITE_BYTE, sDS2482S.sAsync[u8DeviceIndex].u8Data[u8Index]);
+			break;
+
+		case DS2482S_ASYNC_OP__READ_BYTE:
+			s16Return = s16DS2482S_LOWLEVEL__TxReg(u8DeviceIndex, DS2482_REGS__COMMAND_1_WIRE_READ_BYTE);
+			break;
+
+		default:
+			s16Return = -1;
+			break;
+	}
+
+	if(s16Return >= 0)
+	{
+		sDS2482S.sAsync[u8DeviceIndex].u32Issue_Ticks = sDS2482S.u32ISR_Ticks;
+		sDS2482S.sAsync[u8DeviceIndex].eState = DS2482S_ASYNC_STATE__WAIT_BUSY;
+	}
+	else
+	{
+		//I2C fault, abandon the transaction
+		vSIL3_FAULTTREE__Set_Flag(&sDS2482S.sDevice[u8DeviceIndex].sFaultFlags, C_LCCM641__CORE__FAULT_INDEX__00);
+		sDS2482S.sAsync[u8DeviceIndex].s16Result = -1;
+		sDS2482S.sAsync[u8DeviceIndex].eState = DS2482S_ASYNC_STATE__DONE;
+	}
+}
+
+//one status read, come back next time if the 1-Wire is still going
+static void vDS2482S_ASYNC__Wait_Busy(Luint8 u8DeviceIndex)
+{
+	Lint16 s16Return;
+	Luint8 u8Status;
+	Luint32 u32Elapsed;
+
+	u8Status = 0U;
+	s16Return = s16DS2482S_LOWLEVEL__RxReg(u8DeviceIndex, &u8Status);
+	if(s16Return >= 0)
+	{
+		if((u8Status & 0x01U) == 0x00U)
+		{
+			//1WB clear, op is complete
+			switch(sDS2482S.sAsync[u8DeviceIndex].eOp[sDS2482S.sAsync[u8DeviceIndex].u8OpIndex])
+			{
+				case DS2482S_ASYNC_OP__RESET:
+					if((u8Status & 0x04U) != 0x00U)
+					{
+						//bus short circuit
+						sDS2482S.sAsync[u8DeviceIndex].s16Result = -10;
+						sDS2482S.sAsync[u8DeviceIndex].eState = DS2482S_ASYNC_STATE__DONE;
+					}
+					else if((u8Status & 0x02U) == 0x00U)
+					{
+						//nobody on the wire
+						sDS2482S.sAsync[u8DeviceIndex].s16Result = -11;
+						sDS2482S.sAsync[u8DeviceIndex].eState = DS2482S_ASYNC_STATE__DONE;
+					}
+					else
+					{
+						vDS2482S_ASYNC__Next_Op(u8DeviceIndex);
+					}
+					break;
+
+				case DS2482S_ASYNC_OP__READ_BYTE:
+					sDS2482S.sAsync[u8DeviceIndex].eState = DS2482S_ASYNC_STATE__READ_DATA;
+					break;
+
+				default:
+					vDS2482S_ASYNC__Next_Op(u8DeviceIndex);
+					break;
+			}
+		}
+		else
+		{
+			//still busy, check for a hung bus
+			u32Elapsed = sDS2482S.u32ISR_Ticks - sDS2482S.sAsync[u8DeviceIndex].u32Issue_Ticks;
+			if(u32Elapsed > C_LOCALDEF__LCCM641__ASYNC_TIMEOUT_TICKS)
+			{
+				sDS2482S.sAsync[u8DeviceIndex].u32TimeoutCount++;
+				sDS2482S.sAsync[u8DeviceIndex].s16Result = -1;
+				sDS2482S.sAsync[u8DeviceIndex].eState = DS2482S_ASYNC_STATE__DONE;
+			}
+			else
+			{
+				//come back later
+			}
+		}
+	}
+	else
+	{
+		vSIL3_FAULTTREE__Set_Flag(&sDS2482S.sDevice[u8DeviceIndex].sFaultFlags, C_LCCM641__CORE__FAULT_INDEX__00);
+		sDS2482S.sAsync[u8DeviceIndex].s16Result = -1;
+		sDS2482S.sAsync[u8DeviceIndex].eState = DS2482S_ASYNC_STATE__DONE;
+	}
+}
+
+//fetch the read byte into the op data
+static void vDS2482S_ASYNC__Read_Data(Luint8 u8DeviceIndex)
+{
+	Lint16 s16Return;
+	Luint8 u8Index;
+
+	u8Index = sDS2482S.sAsync[u8DeviceIndex].u8OpIndex;
+	s16Return = s16DS2482S_DEVICE__Read_Byte(u8DeviceIndex, &sDS2482S.sAsync[u8DeviceIndex].u8Data[u8Index]);
+	if(s16Return >= 0)
+	{
+		vDS2482S_ASYNC__Next_Op(u8DeviceIndex);
+	}
+	else
+	{
+		vSIL3_FAULTTREE__Set_Flag(&sDS2482S.sDevice[u8DeviceIndex].sFaultFlags, C_LCCM641__CORE__FAULT_INDEX__00);
+		sDS2482S.sAsync[u8DeviceIndex].s16Result = -1;
+		sDS2482S.sAsync[u8DeviceIndex].eState = DS2482S_ASYNC_STATE__DONE;
+	}
+}
+
+//move on, or finish
+static void vDS2482S_ASYNC__Next_Op(Luint8 u8DeviceIndex)
+{
+	sDS2482S.sAsync[u8DeviceIndex].u8OpIndex++;
+	if(sDS2482S.sAsync[u8DeviceIndex].u8OpIndex < sDS2482S.sAsync[u8DeviceIndex].u8NumOps)
+	{
+		sDS2482S.sAsync[u8DeviceIndex].eState = DS2482S_ASYNC_STATE__ISSUE;
+	}
+	else
+	{
+		sDS2482S.sAsync[u8DeviceIndex].s16Result = 0;
+		sDS2482S.sAsync[u8DeviceIndex].eState = DS2482S_ASYNC_STATE__DONE;
+	}
+}
+
+/*lint +e934*/
+
+//safetys
+#ifndef C_LOCALDEF__LCCM641__ASYNC_TIMEOUT_TICKS
+	#error
+#endif
+
+#endif //#if C_LOCALDEF__LCCM641__ENABLE_ASYNC == 1U
+#endif //#if C_LOCALDEF__LCCM641__ENABLE_THIS_MODULE == 1U
+//safetys
+#ifndef C_LOCALDEF__LCCM641__ENABLE_THIS_MODULE
+	#error
+#endif
+/** @} */
+/** @} */
+/** @} */
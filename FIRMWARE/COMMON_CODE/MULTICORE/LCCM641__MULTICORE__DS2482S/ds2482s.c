@@ -34,7 +34,7 @@ struct _strDS2482S sDS2482S;
  * Init the DS2482 device
  * User should call this first up after the I2C driver is operational.
  * 
- * @st_funcMD5		84B03F177A28004719FBAB95581F4291
+ * @st_funcMD5		64F89A0DE65AB326934FAF7ED4DF3EA8
  * @st_funcID		LCCM641R0.FILE.000.FUNC.001
  */
 void vDS2482S__Init(void)
@@ -49,6 +49,11 @@ void vDS2482S__Init(void)
 	//Note 15: I2C communication should not take place for the max tOSCWUP time following a power-on reset.
 	vDS18B20_DELAYS__Delay_uS(100U);
 
+	#if C_LOCALDEF__LCCM641__ENABLE_ASYNC == 1U
+		//clear the transaction engine
+		vDS2482S_ASYNC__Init();
+	#endif
+
 	//go through the devices.
 	for(u8Counter = 0U; u8Counter < C_LOCALDEF__LCCM641__NUM_DEVICS; u8Counter++)
 	{
@@ -98,13 +103,16 @@ void vDS2482S__Init(void)
  * Process any DS2482 tasks.
  * The user should call this in their main program loop as fast as possible.
  * 
- * @st_funcMD5		88AB41C00C534DD2DCE01D8AF6B0FECE
+ * @st_funcMD5		BE4C9BCCDA17795A83DD9EEFDC4441A6
  * @st_funcID		LCCM641R0.FILE.000.FUNC.002
  */
 void vDS2482S__Process(void)
 {
 
-	//nothing here
+	#if C_LOCALDEF__LCCM641__ENABLE_ASYNC == 1U
+		//step any 1-Wire transactions
+		vDS2482S_ASYNC__Process();
+	#endif
 
 }
 
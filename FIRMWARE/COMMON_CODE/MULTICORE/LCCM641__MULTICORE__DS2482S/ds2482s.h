@@ -22,6 +22,7 @@
 		/*lint -e950*/
 		#include <MULTICORE/LCCM641__MULTICORE__DS2482S/ds2482s__fault_flags.h>
 		#include <MULTICORE/LCCM641__MULTICORE__DS2482S/ds2482s__reg_defs.h>
+		#include <MULTICORE/LCCM641__MULTICORE__DS2482S/ds2482s__state_types.h>
 		#include <MULTICORE/LCCM284__MULTICORE__FAULT_TREE/fault_tree__public.h>
 
 
@@ -29,7 +30,8 @@
 		/*******************************************************************************
 		Defines
 		*******************************************************************************/
-
+		/** Max 1-Wire ops in one async transaction, a scratchpad read by ROM ID needs 20 */
+		#define C_DS2482S__ASYNC_MAX_OPS											(24U)
 
 		/*******************************************************************************
 		Structures
@@ -70,6 +72,43 @@
 
 			}sDevice[C_LOCALDEF__LCCM641__NUM_DEVICS];
 
+		#if C_LOCALDEF__LCCM641__ENABLE_ASYNC == 1U
+			/** Async transaction engine, one transaction in flight per device */
+			struct
+			{
+				/** Current state */
+				E_DS2482S_ASYNC_STATE_T eState;
+
+				/** The queued ops */
+				E_DS2482S_ASYNC_OP_T eOp[C_DS2482S__ASYNC_MAX_OPS];
+
+				/** Byte to write, or the byte read back for a read op */
+				Luint8 u8Data[C_DS2482S__ASYNC_MAX_OPS];
+
+				/** Number of ops queued */
+				Luint8 u8NumOps;
+
+				/** The op being worked on */
+				Luint8 u8OpIndex;
+
+				/** ISR tick count when the current op was issued */
+				Luint32 u32Issue_Ticks;
+
+				/** 0 = success\n
+				 * -1 = I2C fault or timeout\n
+				 * -10 = bus short\n
+				 * -11 = no presence pulse */
+				Lint16 s16Result;
+
+				/** Ops that never cleared 1WB */
+				Luint32 u32TimeoutCount;
+
+			}sAsync[C_LOCALDEF__LCCM641__NUM_DEVICS];
+
+			/** Count of 10ms ISR's, used for the async timeouts */
+			Luint32 u32ISR_Ticks;
+		#endif
+
 		};
 
 
@@ -82,6 +121,18 @@
 		Luint32 u32DS2482S__Get_FaultFlags(Luint8 u8DeviceIndex);
 		Luint8 u8DS2482S_USER__1Wire_Reset(Luint8 u8DeviceIndex);
 
+		//async
+		void vDS2482S_ASYNC__Init(void);
+		void vDS2482S_ASYNC__Process(void);
+		void vDS2482S_ASYNC__10MS_ISR(void);
+		Lint16 s16DS2482S_ASYNC__Begin(Luint8 u8DeviceIndex);
+		Lint16 s16DS2482S_ASYNC__Add_Op(Luint8 u8DeviceIndex, E_DS2482S_ASYNC_OP_T eOp, Luint8 u8Data);
+		Lint16 s16DS2482S_ASYNC__Add_Select(Luint8 u8DeviceIndex, const Luint8 *pu8Addx);
+		void vDS2482S_ASYNC__Start(Luint8 u8DeviceIndex);
+		Luint8 u8DS2482S_ASYNC__Is_Busy(Luint8 u8DeviceIndex);
+		Lint16 s16DS2482S_ASYNC__Get_Result(Luint8 u8DeviceIndex);
+		Luint8 u8DS2482S_ASYNC__Get_Data(Luint8 u8DeviceIndex, Luint8 u8OpIndex);
+
 
 		//device
 		Lint16 s16DS2482S_DEVICE__Reset(Luint8 u8DeviceIndex);
@@ -120,6 +171,9 @@
 		#ifndef C_LOCALDEF__LCCM641__NUM_DEVICS
 			#error
 		#endif
+		#ifndef C_LOCALDEF__LCCM641__ENABLE_ASYNC
+			#error
+		#endif
 
 	#endif //#if C_LOCALDEF__LCCM641__ENABLE_THIS_MODULE == 1U
 	//safetys
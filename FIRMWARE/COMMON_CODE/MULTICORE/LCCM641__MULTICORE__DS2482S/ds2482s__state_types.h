@@ -0,0 +1,52 @@
+/**
+ * @file		DS2482S__STATE_TYPES.H
+ * @brief		State types for the async 1-Wire transaction engine
+ * @author		Lachlan Grogan
+ * @copyright	This file contains proprietary and confidential information of
+ *				SIL3 Pty. Ltd. (ACN 123 529 064). This code may be distributed
+ *				under a license from SIL3 Pty. Ltd., and may be used, copied
+ *				and/or disclosed only pursuant to the terms of that license agreement.
+ *				This copyright notice must be retained as part of this file at all times.
+ * @copyright	This file is copyright SIL3 Pty. Ltd. 2003-2016, All Rights Reserved.
+ * @st_fileID	LCCM641R0.FILE.009
+ */
+
+#ifndef _DS2482S__STATE_TYPES_H_
+#define _DS2482S__STATE_TYPES_H_
+
+	/** Async transaction states, one per device */
+	typedef enum
+	{
+		/** Nothing in flight, a new transaction can be built */
+		DS2482S_ASYNC_STATE__IDLE = 0U,
+
+		/** Send the command for the current op */
+		DS2482S_ASYNC_STATE__ISSUE,
+
+		/** Poll the status register until 1WB clears */
+		DS2482S_ASYNC_STATE__WAIT_BUSY,
+
+		/** Fetch the result of a 1-Wire read byte */
+		DS2482S_ASYNC_STATE__READ_DATA,
+
+		/** Transaction finished, the result is ready */
+		DS2482S_ASYNC_STATE__DONE
+
+	}E_DS2482S_ASYNC_STATE_T;
+
+
+	/** 1-Wire ops that can be queued in a transaction */
+	typedef enum
+	{
+		/** Reset / presence detect */
+		DS2482S_ASYNC_OP__RESET = 0U,
+
+		/** Write the op data byte */
+		DS2482S_ASYNC_OP__WRITE_BYTE,
+
+		/** Read a byte into the op data */
+		DS2482S_ASYNC_OP__READ_BYTE
+
+	}E_DS2482S_ASYNC_OP_T;
+
+#endif //_DS2482S__STATE_TYPES_H_
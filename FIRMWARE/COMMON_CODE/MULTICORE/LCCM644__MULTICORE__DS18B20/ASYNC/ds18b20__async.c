@@ -0,0 +1,296 @@
+/**
+ * @file		DS18B20__ASYNC.C
+ * @brief		Non blocking conversion and scratchpad reads via the DS2482S
+ * @author		Lachlan Grogan
+ * @copyright	This file contains proprietary and confidential information of
+ *				SIL3 Pty. Ltd. (ACN 123 529 064). This code may be distributed
+ *				under a license from SIL3 Pty. Ltd., and may be used, copied
+ *				and/or disclosed only pursuant to the terms of that license agreement.
+ *				This copyright notice must be retained as part of this file at all times.
+ * @copyright	This file is copyright SIL3 Pty. Ltd. 2003-2016, All Rights Reserved.
+ * @st_fileID	LCCM644R0.FILE.010
+ */
+/**
+ * @addtogroup MULTICORE
+ * @{ */
+/**
+ * @addtogroup DS18B20
+ * @ingroup MULTICORE
+ * @{ */
+/**
+ * @addtogroup DS18B20__ASYNC
+ * @ingroup DS18B20
+ * @{ */
+
+#include "../ds18b20.h"
+#if C_LOCALDEF__LCCM644__ENABLE_THIS_MODULE == 1U
+#if C_LOCALDEF__LCCM644__USE_ASYNC == 1U
+
+extern struct _strDS18B20 sDS18B20;
+
+//op index of the first scratchpad byte: reset, match ROM + 8, read scratchpad
+#define C_DS18B20__ASYNC_SCRATCH_OP											(11U)
+
+//locals
+static Lint16 s16DS18B20_ASYNC__Start_Read(Luint8 u8ChannelIndex, Luint16 u16SensorIndex);
+static void vDS18B20_ASYNC__Collect(Luint8 u8ChannelIndex);
+
+/***************************************************************************//**
+ * @brief
+ * Init the async scan
+ *
+ * @st_funcMD5		420C6D40D13A5441D50C88E1DBCC7C67
+ * @st_funcID		LCCM644R0.FILE.010.FUNC.001
+ */
+void vDS18B20_ASYNC__Init(void)
+{
+	Luint8 u8Counter;
+
+	sDS18B20.eAsyncRead = DS18B20_ASYNC_READ__TEMPERATURE;
+	for(u8Counter = 0U; u8Counter < C_LOCALDEF__LCCM644__MAX_1WIRE_CHANNELS; u8Counter++)
+	{
+		sDS18B20.sAsync[u8Counter].u16SensorIndex = 0U;
+		sDS18B20.sAsync[u8Counter].u8Pending = 0U;
+		sDS18B20.sAsync[u8Counter].u32ReadFaultCount = 0U;
+	}
+}
+
+/***************************************************************************//**
+ * @brief
+ * Queue a skip ROM + convert T on every channel.
+ * The channels run at the same time, the caller times the conversion.
+ *
+ * @return			0 = success\n
+ *					-1 = a channel was still busy or the queue failed
+ * @st_funcMD5		BCF4BF12B01B716996B97B063CE86803
+ * @st_funcID		LCCM644R0.FILE.010.FUNC.002
+ */
+Lint16 s16DS18B20_ASYNC__Start_ConvertAll(void)
+{
+	Lint16 s16Return;
+	Lint16 s16Test;
+	Luint8 u8Counter;
+
+	s16Return = 0;
+	for(u8Counter = 0U; u8Counter < C_LOCALDEF__LCCM644__MAX_1WIRE_CHANNELS; u8Counter++)
+	{
+		s16Test = s16DS2482S_ASYNC__Begin(u8Counter);
+		if(s16Test >= 0)
+		{
+			//reset, skip ROM, convert T, the op list always has room for these
+			(void)s16DS2482S_ASYNC__Add_Op(u8Counter, DS2482S_ASYNC_OP__RESET, 0U);
+			(void)s16DS2482S_ASYNC__Add_Op(u8Counter, DS2482S_ASYNC_OP__WRITE_BYTE, 0xCCU);
+			(void)s16DS2482S_ASYNC__Add_Op(u8Counter, DS2482S_ASYNC_OP__WRITE_BYTE, 0x44U);
+			vDS2482S_ASYNC__Start(u8Counter);
+		}
+		else
+		{
+			//still reading
+			s16Return = -1;
+		}
+	}
+
+	return s16Return;
+}
+
+/***************************************************************************//**
+ * @brief
+ * Start reading the scratchpad of every sensor, one sensor at a time per channel
+ *
+ * @param[in]		eRead					What to do with the scratchpads
+ * @st_funcMD5		193EEDE6BDA35A4CEE692E2F3258B658
+ * @st_funcID		LCCM644R0.FILE.010.FUNC.003
+ */
+void vDS18B20_ASYNC__Start_Scan(E_DS18B20_ASYNC_READ_T eRead)
+{
+	Luint8 u8Counter;
+
+	sDS18B20.eAsyncRead = eRead;
+	for(u8Counter = 0U; u8Counter < C_LOCALDEF__LCCM644__MAX_1WIRE_CHANNELS; u8Counter++)
+	{
+		sDS18B20.sAsync[u8Counter].u16SensorIndex = 0U;
+		sDS18B20.sAsync[u8Counter].u8Pending = 0U;
+	}
+}
+
+/***************************************************************************//**
+ * @brief
+ * Move the scan along, call from vDS18B20__Process()
+ *
+ * @note
+ * When a channel is free its last read is collected and the next sensor on
+ * that channel is queued. Nothing here waits on the wire.
+ *
+ * @return			1 = every sensor on every channel has been read\n
+ *					0 = still going
+ * @st_funcMD5		587DEE19A624CFA479E4CBA1E5666E92
+ * @st_funcID		LCCM644R0.FILE.010.FUNC.004
+ */
+Luint8 u8DS18B20_ASYNC__Scan_Process(void)
+{
+	Luint8 u8Counter;
+	Luint8 u8Return;
+	Luint8 u8Test;
+	Lint16 s16Return;
+	Luint16 u16Index;
+
+	u8Return = 1U;
+	for(u8Counter = 0U; u8Counter < C_LOCALDEF__LCCM644__MAX_1WIRE_CHANNELS; u8Counter++)
+	{
+		u8Test = u8DS2482S_ASYNC__Is_Busy(u8Counter);
+		if(u8Test == 0U)
+		{
+			if(sDS18B20.sAsync[u8Counter].u8Pending == 1U)
+			{
+				vDS18B20_ASYNC__Collect(u8Counter);
+				sDS18B20.sAsync[u8Counter].u8Pending = 0U;
+				sDS18B20.sAsync[u8Counter].u16SensorIndex++;
+			}
+			else
+			{
+				//nothing to pick up
+			}
+
+			//next sensor on this channel
+			u16Index = sDS18B20.sAsync[u8Counter].u16SensorIndex;
+			while((u16Index < sDS18B20.sEnum.u16NumDevices) && (sDS18B20.sDevice[u16Index].u8ChannelIndex != u8Counter))
+			{
+				u16Index++;
+			}
+			sDS18B20.sAsync[u8Counter].u16SensorIndex = u16Index;
+
+			if(u16Index < sDS18B20.sEnum.u16NumDevices)
+			{
+				s16Return = s16DS18B20_ASYNC__Start_Read(u8Counter, u16Index);
+				if(s16Return >= 0)
+				{
+					sDS18B20.sAsync[u8Counter].u8Pending = 1U;
+				}
+				else
+				{
+					//skip it
+					sDS18B20.sAsync[u8Counter].u32ReadFaultCount++;
+					sDS18B20.sAsync[u8Counter].u16SensorIndex++;
+				}
+				u8Return = 0U;
+			}
+			else
+			{
+				//this channel is done
+			}
+		}
+		else
+		{
+			//wire is busy
+			u8Return = 0U;
+		}
+	}
+
+	return u8Return;
+}
+
+//queue a reset, match ROM, read scratchpad and 9 reads
+static Lint16 s16DS18B20_ASYNC__Start_Read(Luint8 u8ChannelIndex, Luint16 u16SensorIndex)
+{
+	Lint16 s16Return;
+	Luint8 u8Counter;
+
+	s16Return = s16DS2482S_ASYNC__Begin(u8ChannelIndex);
+	if(s16Return >= 0)
+	{
+		//20 ops, C_DS2482S__ASYNC_MAX_OPS is checked below
+		(void)s16DS2482S_ASYNC__Add_Op(u8ChannelIndex, DS2482S_ASYNC_OP__RESET, 0U);
+		(void)s16DS2482S_ASYNC__Add_Select(u8ChannelIndex, &sDS18B20.sDevice[u16SensorIndex].u8SerialNumber[0]);
+		(void)s16DS2482S_ASYNC__Add_Op(u8ChannelIndex, DS2482S_ASYNC_OP__WRITE_BYTE, 0xBEU);
+		for(u8Counter = 0U; u8Counter < C_DS18B20__SCRATCHPAD_SIZE; u8Counter++)
+		{
+			(void)s16DS2482S_ASYNC__Add_Op(u8ChannelIndex, DS2482S_ASYNC_OP__READ_BYTE, 0U);
+		}
+		vDS2482S_ASYNC__Start(u8ChannelIndex);
+	}
+	else
+	{
+		//fall on with the error
+	}
+
+	return s16Return;
+}
+
+//pick up the scratchpad of the sensor just read on a channel
+static void vDS18B20_ASYNC__Collect(Luint8 u8ChannelIndex)
+{
+	Lint16 s16Return;
+	Luint8 u8Counter;
+	Luint8 u8CRC;
+	Luint16 u16SensorIndex;
+
+	u16SensorIndex = sDS18B20.sAsync[u8ChannelIndex].u16SensorIndex;
+	s16Return = s16DS2482S_ASYNC__Get_Result(u8ChannelIndex);
+	if(s16Return >= 0)
+	{
+		for(u8Counter = 0U; u8Counter < C_DS18B20__SCRATCHPAD_SIZE; u8Counter++)
+		{
+			sDS18B20.u8TempScratch[u8Counter] = u8DS2482S_ASYNC__Get_Data(u8ChannelIndex, C_DS18B20__ASYNC_SCRATCH_OP + u8Counter);
+		}
+
+		u8CRC = u8DS18B20_SCRATCH__Compute_CRC(&sDS18B20.u8TempScratch[0]);
+		if(u8CRC == sDS18B20.u8TempScratch[8U])
+		{
+			if(sDS18B20.eAsyncRead == DS18B20_ASYNC_READ__TEMPERATURE)
+			{
+				vDS18B20_TEMP__Scratch_To_Temp(u16SensorIndex, &sDS18B20.u8TempScratch[0], &sDS18B20.sTemp[u16SensorIndex].f32Temperature);
+			#if C_LOCALDEF__LCCM644__ENABLE_TEMP_CALLBACK == 1U
+				C_LOCALDEF__LCCM644__TEMP_CALLBACK(u16SensorIndex);
+			#endif
+			}
+			else if(sDS18B20.sDevice[u16SensorIndex].u8SerialNumber[0] != 0x3BU)
+			{
+				sDS18B20.sDevice[u16SensorIndex].u8Resolution = u8DS18B20_TEMP__Config_To_Resolution(sDS18B20.u8TempScratch[4U]);
+			}
+			else
+			{
+				//thermocouples keep their user ID where the resolution would be
+				sDS18B20.sDevice[u16SensorIndex].u16UserIndex = sDS18B20.u8TempScratch[4U] & 0x0FU;
+			}
+		}
+		else
+		{
+			//CRC fault, keep the last value
+			sDS18B20.sAsync[u8ChannelIndex].u32ReadFaultCount++;
+		}
+	}
+	else
+	{
+		//wire fault, keep the last value
+		sDS18B20.sAsync[u8ChannelIndex].u32ReadFaultCount++;
+	}
+}
+
+//safetys
+#if C_LOCALDEF__LCCM644__CONNECT_LCCM641 != 1U
+	//the async path is only on the DS2482S
+	#error
+#endif
+#if C_LOCALDEF__LCCM644__USE_10MS_ISR != 1U
+	//conversion time is counted on the ISR
+	#error
+#endif
+#if C_LOCALDEF__LCCM644__MAX_1WIRE_CHANNELS > C_LOCALDEF__LCCM641__NUM_DEVICS
+	#error
+#endif
+#if C_LOCALDEF__LCCM641__ENABLE_ASYNC != 1U
+	#error
+#endif
+#if (C_DS18B20__ASYNC_SCRATCH_OP + C_DS18B20__SCRATCHPAD_SIZE) > C_DS2482S__ASYNC_MAX_OPS
+	#error
+#endif
+
+#endif //#if C_LOCALDEF__LCCM644__USE_ASYNC == 1U
+#endif //#if C_LOCALDEF__LCCM644__ENABLE_THIS_MODULE == 1U
+//safetys
+#ifndef C_LOCALDEF__LCCM644__ENABLE_THIS_MODULE
+	#error
+#endif
+/** @} */
+/** @} */
+/** @} */
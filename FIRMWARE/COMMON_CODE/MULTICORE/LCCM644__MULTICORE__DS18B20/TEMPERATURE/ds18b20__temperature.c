@@ -27,8 +27,6 @@
 
 extern struct _strDS18B20 sDS18B20;
 
-//locals
-static void vDS18B20_TEMP__Scratch_To_Temp(Luint16 u16SensorIndex, const Luint8 *pu8Scratch, Lfloat32 *pf32Temp);
 
 /***************************************************************************//**
  * @brief
@@ -37,7 +35,7 @@ static void vDS18B20_TEMP__Scratch_To_Temp(Luint16 u16SensorIndex, const Luint8
  * @param[in]		u16SensorIndex				The sensor index
  * @return			0 = success\n
  *					-ve = error
- * @st_funcMD5		DFE1EB9B81BE1EA46285352390CFEF1A
+ * @st_funcMD5		4A200E8451091886A46A8DF48D9055A8
  * @st_funcID		LCCM644R0.FILE.003.FUNC.006
  */
 Lint16 s16DS18B20_TEMP__Read(Luint16 u16SensorIndex)
@@ -53,6 +51,11 @@ Lint16 s16DS18B20_TEMP__Read(Luint16 u16SensorIndex)
 		//convert scratch RAM to a temperature
 		vDS18B20_TEMP__Scratch_To_Temp(u16SensorIndex, &sDS18B20.u8TempScratch[0], &sDS18B20.sTemp[u16SensorIndex].f32Temperature);
 
+	#if C_LOCALDEF__LCCM644__ENABLE_TEMP_CALLBACK == 1U
+		//tell the app about this reading now, not at the end of the scan
+		C_LOCALDEF__LCCM644__TEMP_CALLBACK(u16SensorIndex);
+	#endif
+
 	}
 	else
 	{
@@ -212,7 +215,7 @@ Lint16 s16DS18B20_TEMP__All_Request_ByChannel(Luint8 u8ChannelIndex, Luint8 u8Wa
  * @param[in]		u16SensorIndex				The addressed index of the device.
  * @return			0 = success\n
  *					-ve = error
- * @st_funcMD5		AFAC92F467DA349D156D5D79A0C1A404
+ * @st_funcMD5		249B70A278D1ECE9DDB7A70FEDC00D5B
  * @st_funcID		LCCM644R0.FILE.003.FUNC.004
  */
 Lint16 s16DS18B20_TEMP__Request(Luint16 u16SensorIndex, Luint8 u8Wait)
@@ -268,6 +271,10 @@ Lint16 s16DS18B20_TEMP__Request(Luint16 u16SensorIndex, Luint8 u8Wait)
 					//convert scratch to temp
 					vDS18B20_TEMP__Scratch_To_Temp(u16SensorIndex, &sDS18B20.u8TempScratch[0], &sDS18B20.sTemp[u16SensorIndex].f32Temperature);
 
+				#if C_LOCALDEF__LCCM644__ENABLE_TEMP_CALLBACK == 1U
+					C_LOCALDEF__LCCM644__TEMP_CALLBACK(u16SensorIndex);
+				#endif
+
 					//success code
 					s16Return = 0;
 
@@ -469,7 +476,7 @@ void vDS18B20_TEMP__Scratch_To_Temp(Luint16 u16SensorIndex, const Luint8 *pu8Scr
  * @param[in]		u16SensorIndex				Already enumerated address ID
  * @return			0 = success\n
  *					-ve = error
- * @st_funcMD5		AA74E61B86A3B1819840161836E80D1D
+ * @st_funcMD5		BF9BFAB5D793EED8D6536482F8AF27A4
  * @st_funcID		LCCM644R0.FILE.003.FUNC.002
  */
 Lint16 s16DS18B20_TEMP__Get_Resolution(Luint16 u16SensorIndex, Luint8 *pu8Resolution)
@@ -483,26 +490,7 @@ Lint16 s16DS18B20_TEMP__Get_Resolution(Luint16 u16SensorIndex, Luint8 *pu8Resolu
 	s16Return = s16DS18B20_SCRATCH__Read(u16SensorIndex, &sDS18B20.u8TempScratch[0]);
 
 	//determine from the scratchpad
-	switch(sDS18B20.u8TempScratch[4U])
-	{
-
-		case 0x7FU:
-			*pu8Resolution = 12U;
-			break;
-		case 0x5FU:
-			*pu8Resolution = 11U;
-			break;
-		case 0x3FU:
-			*pu8Resolution = 10U;
-			break;
-		case 0x1FU:
-			*pu8Resolution = 9U;
-			break;
-
-		default:
-			*pu8Resolution = 0U;
-			break;
-	}
+	*pu8Resolution = u8DS18B20_TEMP__Config_To_Resolution(sDS18B20.u8TempScratch[4U]);
 
 
 	return s16Return;
@@ -605,6 +593,45 @@ Lint16 s16DS18B20_TEMP__Set_Resolution(Luint16 u16SensorIndex, Luint8 u8Resoluti
 
 
 
+/***************************************************************************//**
+ * @brief
+ * Decode the scratchpad configuration register into a resolution
+ *
+ * @param[in]		u8Config				Scratchpad byte 4
+ * @return			9 to 12 bits\n
+ *					0 = unknown
+ * @st_funcMD5		B05C395BDA24B53D3F704D5F15BBF247
+ * @st_funcID		LCCM644R0.FILE.003.FUNC.009
+ */
+Luint8 u8DS18B20_TEMP__Config_To_Resolution(Luint8 u8Config)
+{
+	Luint8 u8Return;
+
+	switch(u8Config)
+	{
+
+		case 0x7FU:
+			u8Return = 12U;
+			break;
+		case 0x5FU:
+			u8Return = 11U;
+			break;
+		case 0x3FU:
+			u8Return = 10U;
+			break;
+		case 0x1FU:
+			u8Return = 9U;
+			break;
+
+		default:
+			u8Return = 0U;
+			break;
+	}
+
+	return u8Return;
+}
+
+
 #endif //#if C_LOCALDEF__LCCM644__ENABLE_THIS_MODULE == 1U
 //safetys
 #ifndef C_LOCALDEF__LCCM644__ENABLE_THIS_MODULE
@@ -35,7 +35,7 @@ struct _strDS18B20 sDS18B20;
  * YOU MUST Either start the search process or manually load
  * ROMID values into the tables before doing anything with this module.
  *
- * @st_funcMD5		D8EA8230604994839D2F3F4C48B18E8E
+ * @st_funcMD5		71B241982EBD4442EB15C0EBE931261B
  * @st_funcID		LCCM644R0.FILE.000.FUNC.001
  */
 void vDS18B20__Init(void)
@@ -53,6 +53,10 @@ void vDS18B20__Init(void)
 	//setup the vars for the address searching.
 	vDS18B20_ADDX__Init();
 
+	#if C_LOCALDEF__LCCM644__USE_ASYNC == 1U
+		vDS18B20_ASYNC__Init();
+	#endif
+
 }
 
 /***************************************************************************//**
@@ -60,13 +64,17 @@ void vDS18B20__Init(void)
  * Process DS18B20 systems
  * Call from main program loop as quick as possible.
  * 
- * @st_funcMD5		CBFDFFAC4C0AD3B6C780F94FED676659
+ * @st_funcMD5		6F684A3367A25C3EFCC8956EB003C01C
  * @st_funcID		LCCM644R0.FILE.000.FUNC.002
  */
 void vDS18B20__Process(void)
 {
 	Lint16 s16Return;
-	Luint8 u8Counter;
+	#if C_LOCALDEF__LCCM644__USE_ASYNC == 1U
+		Luint8 u8Test;
+	#else
+		Luint8 u8Counter;
+	#endif
 
 	//if need be process the search functions
 	vDS18B20_ADDX__SearchSM_Process();
@@ -156,6 +164,26 @@ void vDS18B20__Process(void)
 			break;
 
 		case DS18B20_STATE__READ_RESOLUTION: //And User ID
+			#if C_LOCALDEF__LCCM644__USE_ASYNC == 1U
+				//read back the resolutions and user ID's from the scratchpads
+				if(sDS18B20.u16MainStateCounter == 0U)
+				{
+					vDS18B20_ASYNC__Start_Scan(DS18B20_ASYNC_READ__CONFIG);
+					sDS18B20.u16MainStateCounter = 1U;
+				}
+				else
+				{
+					u8Test = u8DS18B20_ASYNC__Scan_Process();
+					if(u8Test == 1U)
+					{
+						sDS18B20.eMainState = DS18B20_STATE__START_CONVERT_ALL;
+					}
+					else
+					{
+						//keep going
+					}
+				}
+			#else
 			//once we have searched and we have a valid search array, we need to configure
 			//the devices onboard resolution before we can start converting.
 
@@ -200,9 +228,28 @@ void vDS18B20__Process(void)
 			{
 				//keep going
 			}
+			#endif
 			break;
 
 		case DS18B20_STATE__START_CONVERT_ALL:
+			#if C_LOCALDEF__LCCM644__USE_ASYNC == 1U
+				//queue the convert on every channel, the wire does the rest
+				s16Return = s16DS18B20_ASYNC__Start_ConvertAll();
+				if(s16Return >= 0)
+				{
+					//clear the counter
+					sDS18B20.u32ISR_Counter = 0U;
+
+					//clear our device counter now.
+					sDS18B20.u16MainStateCounter = 0U;
+
+					sDS18B20.eMainState = DS18B20_STATE__WAIT_CONVERT;
+				}
+				else
+				{
+					//a channel is still busy, try again next time
+				}
+			#else
 
 			//do the conversion
 
@@ -252,6 +299,7 @@ void vDS18B20__Process(void)
 				sDS18B20.eMainState = DS18B20_STATE__WAIT_CONVERT;
 			#endif
 
+			#endif
 			break;
 
 		case DS18B20_STATE__WAIT_CONVERT:
@@ -302,6 +350,26 @@ void vDS18B20__Process(void)
 			break;
 
 		case DS18B20_STATE__READ_SENSORS:
+			#if C_LOCALDEF__LCCM644__USE_ASYNC == 1U
+				//every channel reads its own sensors at the same time
+				if(sDS18B20.u16MainStateCounter == 0U)
+				{
+					vDS18B20_ASYNC__Start_Scan(DS18B20_ASYNC_READ__TEMPERATURE);
+					sDS18B20.u16MainStateCounter = 1U;
+				}
+				else
+				{
+					u8Test = u8DS18B20_ASYNC__Scan_Process();
+					if(u8Test == 1U)
+					{
+						sDS18B20.eMainState = DS18B20_STATE__READ_DONE;
+					}
+					else
+					{
+						//keep going
+					}
+				}
+			#else
 
 
 			//get the temp data from each sensor
@@ -330,6 +398,7 @@ void vDS18B20__Process(void)
 				sDS18B20.eMainState = DS18B20_STATE__READ_SENSOR_STATE_DELAY;
 			}
 
+			#endif
 			break;
 
 		case DS18B20_STATE__READ_SENSOR_STATE_DELAY:
@@ -557,6 +626,9 @@ void vDS18B20__10MS_ISR(void)
 #ifndef C_LOCALDEF__LCCM644__USE_10MS_ISR
 	#error
 #endif
+#ifndef C_LOCALDEF__LCCM644__USE_ASYNC
+	#error
+#endif
 
 #endif //#if C_LOCALDEF__LCCM644__ENABLE_THIS_MODULE == 1U
 //safetys
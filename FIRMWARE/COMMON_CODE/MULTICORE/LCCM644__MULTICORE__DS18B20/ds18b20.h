@@ -106,6 +106,25 @@
 			Luint8 u8TempScratch[C_DS18B20__SCRATCHPAD_SIZE];
 
 
+		#if C_LOCALDEF__LCCM644__USE_ASYNC == 1U
+			/** Async scratchpad scan, one sensor in flight per 1-Wire channel */
+			struct
+			{
+				/** The sensor being read, or the next one to look at */
+				Luint16 u16SensorIndex;
+
+				/** A read is in flight */
+				Luint8 u8Pending;
+
+				/** Reads that failed or had a bad CRC */
+				Luint32 u32ReadFaultCount;
+
+			}sAsync[C_LOCALDEF__LCCM644__MAX_1WIRE_CHANNELS];
+
+			/** What the current scan is for */
+			E_DS18B20_ASYNC_READ_T eAsyncRead;
+		#endif
+
 			/** Main state machine */
 			E_DS18B20__MAIN_STATES eMainState;
 
@@ -150,6 +169,14 @@
 		Lint16 s16DS18B20_TEMP__Set_Resolution(Luint16 u16SensorIndex, Luint8 u8Resolution);
 		Lint16 s16DS18B20_TEMP__Get_Resolution(Luint16 u16SensorIndex, Luint8 *pu8Resolution);
 		Lint16 s16DS18B20_TEMP__Get_UserID(Luint16 u16SensorIndex);
+		void vDS18B20_TEMP__Scratch_To_Temp(Luint16 u16SensorIndex, const Luint8 *pu8Scratch, Lfloat32 *pf32Temp);
+		Luint8 u8DS18B20_TEMP__Config_To_Resolution(Luint8 u8Config);
+
+		//async
+		void vDS18B20_ASYNC__Init(void);
+		Lint16 s16DS18B20_ASYNC__Start_ConvertAll(void);
+		void vDS18B20_ASYNC__Start_Scan(E_DS18B20_ASYNC_READ_T eRead);
+		Luint8 u8DS18B20_ASYNC__Scan_Process(void);
 
 		//alarms
 		void vDS18B20_ALARMS__Init(void);
@@ -190,6 +217,12 @@
 		#ifndef C_LOCALDEF__LCCM644__MAX_1WIRE_CHANNELS
 			#error
 		#endif
+		#ifndef C_LOCALDEF__LCCM644__USE_ASYNC
+			#error
+		#endif
+		#ifndef C_LOCALDEF__LCCM644__ENABLE_TEMP_CALLBACK
+			#error
+		#endif
 		#if C_LOCALDEF__LCCM644__MAX_DEVICES > 1000
 			//due to data types, limited
 			#error
@@ -30,6 +30,12 @@ DS18B20 - 1-Wire Temperature Sensor
 		 */
 		#define C_LOCALDEF__LCCM644__USE_10MS_ISR							(0U)
 
+		/** Convert and read through the LCCM641 async engine, needs the 10ms ISR */
+		#define C_LOCALDEF__LCCM644__USE_ASYNC								(0U)
+
+		/** Call C_LOCALDEF__LCCM644__TEMP_CALLBACK(index) as each new reading is stored */
+		#define C_LOCALDEF__LCCM644__ENABLE_TEMP_CALLBACK					(0U)
+
 
 		//connectivity options
 		//1-Wire software library
@@ -70,4 +70,17 @@
 
 	}E_DS18B20_SEARCH_T;
 
+
+	/** What an async scratchpad scan is for */
+	typedef enum
+	{
+
+		/** Pick up the resolution, or user ID for thermocouples */
+		DS18B20_ASYNC_READ__CONFIG = 0U,
+
+		/** Convert the scratchpad to a temperature */
+		DS18B20_ASYNC_READ__TEMPERATURE
+
+	}E_DS18B20_ASYNC_READ_T;
+
 #endif /* __DS18B20_DS18B20__STATE_TYPES_H_ */
@@ -29,7 +29,7 @@
 extern struct _str6870 sATA6870;
 
 //locals
-static Luint8 u8ATA6870_BALANCE__Handle(Luint8 u8DeviceIndex, Luint8 u8CellCounter, Luint8 u8CellIndex);
+static Luint8 u8ATA6870_BALANCE__Plan(Luint8 u8DeviceIndex, Lfloat32 f32Target);
 static void vATA6870_BALANCE__Do(void);
 
 /***************************************************************************//**
@@ -264,172 +264,160 @@ void vATA6870_BALANCE__Manual(Luint8 u8CellIndex, Luint8 u8Enable)
 
 /***************************************************************************//**
  * @brief
- * Handle the actual discharging
+ * Plan which resistors on one device should be bleeding this scan.
  * 
- * @param[in]		u8CellIndex				The cell in the stack to act on.
- * @param[in]		u8CellCounter			Individual cell in the BMS
+ * @note
+ * Passive balancing can only take charge off, so every cell is bled down
+ * towards the lowest cell in the pack. The thermal limit allows only
+ * u8MaxBalanceCells resistors per device at once, so those slots go to the
+ * cells furthest above the target. With the same bleed rate on every cell
+ * this largest remaining first order finishes the device in the shortest
+ * time, max(largest excess, total excess / slots). Re-planning on each scan
+ * keeps the schedule current as the cells come down.
+ * A cell that is already bleeding stays eligible down to half the tolerance
+ * so the resistors do not chatter around the threshold.
+ *
+ * @param[in]		f32Target				The lowest cell voltage in the pack
  * @param[in]		u8DeviceIndex			ATA device index
- * @return			return 1 if we are resistors on
- * @st_funcMD5		A00A9DCBE0AF34E89F897ED43D57E81F
- * @st_funcID		LCCM650R0.FILE.012.FUNC.006
+ * @return			Discharge mask for the device, bit n = cell n
+ * @st_funcMD5		F2CBCC316C2662D3A4D5B862DC78318D
+ * @st_funcID		LCCM650R0.FILE.012.FUNC.008
  */
-Luint8 u8ATA6870_BALANCE__Handle(Luint8 u8DeviceIndex, Luint8 u8CellCounter, Luint8 u8CellIndex)
+static Luint8 u8ATA6870_BALANCE__Plan(Luint8 u8DeviceIndex, Lfloat32 f32Target)
 {
-	Luint8 u8Temp;
-	Luint8 u8Return;
+	Luint8 u8Slot;
+	Luint8 u8CellCounter;
+	Luint8 u8CellIndex;
+	Luint8 u8CellMax;
+	Luint8 u8Mask;
+	Lfloat32 f32Excess;
+	Lfloat32 f32Max;
+	Lfloat32 f32Tolerance;
 
-	u8Return = 0U;
+	u8Mask = 0U;
 
-	//If one cell voltage is above average
-	//Note: this could induce a bias.
-	u8Temp = u8SIL3_NUM_TOLERANCE__F32(sATA6870.f32Voltage[u8CellIndex], sATA6870.f32AverageCellVoltage, sATA6870.sBalance.f32BalanceTolerance);
-	if(u8Temp == 0U)
+	//fill each thermal slot with the highest remaining cell
+	for(u8Slot = 0U; u8Slot < sATA6870.sBalance.u8MaxBalanceCells; u8Slot++)
 	{
-		//make sure we are actually greater
-		if(sATA6870.f32Voltage[u8CellIndex] > sATA6870.f32AverageCellVoltage)
+		u8CellMax = 0xFFU;
+		f32Max = 0.0F;
+
+		for(u8CellCounter = 0U; u8CellCounter < C_ATA6870__MAX_CELLS; u8CellCounter++)
 		{
-			//inc the max cell count for this module
-			u8Return = 1U;
+			//calc the current index
+			u8CellIndex = (u8DeviceIndex * C_ATA6870__MAX_CELLS) + u8CellCounter;
 
-			if(sATA6870.sBalance.u8ResistorOn[u8CellIndex] == 0U)
+			//skip cells already given a slot
+			if((u8Mask & (Luint8)(1U << u8CellCounter)) == 0U)
 			{
-				//turn on this resistor
-				vATA6870_RES__TurnOn(u8DeviceIndex, u8CellCounter);
+				f32Excess = sATA6870.f32Voltage[u8CellIndex] - f32Target;
 
-				//update the flag
-				sATA6870.sBalance.u8ResistorOn[u8CellIndex] = 1U;
+				//hysteresis, keep a bleeding cell going a little longer
+				if(sATA6870.sBalance.u8ResistorOn[u8CellIndex] == 1U)
+				{
+					f32Tolerance = sATA6870.sBalance.f32BalanceTolerance * 0.5F;
+				}
+				else
+				{
+					f32Tolerance = sATA6870.sBalance.f32BalanceTolerance;
+				}
+
+				if((f32Excess > f32Tolerance) && (f32Excess > f32Max))
+				{
+					//record it.
+					f32Max = f32Excess;
+					u8CellMax = u8CellCounter;
+				}
+				else
+				{
+					//keep sorting
+				}
 			}
 			else
 			{
-				//res was already set on.
+				//already planned
 			}
 
+		}//for(u8CellCounter = 0U; u8CellCounter < C_ATA6870__MAX_CELLS; u8CellCounter++)
+
+		if(u8CellMax != 0xFFU)
+		{
+			u8Mask |= (Luint8)(1U << u8CellMax);
 		}
 		else
 		{
-			//not within tolerance, but lower, so no need to do anything but check the prev resistor state
-			if(sATA6870.sBalance.u8ResistorOn[u8CellIndex] == 1U)
-			{
-				// cell has reached the setpoint, turn off discharge
-				vATA6870_RES__TurnOff(u8DeviceIndex, u8CellCounter);
-
-				//update the flag
-				sATA6870.sBalance.u8ResistorOn[u8CellIndex] = 0U;
-			}
-			else
-			{
-				//cell was alredy off
-			}
-
+			//nothing left above the target on this device
 		}
-	}
-	else
-	{
-		//the cell and average is close, no point in balancing.
-	}
 
-	return u8Return;
+	}//for(u8Slot = 0U; u8Slot < sATA6870.sBalance.u8MaxBalanceCells; u8Slot++)
+
+	return u8Mask;
 }
 
 
 /***************************************************************************//**
  * @brief
  * Do the balancing.
+ * Plan each device against the lowest cell and only touch the SPI where the
+ * plan differs from what the resistors are already doing.
  * 
- * @st_funcMD5		D2C266693DEBB69953303D9FCEDB80E9
+ * @st_funcMD5		D05DE438BE3E03EAC356AD8AB75DC14C
  * @st_funcID		LCCM650R0.FILE.012.FUNC.007
  */
 void vATA6870_BALANCE__Do(void)
 {
-
-	Luint8 u8MaxCellCount;
 	Luint8 u8DeviceCounter;
 	Luint8 u8CellCounter;
-	Lfloat32 f32Max;
 	Luint8 u8CellIndex;
-	Luint8 u8CellMax;
-	Luint8 u8CellMaxCell;
-
-	//clear the cell index
-	u8CellIndex = 0U;
+	Luint8 u8Mask;
+	Luint8 u8Current;
+	Lfloat32 f32Target;
 
+	//bleed everything towards the lowest cell
+	f32Target = f32ATA6870_CELL__Get_LowestVoltage();
 
 	// for each ATA6870 device
 	for(u8DeviceCounter = 0U; u8DeviceCounter < C_LOCALDEF__LCCM650__NUM_DEVICES; u8DeviceCounter++)
 	{
-		//clear the max count
-		u8MaxCellCount = 0U;
+		u8Mask = u8ATA6870_BALANCE__Plan(u8DeviceCounter, f32Target);
 
-		//find the highest voltage attached to the current device.
-		//we would want to discharge this one first.
-		u8CellMax = 0xFFU;
-		f32Max = 0.0F;
+		//what is on now
+		u8Current = 0U;
 		for(u8CellCounter = 0U; u8CellCounter < C_ATA6870__MAX_CELLS; u8CellCounter++)
 		{
 			//calc the current index
 			u8CellIndex = (u8DeviceCounter * C_ATA6870__MAX_CELLS) + u8CellCounter;
-
-			//simply choose the highest cell.
-			if(sATA6870.f32Voltage[u8CellIndex] > f32Max)
+			if(sATA6870.sBalance.u8ResistorOn[u8CellIndex] == 1U)
 			{
-
-				//record it.
-				f32Max = sATA6870.f32Voltage[u8CellIndex];
-				u8CellMax = u8CellIndex;
-				u8CellMaxCell = u8CellCounter;
+				u8Current |= (Luint8)(1U << u8CellCounter);
 			}
 			else
 			{
-				//keep sorting
+				//off
 			}
+		}
 
-		}//for(u8CellCounter = 0U; u8CellCounter < C_ATA6870__MAX_CELLS; u8CellCounter++)
-
-
-		//balance the highest cell first
-		if(u8CellMax != 0xFFU)
+		//one write per device and only on a change
+		if(u8Mask != u8Current)
 		{
+			vATA6870_RES__Set_Mask(u8DeviceCounter, u8Mask);
 
-			//we have the max voltage in this cell already, so discharge it
-			//handle the balance decision and if needed update the count;
-			u8MaxCellCount += u8ATA6870_BALANCE__Handle(u8DeviceCounter, u8CellMaxCell, u8CellMax);
+			for(u8CellCounter = 0U; u8CellCounter < C_ATA6870__MAX_CELLS; u8CellCounter++)
+			{
+				//calc the current index
+				u8CellIndex = (u8DeviceCounter * C_ATA6870__MAX_CELLS) + u8CellCounter;
 
+				//update the flag
+				sATA6870.sBalance.u8ResistorOn[u8CellIndex] = (u8Mask >> u8CellCounter) & 0x01U;
+			}
 		}
 		else
 		{
-			//no max cell found (which is strange)
+			//plan unchanged
 		}
 
-
-		//fall on and check for any other cells attached to this device that might need balancing.
-
-		// for each 6P module connected to that device
-		for(u8CellCounter = 0U; u8CellCounter < C_ATA6870__MAX_CELLS; u8CellCounter++)
-		{
-			//calc the current index
-			u8CellIndex = (u8DeviceCounter * C_ATA6870__MAX_CELLS) + u8CellCounter;
-
-			//thermal limiting
-			if(u8MaxCellCount < sATA6870.sBalance.u8MaxBalanceCells)
-			{
-
-				//handle the balance decision and if needed update the count;
-				u8MaxCellCount += u8ATA6870_BALANCE__Handle(u8DeviceCounter, u8CellCounter, u8CellIndex);
-
-
-			}//if(u8MaxCellCount < sATA6870.sBalance.u8MaxBalanceCells)
-			else
-			{
-				//not able to do any more on this device
-
-			}//else if(u8MaxCellCount < sATA6870.sBalance.u8MaxBalanceCells)
-
-		}//for(u8CellCounter = 0U; u8CellCounter < C_ATA6870__MAX_CELLS; u8CellCounter++)
-
-
 	}//for(u8DeviceCounter = 0U; u8DeviceCounter < C_LOCALDEF__LCCM650__NUM_DEVICES; u8DeviceCounter++)
 
-
 }
 
 
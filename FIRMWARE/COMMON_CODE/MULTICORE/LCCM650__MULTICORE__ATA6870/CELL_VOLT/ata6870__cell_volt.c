@@ -30,11 +30,14 @@
 //main structure
 extern struct _str6870 sATA6870;
 
+//locals
+static void vATA6870_CELL__Convert(const Luint8 *pu8Buffer, Lfloat32 *pf32Voltages, Lfloat32 *pF32Temperature);
+
 /***************************************************************************//**
  * @brief
  * bulk read voltages: 6 voltages, 1 temperature
  * 
- * @st_funcMD5		9E83BF6A7C1E8046881758D51B0CFCFD
+ * @st_funcMD5		C095A712C7C2562CB89FCD26A3610001
  * @st_funcID		LCCM650R0.FILE.011.FUNC.003
  */
 Lint16 s16ATA6870_CELL__BulkRead_All(void)
@@ -48,13 +51,19 @@ Lint16 s16ATA6870_CELL__BulkRead_All(void)
 	// number of cell voltage readings
 	Luint8 u8VolCounter = 0U;
 
+	//raw burst from every device, read in one sequence before any conversion
+	Luint8 u8Buffer[C_LOCALDEF__LCCM650__NUM_DEVICES * C_ATA6870__BUSRT_LENGTH];
+
 
 	s16Return = 0U;
 
 	// read data
+	vATA6870_LOWLEVEL__Reg_ReadU8_All(ATA6870_REG__DATA_RD16_BURST, &u8Buffer[0], C_ATA6870__BUSRT_LENGTH);
+
+	// now the bus is free, do the conversions
 	for(u8Counter = 0U; u8Counter < C_LOCALDEF__LCCM650__NUM_DEVICES; u8Counter++)
 	{
-		vATA6870_CELL__Get_Voltages(u8Counter, &sATA6870.f32Voltage[u8VolCounter], &sATA6870.f32NTCTemperatureReading[u8Counter]);
+		vATA6870_CELL__Convert(&u8Buffer[u8Counter * C_ATA6870__BUSRT_LENGTH], &sATA6870.f32Voltage[u8VolCounter], &sATA6870.f32NTCTemperatureReading[u8Counter]);
 
 		// move to next module
 		u8VolCounter += C_ATA6870__MAX_CELLS;
@@ -69,18 +78,23 @@ Lint16 s16ATA6870_CELL__BulkRead_All(void)
 
 /***************************************************************************//**
  * @brief
- * Compute the sum of all voltages (= our pack voltage)
+ * Compute the sum of all voltages (= our pack voltage) and the highest and
+ * lowest cells in the same pass
  * 
- * @st_funcMD5		C722B0B07CE53C27DEF8357D218011DA
+ * @st_funcMD5		2CAC6478AF5384728AB37F060AAEE09E
  * @st_funcID		LCCM650R0.FILE.011.FUNC.004
  */
 void vATA6870_CELL__Sum_CellVoltages(void)
 {
 	Luint8 u8Counter;
 	Lfloat32 f32Temp;
+	Lfloat32 f32Max;
+	Lfloat32 f32Min;
 
 	//clear initially:
 	f32Temp = 0.0F;
+	f32Max = 0.0F;
+	f32Min = 100.0F;
 
 	//go through each device
 	for(u8Counter = 0U; u8Counter < C_ATA6870__TOTAL_CELLS; u8Counter++)
@@ -91,10 +105,31 @@ void vATA6870_CELL__Sum_CellVoltages(void)
 			f32Temp += sATA6870.f32FiltVoltage[u8Counter];
 		#endif
 
+		//min/max on the raw cells
+		if(sATA6870.f32Voltage[u8Counter] > f32Max)
+		{
+			f32Max = sATA6870.f32Voltage[u8Counter];
+		}
+		else
+		{
+			//keep sorting
+		}
+
+		if(sATA6870.f32Voltage[u8Counter] < f32Min)
+		{
+			f32Min = sATA6870.f32Voltage[u8Counter];
+		}
+		else
+		{
+			//keep sorting
+		}
+
 	}
 
 	//update
 	sATA6870.f32PackVoltage = f32Temp;
+	sATA6870.f32Highest = f32Max;
+	sATA6870.f32Lowest = f32Min;
 
 }
 
@@ -175,75 +210,16 @@ Lint16 s16ATA6870_CELL__Check_CellVoltageError(Lfloat32 *pf32Voltages)
 }
 
 
-//returns the highest cell voltage
+//returns the highest cell voltage from the last scan
 Lfloat32 f32ATA6870_CELL__Get_HighestVoltage(void)
 {
-	Lfloat32 f32Max;
-	Luint8 u8CellCounter;
-	Luint8 u8CellIndex;
-	Luint8 u8DeviceCounter;
-
-	f32Max = 0.0F;
-	// for each ATA6870 device
-	for(u8DeviceCounter = 0U; u8DeviceCounter < C_LOCALDEF__LCCM650__NUM_DEVICES; u8DeviceCounter++)
-	{
-
-		for(u8CellCounter = 0U; u8CellCounter < C_ATA6870__MAX_CELLS; u8CellCounter++)
-		{
-			//calc the current index
-			u8CellIndex = (u8DeviceCounter * C_ATA6870__MAX_CELLS) + u8CellCounter;
-
-			//simply choose the highest cell.
-			if(sATA6870.f32Voltage[u8CellIndex] > f32Max)
-			{
-				//record it.
-				f32Max = sATA6870.f32Voltage[u8CellIndex];
-			}
-			else
-			{
-				//keep sorting
-			}
-
-		}//for(u8CellCounter = 0U; u8CellCounter < C_ATA6870__MAX_CELLS; u8CellCounter++)
-
-	}//for(u8DeviceCounter = 0U; u8DeviceCounter < C_LOCALDEF__LCCM650__NUM_DEVICES; u8DeviceCounter++)
-
-	return f32Max;
+	return sATA6870.f32Highest;
 }
 
+//returns the lowest cell voltage from the last scan
 Lfloat32 f32ATA6870_CELL__Get_LowestVoltage(void)
 {
-	Lfloat32 f32Min;
-	Luint8 u8CellCounter;
-	Luint8 u8CellIndex;
-	Luint8 u8DeviceCounter;
-
-	f32Min = 100.0F;
-	// for each ATA6870 device
-	for(u8DeviceCounter = 0U; u8DeviceCounter < C_LOCALDEF__LCCM650__NUM_DEVICES; u8DeviceCounter++)
-	{
-
-		for(u8CellCounter = 0U; u8CellCounter < C_ATA6870__MAX_CELLS; u8CellCounter++)
-		{
-			//calc the current index
-			u8CellIndex = (u8DeviceCounter * C_ATA6870__MAX_CELLS) + u8CellCounter;
-
-			//simply choose the lowest cell.
-			if(sATA6870.f32Voltage[u8CellIndex] < f32Min)
-			{
-				//record it.
-				f32Min = sATA6870.f32Voltage[u8CellIndex];
-			}
-			else
-			{
-				//keep sorting
-			}
-
-		}//for(u8CellCounter = 0U; u8CellCounter < C_ATA6870__MAX_CELLS; u8CellCounter++)
-
-	}//for(u8DeviceCounter = 0U; u8DeviceCounter < C_LOCALDEF__LCCM650__NUM_DEVICES; u8DeviceCounter++)
-
-	return f32Min;
+	return sATA6870.f32Lowest;
 }
 
 /***************************************************************************//**
@@ -257,19 +233,11 @@ Lfloat32 f32ATA6870_CELL__Get_LowestVoltage(void)
  * @param[out]		*pF32Temperature		The returned temperature reading from the NTC
  * @param[out]		*pf32Voltages			An array of 6 Cell voltages
  * @param[in]		u8DeviceIndex			The device index on the bus
- * @st_funcMD5		EEE52897EC66ACC3E9A55AD2F3176D4F
+ * @st_funcMD5		83C3BF991189B25A600FEC3226D016C2
  * @st_funcID		LCCM650R0.FILE.011.FUNC.002
  */
 void vATA6870_CELL__Get_Voltages(Luint8 u8DeviceIndex, Lfloat32 *pf32Voltages, Lfloat32 *pF32Temperature)
 {
-	Luint8 u8Counter;
-	Lfloat32 f32Temp;
-	union
-	{
-		Luint16 u16;
-		Luint8 u8[2];
-	}unT;
-	
 	//14 bytes of local memory, reviewed.
 	//We also have to return the temperature value in this
 	Luint8 u8Buffer[C_ATA6870__BUSRT_LENGTH];
@@ -280,13 +248,28 @@ void vATA6870_CELL__Get_Voltages(Luint8 u8DeviceIndex, Lfloat32 *pf32Voltages, L
 
 	//todo
 	//review the status and make sure we did not get a tiemout or data corruption
+
+	vATA6870_CELL__Convert(&u8Buffer[0], pf32Voltages, pF32Temperature);
+
+}
+
+//unpack one device's burst into 6 cell voltages and the NTC reading
+static void vATA6870_CELL__Convert(const Luint8 *pu8Buffer, Lfloat32 *pf32Voltages, Lfloat32 *pF32Temperature)
+{
+	Luint8 u8Counter;
+	Lfloat32 f32Temp;
+	union
+	{
+		Luint16 u16;
+		Luint8 u8[2];
+	}unT;
 	
 	//do the conversions
 	for(u8Counter = 0U; u8Counter < C_ATA6870__MAX_CELLS; u8Counter++)
 	{
 		//convert
-		unT.u8[0] = u8Buffer[1 + (u8Counter * 2U)];
-		unT.u8[1] = u8Buffer[0 + (u8Counter * 2U)];
+		unT.u8[0] = pu8Buffer[1 + (u8Counter * 2U)];
+		unT.u8[1] = pu8Buffer[0 + (u8Counter * 2U)];
 	
 		//unpack
 		f32Temp = (Lfloat32)unT.u16;
@@ -318,8 +301,8 @@ void vATA6870_CELL__Get_Voltages(Luint8 u8DeviceIndex, Lfloat32 *pf32Voltages, L
 	}
 
 	//last two are the temp reading, we can save this off elsewhere
-	unT.u8[0] = u8Buffer[C_ATA6870__BUSRT_LENGTH - 2U];
-	unT.u8[1] = u8Buffer[C_ATA6870__BUSRT_LENGTH - 1U];
+	unT.u8[0] = pu8Buffer[C_ATA6870__BUSRT_LENGTH - 2U];
+	unT.u8[1] = pu8Buffer[C_ATA6870__BUSRT_LENGTH - 1U];
 
 	//unpack
 	//todo, check temp value
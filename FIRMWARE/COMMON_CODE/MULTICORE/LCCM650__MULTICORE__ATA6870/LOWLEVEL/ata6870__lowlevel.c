@@ -37,9 +37,47 @@ extern struct _str6870 sATA6870;
 
 //locals
 static void vATA6870_LOWLEVEL__Reset(void);
-static Luint16 u16ATA6870_LOWLEVEL__Tx_DeviceID(Luint8 u8DeviceIndex, Luint8 *pu8CRC);
+static void vATA6870_LOWLEVEL__Transfer(Luint8 u8DeviceIndex, Luint8 *pu8Tx, Luint8 *pu8Rx, Luint8 u8Length);
+static Luint8 u8ATA6870_LOWLEVEL__Build_Read(ATA6870_REGS_T eRegister, Luint8 *pu8Frame, Luint8 u8Length);
 static Luint8 u8ATA6870_LOWLEVEL__CRC(Luint8 u8InitialCRC, Luint8 u8Data);
 
+//The CRC LFSR (x^8+x^2+x+1) advanced 8 shifts from each starting value with no data
+static const Luint8 u8ATA6870_LOWLEVEL__CRC_Table[256] =
+{
+	0x00U, 0x91U, 0xE3U, 0x72U, 0x07U, 0x96U, 0xE4U, 0x75U,
+	0x0EU, 0x9FU, 0xEDU, 0x7CU, 0x09U, 0x98U, 0xEAU, 0x7BU,
+	0x1CU, 0x8DU, 0xFFU, 0x6EU, 0x1BU, 0x8AU, 0xF8U, 0x69U,
+	0x12U, 0x83U, 0xF1U, 0x60U, 0x15U, 0x84U, 0xF6U, 0x67U,
+	0x38U, 0xA9U, 0xDBU, 0x4AU, 0x3FU, 0xAEU, 0xDCU, 0x4DU,
+	0x36U, 0xA7U, 0xD5U, 0x44U, 0x31U, 0xA0U, 0xD2U, 0x43U,
+	0x24U, 0xB5U, 0xC7U, 0x56U, 0x23U, 0xB2U, 0xC0U, 0x51U,
+	0x2AU, 0xBBU, 0xC9U, 0x58U, 0x2DU, 0xBCU, 0xCEU, 0x5FU,
+	0x70U, 0xE1U, 0x93U, 0x02U, 0x77U, 0xE6U, 0x94U, 0x05U,
+	0x7EU, 0xEFU, 0x9DU, 0x0CU, 0x79U, 0xE8U, 0x9AU, 0x0BU,
+	0x6CU, 0xFDU, 0x8FU, 0x1EU, 0x6BU, 0xFAU, 0x88U, 0x19U,
+	0x62U, 0xF3U, 0x81U, 0x10U, 0x65U, 0xF4U, 0x86U, 0x17U,
+	0x48U, 0xD9U, 0xABU, 0x3AU, 0x4FU, 0xDEU, 0xACU, 0x3DU,
+	0x46U, 0xD7U, 0xA5U, 0x34U, 0x41U, 0xD0U, 0xA2U, 0x33U,
+	0x54U, 0xC5U, 0xB7U, 0x26U, 0x53U, 0xC2U, 0xB0U, 0x21U,
+	0x5AU, 0xCBU, 0xB9U, 0x28U, 0x5DU, 0xCCU, 0xBEU, 0x2FU,
+	0xE0U, 0x71U, 0x03U, 0x92U, 0xE7U, 0x76U, 0x04U, 0x95U,
+	0xEEU, 0x7FU, 0x0DU, 0x9CU, 0xE9U, 0x78U, 0x0AU, 0x9BU,
+	0xFCU, 0x6DU, 0x1FU, 0x8EU, 0xFBU, 0x6AU, 0x18U, 0x89U,
+	0xF2U, 0x63U, 0x11U, 0x80U, 0xF5U, 0x64U, 0x16U, 0x87U,
+	0xD8U, 0x49U, 0x3BU, 0xAAU, 0xDFU, 0x4EU, 0x3CU, 0xADU,
+	0xD6U, 0x47U, 0x35U, 0xA4U, 0xD1U, 0x40U, 0x32U, 0xA3U,
+	0xC4U, 0x55U, 0x27U, 0xB6U, 0xC3U, 0x52U, 0x20U, 0xB1U,
+	0xCAU, 0x5BU, 0x29U, 0xB8U, 0xCDU, 0x5CU, 0x2EU, 0xBFU,
+	0x90U, 0x01U, 0x73U, 0xE2U, 0x97U, 0x06U, 0x74U, 0xE5U,
+	0x9EU, 0x0FU, 0x7DU, 0xECU, 0x99U, 0x08U, 0x7AU, 0xEBU,
+	0x8CU, 0x1DU, 0x6FU, 0xFEU, 0x8BU, 0x1AU, 0x68U, 0xF9U,
+	0x82U, 0x13U, 0x61U, 0xF0U, 0x85U, 0x14U, 0x66U, 0xF7U,
+	0xA8U, 0x39U, 0x4BU, 0xDAU, 0xAFU, 0x3EU, 0x4CU, 0xDDU,
+	0xA6U, 0x37U, 0x45U, 0xD4U, 0xA1U, 0x30U, 0x42U, 0xD3U,
+	0xB4U, 0x25U, 0x57U, 0xC6U, 0xB3U, 0x22U, 0x50U, 0xC1U,
+	0xBAU, 0x2BU, 0x59U, 0xC8U, 0xBDU, 0x2CU, 0x5EU, 0xCFU
+};
+
 /***************************************************************************//**
  * @brief
  * Perform an init of any low level systems, including IO pins.
@@ -105,90 +143,69 @@ void vATA6870_LOWLEVEL__Reset(void)
  * @param[in]		*pu8Data				Pointer to the array of data to write
  * @param[in]		eRegister				The register type.
  * @param[in]		u8DeviceIndex			The ATA6870N device index on the bus.
- * @st_funcMD5		7048DDE8AD40E5D2EF88FD15233E859C
+ * @st_funcMD5		B5799441F5D6B9BD1FA85D00FD129659
  * @st_funcID		LCCM650R0.FILE.005.FUNC.002
  */
 void vATA6870_LOWLEVEL__Reg_WriteU8(Luint8 u8DeviceIndex, ATA6870_REGS_T eRegister, Luint8 *pu8Data, Luint8 u8Length)
 {
-	//the returned IRQ status as a result of the device ID command
-	Luint16 u16IRQStatus;
+	//the whole frame, ID + control + data + CRC
+	Luint8 u8Tx[C_ATA6870__MAX_FRAME_LENGTH];
+	Luint8 u8Rx[C_ATA6870__MAX_FRAME_LENGTH];
 	Luint8 u8Counter;
-	Luint8 u8Temp;
-	Luint8 u8TempData;
+	Luint8 u8Pos;
 	Luint8 u8Control;
 	Luint8 u8CRC;
-	
-	
-	/*
-	7.6.4.6 Communication Error
-	For internal synchronization, it is mandatory to keep CLK running during any SPI access; 
-	CLK must be set on 4 clock cycles [at least) before SPI access starts, and must be kept on 4 clock cycles [at least)
-	after SPI access ends up. Keeping at least 4 CLK clock cycles between two consecutive SPI accesses is mandatory.
-	*/
-	u8Temp = M_LOCALDEF__LCCM650__SPI_TX_U8(0x00U);
-	
-	//deasert the nCS
-	M_LOCALDEF__LCCM650__NCS_LATCH(0U);
 
-	//initial CRC conditions
-	u8CRC = 0U;
-	
-	//send the device ID and at the same time rx the IRQ status.
-	u16IRQStatus = u16ATA6870_LOWLEVEL__Tx_DeviceID(u8DeviceIndex, &u8CRC);
-	
-	//save off the interrupt status from this transaction
-	if(u8DeviceIndex < C_LOCALDEF__LCCM650__NUM_DEVICES)
+	//protect the frame buffer
+	if(u8Length <= C_ATA6870__BUSRT_LENGTH)
 	{
-		sATA6870.sDevice[u8DeviceIndex].sIRQ.u16IRQ_Status = u16IRQStatus;
+		//send the control field
+		u8Control = (Luint8)eRegister;
+
+		//mask for the write
+		u8Control <<= 1U;
+		u8Control |= 0x01U;
+
+		//the ID goes in bytes 0 and 1 during the transfer
+		u8Tx[2] = u8Control;
+		u8Pos = 3U;
+
+		//initial CRC conditions, the ID is not part of the CRC
+		u8CRC = 0U;
+
+		#if C_LOCALDEF__LCCM650__ENABLE_CRC == 1U
+			//CRC the control
+			u8CRC = u8ATA6870_LOWLEVEL__CRC(u8CRC, u8Control);
+		#endif
+
+		//copy in the data
+		for(u8Counter = 0U; u8Counter < u8Length; u8Counter++)
+		{
+			u8Tx[u8Pos] = pu8Data[u8Counter];
+			u8Pos++;
+
+		#if C_LOCALDEF__LCCM650__ENABLE_CRC == 1U
+			//CRC the data
+			u8CRC = u8ATA6870_LOWLEVEL__CRC(u8CRC, pu8Data[u8Counter]);
+		#endif
+		}
+
+		#if C_LOCALDEF__LCCM650__ENABLE_CRC == 1U
+			//finally the CRC.
+			u8Tx[u8Pos] = u8CRC;
+			u8Pos++;
+		#endif
+
+		//we are not clocking data back in, so ignore the return data
+		vATA6870_LOWLEVEL__Transfer(u8DeviceIndex, &u8Tx[0], &u8Rx[0], u8Pos);
 	}
 	else
 	{
-		//todo: log the fault
-	}
-	
-	//send the control field
-	u8Control = (Luint8)eRegister;
-	
-	//mask for the write
-	u8Control <<= 1U;
-	u8Control |= 0x01U;
-	
-	//transmit the control value
-	u8Temp = M_LOCALDEF__LCCM650__SPI_TX_U8(u8Control);
-	
-	#if C_LOCALDEF__LCCM650__ENABLE_CRC == 1U
-		//CRC the control
-		u8CRC = u8ATA6870_LOWLEVEL__CRC(u8CRC, u8Control);
-	#endif
-	
-	//transmit out the data
-	//we are not clocking data back in, so ignore the return data
-	for(u8Counter = 0U; u8Counter < u8Length; u8Counter++)
-	{
-		//data value from the array
-		u8TempData = pu8Data[u8Counter];
-	
-		//transmit the byte in the array.
-		u8Temp = M_LOCALDEF__LCCM650__SPI_TX_U8(u8TempData);
-		
-	#if C_LOCALDEF__LCCM650__ENABLE_CRC == 1U
-			//CRC the data
-			u8CRC = u8ATA6870_LOWLEVEL__CRC(u8CRC, u8TempData);
-	#endif
-
+		//frame would overrun the buffer
+		vSIL3_FAULTTREE__Set_Flag(&sATA6870.sFaultTree, C_LCCM650__CORE__FAULT_INDEX__00);
+		vSIL3_FAULTTREE__Set_Flag(&sATA6870.sFaultTree, C_LCCM650__CORE__FAULT_INDEX__01);
 	}
-	
-	#if C_LOCALDEF__LCCM650__ENABLE_CRC == 1U
-		//finally send the CRC.
-		u8Temp = M_LOCALDEF__LCCM650__SPI_TX_U8(u8CRC);
-	#endif
-	
-	//raise nCS
-	M_LOCALDEF__LCCM650__NCS_LATCH(1U);
 
-	//4+ clocks.
-	u8Temp = M_LOCALDEF__LCCM650__SPI_TX_U8(0x00U);
-	
 }
 
 
@@ -201,149 +218,208 @@ void vATA6870_LOWLEVEL__Reg_WriteU8(Luint8 u8DeviceIndex, ATA6870_REGS_T eRegist
  * @param[out]		*pu8Data				Pointer to the return data buffer
  * @param[in]		eRegister				The register to hit
  * @param[in]		u8DeviceIndex			The device in the chain.
- * @st_funcMD5		AA80B12EE05101B24878CBEA3CDC34D7
+ * @st_funcMD5		BCEABB805826F45DF8CE4F78F55B8BBA
  * @st_funcID		LCCM650R0.FILE.005.FUNC.006
  */
 void vATA6870_LOWLEVEL__Reg_ReadU8(Luint8 u8DeviceIndex, ATA6870_REGS_T eRegister, Luint8 *pu8Data, Luint8 u8Length)
 {
-	//the returned IRQ status as a result of the device ID command
-	Luint16 u16IRQStatus;
+	Luint8 u8Tx[C_ATA6870__MAX_FRAME_LENGTH];
+	Luint8 u8Rx[C_ATA6870__MAX_FRAME_LENGTH];
 	Luint8 u8Counter;
-	Luint8 u8Temp;
-	Luint8 u8TempData;
-	Luint8 u8Control;
-	Luint8 u8CRC;
-	
-	
-	/*
-	7.6.4.6 Communication Error
-	For internal synchronization, it is mandatory to keep CLK running during any SPI access; 
-	CLK must be set on 4 clock cycles [at least) before SPI access starts, and must be kept on 4 clock cycles [at least)
-	after SPI access ends up. Keeping at least 4 CLK clock cycles between two consecutive SPI accesses is mandatory.
-	*/
-	u8Temp = M_LOCALDEF__LCCM650__SPI_TX_U8(0x00U);
-	
-	//deasert the nCS
-	M_LOCALDEF__LCCM650__NCS_LATCH(0U);
+	Luint8 u8FrameLength;
 
-	//initial CRC conditions
-	u8CRC = 0U;
-	
-	//send the device ID and at the same time rx the IRQ status.
-	u16IRQStatus = u16ATA6870_LOWLEVEL__Tx_DeviceID(u8DeviceIndex, &u8CRC);
-	
-	//save off the interrupt status from this transaction
-	if(u8DeviceIndex < C_LOCALDEF__LCCM650__NUM_DEVICES)
+	//protect the frame buffer
+	if(u8Length <= C_ATA6870__BUSRT_LENGTH)
 	{
-		sATA6870.sDevice[u8DeviceIndex].sIRQ.u16IRQ_Status = u16IRQStatus;
+		u8FrameLength = u8ATA6870_LOWLEVEL__Build_Read(eRegister, &u8Tx[0], u8Length);
+
+		vATA6870_LOWLEVEL__Transfer(u8DeviceIndex, &u8Tx[0], &u8Rx[0], u8FrameLength);
+
+		//data follows the ID and control
+		for(u8Counter = 0U; u8Counter < u8Length; u8Counter++)
+		{
+			pu8Data[u8Counter] = u8Rx[3U + u8Counter];
+		}
 	}
 	else
 	{
-		//todo: log the fault
+		//frame would overrun the buffer
+		vSIL3_FAULTTREE__Set_Flag(&sATA6870.sFaultTree, C_LCCM650__CORE__FAULT_INDEX__00);
+		vSIL3_FAULTTREE__Set_Flag(&sATA6870.sFaultTree, C_LCCM650__CORE__FAULT_INDEX__01);
 	}
-	
-	
+
+}
+
+/***************************************************************************//**
+ * @brief
+ * Read the same register from every device in the chain in one sequence.
+ * 
+ * @note
+ * The control, dummy data and CRC are the same for every device as the ID is
+ * not part of the CRC, so the frame is built once and only the ID changes. The
+ * transfers go out back to back with no processing in between.
+ *
+ * @param[in]		u8Length				The length of data per device
+ * @param[out]		*pu8Data				Return buffer, u8Length bytes per device in chain order
+ * @param[in]		eRegister				The register to hit
+ * @st_funcMD5		0C9AD70C922DBA7F00E4B2C542AA4A9F
+ * @st_funcID		LCCM650R0.FILE.005.FUNC.010
+ */
+void vATA6870_LOWLEVEL__Reg_ReadU8_All(ATA6870_REGS_T eRegister, Luint8 *pu8Data, Luint8 u8Length)
+{
+	Luint8 u8Tx[C_ATA6870__MAX_FRAME_LENGTH];
+	Luint8 u8Rx[C_ATA6870__MAX_FRAME_LENGTH];
+	Luint8 u8Device;
+	Luint8 u8Counter;
+	Luint8 u8FrameLength;
+	Luint16 u16Pos;
+
+	//protect the frame buffer
+	if(u8Length <= C_ATA6870__BUSRT_LENGTH)
+	{
+		u8FrameLength = u8ATA6870_LOWLEVEL__Build_Read(eRegister, &u8Tx[0], u8Length);
+
+		u16Pos = 0U;
+		for(u8Device = 0U; u8Device < C_LOCALDEF__LCCM650__NUM_DEVICES; u8Device++)
+		{
+			vATA6870_LOWLEVEL__Transfer(u8Device, &u8Tx[0], &u8Rx[0], u8FrameLength);
+
+			for(u8Counter = 0U; u8Counter < u8Length; u8Counter++)
+			{
+				pu8Data[u16Pos] = u8Rx[3U + u8Counter];
+				u16Pos++;
+			}
+		}
+	}
+	else
+	{
+		//frame would overrun the buffer
+		vSIL3_FAULTTREE__Set_Flag(&sATA6870.sFaultTree, C_LCCM650__CORE__FAULT_INDEX__00);
+		vSIL3_FAULTTREE__Set_Flag(&sATA6870.sFaultTree, C_LCCM650__CORE__FAULT_INDEX__01);
+	}
+
+}
+
+//build the control, dummy data and CRC of a read frame, returns the frame length
+static Luint8 u8ATA6870_LOWLEVEL__Build_Read(ATA6870_REGS_T eRegister, Luint8 *pu8Frame, Luint8 u8Length)
+{
+	Luint8 u8Counter;
+	Luint8 u8Pos;
+	Luint8 u8Control;
+	Luint8 u8CRC;
+
 	//send the control field
 	u8Control = (Luint8)eRegister;
-	
+
 	//mask for the read
 	u8Control <<= 1U;
 	u8Control &= 0xFEU;
-	
-	//transmit the control value
-	u8Temp = M_LOCALDEF__LCCM650__SPI_TX_U8(u8Control);
+
+	//the ID goes in bytes 0 and 1 during the transfer
+	pu8Frame[2] = u8Control;
+	u8Pos = 3U;
+
+	//initial CRC conditions, the ID is not part of the CRC
+	u8CRC = 0U;
 
 	#if C_LOCALDEF__LCCM650__ENABLE_CRC == 1U
 		//CRC the control
 		u8CRC = u8ATA6870_LOWLEVEL__CRC(u8CRC, u8Control);
 	#endif
-	
-	//transmit out the data
-	//we are not clocking data back in, so ignore the return data
+
+	//Read back via dummy bytes
 	for(u8Counter = 0U; u8Counter < u8Length; u8Counter++)
 	{
-		//Read back via a dummy byte
-		pu8Data[u8Counter] = M_LOCALDEF__LCCM650__SPI_TX_U8(0x00U);
+		pu8Frame[u8Pos] = 0x00U;
+		u8Pos++;
 
 	#if C_LOCALDEF__LCCM650__ENABLE_CRC == 1U
-			//CRC the data, its zero and I am not sure if we actually need to do this
-			//or if the CRC won't change if we are clocking in 0's
-			u8CRC = u8ATA6870_LOWLEVEL__CRC(u8CRC, 0x00U);
+		//CRC the data, its zero and I am not sure if we actually need to do this
+		//or if the CRC won't change if we are clocking in 0's
+		u8CRC = u8ATA6870_LOWLEVEL__CRC(u8CRC, 0x00U);
 	#endif
 	}
-	
+
 	#if C_LOCALDEF__LCCM650__ENABLE_CRC == 1U
-		//finally send the CRC.
-		u8Temp = M_LOCALDEF__LCCM650__SPI_TX_U8(u8CRC);
+		//finally the CRC.
+		pu8Frame[u8Pos] = u8CRC;
+		u8Pos++;
 	#endif
-	
-	//raise nCS
-	M_LOCALDEF__LCCM650__NCS_LATCH(1U);
 
-	//4+ clocks.
-	u8Temp = M_LOCALDEF__LCCM650__SPI_TX_U8(0x00U);
-	
+	return u8Pos;
 }
 
 /***************************************************************************//**
  * @brief
- * Transmit the device ID portion on the SPI transaction.
- * The DEV ID is the first two bytes indicating which device in the string we are communicating with
+ * Clock a complete frame to one device in the chain.
+ * The DEV ID is the first two bytes indicating which device in the string we are
+ * communicating with, it is written into the frame here. The IRQ status clocked
+ * back during the ID is saved against the device.
  * 
- * @param[in]		*pu8CRC					The initial CRC and the returned CRC
+ * @note
+ * This is the only place the frame hits the SPI, the rest of the frame is
+ * prepared before nCS goes low so the bytes go out back to back.
+ *
+ * @param[in]		u8Length				Frame length including the ID
+ * @param[out]		*pu8Rx					The clocked in frame
+ * @param[in]		*pu8Tx					The frame to send, bytes 0 and 1 are overwritten with the ID
  * @param[in]		u8DeviceIndex			The device index in the chain we want to communicate with.
- * @st_funcMD5		E70039B823AADE9EDC66F03F56222AAB
- * @st_funcID		LCCM650R0.FILE.005.FUNC.004
+ * @st_funcMD5		9D5885F589FB5BF59E345F851E03BFC9
+ * @st_funcID		LCCM650R0.FILE.005.FUNC.011
  */
-Luint16 u16ATA6870_LOWLEVEL__Tx_DeviceID(Luint8 u8DeviceIndex, Luint8 *pu8CRC)
+static void vATA6870_LOWLEVEL__Transfer(Luint8 u8DeviceIndex, Luint8 *pu8Tx, Luint8 *pu8Rx, Luint8 u8Length)
 {
-
 	Luint16 u16Addx;
-	#if C_LOCALDEF__LCCM650__ENABLE_CRC == 1U
-		Luint8 u8CRC;
-	#endif
-	
-	//I know, MISRA-C issues, but its ok.
-	union
-	{
-		Luint16 u16;
-		Luint8 u8[2];
-	}unT, unR;
-	
-	//generate the address of the device in the chain
+	Luint8 u8Counter;
+	Luint8 u8Temp;
+
+	//generate the address of the device in the chain, upper byte first
 	u16Addx = 0x0001U;
 	u16Addx <<= (Luint16)u8DeviceIndex;
+	pu8Tx[0] = (Luint8)(u16Addx >> 8U);
+	pu8Tx[1] = (Luint8)(u16Addx & 0x00FFU);
 
-	//perform the transfer
-	unT.u16 = u16Addx;
+	/*
+	7.6.4.6 Communication Error
+	For internal synchronization, it is mandatory to keep CLK running during any SPI access; 
+	CLK must be set on 4 clock cycles [at least) before SPI access starts, and must be kept on 4 clock cycles [at least)
+	after SPI access ends up. Keeping at least 4 CLK clock cycles between two consecutive SPI accesses is mandatory.
+	*/
+	u8Temp = M_LOCALDEF__LCCM650__SPI_TX_U8(0x00U);
 
-	//send the lower
-	unR.u8[1] = M_LOCALDEF__LCCM650__SPI_TX_U8(unT.u8[1]);
+	//deasert the nCS
+	M_LOCALDEF__LCCM650__NCS_LATCH(0U);
 
-	#if C_LOCALDEF__LCCM650__ENABLE_CRC == 1U
-		//compute the CRC on the lower
-		u8CRC = u8ATA6870_LOWLEVEL__CRC(*pu8CRC, unT.u8[1]);
-	#endif
+	//the whole frame in one go
+	for(u8Counter = 0U; u8Counter < u8Length; u8Counter++)
+	{
+		pu8Rx[u8Counter] = M_LOCALDEF__LCCM650__SPI_TX_U8(pu8Tx[u8Counter]);
+	}
 
-	//send the upper
-	unR.u8[0] = M_LOCALDEF__LCCM650__SPI_TX_U8(unT.u8[0]);
+	//raise nCS
+	M_LOCALDEF__LCCM650__NCS_LATCH(1U);
 
-	#if C_LOCALDEF__LCCM650__ENABLE_CRC == 1U
-		//compute the CRC on the upper and retun the CRC
-		*pu8CRC = u8ATA6870_LOWLEVEL__CRC(u8CRC, unT.u8[0]);
-	#else
-		*pu8CRC = 0U;
-	#endif
+	//4+ clocks.
+	u8Temp = M_LOCALDEF__LCCM650__SPI_TX_U8(0x00U);
+
+	//save off the interrupt status from this transaction
+	if(u8DeviceIndex < C_LOCALDEF__LCCM650__NUM_DEVICES)
+	{
+		sATA6870.sDevice[u8DeviceIndex].sIRQ.u16IRQ_Status = ((Luint16)pu8Rx[0] << 8U) | (Luint16)pu8Rx[1];
+	}
+	else
+	{
+		vSIL3_FAULTTREE__Set_Flag(&sATA6870.sFaultTree, C_LCCM650__CORE__FAULT_INDEX__00);
+		vSIL3_FAULTTREE__Set_Flag(&sATA6870.sFaultTree, C_LCCM650__CORE__FAULT_INDEX__02);
+	}
 
-	//return with the IRQ
-	return unR.u16;
-	
 }
 
 
 /***************************************************************************//**
  * @brief
  * Compute one byte of the CRC.
+ * Table driven, one lookup per byte in place of the 8 step bit loop.
  * 
  * @note
  *  7.6.4.7 CHKSUM Field
@@ -370,59 +446,15 @@ Luint16 u16ATA6870_LOWLEVEL__Tx_DeviceID(Luint8 u8DeviceIndex, Luint8 *pu8CRC)
  * @param[in]		u8Data					The new data value to add to the CRC.
  * @param[in]		u8InitialCRC			The initial CRC conditions.
  * @return			The new CRC
- * @st_funcMD5		C63B72390C8571071FCB24F7F6810D19
+ * @st_funcMD5		F2FD1F16559921A29F8C6E5742E18DC6
  * @st_funcID		LCCM650R0.FILE.005.FUNC.005
  */
-Luint8 u8ATA6870_LOWLEVEL__CRC(Luint8 u8InitialCRC, Luint8 u8Data)
+static Luint8 u8ATA6870_LOWLEVEL__CRC(Luint8 u8InitialCRC, Luint8 u8Data)
 {
-	Luint8 u8Mask;
-	Luint8 u8BitSet;
-	Luint8 u8Return;
-	
-	//assign the initial conditions
-	u8Return = u8InitialCRC;
-	
-	//slide the mask along
-	for(u8Mask = 0x01U; u8Mask > 0U; u8Mask <<= 1U)
-	{
-	
-		//is the LSB set?
-		if((u8Return & 0x01U) != 0x00U)
-		{
-			u8BitSet = 1U;
-		}
-		else
-		{
-			u8BitSet = 0U;
-		}
-	
-		//shift over
-		u8Return >>= 1U;
-	
-		if((u8Data & u8Mask) != 0x00U)
-		{
-			//set the bit to 1 if we have a match for the mask as this point
-			u8Return |= 0x80U;
-		}
-		else
-		{
-			//fall on
-		}
-	
-		//do we need to do the toggle
-		if(u8BitSet == 0x01U)
-		{
-			//0xE0 = x^8+x^2+x+1
-			u8Return ^= 0xE0U;
-		}
-		else
-		{
-			//fall on
-		}
-	
-	}//for(u8Mask = 0x01U; u8Mask > 0U; u8Mask <<= 1U)
-	
-	return u8Return;
+	//Each data bit is shifted in at the top and lands back on its own bit
+	//position after the eight shifts, so the data is a straight XOR and only
+	//the starting CRC needs the table.
+	return (Luint8)(u8ATA6870_LOWLEVEL__CRC_Table[u8InitialCRC] ^ u8Data);
 }
 
 
@@ -119,6 +119,29 @@ void vATA6870_RES__TurnAllOff(Luint8 u8DeviceIndex)
 }
 
 
+/***************************************************************************//**
+ * @brief
+ * Set the whole discharge selector of a device in one write.
+ * 
+ * @param[in]		u8Mask					Bit n = resistor on cell n
+ * @param[in]		u8DeviceIndex			The BMS device index
+ * @st_funcMD5		B9D0FDFD1274E78EB644FB749894E844
+ * @st_funcID		LCCM650R0.FILE.008.FUNC.004
+ */
+void vATA6870_RES__Set_Mask(Luint8 u8DeviceIndex, Luint8 u8Mask)
+{
+	//Taking address of near auto variable, reviewed
+	/*lint -e934*/
+	Luint8 u8Temp;
+
+	//only the cell bits
+	u8Temp = u8Mask & 0x3FU;
+
+	//update
+	vATA6870_LOWLEVEL__Reg_WriteU8(u8DeviceIndex, ATA6870_REG__CH_DISCHARGE, &u8Temp, 1U);
+	/*lint +e934*/
+}
+
 #endif //#if C_LOCALDEF__LCCM650__ENABLE_THIS_MODULE == 1U
 //safetys
 #ifndef C_LOCALDEF__LCCM650__ENABLE_THIS_MODULE
@@ -36,7 +36,7 @@ static void vATA6870__StartConversion(Luint8 u8VoltageMode, Luint8 u8TempBit);
  * @brief
  * Init any ATA6870 systems
  * 
- * @st_funcMD5		DD75420783FCC074EFEE1B22E4564570
+ * @st_funcMD5		51252AD051CC2FBCE0DB57736430D490
  * @st_funcID		LCCM650R0.FILE.000.FUNC.001
  */
 void vATA6870__Init(void)
@@ -47,6 +47,9 @@ void vATA6870__Init(void)
 	Luint8 u8Counter2;
 	Luint8 u8Temp;
 
+	//init the fault tree
+	vSIL3_FAULTTREE__Init(&sATA6870.sFaultTree);
+
 	sATA6870.u32VoltsUpdateCount = 0U;
 
 	//Init NTC Temp reading and Voltages
@@ -76,6 +79,8 @@ void vATA6870__Init(void)
 	sATA6870.eState = ATA6870_STATE__INIT_DEVICE;
 	sATA6870.f32AverageCellVoltage = 0.0F;
 	sATA6870.f32PackVoltage = 0.0F;
+	sATA6870.f32Highest = 0.0F;
+	sATA6870.f32Lowest = 0.0F;
 	sATA6870.u8AverageUpdated = 0U;
 
 	//setup the lowlevel
@@ -321,6 +326,18 @@ Luint32 u32ATA6870__Get_VoltsUpdateCount(void)
 	return sATA6870.u32VoltsUpdateCount;
 }
 
+/***************************************************************************//**
+ * @brief
+ * Get the module level fault flags for the ATA6870 chain
+ * 
+ * @st_funcMD5		D4CA4459077C766ABB9B9B4981C27F56
+ * @st_funcID		LCCM650R0.FILE.000.FUNC.005
+ */
+Luint32 u32ATA6870__Get_FaultFlags(void)
+{
+	return sATA6870.sFaultTree.u32Flags[0];
+}
+
 /***************************************************************************//**
  * @brief
  * 10ms ISR
@@ -16,6 +16,8 @@
 	#include <localdef.h>
 	#if C_LOCALDEF__LCCM650__ENABLE_THIS_MODULE == 1U
 
+		#include <MULTICORE/LCCM284__MULTICORE__FAULT_TREE/fault_tree__public.h>
+		#include <MULTICORE/LCCM650__MULTICORE__ATA6870/ata6870__fault_flags.h>
 		#include <MULTICORE/LCCM650__MULTICORE__ATA6870/ata6870__register_defs.h>
 	
 	
@@ -28,6 +30,9 @@
 		
 		/** Burst transfer length, NEVER modify this */
 		#define C_ATA6870__BUSRT_LENGTH				(14U)
+
+		/** Longest SPI frame, ID + control + burst + CRC */
+		#define C_ATA6870__MAX_FRAME_LENGTH			(2U + 1U + C_ATA6870__BUSRT_LENGTH + 1U)
 		
 		/** max number of monitored cells */
 		#define C_ATA6870__MAX_CELLS				(6U)
@@ -97,6 +102,9 @@
 		{
 			E_ATA6870_STATE_T eState;
 
+			/** Top level fault handling structure */
+			FAULT_TREE__PUBLIC_T sFaultTree;
+
 			/** A list of all revision ID's found on each bus */
 			Luint8 u8RevID[C_ATA6870__MAX_BUS_DEVICES];
 
@@ -165,6 +173,10 @@
 			/** Total battery pack voltage */
 			Lfloat32 f32PackVoltage;
 
+			/** Highest and lowest cell, found with the sum */
+			Lfloat32 f32Highest;
+			Lfloat32 f32Lowest;
+
 			/** The average pack cell voltage */
 			Lfloat32 f32AverageCellVoltage;
 
@@ -182,6 +194,7 @@
 		void vATA6870__Process(void);
 		void vATA6870__10MS_ISR(void);
 		Luint32 u32ATA6870__Get_VoltsUpdateCount(void);
+		Luint32 u32ATA6870__Get_FaultFlags(void);
 		
 		//balance control
 		void vATA6870_BALANCE__Init(void);
@@ -195,6 +208,7 @@
 		void vATA6870_LOWLEVEL__Init(void);
 		void vATA6870_LOWLEVEL__Reg_WriteU8(Luint8 u8DeviceIndex, ATA6870_REGS_T eRegister, Luint8 *pu8Data, Luint8 u8Length);
 		void vATA6870_LOWLEVEL__Reg_ReadU8(Luint8 u8DeviceIndex, ATA6870_REGS_T eRegister, Luint8 *pu8Data, Luint8 u8Length);
+		void vATA6870_LOWLEVEL__Reg_ReadU8_All(ATA6870_REGS_T eRegister, Luint8 *pu8Data, Luint8 u8Length);
 		void vATA6870_LOWLEVEL__PowerOn(void);
 		void vATA6870_LOWLEVEL__PowerOff(void);
 		Luint8 u8ATA6870_LOWLEVEL__Get_PowerAvail(void);
@@ -217,6 +231,7 @@
 		void vATA6870_RES__TurnOn(Luint8 u8DeviceIndex, Luint8 u8CellIndex);
 		void vATA6870_RES__TurnOff(Luint8 u8DeviceIndex, Luint8 u8CellIndex);
 		void vATA6870_RES__TurnAllOff(Luint8 u8DeviceIndex);
+		void vATA6870_RES__Set_Mask(Luint8 u8DeviceIndex, Luint8 u8Mask);
 		
 		//undervoltage detection
 		void vATA6870_UV__Set_UVTrip(Luint8 u8DeviceIndex, Lfloat32 f32Value);
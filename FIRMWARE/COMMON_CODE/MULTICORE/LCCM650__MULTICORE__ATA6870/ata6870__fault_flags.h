@@ -0,0 +1,41 @@
+#ifndef _LCCM650__00__FAULT_FLAGS_H_
+#define _LCCM650__00__FAULT_FLAGS_H_
+/*
+ * @fault_index
+ * 00
+ * 
+ * @brief
+ * GENERAL 
+ * 
+ * A general fault has occurred. 
+*/
+#define C_LCCM650__CORE__FAULT_INDEX__00				0x00000000U
+#define C_LCCM650__CORE__FAULT_INDEX_MASK__00			0x00000001U
+
+/*
+ * @fault_index
+ * 01
+ * 
+ * @brief
+ * FRAME LENGTH FAULT 
+ * 
+ * A register read or write was asked for more bytes than the burst 
+ * frame can hold, nothing was sent. 
+*/
+#define C_LCCM650__CORE__FAULT_INDEX__01				0x00000001U
+#define C_LCCM650__CORE__FAULT_INDEX_MASK__01			0x00000002U
+
+/*
+ * @fault_index
+ * 02
+ * 
+ * @brief
+ * DEVICE INDEXING FAULT 
+ * 
+ * The device index was beyond the number of devices in the chain. 
+*/
+#define C_LCCM650__CORE__FAULT_INDEX__02				0x00000002U
+#define C_LCCM650__CORE__FAULT_INDEX_MASK__02			0x00000004U
+
+#endif //#ifndef _LCCM650__FAULT_FLAGS_H_
+
@@ -31,7 +31,7 @@ extern struct _strAMC7812 sAMC;
  * @brief
  * Init the DAC portion.
  * 
- * @st_funcMD5		DA9E28553440802ABCC8FB8B52AC802F
+ * @st_funcMD5		D8695EF72FC0045CB494049F40870B42
  * @st_funcID		LCCM658R0.FILE.007.FUNC.001
  */
 void vAMC7812_DAC__Init(void)
@@ -44,7 +44,6 @@ void vAMC7812_DAC__Init(void)
 		sAMC.sDAC.u16DAC_OutputValue[u8Counter] = 0U;
 		sAMC.sDAC.u8NewValueLatched[u8Counter] = 0U;
 	}
-	sAMC.sDAC.u8UpdatePos = 0U;
 
 
 
@@ -65,7 +65,7 @@ void vAMC7812__Init(void)
  * @brief
  * Process any core tasks.
  * 
- * @st_funcMD5		C6F964DAF7F60E005E845DCF4D656A2C
+ * @st_funcMD5		578F87431B787FDCC3425142405718DD
  * @st_funcID		LCCM658R0.FILE.000.FUNC.002
  */
 void vAMC7812__Process(void)
@@ -173,7 +173,15 @@ void vAMC7812__Process(void)
 				 * command to the DAC-n-data register updates that register only, and does not change the DAC-n output.
 				 *
 				 */
-				u16Temp = 0x0000U;
+				if(AMC7812_DAC_CONFIG_MODE_FLAG == 1U)
+				{
+					//synchronous on all channels, outputs only move on ILDAC
+					u16Temp = 0x0FFFU;
+				}
+				else
+				{
+					u16Temp = 0x0000U;
+				}
 				s16Return = s16AMC7812_I2C__WriteU16(C_LOCALDEF__LCCM658__BUS_ADDX, AMC7812_REG_ADR__DAC_CONFIG, u16Temp);
 
 
@@ -215,42 +223,65 @@ void vAMC7812__Process(void)
 
 		case AMC7812_STATE__UPDATE_DAC:
 			//update the DAC settings on the device
+			//write every latched channel in this pass so that the whole set goes
+			//out together rather than one channel per process call
 
-			if(sAMC.sDAC.u8NewValueLatched[sAMC.sDAC.u8UpdatePos] == 1U)
+			s16Return = 0;
+			for(u8Counter = 0U; u8Counter < NUM_DAC_CHANNELS; u8Counter++)
 			{
-				//we have a new value, send it.
-				s16Return = s16AMC7812_I2C__WriteU16(C_LOCALDEF__LCCM658__BUS_ADDX, (TE_AMC7812__REG_ADDX)(AMC7812_REG_ADR__DAC_0_DATA + (TE_AMC7812__REG_ADDX)sAMC.sDAC.u8UpdatePos), sAMC.sDAC.u16DAC_OutputValue[sAMC.sDAC.u8UpdatePos]);
-				if(s16Return >= 0)
+				if(sAMC.sDAC.u8NewValueLatched[u8Counter] == 1U)
 				{
-					//success
-					//change state
-					sAMC.eState = AMC7812_STATE__IDLE;
+					//only keep going while the bus is good
+					if(s16Return >= 0)
+					{
+						//we have a new value, send it.
+						s16Return = s16AMC7812_I2C__WriteU16(C_LOCALDEF__LCCM658__BUS_ADDX, (TE_AMC7812__REG_ADDX)(AMC7812_REG_ADR__DAC_0_DATA + (TE_AMC7812__REG_ADDX)u8Counter), sAMC.sDAC.u16DAC_OutputValue[u8Counter]);
+					}
+					else
+					{
+						//fall on
+					}
+
+					//success or fault, clear the latch
+					sAMC.sDAC.u8NewValueLatched[u8Counter] = 0U;
 				}
 				else
 				{
-					//read error, handle state.
-					sAMC.eState = AMC7812_STATE__FAULT;
-
+					//no new value latched
 				}
+			}
 
-				//success or fault, clear the latch
-				sAMC.sDAC.u8NewValueLatched[sAMC.sDAC.u8UpdatePos] = 0U;
-
+			if(AMC7812_DAC_CONFIG_MODE_FLAG == 1U)
+			{
+				if(s16Return >= 0)
+				{
+					//fire ILDAC so every output changes on the same edge
+					u16Temp = AMC7812_AMC_CONFIG_0_DEFAULT | AMC7812_AMC_CONFIG_0_ILDAC;
+					s16Return = s16AMC7812_I2C__WriteU16(C_LOCALDEF__LCCM658__BUS_ADDX, AMC7812_REG_ADR__AMC_CONFIG_0, u16Temp);
+				}
+				else
+				{
+					//fall on
+				}
 			}
 			else
 			{
-				//no new value latched
-				sAMC.eState = AMC7812_STATE__IDLE;
+				//async, outputs already moved
 			}
 
-			//inc the pos
-			if(sAMC.sDAC.u8UpdatePos < NUM_DAC_CHANNELS)
+			if(s16Return >= 0)
 			{
-				sAMC.sDAC.u8UpdatePos++;
+				//success
+				//change state
+				sAMC.eState = AMC7812_STATE__IDLE;
 			}
 			else
 			{
-				sAMC.sDAC.u8UpdatePos = 0U;
+				vSIL3_FAULTTREE__Set_Flag(&sAMC.sFaultTree, C_LCCM658__CORE__FAULT_INDEX__00);
+				vSIL3_FAULTTREE__Set_Flag(&sAMC.sFaultTree, C_LCCM658__CORE__FAULT_INDEX__02);
+
+				//write error, handle state.
+				sAMC.eState = AMC7812_STATE__FAULT;
 			}
 			break;
 
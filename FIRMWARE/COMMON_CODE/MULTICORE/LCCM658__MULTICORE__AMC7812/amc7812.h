@@ -62,7 +62,13 @@
 		#define AMC7812_DAC_GAIN_FLAG					0U
 
 		// DAC configuration mode flag: 0 for asynchronous, 1 for synchronous
-		#define	AMC7812_DAC_CONFIG_MODE_FLAG			0U
+		#define	AMC7812_DAC_CONFIG_MODE_FLAG			1U
+
+		// AMC config 0 power on value, CMODE set
+		#define AMC7812_AMC_CONFIG_0_DEFAULT			(0x2000U)
+
+		// ILDAC bit in AMC config 0, loads all synchronous DAC latches at once
+		#define AMC7812_AMC_CONFIG_0_ILDAC				(1U << 11U)
 
 		/** AMC7812 Registers */
 		typedef enum
@@ -115,6 +121,8 @@
 
 			AMC7812_REG_ADR__GPIO = 0x4BU,
 
+			AMC7812_REG_ADR__AMC_CONFIG_0 = 0x4CU,
+
 			AMC7812_REG_ADR__SW_DAC_CLEAR = 0x55U,
 
 			AMC7812_REG_ADR__HW_DAC_CLR_EN_0 = 0x56U,
@@ -186,9 +194,6 @@
 				/** Indicate that a new DAC value has been latched */
 				Luint8 u8NewValueLatched[NUM_DAC_CHANNELS];
 
-				/** For round robbin updates */
-				Luint8 u8UpdatePos;
-
 			}sDAC;
 #if 0
 
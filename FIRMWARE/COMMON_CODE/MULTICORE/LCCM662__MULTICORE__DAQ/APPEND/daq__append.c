@@ -43,7 +43,7 @@ Lint16 s16SIL3_DAQ_APPEND__Index_to_Buffer_F32(Luint16 u16Index);
  * @brief
  * Init the append module.
  * 
- * @st_funcMD5		2B5FF6E522591A5E4000B0726733F592
+ * @st_funcMD5		3805D721E94056AF6F4728E03200B4D0
  * @st_funcID		LCCM662R0.FILE.004.FUNC.001
  */
 void vSIL3_DAQ_APPEND__Init(void)
@@ -51,14 +51,6 @@ void vSIL3_DAQ_APPEND__Init(void)
 	Luint16 u16Counter;
 	Luint16 u16Counter2;
 
-	//clear the stats
-	sDAQ.sStats.u32FIFO_U8FullCount = 0U;
-	sDAQ.sStats.u32FIFO_S16FullCount = 0U;
-	sDAQ.sStats.u32FIFO_U16FullCount = 0U;
-	sDAQ.sStats.u32FIFO_S32FullCount = 0U;
-	sDAQ.sStats.u32FIFO_U32FullCount = 0U;
-	sDAQ.sStats.u32FIFO_F32FullCount = 0U;
-
 	#if C_LOCALDEF__LCCM662__NUM_DAQ_CHANNELS__U8 > 0U
 		for(u16Counter = 0; u16Counter < C_LOCALDEF__LCCM662__NUM_DAQ_CHANNELS__U8; u16Counter++)
 		{
@@ -123,81 +115,64 @@ void vSIL3_DAQ_APPEND__Init(void)
  * 
  * @param[in]		u8Value					The value to append
  * @param[in]		u16Index				The stream index
- * @st_funcMD5		AC3BA579451A1EF038A58F2225BDF781
+ * @st_funcMD5		887A740FFFBE66E3584658588C1CC581
  * @st_funcID		LCCM662R0.FILE.004.FUNC.002
  */
 void vSIL3_DAQ_APPEND__U8(Luint16 u16Index, Luint8 u8Value)
 {
 	Lint16 s16Return;
 	Lint16 s16BuffIndex;
-	Lint16 s16R;
 
-	//init
-	s16R = 0;
-	
 	if(sDAQ.u8StreamingOn == 1U)
 	{
 		//memory protection
 		if(u16Index < M_DAQ__NUM_CHANNELS)
 		{
-			//check for an interlock
-			if(sDAQ.sInterlock.u8U8 == 0U)
+			//get our index before we do too much more.
+			s16BuffIndex = s16SIL3_DAQ_APPEND__Index_to_Buffer_U8(u16Index);
+			if(s16BuffIndex >= 0)
 			{
-				sDAQ.sInterlock.u8U8 = 1U;
-
-				//get our index before we do too much more.
-				s16BuffIndex = s16SIL3_DAQ_APPEND__Index_to_Buffer_U8(u16Index);
-				if(s16BuffIndex >= 0)
+				//reserve a slot in this channels ring, no interlock needed as we are the only producer
+				s16Return = s16SIL3_DAQ_RING__Reserve(u16Index);
+				if(s16Return >= 0)
 				{
-					s16Return = s16SIL3_SOFTFIFO__Push(&sDAQ.sFIFO[u16Index]);
-					if(s16Return >= 0)
-					{
-						//write the data in the slot.
-						sDAQ.sBuffers.u8Buffer[(Luint16)s16BuffIndex][(Luint16)s16Return] = u8Value;
-
-						//do the timer if needed.
-						#if C_LOCALDEF__LCCM662__ENABLE_TIMER_IN_DATA == 1U
-							//timer index is based on global index, not related to the data type.
-							sDAQ.sBuffers.u32Timer[u16Index][(Luint16)s16Return] = u32SIL3_DAQ__Get_SystemTimer();
-						#endif
-					}
-					else
-					{
-						//log the fault
-						sDAQ.sStats.u32FIFO_U8FullCount++;
-						s16R = -1;
-					}
+					//write the data in the slot.
+					sDAQ.sBuffers.u8Buffer[(Luint16)s16BuffIndex][(Luint16)s16Return] = u8Value;
+
+					//do the timer if needed.
+					#if C_LOCALDEF__LCCM662__ENABLE_TIMER_IN_DATA == 1U
+						//timer index is based on global index, not related to the data type.
+						sDAQ.sBuffers.u32Timer[u16Index][(Luint16)s16Return] = u32SIL3_DAQ__Get_SystemTimer();
+					#endif
+
+					//publish the slot to the consumer
+					vSIL3_DAQ_RING__Commit(u16Index, (Luint16)s16Return);
 				}
 				else
 				{
-					//big error
-					s16R = -2;
+					//ring was full, the drop has been counted against the channel
+					vSIL3_FAULTTREE__Set_Flag(&sDAQ.sFaultFlags, C_LCCM662__CORE__FAULT_INDEX__00);
+					vSIL3_FAULTTREE__Set_Flag(&sDAQ.sFaultFlags, C_LCCM662__CORE__FAULT_INDEX__02);
 				}
-
-				//clear the interlock.
-				sDAQ.sInterlock.u8U8 = 0U;
-
-			}//if (sDAQ.sInterlock.u8U8 == 0U)
+			}
 			else
 			{
-				//error, we are interlocked
-				sDAQ.sInterlock.u8U8 = 1U;
-				s16R = -3;
-			}//else if (sDAQ.sInterlock.u8U8 == 0U)
+				//index is not one of our type
+				vSIL3_FAULTTREE__Set_Flag(&sDAQ.sFaultFlags, C_LCCM662__CORE__FAULT_INDEX__00);
+				vSIL3_FAULTTREE__Set_Flag(&sDAQ.sFaultFlags, C_LCCM662__CORE__FAULT_INDEX__01);
+			}
 		}
 		else
 		{
-			//log the fault
-			s16R = -4;
+			//out of range
+			vSIL3_FAULTTREE__Set_Flag(&sDAQ.sFaultFlags, C_LCCM662__CORE__FAULT_INDEX__00);
+			vSIL3_FAULTTREE__Set_Flag(&sDAQ.sFaultFlags, C_LCCM662__CORE__FAULT_INDEX__01);
 		}
-
 	}
 	else
 	{
 		//streaming not enabled yet, fall on
 	}
-
-	//return s16R;
 }
 
 #endif
@@ -209,7 +184,7 @@ void vSIL3_DAQ_APPEND__U8(Luint16 u16Index, Luint8 u8Value)
  *
  * @param[in]		s16Value				The value to append
  * @param[in]		u16Index				The stream index
- * @st_funcMD5		600E9702BD683635DC27D82143040133
+ * @st_funcMD5		33CC3065D9898966C61BD42704153B33
  * @st_funcID		LCCM662R0.FILE.004.FUNC.005
  */
 void vSIL3_DAQ_APPEND__S16(Luint16 u16Index, Lint16 s16Value)
@@ -222,49 +197,45 @@ void vSIL3_DAQ_APPEND__S16(Luint16 u16Index, Lint16 s16Value)
 		//memory protection
 		if(u16Index < M_DAQ__NUM_CHANNELS)
 		{
-			//check for an interlock
-			if(sDAQ.sInterlock.u8S16 == 0U)
+			//get our index before we do too much more.
+			s16BuffIndex = s16SIL3_DAQ_APPEND__Index_to_Buffer_S16(u16Index);
+			if(s16BuffIndex >= 0)
 			{
-				sDAQ.sInterlock.u8S16 = 1U;
-
-				//get our index before we do too much more.
-				s16BuffIndex = s16SIL3_DAQ_APPEND__Index_to_Buffer_S16(u16Index);
-				if(s16BuffIndex >= 0)
+				//reserve a slot in this channels ring, no interlock needed as we are the only producer
+				s16Return = s16SIL3_DAQ_RING__Reserve(u16Index);
+				if(s16Return >= 0)
 				{
-					s16Return = s16SIL3_SOFTFIFO__Push(&sDAQ.sFIFO[u16Index]);
-					if(s16Return >= 0)
-					{
-						//write the data in the slot.
-						sDAQ.sBuffers.s16Buffer[(Luint16)s16BuffIndex][(Luint16)s16Return] = s16Value;
-
-						//do the timer if needed.
-						#if C_LOCALDEF__LCCM662__ENABLE_TIMER_IN_DATA == 1U
-							//timer index is based on global index, not related to the data type.
-							sDAQ.sBuffers.u32Timer[u16Index][(Luint16)s16Return] = u32SIL3_DAQ__Get_SystemTimer();
-						#endif
-					}
-					else
-					{
-						sDAQ.sStats.u32FIFO_S16FullCount++;
-						//log the fault
-					}
+					//write the data in the slot.
+					sDAQ.sBuffers.s16Buffer[(Luint16)s16BuffIndex][(Luint16)s16Return] = s16Value;
+
+					//do the timer if needed.
+					#if C_LOCALDEF__LCCM662__ENABLE_TIMER_IN_DATA == 1U
+						//timer index is based on global index, not related to the data type.
+						sDAQ.sBuffers.u32Timer[u16Index][(Luint16)s16Return] = u32SIL3_DAQ__Get_SystemTimer();
+					#endif
+
+					//publish the slot to the consumer
+					vSIL3_DAQ_RING__Commit(u16Index, (Luint16)s16Return);
 				}
 				else
 				{
-					//big error
+					//ring was full, the drop has been counted against the channel
+					vSIL3_FAULTTREE__Set_Flag(&sDAQ.sFaultFlags, C_LCCM662__CORE__FAULT_INDEX__00);
+					vSIL3_FAULTTREE__Set_Flag(&sDAQ.sFaultFlags, C_LCCM662__CORE__FAULT_INDEX__02);
 				}
-
-				sDAQ.sInterlock.u8S16 = 0U;
 			}
 			else
 			{
-				//interlocking error
-				sDAQ.sInterlock.u8S16 = 1U;
+				//index is not one of our type
+				vSIL3_FAULTTREE__Set_Flag(&sDAQ.sFaultFlags, C_LCCM662__CORE__FAULT_INDEX__00);
+				vSIL3_FAULTTREE__Set_Flag(&sDAQ.sFaultFlags, C_LCCM662__CORE__FAULT_INDEX__01);
 			}
 		}
 		else
 		{
-			//log the fault
+			//out of range
+			vSIL3_FAULTTREE__Set_Flag(&sDAQ.sFaultFlags, C_LCCM662__CORE__FAULT_INDEX__00);
+			vSIL3_FAULTTREE__Set_Flag(&sDAQ.sFaultFlags, C_LCCM662__CORE__FAULT_INDEX__01);
 		}
 	}
 	else
@@ -281,7 +252,7 @@ void vSIL3_DAQ_APPEND__S16(Luint16 u16Index, Lint16 s16Value)
  *
  * @param[in]		u16Value				The value to append
  * @param[in]		u16Index				The stream index
- * @st_funcMD5		A6A76FCED1933596F9C7E208C593C499
+ * @st_funcMD5		F4BA973C92B376EAACCAC1BC46DAD121
  * @st_funcID		LCCM662R0.FILE.004.FUNC.006
  */
 void vSIL3_DAQ_APPEND__U16(Luint16 u16Index, Luint16 u16Value)
@@ -294,50 +265,45 @@ void vSIL3_DAQ_APPEND__U16(Luint16 u16Index, Luint16 u16Value)
 		//memory protection
 		if(u16Index < M_DAQ__NUM_CHANNELS)
 		{
-
-			//check for an interlock
-			if(sDAQ.sInterlock.u8U16 == 0U)
+			//get our index before we do too much more.
+			s16BuffIndex = s16SIL3_DAQ_APPEND__Index_to_Buffer_U16(u16Index);
+			if(s16BuffIndex >= 0)
 			{
-				sDAQ.sInterlock.u8U16 = 1U;
-
-				//get our index before we do too much more.
-				s16BuffIndex = s16SIL3_DAQ_APPEND__Index_to_Buffer_U16(u16Index);
-				if(s16BuffIndex >= 0)
+				//reserve a slot in this channels ring, no interlock needed as we are the only producer
+				s16Return = s16SIL3_DAQ_RING__Reserve(u16Index);
+				if(s16Return >= 0)
 				{
-					s16Return = s16SIL3_SOFTFIFO__Push(&sDAQ.sFIFO[u16Index]);
-					if(s16Return >= 0)
-					{
-						//write the data in the slot.
-						sDAQ.sBuffers.u16Buffer[(Luint16)s16BuffIndex][(Luint16)s16Return] = u16Value;
-
-						//do the timer if needed.
-						#if C_LOCALDEF__LCCM662__ENABLE_TIMER_IN_DATA == 1U
-							//timer index is based on global index, not related to the data type.
-							sDAQ.sBuffers.u32Timer[u16Index][(Luint16)s16Return] = u32SIL3_DAQ__Get_SystemTimer();
-						#endif
-					}
-					else
-					{
-						sDAQ.sStats.u32FIFO_U16FullCount++;
-						//log the fault
-					}
+					//write the data in the slot.
+					sDAQ.sBuffers.u16Buffer[(Luint16)s16BuffIndex][(Luint16)s16Return] = u16Value;
+
+					//do the timer if needed.
+					#if C_LOCALDEF__LCCM662__ENABLE_TIMER_IN_DATA == 1U
+						//timer index is based on global index, not related to the data type.
+						sDAQ.sBuffers.u32Timer[u16Index][(Luint16)s16Return] = u32SIL3_DAQ__Get_SystemTimer();
+					#endif
+
+					//publish the slot to the consumer
+					vSIL3_DAQ_RING__Commit(u16Index, (Luint16)s16Return);
 				}
 				else
 				{
-					//big error
+					//ring was full, the drop has been counted against the channel
+					vSIL3_FAULTTREE__Set_Flag(&sDAQ.sFaultFlags, C_LCCM662__CORE__FAULT_INDEX__00);
+					vSIL3_FAULTTREE__Set_Flag(&sDAQ.sFaultFlags, C_LCCM662__CORE__FAULT_INDEX__02);
 				}
-
-				sDAQ.sInterlock.u8U16 = 0U;
 			}
 			else
 			{
-				//interlocking error
-				sDAQ.sInterlock.u8U16 = 1U;
+				//index is not one of our type
+				vSIL3_FAULTTREE__Set_Flag(&sDAQ.sFaultFlags, C_LCCM662__CORE__FAULT_INDEX__00);
+				vSIL3_FAULTTREE__Set_Flag(&sDAQ.sFaultFlags, C_LCCM662__CORE__FAULT_INDEX__01);
 			}
 		}
 		else
 		{
-			//log the fault
+			//out of range
+			vSIL3_FAULTTREE__Set_Flag(&sDAQ.sFaultFlags, C_LCCM662__CORE__FAULT_INDEX__00);
+			vSIL3_FAULTTREE__Set_Flag(&sDAQ.sFaultFlags, C_LCCM662__CORE__FAULT_INDEX__01);
 		}
 	}
 	else
@@ -354,7 +320,7 @@ void vSIL3_DAQ_APPEND__U16(Luint16 u16Index, Luint16 u16Value)
  *
  * @param[in]		s32Value				The value to append
  * @param[in]		u16Index				The stream index
- * @st_funcMD5		3FD889D7270CAE7FE41FD2888234C066
+ * @st_funcMD5		C63722C5AEE9E7F1A3B3EDB9867597DC
  * @st_funcID		LCCM662R0.FILE.004.FUNC.007
  */
 void vSIL3_DAQ_APPEND__S32(Luint16 u16Index, Lint32 s32Value)
@@ -367,49 +333,45 @@ void vSIL3_DAQ_APPEND__S32(Luint16 u16Index, Lint32 s32Value)
 		//memory protection
 		if(u16Index < M_DAQ__NUM_CHANNELS)
 		{
-			//check for an interlock
-			if(sDAQ.sInterlock.u8S32 == 0U)
+			//get our index before we do too much more.
+			s16BuffIndex = s16SIL3_DAQ_APPEND__Index_to_Buffer_S32(u16Index);
+			if(s16BuffIndex >= 0)
 			{
-				sDAQ.sInterlock.u8S32 = 1U;
-
-				//get our index before we do too much more.
-				s16BuffIndex = s16SIL3_DAQ_APPEND__Index_to_Buffer_S32(u16Index);
-				if(s16BuffIndex >= 0)
+				//reserve a slot in this channels ring, no interlock needed as we are the only producer
+				s16Return = s16SIL3_DAQ_RING__Reserve(u16Index);
+				if(s16Return >= 0)
 				{
-					s16Return = s16SIL3_SOFTFIFO__Push(&sDAQ.sFIFO[u16Index]);
-					if(s16Return >= 0)
-					{
-						//write the data in the slot.
-						sDAQ.sBuffers.s32Buffer[(Luint16)s16BuffIndex][(Luint16)s16Return] = s32Value;
-
-						//do the timer if needed.
-						#if C_LOCALDEF__LCCM662__ENABLE_TIMER_IN_DATA == 1U
-							//timer index is based on global index, not related to the data type.
-							sDAQ.sBuffers.u32Timer[u16Index][(Luint16)s16Return] = u32SIL3_DAQ__Get_SystemTimer();
-						#endif
-					}
-					else
-					{
-						sDAQ.sStats.u32FIFO_S32FullCount++;
-						//log the fault
-					}
+					//write the data in the slot.
+					sDAQ.sBuffers.s32Buffer[(Luint16)s16BuffIndex][(Luint16)s16Return] = s32Value;
+
+					//do the timer if needed.
+					#if C_LOCALDEF__LCCM662__ENABLE_TIMER_IN_DATA == 1U
+						//timer index is based on global index, not related to the data type.
+						sDAQ.sBuffers.u32Timer[u16Index][(Luint16)s16Return] = u32SIL3_DAQ__Get_SystemTimer();
+					#endif
+
+					//publish the slot to the consumer
+					vSIL3_DAQ_RING__Commit(u16Index, (Luint16)s16Return);
 				}
 				else
 				{
-					//big error
+					//ring was full, the drop has been counted against the channel
+					vSIL3_FAULTTREE__Set_Flag(&sDAQ.sFaultFlags, C_LCCM662__CORE__FAULT_INDEX__00);
+					vSIL3_FAULTTREE__Set_Flag(&sDAQ.sFaultFlags, C_LCCM662__CORE__FAULT_INDEX__02);
 				}
-
-				sDAQ.sInterlock.u8S32 = 0U;
 			}
 			else
 			{
-				//interlocking error
-				sDAQ.sInterlock.u8S32 = 1U;
+				//index is not one of our type
+				vSIL3_FAULTTREE__Set_Flag(&sDAQ.sFaultFlags, C_LCCM662__CORE__FAULT_INDEX__00);
+				vSIL3_FAULTTREE__Set_Flag(&sDAQ.sFaultFlags, C_LCCM662__CORE__FAULT_INDEX__01);
 			}
 		}
 		else
 		{
-			//log the fault
+			//out of range
+			vSIL3_FAULTTREE__Set_Flag(&sDAQ.sFaultFlags, C_LCCM662__CORE__FAULT_INDEX__00);
+			vSIL3_FAULTTREE__Set_Flag(&sDAQ.sFaultFlags, C_LCCM662__CORE__FAULT_INDEX__01);
 		}
 	}
 	else
@@ -426,7 +388,7 @@ void vSIL3_DAQ_APPEND__S32(Luint16 u16Index, Lint32 s32Value)
  *
  * @param[in]		u32Value				The value to append
  * @param[in]		u16Index				The stream index
- * @st_funcMD5		706404C1DD0AAB58FFB2666580FD09CB
+ * @st_funcMD5		3A0C589E5E918FB545F06ECF5CD79E5D
  * @st_funcID		LCCM662R0.FILE.004.FUNC.008
  */
 void vSIL3_DAQ_APPEND__U32(Luint16 u16Index, Luint32 u32Value)
@@ -439,50 +401,45 @@ void vSIL3_DAQ_APPEND__U32(Luint16 u16Index, Luint32 u32Value)
 		//memory protection
 		if(u16Index < M_DAQ__NUM_CHANNELS)
 		{
-
-			//check for an interlock
-			if(sDAQ.sInterlock.u8U32 == 0U)
+			//get our index before we do too much more.
+			s16BuffIndex = s16SIL3_DAQ_APPEND__Index_to_Buffer_U32(u16Index);
+			if(s16BuffIndex >= 0)
 			{
-				sDAQ.sInterlock.u8U32 = 1U;
-
-				//get our index before we do too much more.
-				s16BuffIndex = s16SIL3_DAQ_APPEND__Index_to_Buffer_U32(u16Index);
-				if(s16BuffIndex >= 0)
+				//reserve a slot in this channels ring, no interlock needed as we are the only producer
+				s16Return = s16SIL3_DAQ_RING__Reserve(u16Index);
+				if(s16Return >= 0)
 				{
-					s16Return = s16SIL3_SOFTFIFO__Push(&sDAQ.sFIFO[u16Index]);
-					if(s16Return >= 0)
-					{
-						//write the data in the slot.
-						sDAQ.sBuffers.u32Buffer[(Luint16)s16BuffIndex][(Luint16)s16Return] = u32Value;
-
-						//do the timer if needed.
-						#if C_LOCALDEF__LCCM662__ENABLE_TIMER_IN_DATA == 1U
-							//timer index is based on global index, not related to the data type.
-							sDAQ.sBuffers.u32Timer[u16Index][(Luint16)s16Return] = u32SIL3_DAQ__Get_SystemTimer();
-						#endif
-					}
-					else
-					{
-						sDAQ.sStats.u32FIFO_U32FullCount++;
-						//log the fault
-					}
+					//write the data in the slot.
+					sDAQ.sBuffers.u32Buffer[(Luint16)s16BuffIndex][(Luint16)s16Return] = u32Value;
+
+					//do the timer if needed.
+					#if C_LOCALDEF__LCCM662__ENABLE_TIMER_IN_DATA == 1U
+						//timer index is based on global index, not related to the data type.
+						sDAQ.sBuffers.u32Timer[u16Index][(Luint16)s16Return] = u32SIL3_DAQ__Get_SystemTimer();
+					#endif
+
+					//publish the slot to the consumer
+					vSIL3_DAQ_RING__Commit(u16Index, (Luint16)s16Return);
 				}
 				else
 				{
-					//big error
+					//ring was full, the drop has been counted against the channel
+					vSIL3_FAULTTREE__Set_Flag(&sDAQ.sFaultFlags, C_LCCM662__CORE__FAULT_INDEX__00);
+					vSIL3_FAULTTREE__Set_Flag(&sDAQ.sFaultFlags, C_LCCM662__CORE__FAULT_INDEX__02);
 				}
-
-				sDAQ.sInterlock.u8U32 = 0U;
 			}
 			else
 			{
-				//interlock error
-				sDAQ.sInterlock.u8U32 = 1U;
+				//index is not one of our type
+				vSIL3_FAULTTREE__Set_Flag(&sDAQ.sFaultFlags, C_LCCM662__CORE__FAULT_INDEX__00);
+				vSIL3_FAULTTREE__Set_Flag(&sDAQ.sFaultFlags, C_LCCM662__CORE__FAULT_INDEX__01);
 			}
 		}
 		else
 		{
-			//log the fault
+			//out of range
+			vSIL3_FAULTTREE__Set_Flag(&sDAQ.sFaultFlags, C_LCCM662__CORE__FAULT_INDEX__00);
+			vSIL3_FAULTTREE__Set_Flag(&sDAQ.sFaultFlags, C_LCCM662__CORE__FAULT_INDEX__01);
 		}
 	}
 	else
@@ -499,7 +456,7 @@ void vSIL3_DAQ_APPEND__U32(Luint16 u16Index, Luint32 u32Value)
  *
  * @param[in]		f32Value				The value to append
  * @param[in]		u16Index				The stream index
- * @st_funcMD5		2C29E8D0D08CB43F2784AC1F6E1C700C
+ * @st_funcMD5		EFA85A4C72EBBB819658C1DDDDE96A1F
  * @st_funcID		LCCM662R0.FILE.004.FUNC.009
  */
 void vSIL3_DAQ_APPEND__F32(Luint16 u16Index, Lfloat32 f32Value)
@@ -512,56 +469,51 @@ void vSIL3_DAQ_APPEND__F32(Luint16 u16Index, Lfloat32 f32Value)
 		//memory protection
 		if(u16Index < M_DAQ__NUM_CHANNELS)
 		{
-			if(sDAQ.sInterlock.u8F32 == 0U)
+			//get our index before we do too much more.
+			s16BuffIndex = s16SIL3_DAQ_APPEND__Index_to_Buffer_F32(u16Index);
+			if(s16BuffIndex >= 0)
 			{
-				sDAQ.sInterlock.u8F32 = 1U;
-
-				//get our index before we do too much more.
-				s16BuffIndex = s16SIL3_DAQ_APPEND__Index_to_Buffer_F32(u16Index);
-				if(s16BuffIndex >= 0)
+				//reserve a slot in this channels ring, no interlock needed as we are the only producer
+				s16Return = s16SIL3_DAQ_RING__Reserve(u16Index);
+				if(s16Return >= 0)
 				{
-					s16Return = s16SIL3_SOFTFIFO__Push(&sDAQ.sFIFO[u16Index]);
-					if(s16Return >= 0)
-					{
-						//write the data in the slot.
-						sDAQ.sBuffers.f32Buffer[(Luint16)s16BuffIndex][(Luint16)s16Return] = f32Value;
-
-						//do the timer if needed.
-						#if C_LOCALDEF__LCCM662__ENABLE_TIMER_IN_DATA == 1U
-							//timer index is based on global index, not related to the data type.
-							sDAQ.sBuffers.u32Timer[u16Index][(Luint16)s16Return] = u32SIL3_DAQ__Get_SystemTimer();
-						#endif
-					}
-					else
-					{
-						sDAQ.sStats.u32FIFO_F32FullCount++;
-						//log the fault
-					}
+					//write the data in the slot.
+					sDAQ.sBuffers.f32Buffer[(Luint16)s16BuffIndex][(Luint16)s16Return] = f32Value;
+
+					//do the timer if needed.
+					#if C_LOCALDEF__LCCM662__ENABLE_TIMER_IN_DATA == 1U
+						//timer index is based on global index, not related to the data type.
+						sDAQ.sBuffers.u32Timer[u16Index][(Luint16)s16Return] = u32SIL3_DAQ__Get_SystemTimer();
+					#endif
+
+					//publish the slot to the consumer
+					vSIL3_DAQ_RING__Commit(u16Index, (Luint16)s16Return);
 				}
 				else
 				{
-					//big error
+					//ring was full, the drop has been counted against the channel
+					vSIL3_FAULTTREE__Set_Flag(&sDAQ.sFaultFlags, C_LCCM662__CORE__FAULT_INDEX__00);
+					vSIL3_FAULTTREE__Set_Flag(&sDAQ.sFaultFlags, C_LCCM662__CORE__FAULT_INDEX__02);
 				}
-
-				sDAQ.sInterlock.u8F32 = 0U;
 			}
 			else
 			{
-				//interlocking error
-				sDAQ.sInterlock.u8F32  = 1U;
+				//index is not one of our type
+				vSIL3_FAULTTREE__Set_Flag(&sDAQ.sFaultFlags, C_LCCM662__CORE__FAULT_INDEX__00);
+				vSIL3_FAULTTREE__Set_Flag(&sDAQ.sFaultFlags, C_LCCM662__CORE__FAULT_INDEX__01);
 			}
 		}
 		else
 		{
-			//log the fault
+			//out of range
+			vSIL3_FAULTTREE__Set_Flag(&sDAQ.sFaultFlags, C_LCCM662__CORE__FAULT_INDEX__00);
+			vSIL3_FAULTTREE__Set_Flag(&sDAQ.sFaultFlags, C_LCCM662__CORE__FAULT_INDEX__01);
 		}
-
 	}
 	else
 	{
 		//streaming not enabled yet, fall on
 	}
-
 }
 
 #endif
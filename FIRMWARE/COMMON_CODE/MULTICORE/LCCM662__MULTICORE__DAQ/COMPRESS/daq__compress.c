@@ -0,0 +1,251 @@
+/**
+ * @file		DAQ__COMPRESS.C
+ * @brief		Delta / zig-zag varint encoding of DAQ channels
+ * @author		Lachlan Grogan
+ * @copyright	This file contains proprietary and confidential information of
+ *				SIL3 Pty. Ltd. (ACN 123 529 064). This code may be distributed
+ *				under a license from SIL3 Pty. Ltd., and may be used, copied
+ *				and/or disclosed only pursuant to the terms of that license agreement.
+ *				This copyright notice must be retained as part of this file at all times.
+ * @copyright	This file is copyright SIL3 Pty. Ltd. 2003-2016, All Rights Reserved.
+ * @st_fileID	LCCM662R0.FILE.008
+ */
+/*
+ * ENCODED PACKET
+ * U8		Flags, bit 0 = timer present
+ * U8		Channel type (E_DAQ__CHANNEL_TYPES)
+ * U16		Number of samples
+ *
+ * Then for each sample
+ * [var]	Timer delta from the previous sample, unsigned varint (only if timer present)
+ * [var]	Value delta from the previous sample, zig-zag varint
+ *
+ * The previous timer and value start at 0 in every packet, so the first sample
+ * is sent in full and a lost packet does not break the next one.
+ *
+ * Values are deltaed as 32 bit: S16 is sign extended and F32 uses its bit
+ * pattern, slowly changing floats of the same sign and exponent give small deltas.
+ *
+ * Varints are 7 bits per byte, LSB group first, bit 7 set if more bytes follow.
+ * Zig-zag maps 0, -1, 1, -2 ... to 0, 1, 2, 3 ... so small negative deltas stay short.
+ */
+
+#include "../daq.h"
+/**
+ * @addtogroup MULTICORE
+ * @{
+*/
+/**
+ * @addtogroup DAQ
+ * @ingroup MULTICORE
+ * @{
+*/
+/**
+ * @addtogroup DAQ__COMPRESS
+ * @ingroup DAQ
+ * @{
+*/
+#if C_LOCALDEF__LCCM662__ENABLE_THIS_MODULE == 1U
+#if C_LOCALDEF__LCCM662__ENABLE_COMPRESSION == 1U
+
+extern struct _strDAQ sDAQ;
+
+//locals
+static Luint32 u32SIL3_DAQ_COMPRESS__Get_Sample(Luint16 u16Index, const Luint8 *pu8Ring, Luint16 u16Slot);
+static Luint8 u8SIL3_DAQ_COMPRESS__Put_VarInt(Luint8 *pu8Dest, Luint32 u32Value);
+
+/***************************************************************************//**
+ * @brief
+ * Encode a run of samples from a channels ring into the compress buffer.
+ *
+ * @note
+ * Encodes from the tail up to the end of the ring then any samples that have
+ * wrapped to the start. Stops early if the next sample could overflow
+ * C_LOCALDEF__LCCM662__COMPRESS_MAX_BYTES, the caller must only release the
+ * number of samples returned in pu16Samples.
+ *
+ * @param[out]		*pu16Samples			Number of samples encoded
+ * @param[in]		u16Wrapped				Samples waiting at the start of the ring
+ * @param[in]		u16Burst				Samples from the start slot to the end of the ring
+ * @param[in]		u16Start				Slot of the first sample
+ * @param[in]		*pu8Ring				Start of the channels ring
+ * @param[in]		u16Index				The stream index
+ * @return			Encoded length in bytes, data is in sDAQ.sCompress.u8Buffer
+ * @st_funcMD5		559CEB085802C12307DB6CF23E12C062
+ * @st_funcID		LCCM662R0.FILE.008.FUNC.001
+ */
+Luint16 u16SIL3_DAQ_COMPRESS__Encode(Luint16 u16Index, const Luint8 *pu8Ring, Luint16 u16Start, Luint16 u16Burst, Luint16 u16Wrapped, Luint16 *pu16Samples)
+{
+	Luint8 *pu8Dest;
+	Luint16 u16Length;
+	Luint16 u16Total;
+	Luint16 u16Count;
+	Luint16 u16Slot;
+	Luint32 u32Value;
+	Luint32 u32PrevValue;
+	Luint32 u32Delta;
+	#if C_LOCALDEF__LCCM662__ENABLE_TIMER_IN_DATA == 1U
+	Luint32 u32Timer;
+	Luint32 u32PrevTimer;
+	#endif
+
+	pu8Dest = &sDAQ.sCompress.u8Buffer[0];
+
+	//header, count is filled in once we know it
+	#if C_LOCALDEF__LCCM662__ENABLE_TIMER_IN_DATA == 1U
+		pu8Dest[0] = 0x01U;
+	#else
+		pu8Dest[0] = 0x00U;
+	#endif
+	pu8Dest[1] = u8SIL3_DAQ__Get_ChannelType(u16Index);
+	u16Length = C_DAQ__COMPRESS_HEADER_BYTES;
+
+	//first sample goes in full
+	u32PrevValue = 0U;
+	#if C_LOCALDEF__LCCM662__ENABLE_TIMER_IN_DATA == 1U
+	u32PrevTimer = 0U;
+	#endif
+
+	u16Total = u16Burst + u16Wrapped;
+	u16Slot = u16Start;
+	u16Count = 0U;
+
+	//stop when the worst case sample may not fit
+	while((u16Count < u16Total) && ((u16Length + C_DAQ__COMPRESS_MAX_SAMPLE_BYTES) <= C_LOCALDEF__LCCM662__COMPRESS_MAX_BYTES))
+	{
+		//move to the start of the ring once the first run is done
+		if(u16Count == u16Burst)
+		{
+			u16Slot = 0U;
+		}
+		else
+		{
+			//fall on
+		}
+
+		#if C_LOCALDEF__LCCM662__ENABLE_TIMER_IN_DATA == 1U
+			//the timer only goes forward, modulo 2^32 takes care of the wrap
+			u32Timer = sDAQ.sBuffers.u32Timer[u16Index][u16Slot];
+			u16Length += (Luint16)u8SIL3_DAQ_COMPRESS__Put_VarInt(&pu8Dest[u16Length], u32Timer - u32PrevTimer);
+			u32PrevTimer = u32Timer;
+		#endif
+
+		//delta then zig-zag so small steps either way are short
+		u32Value = u32SIL3_DAQ_COMPRESS__Get_Sample(u16Index, pu8Ring, u16Slot);
+		u32Delta = u32Value - u32PrevValue;
+		if((u32Delta & 0x80000000U) == 0x80000000U)
+		{
+			u32Delta = ((~u32Delta) << 1U) | 0x00000001U;
+		}
+		else
+		{
+			u32Delta = u32Delta << 1U;
+		}
+		u16Length += (Luint16)u8SIL3_DAQ_COMPRESS__Put_VarInt(&pu8Dest[u16Length], u32Delta);
+		u32PrevValue = u32Value;
+
+		u16Slot++;
+		u16Count++;
+	}
+
+	vSIL3_NUM_CONVERT__Array_U16(&pu8Dest[2], u16Count);
+
+	*pu16Samples = u16Count;
+	return u16Length;
+}
+
+/***************************************************************************//**
+ * @brief
+ * Get a sample from the ring as a 32 bit pattern.
+ *
+ * @param[in]		u16Slot					The ring slot
+ * @param[in]		*pu8Ring				Start of the channels ring
+ * @param[in]		u16Index				The stream index
+ * @return			Sign extended for S16, raw bits for F32
+ * @st_funcMD5		31D90FA32F347D0A6FC7F0EA9E2AAC08
+ * @st_funcID		LCCM662R0.FILE.008.FUNC.002
+ */
+static Luint32 u32SIL3_DAQ_COMPRESS__Get_Sample(Luint16 u16Index, const Luint8 *pu8Ring, Luint16 u16Slot)
+{
+	Luint32 u32Return;
+
+	switch((E_DAQ__CHANNEL_TYPES)u8SIL3_DAQ__Get_ChannelType(u16Index))
+	{
+		case DAQ_CHANNEL_TYPE__U8:
+			u32Return = (Luint32)pu8Ring[u16Slot];
+			break;
+
+		case DAQ_CHANNEL_TYPE__S16:
+			u32Return = (Luint32)((Lint32)((const Lint16 *)pu8Ring)[u16Slot]);
+			break;
+
+		case DAQ_CHANNEL_TYPE__U16:
+			u32Return = (Luint32)((const Luint16 *)pu8Ring)[u16Slot];
+			break;
+
+		case DAQ_CHANNEL_TYPE__S32:
+		case DAQ_CHANNEL_TYPE__U32:
+		case DAQ_CHANNEL_TYPE__F32:
+		default:
+			//same width, we only care about the bits
+			u32Return = ((const Luint32 *)pu8Ring)[u16Slot];
+			break;
+	}
+
+	return u32Return;
+}
+
+/***************************************************************************//**
+ * @brief
+ * Write an unsigned varint.
+ *
+ * @param[in]		u32Value				The value
+ * @param[out]		*pu8Dest				Where to write, up to 5 bytes
+ * @return			Number of bytes written
+ * @st_funcMD5		0EC3760AF9EC5A386415CCC8DB90F809
+ * @st_funcID		LCCM662R0.FILE.008.FUNC.003
+ */
+static Luint8 u8SIL3_DAQ_COMPRESS__Put_VarInt(Luint8 *pu8Dest, Luint32 u32Value)
+{
+	Luint8 u8Count;
+
+	u8Count = 0U;
+
+	//7 bits at a time with the continue flag
+	while(u32Value > 0x7FU)
+	{
+		pu8Dest[u8Count] = (Luint8)(u32Value & 0x7FU) | 0x80U;
+		u32Value >>= 7U;
+		u8Count++;
+	}
+
+	//last group
+	pu8Dest[u8Count] = (Luint8)u32Value;
+	u8Count++;
+
+	return u8Count;
+}
+
+//safetys
+#if C_LOCALDEF__LCCM662__COMPRESS_MAX_BYTES > C_DAQ__COMPRESS_BUFFER_BYTES
+	#error
+#endif
+#if C_LOCALDEF__LCCM662__COMPRESS_MAX_BYTES < (C_DAQ__COMPRESS_HEADER_BYTES + C_DAQ__COMPRESS_MAX_SAMPLE_BYTES)
+	//must fit at least one sample
+	#error
+#endif
+#ifndef C_LOCALDEF__LCCM118__ENABLE_THIS_MODULE
+	//header fields need the numerical module
+	#error
+#endif
+
+#endif //C_LOCALDEF__LCCM662__ENABLE_COMPRESSION
+#endif //#if C_LOCALDEF__LCCM662__ENABLE_THIS_MODULE == 1U
+//safetys
+#ifndef C_LOCALDEF__LCCM662__ENABLE_THIS_MODULE
+	#error
+#endif
+/** @} */
+/** @} */
+/** @} */
+
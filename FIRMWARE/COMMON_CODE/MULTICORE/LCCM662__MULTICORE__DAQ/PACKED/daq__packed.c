@@ -0,0 +1,384 @@
+/**
+ * @file		DAQ__PACKED.C
+ * @brief		Pack many DAQ channels into one frame
+ * @author		Lachlan Grogan
+ * @copyright	This file contains proprietary and confidential information of
+ *				SIL3 Pty. Ltd. (ACN 123 529 064). This code may be distributed
+ *				under a license from SIL3 Pty. Ltd., and may be used, copied
+ *				and/or disclosed only pursuant to the terms of that license agreement.
+ *				This copyright notice must be retained as part of this file at all times.
+ * @copyright	This file is copyright SIL3 Pty. Ltd. 2003-2016, All Rights Reserved.
+ * @st_fileID	LCCM662R0.FILE.007
+ */
+/*
+ * DATA FRAME
+ * U16		Frame sequence number, increments each data frame
+ * U8		Number of blocks in this frame
+ * U8		Spare (0)
+ *
+ * Then for each block
+ * U8		Channel index
+ * U8		Channel type (E_DAQ__CHANNEL_TYPES)
+ * U16		Number of samples
+ * U32		Timer of the first sample in the block, from the per sample timers
+ * [n]		Samples * bytes per sample, raw as they sit in the channel ring
+ *
+ * SCHEMA
+ * U16		Schema version
+ * U16		Number of channels
+ * U16		Max frame size in bytes
+ * U16		Spare (0)
+ *
+ * Then for each channel
+ * U8		Channel type (E_DAQ__CHANNEL_TYPES)
+ * U8		Bytes per sample
+ * U16		Watermark level in samples
+ *
+ * Header fields are written with the numerical module so they share the byte order
+ * of every other packet we send.
+ */
+
+#include "../daq.h"
+/**
+ * @addtogroup MULTICORE
+ * @{
+*/
+/**
+ * @addtogroup DAQ
+ * @ingroup MULTICORE
+ * @{
+*/
+/**
+ * @addtogroup DAQ__PACKED
+ * @ingroup DAQ
+ * @{
+*/
+#if C_LOCALDEF__LCCM662__ENABLE_THIS_MODULE == 1U
+#if C_LOCALDEF__LCCM662__ENABLE_PACKED_FRAMES == 1U
+
+extern struct _strDAQ sDAQ;
+
+//locals
+static void vSIL3_DAQ_PACKED__Build_Schema(void);
+static void vSIL3_DAQ_PACKED__Transmit(void);
+
+/***************************************************************************//**
+ * @brief
+ * Init the packed frame module.
+ *
+ * @st_funcMD5		D5758AD5503B49C7E2D000A8FA6E73F5
+ * @st_funcID		LCCM662R0.FILE.007.FUNC.001
+ */
+void vSIL3_DAQ_PACKED__Init(void)
+{
+	sDAQ.sPacked.u16Length = 0U;
+	sDAQ.sPacked.u8TxPending = 0U;
+	sDAQ.sPacked.eTxType = DAQ_PACKED__DATA_FRAME;
+	sDAQ.sPacked.u16FrameSequence = 0U;
+
+	//always describe ourselves before the first frame
+	sDAQ.sPacked.u8SchemaPending = 1U;
+}
+
+/***************************************************************************//**
+ * @brief
+ * Ask for the schema to be sent before the next data frame.
+ *
+ * @note
+ * Called when streaming is turned on, or when the ground station has lost
+ * track of the channel layout.
+ *
+ * @st_funcMD5		D6D08DDE72037A815EC0C668AEA14707
+ * @st_funcID		LCCM662R0.FILE.007.FUNC.002
+ */
+void vSIL3_DAQ_PACKED__Request_Schema(void)
+{
+	sDAQ.sPacked.u8SchemaPending = 1U;
+}
+
+/***************************************************************************//**
+ * @brief
+ * Pack the watermarked / flushed channels, replaces the per channel transmit
+ * in the DAQ_STATE__PROCESS_FILL state.
+ *
+ * @note
+ * Builds at most one frame per call. Channels are walked from the current
+ * process point, each one is copied in as a block and released straight back
+ * to its producer. A channel that does not fit is finished in the next frame.
+ * Once the last channel is serviced the process point moves the main state
+ * back to DAQ_STATE__CHECK_FILL.
+ *
+ * @st_funcMD5		3DB984D4CE804B27BEBD6D79426FC8A1
+ * @st_funcID		LCCM662R0.FILE.007.FUNC.003
+ */
+void vSIL3_DAQ_PACKED__Process(void)
+{
+	Lint16 s16Return;
+	Luint8 *pu8Ring;
+	Luint8 *pu8Frame;
+	Luint16 u16Index;
+	Luint16 u16Level;
+	Luint16 u16Fit;
+	Luint16 u16Take;
+	Luint16 u16Burst;
+	Luint16 u16Start;
+	Luint16 u16Wrapped;
+	Luint16 u16Size;
+	Luint16 u16Counter;
+	Luint8 u8NumBlocks;
+	Luint8 u8Full;
+
+	if(sDAQ.sPacked.u8TxPending == 1U)
+	{
+		//the last frame could not go out, keep trying before building any more.
+		vSIL3_DAQ_PACKED__Transmit();
+	}
+	else if(sDAQ.sPacked.u8SchemaPending == 1U)
+	{
+		//schema goes before any data
+		vSIL3_DAQ_PACKED__Build_Schema();
+		sDAQ.sPacked.u8SchemaPending = 0U;
+		vSIL3_DAQ_PACKED__Transmit();
+	}
+	else
+	{
+		//leave room for the frame header
+		sDAQ.sPacked.u16Length = C_DAQ__PACKED_FRAME_HEADER_BYTES;
+		u8NumBlocks = 0U;
+		u8Full = 0U;
+
+		//walk the channels until we are full or have serviced them all
+		while((u8Full == 0U) && (sDAQ.eMainState == DAQ_STATE__PROCESS_FILL))
+		{
+			u16Index = sDAQ.u16ProcessPoint;
+
+			if((sDAQ.u8WatermarkFlag[u16Index] == 1U) || (sDAQ.u8ForceFlushFlag[u16Index] == 1U))
+			{
+				u16Size = (Luint16)sDAQ.u8SizeMultiplier[u16Index];
+
+				//how many samples are waiting, both halves of the ring come from the same snapshot
+				u16Burst = u16SIL3_DAQ_RING__Get_Contiguous(u16Index, &u16Start, &u16Wrapped);
+				u16Level = u16Burst + u16Wrapped;
+
+				//how many samples will fit after the block header
+				if((sDAQ.sPacked.u16Length + C_DAQ__PACKED_BLOCK_HEADER_BYTES) < C_LOCALDEF__LCCM662__PACKED_FRAME_MAX_BYTES)
+				{
+					u16Fit = (C_LOCALDEF__LCCM662__PACKED_FRAME_MAX_BYTES - (sDAQ.sPacked.u16Length + C_DAQ__PACKED_BLOCK_HEADER_BYTES)) / u16Size;
+				}
+				else
+				{
+					u16Fit = 0U;
+				}
+
+				//also limited by the block count field
+				if(u8NumBlocks == 0xFFU)
+				{
+					u16Fit = 0U;
+				}
+				else
+				{
+					//fall on
+				}
+
+				if(u16Level == 0U)
+				{
+					//nothing waiting, a flush on an empty channel is done
+					sDAQ.u8WatermarkFlag[u16Index] = 0U;
+					sDAQ.u8ForceFlushFlag[u16Index] = 0U;
+					vSIL3_DAQ__Next_ProcessPoint();
+				}
+				else if(u16Fit == 0U)
+				{
+					//frame is full, carry on from this channel next frame
+					u8Full = 1U;
+				}
+				else
+				{
+					pu8Ring = 0;
+					s16Return = s16SIL3_DAQ_APPEND__Index_to_BufferPointer(u16Index, &pu8Ring);
+					if(s16Return == 0)
+					{
+						//take what will fit
+						if(u16Level > u16Fit)
+						{
+							u16Take = u16Fit;
+							if(u16Burst > u16Take)
+							{
+								u16Burst = u16Take;
+							}
+							else
+							{
+								//fall on
+							}
+							u16Wrapped = u16Take - u16Burst;
+						}
+						else
+						{
+							//all of it fits
+							u16Take = u16Level;
+						}
+
+						//block header
+						pu8Frame = &sDAQ.sPacked.u8Frame[sDAQ.sPacked.u16Length];
+						pu8Frame[0] = (Luint8)u16Index;
+						pu8Frame[1] = u8SIL3_DAQ__Get_ChannelType(u16Index);
+						vSIL3_NUM_CONVERT__Array_U16(pu8Frame + 2U, u16Take);
+						vSIL3_NUM_CONVERT__Array_U32(pu8Frame + 4U, sDAQ.sBuffers.u32Timer[u16Index][u16Start]);
+						pu8Frame += C_DAQ__PACKED_BLOCK_HEADER_BYTES;
+
+						//copy from the tail up to the end of the ring
+						for(u16Counter = 0U; u16Counter < (u16Burst * u16Size); u16Counter++)
+						{
+							pu8Frame[u16Counter] = pu8Ring[((Luint32)u16Start * (Luint32)u16Size) + (Luint32)u16Counter];
+						}
+						pu8Frame += u16Burst * u16Size;
+
+						//then anything that has wrapped back to the start
+						for(u16Counter = 0U; u16Counter < (u16Wrapped * u16Size); u16Counter++)
+						{
+							pu8Frame[u16Counter] = pu8Ring[u16Counter];
+						}
+
+						sDAQ.sPacked.u16Length += C_DAQ__PACKED_BLOCK_HEADER_BYTES + (u16Take * u16Size);
+						u8NumBlocks++;
+
+						//we have our own copy, the producer can have the slots back now
+						vSIL3_DAQ_RING__Release(u16Index, u16Take);
+					}
+					else
+					{
+						//we got the wrong buffer index or something out of range, drop the request.
+						vSIL3_FAULTTREE__Set_Flag(&sDAQ.sFaultFlags, C_LCCM662__CORE__FAULT_INDEX__00);
+						vSIL3_FAULTTREE__Set_Flag(&sDAQ.sFaultFlags, C_LCCM662__CORE__FAULT_INDEX__01);
+						u16Take = u16Level;
+					}
+
+					if(u16Take == u16Level)
+					{
+						//everything up to the snapshot has gone, move on
+						sDAQ.u8WatermarkFlag[u16Index] = 0U;
+						sDAQ.u8ForceFlushFlag[u16Index] = 0U;
+						vSIL3_DAQ__Next_ProcessPoint();
+					}
+					else
+					{
+						//frame is full, the rest of this channel goes next frame
+						u8Full = 1U;
+					}
+				}
+			}
+			else
+			{
+				//nothing to do for this index.
+				vSIL3_DAQ__Next_ProcessPoint();
+			}
+		}
+
+		if(u8NumBlocks > 0U)
+		{
+			//frame header
+			pu8Frame = &sDAQ.sPacked.u8Frame[0];
+			vSIL3_NUM_CONVERT__Array_U16(pu8Frame, sDAQ.sPacked.u16FrameSequence);
+			pu8Frame[2] = u8NumBlocks;
+			pu8Frame[3] = 0U;
+
+			sDAQ.sPacked.u16FrameSequence++;
+			sDAQ.sPacked.eTxType = DAQ_PACKED__DATA_FRAME;
+			vSIL3_DAQ_PACKED__Transmit();
+		}
+		else
+		{
+			//nothing was waiting
+			sDAQ.sPacked.u16Length = 0U;
+		}
+	}
+}
+
+/***************************************************************************//**
+ * @brief
+ * Build the schema into the frame buffer.
+ *
+ * @st_funcMD5		BF43B8037A75DCF168233CE42F6D342D
+ * @st_funcID		LCCM662R0.FILE.007.FUNC.004
+ */
+static void vSIL3_DAQ_PACKED__Build_Schema(void)
+{
+	Luint8 *pu8Frame;
+	Luint16 u16Counter;
+
+	pu8Frame = &sDAQ.sPacked.u8Frame[0];
+
+	vSIL3_NUM_CONVERT__Array_U16(pu8Frame, C_DAQ__PACKED_SCHEMA_VERSION);
+	vSIL3_NUM_CONVERT__Array_U16(pu8Frame + 2U, (Luint16)M_DAQ__NUM_CHANNELS);
+	vSIL3_NUM_CONVERT__Array_U16(pu8Frame + 4U, C_LOCALDEF__LCCM662__PACKED_FRAME_MAX_BYTES);
+	vSIL3_NUM_CONVERT__Array_U16(pu8Frame + 6U, 0U);
+	pu8Frame += C_DAQ__PACKED_SCHEMA_HEADER_BYTES;
+
+	//one entry per channel in index order
+	for(u16Counter = 0U; u16Counter < M_DAQ__NUM_CHANNELS; u16Counter++)
+	{
+		pu8Frame[0] = u8SIL3_DAQ__Get_ChannelType(u16Counter);
+		pu8Frame[1] = sDAQ.u8SizeMultiplier[u16Counter];
+		vSIL3_NUM_CONVERT__Array_U16(pu8Frame + 2U, sDAQ.u16WatermarkLevel[u16Counter]);
+		pu8Frame += C_DAQ__PACKED_SCHEMA_ENTRY_BYTES;
+	}
+
+	sDAQ.sPacked.u16Length = C_DAQ__PACKED_SCHEMA_HEADER_BYTES + (M_DAQ__NUM_CHANNELS * C_DAQ__PACKED_SCHEMA_ENTRY_BYTES);
+	sDAQ.sPacked.eTxType = DAQ_PACKED__SCHEMA;
+}
+
+/***************************************************************************//**
+ * @brief
+ * Try and send the frame buffer, leaving it pending if the transmitter is busy.
+ *
+ * @st_funcMD5		B242D32553B5DE9A6FB3471818ED273B
+ * @st_funcID		LCCM662R0.FILE.007.FUNC.005
+ */
+static void vSIL3_DAQ_PACKED__Transmit(void)
+{
+	Lint16 s16Test;
+
+	//we may fail here due to Eth interface currently processing something else, so come back and re-try
+	s16Test = M_LOCALDEF__LCCM662__TX_PACKED_HANDLER((Luint16)sDAQ.sPacked.eTxType, &sDAQ.sPacked.u8Frame[0], sDAQ.sPacked.u16Length);
+	if(s16Test >= 0)
+	{
+		sDAQ.sPacked.u8TxPending = 0U;
+	}
+	else
+	{
+		//hold the frame, the data has already left the rings
+		sDAQ.sPacked.u8TxPending = 1U;
+	}
+}
+
+//safetys
+#if C_LOCALDEF__LCCM662__PACKED_FRAME_MAX_BYTES > C_DAQ__PACKED_FRAME_BUFFER_BYTES
+	#error
+#endif
+#if (C_DAQ__PACKED_SCHEMA_HEADER_BYTES + (M_DAQ__NUM_CHANNELS * C_DAQ__PACKED_SCHEMA_ENTRY_BYTES)) > C_LOCALDEF__LCCM662__PACKED_FRAME_MAX_BYTES
+	//schema has to fit in a frame
+	#error
+#endif
+#if M_DAQ__NUM_CHANNELS > 256U
+	//channel index is a U8 in the block header
+	#error
+#endif
+#if C_LOCALDEF__LCCM662__ENABLE_TIMER_IN_DATA != 1U
+	//each block is stamped with the timer of its first sample
+	#error
+#endif
+#ifndef C_LOCALDEF__LCCM118__ENABLE_THIS_MODULE
+	//header fields need the numerical module
+	#error
+#endif
+
+#endif //C_LOCALDEF__LCCM662__ENABLE_PACKED_FRAMES
+#endif //#if C_LOCALDEF__LCCM662__ENABLE_THIS_MODULE == 1U
+//safetys
+#ifndef C_LOCALDEF__LCCM662__ENABLE_THIS_MODULE
+	#error
+#endif
+/** @} */
+/** @} */
+/** @} */
+
@@ -0,0 +1,254 @@
+/**
+ * @file		DAQ__RING.C
+ * @brief		Single producer / single consumer ring per DAQ channel
+ * @author		Lachlan Grogan
+ * @copyright	This file contains proprietary and confidential information of
+ *				SIL3 Pty. Ltd. (ACN 123 529 064). This code may be distributed
+ *				under a license from SIL3 Pty. Ltd., and may be used, copied
+ *				and/or disclosed only pursuant to the terms of that license agreement.
+ *				This copyright notice must be retained as part of this file at all times.
+ * @copyright	This file is copyright SIL3 Pty. Ltd. 2003-2016, All Rights Reserved.
+ * @st_fileID	LCCM662R0.FILE.005
+ */
+
+
+#include "../daq.h"
+/**
+ * @addtogroup MULTICORE
+ * @{
+*/
+/**
+ * @addtogroup DAQ
+ * @ingroup MULTICORE
+ * @{
+*/
+/**
+ * @addtogroup DAQ__RING
+ * @ingroup DAQ
+ * @{
+*/
+#if C_LOCALDEF__LCCM662__ENABLE_THIS_MODULE == 1U
+
+extern struct _strDAQ sDAQ;
+
+/***************************************************************************//**
+ * @brief
+ * Init a channels ring.
+ *
+ * @note
+ * The ring keeps one slot empty so that head == tail always means empty,
+ * this way the producer and consumer never have to share a fill counter.
+ *
+ * @param[in]		u16Size					Number of elements in the channels buffer
+ * @param[in]		u16Index				The stream index
+ * @st_funcMD5		1F6D50CF93B7BBA9648F0FB76335FC06
+ * @st_funcID		LCCM662R0.FILE.005.FUNC.001
+ */
+void vSIL3_DAQ_RING__Init(Luint16 u16Index, Luint16 u16Size)
+{
+	sDAQ.sRing[u16Index].u16Head = 0U;
+	sDAQ.sRing[u16Index].u16Tail = 0U;
+	sDAQ.sRing[u16Index].u16Size = u16Size;
+	sDAQ.sRing[u16Index].u32DropCount = 0U;
+}
+
+/***************************************************************************//**
+ * @brief
+ * Reserve the next write slot, PRODUCER side only.
+ *
+ * @note
+ * Only reads the tail, so an ISR can safely call this while the main loop
+ * is draining the same channel. The slot is not visible to the consumer
+ * until vSIL3_DAQ_RING__Commit() is called.
+ *
+ * @param[in]		u16Index				The stream index
+ * @return			The slot index to write to or\n
+ * 					-1 if the ring is full and the sample was dropped
+ * @st_funcMD5		402058902B796AC5F64771F172F8937E
+ * @st_funcID		LCCM662R0.FILE.005.FUNC.002
+ */
+Lint16 s16SIL3_DAQ_RING__Reserve(Luint16 u16Index)
+{
+	Lint16 s16Return;
+	Luint16 u16Head;
+	Luint16 u16Next;
+
+	//take a local copy of our head, only we modify it.
+	u16Head = sDAQ.sRing[u16Index].u16Head;
+
+	//compute the next position with wrap
+	u16Next = u16Head + 1U;
+	if(u16Next >= sDAQ.sRing[u16Index].u16Size)
+	{
+		u16Next = 0U;
+	}
+	else
+	{
+		//fall on
+	}
+
+	//if the next head would hit the tail we are full
+	if(u16Next == sDAQ.sRing[u16Index].u16Tail)
+	{
+		//count the drop against this channel
+		sDAQ.sRing[u16Index].u32DropCount++;
+		s16Return = -1;
+	}
+	else
+	{
+		//give the slot back to the caller
+		s16Return = (Lint16)u16Head;
+	}
+
+	return s16Return;
+}
+
+/***************************************************************************//**
+ * @brief
+ * Publish a previously reserved slot, PRODUCER side only.
+ *
+ * @param[in]		u16Slot					The slot returned from Reserve
+ * @param[in]		u16Index				The stream index
+ * @st_funcMD5		9AC4F445976FA192ACC90E38CB41E98A
+ * @st_funcID		LCCM662R0.FILE.005.FUNC.003
+ */
+void vSIL3_DAQ_RING__Commit(Luint16 u16Index, Luint16 u16Slot)
+{
+	Luint16 u16Next;
+
+	u16Next = u16Slot + 1U;
+	if(u16Next >= sDAQ.sRing[u16Index].u16Size)
+	{
+		u16Next = 0U;
+	}
+	else
+	{
+		//fall on
+	}
+
+	//make sure the payload (and timer) has landed in memory before the consumer sees the new head
+	M_DAQ__MEMORY_BARRIER();
+
+	//publish
+	sDAQ.sRing[u16Index].u16Head = u16Next;
+}
+
+/***************************************************************************//**
+ * @brief
+ * Get the number of elements waiting in the ring.
+ *
+ * @param[in]		u16Index				The stream index
+ * @return			The fill level in elements
+ * @st_funcMD5		F5832452740235985DD9D74B4C504C41
+ * @st_funcID		LCCM662R0.FILE.005.FUNC.004
+ */
+Luint16 u16SIL3_DAQ_RING__Get_Level(Luint16 u16Index)
+{
+	Luint16 u16Head;
+	Luint16 u16Tail;
+	Luint16 u16Return;
+
+	//snapshot both sides once
+	u16Head = sDAQ.sRing[u16Index].u16Head;
+	u16Tail = sDAQ.sRing[u16Index].u16Tail;
+
+	if(u16Head >= u16Tail)
+	{
+		u16Return = u16Head - u16Tail;
+	}
+	else
+	{
+		//we have wrapped
+		u16Return = (sDAQ.sRing[u16Index].u16Size - u16Tail) + u16Head;
+	}
+
+	return u16Return;
+}
+
+/***************************************************************************//**
+ * @brief
+ * Get the contiguous run of elements starting at the tail, CONSUMER side only.
+ *
+ * @note
+ * If the data has wrapped, only the part up to the end of the buffer is
+ * returned, the number of elements waiting at the start of the buffer is
+ * returned in pu16Wrapped. Both come from the same head snapshot.
+ *
+ * @param[out]		*pu16Wrapped			Elements waiting at the start of the buffer
+ * @param[out]		*pu16Start				The element index the run starts at
+ * @param[in]		u16Index				The stream index
+ * @return			The number of contiguous elements
+ * @st_funcMD5		97D43011699715229989D853CB8F6428
+ * @st_funcID		LCCM662R0.FILE.005.FUNC.005
+ */
+Luint16 u16SIL3_DAQ_RING__Get_Contiguous(Luint16 u16Index, Luint16 *pu16Start, Luint16 *pu16Wrapped)
+{
+	Luint16 u16Head;
+	Luint16 u16Tail;
+	Luint16 u16Return;
+
+	//snapshot the head, the producer may move it at any time
+	u16Head = sDAQ.sRing[u16Index].u16Head;
+	u16Tail = sDAQ.sRing[u16Index].u16Tail;
+
+	//make sure we read the payload after reading the head.
+	M_DAQ__MEMORY_BARRIER();
+
+	*pu16Start = u16Tail;
+
+	if(u16Head >= u16Tail)
+	{
+		u16Return = u16Head - u16Tail;
+		*pu16Wrapped = 0U;
+	}
+	else
+	{
+		//only up to the end of the buffer
+		u16Return = sDAQ.sRing[u16Index].u16Size - u16Tail;
+
+		//the rest is sitting at the start
+		*pu16Wrapped = u16Head;
+	}
+
+	return u16Return;
+}
+
+/***************************************************************************//**
+ * @brief
+ * Release elements back to the producer, CONSUMER side only.
+ *
+ * @param[in]		u16Num					Number of elements consumed
+ * @param[in]		u16Index				The stream index
+ * @st_funcMD5		E1651EDD5BC7CAB0266CC6FBDB14A08D
+ * @st_funcID		LCCM662R0.FILE.005.FUNC.006
+ */
+void vSIL3_DAQ_RING__Release(Luint16 u16Index, Luint16 u16Num)
+{
+	Luint16 u16Tail;
+
+	u16Tail = sDAQ.sRing[u16Index].u16Tail + u16Num;
+	if(u16Tail >= sDAQ.sRing[u16Index].u16Size)
+	{
+		u16Tail -= sDAQ.sRing[u16Index].u16Size;
+	}
+	else
+	{
+		//fall on
+	}
+
+	//we must be done reading the payload before the producer can reuse the slots
+	M_DAQ__MEMORY_BARRIER();
+
+	sDAQ.sRing[u16Index].u16Tail = u16Tail;
+}
+
+
+#endif //#if C_LOCALDEF__LCCM662__ENABLE_THIS_MODULE == 1U
+//safetys
+#ifndef C_LOCALDEF__LCCM662__ENABLE_THIS_MODULE
+	#error
+#endif
+/** @} */
+/** @} */
+/** @} */
+
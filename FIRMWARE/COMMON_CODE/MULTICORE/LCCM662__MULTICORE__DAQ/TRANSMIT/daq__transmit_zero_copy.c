@@ -0,0 +1,279 @@
+/**
+ * @file		DAQ__TRANSMIT_ZERO_COPY.C
+ * @brief		Zero copy DAQ transmit helpers
+ * @author		Lachlan Grogan
+ * @copyright	This file contains proprietary and confidential information of
+ *				SIL3 Pty. Ltd. (ACN 123 529 064). This code may be distributed
+ *				under a license from SIL3 Pty. Ltd., and may be used, copied
+ *				and/or disclosed only pursuant to the terms of that license agreement.
+ *				This copyright notice must be retained as part of this file at all times.
+ * @copyright	This file is copyright SIL3 Pty. Ltd. 2003-2016, All Rights Reserved.
+ * @st_fileID	LCCM662R0.FILE.006
+ */
+
+#include "../daq.h"
+/**
+ * @addtogroup MULTICORE
+ * @{
+*/
+/**
+ * @addtogroup DAQ
+ * @ingroup MULTICORE
+ * @{
+*/
+/**
+ * @addtogroup DAQ__TRANSMIT_ZERO_COPY
+ * @ingroup DAQ
+ * @{
+*/
+#if C_LOCALDEF__LCCM662__ENABLE_THIS_MODULE == 1U
+#if C_LOCALDEF__LCCM662__ENABLE_ZERO_COPY_TX == 1U
+
+#include <MULTICORE/LCCM528__MULTICORE__SAFE_UDP/safe_udp__packet_types.h>
+
+extern struct _strDAQ sDAQ;
+
+//locals
+#ifndef WIN32
+static void vSIL3_DAQ_TRANSMIT_ZC__DMA_Start(RM4_DMA__CHANNEL_E eChannel, Luint8 *pu8Source, Luint8 *pu8Dest, Luint16 u16Length);
+#endif
+
+/***************************************************************************//**
+ * @brief
+ * Transmit a contiguous region of the DAQ ring without copying it.
+ *
+ * @note
+ * Only the SafeUDP header is built in the EMAC buffer, the ring memory is
+ * chained on as an extra buffer descriptor. The caller must not release the
+ * ring slots until u8SIL3_DAQ_TRANSMIT_ZC__Is_Complete() returns 1.
+ *
+ * @param[in]		u16Length				Length in bytes
+ * @param[in]		*pu8Buffer				Start of the region in the ring
+ * @param[in]		u16Port					UDP source and dest port
+ * @param[in]		u16PacketType			SafeUDP packet type
+ * @return			0 = success\n
+ * 					-1 = EMAC was busy, try again later
+ * @st_funcMD5		4DA731234819733763AECD6E8115534A
+ * @st_funcID		LCCM662R0.FILE.006.FUNC.001
+ */
+Lint16 s16SIL3_DAQ_TRANSMIT_ZC__Tx(Luint16 u16PacketType, Luint16 u16Port, Luint8 *pu8Buffer, Luint16 u16Length)
+{
+	Lint16 s16Return;
+	Lint16 s16R;
+	Luint8 u8BufferIndex;
+	//pointer to the EMAC data, not used as we have no local payload
+	Luint8 *pu8EMAC;
+
+	//precommit with no local payload, we only need the header.
+	s16Return = s16SIL3_SAFEUDP_TX__PreCommit(0U, (SAFE_UDP__PACKET_T)u16PacketType, &pu8EMAC, &u8BufferIndex);
+	if(s16Return == 0)
+	{
+		//hand the ring memory to the EMAC as the payload
+		vSIL3_SAFEUDP_TX__Commit_WithPayload(u8BufferIndex, 0U, u16Port, u16Port, (Luint32)u16Length, (Luint32)pu8Buffer);
+		s16R = 0;
+	}
+	else
+	{
+		//maybe the ETH was busy with an ARP or something, come back around and re-try
+		s16R = -1;
+	}
+
+	return s16R;
+}
+
+/***************************************************************************//**
+ * @brief
+ * Transmit a wrapped region of the DAQ ring as one packet.
+ *
+ * @note
+ * The two halves are gathered into the EMAC buffer by two DMA channels and
+ * the packet is committed from u8SIL3_DAQ_TRANSMIT_ZC__Is_Complete() once
+ * both have finished, so the CPU does not do the copy.
+ *
+ * @param[in]		u16SecondLength			Length in bytes of the part at the start of the ring
+ * @param[in]		*pu8Second				The start of the ring
+ * @param[in]		u16FirstLength			Length in bytes up to the end of the ring
+ * @param[in]		*pu8First				The tail of the ring
+ * @param[in]		u16Port					UDP source and dest port
+ * @param[in]		u16PacketType			SafeUDP packet type
+ * @return			0 = success\n
+ * 					-1 = EMAC was busy, try again later
+ * @st_funcMD5		B4963E2E69D17845DE515B26FA0B2ED3
+ * @st_funcID		LCCM662R0.FILE.006.FUNC.002
+ */
+Lint16 s16SIL3_DAQ_TRANSMIT_ZC__Tx_Wrapped(Luint16 u16PacketType, Luint16 u16Port, Luint8 *pu8First, Luint16 u16FirstLength, Luint8 *pu8Second, Luint16 u16SecondLength)
+{
+	Lint16 s16Return;
+	Lint16 s16R;
+	Luint8 u8BufferIndex;
+	Luint16 u16Length;
+	//pointer to the EMAC data allowing us to fill up here.
+	Luint8 *pu8EMAC;
+	#ifdef WIN32
+	Luint16 u16Counter;
+	#endif
+
+	u16Length = u16FirstLength + u16SecondLength;
+
+	//precommit the full length so both halves land in the one EMAC buffer
+	s16Return = s16SIL3_SAFEUDP_TX__PreCommit(u16Length, (SAFE_UDP__PACKET_T)u16PacketType, &pu8EMAC, &u8BufferIndex);
+	if(s16Return == 0)
+	{
+		#ifndef WIN32
+			//kick off both halves at once
+			vSIL3_DAQ_TRANSMIT_ZC__DMA_Start(C_LOCALDEF__LCCM662__ZERO_COPY_DMA_CHANNEL_A, pu8First, pu8EMAC, u16FirstLength);
+			vSIL3_DAQ_TRANSMIT_ZC__DMA_Start(C_LOCALDEF__LCCM662__ZERO_COPY_DMA_CHANNEL_B, pu8Second, pu8EMAC + u16FirstLength, u16SecondLength);
+		#else
+			//no DMA on the PC, just copy
+			for(u16Counter = 0U; u16Counter < u16FirstLength; u16Counter++)
+			{
+				pu8EMAC[u16Counter] = pu8First[u16Counter];
+			}
+			for(u16Counter = 0U; u16Counter < u16SecondLength; u16Counter++)
+			{
+				pu8EMAC[u16FirstLength + u16Counter] = pu8Second[u16Counter];
+			}
+		#endif
+
+		//commit once the gather is done
+		sDAQ.sZeroCopy.u8DMA_BufferIndex = u8BufferIndex;
+		sDAQ.sZeroCopy.u16DMA_Length = u16Length;
+		sDAQ.sZeroCopy.u16DMA_Port = u16Port;
+		sDAQ.sZeroCopy.u8DMA_CommitPending = 1U;
+
+		s16R = 0;
+	}
+	else
+	{
+		//maybe the ETH was busy with an ARP or something, come back around and re-try
+		s16R = -1;
+	}
+
+	return s16R;
+}
+
+/***************************************************************************//**
+ * @brief
+ * Check if the transmitter has finished with the ring memory.
+ *
+ * @note
+ * Also commits any DMA gathered packet once its DMA has finished. Call from
+ * the DAQ process loop until it returns 1.
+ *
+ * @return			1 = ring memory can be released\n
+ * 					0 = still in use
+ * @st_funcMD5		E8EDF8EFCC1668936B0E86E22C461C4E
+ * @st_funcID		LCCM662R0.FILE.006.FUNC.003
+ */
+Luint8 u8SIL3_DAQ_TRANSMIT_ZC__Is_Complete(void)
+{
+	Luint8 u8Return;
+	Luint8 u8DMA_Done;
+
+	if(sDAQ.sZeroCopy.u8DMA_CommitPending == 1U)
+	{
+		#ifndef WIN32
+			//both halves have to have landed
+			if((u8RM4_DMA__IsChannelBusy(C_LOCALDEF__LCCM662__ZERO_COPY_DMA_CHANNEL_A) == 0U) &&
+				(u8RM4_DMA__IsChannelBusy(C_LOCALDEF__LCCM662__ZERO_COPY_DMA_CHANNEL_B) == 0U))
+			{
+				u8DMA_Done = 1U;
+			}
+			else
+			{
+				u8DMA_Done = 0U;
+			}
+		#else
+			//copied in place on the PC
+			u8DMA_Done = 1U;
+		#endif
+
+		if(u8DMA_Done == 1U)
+		{
+			//the payload is now in the EMAC buffer, send it.
+			vSIL3_SAFEUDP_TX__Commit(sDAQ.sZeroCopy.u8DMA_BufferIndex, sDAQ.sZeroCopy.u16DMA_Length,
+									sDAQ.sZeroCopy.u16DMA_Port, sDAQ.sZeroCopy.u16DMA_Port);
+			sDAQ.sZeroCopy.u8DMA_CommitPending = 0U;
+
+			//the ring is no longer needed as the data was copied
+			u8Return = 1U;
+		}
+		else
+		{
+			//DMA still running
+			u8Return = 0U;
+		}
+	}
+	else
+	{
+		#ifndef WIN32
+			//the EMAC is reading straight out of the ring, wait for the Tx to finish
+			if(u8RM4_EMAC_TX__Get_IsBusy() == 0U)
+			{
+				u8Return = 1U;
+			}
+			else
+			{
+				u8Return = 0U;
+			}
+		#else
+			u8Return = 1U;
+		#endif
+	}
+
+	return u8Return;
+}
+
+#ifndef WIN32
+/***************************************************************************//**
+ * @brief
+ * Start a software triggered memory to memory DMA block copy.
+ *
+ * @param[in]		u16Length				Length in bytes
+ * @param[in]		*pu8Dest				Destination
+ * @param[in]		*pu8Source				Source
+ * @param[in]		eChannel				DMA channel to use
+ * @st_funcMD5		59CA02C9C11AF808C1452AB4201AA104
+ * @st_funcID		LCCM662R0.FILE.006.FUNC.004
+ */
+static void vSIL3_DAQ_TRANSMIT_ZC__DMA_Start(RM4_DMA__CHANNEL_E eChannel, Luint8 *pu8Source, Luint8 *pu8Dest, Luint16 u16Length)
+{
+	RM4_DMA__CONTROL_T sControl;
+
+	//build the control packet
+	u32RM4_DMA__Config_ControlPacket(&sControl, (Luint32)pu8Source, (Luint32)pu8Dest, (Luint32)u16Length);
+	vRM4_DMA__Set_ControlPacket(eChannel, sControl);
+
+	//the block complete interrupt clears our busy flag
+	vRM4_DMA__EnableInterrupt(eChannel, INTERRUPT__BLOCK_TX_COMPLETE);
+	vRM4_DMA__Set_ChannelBusy(eChannel);
+
+	//go
+	vRM4_DMA__Set_ChannelEnable(eChannel, DMA_SW);
+}
+#endif //WIN32
+
+//safetys
+#ifndef WIN32
+	#ifndef C_LOCALDEF__LCCM229__ENABLE_THIS_MODULE
+		//zero copy needs the DMA module
+		#error
+	#endif
+#endif
+#ifndef C_LOCALDEF__LCCM662__ZERO_COPY_DMA_CHANNEL_A
+	#error
+#endif
+#ifndef C_LOCALDEF__LCCM662__ZERO_COPY_DMA_CHANNEL_B
+	#error
+#endif
+
+#endif //C_LOCALDEF__LCCM662__ENABLE_ZERO_COPY_TX
+#endif //#if C_LOCALDEF__LCCM662__ENABLE_THIS_MODULE == 1U
+//safetys
+#ifndef C_LOCALDEF__LCCM662__ENABLE_THIS_MODULE
+	#error
+#endif
+/** @} */
+/** @} */
+/** @} */
+
@@ -57,6 +57,118 @@ Lint16 s16SIL3_DAQ_WIN32__TxHandler(Luint16 u16PacketIndex, Luint8 *pu8Buffer, L
 	return 0;
 }
 
+/***************************************************************************//**
+ * @brief
+ * Decode a delta / varint encoded DAQ packet, see daq__compress.c
+ *
+ * @note
+ * Values come back as 32 bit patterns, S16 is sign extended and F32 is the raw
+ * bits, the caller casts based on the channel type in byte 1 of the packet.
+ * If the packet has no timer, the timer array is filled with 0.
+ *
+ * @param[in]		u16MaxSamples		Size of the timer and value arrays
+ * @param[out]		*pu32Value			Decoded values
+ * @param[out]		*pu32Timer			Decoded timers
+ * @param[in]		u16Length			Packet payload length
+ * @param[in]		*pu8Buffer			Packet payload
+ * @return			Number of samples decoded\n
+ * 					-1 = packet is malformed or too many samples
+ * @st_funcMD5		7D52EA7D0712460170C932672E017B67
+ * @st_funcID		LCCM662R0.FILE.003.FUNC.002
+ */
+Lint16 s16SIL3_DAQ_WIN32__Decode(const Luint8 *pu8Buffer, Luint16 u16Length, Luint32 *pu32Timer, Luint32 *pu32Value, Luint16 u16MaxSamples)
+{
+	Lint16 s16Return;
+	Luint16 u16Count;
+	Luint16 u16Counter;
+	Luint16 u16Pos;
+	Luint8 u8Field;
+	Luint8 u8NumFields;
+	Luint8 u8Shift;
+	Luint32 u32Raw;
+	Luint32 u32Timer;
+	Luint32 u32Value;
+
+	if(u16Length >= C_DAQ__COMPRESS_HEADER_BYTES)
+	{
+		//timer present?
+		if((pu8Buffer[0] & 0x01U) == 0x01U)
+		{
+			u8NumFields = 2U;
+		}
+		else
+		{
+			u8NumFields = 1U;
+		}
+		u16Count = u16SIL3_NUM_CONVERT__Array(&pu8Buffer[2]);
+
+		if(u16Count <= u16MaxSamples)
+		{
+			u16Pos = C_DAQ__COMPRESS_HEADER_BYTES;
+			u32Timer = 0U;
+			u32Value = 0U;
+			s16Return = (Lint16)u16Count;
+
+			for(u16Counter = 0U; (u16Counter < u16Count) && (s16Return >= 0); u16Counter++)
+			{
+				for(u8Field = 0U; (u8Field < u8NumFields) && (s16Return >= 0); u8Field++)
+				{
+					//read the varint
+					u32Raw = 0U;
+					u8Shift = 0U;
+					do
+					{
+						if((u16Pos >= u16Length) || (u8Shift > 28U))
+						{
+							//ran off the end or too long
+							s16Return = -1;
+						}
+						else
+						{
+							u32Raw |= (Luint32)(pu8Buffer[u16Pos] & 0x7FU) << u8Shift;
+							u8Shift += 7U;
+							u16Pos++;
+						}
+					}while((s16Return >= 0) && ((pu8Buffer[u16Pos - 1U] & 0x80U) == 0x80U));
+
+					if((u8Field + 1U) < u8NumFields)
+					{
+						//timer delta
+						u32Timer += u32Raw;
+					}
+					else
+					{
+						//undo the zig-zag then the delta
+						if((u32Raw & 0x00000001U) == 0x00000001U)
+						{
+							u32Value += ~(u32Raw >> 1U);
+						}
+						else
+						{
+							u32Value += u32Raw >> 1U;
+						}
+					}
+				}
+
+				pu32Timer[u16Counter] = u32Timer;
+				pu32Value[u16Counter] = u32Value;
+			}
+		}
+		else
+		{
+			//caller has not given us enough room
+			s16Return = -1;
+		}
+	}
+	else
+	{
+		//too short for the header
+		s16Return = -1;
+	}
+
+	return s16Return;
+}
+
 
 #endif //win32
 #endif //#if C_LOCALDEF__LCCM662__ENABLE_THIS_MODULE == 1U
@@ -105,6 +105,14 @@ void vSIL3_DAQ_WIN32_MAIN__RxUDPSafe(Luint8 *pu8Payload, Luint16 u16PayloadLengt
 
 			break;
 
+		#if C_LOCALDEF__LCCM662__ENABLE_PACKED_FRAMES == 1U
+		case SAFE_UDP__LCCM662__DAQ_PACKED_SCHEMA:
+
+			//host has asked for the channel layout again
+			vSIL3_DAQ_PACKED__Request_Schema();
+			break;
+		#endif
+
 	}
 
 }
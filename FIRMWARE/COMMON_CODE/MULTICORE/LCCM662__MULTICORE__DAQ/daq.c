@@ -35,7 +35,7 @@ struct _strDAQ sDAQ;
  * Init the DAQ module
  * To be called early in the program.
  * 
- * @st_funcMD5		B410D8BC951DF82A75D71AD117A809EA
+ * @st_funcMD5		8568252ED47299DD29DFA3B0F63CD747
  * @st_funcID		LCCM662R0.FILE.000.FUNC.001
  */
 void vSIL3_DAQ__Init(void)
@@ -46,19 +46,14 @@ void vSIL3_DAQ__Init(void)
 	
 	//init vars
 	sDAQ.u8StreamingOn = 0U;
-	sDAQ.sInterlock.u8U8 = 0U;
-	sDAQ.sInterlock.u8S16 = 0U;
-	sDAQ.sInterlock.u8U16 = 0U;
-	sDAQ.sInterlock.u8S32 = 0U;
-	sDAQ.sInterlock.u8U32 = 0U;
-	sDAQ.sInterlock.u8F32 = 0U;
+	vSIL3_FAULTTREE__Init(&sDAQ.sFaultFlags);
 
 	u16Counter2 = 0U;
 	#if C_LOCALDEF__LCCM662__NUM_DAQ_CHANNELS__U8 > 0
 	for(u16Counter = 0U; u16Counter < C_LOCALDEF__LCCM662__NUM_DAQ_CHANNELS__U8; u16Counter++)
 	{
 		sDAQ.u16WatermarkLevel[u16Counter2] = C_LOCALDEF__LCCM662__BUFFER_WATERMARK_LEVEL * 4U;
-		vSIL3_SOFTFIFO__Init(&sDAQ.sFIFO[u16Counter2], C_LOCALDEF__LCCM662__MAX_DAQ_BUFFER_BLOCKS * 4U);
+		vSIL3_DAQ_RING__Init(u16Counter2, C_LOCALDEF__LCCM662__MAX_DAQ_BUFFER_BLOCKS * 4U);
 		sDAQ.u8SizeMultiplier[u16Counter2] = 1U;
 		//inc the global counter
 		u16Counter2++;
@@ -68,7 +63,7 @@ void vSIL3_DAQ__Init(void)
 	for(u16Counter = 0U; u16Counter < C_LOCALDEF__LCCM662__NUM_DAQ_CHANNELS__S16; u16Counter++)
 	{
 		sDAQ.u16WatermarkLevel[u16Counter2] = C_LOCALDEF__LCCM662__BUFFER_WATERMARK_LEVEL * 2U;
-		vSIL3_SOFTFIFO__Init(&sDAQ.sFIFO[u16Counter2], C_LOCALDEF__LCCM662__MAX_DAQ_BUFFER_BLOCKS * 2U);
+		vSIL3_DAQ_RING__Init(u16Counter2, C_LOCALDEF__LCCM662__MAX_DAQ_BUFFER_BLOCKS * 2U);
 		sDAQ.u8SizeMultiplier[u16Counter2] = 2U;
 		//inc the global counter
 		u16Counter2++;
@@ -78,7 +73,7 @@ void vSIL3_DAQ__Init(void)
 	for(u16Counter = 0U; u16Counter < C_LOCALDEF__LCCM662__NUM_DAQ_CHANNELS__U16; u16Counter++)
 	{
 		sDAQ.u16WatermarkLevel[u16Counter2] = C_LOCALDEF__LCCM662__BUFFER_WATERMARK_LEVEL * 2U;
-		vSIL3_SOFTFIFO__Init(&sDAQ.sFIFO[u16Counter2], C_LOCALDEF__LCCM662__MAX_DAQ_BUFFER_BLOCKS * 2U);
+		vSIL3_DAQ_RING__Init(u16Counter2, C_LOCALDEF__LCCM662__MAX_DAQ_BUFFER_BLOCKS * 2U);
 		sDAQ.u8SizeMultiplier[u16Counter2] = 2U;
 		//inc the global counter
 		u16Counter2++;
@@ -88,7 +83,7 @@ void vSIL3_DAQ__Init(void)
 	for(u16Counter = 0U; u16Counter < C_LOCALDEF__LCCM662__NUM_DAQ_CHANNELS__S32; u16Counter++)
 	{
 		sDAQ.u16WatermarkLevel[u16Counter2] = C_LOCALDEF__LCCM662__BUFFER_WATERMARK_LEVEL;
-		vSIL3_SOFTFIFO__Init(&sDAQ.sFIFO[u16Counter2], C_LOCALDEF__LCCM662__MAX_DAQ_BUFFER_BLOCKS);
+		vSIL3_DAQ_RING__Init(u16Counter2, C_LOCALDEF__LCCM662__MAX_DAQ_BUFFER_BLOCKS);
 		sDAQ.u8SizeMultiplier[u16Counter2] = 4U;
 		//inc the global counter
 		u16Counter2++;
@@ -98,7 +93,7 @@ void vSIL3_DAQ__Init(void)
 	for(u16Counter = 0U; u16Counter < C_LOCALDEF__LCCM662__NUM_DAQ_CHANNELS__U32; u16Counter++)
 	{
 		sDAQ.u16WatermarkLevel[u16Counter2] = C_LOCALDEF__LCCM662__BUFFER_WATERMARK_LEVEL;
-		vSIL3_SOFTFIFO__Init(&sDAQ.sFIFO[u16Counter2], C_LOCALDEF__LCCM662__MAX_DAQ_BUFFER_BLOCKS);
+		vSIL3_DAQ_RING__Init(u16Counter2, C_LOCALDEF__LCCM662__MAX_DAQ_BUFFER_BLOCKS);
 		sDAQ.u8SizeMultiplier[u16Counter2] = 4U;
 		//inc the global counter
 		u16Counter2++;
@@ -108,7 +103,7 @@ void vSIL3_DAQ__Init(void)
 	for(u16Counter = 0U; u16Counter < C_LOCALDEF__LCCM662__NUM_DAQ_CHANNELS__F32; u16Counter++)
 	{
 		sDAQ.u16WatermarkLevel[u16Counter2] = C_LOCALDEF__LCCM662__BUFFER_WATERMARK_LEVEL;
-		vSIL3_SOFTFIFO__Init(&sDAQ.sFIFO[u16Counter2], C_LOCALDEF__LCCM662__MAX_DAQ_BUFFER_BLOCKS);
+		vSIL3_DAQ_RING__Init(u16Counter2, C_LOCALDEF__LCCM662__MAX_DAQ_BUFFER_BLOCKS);
 		sDAQ.u8SizeMultiplier[u16Counter2] = 4U;
 		//inc the global counter
 		u16Counter2++;
@@ -128,7 +123,7 @@ void vSIL3_DAQ__Init(void)
 
 		//clear the timer
 		#if C_LOCALDEF__LCCM662__ENABLE_TIMER_IN_DATA == 1U
-		for(u16Counter2 = 0U; u16Counter2 < C_LOCALDEF__LCCM662__MAX_DAQ_BUFFER_BLOCKS; u16Counter2++)
+		for(u16Counter2 = 0U; u16Counter2 < M_DAQ__TIMER_SLOTS; u16Counter2++)
 		{
 			sDAQ.sBuffers.u32Timer[u16Counter][u16Counter2] = 0U;
 		}
@@ -138,6 +133,18 @@ void vSIL3_DAQ__Init(void)
 	//init the append module
 	vSIL3_DAQ_APPEND__Init();
 
+	#if C_LOCALDEF__LCCM662__ENABLE_ZERO_COPY_TX == 1U
+		sDAQ.sZeroCopy.u16PendingCount = 0U;
+		sDAQ.sZeroCopy.u8DMA_CommitPending = 0U;
+		sDAQ.sZeroCopy.u8DMA_BufferIndex = 0U;
+		sDAQ.sZeroCopy.u16DMA_Length = 0U;
+		sDAQ.sZeroCopy.u16DMA_Port = 0U;
+	#endif
+
+	#if C_LOCALDEF__LCCM662__ENABLE_PACKED_FRAMES == 1U
+		vSIL3_DAQ_PACKED__Init();
+	#endif
+
 	//init the sates
 	sDAQ.eMainState = DAQ_STATE__IDLE;
 
@@ -153,7 +160,7 @@ void vSIL3_DAQ__Init(void)
  * Sould make sure the transport mechanism (such as eth) is up before
  * processing any data.
  * 
- * @st_funcMD5		90C4D1787121A78BCD8EBB02437A09E5
+ * @st_funcMD5		65859AA3CCAC29BB0DA47E890417479B
  * @st_funcID		LCCM662R0.FILE.000.FUNC.002
  */
 void vSIL3_DAQ__Process(void)
@@ -163,7 +170,13 @@ void vSIL3_DAQ__Process(void)
 	Luint8 * pu8Temp;
 	Lint16 s16Test;
 	Luint16 u16Burst;
+	Luint16 u16Start;
+	Luint16 u16Wrapped;
 	Luint8 u8Flag;
+	#if C_LOCALDEF__LCCM662__ENABLE_COMPRESSION == 1U
+	Luint16 u16Length;
+	Luint16 u16Samples;
+	#endif
 
 	u8Flag = 0U;
 	
@@ -184,7 +197,7 @@ void vSIL3_DAQ__Process(void)
 			for(u16Counter = 0U; u16Counter < M_DAQ__NUM_CHANNELS; u16Counter++)
 			{
 				//mark any entries as appropriate.
-				if(sDAQ.sFIFO[u16Counter].uFIFO_FillLevel >= sDAQ.u16WatermarkLevel[u16Counter])
+				if(u16SIL3_DAQ_RING__Get_Level(u16Counter) >= sDAQ.u16WatermarkLevel[u16Counter])
 				{
 					sDAQ.u8WatermarkFlag[u16Counter] = 1U;
 				}
@@ -204,7 +217,12 @@ void vSIL3_DAQ__Process(void)
 			break;
 	
 		case DAQ_STATE__PROCESS_FILL:
-	
+
+#if C_LOCALDEF__LCCM662__ENABLE_PACKED_FRAMES == 1U
+			//interleave as many channels as will fit into each frame,
+			//moves us back to check fill once all channels are serviced
+			vSIL3_DAQ_PACKED__Process();
+#else
 			//see if we are watermarked or need to flush
 			if((sDAQ.u8WatermarkFlag[sDAQ.u16ProcessPoint] == 1U) || (sDAQ.u8ForceFlushFlag[sDAQ.u16ProcessPoint] == 1U))
 			{
@@ -213,42 +231,98 @@ void vSIL3_DAQ__Process(void)
 				s16Return = s16SIL3_DAQ_APPEND__Index_to_BufferPointer(sDAQ.u16ProcessPoint, &pu8Temp);
 				if(s16Return == 0)
 				{
-					//copy our length
-					u16Burst = (Luint16)sDAQ.sFIFO[sDAQ.u16ProcessPoint].uFIFO_FillLevel;
+					//get what is contiguous from the tail, and anything that has wrapped to the start
+					u16Burst = u16SIL3_DAQ_RING__Get_Contiguous(sDAQ.u16ProcessPoint, &u16Start, &u16Wrapped);
 
 					if(u16Burst == 0U)
 					{
-						//if we have nothing to burst, but have wanted a flush then clear the flag.
-						//The Tx function will return -ve if the burst is 0 anyhow.
+						//if we have nothing to burst, but have wanted a flush then clear the flag,
+						//there is nothing to hand the transmitter.
 						sDAQ.u8ForceFlushFlag[sDAQ.u16ProcessPoint] = 0U;
 					}
 					else
 					{
-						//fall on.
-					}
-
-					//transmit notification
-					//we may fail here due to Eth interface currently processing something else, so come back and re-check
-					s16Test = M_LOCALDEF__LCCM662__TX_HANDLER(sDAQ.u16ProcessPoint, pu8Temp, u16Burst * (Luint16)sDAQ.u8SizeMultiplier[sDAQ.u16ProcessPoint]);
-					if(s16Test >= 0)
-					{
-
-						//empty the fifo now
-						//risk here is we get another entry while drainging, so use flush.
-						s16SIL3_SOFTFIFO__PopMany(&sDAQ.sFIFO[sDAQ.u16ProcessPoint], u16Burst);
-
-						//clear.
-						sDAQ.u8WatermarkFlag[sDAQ.u16ProcessPoint] = 0U;
-						sDAQ.u8ForceFlushFlag[sDAQ.u16ProcessPoint] = 0U;
-
-					}
-					else
-					{
-						//transmitter was busy
-						//this is not an error, come back and try again in a bit, do not clear
-						//the current process point,
+#if C_LOCALDEF__LCCM662__ENABLE_ZERO_COPY_TX == 1U
+						if(u16Wrapped > 0U)
+						{
+							//the run wraps, the transmitter has to gather both halves into one packet
+							s16Test = M_LOCALDEF__LCCM662__TX_HANDLER_WRAPPED(sDAQ.u16ProcessPoint,
+																			pu8Temp + ((Luint32)u16Start * (Luint32)sDAQ.u8SizeMultiplier[sDAQ.u16ProcessPoint]),
+																			u16Burst * (Luint16)sDAQ.u8SizeMultiplier[sDAQ.u16ProcessPoint],
+																			pu8Temp,
+																			u16Wrapped * (Luint16)sDAQ.u8SizeMultiplier[sDAQ.u16ProcessPoint]);
+							u16Burst += u16Wrapped;
+						}
+						else
+						{
+							//hand the ring memory straight to the transmitter
+							s16Test = M_LOCALDEF__LCCM662__TX_HANDLER(sDAQ.u16ProcessPoint,
+																	pu8Temp + ((Luint32)u16Start * (Luint32)sDAQ.u8SizeMultiplier[sDAQ.u16ProcessPoint]),
+																	u16Burst * (Luint16)sDAQ.u8SizeMultiplier[sDAQ.u16ProcessPoint]);
+						}
+						if(s16Test >= 0)
+						{
+							//the transmitter now owns the slots, do not release them until it is done
+							sDAQ.sZeroCopy.u16PendingCount = u16Burst;
+							sDAQ.eMainState = DAQ_STATE__WAIT_TX_COMPLETE;
+						}
+						else
+						{
+							//transmitter was busy, come back and try again.
+						}
+
+						//either way we are not moving the process point yet.
 						u8Flag = 1U;
-					}
+#else
+		#if C_LOCALDEF__LCCM662__ENABLE_COMPRESSION == 1U
+						//encode both sides of the wrap in one go, as much as will fit in a packet
+						u16Length = u16SIL3_DAQ_COMPRESS__Encode(sDAQ.u16ProcessPoint, pu8Temp, u16Start, u16Burst, u16Wrapped, &u16Samples);
+
+						//transmit notification
+						//we may fail here due to Eth interface currently processing something else, so come back and re-check
+						s16Test = M_LOCALDEF__LCCM662__TX_HANDLER(sDAQ.u16ProcessPoint, &sDAQ.sCompress.u8Buffer[0], u16Length);
+
+						//release what was encoded, anything left over is handled like the wrapped part
+						u16Wrapped = (u16Burst + u16Wrapped) - u16Samples;
+						u16Burst = u16Samples;
+		#else
+						//move up to the start of the run
+						pu8Temp += (Luint32)u16Start * (Luint32)sDAQ.u8SizeMultiplier[sDAQ.u16ProcessPoint];
+
+						//transmit notification
+						//we may fail here due to Eth interface currently processing something else, so come back and re-check
+						s16Test = M_LOCALDEF__LCCM662__TX_HANDLER(sDAQ.u16ProcessPoint, pu8Temp, u16Burst * (Luint16)sDAQ.u8SizeMultiplier[sDAQ.u16ProcessPoint]);
+		#endif //C_LOCALDEF__LCCM662__ENABLE_COMPRESSION
+						if(s16Test >= 0)
+						{
+
+							//hand the slots back to the producer.
+							//anything appended while we were sending stays in the ring for next time.
+							vSIL3_DAQ_RING__Release(sDAQ.u16ProcessPoint, u16Burst);
+
+							//clear.
+							sDAQ.u8WatermarkFlag[sDAQ.u16ProcessPoint] = 0U;
+
+							//if we only sent part of a flush, stay here for the rest
+							if((sDAQ.u8ForceFlushFlag[sDAQ.u16ProcessPoint] == 1U) && (u16Wrapped > 0U))
+							{
+								u8Flag = 1U;
+							}
+							else
+							{
+								sDAQ.u8ForceFlushFlag[sDAQ.u16ProcessPoint] = 0U;
+							}
+
+						}
+						else
+						{
+							//transmitter was busy
+							//this is not an error, come back and try again in a bit, do not clear
+							//the current process point,
+							u8Flag = 1U;
+						}
+#endif //C_LOCALDEF__LCCM662__ENABLE_ZERO_COPY_TX
+					}//else if(u16Burst == 0U)
 				}
 				else
 				{
@@ -266,32 +340,76 @@ void vSIL3_DAQ__Process(void)
 			if(u8Flag == 0U)
 			{
 				//increment for next time around
-				sDAQ.u16ProcessPoint++;
-				if(sDAQ.u16ProcessPoint >= M_DAQ__NUM_CHANNELS)
-				{
-					//reset.
-					sDAQ.u16ProcessPoint = 0U;
-
-					sDAQ.eMainState = DAQ_STATE__CHECK_FILL;
-
-				}
-				else
-				{
-					//stay in state
-				}
+				vSIL3_DAQ__Next_ProcessPoint();
 			}
 			else
 			{
 				//stay in state due to the Ethernet not being ready.
 			}
+#endif //C_LOCALDEF__LCCM662__ENABLE_PACKED_FRAMES
 	
 			break;
+
+#if C_LOCALDEF__LCCM662__ENABLE_ZERO_COPY_TX == 1U
+		case DAQ_STATE__WAIT_TX_COMPLETE:
+
+			//the EMAC (or the DMA gather) is still reading from our ring memory
+			if(M_LOCALDEF__LCCM662__TX_IS_COMPLETE() == 1U)
+			{
+				//now safe to give the slots back to the producer
+				vSIL3_DAQ_RING__Release(sDAQ.u16ProcessPoint, sDAQ.sZeroCopy.u16PendingCount);
+				sDAQ.sZeroCopy.u16PendingCount = 0U;
+
+				//everything up to the snapshot went out in one go
+				sDAQ.u8WatermarkFlag[sDAQ.u16ProcessPoint] = 0U;
+				sDAQ.u8ForceFlushFlag[sDAQ.u16ProcessPoint] = 0U;
+
+				//back to processing the next channel
+				sDAQ.eMainState = DAQ_STATE__PROCESS_FILL;
+				vSIL3_DAQ__Next_ProcessPoint();
+			}
+			else
+			{
+				//stay here, the CPU is free to do other things
+			}
+			break;
+#endif //C_LOCALDEF__LCCM662__ENABLE_ZERO_COPY_TX
+
+		default:
+			//should never get here
+			break;
 	
 	}//switch(sDAQ.eMainState)
 
 }
 
 
+/***************************************************************************//**
+ * @brief
+ * Move the process point onto the next channel, going back to checking the
+ * fill levels once all channels have been serviced.
+ * 
+ * @st_funcMD5		8D83B36E40848046EC900E9307CD30FD
+ * @st_funcID		LCCM662R0.FILE.000.FUNC.012
+ */
+void vSIL3_DAQ__Next_ProcessPoint(void)
+{
+	//increment for next time around
+	sDAQ.u16ProcessPoint++;
+	if(sDAQ.u16ProcessPoint >= M_DAQ__NUM_CHANNELS)
+	{
+		//reset.
+		sDAQ.u16ProcessPoint = 0U;
+
+		sDAQ.eMainState = DAQ_STATE__CHECK_FILL;
+
+	}
+	else
+	{
+		//stay in state
+	}
+}
+
 //this will force the DAQ to transmit what is in its buffers.
 //Useful for getting the last packet of data or flushing after a run.
 /***************************************************************************//**
@@ -342,13 +460,18 @@ void vSIL3_DAQ__Config_UserPacketType(Luint16 u16Index, Luint16 u16Type)
  * @brief
  * Call this to enable the append systems to work
  * 
- * @st_funcMD5		B7044EB3CED0B26CC84FCC8DE9ADD186
+ * @st_funcMD5		A95C0BE6F17D70876DE115DA957940AF
  * @st_funcID		LCCM662R0.FILE.000.FUNC.005
  */
 void vSIL3_DAQ__Streaming_On(void)
 {
 	sDAQ.u8StreamingOn = 1U;
 
+	#if C_LOCALDEF__LCCM662__ENABLE_PACKED_FRAMES == 1U
+		//tell the ground station what is coming
+		vSIL3_DAQ_PACKED__Request_Schema();
+	#endif
+
 }
 
 /***************************************************************************//**
@@ -380,73 +503,139 @@ Luint32 u32SIL3_DAQ__Get_SystemTimer(void)
  * @brief
  * Get the current FIFO fill level for a particular index for debug
  * 
+ * @note
+ * If the ring has overflowed the level is pinned at u16SIL3_DAQ__Get_FIFO_Max()
+ * and the samples dropped since are in u32SIL3_DAQ__Get_FIFO_DropCount(), the
+ * fault flags also carry C_LCCM662__CORE__FAULT_INDEX__02.
+ * 
  * @param[in]		u16Index			The stream index
- * @st_funcMD5		3744B6AA814D06E45A93130C7CCF562D
+ * @st_funcMD5		80682717741E092F96187F5326E598BC
  * @st_funcID		LCCM662R0.FILE.000.FUNC.007
  */
 Luint16 u16SIL3_DAQ__Get_FIFO_Level(Luint16 u16Index)
 {
-	return sDAQ.sFIFO[u16Index].uFIFO_FillLevel;
+	return u16SIL3_DAQ_RING__Get_Level(u16Index);
 }
 
 /***************************************************************************//**
  * @brief
- * Ge the max FIFO capacity for a particular stream
+ * Get the number of samples dropped on a stream because its ring was full
  * 
- * @param[in]		u16Index			Stream index
- * @st_funcMD5		5D5CE51E235E92CF20C1BD99C07B937A
- * @st_funcID		LCCM662R0.FILE.000.FUNC.008
+ * @param[in]		u16Index			The stream index
+ * @st_funcMD5		22FA09A5FF7A30D1314FD3F09329EBE6
+ * @st_funcID		LCCM662R0.FILE.000.FUNC.010
  */
-Luint16 u16SIL3_DAQ__Get_FIFO_Max(Luint16 u16Index)
+Luint32 u32SIL3_DAQ__Get_FIFO_DropCount(Luint16 u16Index)
 {
-	Lint16 u16Return;
-	Luint16 u16Temp;
-	
-	
+	Luint32 u32Return;
+
+	if(u16Index < M_DAQ__NUM_CHANNELS)
+	{
+		u32Return = sDAQ.sRing[u16Index].u32DropCount;
+	}
+	else
+	{
+		//out of range
+		u32Return = 0U;
+	}
+
+	return u32Return;
+}
+
+/***************************************************************************//**
+ * @brief
+ * Get the data type of a channel, used when describing the channel to the host.
+ *
+ * @param[in]		u16Index				The stream index
+ * @return			E_DAQ__CHANNEL_TYPES as a U8
+ * @st_funcMD5		8B3FC82FA4D9E6120726E88B157D85BB
+ * @st_funcID		LCCM662R0.FILE.000.FUNC.013
+ */
+Luint8 u8SIL3_DAQ__Get_ChannelType(Luint16 u16Index)
+{
+	Luint8 u8Return;
+
 	if(u16Index < M_DAQ__S16_OFFSET)
 	{
-		u16Temp = u16Index - M_DAQ__U8_OFFSET;
-		u16Return = C_LOCALDEF__LCCM662__MAX_DAQ_BUFFER_BLOCKS * 4;
+		u8Return = (Luint8)DAQ_CHANNEL_TYPE__U8;
 	}
-	else if (u16Index < M_DAQ__U16_OFFSET)
+	else if(u16Index < M_DAQ__U16_OFFSET)
 	{
-	u16Temp = u16Index - M_DAQ__S16_OFFSET;
-		u16Return = C_LOCALDEF__LCCM662__MAX_DAQ_BUFFER_BLOCKS * 2;
+		u8Return = (Luint8)DAQ_CHANNEL_TYPE__S16;
 	}
-	else if (u16Index < M_DAQ__S32_OFFSET)
+	else if(u16Index < M_DAQ__S32_OFFSET)
 	{
-	u16Temp = u16Index - M_DAQ__U16_OFFSET;
-		u16Return = C_LOCALDEF__LCCM662__MAX_DAQ_BUFFER_BLOCKS * 2;
+		u8Return = (Luint8)DAQ_CHANNEL_TYPE__U16;
 	}
-	else if (u16Index < M_DAQ__U32_OFFSET)
+	else if(u16Index < M_DAQ__U32_OFFSET)
 	{
-	u16Temp = u16Index - M_DAQ__S32_OFFSET;
-		u16Return = C_LOCALDEF__LCCM662__MAX_DAQ_BUFFER_BLOCKS;
+		u8Return = (Luint8)DAQ_CHANNEL_TYPE__S32;
 	}
-	else if (u16Index < M_DAQ__F32_OFFSET)
+	else if(u16Index < M_DAQ__F32_OFFSET)
 	{
-		u16Temp = u16Index - M_DAQ__U32_OFFSET;
-		u16Return = C_LOCALDEF__LCCM662__MAX_DAQ_BUFFER_BLOCKS;
+		u8Return = (Luint8)DAQ_CHANNEL_TYPE__U32;
 	}
-	else if (u16Index < M_DAQ__NUM_CHANNELS)
+	else
 	{
-		u16Temp = u16Index - M_DAQ__F32_OFFSET;
-		u16Return = C_LOCALDEF__LCCM662__MAX_DAQ_BUFFER_BLOCKS ;
+		u8Return = (Luint8)DAQ_CHANNEL_TYPE__F32;
+	}
+
+	return u8Return;
+}
+
+/***************************************************************************//**
+ * @brief
+ * Ge the max FIFO capacity for a particular stream
+ * 
+ * @note
+ * The ring always keeps one slot empty, so this is one less than the buffer.
+ * 
+ * @param[in]		u16Index			Stream index
+ * @st_funcMD5		C8AC52AC49689FE8A59F99E48EC2E4F3
+ * @st_funcID		LCCM662R0.FILE.000.FUNC.008
+ */
+Luint16 u16SIL3_DAQ__Get_FIFO_Max(Luint16 u16Index)
+{
+	Luint16 u16Return;
+
+	if(u16Index < M_DAQ__NUM_CHANNELS)
+	{
+		u16Return = sDAQ.sRing[u16Index].u16Size - 1U;
 	}
 	else
 	{
-		u16Return = 0;
+		u16Return = 0U;
 	}
 
 	return u16Return;
 
 }
 
+/***************************************************************************//**
+ * @brief
+ * Get the DAQ fault flags, the samples dropped flag is set the first time any
+ * channel ring overflows.
+ * 
+ * @st_funcMD5		4D1C911AF1692E439298CD4F67BC6352
+ * @st_funcID		LCCM662R0.FILE.000.FUNC.011
+ */
+Luint32 u32SIL3_DAQ__Get_FaultFlags(void)
+{
+	return sDAQ.sFaultFlags.u32Flags[0];
+}
+
 //safety checks
-#if C_LOCALDEF__LCCM357__FIFO_DEPTH_U8 == 1U
+//The slot index would be good to 32767 (it comes back as a S16) but RAM runs out first.
+//Each channel ring is MAX_DAQ_BUFFER_BLOCKS * 4 bytes, so 1024 blocks is 4K per channel.
+//With the timer on every channel also gets M_DAQ__TIMER_SLOTS * 4 bytes, which is
+//16 bytes per block once there is a U8 channel, so that case is held to 4K as well.
+#if C_LOCALDEF__LCCM662__MAX_DAQ_BUFFER_BLOCKS > 1024U
+	#error
+#endif
+#if C_LOCALDEF__LCCM662__ENABLE_TIMER_IN_DATA == 1U
 #if C_LOCALDEF__LCCM662__NUM_DAQ_CHANNELS__U8 > 0
-#if C_LOCALDEF__LCCM662__MAX_DAQ_BUFFER_BLOCKS >= 128U
-	//cannot because 4*128 > fifo U8 range
+#if C_LOCALDEF__LCCM662__MAX_DAQ_BUFFER_BLOCKS > 256U
+	//4K of timer per channel
 	#error
 #endif
 #endif
@@ -455,6 +644,48 @@ Luint16 u16SIL3_DAQ__Get_FIFO_Max(Luint16 u16Index)
 #ifndef C_LOCALDEF__LCCM662__ENABLE_USER_PAYLOAD_TYPES
 	#error
 #endif
+#ifndef C_LOCALDEF__LCCM662__ENABLE_ZERO_COPY_TX
+	#error
+#endif
+#if C_LOCALDEF__LCCM662__ENABLE_ZERO_COPY_TX == 1U
+	#ifndef M_LOCALDEF__LCCM662__TX_HANDLER_WRAPPED
+		#error
+	#endif
+	#ifndef M_LOCALDEF__LCCM662__TX_IS_COMPLETE
+		#error
+	#endif
+#endif
+#ifndef C_LOCALDEF__LCCM662__ENABLE_PACKED_FRAMES
+	#error
+#endif
+#ifndef C_LOCALDEF__LCCM662__ENABLE_COMPRESSION
+	#error
+#endif
+#if C_LOCALDEF__LCCM662__ENABLE_COMPRESSION == 1U
+	#if C_LOCALDEF__LCCM662__ENABLE_ZERO_COPY_TX == 1U
+		//the encoded data is not in the ring
+		#error
+	#endif
+	#if C_LOCALDEF__LCCM662__ENABLE_PACKED_FRAMES == 1U
+		//packed frames carry raw samples
+		#error
+	#endif
+	#ifndef C_LOCALDEF__LCCM662__COMPRESS_MAX_BYTES
+		#error
+	#endif
+#endif
+#if C_LOCALDEF__LCCM662__ENABLE_PACKED_FRAMES == 1U
+	#if C_LOCALDEF__LCCM662__ENABLE_ZERO_COPY_TX == 1U
+		//packed frames are copied out of the rings, zero copy does not apply
+		#error
+	#endif
+	#ifndef C_LOCALDEF__LCCM662__PACKED_FRAME_MAX_BYTES
+		#error
+	#endif
+	#ifndef M_LOCALDEF__LCCM662__TX_PACKED_HANDLER
+		#error
+	#endif
+#endif
 
 #endif //#if C_LOCALDEF__LCCM662__ENABLE_THIS_MODULE == 1U
 //safetys
@@ -20,8 +20,8 @@
 		/*******************************************************************************
 		Includes
 		*******************************************************************************/
-		#include <MULTICORE/LCCM357__MULTICORE__SOFTWARE_FIFO/software_fifo__public.h>
 		#include <MULTICORE/LCCM284__MULTICORE__FAULT_TREE/fault_tree__public.h>
+		#include <MULTICORE/LCCM662__MULTICORE__DAQ/daq__fault_flags.h>
 	
 		/*******************************************************************************
 		Defines
@@ -54,7 +54,50 @@
 										C_LOCALDEF__LCCM662__NUM_DAQ_CHANNELS__S32 + \
 										C_LOCALDEF__LCCM662__NUM_DAQ_CHANNELS__U32 + \
 										C_LOCALDEF__LCCM662__NUM_DAQ_CHANNELS__F32)
+
+		/** Timer slots per channel, has to cover the longest ring as the timer is
+		 * indexed by the ring slot, not by the 4 byte block */
+		#if C_LOCALDEF__LCCM662__NUM_DAQ_CHANNELS__U8 > 0U
+			#define M_DAQ__TIMER_SLOTS		(C_LOCALDEF__LCCM662__MAX_DAQ_BUFFER_BLOCKS * 4U)
+		#elif (C_LOCALDEF__LCCM662__NUM_DAQ_CHANNELS__S16 + C_LOCALDEF__LCCM662__NUM_DAQ_CHANNELS__U16) > 0U
+			#define M_DAQ__TIMER_SLOTS		(C_LOCALDEF__LCCM662__MAX_DAQ_BUFFER_BLOCKS * 2U)
+		#else
+			#define M_DAQ__TIMER_SLOTS		(C_LOCALDEF__LCCM662__MAX_DAQ_BUFFER_BLOCKS)
+		#endif
+
+		/** Data memory barrier between the ring payload and the ring positions */
+		#if defined(__TI_COMPILER_VERSION__)
+			//RM4, Cortex-R4
+			#define M_DAQ__MEMORY_BARRIER()									__asm(" DMB")
+		#elif defined(__GNUC__)
+			//GCC / Clang host builds
+			#define M_DAQ__MEMORY_BARRIER()									__sync_synchronize()
+		#elif defined(WIN32)
+			//MSVC volatile access already has acquire / release semantics on x86
+			#define M_DAQ__MEMORY_BARRIER()
+		#else
+			#error
+		#endif
 		
+		/** Packed frame layout, see daq__packed.c */
+		#define C_DAQ__PACKED_FRAME_HEADER_BYTES							(4U)
+		#define C_DAQ__PACKED_BLOCK_HEADER_BYTES							(8U)
+		#define C_DAQ__PACKED_SCHEMA_HEADER_BYTES							(8U)
+		#define C_DAQ__PACKED_SCHEMA_ENTRY_BYTES							(4U)
+		#define C_DAQ__PACKED_SCHEMA_VERSION								(1U)
+
+		/** Largest frame we can hold, leaves room for the SafeUDP / UDP / IP headers */
+		#define C_DAQ__PACKED_FRAME_BUFFER_BYTES							(1400U)
+
+		/** Compressed packet layout, see daq__compress.c */
+		#define C_DAQ__COMPRESS_HEADER_BYTES								(4U)
+
+		/** Worst case encoded sample, 5 byte timer and 5 byte value varint */
+		#define C_DAQ__COMPRESS_MAX_SAMPLE_BYTES							(10U)
+
+		/** Largest encoded packet we can hold */
+		#define C_DAQ__COMPRESS_BUFFER_BYTES								(1400U)
+
 		/** Main DAQ States */
 		typedef enum
 		{
@@ -65,14 +108,59 @@
 			DAQ_STATE__CHECK_FILL,
 			
 			/** Process Fill */
-			DAQ_STATE__PROCESS_FILL
+			DAQ_STATE__PROCESS_FILL,
+
+			/** Zero copy, waiting for the transmitter to finish with the ring memory */
+			DAQ_STATE__WAIT_TX_COMPLETE
 		
 		}E_DAQ__MAIN_STATES;
+
+		/** Channel data types, as sent to the host in the packed and compressed headers */
+		typedef enum
+		{
+			DAQ_CHANNEL_TYPE__U8 = 0U,
+			DAQ_CHANNEL_TYPE__S16,
+			DAQ_CHANNEL_TYPE__U16,
+			DAQ_CHANNEL_TYPE__S32,
+			DAQ_CHANNEL_TYPE__U32,
+			DAQ_CHANNEL_TYPE__F32
+
+		}E_DAQ__CHANNEL_TYPES;
+
+		/** What the packed transmit handler is being asked to send */
+		typedef enum
+		{
+			/** Interleaved channel blocks */
+			DAQ_PACKED__DATA_FRAME = 0U,
+
+			/** Channel layout for the ground station */
+			DAQ_PACKED__SCHEMA
+
+		}E_DAQ__PACKED_TYPES;
 		
 		
 		/*******************************************************************************
 		Structures
 		*******************************************************************************/
+		/** Single producer / single consumer ring, one per channel.
+		 * Only the append side writes the head and only the process side writes the tail
+		 * so an ISR and the main loop never need to lock each other out. */
+		typedef struct
+		{
+			/** Next write position, only modified by the producer */
+			volatile Luint16 u16Head;
+
+			/** Next read position, only modified by the consumer */
+			volatile Luint16 u16Tail;
+
+			/** Number of elements in the buffer, one is always kept empty */
+			Luint16 u16Size;
+
+			/** Samples lost because the ring was full */
+			volatile Luint32 u32DropCount;
+
+		}DAQ__RING_T;
+
 		struct _strDAQ
 		{
 			/** These are the buffers to hold the FIFO data */
@@ -98,25 +186,16 @@
 				#endif				
 				
 				#if C_LOCALDEF__LCCM662__ENABLE_TIMER_IN_DATA == 1U
-				Luint32 u32Timer[M_DAQ__NUM_CHANNELS][C_LOCALDEF__LCCM662__MAX_DAQ_BUFFER_BLOCKS];
+				Luint32 u32Timer[M_DAQ__NUM_CHANNELS][M_DAQ__TIMER_SLOTS];
 				#endif
 				
 			}sBuffers;
 
-			/** Statistics Module */
-			struct
-			{
-				Luint32 u32FIFO_U8FullCount;
-				Luint32 u32FIFO_S16FullCount;
-				Luint32 u32FIFO_U16FullCount;
-				Luint32 u32FIFO_S32FullCount;
-				Luint32 u32FIFO_U32FullCount;
-				Luint32 u32FIFO_F32FullCount;
-
-			}sStats;
-		
-			/** the software FIFO's*/
-			SOFTWARE_FIFO__USER_T sFIFO[M_DAQ__NUM_CHANNELS];
+			/** The per channel rings, also holds the drop statistics */
+			DAQ__RING_T sRing[M_DAQ__NUM_CHANNELS];
+
+			/** Fault flags */
+			FAULT_TREE__PUBLIC_T sFaultFlags;
 		
 			#if C_LOCALDEF__LCCM662__ENABLE_USER_PAYLOAD_TYPES == 1U
 				/** user configurable packet type for transmission purposes */
@@ -144,19 +223,62 @@
 			/** Are we streaming, and if so can we append safely?*/
 			Luint8 u8StreamingOn;
 
-			/** For Interlocking Append functions 
-			 * Not really needed other than for WIN32 simulations
-			 * where multiple threads are writing at the same time and we
-			 * want to detect these sorts of issues.*/
+			#if C_LOCALDEF__LCCM662__ENABLE_ZERO_COPY_TX == 1U
+			/** Zero copy transmit tracking */
 			struct
 			{
-				Luint8 u8U8;
-				Luint8 u8S16;
-				Luint8 u8U16;
-				Luint8 u8S32;
-				Luint8 u8U32;
-				Luint8 u8F32;
-			}sInterlock;
+				/** Ring elements currently owned by the transmitter */
+				Luint16 u16PendingCount;
+
+				/** An EMAC buffer is waiting on the DMA gather before it can be committed */
+				Luint8 u8DMA_CommitPending;
+
+				/** The EMAC buffer index from the precommit */
+				Luint8 u8DMA_BufferIndex;
+
+				/** Total gathered payload length */
+				Luint16 u16DMA_Length;
+
+				/** UDP port to commit the gathered packet on */
+				Luint16 u16DMA_Port;
+
+			}sZeroCopy;
+			#endif
+
+			#if C_LOCALDEF__LCCM662__ENABLE_PACKED_FRAMES == 1U
+			/** Multi channel packed frames */
+			struct
+			{
+				/** The frame being built, or waiting on the transmitter */
+				Luint8 u8Frame[C_DAQ__PACKED_FRAME_BUFFER_BYTES];
+
+				/** Bytes used in the frame */
+				Luint16 u16Length;
+
+				/** Frame built but the transmitter was busy */
+				Luint8 u8TxPending;
+
+				/** Send the schema before the next data frame */
+				Luint8 u8SchemaPending;
+
+				/** What is in the frame buffer */
+				E_DAQ__PACKED_TYPES eTxType;
+
+				/** Data frame sequence so the ground station can spot lost frames */
+				Luint16 u16FrameSequence;
+
+			}sPacked;
+			#endif
+
+			#if C_LOCALDEF__LCCM662__ENABLE_COMPRESSION == 1U
+			/** Delta / varint encoding stage */
+			struct
+			{
+				/** Encoded channel data waiting to be transmitted */
+				Luint8 u8Buffer[C_DAQ__COMPRESS_BUFFER_BYTES];
+
+			}sCompress;
+			#endif
 
 			#ifdef WIN32
 			struct
@@ -175,10 +297,14 @@
 		*******************************************************************************/
 		void vSIL3_DAQ__Init(void);
 		void vSIL3_DAQ__Process(void);
+		void vSIL3_DAQ__Next_ProcessPoint(void);
 		void vSIL3_DAQ__ForceFlush(void);
 		Luint32 u32SIL3_DAQ__Get_SystemTimer(void);
 		DLL_DECLARATION Luint16 u16SIL3_DAQ__Get_FIFO_Level(Luint16 u16Index);
 		DLL_DECLARATION Luint16 u16SIL3_DAQ__Get_FIFO_Max(Luint16 u16Index);
+		DLL_DECLARATION Luint32 u32SIL3_DAQ__Get_FIFO_DropCount(Luint16 u16Index);
+		Luint32 u32SIL3_DAQ__Get_FaultFlags(void);
+		Luint8 u8SIL3_DAQ__Get_ChannelType(Luint16 u16Index);
 		void vSIL3_DAQ__Config_UserPacketType(Luint16 u16Index, Luint16 u16Type);
 		void vSIL3_DAQ__Streaming_On(void);
 		void vSIL3_DAQ__Streaming_Off(void);
@@ -193,13 +319,43 @@
 		DLL_DECLARATION void vSIL3_DAQ_APPEND__U32(Luint16 u16Index, Luint32 u32Value);
 		DLL_DECLARATION void vSIL3_DAQ_APPEND__F32(Luint16 u16Index, Lfloat32 f32Value);
 		Lint16 s16SIL3_DAQ_APPEND__Index_to_BufferPointer(Luint16 u16Index, Luint8 **pu8Buffer);
+
+		//ring
+		void vSIL3_DAQ_RING__Init(Luint16 u16Index, Luint16 u16Size);
+		Lint16 s16SIL3_DAQ_RING__Reserve(Luint16 u16Index);
+		void vSIL3_DAQ_RING__Commit(Luint16 u16Index, Luint16 u16Slot);
+		Luint16 u16SIL3_DAQ_RING__Get_Level(Luint16 u16Index);
+		Luint16 u16SIL3_DAQ_RING__Get_Contiguous(Luint16 u16Index, Luint16 *pu16Start, Luint16 *pu16Wrapped);
+		void vSIL3_DAQ_RING__Release(Luint16 u16Index, Luint16 u16Num);
 		
 		#ifdef WIN32
 			Lint16 s16SIL3_DAQ_WIN32__TxHandler(Luint16 u16Index, Luint8 *pu8Buffer, Luint16 u16Length);
+			DLL_DECLARATION Lint16 s16SIL3_DAQ_WIN32__Decode(const Luint8 *pu8Buffer, Luint16 u16Length, Luint32 *pu32Timer, Luint32 *pu32Value, Luint16 u16MaxSamples);
+		#endif
+
+		//packed frames
+		#if C_LOCALDEF__LCCM662__ENABLE_PACKED_FRAMES == 1U
+			void vSIL3_DAQ_PACKED__Init(void);
+			void vSIL3_DAQ_PACKED__Process(void);
+			void vSIL3_DAQ_PACKED__Request_Schema(void);
+		#endif
+
+		//compression
+		#if C_LOCALDEF__LCCM662__ENABLE_COMPRESSION == 1U
+			Luint16 u16SIL3_DAQ_COMPRESS__Encode(Luint16 u16Index, const Luint8 *pu8Ring, Luint16 u16Start, Luint16 u16Burst, Luint16 u16Wrapped, Luint16 *pu16Samples);
 		#endif
 
 		//template, user should implement their own
 		Lint16 s16SIL3_DAQ_TRANSMIT__Template(Luint16 u16Index, Luint8 *pu8BufferPointer, Luint16 u16LengthBytes);
+		Lint16 s16SIL3_DAQ_TRANSMIT__Template_Wrapped(Luint16 u16Index, Luint8 *pu8First, Luint16 u16FirstLength, Luint8 *pu8Second, Luint16 u16SecondLength);
+		Lint16 s16SIL3_DAQ_TRANSMIT__Template_Packed(Luint16 u16Type, Luint8 *pu8BufferPointer, Luint16 u16LengthBytes);
+
+		//zero copy transmit
+		#if C_LOCALDEF__LCCM662__ENABLE_ZERO_COPY_TX == 1U
+			Lint16 s16SIL3_DAQ_TRANSMIT_ZC__Tx(Luint16 u16PacketType, Luint16 u16Port, Luint8 *pu8Buffer, Luint16 u16Length);
+			Lint16 s16SIL3_DAQ_TRANSMIT_ZC__Tx_Wrapped(Luint16 u16PacketType, Luint16 u16Port, Luint8 *pu8First, Luint16 u16FirstLength, Luint8 *pu8Second, Luint16 u16SecondLength);
+			Luint8 u8SIL3_DAQ_TRANSMIT_ZC__Is_Complete(void);
+		#endif
 
 
 		#if C_LOCALDEF__LCCM662__ENABLE_TEST_SPEC == 1U
@@ -0,0 +1,52 @@
+#ifndef _LCCM662__00__FAULT_FLAGS_H_
+#define _LCCM662__00__FAULT_FLAGS_H_
+/*
+ * @fault_index
+ * 00
+ * 
+ * @brief
+ * GENERAL 
+ * 
+ * @note
+ * A general fault has occured 
+ * 
+ * @tool
+ * [CORE]|[00]|[GENERAL ]|[A general fault has occured ]
+*/
+#define C_LCCM662__CORE__FAULT_INDEX__00				0x00000000U
+#define C_LCCM662__CORE__FAULT_INDEX_MASK__00			0x00000001U
+
+/*
+ * @fault_index
+ * 01
+ * 
+ * @brief
+ * CHANNEL INDEX FAULT 
+ * 
+ * @note
+ * A channel index was out of range or did not match the data type it was used with. 
+ * 
+ * @tool
+ * [CORE]|[01]|[CHANNEL INDEX FAULT ]|[A channel index was out of range or did not match the data type it was used with. ]
+*/
+#define C_LCCM662__CORE__FAULT_INDEX__01				0x00000001U
+#define C_LCCM662__CORE__FAULT_INDEX_MASK__01			0x00000002U
+
+/*
+ * @fault_index
+ * 02
+ * 
+ * @brief
+ * SAMPLES DROPPED 
+ * 
+ * @note
+ * A channel ring was full and at least one sample was lost, see the per channel drop count. 
+ * 
+ * @tool
+ * [CORE]|[02]|[SAMPLES DROPPED ]|[A channel ring was full and at least one sample was lost, see the per channel drop count. ]
+*/
+#define C_LCCM662__CORE__FAULT_INDEX__02				0x00000002U
+#define C_LCCM662__CORE__FAULT_INDEX_MASK__02			0x00000004U
+
+#endif //#ifndef _LCCM662__FAULT_FLAGS_H_
+
@@ -30,11 +30,15 @@
 
 extern TS_BQ76__MAIN sBQ76;
 
+//locals
+static Luint8 u8BQ76_BALANCE__Plan(Luint8 u8DeviceIndex, Lfloat32 f32Target);
+static void vBQ76_BALANCE__Do(void);
+
 /***************************************************************************//**
  * @brief
  * Init the balancer
  * 
- * @st_funcMD5		DCBDDD902B64D985F0B09D4BB187B122
+ * @st_funcMD5		07A564B3630A88D761000E0EB8555946
  * @st_funcID		LCCM715R0.FILE.012.FUNC.001
  */
 void vBQ76_BALANCE__Init(void)
@@ -47,22 +51,100 @@ void vBQ76_BALANCE__Init(void)
 	}
 
 	sBQ76.sBalance.u3210MS_Counter = 0U;
+
+	sBQ76.sBalance.eState = BALANCE_STATE__IDLE;
+
+	//allow a max of 3 cells, but this can be changed later on.
+	sBQ76.sBalance.u8MaxBalanceCells = 3U;
+
+	//0.025v, can change this later.
+	sBQ76.sBalance.f32BalanceTolerance = 0.025F;
+	sBQ76.sBalance.u32LastUpdateCount = 0U;
 }
 
 /***************************************************************************//**
  * @brief
  * Process any balancing tasks
  * 
- * @st_funcMD5		600233110464B6BAD3B047B64966DA0D
+ * @st_funcMD5		469D7606DA4A2E9205895D78487530C4
  * @st_funcID		LCCM715R0.FILE.012.FUNC.002
  */
 void vBQ76_BALANCE__Process(void)
 {
+	Luint8 u8Counter;
+
+	//handle the balancer states
+	switch(sBQ76.sBalance.eState)
+	{
+		case BALANCE_STATE__IDLE:
+			//do nothing.
+			break;
+
+		case BALANCE_STATE__WAIT_VOLTAGE_UPDATE:
+
+			//only move on once a new scan has gone all the way through min/max
+			if(sBQ76.sCells.u32UpdateCount != sBQ76.sBalance.u32LastUpdateCount)
+			{
+				sBQ76.sBalance.u32LastUpdateCount = sBQ76.sCells.u32UpdateCount;
+
+				//change state
+				sBQ76.sBalance.eState = BALANCE_STATE__START_BALANCING;
+			}
+			else
+			{
+				//stay here until the next voltage scan.
+			}
+			break;
+
+		case BALANCE_STATE__START_BALANCING:
+
+			//re-plan the resistors on this scan
+			vBQ76_BALANCE__Do();
 
-    //Update cell balance discharge resistor at 2 Hz
-	if(sBQ76.sBalance.u3210MS_Counter >= 50U){
-	    sBQ76.sBalance.u3210MS_Counter = 0U;
-	    vBQ76_BALANCE__Update_Discharge_Resistors();
+			//Move state
+			sBQ76.sBalance.eState = BALANCE_STATE__CHECK_BALANCED;
+			break;
+
+		case BALANCE_STATE__CHECK_BALANCED:
+
+			//default state
+			sBQ76.sBalance.eState = BALANCE_STATE__BALANCED;
+
+			for(u8Counter = 0U; u8Counter < C_BQ76__TOTAL_CELLS; u8Counter++)
+			{
+				//if we are still balancing, come back in a bit
+				if(sBQ76.sBalance.u8Resistor[u8Counter] == 1U)
+				{
+					//wait for the next voltage update before re-balancing.
+					sBQ76.sBalance.eState = BALANCE_STATE__WAIT_VOLTAGE_UPDATE;
+				}
+				else
+				{
+					//keep looking.
+				}
+			}
+			break;
+
+		case BALANCE_STATE__BALANCED:
+			// Balancing has finished; turn off all discharge resistors.
+			vBQ76_BALANCE__Stop();
+			break;
+
+		default:
+			//log the error
+			break;
+
+	}//switch(sBQ76.sBalance.eState)
+
+	//Update cell balance discharge resistor at 2 Hz
+	if(sBQ76.sBalance.u3210MS_Counter >= 50U)
+	{
+		sBQ76.sBalance.u3210MS_Counter = 0U;
+		vBQ76_BALANCE__Update_Discharge_Resistors();
+	}
+	else
+	{
+		//fall on
 	}
 }
 
@@ -70,12 +152,14 @@ void vBQ76_BALANCE__Process(void)
  * @brief
  * Start the balancing process
  * 
- * @st_funcMD5		C75001693893BA9946A832499E1350EF
+ * @st_funcMD5		A431DEFD0DA958CE7824916792F77327
  * @st_funcID		LCCM715R0.FILE.012.FUNC.003
  */
 void vBQ76_BALANCE__Start(void)
 {
-	//nothing here yet
+	//wait for a scan newer than now
+	sBQ76.sBalance.u32LastUpdateCount = sBQ76.sCells.u32UpdateCount;
+	sBQ76.sBalance.eState = BALANCE_STATE__WAIT_VOLTAGE_UPDATE;
 }
 
 /***************************************************************************//**
@@ -83,24 +167,39 @@ void vBQ76_BALANCE__Start(void)
  * Check if the balancer is busy
  * 
  * @return 			1 = busy
- * @st_funcMD5		EAC635F7A4A802DB33BC96DDB37EF9F6
+ * @st_funcMD5		97297E365A3DF4BFFC61E8C43B6414A9
  * @st_funcID		LCCM715R0.FILE.012.FUNC.004
  */
 Luint8 u8BQ76_BALANCE__Is_Busy(void)
 {
-	return 0;
+	Luint8 u8Return;
+
+	if(sBQ76.sBalance.eState == BALANCE_STATE__IDLE)
+	{
+		u8Return = 0U;
+	}
+	else
+	{
+		u8Return = 1U;
+	}
+
+	return u8Return;
 }
 
 /***************************************************************************//**
  * @brief
  * Stop the balancing
  * 
- * @st_funcMD5		FB05686967B46A17D238B4B6740C4B4F
+ * @st_funcMD5		3EA17D3BF628670D2CBDF04C0E3832F7
  * @st_funcID		LCCM715R0.FILE.012.FUNC.005
  */
 void vBQ76_BALANCE__Stop(void)
 {
-	//nothign here yet
+	//all resistors off and clear the states
+	vBQ76_RES__All_Off();
+
+	//put the state back to idle
+	sBQ76.sBalance.eState = BALANCE_STATE__IDLE;
 }
 
 /***************************************************************************//**
@@ -175,31 +274,193 @@ void vBQ76_BALANCE__Manual(Luint8 u8CellIndex, Luint8 u8Enable)
 
 /***************************************************************************//**
  * @brief
- * Read discharge resistor status from BMS
+ * Plan which resistors on one device should be bleeding this scan.
+ * 
+ * @note
+ * Same planner as the ATA6870 balancer. Every cell is bled towards the lowest
+ * cell, the u8MaxBalanceCells slots per device go to the cells furthest above
+ * it, which is the shortest time to balance for a fixed number of slots.
+ * A bleeding cell stays eligible down to half the tolerance.
+ *
+ * @param[in]		f32Target				The lowest cell voltage in the pack
+ * @param[in]		u8DeviceIndex			Device index
+ * @return			CB_CTRL mask for the device, bit n = cell n
+ * @st_funcMD5		A98EAF5DAF2B2A4FF435743C6B5A26D8
+ * @st_funcID		LCCM715R0.FILE.012.FUNC.008
+ */
+static Luint8 u8BQ76_BALANCE__Plan(Luint8 u8DeviceIndex, Lfloat32 f32Target)
+{
+	Luint8 u8Slot;
+	Luint8 u8CellCounter;
+	Luint8 u8CellIndex;
+	Luint8 u8CellMax;
+	Luint8 u8Mask;
+	Lfloat32 f32Excess;
+	Lfloat32 f32Max;
+	Lfloat32 f32Tolerance;
+
+	u8Mask = 0U;
+
+	//fill each thermal slot with the highest remaining cell
+	for(u8Slot = 0U; u8Slot < sBQ76.sBalance.u8MaxBalanceCells; u8Slot++)
+	{
+		u8CellMax = 0xFFU;
+		f32Max = 0.0F;
+
+		for(u8CellCounter = 0U; u8CellCounter < C_BQ76__MAX_CELLS_PER_DEVICE; u8CellCounter++)
+		{
+			//compute the index
+			u8CellIndex = (u8DeviceIndex * C_BQ76__MAX_CELLS_PER_DEVICE) + u8CellCounter;
+
+			//skip cells already given a slot
+			if((u8Mask & (Luint8)(1U << u8CellCounter)) == 0U)
+			{
+				f32Excess = sBQ76.sCell[u8CellIndex].f32CellVoltage - f32Target;
+
+				//hysteresis, keep a bleeding cell going a little longer
+				if(sBQ76.sBalance.u8Resistor[u8CellIndex] == 1U)
+				{
+					f32Tolerance = sBQ76.sBalance.f32BalanceTolerance * 0.5F;
+				}
+				else
+				{
+					f32Tolerance = sBQ76.sBalance.f32BalanceTolerance;
+				}
+
+				if((f32Excess > f32Tolerance) && (f32Excess > f32Max))
+				{
+					//record it.
+					f32Max = f32Excess;
+					u8CellMax = u8CellCounter;
+				}
+				else
+				{
+					//keep sorting
+				}
+			}
+			else
+			{
+				//already planned
+			}
+
+		}//for(u8CellCounter = 0U; u8CellCounter < C_BQ76__MAX_CELLS_PER_DEVICE; u8CellCounter++)
+
+		if(u8CellMax != 0xFFU)
+		{
+			u8Mask |= (Luint8)(1U << u8CellMax);
+		}
+		else
+		{
+			//nothing left above the target on this device
+		}
+
+	}//for(u8Slot = 0U; u8Slot < sBQ76.sBalance.u8MaxBalanceCells; u8Slot++)
+
+	return u8Mask;
+}
+
+/***************************************************************************//**
+ * @brief
+ * Plan every device and write its CB_CTRL once, only where the plan changed
+ * 
+ * @st_funcMD5		1EE3BC6F516197FDA538511C564268F9
+ * @st_funcID		LCCM715R0.FILE.012.FUNC.009
+ */
+static void vBQ76_BALANCE__Do(void)
+{
+	Luint8 u8DeviceCounter;
+	Luint8 u8CellCounter;
+	Luint8 u8CellIndex;
+	Luint8 u8Mask;
+	Luint8 u8Current;
+	Lfloat32 f32Target;
+
+	//bleed everything towards the lowest cell
+	f32Target = f32BQ76_CELLS__Get_LowestVoltage();
+
+	for(u8DeviceCounter = 0U; u8DeviceCounter < C_LOCALDEF__LCCM715__NUM_DEVICES; u8DeviceCounter++)
+	{
+		u8Mask = u8BQ76_BALANCE__Plan(u8DeviceCounter, f32Target);
+
+		//what is on now
+		u8Current = 0U;
+		for(u8CellCounter = 0U; u8CellCounter < C_BQ76__MAX_CELLS_PER_DEVICE; u8CellCounter++)
+		{
+			//compute the index
+			u8CellIndex = (u8DeviceCounter * C_BQ76__MAX_CELLS_PER_DEVICE) + u8CellCounter;
+			if(sBQ76.sBalance.u8Resistor[u8CellIndex] == 1U)
+			{
+				u8Current |= (Luint8)(1U << u8CellCounter);
+			}
+			else
+			{
+				//off
+			}
+		}
+
+		if(u8Mask != u8Current)
+		{
+			//set the balance time, same as the refresh
+			vBQ76_SPI__Write_U8(u8DeviceCounter + 1U, BQ76_REG__CB_TIME, 0x0AU);
+
+			//switch the whole device over in one go
+			vBQ76_SPI__Write_U8(u8DeviceCounter + 1U, BQ76_REG__CB_CTRL, u8Mask);
+
+			for(u8CellCounter = 0U; u8CellCounter < C_BQ76__MAX_CELLS_PER_DEVICE; u8CellCounter++)
+			{
+				//compute the index
+				u8CellIndex = (u8DeviceCounter * C_BQ76__MAX_CELLS_PER_DEVICE) + u8CellCounter;
+
+				//set the state
+				sBQ76.sBalance.u8Resistor[u8CellIndex] = (u8Mask >> u8CellCounter) & 0x01U;
+			}
+		}
+		else
+		{
+			//plan unchanged
+		}
+
+	}//for(u8DeviceCounter = 0U; u8DeviceCounter < C_LOCALDEF__LCCM715__NUM_DEVICES; u8DeviceCounter++)
+
+}
+
+/***************************************************************************//**
+ * @brief
+ * Refresh the discharge resistors on every device from the balancer states,
+ * restarting the CB_TIME timeout so they stay on
  *
  */
 //TODO: maybe move to RESISTOR
 void vBQ76_BALANCE__Update_Discharge_Resistors(void)
 {
-    Luint8 u8DeviceCounter;
-    Luint8 u8Temp;
-    Luint8 u8Counter;
+	Luint8 u8DeviceCounter;
+	Luint8 u8Temp;
+	Luint8 u8Counter;
 
 
-    for(u8DeviceCounter = 0U; u8DeviceCounter < C_LOCALDEF__LCCM715__NUM_DEVICES; u8DeviceCounter++)
-    {
-        u8Temp = u8BQ76_SPI__Read_U8(u8DeviceCounter + 1U, BQ76_REG__CB_CTRL);
-        for(u8Counter = 0U; u8Counter < 8; u8Counter++){
-            sBQ76.sBalance.u8Resistor[u8Counter+8*u8DeviceCounter] = (u8Temp >> u8Counter) & 0x01;
-        }
+	for(u8DeviceCounter = 0U; u8DeviceCounter < C_LOCALDEF__LCCM715__NUM_DEVICES; u8DeviceCounter++)
+	{
+		//rebuild the mask from our own states, 6 cells per device
+		u8Temp = 0U;
+		for(u8Counter = 0U; u8Counter < C_BQ76__MAX_CELLS_PER_DEVICE; u8Counter++)
+		{
+			if(sBQ76.sBalance.u8Resistor[(u8DeviceCounter * C_BQ76__MAX_CELLS_PER_DEVICE) + u8Counter] == 1U)
+			{
+				u8Temp |= (Luint8)(1U << u8Counter);
+			}
+			else
+			{
+				//off
+			}
+		}
 
-        //set the balance time. 5 min = 0x85U
-        vBQ76_SPI__Write_U8(u8DeviceCounter + 1U, BQ76_REG__CB_TIME, 0x0AU);
+		//set the balance time. 5 min = 0x85U
+		vBQ76_SPI__Write_U8(u8DeviceCounter + 1U, BQ76_REG__CB_TIME, 0x0AU);
 
-        //refresh the resistor value
-        vBQ76_SPI__Write_U8(u8DeviceCounter + 1U, BQ76_REG__CB_CTRL, 0);
-        vBQ76_SPI__Write_U8(u8DeviceCounter + 1U, BQ76_REG__CB_CTRL, u8Temp);
-    }
+		//refresh the resistor value
+		vBQ76_SPI__Write_U8(u8DeviceCounter + 1U, BQ76_REG__CB_CTRL, 0);
+		vBQ76_SPI__Write_U8(u8DeviceCounter + 1U, BQ76_REG__CB_CTRL, u8Temp);
+	}
 }
 
 /***************************************************************************//**
@@ -73,7 +73,7 @@ void vBQ76_CELLS__Init(void)
  * @brief
  * Process the cell level state machine.
  * 
- * @st_funcMD5		DB9A8F4A04A3B0439C6548DAFDEDA803
+ * @st_funcMD5		27746B15BDA852B0197FD348C4514DBB
  * @st_funcID		LCCM715R0.FILE.010.FUNC.002
  */
 void vBQ76_CELLS__Process(void)
@@ -226,6 +226,9 @@ void vBQ76_CELLS__Process(void)
 			//compute the pack voltage
 			vBQ76_BATTERY__Compute_PackVoltage();
 
+			//inc the update count now the whole scan is done
+			sBQ76.sCells.u32UpdateCount++;
+
 			sBQ76.sCells.sState = CELLS_STATE__IDLE;
 			break;
 
@@ -239,7 +242,7 @@ void vBQ76_CELLS__Process(void)
  * @brief
  * Read all the cell voltages off the device
  * 
- * @st_funcMD5		78564D765DDF8EFC0F439B5F489E4572
+ * @st_funcMD5		CB1E8C97040349FCBF2276E81DF57E07
  * @st_funcID		LCCM715R0.FILE.010.FUNC.006
  */
 void vBQ76_CELLS__Read_All(void)
@@ -253,9 +256,6 @@ void vBQ76_CELLS__Read_All(void)
 		vBQ76_SPI__Read_U8_Array(u8Device + 1U, BQ76_REG__VCELL1, &sBQ76.sDevice[u8Device].u8RawVoltArray[0], 12U);
 		
 	}
-	
-	//inc the update count
-	sBQ76.sCells.u32UpdateCount++;
 
 }
 
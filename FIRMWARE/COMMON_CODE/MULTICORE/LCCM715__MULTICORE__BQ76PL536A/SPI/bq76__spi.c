@@ -163,7 +163,7 @@ void vBQ76_SPI__Set_Addresses(void)
  * @param[in]		u8Value					The value to write
  * @param[in]		eReg					The register addx
  * @param[in]		u8DeviceAddx			The BQ76 device address (Must not be zero)
- * @st_funcMD5		E28EEC9D306AB58712AA3FC2286EA0B0
+ * @st_funcMD5		F5B57A5093FE8B0A61AE4878D43BFCF1
  * @st_funcID		LCCM715R0.FILE.006.FUNC.003
  */
 void vBQ76_SPI__Write_U8(Luint8 u8DeviceAddx, TE_BQ76__REG_DEFS eReg, Luint8 u8Value)
@@ -214,6 +214,7 @@ void vBQ76_SPI__Write_U8(Luint8 u8DeviceAddx, TE_BQ76__REG_DEFS eReg, Luint8 u8V
 
 #else
 	//win32
+	vBQ76_WIN32__SPI_Write(u8DeviceAddx, eReg, u8Value);
 #endif
 
 }
@@ -0,0 +1,269 @@
+#include <localdef.h>
+
+#ifndef C_LOCALDEF__LCCM715__ENABLE_THIS_MODULE
+	#error
+#endif
+
+#if C_LOCALDEF__LCCM715__ENABLE_THIS_MODULE == 1U
+#if C_LOCALDEF__LCCM715__ENABLE_TEST_SPEC == 1U
+#ifdef WIN32
+/*
+VB.NET CALL
+<System.Runtime.InteropServices.DllImport(C_DLL_NAME, CallingConvention:=System.Runtime.InteropServices.CallingConvention.Cdecl)> Private Shared Sub vLCCM715R0_TS_000()
+End Sub
+*/
+extern TS_BQ76__MAIN sBQ76;
+void vLCCM715R0_TS_000_TCASE_001(void);
+void vLCCM715R0_TS_000_TCASE_002(void);
+void vLCCM715R0_TS_000_TCASE_003(void);
+
+static void vLCCM715R0_TS_000__Setup(void);
+static void vLCCM715R0_TS_000__Scan(void);
+
+//every cell starts here, also the lowest cell in the pack
+#define C_TS_000__LOW_V						(3.600F)
+
+
+//Function to call the tests for this test specification
+void vLCCM715R0_TS_000(void)
+{
+
+	//Call the test cases
+	vLCCM715R0_TS_000_TCASE_001();
+	vLCCM715R0_TS_000_TCASE_002();
+	vLCCM715R0_TS_000_TCASE_003();
+
+}
+
+//Individual Test Cases can be found below
+/***************************************************************************//**
+ * @st_test_case_id
+ * LCCM715R0.TS.000.TCASE.001
+ * @st_test_desc
+ * Five cells of device 0 are above the target but there are only 3 slots,
+ * they must go to the three highest cells. Device 2 has one cell to bleed
+ * and device 1 none, so device 1 must not be written at all.
+ *
+*/
+void vLCCM715R0_TS_000_TCASE_001(void)
+{
+	Luint8 u8Test;
+	DEBUG_PRINT("START:LCCM715R0.TS.000.TCASE.001\r\n");
+
+	vLCCM715R0_TS_000__Setup();
+
+	u8Test = 1U;
+
+	sBQ76.sCell[0].f32CellVoltage = 3.700F;
+	sBQ76.sCell[1].f32CellVoltage = 3.750F;
+	sBQ76.sCell[2].f32CellVoltage = 3.800F;
+	sBQ76.sCell[3].f32CellVoltage = 3.850F;
+	sBQ76.sCell[4].f32CellVoltage = 3.900F;
+	sBQ76.sCell[(2U * C_BQ76__MAX_CELLS_PER_DEVICE) + 3U].f32CellVoltage = 3.700F;
+	vLCCM715R0_TS_000__Scan();
+
+	if((sBQ76.sWin32.u8CB_CTRL[0] != 0x1CU) ||
+		(sBQ76.sWin32.u8CB_CTRL[2] != 0x08U))
+	{
+		u8Test = 0U;
+	}
+	else
+	{
+		//fall on
+	}
+
+	if((sBQ76.sWin32.u32CB_CTRL_Writes[0] != 1U) ||
+		(sBQ76.sWin32.u32CB_CTRL_Writes[1] != 0U) ||
+		(sBQ76.sWin32.u32CB_CTRL_Writes[2] != 1U))
+	{
+		u8Test = 0U;
+	}
+	else
+	{
+		//fall on
+	}
+
+	if((sBQ76.sBalance.u8Resistor[0] != 0U) ||
+		(sBQ76.sBalance.u8Resistor[1] != 0U) ||
+		(sBQ76.sBalance.u8Resistor[4] != 1U))
+	{
+		u8Test = 0U;
+	}
+	else
+	{
+		//fall on
+	}
+
+	if(u8Test == 1U)
+	{
+		DEBUG_PRINT("PASS:LCCM715R0.TS.000.TCASE.001\r\n");
+	}
+	else
+	{
+		DEBUG_PRINT("FAIL:LCCM715R0.TS.000.TCASE.001\r\n");
+	}
+	DEBUG_PRINT("END:LCCM715R0.TS.000.TCASE.001\r\n");
+
+}
+
+/***************************************************************************//**
+ * @st_test_case_id
+ * LCCM715R0.TS.000.TCASE.002
+ * @st_test_desc
+ * A cell 30mV up starts bleeding. At 15mV it is under the 25mV tolerance
+ * but over half of it so it must keep bleeding, while a cell at 15mV that
+ * was not bleeding must stay off. At 10mV it must stop.
+ *
+*/
+void vLCCM715R0_TS_000_TCASE_002(void)
+{
+	Luint8 u8Test;
+	DEBUG_PRINT("START:LCCM715R0.TS.000.TCASE.002\r\n");
+
+	vLCCM715R0_TS_000__Setup();
+
+	u8Test = 1U;
+
+	sBQ76.sCell[0].f32CellVoltage = C_TS_000__LOW_V + 0.030F;
+	vLCCM715R0_TS_000__Scan();
+	if(sBQ76.sWin32.u8CB_CTRL[0] != 0x01U)
+	{
+		u8Test = 0U;
+	}
+	else
+	{
+		//fall on
+	}
+
+	sBQ76.sCell[0].f32CellVoltage = C_TS_000__LOW_V + 0.015F;
+	sBQ76.sCell[1].f32CellVoltage = C_TS_000__LOW_V + 0.015F;
+	vLCCM715R0_TS_000__Scan();
+	if((sBQ76.sBalance.u8Resistor[0] != 1U) ||
+		(sBQ76.sBalance.u8Resistor[1] != 0U))
+	{
+		u8Test = 0U;
+	}
+	else
+	{
+		//fall on
+	}
+
+	sBQ76.sCell[0].f32CellVoltage = C_TS_000__LOW_V + 0.010F;
+	vLCCM715R0_TS_000__Scan();
+	if((sBQ76.sBalance.u8Resistor[0] != 0U) ||
+		(sBQ76.sWin32.u8CB_CTRL[0] != 0x00U))
+	{
+		u8Test = 0U;
+	}
+	else
+	{
+		//fall on
+	}
+
+	if(u8Test == 1U)
+	{
+		DEBUG_PRINT("PASS:LCCM715R0.TS.000.TCASE.002\r\n");
+	}
+	else
+	{
+		DEBUG_PRINT("FAIL:LCCM715R0.TS.000.TCASE.002\r\n");
+	}
+	DEBUG_PRINT("END:LCCM715R0.TS.000.TCASE.002\r\n");
+
+}
+
+/***************************************************************************//**
+ * @st_test_case_id
+ * LCCM715R0.TS.000.TCASE.003
+ * @st_test_desc
+ * A scan with the same plan must not write any device, a scan where only
+ * device 1 changes must write device 1 once and nothing else.
+ *
+*/
+void vLCCM715R0_TS_000_TCASE_003(void)
+{
+	Luint8 u8Test;
+	DEBUG_PRINT("START:LCCM715R0.TS.000.TCASE.003\r\n");
+
+	vLCCM715R0_TS_000__Setup();
+
+	u8Test = 1U;
+
+	sBQ76.sCell[2].f32CellVoltage = 3.700F;
+	sBQ76.sCell[(2U * C_BQ76__MAX_CELLS_PER_DEVICE) + 5U].f32CellVoltage = 3.700F;
+	vLCCM715R0_TS_000__Scan();
+
+	//same again
+	vLCCM715R0_TS_000__Scan();
+	if((sBQ76.sWin32.u32CB_CTRL_Writes[0] != 1U) ||
+		(sBQ76.sWin32.u32CB_CTRL_Writes[1] != 0U) ||
+		(sBQ76.sWin32.u32CB_CTRL_Writes[2] != 1U))
+	{
+		u8Test = 0U;
+	}
+	else
+	{
+		//fall on
+	}
+
+	//only device 1 moves
+	sBQ76.sCell[C_BQ76__MAX_CELLS_PER_DEVICE + 1U].f32CellVoltage = 3.700F;
+	vLCCM715R0_TS_000__Scan();
+	if((sBQ76.sWin32.u32CB_CTRL_Writes[0] != 1U) ||
+		(sBQ76.sWin32.u32CB_CTRL_Writes[1] != 1U) ||
+		(sBQ76.sWin32.u32CB_CTRL_Writes[2] != 1U) ||
+		(sBQ76.sWin32.u8CB_CTRL[1] != 0x02U))
+	{
+		u8Test = 0U;
+	}
+	else
+	{
+		//fall on
+	}
+
+	if(u8Test == 1U)
+	{
+		DEBUG_PRINT("PASS:LCCM715R0.TS.000.TCASE.003\r\n");
+	}
+	else
+	{
+		DEBUG_PRINT("FAIL:LCCM715R0.TS.000.TCASE.003\r\n");
+	}
+	DEBUG_PRINT("END:LCCM715R0.TS.000.TCASE.003\r\n");
+
+}
+
+//balancer at its defaults, 3 slots and 25mV, every cell at the low voltage
+static void vLCCM715R0_TS_000__Setup(void)
+{
+	Luint8 u8Counter;
+
+	vBQ76_BALANCE__Init();
+	vBQ76_WIN32__Init();
+
+	for(u8Counter = 0U; u8Counter < C_BQ76__TOTAL_CELLS; u8Counter++)
+	{
+		sBQ76.sCell[u8Counter].f32CellVoltage = C_TS_000__LOW_V;
+	}
+	sBQ76.sCells.f32Lowest = C_TS_000__LOW_V;
+
+	//keep the 2Hz refresh out of the write counts
+	sBQ76.sBalance.u3210MS_Counter = 0U;
+}
+
+//a new voltage scan, balancer plans on it once
+static void vLCCM715R0_TS_000__Scan(void)
+{
+	vBQ76_BALANCE__Start();
+	sBQ76.sCells.u32UpdateCount++;
+
+	//wait update -> start
+	vBQ76_BALANCE__Process();
+
+	//start -> plan and write
+	vBQ76_BALANCE__Process();
+}
+
+#endif //WIN32
+#endif //#if C_LOCALDEF__LCCM715__ENABLE_TEST_SPEC == 1U
+#endif //#if C_LOCALDEF__LCCM715__ENABLE_THIS_MODULE == 1U
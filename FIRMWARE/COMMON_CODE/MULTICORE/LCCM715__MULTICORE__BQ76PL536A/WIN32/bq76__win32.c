@@ -29,6 +29,49 @@
 #if C_LOCALDEF__LCCM715__ENABLE_THIS_MODULE == 1U
 #ifdef WIN32
 
+extern TS_BQ76__MAIN sBQ76;
+
+/***************************************************************************//**
+ * @brief
+ * Clear the simulated SPI capture
+ * 
+ * @st_funcMD5		47E8369B1812B18877F92CDF95C03C47
+ * @st_funcID		LCCM715R0.FILE.005.FUNC.001
+ */
+void vBQ76_WIN32__Init(void)
+{
+	Luint8 u8Counter;
+
+	for(u8Counter = 0U; u8Counter < C_LOCALDEF__LCCM715__NUM_DEVICES; u8Counter++)
+	{
+		sBQ76.sWin32.u32CB_CTRL_Writes[u8Counter] = 0U;
+		sBQ76.sWin32.u8CB_CTRL[u8Counter] = 0U;
+	}
+}
+
+/***************************************************************************//**
+ * @brief
+ * Capture a register write that would have gone out on the SPI
+ * 
+ * @param[in]		u8Value					The value written
+ * @param[in]		eReg					The register addx
+ * @param[in]		u8DeviceAddx			The BQ76 device address
+ * @st_funcMD5		F2D7C006D9215BD6DAC16817BD47BA1E
+ * @st_funcID		LCCM715R0.FILE.005.FUNC.002
+ */
+void vBQ76_WIN32__SPI_Write(Luint8 u8DeviceAddx, TE_BQ76__REG_DEFS eReg, Luint8 u8Value)
+{
+	//only the balance control of an addressed device is kept
+	if((eReg == BQ76_REG__CB_CTRL) && (u8DeviceAddx > 0U) && (u8DeviceAddx <= C_LOCALDEF__LCCM715__NUM_DEVICES))
+	{
+		sBQ76.sWin32.u32CB_CTRL_Writes[u8DeviceAddx - 1U]++;
+		sBQ76.sWin32.u8CB_CTRL[u8DeviceAddx - 1U] = u8Value;
+	}
+	else
+	{
+		//not tracked
+	}
+}
 
 #endif //WIN32
 #endif //#if C_LOCALDEF__LCCM715__ENABLE_THIS_MODULE == 1U
@@ -34,7 +34,7 @@ TS_BQ76__MAIN sBQ76;
  * @brief
  * Init the BQ76 device.
  * 
- * @st_funcMD5		F10254CAECA5B757C2E5CBB41CB26500
+ * @st_funcMD5		4EF1F7B3C6D1832C2B1B231C81292264
  * @st_funcID		LCCM715R0.FILE.000.FUNC.001
  */
 void vBQ76__Init(void)
@@ -63,6 +63,10 @@ void vBQ76__Init(void)
 	//resistor control
 	vBQ76_RES__Init();
 
+#ifdef WIN32
+	vBQ76_WIN32__Init();
+#endif
+
 }
 
 /***************************************************************************//**
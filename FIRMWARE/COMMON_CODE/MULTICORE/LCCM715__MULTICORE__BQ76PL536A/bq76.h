@@ -128,6 +128,18 @@
 			struct
 			{
 
+				/** The current balancing state */
+				TE_BQ76__BALANCE_STATE_T eState;
+
+				/** Thermal limit, max resistors on at once per device */
+				Luint8 u8MaxBalanceCells;
+
+				/** Volts above the lowest cell before a cell is worth bleeding */
+				Lfloat32 f32BalanceTolerance;
+
+				/** Cell update count of the last scan we planned on */
+				Luint32 u32LastUpdateCount;
+
 				/** Resistor control state for the balancer */
 				Luint8 u8Resistor[C_BQ76__TOTAL_CELLS];
 
@@ -176,7 +188,7 @@
 				/** Lowest cell voltage */
 				Lfloat32 f32Lowest;
 
-				/** Number of times state machine has read cells */
+				/** Number of complete cell scans, bumped once min/max and the pack are done */
 				Luint32 u32UpdateCount;
 
 			}sCells;
@@ -192,6 +204,19 @@
 				Luint8 u8RawVoltArray[C_BQ76__MAX_CELLS_PER_DEVICE * 2U];
 				
 			}sDevice[C_LOCALDEF__LCCM715__NUM_DEVICES];
+
+			#ifdef WIN32
+			/** Simulated SPI capture */
+			struct
+			{
+				/** Number of CB_CTRL writes to each device */
+				Luint32 u32CB_CTRL_Writes[C_LOCALDEF__LCCM715__NUM_DEVICES];
+
+				/** Last CB_CTRL value written to each device */
+				Luint8 u8CB_CTRL[C_LOCALDEF__LCCM715__NUM_DEVICES];
+
+			}sWin32;
+			#endif
 			
 		}TS_BQ76__MAIN;
 
@@ -248,6 +273,17 @@
 		void vBQ76_SPI__Write_U8(Luint8 u8DeviceAddx, TE_BQ76__REG_DEFS eReg, Luint8 u8Value);
 		void vBQ76_SPI__Read_U8_Array(Luint8 u8DeviceAddx, TE_BQ76__REG_DEFS eReg, Luint8 *pu8Data, Luint8 u8Length);
 
+		//win32
+		#ifdef WIN32
+			DLL_DECLARATION void vBQ76_WIN32__Init(void);
+			void vBQ76_WIN32__SPI_Write(Luint8 u8DeviceAddx, TE_BQ76__REG_DEFS eReg, Luint8 u8Value);
+		#endif
+
+		//testing
+		#if C_LOCALDEF__LCCM715__ENABLE_TEST_SPEC == 1U
+			DLL_DECLARATION void vLCCM715R0_TS_000(void);
+		#endif
+
 
 	#endif //#if C_LOCALDEF__LCCM715__ENABLE_THIS_MODULE == 1U
 	//safetys
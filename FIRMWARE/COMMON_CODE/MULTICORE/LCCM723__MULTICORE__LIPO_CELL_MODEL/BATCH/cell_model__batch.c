@@ -0,0 +1,449 @@
+/**
+ * @file		CELL_MODEL__BATCH.C
+ * @brief		Batch model of many independent packs for host side studies
+ * @author		Lachlan Grogan
+ * @copyright	This file contains proprietary and confidential information of
+ *				SIL3 Pty. Ltd. (ACN 123 529 064). This code may be distributed
+ *				under a license from SIL3 Pty. Ltd., and may be used, copied
+ *				and/or disclosed only pursuant to the terms of that license agreement.
+ *				This copyright notice must be retained as part of this file at all times.
+ * @copyright	This file is copyright SIL3 Pty. Ltd. 2003-2016, All Rights Reserved.
+ * @st_fileID	LCCM723R0.FILE.008
+ */
+
+/**
+ * @addtogroup MULTICORE
+ * @{
+*/
+/**
+ * @addtogroup LIPO_CELL_MODEL
+ * @ingroup MULTICORE
+ * @{
+*/
+/**
+ * @addtogroup LIPO_CELL_MODEL__BATCH
+ * @ingroup LIPO_CELL_MODEL
+ * @{
+*/
+#include <MULTICORE/LCCM723__MULTICORE__LIPO_CELL_MODEL/cell_model.h>
+#if C_LOCALDEF__LCCM723__ENABLE_THIS_MODULE == 1U
+#if C_LOCALDEF__LCCM723__ENABLE_BATCH == 1U
+
+#include <math.h>
+
+extern TS_LIPO_CELL_MODEL sLiPo;
+#ifdef WIN32
+	extern Lfloat32 f32CELLMODEL_TABLES__Entropy[];
+#else
+	extern const Lfloat32 f32CELLMODEL_TABLES__Entropy[];
+#endif
+
+/** The batch of packs */
+TS_LIPO_CELL_BATCH sLiPoBatch;
+
+//locals
+static void vLIPOMODEL_BATCH__Run_Pack(Luint32 u32PackIndex, Luint32 u32Steps);
+
+
+/***************************************************************************//**
+ * @brief
+ * Init the batch, every cell starts full at 20C with nominal capacity
+ * and resistance and no load.
+ *
+ * @param[in]		u32NumPacks				Packs to simulate, limited to the max
+ * @param[in]		f32TimeStep				Time step in seconds
+ * @st_funcMD5		4139D770C22F87C165BA460178D05C74
+ * @st_funcID		LCCM723R0.FILE.008.FUNC.001
+ */
+void vLIPOMODEL_BATCH__Init(Luint32 u32NumPacks, Lfloat32 f32TimeStep)
+{
+	Luint32 u32Pack;
+	Luint32 u32Cell;
+
+	if(u32NumPacks > C_LOCALDEF__LCCM723__BATCH_MAX_PACKS)
+	{
+		u32NumPacks = C_LOCALDEF__LCCM723__BATCH_MAX_PACKS;
+	}
+	else
+	{
+		//fall on
+	}
+	sLiPoBatch.u32NumPacks = u32NumPacks;
+	sLiPoBatch.f32TimeStep = f32TimeStep;
+
+	//the batch shares the tables with the single model
+	vLIPOMODEL_LOOKUP__Init();
+
+	for(u32Pack = 0U; u32Pack < C_LOCALDEF__LCCM723__BATCH_MAX_PACKS; u32Pack++)
+	{
+		vLIPOMODEL_BATCH__Set_Load(u32Pack, LIPOMODEL_BATCH_LOAD__CURRENT, 0.0F, 20.0F);
+		for(u32Cell = 0U; u32Cell < C_LOCALDEF__LCCM723__NUM_CELLS_PER_PACK; u32Cell++)
+		{
+			vLIPOMODEL_BATCH__Set_Cell(u32Pack, u32Cell, 1.0F, 1.0F, 20.0F);
+		}
+	}
+}
+
+/***************************************************************************//**
+ * @brief
+ * Set the starting state and variation of one cell, also clears its
+ * pack results.
+ *
+ * @param[in]		u32PackIndex			Pack index
+ * @param[in]		u32CellIndex			Cell index in the pack
+ * @param[in]		f32CapacityScale		Capacity relative to nominal
+ * @param[in]		f32ResistanceScale		Resistance relative to nominal
+ * @param[in]		f32Temperature_degC		Starting cell, PCM and sensor temperature
+ * @st_funcMD5		2EC9FB52352B01F4D7E903357ABBE5A2
+ * @st_funcID		LCCM723R0.FILE.008.FUNC.002
+ */
+void vLIPOMODEL_BATCH__Set_Cell(Luint32 u32PackIndex, Luint32 u32CellIndex, Lfloat32 f32CapacityScale, Lfloat32 f32ResistanceScale, Lfloat32 f32Temperature_degC)
+{
+	Luint32 u32Index;
+
+	if((u32PackIndex < C_LOCALDEF__LCCM723__BATCH_MAX_PACKS) && (u32CellIndex < C_LOCALDEF__LCCM723__NUM_CELLS_PER_PACK))
+	{
+		u32Index = (u32PackIndex * C_LOCALDEF__LCCM723__NUM_CELLS_PER_PACK) + u32CellIndex;
+
+		sLiPoBatch.sCell.f32DOD[u32Index] = 0.0F;
+		sLiPoBatch.sCell.f32InvCapacity[u32Index] = 1.0F / (C_LIPOMODEL__CELL_CAPACITY_AS * (Lfloat32)C_LOCALDEF__LCCM723__NUM_PARALLEL * f32CapacityScale);
+		sLiPoBatch.sCell.f32ResistanceScale[u32Index] = f32ResistanceScale;
+		sLiPoBatch.sCell.f32CellTemp_degC[u32Index] = f32Temperature_degC;
+		sLiPoBatch.sCell.f32PCMTemp_degC[u32Index] = f32Temperature_degC;
+		sLiPoBatch.sCell.f32SensorTemp_degC[u32Index] = f32Temperature_degC;
+		sLiPoBatch.sCell.f32Voltage_V[u32Index] = 0.0F;
+
+		sLiPoBatch.sPack.f32PackVoltage_V[u32PackIndex] = 0.0F;
+		sLiPoBatch.sPack.f32PeakCellTemp_degC[u32PackIndex] = -273.15F;
+		sLiPoBatch.sPack.f32MinCellVoltage_V[u32PackIndex] = 1000.0F;
+	}
+	else
+	{
+		//error
+	}
+}
+
+/***************************************************************************//**
+ * @brief
+ * Set the load on each cell of a pack, can be changed between runs to build
+ * up a load profile.
+ *
+ * @param[in]		u32PackIndex			Pack index
+ * @param[in]		eLoad					Load type
+ * @param[in]		f32Value				Load per cell in A, W or R
+ * @param[in]		f32Ambient_degC			Ambient temperature
+ * @st_funcMD5		A6F3BD06A5D150737C291ECB9332C1EE
+ * @st_funcID		LCCM723R0.FILE.008.FUNC.003
+ */
+void vLIPOMODEL_BATCH__Set_Load(Luint32 u32PackIndex, E_LIPOMODEL_BATCH_LOAD_T eLoad, Lfloat32 f32Value, Lfloat32 f32Ambient_degC)
+{
+	if(u32PackIndex < C_LOCALDEF__LCCM723__BATCH_MAX_PACKS)
+	{
+		sLiPoBatch.sPack.eLoad[u32PackIndex] = eLoad;
+		sLiPoBatch.sPack.f32Load[u32PackIndex] = f32Value;
+		sLiPoBatch.sPack.f32Ambient_degC[u32PackIndex] = f32Ambient_degC;
+	}
+	else
+	{
+		//error
+	}
+}
+
+/***************************************************************************//**
+ * @brief
+ * Run every pack forward a number of steps
+ *
+ * @note
+ * Packs are independent so each one runs all of its steps before the next,
+ * keeping its cells in cache. With OpenMP enabled the packs are shared
+ * across threads, without it the pragma is ignored and this runs on one core.
+ *
+ * @param[in]		u32Steps				Number of time steps
+ * @st_funcMD5		8B726770A06CFA38CBD2BF86135D4B0B
+ * @st_funcID		LCCM723R0.FILE.008.FUNC.004
+ */
+void vLIPOMODEL_BATCH__Run(Luint32 u32Steps)
+{
+	//MSVC OpenMP needs a signed loop index
+	Lint32 s32Pack;
+
+	#pragma omp parallel for schedule(static)
+	for(s32Pack = 0; s32Pack < (Lint32)sLiPoBatch.u32NumPacks; s32Pack++)
+	{
+		vLIPOMODEL_BATCH__Run_Pack((Luint32)s32Pack, u32Steps);
+	}
+}
+
+/***************************************************************************//**
+ * @brief
+ * Pack voltage after the last step
+ *
+ * @param[in]		u32PackIndex			Pack index
+ * @return			Pack voltage in V
+ * @st_funcMD5		4C8BA03B2DA7DFB87CA202938CDAD114
+ * @st_funcID		LCCM723R0.FILE.008.FUNC.005
+ */
+Lfloat32 f32LIPOMODEL_BATCH__Get_PackVoltage(Luint32 u32PackIndex)
+{
+	return sLiPoBatch.sPack.f32PackVoltage_V[u32PackIndex];
+}
+
+/***************************************************************************//**
+ * @brief
+ * Highest cell temperature of a pack since it was set
+ *
+ * @param[in]		u32PackIndex			Pack index
+ * @return			Temperature in C
+ * @st_funcMD5		44A6FDFD4BE5D25F6E354303D83A4F00
+ * @st_funcID		LCCM723R0.FILE.008.FUNC.006
+ */
+Lfloat32 f32LIPOMODEL_BATCH__Get_PeakCellTemp(Luint32 u32PackIndex)
+{
+	return sLiPoBatch.sPack.f32PeakCellTemp_degC[u32PackIndex];
+}
+
+/***************************************************************************//**
+ * @brief
+ * Lowest cell voltage of a pack since it was set
+ *
+ * @param[in]		u32PackIndex			Pack index
+ * @return			Voltage in V
+ * @st_funcMD5		654953ABBDE153BC82C63614A34E9569
+ * @st_funcID		LCCM723R0.FILE.008.FUNC.007
+ */
+Lfloat32 f32LIPOMODEL_BATCH__Get_MinCellVoltage(Luint32 u32PackIndex)
+{
+	return sLiPoBatch.sPack.f32MinCellVoltage_V[u32PackIndex];
+}
+
+/***************************************************************************//**
+ * @brief
+ * Current temperature of one cell
+ *
+ * @param[in]		u32PackIndex			Pack index
+ * @param[in]		u32CellIndex			Cell index in the pack
+ * @return			Temperature in C
+ * @st_funcMD5		F44C7BD5EA0AF0973C5116BE59C6B28C
+ * @st_funcID		LCCM723R0.FILE.008.FUNC.008
+ */
+Lfloat32 f32LIPOMODEL_BATCH__Get_CellTemp(Luint32 u32PackIndex, Luint32 u32CellIndex)
+{
+	return sLiPoBatch.sCell.f32CellTemp_degC[(u32PackIndex * C_LOCALDEF__LCCM723__NUM_CELLS_PER_PACK) + u32CellIndex];
+}
+
+/***************************************************************************//**
+ * @brief
+ * Count the packs whose peak cell temperature went over a limit
+ *
+ * @param[in]		f32Limit_degC			Temperature limit
+ * @return			Number of packs over the limit
+ * @st_funcMD5		92A2CAF767532FFDBF6729B1270BFB1A
+ * @st_funcID		LCCM723R0.FILE.008.FUNC.009
+ */
+Luint32 u32LIPOMODEL_BATCH__Count_Over(Lfloat32 f32Limit_degC)
+{
+	Luint32 u32Pack;
+	Luint32 u32Count;
+
+	u32Count = 0U;
+	for(u32Pack = 0U; u32Pack < sLiPoBatch.u32NumPacks; u32Pack++)
+	{
+		if(sLiPoBatch.sPack.f32PeakCellTemp_degC[u32Pack] > f32Limit_degC)
+		{
+			u32Count++;
+		}
+		else
+		{
+			//fall on
+		}
+	}
+
+	return u32Count;
+}
+
+//same physics as vLIPOMODEL_CELL__Step_All(), written without branches in the
+//cell loop so it vectorises. Table lookups clamp by min/max and the loads are
+//selected. The clamps are written (x >= min) ? x : min so a NaN lands on the
+//clamp, and the integer index is clamped again before it is used. Build with -fno-math-errno -fno-trapping-math or /fp:fast so the
+//selects and sqrtf() stay in the vector loop.
+//Table indexes are signed so they map onto 32 bit gathers.
+static void vLIPOMODEL_BATCH__Run_Pack(Luint32 u32PackIndex, Luint32 u32Steps)
+{
+	Luint32 u32Step;
+	Luint32 u32Cell;
+	Luint32 u32Base;
+	Lint32 s32Index;
+	Lint32 s32SoC;
+	E_LIPOMODEL_BATCH_LOAD_T eLoad;
+	Lfloat32 f32Load;
+	Lfloat32 f32Ambient;
+	Lfloat32 f32TimeStep;
+	Lfloat32 f32PackV;
+	Lfloat32 f32PeakT;
+	Lfloat32 f32MinV;
+	Lfloat32 f32SoC;
+	Lfloat32 f32Pos;
+	Lfloat32 f32Frac;
+	Lfloat32 f32OCV;
+	Lfloat32 f32R;
+	Lfloat32 f32V;
+	Lfloat32 f32I;
+	Lfloat32 f32VPower;
+	Lfloat32 f32IPower;
+	Lfloat32 f32VRes;
+	Lfloat32 f32IRes;
+	Lfloat32 f32Temp;
+	Lfloat32 f32Melt;
+	Lfloat32 f32CellT;
+	Lfloat32 f32PCMT;
+	Lfloat32 f32IrrHeat;
+	Lfloat32 f32RevHeat;
+	Lfloat32 f32AmbCool;
+	Lfloat32 f32PCMHeat;
+	Lfloat32 *pf32DOD;
+	Lfloat32 *pf32InvCap;
+	Lfloat32 *pf32RScale;
+	Lfloat32 *pf32CellT;
+	Lfloat32 *pf32PCMT;
+	Lfloat32 *pf32SenseT;
+	Lfloat32 *pf32V;
+
+	u32Base = u32PackIndex * C_LOCALDEF__LCCM723__NUM_CELLS_PER_PACK;
+	pf32DOD = &sLiPoBatch.sCell.f32DOD[u32Base];
+	pf32InvCap = &sLiPoBatch.sCell.f32InvCapacity[u32Base];
+	pf32RScale = &sLiPoBatch.sCell.f32ResistanceScale[u32Base];
+	pf32CellT = &sLiPoBatch.sCell.f32CellTemp_degC[u32Base];
+	pf32PCMT = &sLiPoBatch.sCell.f32PCMTemp_degC[u32Base];
+	pf32SenseT = &sLiPoBatch.sCell.f32SensorTemp_degC[u32Base];
+	pf32V = &sLiPoBatch.sCell.f32Voltage_V[u32Base];
+
+	eLoad = sLiPoBatch.sPack.eLoad[u32PackIndex];
+	f32Load = sLiPoBatch.sPack.f32Load[u32PackIndex];
+	f32Ambient = sLiPoBatch.sPack.f32Ambient_degC[u32PackIndex];
+	f32TimeStep = sLiPoBatch.f32TimeStep;
+	f32PeakT = sLiPoBatch.sPack.f32PeakCellTemp_degC[u32PackIndex];
+	f32MinV = sLiPoBatch.sPack.f32MinCellVoltage_V[u32PackIndex];
+	f32PackV = sLiPoBatch.sPack.f32PackVoltage_V[u32PackIndex];
+
+	for(u32Step = 0U; u32Step < u32Steps; u32Step++)
+	{
+		for(u32Cell = 0U; u32Cell < C_LOCALDEF__LCCM723__NUM_CELLS_PER_PACK; u32Cell++)
+		{
+			f32CellT = pf32CellT[u32Cell];
+			f32PCMT = pf32PCMT[u32Cell];
+			f32SoC = 1.0F - pf32DOD[u32Cell];
+
+			//OCV
+			f32Pos = f32SoC * (Lfloat32)(C_LIPOMODEL__OCV_TABLE_SIZE - 1U);
+			f32Pos = (f32Pos >= 0.0F) ? f32Pos : 0.0F;
+			f32Pos = (f32Pos <= (Lfloat32)(C_LIPOMODEL__OCV_TABLE_SIZE - 1U)) ? f32Pos : (Lfloat32)(C_LIPOMODEL__OCV_TABLE_SIZE - 1U);
+			s32Index = (Lint32)f32Pos;
+			s32Index = (s32Index >= 0) ? s32Index : 0;
+			s32Index = (s32Index > ((Lint32)C_LIPOMODEL__OCV_TABLE_SIZE - 2)) ? ((Lint32)C_LIPOMODEL__OCV_TABLE_SIZE - 2) : s32Index;
+			f32Frac = f32Pos - (Lfloat32)s32Index;
+			f32OCV = sLiPo.sLookup.f32OCV_V[s32Index] + (f32Frac * (sLiPo.sLookup.f32OCV_V[s32Index + 1] - sLiPo.sLookup.f32OCV_V[s32Index]));
+
+			//resistance
+			f32Pos = (f32CellT - C_LIPOMODEL__RES_TABLE_MIN_DEGC) / C_LIPOMODEL__RES_TABLE_STEP_DEGC;
+			f32Pos = (f32Pos >= 0.0F) ? f32Pos : 0.0F;
+			f32Pos = (f32Pos <= (Lfloat32)(C_LIPOMODEL__RES_TABLE_SIZE - 1U)) ? f32Pos : (Lfloat32)(C_LIPOMODEL__RES_TABLE_SIZE - 1U);
+			s32Index = (Lint32)f32Pos;
+			s32Index = (s32Index >= 0) ? s32Index : 0;
+			s32Index = (s32Index > ((Lint32)C_LIPOMODEL__RES_TABLE_SIZE - 2)) ? ((Lint32)C_LIPOMODEL__RES_TABLE_SIZE - 2) : s32Index;
+			f32Frac = f32Pos - (Lfloat32)s32Index;
+			f32R = sLiPo.sLookup.f32Resistance_R[s32Index] + (f32Frac * (sLiPo.sLookup.f32Resistance_R[s32Index + 1] - sLiPo.sLookup.f32Resistance_R[s32Index]));
+			f32R *= pf32RScale[u32Cell];
+
+			//entropy at the integer SoC, clamp before the cast as a NaN cast is undefined
+			f32Temp = f32SoC * 100.0F;
+			f32Temp = (f32Temp >= 0.0F) ? f32Temp : 0.0F;
+			f32Temp = (f32Temp <= 100.0F) ? f32Temp : 100.0F;
+			s32SoC = (Lint32)f32Temp;
+
+			//loads - Equations 1, 2 and 3, all three are worked out and one picked
+			//so the loop has no branches, the unused ones may be inf which is fine
+			f32Temp = (f32OCV * f32OCV) - (4.0F * f32Load * f32R);
+			f32Temp = (f32Temp >= 0.0F) ? f32Temp : 0.0F;
+			f32VPower = 0.5F * (f32OCV + sqrtf(f32Temp));
+			f32IPower = f32Load / f32VPower;
+			f32VRes = f32Load / (f32R + f32Load) * f32OCV;
+			//not V / load, a short (0R) would give 0 / 0
+			f32IRes = f32OCV / (f32R + f32Load);
+			f32V = (eLoad == LIPOMODEL_BATCH_LOAD__POWER) ? f32VPower : f32VRes;
+			f32I = (eLoad == LIPOMODEL_BATCH_LOAD__POWER) ? f32IPower : f32IRes;
+			f32V = (eLoad == LIPOMODEL_BATCH_LOAD__CURRENT) ? (f32OCV - (f32Load * f32R)) : f32V;
+			f32I = (eLoad == LIPOMODEL_BATCH_LOAD__CURRENT) ? f32Load : f32I;
+
+			//cell heat - Equation 6
+			f32IrrHeat = (f32I * f32I) * f32R;
+			f32RevHeat = -1.0F * f32CELLMODEL_TABLES__Entropy[s32SoC] / 1000.0F * (f32CellT + 273.15F) * f32I;
+			f32AmbCool = 1.0F / C_LIPOMODEL__RTH_AMBIENT * (f32CellT - f32Ambient);
+			f32PCMHeat = 1.0F / C_LIPOMODEL__RTH_PCM * (f32CellT - f32PCMT);
+
+			//PCM melt - Equation 8, zero outside the table
+			f32Temp = f32PCMT - C_LIPOMODEL__PCM_MELT_DEGC;
+			f32Pos = (f32Temp - C_LIPOMODEL__MELT_TABLE_MIN_DEGC) / C_LIPOMODEL__MELT_TABLE_STEP_DEGC;
+			f32Pos = (f32Pos >= 0.0F) ? f32Pos : 0.0F;
+			f32Pos = (f32Pos <= (Lfloat32)(C_LIPOMODEL__MELT_TABLE_SIZE - 1U)) ? f32Pos : (Lfloat32)(C_LIPOMODEL__MELT_TABLE_SIZE - 1U);
+			s32Index = (Lint32)f32Pos;
+			s32Index = (s32Index >= 0) ? s32Index : 0;
+			s32Index = (s32Index > ((Lint32)C_LIPOMODEL__MELT_TABLE_SIZE - 2)) ? ((Lint32)C_LIPOMODEL__MELT_TABLE_SIZE - 2) : s32Index;
+			f32Frac = f32Pos - (Lfloat32)s32Index;
+			f32Melt = sLiPo.sLookup.f32MeltFunc[s32Index] + (f32Frac * (sLiPo.sLookup.f32MeltFunc[s32Index + 1] - sLiPo.sLookup.f32MeltFunc[s32Index]));
+			f32Melt = (f32Temp > C_LIPOMODEL__MELT_TABLE_MIN_DEGC) ? f32Melt : 0.0F;
+			f32Melt = (f32Temp < -C_LIPOMODEL__MELT_TABLE_MIN_DEGC) ? f32Melt : 0.0F;
+
+			//integrate - Equations 6, 7 and 9
+			pf32DOD[u32Cell] += f32I * f32TimeStep * pf32InvCap[u32Cell];
+			pf32CellT[u32Cell] += 1.0F / C_LIPOMODEL__CELL_MASS_G / C_LIPOMODEL__SHC_CELL * (f32IrrHeat + f32RevHeat - f32AmbCool - f32PCMHeat) * f32TimeStep;
+			pf32PCMT[u32Cell] += 1.0F / C_LIPOMODEL__PCM_MASS_G / (C_LIPOMODEL__SHC_PCM + (f32Melt * C_LIPOMODEL__PCM_HEAT_MELT)) * f32PCMHeat * f32TimeStep;
+			pf32SenseT[u32Cell] += 1.0F / C_LIPOMODEL__SENSE_TIME_CONST * (f32CellT - pf32SenseT[u32Cell]) * f32TimeStep;
+			pf32V[u32Cell] = f32V;
+		}
+
+		//results, kept out of the loop above so it has no reductions
+		f32PackV = 0.0F;
+		for(u32Cell = 0U; u32Cell < C_LOCALDEF__LCCM723__NUM_CELLS_PER_PACK; u32Cell++)
+		{
+			f32PackV += pf32V[u32Cell];
+			if(pf32CellT[u32Cell] > f32PeakT)
+			{
+				f32PeakT = pf32CellT[u32Cell];
+			}
+			else
+			{
+				//fall on
+			}
+			if(pf32V[u32Cell] < f32MinV)
+			{
+				f32MinV = pf32V[u32Cell];
+			}
+			else
+			{
+				//fall on
+			}
+		}
+	}
+
+	sLiPoBatch.sPack.f32PackVoltage_V[u32PackIndex] = f32PackV;
+	sLiPoBatch.sPack.f32PeakCellTemp_degC[u32PackIndex] = f32PeakT;
+	sLiPoBatch.sPack.f32MinCellVoltage_V[u32PackIndex] = f32MinV;
+}
+
+//safetys
+#ifndef C_LOCALDEF__LCCM723__BATCH_MAX_PACKS
+	#error
+#endif
+#if C_LOCALDEF__LCCM723__BATCH_MAX_PACKS == 0U
+	#error
+#endif
+
+#endif //#if C_LOCALDEF__LCCM723__ENABLE_BATCH == 1U
+#endif //#if C_LOCALDEF__LCCM723__ENABLE_THIS_MODULE == 1U
+//safetys
+#ifndef C_LOCALDEF__LCCM723__ENABLE_THIS_MODULE
+	#error
+#endif
+/** @} */
+/** @} */
+/** @} */
@@ -67,7 +67,7 @@ void vLIPOMODEL_BATTERY__Init(Luint16 u16PackIndex)
  * Process the battery pack
  * 
  * @param[in]		u16PackIndex			The pack index
- * @st_funcMD5		888CC156FCFD5FBE78DEC4C060C1FEF7
+ * @st_funcMD5		9E117E6B7D292A3984D17F77869C957C
  * @st_funcID		LCCM723R0.FILE.006.FUNC.002
  */
 void vLIPOMODEL_BATTERY__Process(Luint16 u16PackIndex)
@@ -80,14 +80,11 @@ void vLIPOMODEL_BATTERY__Process(Luint16 u16PackIndex)
 		//clear the pack vo
 		f32Temp = 0.0F;
 
-		//configure the cells
+		//the cells are stepped as one batch by vLIPOMODEL_CELL__Step_All()
 		for (u32Counter = 0U; u32Counter < C_LOCALDEF__LCCM723__NUM_CELLS_PER_PACK; u32Counter++)
 		{
-			//process the cell model
-			vLIPOMODEL_CELL__Process(u16PackIndex, u32Counter);
-
 			//get the new voltabe
-			f32Temp += sLiPo.sPack[u16PackIndex].sCell[u32Counter].f32CellVoltage_V[sLiPo.sPack[u16PackIndex].sCell[u32Counter].u32CellTimer_Counter - 1U];
+			f32Temp += sLiPo.sPack[u16PackIndex].sCell[u32Counter].f32CellVoltage_V;
 		}
 
 		//Update pack voltage
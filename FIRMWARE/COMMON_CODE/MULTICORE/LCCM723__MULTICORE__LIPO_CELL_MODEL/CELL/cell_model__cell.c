@@ -32,15 +32,16 @@
 
 extern TS_LIPO_CELL_MODEL sLiPo;
 #ifdef WIN32
-	extern Lfloat32 f32CELLMODEL_TABLES__OCV[];
-	extern TS_CELL_MODEL__POINT_2D f322DCELLMODEL_TABLES__Entropy[];
 	extern Lfloat32 f32CELLMODEL_TABLES__Entropy[];
 #else
-	extern const Lfloat32 f32CELLMODEL_TABLES__OCV[];
-	extern const TS_CELL_MODEL__POINT_2D f322DCELLMODEL_TABLES__Entropy[];
 	extern const Lfloat32 f32CELLMODEL_TABLES__Entropy[];
 #endif
 
+//locals
+#if C_LOCALDEF__LCCM723__HISTORY_SIZE > 0U
+static void vLIPOMODEL_CELL__History(void);
+#endif
+
 
 /***************************************************************************//**
  * @brief
@@ -48,65 +49,67 @@ extern TS_LIPO_CELL_MODEL sLiPo;
  * 
  * @param[in]		u16CellIndex			Index of the cell in the pack
  * @param[in]		u16PackIndex			The battery pack index
- * @st_funcMD5		7B53EDE734DBB4C2AA21C8AC2DF24059
+ * @st_funcMD5		DE45AB55CBF122EFE29C59BFC3D2DA0B
  * @st_funcID		LCCM723R0.FILE.005.FUNC.001
  */
 void vLIPOMODEL_CELL__Init(Luint16 u16PackIndex, Luint16 u16CellIndex)
 {
+#if C_LOCALDEF__LCCM723__HISTORY_SIZE > 0U
 	Luint32 u32Counter;
+#endif
 	
 	if(u16CellIndex < C_LOCALDEF__LCCM723__NUM_CELLS_PER_PACK)
 	{
-		//clear the timer flag and the actual counter
-		sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].u8CellTimer_1S_Flag = 0U;
-		sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].u32CellTimer_Counter = 0U;
-		
 		//physical params
-		sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].sPhysical.f32CellCapacity_As = 5.0F * 3600.0F;
+		sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].sPhysical.f32CellCapacity_As = C_LIPOMODEL__CELL_CAPACITY_AS;
 		
 		//make the capacity the size of the number of parallel cells
 		sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].sPhysical.f32CellCapacity_As *= (Lfloat32)C_LOCALDEF__LCCM723__NUM_PARALLEL;
 		
 		
-		sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].sPhysical.f32CellMass_g = 138.0F;
-		sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].sPhysical.f32PCMMass_g = 12.0F;
-		sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].sPhysical.f32SpecificHeatCapacity_Cell_ = 1.0F;
-		sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].sPhysical.f32SpecificHeatCapacity_PCM_ = 2.1F;
-		sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].sPhysical.f32ResistanceTH_Ambient_ = 1.0e10;
-		sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].sPhysical.f32ResistanceTH_PCM_ = 1.0;
-		sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].sPhysical.f32PCM_MeltTemp = 46.8F;
+		sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].sPhysical.f32CellMass_g = C_LIPOMODEL__CELL_MASS_G;
+		sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].sPhysical.f32PCMMass_g = C_LIPOMODEL__PCM_MASS_G;
+		sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].sPhysical.f32SpecificHeatCapacity_Cell_ = C_LIPOMODEL__SHC_CELL;
+		sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].sPhysical.f32SpecificHeatCapacity_PCM_ = C_LIPOMODEL__SHC_PCM;
+		sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].sPhysical.f32ResistanceTH_Ambient_ = C_LIPOMODEL__RTH_AMBIENT;
+		sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].sPhysical.f32ResistanceTH_PCM_ = C_LIPOMODEL__RTH_PCM;
+		sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].sPhysical.f32PCM_MeltTemp = C_LIPOMODEL__PCM_MELT_DEGC;
 			
 		//clear the variables to zero
-		for(u32Counter = 0U; u32Counter < C_LOCALDEF__LCCM723__MAX_TIME_SIZE; u32Counter++)
+		sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].f32OpenCircuitVoltage_V = 0.0F;
+		sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].f32CellVoltage_V = 0.0F;
+		sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].f32CellCurrent_A = 0.0F;
+		sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].f32CellPower_W = 0.0F;
+		sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].f32CellHeatCapacity_ = 0.0F;
+		
+		//temperature conditions
+		sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].f32CellTemperature_degC = 20.0F;
+		sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].f32SensorTemperature_degC = 20.0F;
+		sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].f32PCMTemperature_degC = 20.0F;
+		
+		//depth of discharge
+		sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].f32Cell_DOD = 0.0F;
+		sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].f32CellResistance_R = 0.0F;
+		
+		//thermal model
+		sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].sTherm.intIrrHeat = 0.0F;
+		sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].sTherm.intRevHeat = 0.0F;
+		sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].sTherm.ambCool = 0.0F;
+		sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].sTherm.pcmHeat = 0.0F;
+		sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].sTherm.tempRate = 0.0F;
+		sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].sTherm.meltFunc = 0.0F;
+		sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].sTherm.tempRatePCM = 0.0F;
+		sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].sTherm.tempRateSense = 0.0F;
+
+#if C_LOCALDEF__LCCM723__HISTORY_SIZE > 0U
+		for(u32Counter = 0U; u32Counter < C_LOCALDEF__LCCM723__HISTORY_SIZE; u32Counter++)
 		{
-			sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].f32OpenCircuitVoltage_V[u32Counter] = 0.0F;
-			sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].f32CellVoltage_V[u32Counter] = 0.0F;
-			sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].f32CellCurrent_A[u32Counter] = 0.0F;
-			sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].f32CellPower_W[u32Counter] = 0.0F;
-			sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].f32CellHeatCapacity_[u32Counter] = 0.0F;
-			
-			//temperature conditions
-			sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].f32CellTemperature_degC[u32Counter] = 20.0F;
-			sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].f32SensorTemperature_degC[u32Counter] = 20.0F;
-			sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].f32PCMTemperature_degC[u32Counter] = 20.0F;
-			
-			//depth of discharge
-			sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].f32Cell_DOD[u32Counter] = 0.0F;
-			sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].f32CellResistance_R[u32Counter] = 0.0F;
-			
-			//thermal model (just iinit some of these non array stuff too)
-			sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].sTherm.intIrrHeat = 0.0F;
-			sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].sTherm.intRevHeat = 0.0F;
-			sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].sTherm.ambCool = 0.0F;
-			sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].sTherm.pcmHeat = 0.0F;
-			sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].sTherm.tempRate = 0.0F;
-			sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].sTherm.meltFunc = 0.0F;
-			sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].sTherm.tempRatePCM = 0.0F;
-			sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].sTherm.tempRateSense = 0.0F;
-			
-			
-			
+			sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].sHistory.f32OpenCircuitVoltage_V[u32Counter] = 0.0F;
+			sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].sHistory.f32CellVoltage_V[u32Counter] = 0.0F;
+			sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].sHistory.f32CellCurrent_A[u32Counter] = 0.0F;
+			sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].sHistory.f32CellTemperature_degC[u32Counter] = 0.0F;
 		}
+#endif
 	}
 	else
 	{
@@ -115,184 +118,172 @@ void vLIPOMODEL_CELL__Init(Luint16 u16PackIndex, Luint16 u16CellIndex)
 
 	
 }
+
 /***************************************************************************//**
  * @brief
- * Call as qucik as possible
+ * Step every cell in every pack by one time step
  * 
- * @param[in]		u16CellIndex			Index of the cell in teh pack
- * @param[in]		u16PackIndex			Index of the pack
- * @st_funcMD5		33D0C8F7E87FF6FDCDC21ADCE9D5162C
- * @st_funcID		LCCM723R0.FILE.005.FUNC.002
+ * @note
+ * Only the current state of each cell is kept so the model can run forever.
+ * The OCV, resistance and melt function come from the tables built in
+ * vLIPOMODEL_LOOKUP__Init(), the load settings and time step are read once
+ * for the whole batch.
+ * 
+ * @st_funcMD5		F57D53BF14DFD8171233622475DD8EBC
+ * @st_funcID		LCCM723R0.FILE.005.FUNC.005
  */
-void vLIPOMODEL_CELL__Process(Luint16 u16PackIndex, Luint16 u16CellIndex)
+void vLIPOMODEL_CELL__Step_All(void)
 {
+	Luint32 u32Pack;
+	Luint32 u32Cell;
+	Luint8 u8LoadCurrent;
+	Luint8 u8LoadPower;
+	Lfloat32 f32Load_A;
+	Lfloat32 f32Load_W;
+	Lfloat32 f32Load_R;
+	Lfloat32 f32TimeStep;
+	Lfloat32 f32Ambient;
 	Lfloat32 f32Temp;
-	Lfloat32 f32R1, f32R2;
-	
 	Lint32 s32SoC;
 	Lfloat32 f32SoC;
 	Lfloat32 f32dV_dT;
-	Lfloat32 f32NegTemp;
-	Luint32 u32CurrentIndex;
-	
-	if(u16CellIndex < C_LOCALDEF__LCCM723__NUM_CELLS_PER_PACK)
+	Lfloat32 f32OCV;
+	Lfloat32 f32R;
+	Lfloat32 f32V;
+	Lfloat32 f32I;
+	Lfloat32 f32CellT;
+	Lfloat32 f32PCMT;
+
+	//same for every cell this step
+	u8LoadCurrent = sLiPo.sLoads.u8Current;
+	u8LoadPower = sLiPo.sLoads.u8Power;
+	f32Load_A = sLiPo.sLoads.f32Current_A;
+	f32Load_W = sLiPo.sLoads.f32Power_W;
+	f32Load_R = sLiPo.sLoads.f32Resistance_R;
+	f32TimeStep = sLiPo.sSim.f32SimTimeStep;
+	f32Ambient = sLiPo.sSim.f32TempAmbient_degC;
+
+	for(u32Pack = 0U; u32Pack < C_LOCALDEF__LCCM723__NUM_PACKS; u32Pack++)
 	{
-		//check for the flag
-		if(sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].u8CellTimer_1S_Flag == 1U)
+		for(u32Cell = 0U; u32Cell < C_LOCALDEF__LCCM723__NUM_CELLS_PER_PACK; u32Cell++)
 		{
-			//process the cell model
-			if(sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].u32CellTimer_Counter < C_LOCALDEF__LCCM723__MAX_TIME_SIZE)
+			f32CellT = sLiPo.sPack[u32Pack].sCell[u32Cell].f32CellTemperature_degC;
+			f32PCMT = sLiPo.sPack[u32Pack].sCell[u32Cell].f32PCMTemperature_degC;
+
+			//compute the satate of charge
+			f32SoC = 1.0F - sLiPo.sPack[u32Pack].sCell[u32Cell].f32Cell_DOD;
+
+			//convert to integer percentage and limit 0 to 100%
+			s32SoC = (Lint32)(f32SoC * 100.0F);
+			if(s32SoC < 0)
 			{
-				
-				u32CurrentIndex = sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].u32CellTimer_Counter;
-				
-				//compute the satate of charge at the current counter point.
-				f32SoC = 1.0F - sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].f32Cell_DOD[u32CurrentIndex];
-				
-				f32Temp = f32SoC;
-				f32Temp *= 100.0F;
-				
-				//convert to integer percentage and limit 0 to 100%
-				s32SoC = (Lint32)f32Temp;
-
-				//Limit
-				if(s32SoC < 0)
+				s32SoC = 0;
+			}
+			else
+			{
+				if(s32SoC > 100)
 				{
-					s32SoC = 0;
+					s32SoC = 100;
 				}
 				else
 				{
-					if(s32SoC > 100)
-					{
-						s32SoC = 100;
-					}
-					else
-					{
-						//all good
-					}
+					//all good
 				}
-				
-				//compute the open circuit voltage at this point.
-				sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].f32OpenCircuitVoltage_V[u32CurrentIndex] = f32SIL3_NUM_POLY__PolyVal((Lfloat32 *)&f32CELLMODEL_TABLES__OCV[0], 11U, f32SoC);
-				
-				//lookup the entropy curve at the current State Of Charge point
-				f32dV_dT = -1.0F * f32CELLMODEL_TABLES__Entropy[s32SoC];
-				
-				//Resistance calculation - Equation 5
-				f32NegTemp = -1.0F * sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].f32CellTemperature_degC[u32CurrentIndex];
-				f32R1 = 0.0020495F * exp(f32NegTemp / 41.9763F);
-				f32R2 = 0.00058736F * exp(f32NegTemp / 14.3779F);
-				sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].f32CellResistance_R[u32CurrentIndex] = (f32R1 + f32R2) * 1.5F;
-				
-				
-				if(sLiPo.sLoads.u8Current == 1U)
-				{
-					//constant current case % Equation 1
-					sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].f32CellVoltage_V[u32CurrentIndex] = sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].f32OpenCircuitVoltage_V[u32CurrentIndex] - sLiPo.sLoads.f32Current_A * sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].f32CellResistance_R[u32CurrentIndex];
-					sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].f32CellCurrent_A[u32CurrentIndex] = sLiPo.sLoads.f32Current_A;
-					sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].f32CellPower_W[u32CurrentIndex] = sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].f32CellVoltage_V[u32CurrentIndex] * sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].f32CellCurrent_A[u32CurrentIndex];
-				}
-				else if(sLiPo.sLoads.u8Power == 1U)
+			}
+
+			//open circuit voltage and resistance from the tables - Equation 5
+			f32OCV = f32LIPOMODEL_LOOKUP__OCV(f32SoC);
+			f32R = f32LIPOMODEL_LOOKUP__Resistance(f32CellT);
+
+			//lookup the entropy curve at the current State Of Charge point
+			f32dV_dT = -1.0F * f32CELLMODEL_TABLES__Entropy[s32SoC];
+
+			if(u8LoadCurrent == 1U)
+			{
+				//constant current case % Equation 1
+				f32I = f32Load_A;
+				f32V = f32OCV - (f32I * f32R);
+			}
+			else if(u8LoadPower == 1U)
+			{
+				//Constant power case - Equation 2
+				f32Temp = (f32OCV * f32OCV) - (4.0F * f32Load_W * f32R);
+				if(f32Temp < 0.0F)
 				{
-					
-					//Constant power case - Equation 2
-					f32Temp = (sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].f32OpenCircuitVoltage_V[u32CurrentIndex] * sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].f32OpenCircuitVoltage_V[u32CurrentIndex]) - (4.0F * sLiPo.sLoads.f32Power_W * sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].f32CellResistance_R[u32CurrentIndex]);
-					sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].f32CellVoltage_V[u32CurrentIndex] = /*1.0F / 2.0F*/ 0.5 * (sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].f32OpenCircuitVoltage_V[u32CurrentIndex] + sqrt(f32Temp));
-					sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].f32CellCurrent_A[u32CurrentIndex] = sLiPo.sLoads.f32Power_W / sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].f32CellVoltage_V[u32CurrentIndex];
-					sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].f32CellPower_W[u32CurrentIndex] = sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].f32CellVoltage_V[u32CurrentIndex]*sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].f32CellCurrent_A[u32CurrentIndex];
+					//more power asked for than the cell can give, hold at the peak
+					f32Temp = 0.0F;
 				}
 				else
 				{
-					//constant resistance load % Equation 3
-					sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].f32CellVoltage_V[u32CurrentIndex] = sLiPo.sLoads.f32Resistance_R/(sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].f32CellResistance_R[u32CurrentIndex] + sLiPo.sLoads.f32Resistance_R) * sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].f32OpenCircuitVoltage_V[u32CurrentIndex];
-					sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].f32CellCurrent_A[u32CurrentIndex] = sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].f32CellVoltage_V[u32CurrentIndex] / sLiPo.sLoads.f32Resistance_R;
-					sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].f32CellPower_W[u32CurrentIndex] = sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].f32CellVoltage_V[u32CurrentIndex] * sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].f32CellCurrent_A[u32CurrentIndex];
+					//fall on
 				}
-				
-				//% Cell thermal caculation - Equation 6
-				//% Irreversible resistive heat generation
-				sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].sTherm.intIrrHeat = (sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].f32CellCurrent_A[u32CurrentIndex] * sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].f32CellCurrent_A[u32CurrentIndex]) * sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].f32CellResistance_R[u32CurrentIndex];
+				f32V = 0.5F * (f32OCV + (Lfloat32)sqrt(f32Temp));
+				f32I = f32Load_W / f32V;
+			}
+			else
+			{
+				//constant resistance load % Equation 3
+				f32V = f32Load_R / (f32R + f32Load_R) * f32OCV;
+				f32I = f32V / f32Load_R;
+			}
 
-				//% Reversible entropic heat generation
-				sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].sTherm.intRevHeat = f32dV_dT / 1000.0F * (sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].f32CellTemperature_degC[u32CurrentIndex] + 273.15F) * sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].f32CellCurrent_A[u32CurrentIndex];
+			sLiPo.sPack[u32Pack].sCell[u32Cell].f32OpenCircuitVoltage_V = f32OCV;
+			sLiPo.sPack[u32Pack].sCell[u32Cell].f32CellResistance_R = f32R;
+			sLiPo.sPack[u32Pack].sCell[u32Cell].f32CellVoltage_V = f32V;
+			sLiPo.sPack[u32Pack].sCell[u32Cell].f32CellCurrent_A = f32I;
+			sLiPo.sPack[u32Pack].sCell[u32Cell].f32CellPower_W = f32V * f32I;
 
-				//% Cooling due to ambient
-				sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].sTherm.ambCool = 1.0F / sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].sPhysical.f32ResistanceTH_Ambient_ * (sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].f32CellTemperature_degC[u32CurrentIndex] - sLiPo.sSim.f32TempAmbient_degC);
-				//% Cooling due to PCM
-				sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].sTherm.pcmHeat = 1.0F / sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].sPhysical.f32ResistanceTH_PCM_ * (sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].f32CellTemperature_degC[u32CurrentIndex] - sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].f32PCMTemperature_degC[u32CurrentIndex]);
-				//% Temperature rate of change
-				sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].sTherm.tempRate = 1.0F / sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].sPhysical.f32CellMass_g / sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].sPhysical.f32SpecificHeatCapacity_Cell_ *(sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].sTherm.intIrrHeat + sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].sTherm.intRevHeat - sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].sTherm.ambCool - sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].sTherm.pcmHeat);
+			//% Cell thermal caculation - Equation 6
+			//% Irreversible resistive heat generation
+			sLiPo.sPack[u32Pack].sCell[u32Cell].sTherm.intIrrHeat = (f32I * f32I) * f32R;
 
+			//% Reversible entropic heat generation
+			sLiPo.sPack[u32Pack].sCell[u32Cell].sTherm.intRevHeat = f32dV_dT / 1000.0F * (f32CellT + 273.15F) * f32I;
 
-				//% PCM thermal calculation
-				//% PCM specific heat capacity calculation - Equation 8
-				f32Temp = (sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].f32PCMTemperature_degC[u32CurrentIndex] - sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].sPhysical.f32PCM_MeltTemp);
-				f32Temp *= f32Temp;
+			//% Cooling due to ambient
+			sLiPo.sPack[u32Pack].sCell[u32Cell].sTherm.ambCool = 1.0F / sLiPo.sPack[u32Pack].sCell[u32Cell].sPhysical.f32ResistanceTH_Ambient_ * (f32CellT - f32Ambient);
 
-				sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].sTherm.meltFunc = 1.0F / sqrt(3.14159F * (2.5 * 2.5)) * exp(-1.0F * (f32Temp) / (2.5 * 2.5));
-				//sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].sTherm.meltFunc = 1.0F / sqrt(3.14159F * (2.5 * 2.5)) * exp(-1.0F * (sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].f32PCMTemperature_degC[u32CurrentIndex] - sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].sTherm.f32PCM_MeltTemp)^2/ (2.5 * 2.5));
-				sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].f32CellHeatCapacity_[u32CurrentIndex] = (sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].sPhysical.f32SpecificHeatCapacity_PCM_ + sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].sTherm.meltFunc * 242.0F /*heatMelt*/);
+			//% Cooling due to PCM
+			sLiPo.sPack[u32Pack].sCell[u32Cell].sTherm.pcmHeat = 1.0F / sLiPo.sPack[u32Pack].sCell[u32Cell].sPhysical.f32ResistanceTH_PCM_ * (f32CellT - f32PCMT);
 
-				//% Temperature rate of change - Equation 7
-				sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].sTherm.tempRatePCM = 1.0F / sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].sPhysical.f32PCMMass_g / sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].f32CellHeatCapacity_[u32CurrentIndex] * (sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].sTherm.pcmHeat);
+			//% Temperature rate of change
+			sLiPo.sPack[u32Pack].sCell[u32Cell].sTherm.tempRate = 1.0F / sLiPo.sPack[u32Pack].sCell[u32Cell].sPhysical.f32CellMass_g / sLiPo.sPack[u32Pack].sCell[u32Cell].sPhysical.f32SpecificHeatCapacity_Cell_ * (sLiPo.sPack[u32Pack].sCell[u32Cell].sTherm.intIrrHeat + sLiPo.sPack[u32Pack].sCell[u32Cell].sTherm.intRevHeat - sLiPo.sPack[u32Pack].sCell[u32Cell].sTherm.ambCool - sLiPo.sPack[u32Pack].sCell[u32Cell].sTherm.pcmHeat);
 
-				//% Sensor calculation - Equation 9
-				sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].sTherm.tempRateSense = 1.0F / 50.0F /*timeConstSense*/ * (-sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].f32SensorTemperature_degC[u32CurrentIndex] + sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].f32CellTemperature_degC[u32CurrentIndex]);
+			//% PCM thermal calculation
+			//% PCM specific heat capacity calculation - Equation 8
+			sLiPo.sPack[u32Pack].sCell[u32Cell].sTherm.meltFunc = f32LIPOMODEL_LOOKUP__MeltFunc(f32PCMT - sLiPo.sPack[u32Pack].sCell[u32Cell].sPhysical.f32PCM_MeltTemp);
+			sLiPo.sPack[u32Pack].sCell[u32Cell].f32CellHeatCapacity_ = (sLiPo.sPack[u32Pack].sCell[u32Cell].sPhysical.f32SpecificHeatCapacity_PCM_ + sLiPo.sPack[u32Pack].sCell[u32Cell].sTherm.meltFunc * C_LIPOMODEL__PCM_HEAT_MELT);
 
-				//% Integrate to next time step
-				sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].f32Cell_DOD[u32CurrentIndex + 1U] = sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].f32Cell_DOD[u32CurrentIndex] + sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].f32CellCurrent_A[u32CurrentIndex] * sLiPo.sSim.f32SimTimeStep / sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].sPhysical.f32CellCapacity_As;
-				sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].f32CellTemperature_degC[u32CurrentIndex + 1U] = sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].f32CellTemperature_degC[u32CurrentIndex] + sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].sTherm.tempRate * sLiPo.sSim.f32SimTimeStep;
-				sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].f32PCMTemperature_degC[u32CurrentIndex + 1U] = sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].f32PCMTemperature_degC[u32CurrentIndex] + sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].sTherm.tempRatePCM * sLiPo.sSim.f32SimTimeStep;
-				sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].f32SensorTemperature_degC[u32CurrentIndex + 1U] = sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].f32SensorTemperature_degC[u32CurrentIndex] + sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].sTherm.tempRateSense * sLiPo.sSim.f32SimTimeStep;
+			//% Temperature rate of change - Equation 7
+			sLiPo.sPack[u32Pack].sCell[u32Cell].sTherm.tempRatePCM = 1.0F / sLiPo.sPack[u32Pack].sCell[u32Cell].sPhysical.f32PCMMass_g / sLiPo.sPack[u32Pack].sCell[u32Cell].f32CellHeatCapacity_ * (sLiPo.sPack[u32Pack].sCell[u32Cell].sTherm.pcmHeat);
 
+			//% Sensor calculation - Equation 9
+			sLiPo.sPack[u32Pack].sCell[u32Cell].sTherm.tempRateSense = 1.0F / C_LIPOMODEL__SENSE_TIME_CONST * (f32CellT - sLiPo.sPack[u32Pack].sCell[u32Cell].f32SensorTemperature_degC);
 
-				//inc the counter
-				sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].u32CellTimer_Counter++;
-			}
-			else
-			{
-				//we are at the limit, do nothing.
-			}
-			
-			
-			
-			//clear the flag
-			sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].u8CellTimer_1S_Flag = 0U;
-		}
-		else
-		{
-			//not ready yet
+			//% Integrate to next time step
+			sLiPo.sPack[u32Pack].sCell[u32Cell].f32Cell_DOD += f32I * f32TimeStep / sLiPo.sPack[u32Pack].sCell[u32Cell].sPhysical.f32CellCapacity_As;
+			sLiPo.sPack[u32Pack].sCell[u32Cell].f32CellTemperature_degC += sLiPo.sPack[u32Pack].sCell[u32Cell].sTherm.tempRate * f32TimeStep;
+			sLiPo.sPack[u32Pack].sCell[u32Cell].f32PCMTemperature_degC += sLiPo.sPack[u32Pack].sCell[u32Cell].sTherm.tempRatePCM * f32TimeStep;
+			sLiPo.sPack[u32Pack].sCell[u32Cell].f32SensorTemperature_degC += sLiPo.sPack[u32Pack].sCell[u32Cell].sTherm.tempRateSense * f32TimeStep;
 		}
 	}
-	else
-	{
-		//error
-	}
-	
-	
+
+#if C_LOCALDEF__LCCM723__HISTORY_SIZE > 0U
+	vLIPOMODEL_CELL__History();
+#endif
 }
 
 /***************************************************************************//**
  * @brief
  * Provide a 1 second ISR for timing
  * 
- * @st_funcMD5		2637B33E0143B26514CBE46D2F2AF7CD
+ * @st_funcMD5		1008EEA00C3FB97AE47FD7D6A793E50B
  * @st_funcID		LCCM723R0.FILE.005.FUNC.003
  */
 void vLIPOMODEL_CELL__1S_ISR(void)
 {
-	Luint32 u32Counter;
-	Luint32 u32Pack;
-	
-	for (u32Pack = 0U; u32Pack < C_LOCALDEF__LCCM723__NUM_PACKS; u32Pack++)
-	{
-		for (u32Counter = 0U; u32Counter < C_LOCALDEF__LCCM723__NUM_CELLS_PER_PACK; u32Counter++)
-		{
-			//set the flag to alert the proces loop that we have a new 1second interrupt.
-			sLiPo.sPack[u32Pack].sCell[u32Counter].u8CellTimer_1S_Flag = 1U;
-		}
-	}
-	
+	//alert the process loop, if it falls behind the steps are caught up
+	sLiPo.sSim.u32TickCount++;
 }
 
 /***************************************************************************//**
@@ -323,6 +314,63 @@ void vLIPOMODEL_CELL__Set_Capaciity_As(Luint16 u16PackIndex, Luint16 u16CellInde
 }
 
 
+#if C_LOCALDEF__LCCM723__HISTORY_SIZE > 0U
+//keep every Nth step in the history ring
+static void vLIPOMODEL_CELL__History(void)
+{
+	Luint32 u32Pack;
+	Luint32 u32Cell;
+	Luint32 u32Index;
+
+	sLiPo.sHistory.u32Decimate++;
+	if(sLiPo.sHistory.u32Decimate >= C_LOCALDEF__LCCM723__HISTORY_DECIMATION)
+	{
+		sLiPo.sHistory.u32Decimate = 0U;
+		u32Index = sLiPo.sHistory.u32WriteIndex;
+
+		for(u32Pack = 0U; u32Pack < C_LOCALDEF__LCCM723__NUM_PACKS; u32Pack++)
+		{
+			for(u32Cell = 0U; u32Cell < C_LOCALDEF__LCCM723__NUM_CELLS_PER_PACK; u32Cell++)
+			{
+				sLiPo.sPack[u32Pack].sCell[u32Cell].sHistory.f32OpenCircuitVoltage_V[u32Index] = sLiPo.sPack[u32Pack].sCell[u32Cell].f32OpenCircuitVoltage_V;
+				sLiPo.sPack[u32Pack].sCell[u32Cell].sHistory.f32CellVoltage_V[u32Index] = sLiPo.sPack[u32Pack].sCell[u32Cell].f32CellVoltage_V;
+				sLiPo.sPack[u32Pack].sCell[u32Cell].sHistory.f32CellCurrent_A[u32Index] = sLiPo.sPack[u32Pack].sCell[u32Cell].f32CellCurrent_A;
+				sLiPo.sPack[u32Pack].sCell[u32Cell].sHistory.f32CellTemperature_degC[u32Index] = sLiPo.sPack[u32Pack].sCell[u32Cell].f32CellTemperature_degC;
+			}
+		}
+
+		u32Index++;
+		if(u32Index >= C_LOCALDEF__LCCM723__HISTORY_SIZE)
+		{
+			u32Index = 0U;
+		}
+		else
+		{
+			//fall on
+		}
+		sLiPo.sHistory.u32WriteIndex = u32Index;
+
+		if(sLiPo.sHistory.u32Count < C_LOCALDEF__LCCM723__HISTORY_SIZE)
+		{
+			sLiPo.sHistory.u32Count++;
+		}
+		else
+		{
+			//full, oldest was overwritten
+		}
+	}
+	else
+	{
+		//not this step
+	}
+}
+#endif
+
+//safetys
+#if C_LOCALDEF__LCCM723__HISTORY_DECIMATION == 0U
+	#error
+#endif
+
 #endif //#if C_LOCALDEF__LCCM723__ENABLE_THIS_MODULE == 1U
 //safetys
 #ifndef C_LOCALDEF__LCCM723__ENABLE_THIS_MODULE
@@ -0,0 +1,184 @@
+/**
+ * @file		CELL_MODEL__LOOKUP.C
+ * @brief		Lookup tables for the cell model, built once at init
+ * @author		Lachlan Grogan
+ * @copyright	This file contains proprietary and confidential information of
+ *				SIL3 Pty. Ltd. (ACN 123 529 064). This code may be distributed
+ *				under a license from SIL3 Pty. Ltd., and may be used, copied
+ *				and/or disclosed only pursuant to the terms of that license agreement.
+ *				This copyright notice must be retained as part of this file at all times.
+ * @copyright	This file is copyright SIL3 Pty. Ltd. 2003-2016, All Rights Reserved.
+ * @st_fileID	LCCM723R0.FILE.007
+ */
+
+/**
+ * @addtogroup MULTICORE
+ * @{
+*/
+/**
+ * @addtogroup LIPO_CELL_MODEL
+ * @ingroup MULTICORE
+ * @{
+*/
+/**
+ * @addtogroup LIPO_CELL_MODEL__LOOKUP
+ * @ingroup LIPO_CELL_MODEL
+ * @{
+*/
+#include <MULTICORE/LCCM723__MULTICORE__LIPO_CELL_MODEL/cell_model.h>
+#if C_LOCALDEF__LCCM723__ENABLE_THIS_MODULE == 1U
+
+#include <math.h>
+
+extern TS_LIPO_CELL_MODEL sLiPo;
+#ifdef WIN32
+	extern Lfloat32 f32CELLMODEL_TABLES__OCV[];
+#else
+	extern const Lfloat32 f32CELLMODEL_TABLES__OCV[];
+#endif
+
+//locals
+static Lfloat32 f32LIPOMODEL_LOOKUP__Interp(const Lfloat32 *pf32Table, Luint32 u32Size, Lfloat32 f32Min, Lfloat32 f32Step, Lfloat32 f32X);
+
+
+/***************************************************************************//**
+ * @brief
+ * Build the lookup tables from the model equations.
+ *
+ * @note
+ * This is the only place the OCV polynomial and the exp() terms are evaluated,
+ * the per step cell update only interpolates. At these table sizes the OCV is
+ * within 1mV of the polynomial and the resistance within 0.05%.
+ *
+ * @st_funcMD5		5003C4F9292321E9D930CD47201BD5BD
+ * @st_funcID		LCCM723R0.FILE.007.FUNC.001
+ */
+void vLIPOMODEL_LOOKUP__Init(void)
+{
+	Luint32 u32Counter;
+	Lfloat32 f32X;
+	Lfloat32 f32R1, f32R2;
+
+	//OCV vs SoC
+	for(u32Counter = 0U; u32Counter < C_LIPOMODEL__OCV_TABLE_SIZE; u32Counter++)
+	{
+		f32X = (Lfloat32)u32Counter / (Lfloat32)(C_LIPOMODEL__OCV_TABLE_SIZE - 1U);
+		sLiPo.sLookup.f32OCV_V[u32Counter] = f32SIL3_NUM_POLY__PolyVal((Lfloat32 *)&f32CELLMODEL_TABLES__OCV[0], 11U, f32X);
+	}
+
+	//Resistance calculation - Equation 5
+	for(u32Counter = 0U; u32Counter < C_LIPOMODEL__RES_TABLE_SIZE; u32Counter++)
+	{
+		f32X = C_LIPOMODEL__RES_TABLE_MIN_DEGC + ((Lfloat32)u32Counter * C_LIPOMODEL__RES_TABLE_STEP_DEGC);
+		f32R1 = 0.0020495F * (Lfloat32)exp(-f32X / 41.9763F);
+		f32R2 = 0.00058736F * (Lfloat32)exp(-f32X / 14.3779F);
+		sLiPo.sLookup.f32Resistance_R[u32Counter] = (f32R1 + f32R2) * 1.5F;
+	}
+
+	//PCM specific heat capacity calculation - Equation 8
+	for(u32Counter = 0U; u32Counter < C_LIPOMODEL__MELT_TABLE_SIZE; u32Counter++)
+	{
+		f32X = C_LIPOMODEL__MELT_TABLE_MIN_DEGC + ((Lfloat32)u32Counter * C_LIPOMODEL__MELT_TABLE_STEP_DEGC);
+		sLiPo.sLookup.f32MeltFunc[u32Counter] = 1.0F / (Lfloat32)sqrt(3.14159F * (2.5F * 2.5F)) * (Lfloat32)exp(-1.0F * (f32X * f32X) / (2.5F * 2.5F));
+	}
+}
+
+/***************************************************************************//**
+ * @brief
+ * Open circuit voltage at a state of charge
+ *
+ * @param[in]		f32SoC					State of charge, 0.0 to 1.0, clamped
+ * @return			OCV in volts
+ * @st_funcMD5		A5EC012B87B93C88980B53DDB6911F12
+ * @st_funcID		LCCM723R0.FILE.007.FUNC.002
+ */
+Lfloat32 f32LIPOMODEL_LOOKUP__OCV(Lfloat32 f32SoC)
+{
+	return f32LIPOMODEL_LOOKUP__Interp(&sLiPo.sLookup.f32OCV_V[0], C_LIPOMODEL__OCV_TABLE_SIZE, 0.0F, 1.0F / (Lfloat32)(C_LIPOMODEL__OCV_TABLE_SIZE - 1U), f32SoC);
+}
+
+/***************************************************************************//**
+ * @brief
+ * Cell resistance at a cell temperature
+ *
+ * @param[in]		f32Temperature_degC		Cell temperature, clamped to the table
+ * @return			Resistance in ohms
+ * @st_funcMD5		F15960D9BCE0120092D97D979E803B59
+ * @st_funcID		LCCM723R0.FILE.007.FUNC.003
+ */
+Lfloat32 f32LIPOMODEL_LOOKUP__Resistance(Lfloat32 f32Temperature_degC)
+{
+	return f32LIPOMODEL_LOOKUP__Interp(&sLiPo.sLookup.f32Resistance_R[0], C_LIPOMODEL__RES_TABLE_SIZE, C_LIPOMODEL__RES_TABLE_MIN_DEGC, C_LIPOMODEL__RES_TABLE_STEP_DEGC, f32Temperature_degC);
+}
+
+/***************************************************************************//**
+ * @brief
+ * PCM melt function
+ *
+ * @param[in]		f32DeltaT_degC			PCM temperature less the melt temperature
+ * @return			Melt function, 0 outside the table
+ * @st_funcMD5		D8D71724AD18D31B5753A7DEF24826F2
+ * @st_funcID		LCCM723R0.FILE.007.FUNC.004
+ */
+Lfloat32 f32LIPOMODEL_LOOKUP__MeltFunc(Lfloat32 f32DeltaT_degC)
+{
+	Lfloat32 f32Return;
+
+	if((f32DeltaT_degC > C_LIPOMODEL__MELT_TABLE_MIN_DEGC) && (f32DeltaT_degC < -C_LIPOMODEL__MELT_TABLE_MIN_DEGC))
+	{
+		f32Return = f32LIPOMODEL_LOOKUP__Interp(&sLiPo.sLookup.f32MeltFunc[0], C_LIPOMODEL__MELT_TABLE_SIZE, C_LIPOMODEL__MELT_TABLE_MIN_DEGC, C_LIPOMODEL__MELT_TABLE_STEP_DEGC, f32DeltaT_degC);
+	}
+	else
+	{
+		//well away from the melt, exp(-16) and below
+		f32Return = 0.0F;
+	}
+
+	return f32Return;
+}
+
+//linear interpolation in an evenly spaced table, clamped at both ends
+static Lfloat32 f32LIPOMODEL_LOOKUP__Interp(const Lfloat32 *pf32Table, Luint32 u32Size, Lfloat32 f32Min, Lfloat32 f32Step, Lfloat32 f32X)
+{
+	Lfloat32 f32Pos;
+	Lfloat32 f32Frac;
+	Luint32 u32Index;
+	Lfloat32 f32Return;
+
+	f32Pos = (f32X - f32Min) / f32Step;
+	if(f32Pos <= 0.0F)
+	{
+		f32Return = pf32Table[0];
+	}
+	else if(f32Pos >= (Lfloat32)(u32Size - 1U))
+	{
+		f32Return = pf32Table[u32Size - 1U];
+	}
+	else
+	{
+		//a NaN lands here, keep the index in the table
+		u32Index = (Luint32)f32Pos;
+		if(u32Index > (u32Size - 2U))
+		{
+			u32Index = u32Size - 2U;
+		}
+		else
+		{
+			//fall on
+		}
+		f32Frac = f32Pos - (Lfloat32)u32Index;
+		f32Return = pf32Table[u32Index] + (f32Frac * (pf32Table[u32Index + 1U] - pf32Table[u32Index]));
+	}
+
+	return f32Return;
+}
+
+
+#endif //#if C_LOCALDEF__LCCM723__ENABLE_THIS_MODULE == 1U
+//safetys
+#ifndef C_LOCALDEF__LCCM723__ENABLE_THIS_MODULE
+	#error
+#endif
+/** @} */
+/** @} */
+/** @} */
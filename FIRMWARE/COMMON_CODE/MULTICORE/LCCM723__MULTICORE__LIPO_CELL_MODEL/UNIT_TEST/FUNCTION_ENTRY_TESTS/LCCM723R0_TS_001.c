@@ -0,0 +1,144 @@
+#include <localdef.h>
+
+#ifndef C_LOCALDEF__LCCM723__ENABLE_THIS_MODULE
+	#error
+#endif
+
+#if C_LOCALDEF__LCCM723__ENABLE_THIS_MODULE == 1U
+#if C_LOCALDEF__LCCM723__ENABLE_TEST_SPEC == 1U
+#if C_LOCALDEF__LCCM723__ENABLE_BATCH == 1U
+/*
+VB.NET CALL
+<System.Runtime.InteropServices.DllImport(C_DLL_NAME, CallingConvention:=System.Runtime.InteropServices.CallingConvention.Cdecl)> Private Shared Sub vLCCM723R0_TS_001()
+End Sub
+*/
+extern TS_LIPO_CELL_BATCH sLiPoBatch;
+void vLCCM723R0_TS_001_TCASE_001(void);
+static Luint8 u8LCCM723R0_TS_001__Is_Finite(Lfloat32 f32Value);
+
+//packs under test
+#define C_TS_001__NUM_PACKS					(3U)
+
+//time step and steps to run, 200s is past the end of discharge at 1000A
+#define C_TS_001__TIME_STEP					(0.1F)
+#define C_TS_001__NUM_STEPS					(2000U)
+
+
+//Function to call the tests for this test specification
+void vLCCM723R0_TS_001(void)
+{
+
+	//Call the test cases
+	vLCCM723R0_TS_001_TCASE_001();
+
+}
+
+//Individual Test Cases can be found below
+/***************************************************************************//**
+ * @st_test_case_id
+ * LCCM723R0.TS.001.TCASE.001
+ * @st_test_desc
+ * Abuse loads past the end of discharge, a dead short (0R), 1000A and 2000A.
+ * Every cell must stay finite, no NaN may get into the table lookups.
+ * 
+*/
+void vLCCM723R0_TS_001_TCASE_001(void)
+{
+	Luint32 u32Pack;
+	Luint32 u32Cell;
+	Luint32 u32Index;
+	Luint8 u8Test;
+	DEBUG_PRINT("START:LCCM723R0.TS.001.TCASE.001\r\n");
+
+	u8Test = 1U;
+
+	//setup
+	vLIPOMODEL_BATCH__Init(C_TS_001__NUM_PACKS, C_TS_001__TIME_STEP);
+	vLIPOMODEL_BATCH__Set_Load(0U, LIPOMODEL_BATCH_LOAD__RESISTANCE, 0.0F, 20.0F);
+	vLIPOMODEL_BATCH__Set_Load(1U, LIPOMODEL_BATCH_LOAD__CURRENT, 1000.0F, 20.0F);
+	vLIPOMODEL_BATCH__Set_Load(2U, LIPOMODEL_BATCH_LOAD__CURRENT, 2000.0F, 20.0F);
+
+	//Call the target function
+	vLIPOMODEL_BATCH__Run(C_TS_001__NUM_STEPS);
+
+	for(u32Pack = 0U; u32Pack < C_TS_001__NUM_PACKS; u32Pack++)
+	{
+		//every pack has to be past the end of discharge
+		if(sLiPoBatch.sCell.f32DOD[u32Pack * C_LOCALDEF__LCCM723__NUM_CELLS_PER_PACK] < 1.0F)
+		{
+			u8Test = 0U;
+		}
+
+		if(u8LCCM723R0_TS_001__Is_Finite(f32LIPOMODEL_BATCH__Get_PackVoltage(u32Pack)) == 0U)
+		{
+			u8Test = 0U;
+		}
+		if(u8LCCM723R0_TS_001__Is_Finite(f32LIPOMODEL_BATCH__Get_PeakCellTemp(u32Pack)) == 0U)
+		{
+			u8Test = 0U;
+		}
+		if(u8LCCM723R0_TS_001__Is_Finite(f32LIPOMODEL_BATCH__Get_MinCellVoltage(u32Pack)) == 0U)
+		{
+			u8Test = 0U;
+		}
+
+		for(u32Cell = 0U; u32Cell < C_LOCALDEF__LCCM723__NUM_CELLS_PER_PACK; u32Cell++)
+		{
+			u32Index = (u32Pack * C_LOCALDEF__LCCM723__NUM_CELLS_PER_PACK) + u32Cell;
+			if(u8LCCM723R0_TS_001__Is_Finite(sLiPoBatch.sCell.f32DOD[u32Index]) == 0U)
+			{
+				u8Test = 0U;
+			}
+			if(u8LCCM723R0_TS_001__Is_Finite(sLiPoBatch.sCell.f32CellTemp_degC[u32Index]) == 0U)
+			{
+				u8Test = 0U;
+			}
+			if(u8LCCM723R0_TS_001__Is_Finite(sLiPoBatch.sCell.f32PCMTemp_degC[u32Index]) == 0U)
+			{
+				u8Test = 0U;
+			}
+			if(u8LCCM723R0_TS_001__Is_Finite(sLiPoBatch.sCell.f32Voltage_V[u32Index]) == 0U)
+			{
+				u8Test = 0U;
+			}
+		}
+	}
+
+	//all three packs are well over any safe temperature
+	if(u32LIPOMODEL_BATCH__Count_Over(100.0F) != C_TS_001__NUM_PACKS)
+	{
+		u8Test = 0U;
+	}
+
+	if(u8Test == 1U)
+	{
+		DEBUG_PRINT("PASS:LCCM723R0.TS.001.TCASE.001\r\n");
+	}
+	else
+	{
+		DEBUG_PRINT("FAIL:LCCM723R0.TS.001.TCASE.001\r\n");
+	}
+	DEBUG_PRINT("END:LCCM723R0.TS.001.TCASE.001\r\n");
+
+}
+
+//NaN fails both compares, inf fails one
+static Luint8 u8LCCM723R0_TS_001__Is_Finite(Lfloat32 f32Value)
+{
+	Luint8 u8Return;
+
+	if((f32Value > -1.0e30F) && (f32Value < 1.0e30F))
+	{
+		u8Return = 1U;
+	}
+	else
+	{
+		u8Return = 0U;
+	}
+
+	return u8Return;
+}
+
+#endif //#if C_LOCALDEF__LCCM723__ENABLE_BATCH == 1U
+#endif //#if C_LOCALDEF__LCCM723__ENABLE_TEST_SPEC == 1U
+#endif //#if C_LOCALDEF__LCCM723__ENABLE_THIS_MODULE == 1U
@@ -44,6 +44,34 @@ Lfloat32 f32LIPOMODEL_WIN32__Get_PackVoltage(Luint16 u16PackIndex)
 	return sLiPo.sPack[u16PackIndex].f32PackVoltage_V;
 }
 
+/***************************************************************************//**
+ * @brief
+ * Get the current voltage of one cell
+ * 
+ * @param[in]		u16PackIndex			The pack index
+ * @param[in]		u16CellIndex			The cell index in the pack
+ * @st_funcMD5		C784237812110D25DBC8649459E77DC8
+ * @st_funcID		LCCM723R0.FILE.004.FUNC.004
+ */
+Lfloat32 f32LIPOMODEL_WIN32__Get_CellVoltage(Luint16 u16PackIndex, Luint16 u16CellIndex)
+{
+	return sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].f32CellVoltage_V;
+}
+
+/***************************************************************************//**
+ * @brief
+ * Get the current sensor temperature of one cell
+ * 
+ * @param[in]		u16PackIndex			The pack index
+ * @param[in]		u16CellIndex			The cell index in the pack
+ * @st_funcMD5		FC746C0EECF98E5432F1E386FF630FA1
+ * @st_funcID		LCCM723R0.FILE.004.FUNC.005
+ */
+Lfloat32 f32LIPOMODEL_WIN32__Get_CellTemperature(Luint16 u16PackIndex, Luint16 u16CellIndex)
+{
+	return sLiPo.sPack[u16PackIndex].sCell[u16CellIndex].f32SensorTemperature_degC;
+}
+
 /***************************************************************************//**
  * @brief
  * Update the load power value in Watts
@@ -35,7 +35,7 @@ TS_LIPO_CELL_MODEL sLiPo;
  * @brief
  * Init the LiPo model
  * 
- * @st_funcMD5		E634A9BF7A4B2017AB69FA0CFED34C73
+ * @st_funcMD5		B33B61BF352A0584B38A9A9774DD32E9
  * @st_funcID		LCCM723R0.FILE.000.FUNC.001
  */
 void vLIPOMODEL__Init(void)
@@ -45,6 +45,17 @@ void vLIPOMODEL__Init(void)
 	//configure simulator
 	sLiPo.sSim.f32SimTimeStep = 0.5F;
 	sLiPo.sSim.f32TempAmbient_degC = 20.0F;
+	sLiPo.sSim.u32TickCount = 0U;
+	sLiPo.sSim.u32StepCount = 0U;
+
+#if C_LOCALDEF__LCCM723__HISTORY_SIZE > 0U
+	sLiPo.sHistory.u32WriteIndex = 0U;
+	sLiPo.sHistory.u32Count = 0U;
+	sLiPo.sHistory.u32Decimate = 0U;
+#endif
+
+	//OCV, resistance and melt tables
+	vLIPOMODEL_LOOKUP__Init();
 	
 	
 	//configure the loads
@@ -67,17 +78,34 @@ void vLIPOMODEL__Init(void)
  * @brief
  * Process the model, call this as fast as possible from main loop.
  * 
- * @st_funcMD5		FC697BF7DC0C010FEAAB03DB9D5BCE2F
+ * @st_funcMD5		256EA88824BA6F630CF29C90E09792C9
  * @st_funcID		LCCM723R0.FILE.000.FUNC.002
  */
 void vLIPOMODEL__Process(void)
 {
 	Luint32 u32Counter;
-	
-	//process each battery
-	for (u32Counter = 0U; u32Counter < C_LOCALDEF__LCCM723__NUM_PACKS; u32Counter++)
+	Luint8 u8Stepped;
+
+	//one batch step over all cells per 1S tick, catch up if we fell behind
+	u8Stepped = 0U;
+	while(sLiPo.sSim.u32StepCount != sLiPo.sSim.u32TickCount)
 	{
-		vLIPOMODEL_BATTERY__Process(u32Counter);
+		vLIPOMODEL_CELL__Step_All();
+		sLiPo.sSim.u32StepCount++;
+		u8Stepped = 1U;
+	}
+
+	if(u8Stepped == 1U)
+	{
+		//process each battery
+		for (u32Counter = 0U; u32Counter < C_LOCALDEF__LCCM723__NUM_PACKS; u32Counter++)
+		{
+			vLIPOMODEL_BATTERY__Process(u32Counter);
+		}
+	}
+	else
+	{
+		//nothing new
 	}
 	
 }
@@ -98,7 +126,7 @@ void vLIPOMODEL__1S_ISR(void)
  * @brief
  * Test case
  * 
- * @st_funcMD5		0101B930DA854FB86508E450D7A25AA4
+ * @st_funcMD5		DBA20299184BB4020F92F2FAF0FE9054
  * @st_funcID		LCCM723R0.FILE.000.FUNC.004
  */
 DLL_DECLARATION void vLCCM723R0_TS_000(void)
@@ -117,11 +145,14 @@ DLL_DECLARATION void vLCCM723R0_TS_000(void)
 		vLIPOMODEL__Process();
 	}
 
-	//save off the data
-	vWIN32_DEBUG_CSV__Write_CSV_F32("D:\\RLOOP_LOG\\BATTERY_MODEL\\cell_voltage.csv", u32Length, &sLiPo.sPack[0].sCell[0].f32CellVoltage_V[0]);
-	vWIN32_DEBUG_CSV__Write_CSV_F32("D:\\RLOOP_LOG\\BATTERY_MODEL\\cell_current.csv", u32Length, &sLiPo.sPack[0].sCell[0].f32CellCurrent_A[0]);
-	vWIN32_DEBUG_CSV__Write_CSV_F32("D:\\RLOOP_LOG\\BATTERY_MODEL\\cell_power.csv", u32Length, &sLiPo.sPack[0].sCell[0].f32CellPower_W[0]);
-	vWIN32_DEBUG_CSV__Write_CSV_F32("D:\\RLOOP_LOG\\BATTERY_MODEL\\cell_oc_voltage.csv", u32Length, &sLiPo.sPack[0].sCell[0].f32OpenCircuitVoltage_V[0]);
+#if C_LOCALDEF__LCCM723__HISTORY_SIZE > 0U
+	//save off the data, oldest first until the ring wraps
+	u32Length = sLiPo.sHistory.u32Count;
+	vWIN32_DEBUG_CSV__Write_CSV_F32("D:\\RLOOP_LOG\\BATTERY_MODEL\\cell_voltage.csv", u32Length, &sLiPo.sPack[0].sCell[0].sHistory.f32CellVoltage_V[0]);
+	vWIN32_DEBUG_CSV__Write_CSV_F32("D:\\RLOOP_LOG\\BATTERY_MODEL\\cell_current.csv", u32Length, &sLiPo.sPack[0].sCell[0].sHistory.f32CellCurrent_A[0]);
+	vWIN32_DEBUG_CSV__Write_CSV_F32("D:\\RLOOP_LOG\\BATTERY_MODEL\\cell_temperature.csv", u32Length, &sLiPo.sPack[0].sCell[0].sHistory.f32CellTemperature_degC[0]);
+	vWIN32_DEBUG_CSV__Write_CSV_F32("D:\\RLOOP_LOG\\BATTERY_MODEL\\cell_oc_voltage.csv", u32Length, &sLiPo.sPack[0].sCell[0].sHistory.f32OpenCircuitVoltage_V[0]);
+#endif
 
 }
 
@@ -23,6 +23,31 @@
 		/*******************************************************************************
 		Defines
 		*******************************************************************************/
+		/** OCV lookup, 0 to 100% SoC in 0.5% steps */
+		#define C_LIPOMODEL__OCV_TABLE_SIZE									(201U)
+
+		/** Resistance lookup, -40C to 100C in 1C steps */
+		#define C_LIPOMODEL__RES_TABLE_MIN_DEGC								(-40.0F)
+		#define C_LIPOMODEL__RES_TABLE_STEP_DEGC							(1.0F)
+		#define C_LIPOMODEL__RES_TABLE_SIZE									(141U)
+
+		/** PCM melt function lookup, +/-10C around the melt temperature in 0.25C steps */
+		#define C_LIPOMODEL__MELT_TABLE_MIN_DEGC							(-10.0F)
+		#define C_LIPOMODEL__MELT_TABLE_STEP_DEGC							(0.25F)
+		#define C_LIPOMODEL__MELT_TABLE_SIZE								(81U)
+
+		/** Physical parameters of one cell and its PCM */
+		#define C_LIPOMODEL__CELL_CAPACITY_AS								(5.0F * 3600.0F)
+		#define C_LIPOMODEL__CELL_MASS_G									(138.0F)
+		#define C_LIPOMODEL__PCM_MASS_G										(12.0F)
+		#define C_LIPOMODEL__SHC_CELL										(1.0F)
+		#define C_LIPOMODEL__SHC_PCM										(2.1F)
+		#define C_LIPOMODEL__RTH_AMBIENT									(1.0e10F)
+		#define C_LIPOMODEL__RTH_PCM										(1.0F)
+		#define C_LIPOMODEL__PCM_MELT_DEGC									(46.8F)
+		#define C_LIPOMODEL__PCM_HEAT_MELT									(242.0F)
+		#define C_LIPOMODEL__SENSE_TIME_CONST								(50.0F)
+
 		/** Strucuture for a 2D lookup table */
 		typedef struct
 		{
@@ -69,8 +94,44 @@
 				
 				/** Ambient Temperature */
 				Lfloat32 f32TempAmbient_degC;
+
+				/** 1S ISR ticks since init, only written by the ISR */
+				Luint32 u32TickCount;
+
+				/** Steps simulated since init, catches up to the tick count */
+				Luint32 u32StepCount;
 				
 			}sSim;
+
+			/** Lookup tables, built once at init */
+			struct
+			{
+				/** Open circuit voltage vs SoC */
+				Lfloat32 f32OCV_V[C_LIPOMODEL__OCV_TABLE_SIZE];
+
+				/** Cell resistance vs cell temperature - Equation 5 */
+				Lfloat32 f32Resistance_R[C_LIPOMODEL__RES_TABLE_SIZE];
+
+				/** PCM melt function vs PCM temperature less the melt temperature - Equation 8 */
+				Lfloat32 f32MeltFunc[C_LIPOMODEL__MELT_TABLE_SIZE];
+
+			}sLookup;
+
+			#if C_LOCALDEF__LCCM723__HISTORY_SIZE > 0U
+			/** History ring position, shared by all cells */
+			struct
+			{
+				/** Next sample to write */
+				Luint32 u32WriteIndex;
+
+				/** Number of valid samples, up to the history size */
+				Luint32 u32Count;
+
+				/** Steps since the last sample */
+				Luint32 u32Decimate;
+
+			}sHistory;
+			#endif
 			
 			/** Battery packs */
 			struct
@@ -108,39 +169,35 @@
 						
 					}sPhysical;
 					
-					/** Cell 1 second timer increment flag */
-					Luint8 u8CellTimer_1S_Flag;
-					Luint32 u32CellTimer_Counter;
-					
-					/** Open circuit voltage vector, units are volts */
-					Lfloat32 f32OpenCircuitVoltage_V[C_LOCALDEF__LCCM723__MAX_TIME_SIZE];
+					/** Open circuit voltage, units are volts */
+					Lfloat32 f32OpenCircuitVoltage_V;
 					
 					/** Cell voltage in volts */
-					Lfloat32 f32CellVoltage_V[C_LOCALDEF__LCCM723__MAX_TIME_SIZE];
+					Lfloat32 f32CellVoltage_V;
 					
 					/** Cell Current, in Amps */
-					Lfloat32 f32CellCurrent_A[C_LOCALDEF__LCCM723__MAX_TIME_SIZE];
+					Lfloat32 f32CellCurrent_A;
 					
 					/** Cell Power, in Watts*/
-					Lfloat32 f32CellPower_W[C_LOCALDEF__LCCM723__MAX_TIME_SIZE];
+					Lfloat32 f32CellPower_W;
 					
 					/** Cell Heat Capacity*/
-					Lfloat32 f32CellHeatCapacity_[C_LOCALDEF__LCCM723__MAX_TIME_SIZE];
+					Lfloat32 f32CellHeatCapacity_;
 					
 					/** Cell Temperature, deg C */
-					Lfloat32 f32CellTemperature_degC[C_LOCALDEF__LCCM723__MAX_TIME_SIZE];
+					Lfloat32 f32CellTemperature_degC;
 					
 					/** Sensor Temperature, deg C */
-					Lfloat32 f32SensorTemperature_degC[C_LOCALDEF__LCCM723__MAX_TIME_SIZE];
+					Lfloat32 f32SensorTemperature_degC;
 
 					/** PCM Temperature, deg C*/
-					Lfloat32 f32PCMTemperature_degC[C_LOCALDEF__LCCM723__MAX_TIME_SIZE];
+					Lfloat32 f32PCMTemperature_degC;
 					
 					/** Depth of Discharge, unitless */
-					Lfloat32 f32Cell_DOD[C_LOCALDEF__LCCM723__MAX_TIME_SIZE];
+					Lfloat32 f32Cell_DOD;
 				
 					/** Cell Resistance, R*/
-					Lfloat32 f32CellResistance_R[C_LOCALDEF__LCCM723__MAX_TIME_SIZE];
+					Lfloat32 f32CellResistance_R;
 				
 					/** Thermal Model */
 					struct
@@ -163,7 +220,6 @@
 						
 						/** PCM specific heat capacity calculation - Equation 8 */
 						Lfloat32 meltFunc;
-						Lfloat32 effHeatCap[C_LOCALDEF__LCCM723__MAX_TIME_SIZE];
 						
 						/** Temperature rate of change - Equation 7*/
 						Lfloat32 tempRatePCM;
@@ -173,12 +229,106 @@
 						
 						
 					}sTherm;
-				
+
+					#if C_LOCALDEF__LCCM723__HISTORY_SIZE > 0U
+					/** Decimated history ring, see sLiPo.sHistory for the position */
+					struct
+					{
+						Lfloat32 f32OpenCircuitVoltage_V[C_LOCALDEF__LCCM723__HISTORY_SIZE];
+						Lfloat32 f32CellVoltage_V[C_LOCALDEF__LCCM723__HISTORY_SIZE];
+						Lfloat32 f32CellCurrent_A[C_LOCALDEF__LCCM723__HISTORY_SIZE];
+						Lfloat32 f32CellTemperature_degC[C_LOCALDEF__LCCM723__HISTORY_SIZE];
+
+					}sHistory;
+					#endif
 				
 				}sCell[C_LOCALDEF__LCCM723__NUM_CELLS_PER_PACK];
 			}sPack[C_LOCALDEF__LCCM723__NUM_PACKS];
 			
 		}TS_LIPO_CELL_MODEL;
+
+		#if C_LOCALDEF__LCCM723__ENABLE_BATCH == 1U
+
+		/** Total cells held by the batch model */
+		#define C_LIPOMODEL__BATCH_MAX_CELLS								(C_LOCALDEF__LCCM723__BATCH_MAX_PACKS * C_LOCALDEF__LCCM723__NUM_CELLS_PER_PACK)
+
+		/** Load applied to each cell of a batch pack */
+		typedef enum
+		{
+			/** Constant current in A */
+			LIPOMODEL_BATCH_LOAD__CURRENT = 0U,
+
+			/** Constant power in W */
+			LIPOMODEL_BATCH_LOAD__POWER,
+
+			/** Constant resistance in R */
+			LIPOMODEL_BATCH_LOAD__RESISTANCE
+
+		}E_LIPOMODEL_BATCH_LOAD_T;
+
+		/** Batch of independent packs, host only.
+		 * Each cell state is its own array indexed by (pack * cells per pack) + cell
+		 * so the cell loop is contiguous and the compiler can vectorise it. */
+		typedef struct
+		{
+			/** Number of packs in use */
+			Luint32 u32NumPacks;
+
+			/** Simulation time step, s */
+			Lfloat32 f32TimeStep;
+
+			/** Per cell state */
+			struct
+			{
+				/** Depth of discharge */
+				Lfloat32 f32DOD[C_LIPOMODEL__BATCH_MAX_CELLS];
+
+				/** 1 / capacity in As, cell variation */
+				Lfloat32 f32InvCapacity[C_LIPOMODEL__BATCH_MAX_CELLS];
+
+				/** Resistance multiplier, cell variation */
+				Lfloat32 f32ResistanceScale[C_LIPOMODEL__BATCH_MAX_CELLS];
+
+				/** Cell temperature */
+				Lfloat32 f32CellTemp_degC[C_LIPOMODEL__BATCH_MAX_CELLS];
+
+				/** PCM temperature */
+				Lfloat32 f32PCMTemp_degC[C_LIPOMODEL__BATCH_MAX_CELLS];
+
+				/** Sensor temperature */
+				Lfloat32 f32SensorTemp_degC[C_LIPOMODEL__BATCH_MAX_CELLS];
+
+				/** Last terminal voltage */
+				Lfloat32 f32Voltage_V[C_LIPOMODEL__BATCH_MAX_CELLS];
+
+			}sCell;
+
+			/** Per pack load and results */
+			struct
+			{
+				/** Load type */
+				E_LIPOMODEL_BATCH_LOAD_T eLoad[C_LOCALDEF__LCCM723__BATCH_MAX_PACKS];
+
+				/** Load value per cell, A, W or R */
+				Lfloat32 f32Load[C_LOCALDEF__LCCM723__BATCH_MAX_PACKS];
+
+				/** Ambient temperature */
+				Lfloat32 f32Ambient_degC[C_LOCALDEF__LCCM723__BATCH_MAX_PACKS];
+
+				/** Pack voltage after the last step */
+				Lfloat32 f32PackVoltage_V[C_LOCALDEF__LCCM723__BATCH_MAX_PACKS];
+
+				/** Highest cell temperature seen since init */
+				Lfloat32 f32PeakCellTemp_degC[C_LOCALDEF__LCCM723__BATCH_MAX_PACKS];
+
+				/** Lowest cell voltage seen since init */
+				Lfloat32 f32MinCellVoltage_V[C_LOCALDEF__LCCM723__BATCH_MAX_PACKS];
+
+			}sPack;
+
+		}TS_LIPO_CELL_BATCH;
+
+		#endif //C_LOCALDEF__LCCM723__ENABLE_BATCH
 		
 
 		/*******************************************************************************
@@ -191,16 +341,42 @@
 
 		//cell functions
 		void vLIPOMODEL_CELL__Init(Luint16 u16PackIndex, Luint16 u16CellIndex);
-		void vLIPOMODEL_CELL__Process(Luint16 u16PackIndex, Luint16 u16CellIndex);
+		void vLIPOMODEL_CELL__Step_All(void);
 		void vLIPOMODEL_CELL__1S_ISR(void);
+		void vLIPOMODEL_CELL__Set_Capaciity_As(Luint16 u16PackIndex, Luint16 u16CellIndex, Lfloat32 f32Value);
+
+		//lookup tables
+		void vLIPOMODEL_LOOKUP__Init(void);
+		Lfloat32 f32LIPOMODEL_LOOKUP__OCV(Lfloat32 f32SoC);
+		Lfloat32 f32LIPOMODEL_LOOKUP__Resistance(Lfloat32 f32Temperature_degC);
+		Lfloat32 f32LIPOMODEL_LOOKUP__MeltFunc(Lfloat32 f32DeltaT_degC);
 		
 		//battery
 		void vLIPOMODEL_BATTERY__Init(Luint16 u16BattIndex);
 		void vLIPOMODEL_BATTERY__Process(Luint16 u16BattIndex);
 		
+		//batch
+		#if C_LOCALDEF__LCCM723__ENABLE_BATCH == 1U
+			DLL_DECLARATION void vLIPOMODEL_BATCH__Init(Luint32 u32NumPacks, Lfloat32 f32TimeStep);
+			DLL_DECLARATION void vLIPOMODEL_BATCH__Set_Cell(Luint32 u32PackIndex, Luint32 u32CellIndex, Lfloat32 f32CapacityScale, Lfloat32 f32ResistanceScale, Lfloat32 f32Temperature_degC);
+			DLL_DECLARATION void vLIPOMODEL_BATCH__Set_Load(Luint32 u32PackIndex, E_LIPOMODEL_BATCH_LOAD_T eLoad, Lfloat32 f32Value, Lfloat32 f32Ambient_degC);
+			DLL_DECLARATION void vLIPOMODEL_BATCH__Run(Luint32 u32Steps);
+			DLL_DECLARATION Lfloat32 f32LIPOMODEL_BATCH__Get_PackVoltage(Luint32 u32PackIndex);
+			DLL_DECLARATION Lfloat32 f32LIPOMODEL_BATCH__Get_PeakCellTemp(Luint32 u32PackIndex);
+			DLL_DECLARATION Lfloat32 f32LIPOMODEL_BATCH__Get_MinCellVoltage(Luint32 u32PackIndex);
+			DLL_DECLARATION Lfloat32 f32LIPOMODEL_BATCH__Get_CellTemp(Luint32 u32PackIndex, Luint32 u32CellIndex);
+			DLL_DECLARATION Luint32 u32LIPOMODEL_BATCH__Count_Over(Lfloat32 f32Limit_degC);
+		#endif
+
+		#if C_LOCALDEF__LCCM723__ENABLE_TEST_SPEC == 1U
+			DLL_DECLARATION void vLCCM723R0_TS_001(void);
+		#endif
+
 		//win32 simulation
 		#ifdef WIN32
 			DLL_DECLARATION Lfloat32 f32LIPOMODEL_WIN32__Get_PackVoltage(Luint16 u16PackIndex);
+			DLL_DECLARATION Lfloat32 f32LIPOMODEL_WIN32__Get_CellVoltage(Luint16 u16PackIndex, Luint16 u16CellIndex);
+			DLL_DECLARATION Lfloat32 f32LIPOMODEL_WIN32__Get_CellTemperature(Luint16 u16PackIndex, Luint16 u16CellIndex);
 			DLL_DECLARATION void vLIPOMODEL_WIN32__Update_LoadPower(Lfloat32 f32Value);
 			DLL_DECLARATION void vLIPOMODEL_WIN32__Update_LoadCurrent(Lfloat32 f32Value);
 		#endif
@@ -209,12 +385,18 @@
 		#ifndef C_LOCALDEF__LCCM723__NUM_CELLS_PER_PACK
 			#error
 		#endif
-		#ifndef C_LOCALDEF__LCCM723__MAX_TIME_SIZE
+		#ifndef C_LOCALDEF__LCCM723__HISTORY_SIZE
+			#error
+		#endif
+		#ifndef C_LOCALDEF__LCCM723__HISTORY_DECIMATION
 			#error
 		#endif
 		#ifndef C_LOCALDEF__LCCM723__NUM_PACKS
 			#error
 		#endif	
+		#ifndef C_LOCALDEF__LCCM723__ENABLE_BATCH
+			#error
+		#endif
 		
 	#endif //#if C_LOCALDEF__LCCM723__ENABLE_THIS_MODULE == 1U
 	//safetys
@@ -19,10 +19,12 @@ LIPO CELL MODEL
 	#define C_LOCALDEF__LCCM723__ENABLE_THIS_MODULE							(1U)
 	#if C_LOCALDEF__LCCM723__ENABLE_THIS_MODULE == 1U
 
-		/** Define the maximum time size in seconds */
-		#define C_LOCALDEF__LCCM723__MAX_TIME_SIZE							(600U)
-	
-	
+		/** Size of the decimated history ring per cell, 0 keeps only the current state */
+		#define C_LOCALDEF__LCCM723__HISTORY_SIZE							(0U)
+
+		/** Record every Nth simulation step into the history ring, min is 1 */
+		#define C_LOCALDEF__LCCM723__HISTORY_DECIMATION						(1U)
+
 		/** If you want to make a battery out of many cells, specify the
 		number of cells, min is 1
 		Number of cells * num Packs = total cells */
@@ -36,6 +38,12 @@ LIPO CELL MODEL
 		/** Number of individual battery packs */
 		#define C_LOCALDEF__LCCM723__NUM_PACKS								(1U)
 
+		/** Host only batch model for running many independent packs at once */
+		#define C_LOCALDEF__LCCM723__ENABLE_BATCH							(0U)
+
+		/** Number of packs the batch model can hold */
+		#define C_LOCALDEF__LCCM723__BATCH_MAX_PACKS						(1U)
+
 		/** Testing Options */
 		#define C_LOCALDEF__LCCM723__ENABLE_TEST_SPEC						(0U)
 		
@@ -17,8 +17,8 @@
 	#include <localdef.h>
 	#if C_LOCALDEF__LCCM107__ENABLE_THIS_MODULE == 1U
 		
-		#include <rm4/lccm107__rm4__emif/rm4_emif__private.h>
-		#include <rm4/lccm229__rm4__dma/rm4_dma__private.h>
+		#include <RM4/LCCM107__RM4__EMIF/rm4_emif__private.h>
+		#include <RM4/LCCM229__RM4__DMA/rm4_dma__private.h>
 
 		typedef volatile struct emifDATA
 		{
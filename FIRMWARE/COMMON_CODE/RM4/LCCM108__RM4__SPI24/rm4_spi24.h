@@ -26,8 +26,8 @@
 		/*****************************************************************************
 		Includes
 		*****************************************************************************/
-		#include <rm4/lccm108__rm4__spi24/rm4_spi24__private.h>
-		#include <rm4/lccm108__rm4__spi24/rm4_spi24__semistaticdef.h>
+		#include <RM4/LCCM108__RM4__SPI24/rm4_spi24__private.h>
+		#include <RM4/LCCM108__RM4__SPI24/rm4_spi24__semistaticdef.h>
 
 
 		/*****************************************************************************
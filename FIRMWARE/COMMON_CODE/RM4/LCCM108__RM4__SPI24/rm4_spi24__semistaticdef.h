@@ -14,7 +14,7 @@
 #ifndef RM48_SPI_SEMISTATICDEF_H_
 #define RM48_SPI_SEMISTATICDEF_H_
 
-	#include <rm4/lccm108__rm4__spi24/rm4_spi24__staticdef.h>
+	#include <RM4/LCCM108__RM4__SPI24/rm4_spi24__staticdef.h>
 
 	#ifndef C_LOCALDEF__LCCM108__ENABLE_THIS_MODULE
 		#error
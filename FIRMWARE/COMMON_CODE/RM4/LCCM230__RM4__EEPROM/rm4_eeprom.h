@@ -65,7 +65,7 @@
 		/*****************************************************************************
 		Includes
 		*****************************************************************************/
-		#include <MULTICORE/lccm284__multicore__fault_tree/fault_tree__public.h>
+		#include <MULTICORE/LCCM284__MULTICORE__FAULT_TREE/fault_tree__public.h>
 		//fault flags file.
 		#include <RM4/LCCM230__RM4__EEPROM/rm4_eeprom__fault_flags.h>
 
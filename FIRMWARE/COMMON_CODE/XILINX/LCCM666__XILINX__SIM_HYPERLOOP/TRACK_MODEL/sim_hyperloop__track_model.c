@@ -1,6 +1,9 @@
 /**
  * @file		SIM_HYPERLOOP__TRACK_MODEL.C
  * @brief		Software track model,
+ * 				Fixed step pod dynamics through the accel, coast and decel
+ * 				profiles, generating the contrast laser edges, laser range
+ * 				and accel samples a pod would see in the tube.
  * @author		Lachlan Grogan
  * @copyright	This file contains proprietary and confidential information of
  *				SIL3 Pty. Ltd. (ACN 123 529 064). This code may be distributed
@@ -24,85 +27,730 @@
  * @{ */
 
 #include "../sim_hyperloop.h"
+#if C_LOCALDEF__LCCM666__ENABLE_THIS_MODULE == 1U
+
+#include <math.h>
 
 extern struct _strSIMHLOOP sSH;
 
+//locals
+static void vSIMHLOOP_TRACK__Step(Lfloat64 f64Step_s);
+static void vSIMHLOOP_TRACK__Advance(Lfloat64 f64Dt_s);
+static Lfloat64 f64SIMHLOOP_TRACK__Time_To(Lfloat64 f64Dist_m, Lfloat64 f64Dt_s);
+static Lfloat64 f64SIMHLOOP_TRACK__Edge_Pos_m(Luint8 u8Laser);
+static Luint64 u64SIMHLOOP_TRACK__To_ns(Lfloat64 f64Time_s);
+static Lfloat32 f32SIMHLOOP_TRACK__Noise(Lfloat32 f32Sigma);
+
+
 //init the track model.
 /***************************************************************************//**
  * @brief
- * ToDo
- * 
- * @st_funcMD5		7D1FE410B86838B43F9BD31EA4526184
+ * Init the software track model with a 1ms step, no stripes and no noise.
+ *
+ * @st_funcMD5		4D90B6B0AA2A4DF34D6278B3A386ADCE
  * @st_funcID		LCCM666R0.FILE.003.FUNC.001
  */
 void vSIMHLOOP_TRACK__Init(void)
 {
-	
+	Luint8 u8Counter;
+
 	sSH.sTrack.eState = TRAKSIM_STATE__IDLE;
-	
+
 	//config the pod model
 	sSH.sTrack.sPod.f32PodMass_KG = 320.0F;
 	sSH.sTrack.sPod.f32Accel_G = 2.0F;
 	sSH.sTrack.sPod.f32CoastVeloc_ms = 100.0F;
 	sSH.sTrack.sPod.f32Decel_G = -2.0F;
-	
+
 	//Simulation
-	//10ns time step
-	sSH.sTrack.f32TimeStep = 10E-9;
-	
+	//The edges are solved exactly inside each step from s = ut + 1/2at^2 so
+	//the step only sets how often we come up for air, 1ms keeps the host
+	//well above real time.
+	sSH.sTrack.f32TimeStep = 1E-3F;
+
 	//compute the veloc increase per time step based on the g-force
-	//sSH.sTrack.f32AccelIncrement;
-	
-	//Need to compute the distance travelled per time step
-	//no easy way to do this other than
-	//s = ut + 1/2at^2
-	
-	
+	sSH.sTrack.f32AccelIncrement = sSH.sTrack.sPod.f32Accel_G * (Lfloat32)C_SIMHLOOP__GRAVITY_MSS * sSH.sTrack.f32TimeStep;
+
+	//the SpaceX tube
+	sSH.sTrack.sGeom.f64Length_m = 1250.0;
+	sSH.sTrack.sGeom.f64StopPos_m = 1200.0;
+	sSH.sTrack.sGeom.u16NumStripes = 0U;
+	sSH.sTrack.sGeom.f32StripeWidth_mm = 101.6F;
+	for(u8Counter = 0U; u8Counter < C_SIMHLOOP__NUM_CONTRAST_LASERS; u8Counter++)
+	{
+		sSH.sTrack.sGeom.f32LaserOffset_mm[u8Counter] = 0.0F;
+	}
+	sSH.sTrack.sGeom.f32RangeOffset_mm = 0.0F;
+
+	//sensor rates
+	sSH.sTrack.sSample.u32RangePeriod_ns = 10000000U;
+	sSH.sTrack.sSample.u32AccelPeriod_ns = 10000000U;
+
+	//clean
+	sSH.sTrack.sNoise.f32Range_mm = 0.0F;
+	sSH.sTrack.sNoise.f32Accel_G = 0.0F;
+	sSH.sTrack.sNoise.f32EdgeJitter_ns = 0.0F;
+	sSH.sTrack.sNoise.u32Seed = 0x2545F491U;
+
+	//put the pod at the start
+	vSIMHLOOP_TRACK__Start();
+	sSH.sTrack.eState = TRAKSIM_STATE__IDLE;
 }
 
 /***************************************************************************//**
  * @brief
- * ToDo
- * 
- * @st_funcMD5		EC34923095FC8D17EEF1551720BD0A34
+ * Run one fixed time step of the track model
+ *
+ * @st_funcMD5		CB7D4099B4D9FC6AF75930E19060030A
  * @st_funcID		LCCM666R0.FILE.003.FUNC.002
  */
 void vSIMHLOOP_TRACK__Process(void)
 {
-	
-	switch(sSH.sTrack.eState)
+	vSIMHLOOP_TRACK__Step((Lfloat64)sSH.sTrack.f32TimeStep);
+}
+
+/***************************************************************************//**
+ * @brief
+ * Run fixed steps until the simulation reaches a time, the last step is
+ * shortened so we land on the time exactly.
+ *
+ * @param[in]		u64Time_ns				Simulation time to run to
+ * @st_funcMD5		596343175F2AC10B0678534103717506
+ * @st_funcID		LCCM666R0.FILE.003.FUNC.004
+ */
+void vSIMHLOOP_TRACK__Run_Until(Luint64 u64Time_ns)
+{
+	Lfloat64 f64Target_s;
+	Lfloat64 f64Step_s;
+
+	f64Target_s = (Lfloat64)u64Time_ns * 1E-9;
+
+	//not init'd yet
+	if(sSH.sTrack.f32TimeStep <= 0.0F)
+	{
+		f64Target_s = 0.0;
+	}
+	else
 	{
-		
-		case TRAKSIM_STATE__IDLE:
-			break;
-		case TRAKSIM_STATE__ACCEL:
-			break;
-			
-		case TRAKSIM_STATE__COAST:
-			break;
-			
-		case TRAKSIM_STATE__DECEL:
-			break;
-			
-		case TRAKSIM_STATE__STOP:
-			break;
-		
+		//fall on
+	}
+
+	//anything under 1ps is rounding, don't chase it
+	while((f64Target_s - sSH.sTrack.sKin.f64Time_s) > 1E-12)
+	{
+		f64Step_s = f64Target_s - sSH.sTrack.sKin.f64Time_s;
+		if(f64Step_s > (Lfloat64)sSH.sTrack.f32TimeStep)
+		{
+			f64Step_s = (Lfloat64)sSH.sTrack.f32TimeStep;
+		}
+		else
+		{
+			//fall on
+		}
+
+		vSIMHLOOP_TRACK__Step(f64Step_s);
 	}
-	
 }
 
 /***************************************************************************//**
  * @brief
- * ToDo
- * 
- * @st_funcMD5		AE42C7F8391E98903A4588048F26F286
+ * Put the pod at the start of the track at time 0 and begin the accel.
+ *
+ * @st_funcMD5		DD64C72B75CDAFC85C645B9237435FEB
  * @st_funcID		LCCM666R0.FILE.003.FUNC.003
  */
 void vSIMHLOOP_TRACK__Start(void)
 {
-	
+	Luint8 u8Counter;
+
+	sSH.sTrack.sKin.f64Time_s = 0.0;
+	sSH.sTrack.sKin.f64Pos_m = 0.0;
+	sSH.sTrack.sKin.f64Veloc_ms = 0.0;
+	sSH.sTrack.sKin.f64Accel_mss = 0.0;
+
+	for(u8Counter = 0U; u8Counter < C_SIMHLOOP__NUM_CONTRAST_LASERS; u8Counter++)
+	{
+		sSH.sTrack.sLaser[u8Counter].u16NextEdge = 0U;
+	}
+
+	sSH.sTrack.sSample.u64NextRange_ns = 0U;
+	sSH.sTrack.sSample.u64NextAccel_ns = 0U;
+
+	sSH.sTrack.u32EdgeCount = 0U;
+	sSH.sTrack.u32RangeCount = 0U;
+	sSH.sTrack.u32AccelCount = 0U;
+
 	sSH.sTrack.eState = TRAKSIM_STATE__ACCEL;
 }
+
+/***************************************************************************//**
+ * @brief
+ * Set the flight profile
+ *
+ * @param[in]		f32Accel_G				Pusher accel
+ * @param[in]		f32CoastVeloc_ms		Velocity we stop accelerating at
+ * @param[in]		f32Decel_G				Braking, negative
+ * @st_funcMD5		F5EB3607C6459E9F6F13217F37F86582
+ * @st_funcID		LCCM666R0.FILE.003.FUNC.005
+ */
+void vSIMHLOOP_TRACK__Set_Profile(Lfloat32 f32Accel_G, Lfloat32 f32CoastVeloc_ms, Lfloat32 f32Decel_G)
+{
+	//the phase times divide by all three
+	if((f32Accel_G > 0.0F) && (f32CoastVeloc_ms > 0.0F) && (f32Decel_G < 0.0F))
+	{
+		sSH.sTrack.sPod.f32Accel_G = f32Accel_G;
+		sSH.sTrack.sPod.f32CoastVeloc_ms = f32CoastVeloc_ms;
+		sSH.sTrack.sPod.f32Decel_G = f32Decel_G;
+		sSH.sTrack.f32AccelIncrement = f32Accel_G * (Lfloat32)C_SIMHLOOP__GRAVITY_MSS * sSH.sTrack.f32TimeStep;
+	}
+	else
+	{
+		//error
+	}
+}
+
+/***************************************************************************//**
+ * @brief
+ * Set the tube length and where the pod should stop, the brake point is
+ * worked out from the decel so the pod rests at the stop position.
+ *
+ * @param[in]		u32Length_mm			Length of the tube
+ * @param[in]		u32StopPos_mm			Rest position of the pod reference
+ * @st_funcMD5		903E671CF4CDB764B68527BA20C21AB9
+ * @st_funcID		LCCM666R0.FILE.003.FUNC.006
+ */
+void vSIMHLOOP_TRACK__Set_Track(Luint32 u32Length_mm, Luint32 u32StopPos_mm)
+{
+	sSH.sTrack.sGeom.f64Length_m = (Lfloat64)u32Length_mm * 1E-3;
+	sSH.sTrack.sGeom.f64StopPos_m = (Lfloat64)u32StopPos_mm * 1E-3;
+}
+
+/***************************************************************************//**
+ * @brief
+ * Load the stripe positions, normally straight from the track database.
+ *
+ * @note
+ * The list is sorted on the way in as the database can hold clusters out of
+ * order, zero entries are treated as unused.
+ *
+ * @param[in]		*pu32Stripe_mm			Stripe start positions
+ * @param[in]		u16Count				Number of entries
+ * @st_funcMD5		EC8A50EDB469B7849BB2CA07BA9D4276
+ * @st_funcID		LCCM666R0.FILE.003.FUNC.007
+ */
+void vSIMHLOOP_TRACK__Set_Stripes(const Luint32 *pu32Stripe_mm, Luint16 u16Count)
+{
+	Luint16 u16Counter;
+	Luint16 u16Insert;
+	Luint16 u16Num;
+	Luint32 u32Value;
+
+	u16Num = 0U;
+	for(u16Counter = 0U; u16Counter < u16Count; u16Counter++)
+	{
+		u32Value = pu32Stripe_mm[u16Counter];
+		if((u32Value != 0U) && (u16Num < C_SIMHLOOP__MAX_STRIPES))
+		{
+			//insertion sort, the lists are short
+			u16Insert = u16Num;
+			while((u16Insert > 0U) && (sSH.sTrack.sGeom.u32Stripe_mm[u16Insert - 1U] > u32Value))
+			{
+				sSH.sTrack.sGeom.u32Stripe_mm[u16Insert] = sSH.sTrack.sGeom.u32Stripe_mm[u16Insert - 1U];
+				u16Insert--;
+			}
+			sSH.sTrack.sGeom.u32Stripe_mm[u16Insert] = u32Value;
+			u16Num++;
+		}
+		else
+		{
+			//skip
+		}
+	}
+	sSH.sTrack.sGeom.u16NumStripes = u16Num;
+}
+
+/***************************************************************************//**
+ * @brief
+ * Set where a contrast laser sits on the pod
+ *
+ * @param[in]		u8Laser					0 to C_SIMHLOOP__NUM_CONTRAST_LASERS - 1
+ * @param[in]		f32Offset_mm			Forward of the pod reference is positive
+ * @st_funcMD5		C5C9670802B8D919682A4716E41A6F45
+ * @st_funcID		LCCM666R0.FILE.003.FUNC.008
+ */
+void vSIMHLOOP_TRACK__Set_LaserOffset(Luint8 u8Laser, Lfloat32 f32Offset_mm)
+{
+	if(u8Laser < C_SIMHLOOP__NUM_CONTRAST_LASERS)
+	{
+		sSH.sTrack.sGeom.f32LaserOffset_mm[u8Laser] = f32Offset_mm;
+	}
+	else
+	{
+		//error
+	}
+}
+
+/***************************************************************************//**
+ * @brief
+ * Set the laser range and accel sample rates
+ *
+ * @param[in]		u32Range_us				Laser range sample period
+ * @param[in]		u32Accel_us				Accel sample period
+ * @st_funcMD5		545DC78CDD9D32D1CB1C2542D64D1608
+ * @st_funcID		LCCM666R0.FILE.003.FUNC.009
+ */
+void vSIMHLOOP_TRACK__Set_SamplePeriods(Luint32 u32Range_us, Luint32 u32Accel_us)
+{
+	if((u32Range_us > 0U) && (u32Accel_us > 0U))
+	{
+		sSH.sTrack.sSample.u32RangePeriod_ns = u32Range_us * 1000U;
+		sSH.sTrack.sSample.u32AccelPeriod_ns = u32Accel_us * 1000U;
+	}
+	else
+	{
+		//error
+	}
+}
+
+/***************************************************************************//**
+ * @brief
+ * Set the sensor noise, all values are 1 sigma gaussian
+ *
+ * @param[in]		f32Range_mm				Laser range noise
+ * @param[in]		f32Accel_G				Accel noise
+ * @param[in]		f32EdgeJitter_ns		Contrast edge timing jitter
+ * @param[in]		u32Seed					PRNG seed so a noisy run can be repeated
+ * @st_funcMD5		74E3750AB715D5C486A499BCDFF679E6
+ * @st_funcID		LCCM666R0.FILE.003.FUNC.010
+ */
+void vSIMHLOOP_TRACK__Set_Noise(Lfloat32 f32Range_mm, Lfloat32 f32Accel_G, Lfloat32 f32EdgeJitter_ns, Luint32 u32Seed)
+{
+	sSH.sTrack.sNoise.f32Range_mm = f32Range_mm;
+	sSH.sTrack.sNoise.f32Accel_G = f32Accel_G;
+	sSH.sTrack.sNoise.f32EdgeJitter_ns = f32EdgeJitter_ns;
+
+	//xorshift locks up on 0
+	if(u32Seed != 0U)
+	{
+		sSH.sTrack.sNoise.u32Seed = u32Seed;
+	}
+	else
+	{
+		sSH.sTrack.sNoise.u32Seed = 0x2545F491U;
+	}
+}
+
+/***************************************************************************//**
+ * @brief
+ * Simulation time
+ *
+ * @st_funcMD5		CE898BF82C97D81A2362A628E4CDD838
+ * @st_funcID		LCCM666R0.FILE.003.FUNC.011
+ */
+Luint64 u64SIMHLOOP_TRACK__Get_Time_ns(void)
+{
+	return u64SIMHLOOP_TRACK__To_ns(sSH.sTrack.sKin.f64Time_s);
+}
+
+/***************************************************************************//**
+ * @brief
+ * True position of the pod reference
+ *
+ * @st_funcMD5		19EF515C02F2437424794FDF2F5175F5
+ * @st_funcID		LCCM666R0.FILE.003.FUNC.012
+ */
+Lfloat64 f64SIMHLOOP_TRACK__Get_Position_m(void)
+{
+	return sSH.sTrack.sKin.f64Pos_m;
+}
+
+/***************************************************************************//**
+ * @brief
+ * True velocity of the pod
+ *
+ * @st_funcMD5		2D333419E461C4FC5722279EE1340019
+ * @st_funcID		LCCM666R0.FILE.003.FUNC.013
+ */
+Lfloat64 f64SIMHLOOP_TRACK__Get_Veloc_ms(void)
+{
+	return sSH.sTrack.sKin.f64Veloc_ms;
+}
+
+/***************************************************************************//**
+ * @brief
+ * Current profile state
+ *
+ * @st_funcMD5		725FACE8DBA7FF6F66B27599264C317C
+ * @st_funcID		LCCM666R0.FILE.003.FUNC.014
+ */
+E_SIMHL__TRACK_SIM_STATE_T eSIMHLOOP_TRACK__Get_State(void)
+{
+	return sSH.sTrack.eState;
+}
+
+//run one step, splitting it where the profile changes
+static void vSIMHLOOP_TRACK__Step(Lfloat64 f64Step_s)
+{
+	Lfloat64 f64Remain;
+	Lfloat64 f64Dt;
+	Lfloat64 f64Phase;
+	Lfloat64 f64Decel;
+	Lfloat64 f64A;
+	Lfloat64 f64B;
+	Lfloat64 f64C;
+	Luint8 u8Change;
+
+	f64Remain = f64Step_s;
+	while(f64Remain > 0.0)
+	{
+		f64Decel = (Lfloat64)sSH.sTrack.sPod.f32Decel_G * C_SIMHLOOP__GRAVITY_MSS;
+		u8Change = 0U;
+		f64Dt = f64Remain;
+
+		switch(sSH.sTrack.eState)
+		{
+
+			case TRAKSIM_STATE__IDLE:
+			case TRAKSIM_STATE__STOP:
+				//sitting still, the sensors still sample
+				sSH.sTrack.sKin.f64Accel_mss = 0.0;
+				sSH.sTrack.sKin.f64Veloc_ms = 0.0;
+				break;
+
+			case TRAKSIM_STATE__ACCEL:
+				sSH.sTrack.sKin.f64Accel_mss = (Lfloat64)sSH.sTrack.sPod.f32Accel_G * C_SIMHLOOP__GRAVITY_MSS;
+
+				//time to the coast velocity
+				f64Phase = ((Lfloat64)sSH.sTrack.sPod.f32CoastVeloc_ms - sSH.sTrack.sKin.f64Veloc_ms) / sSH.sTrack.sKin.f64Accel_mss;
+
+				//on a short track we hit the brake point first, solve
+				//x + vt + 1/2at^2 + (v + at)^2 / 2|d| = stop
+				f64A = (0.5 * sSH.sTrack.sKin.f64Accel_mss) - ((sSH.sTrack.sKin.f64Accel_mss * sSH.sTrack.sKin.f64Accel_mss) / (2.0 * f64Decel));
+				f64B = sSH.sTrack.sKin.f64Veloc_ms - ((sSH.sTrack.sKin.f64Accel_mss * sSH.sTrack.sKin.f64Veloc_ms) / f64Decel);
+				f64C = sSH.sTrack.sKin.f64Pos_m - ((sSH.sTrack.sKin.f64Veloc_ms * sSH.sTrack.sKin.f64Veloc_ms) / (2.0 * f64Decel)) - sSH.sTrack.sGeom.f64StopPos_m;
+				if(f64C >= 0.0)
+				{
+					sSH.sTrack.eState = TRAKSIM_STATE__DECEL;
+					f64Dt = 0.0;
+				}
+				else
+				{
+					f64C = (-f64B + sqrt((f64B * f64B) - (4.0 * f64A * f64C))) / (2.0 * f64A);
+					if(f64C < f64Phase)
+					{
+						f64Phase = f64C;
+						u8Change = 2U;
+					}
+					else
+					{
+						u8Change = 1U;
+					}
+
+					if(f64Phase <= f64Dt)
+					{
+						f64Dt = f64Phase;
+					}
+					else
+					{
+						u8Change = 0U;
+					}
+				}
+				break;
+
+			case TRAKSIM_STATE__COAST:
+				sSH.sTrack.sKin.f64Accel_mss = 0.0;
+
+				//run to the brake point
+				f64Phase = sSH.sTrack.sGeom.f64StopPos_m + ((sSH.sTrack.sKin.f64Veloc_ms * sSH.sTrack.sKin.f64Veloc_ms) / (2.0 * f64Decel));
+				f64Phase = (f64Phase - sSH.sTrack.sKin.f64Pos_m) / sSH.sTrack.sKin.f64Veloc_ms;
+				if(f64Phase <= f64Dt)
+				{
+					f64Dt = f64Phase;
+					u8Change = 2U;
+				}
+				else
+				{
+					//fall on
+				}
+				break;
+
+			case TRAKSIM_STATE__DECEL:
+				sSH.sTrack.sKin.f64Accel_mss = f64Decel;
+
+				//run to a stop
+				f64Phase = -sSH.sTrack.sKin.f64Veloc_ms / f64Decel;
+				if(f64Phase <= f64Dt)
+				{
+					f64Dt = f64Phase;
+					u8Change = 3U;
+				}
+				else
+				{
+					//fall on
+				}
+				break;
+
+			default:
+				//do nothing.
+				break;
+
+		}//switch(sSH.sTrack.eState)
+
+		//a phase boundary right on the start of a step
+		if(f64Dt < 0.0)
+		{
+			f64Dt = 0.0;
+		}
+		else
+		{
+			//fall on
+		}
+
+		vSIMHLOOP_TRACK__Advance(f64Dt);
+		f64Remain -= f64Dt;
+
+		switch(u8Change)
+		{
+			case 1U:
+				sSH.sTrack.sKin.f64Veloc_ms = (Lfloat64)sSH.sTrack.sPod.f32CoastVeloc_ms;
+				sSH.sTrack.eState = TRAKSIM_STATE__COAST;
+				break;
+
+			case 2U:
+				sSH.sTrack.eState = TRAKSIM_STATE__DECEL;
+				break;
+
+			case 3U:
+				sSH.sTrack.sKin.f64Veloc_ms = 0.0;
+				sSH.sTrack.sKin.f64Accel_mss = 0.0;
+				sSH.sTrack.eState = TRAKSIM_STATE__STOP;
+				break;
+
+			default:
+				//no change
+				break;
+		}
+	}
+}
+
+//move the pod on, firing the edges and sensor samples that fall inside dt
+static void vSIMHLOOP_TRACK__Advance(Lfloat64 f64Dt_s)
+{
+	Luint8 u8Laser;
+	Luint8 u8Next;
+	Lfloat64 f64Tau;
+	Lfloat64 f64Best;
+	Lfloat64 f64Pos;
+	Lfloat64 f64Time;
+	Lint32 s32Range;
+	Lfloat32 f32Accel;
+	Luint64 u64End_ns;
+	Luint64 u64Edge_ns;
+
+	//contrast edges in time order across all the lasers
+	do
+	{
+		u8Next = C_SIMHLOOP__NUM_CONTRAST_LASERS;
+		f64Best = f64Dt_s;
+		for(u8Laser = 0U; u8Laser < C_SIMHLOOP__NUM_CONTRAST_LASERS; u8Laser++)
+		{
+			if((Luint16)(sSH.sTrack.sLaser[u8Laser].u16NextEdge >> 1U) < sSH.sTrack.sGeom.u16NumStripes)
+			{
+				f64Pos = f64SIMHLOOP_TRACK__Edge_Pos_m(u8Laser) - sSH.sTrack.sKin.f64Pos_m;
+				f64Tau = f64SIMHLOOP_TRACK__Time_To(f64Pos, f64Dt_s);
+				//on a tie the lowest laser goes first, an edge right on the
+				//end of the step goes at the start of the next
+				if(f64Tau < f64Best)
+				{
+					f64Best = f64Tau;
+					u8Next = u8Laser;
+				}
+				else
+				{
+					//fall on
+				}
+			}
+			else
+			{
+				//past the last stripe
+			}
+		}
+
+		if(u8Next < C_SIMHLOOP__NUM_CONTRAST_LASERS)
+		{
+			f64Time = sSH.sTrack.sKin.f64Time_s + f64Best + ((Lfloat64)f32SIMHLOOP_TRACK__Noise(sSH.sTrack.sNoise.f32EdgeJitter_ns) * 1E-9);
+			u64Edge_ns = u64SIMHLOOP_TRACK__To_ns(f64Time);
+
+			#if C_LOCALDEF__LCCM666__ENABLE_TRACK_CALLBACKS == 1U
+				C_LOCALDEF__LCCM666__EDGE_CALLBACK(u8Next, (Luint8)((sSH.sTrack.sLaser[u8Next].u16NextEdge & 0x0001U) ^ 0x0001U), u64Edge_ns);
+			#else
+				(void)u64Edge_ns;
+			#endif
+
+			sSH.sTrack.sLaser[u8Next].u16NextEdge++;
+			sSH.sTrack.u32EdgeCount++;
+		}
+		else
+		{
+			//no more edges this step
+		}
+
+	}while(u8Next < C_SIMHLOOP__NUM_CONTRAST_LASERS);
+
+	u64End_ns = u64SIMHLOOP_TRACK__To_ns(sSH.sTrack.sKin.f64Time_s + f64Dt_s);
+
+	//laser range, the end of the tube less where the range finder is
+	while(sSH.sTrack.sSample.u64NextRange_ns <= u64End_ns)
+	{
+		f64Tau = ((Lfloat64)sSH.sTrack.sSample.u64NextRange_ns * 1E-9) - sSH.sTrack.sKin.f64Time_s;
+		f64Pos = sSH.sTrack.sKin.f64Pos_m + (sSH.sTrack.sKin.f64Veloc_ms * f64Tau) + (0.5 * sSH.sTrack.sKin.f64Accel_mss * f64Tau * f64Tau);
+		f64Pos = ((sSH.sTrack.sGeom.f64Length_m - f64Pos) * 1000.0) - (Lfloat64)sSH.sTrack.sGeom.f32RangeOffset_mm;
+		s32Range = (Lint32)floor(f64Pos + (Lfloat64)f32SIMHLOOP_TRACK__Noise(sSH.sTrack.sNoise.f32Range_mm) + 0.5);
+
+		#if C_LOCALDEF__LCCM666__ENABLE_TRACK_CALLBACKS == 1U
+			C_LOCALDEF__LCCM666__RANGE_CALLBACK(s32Range, sSH.sTrack.sSample.u64NextRange_ns);
+		#else
+			(void)s32Range;
+		#endif
+
+		sSH.sTrack.sSample.u64NextRange_ns += (Luint64)sSH.sTrack.sSample.u32RangePeriod_ns;
+		sSH.sTrack.u32RangeCount++;
+	}
+
+	//accel along the tube
+	while(sSH.sTrack.sSample.u64NextAccel_ns <= u64End_ns)
+	{
+		f32Accel = (Lfloat32)(sSH.sTrack.sKin.f64Accel_mss / C_SIMHLOOP__GRAVITY_MSS);
+		f32Accel += f32SIMHLOOP_TRACK__Noise(sSH.sTrack.sNoise.f32Accel_G);
+
+		#if C_LOCALDEF__LCCM666__ENABLE_TRACK_CALLBACKS == 1U
+			C_LOCALDEF__LCCM666__ACCEL_CALLBACK(f32Accel, sSH.sTrack.sSample.u64NextAccel_ns);
+		#else
+			(void)f32Accel;
+		#endif
+
+		sSH.sTrack.sSample.u64NextAccel_ns += (Luint64)sSH.sTrack.sSample.u32AccelPeriod_ns;
+		sSH.sTrack.u32AccelCount++;
+	}
+
+	//s = ut + 1/2at^2
+	sSH.sTrack.sKin.f64Pos_m += (sSH.sTrack.sKin.f64Veloc_ms * f64Dt_s) + (0.5 * sSH.sTrack.sKin.f64Accel_mss * f64Dt_s * f64Dt_s);
+	sSH.sTrack.sKin.f64Veloc_ms += sSH.sTrack.sKin.f64Accel_mss * f64Dt_s;
+	sSH.sTrack.sKin.f64Time_s += f64Dt_s;
+}
+
+//time to cover a distance at the current velocity and accel, > dt if we won't get there
+static Lfloat64 f64SIMHLOOP_TRACK__Time_To(Lfloat64 f64Dist_m, Lfloat64 f64Dt_s)
+{
+	Lfloat64 f64Disc;
+	Lfloat64 f64Den;
+	Lfloat64 f64Return;
+
+	f64Return = f64Dt_s + 1.0;
+	if(f64Dist_m <= 0.0)
+	{
+		//already there
+		f64Return = 0.0;
+	}
+	else
+	{
+		//t = 2s / (u + sqrt(u^2 + 2as)), no cancellation when a is small
+		f64Disc = (sSH.sTrack.sKin.f64Veloc_ms * sSH.sTrack.sKin.f64Veloc_ms) + (2.0 * sSH.sTrack.sKin.f64Accel_mss * f64Dist_m);
+		if(f64Disc >= 0.0)
+		{
+			f64Den = sSH.sTrack.sKin.f64Veloc_ms + sqrt(f64Disc);
+			if(f64Den > 0.0)
+			{
+				f64Return = (2.0 * f64Dist_m) / f64Den;
+			}
+			else
+			{
+				//stopped
+			}
+		}
+		else
+		{
+			//we stop short of it
+		}
+	}
+
+	return f64Return;
+}
+
+//pod reference position at which a laser sees its next edge
+static Lfloat64 f64SIMHLOOP_TRACK__Edge_Pos_m(Luint8 u8Laser)
+{
+	Luint16 u16Edge;
+	Lfloat64 f64Return;
+
+	u16Edge = sSH.sTrack.sLaser[u8Laser].u16NextEdge;
+	f64Return = (Lfloat64)sSH.sTrack.sGeom.u32Stripe_mm[u16Edge >> 1U];
+	if((u16Edge & 0x0001U) != 0U)
+	{
+		//falling edge at the far side of the stripe
+		f64Return += (Lfloat64)sSH.sTrack.sGeom.f32StripeWidth_mm;
+	}
+	else
+	{
+		//fall on
+	}
+	f64Return -= (Lfloat64)sSH.sTrack.sGeom.f32LaserOffset_mm[u8Laser];
+
+	return f64Return * 1E-3;
+}
+
+//seconds to ns, rounded
+static Luint64 u64SIMHLOOP_TRACK__To_ns(Lfloat64 f64Time_s)
+{
+	Luint64 u64Return;
+
+	if(f64Time_s > 0.0)
+	{
+		u64Return = (Luint64)((f64Time_s * 1E9) + 0.5);
+	}
+	else
+	{
+		u64Return = 0U;
+	}
+
+	return u64Return;
+}
+
+//gaussian noise, sum of 12 xorshift uniforms
+static Lfloat32 f32SIMHLOOP_TRACK__Noise(Lfloat32 f32Sigma)
+{
+	Luint8 u8Counter;
+	Luint32 u32X;
+	Lfloat32 f32Sum;
+	Lfloat32 f32Return;
+
+	if(f32Sigma > 0.0F)
+	{
+		u32X = sSH.sTrack.sNoise.u32Seed;
+		f32Sum = 0.0F;
+		for(u8Counter = 0U; u8Counter < 12U; u8Counter++)
+		{
+			u32X ^= u32X << 13U;
+			u32X ^= u32X >> 17U;
+			u32X ^= u32X << 5U;
+			f32Sum += (Lfloat32)(u32X >> 8U) * (1.0F / 16777216.0F);
+		}
+		sSH.sTrack.sNoise.u32Seed = u32X;
+		f32Return = (f32Sum - 6.0F) * f32Sigma;
+	}
+	else
+	{
+		f32Return = 0.0F;
+	}
+
+	return f32Return;
+}
+
+#endif //#if C_LOCALDEF__LCCM666__ENABLE_THIS_MODULE == 1U
+//safetys
+#ifndef C_LOCALDEF__LCCM666__ENABLE_THIS_MODULE
+	#error
+#endif
 /** @} */
 /** @} */
 /** @} */
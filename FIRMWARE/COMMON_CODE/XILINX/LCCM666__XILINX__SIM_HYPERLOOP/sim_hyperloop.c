@@ -31,16 +31,18 @@ struct _strSIMHLOOP sSH;
  * @brief
  * Init the hyperloop simulation
  * 
- * @st_funcMD5		2388B5E66EC14301E85A04442BDDFC37
+ * @st_funcMD5		7B2C4EFFA256A325D50DD734BB4CE5FA
  * @st_funcID		LCCM666R0.FILE.000.FUNC.001
  */
 void vSIMHLOOP__Init(void)
 {
-	Luint32 u32Counter;
-
 
 	sSH.sControl.u8RunStatus = 0U;
 
+	//software track model
+	vSIMHLOOP_TRACK__Init();
+
+#ifndef WIN32
 	//init the hardware level
 	vSIMHLOOP_LOWLEVEL__Init();
 
@@ -61,6 +63,7 @@ void vSIMHLOOP__Init(void)
 #ifdef __SIM__MODELSIM__
 		vSIMHLOOP_LOWLEVEL__Run_On();
 #endif
+#endif //WIN32
 
 }
 
@@ -19,6 +19,14 @@
 		/*******************************************************************************
 		Defines
 		*******************************************************************************/
+		/** Max number of contrast stripes the track model can hold */
+		#define C_SIMHLOOP__MAX_STRIPES											(64U)
+
+		/** Number of contrast lasers on the pod, FWD, MID, AFT */
+		#define C_SIMHLOOP__NUM_CONTRAST_LASERS									(3U)
+
+		/** Standard gravity */
+		#define C_SIMHLOOP__GRAVITY_MSS											(9.80665)
 
 		typedef enum
 		{
@@ -73,7 +81,94 @@
 				/** Accel increment per time step */
 				Lfloat32 f32AccelIncrement;
 				
-				
+				/** Track geometry */
+				struct
+				{
+					/** Length of the tube, the laser range finder sees the end */
+					Lfloat64 f64Length_m;
+
+					/** Where we want the pod to come to rest */
+					Lfloat64 f64StopPos_m;
+
+					/** Stripe start positions along the track, sorted */
+					Luint32 u32Stripe_mm[C_SIMHLOOP__MAX_STRIPES];
+
+					/** Number of stripes in use */
+					Luint16 u16NumStripes;
+
+					/** Width of each stripe, rising edge at the start, falling at the end */
+					Lfloat32 f32StripeWidth_mm;
+
+					/** Contrast laser position relative to the pod reference */
+					Lfloat32 f32LaserOffset_mm[C_SIMHLOOP__NUM_CONTRAST_LASERS];
+
+					/** Range finder position relative to the pod reference */
+					Lfloat32 f32RangeOffset_mm;
+
+				}sGeom;
+
+				/** Pod kinematics, integrated in double so long runs stay exact */
+				struct
+				{
+					/** Simulation time */
+					Lfloat64 f64Time_s;
+
+					/** Pod reference position from the start of the track */
+					Lfloat64 f64Pos_m;
+
+					/** Pod velocity */
+					Lfloat64 f64Veloc_ms;
+
+					/** Acceleration of the current profile */
+					Lfloat64 f64Accel_mss;
+
+				}sKin;
+
+				/** Contrast laser edge tracking */
+				struct
+				{
+					/** Next edge to cross, even is the rising edge of stripe n/2 */
+					Luint16 u16NextEdge;
+
+				}sLaser[C_SIMHLOOP__NUM_CONTRAST_LASERS];
+
+				/** Sensor sample scheduling */
+				struct
+				{
+					/** Laser range sample period */
+					Luint32 u32RangePeriod_ns;
+
+					/** Accel sample period */
+					Luint32 u32AccelPeriod_ns;
+
+					/** Next sample times */
+					Luint64 u64NextRange_ns;
+					Luint64 u64NextAccel_ns;
+
+				}sSample;
+
+				/** Sensor noise, all 1 sigma, 0 for a clean run */
+				struct
+				{
+					/** Laser range noise */
+					Lfloat32 f32Range_mm;
+
+					/** Accel noise */
+					Lfloat32 f32Accel_G;
+
+					/** Timing jitter on the contrast edges */
+					Lfloat32 f32EdgeJitter_ns;
+
+					/** PRNG state, never 0 */
+					Luint32 u32Seed;
+
+				}sNoise;
+
+				/** Counters */
+				Luint32 u32EdgeCount;
+				Luint32 u32RangeCount;
+				Luint32 u32AccelCount;
+
 			}sTrack;
 			
 
@@ -115,6 +210,22 @@
 		void vSIMHLOOP_ETH__Init(void);
 		void vSIMHLOOP_ETH__Process(void);
 
+		//track model
+		void vSIMHLOOP_TRACK__Init(void);
+		void vSIMHLOOP_TRACK__Process(void);
+		void vSIMHLOOP_TRACK__Run_Until(Luint64 u64Time_ns);
+		void vSIMHLOOP_TRACK__Start(void);
+		void vSIMHLOOP_TRACK__Set_Profile(Lfloat32 f32Accel_G, Lfloat32 f32CoastVeloc_ms, Lfloat32 f32Decel_G);
+		void vSIMHLOOP_TRACK__Set_Track(Luint32 u32Length_mm, Luint32 u32StopPos_mm);
+		void vSIMHLOOP_TRACK__Set_Stripes(const Luint32 *pu32Stripe_mm, Luint16 u16Count);
+		void vSIMHLOOP_TRACK__Set_LaserOffset(Luint8 u8Laser, Lfloat32 f32Offset_mm);
+		void vSIMHLOOP_TRACK__Set_SamplePeriods(Luint32 u32Range_us, Luint32 u32Accel_us);
+		void vSIMHLOOP_TRACK__Set_Noise(Lfloat32 f32Range_mm, Lfloat32 f32Accel_G, Lfloat32 f32EdgeJitter_ns, Luint32 u32Seed);
+		Luint64 u64SIMHLOOP_TRACK__Get_Time_ns(void);
+		Lfloat64 f64SIMHLOOP_TRACK__Get_Position_m(void);
+		Lfloat64 f64SIMHLOOP_TRACK__Get_Veloc_ms(void);
+		E_SIMHL__TRACK_SIM_STATE_T eSIMHLOOP_TRACK__Get_State(void);
+
 		//lowlevel
 		void vSIMHLOOP_LOWLEVEL__Init(void);
 		void vSIMHLOOP_LOWLEVEL__Set_Accel_GForce(Lfloat32 f32GForce);
@@ -123,6 +234,11 @@
 		void vSIMHLOOP_LOWLEVEL__Run_On(void);
 		void vSIMHLOOP_LOWLEVEL__Run_Off(void);
 
+		//safetys
+		#ifndef C_LOCALDEF__LCCM666__ENABLE_TRACK_CALLBACKS
+			#error
+		#endif
+
 	#endif //#if C_LOCALDEF__LCCM666__ENABLE_THIS_MODULE == 1U
 	//safetys
 	#ifndef C_LOCALDEF__LCCM666__ENABLE_THIS_MODULE
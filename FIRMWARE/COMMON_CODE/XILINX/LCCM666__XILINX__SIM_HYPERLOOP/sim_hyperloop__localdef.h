@@ -26,6 +26,13 @@ Hyperloop Tube Simulation Model
 		/** Use Eth */
 		#define C_LOCALDEF__LCCM666__ENABLE_ETHERNET						(0U)
 
+		/** Hand the software track model outputs to the user as they are generated
+		Times are ns from the start of the run */
+		#define C_LOCALDEF__LCCM666__ENABLE_TRACK_CALLBACKS					(0U)
+		#define C_LOCALDEF__LCCM666__EDGE_CALLBACK(laser, rising, time)		vUSER__ContrastEdge(laser, rising, time)
+		#define C_LOCALDEF__LCCM666__RANGE_CALLBACK(range, time)			vUSER__LaserRange_mm(range, time)
+		#define C_LOCALDEF__LCCM666__ACCEL_CALLBACK(accel, time)			vUSER__Accel_G(accel, time)
+
 
 		/** Main include file */
 		#include <XILINX/FIRMWARE/LCCM666__XILINX__SIM_HYPERLOOP/sim_hyperloop.h>
@@ -111,6 +111,12 @@ RLOOP - FLIGHT CONTROL UNIT - CORE
 		/** Data Acqusition System */
 		#define C_LOCALDEF__LCCM655__ENABLE_DAQ								(1U)
 
+		/** Run the main loop tasks from the cooperative scheduler with per task timing */
+		#define C_LOCALDEF__LCCM655__ENABLE_SCHEDULER						(1U)
+
+		/** Named probe execution time profiling of the scheduler tasks and RTI ISRs, needs the scheduler */
+		#define C_LOCALDEF__LCCM655__ENABLE_PROFILE							(1U)
+
 		/** Enable the OptoNCDT laser interface */
 		#define C_LOCALDEF__LCCM655__ENABLE_LASER_OPTONCDT					(0U)
 
@@ -123,6 +129,9 @@ RLOOP - FLIGHT CONTROL UNIT - CORE
 		/** Enable accel subsystem */
 		#define C_LOCALDEF__LCCM655__ENABLE_ACCEL							(1U)
 
+		/** Read the MMA8451s by FIFO burst and run the fixed point filter chain */
+		#define C_LOCALDEF__LCCM655__ENABLE_ACCEL_FIFO						(1U)
+
 		/** Enable the braking subsystems */
 		#define C_LOCALDEF__LCCM655__ENABLE_BRAKES							(1U)
 
@@ -187,6 +196,9 @@ RLOOP - FLIGHT CONTROL UNIT - CORE
 			/** Navigation function */
 			#define C_LOCALDEF__LCCM655__ENABLE_FCTL_NAVIGATION 				(0U)
 
+			/** Fuse the nav sensors in the blender */
+			#define C_LOCALDEF__LCCM655__ENABLE_FCTL_BLENDER					(0U)
+
 			/** Control Aux Propulsion */
 			#define C_LOCALDEF__LCCM655__ENABLE_AUX_PROPULSION_CONTROL 			(0U)
 
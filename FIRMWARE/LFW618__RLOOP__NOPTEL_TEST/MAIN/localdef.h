@@ -211,6 +211,12 @@ RLOOP - FLIGHT CONTROL UNIT - CORE
         /** Data Acqusition System */
         #define C_LOCALDEF__LCCM655__ENABLE_DAQ                             (0U)
 
+        /** Run the main loop tasks from the cooperative scheduler with per task timing */
+        #define C_LOCALDEF__LCCM655__ENABLE_SCHEDULER                       (0U)
+
+        /** Named probe execution time profiling of the scheduler tasks and RTI ISRs, needs the scheduler */
+        #define C_LOCALDEF__LCCM655__ENABLE_PROFILE                         (0U)
+
         /** Enable or disable the PiComms layer */
         #define C_LOCALDEF__LCCM655__ENABLE_PI_COMMS                        (0U)
 
@@ -226,6 +232,9 @@ RLOOP - FLIGHT CONTROL UNIT - CORE
         /** Enable accel subsystem */
         #define C_LOCALDEF__LCCM655__ENABLE_ACCEL                           (0U)
 
+        /** Read the MMA8451s by FIFO burst and run the fixed point filter chain */
+        #define C_LOCALDEF__LCCM655__ENABLE_ACCEL_FIFO                      (0U)
+
         /** Enable the braking subsystems */
         #define C_LOCALDEF__LCCM655__ENABLE_BRAKES                          (0U)
         #define C_LOCALDEF__LCCM655__ENABLE_DEBUG_BRAKES                    (0U)
@@ -297,6 +306,9 @@ RLOOP - FLIGHT CONTROL UNIT - CORE
             /** Navigation function */
             #define C_LOCALDEF__LCCM655__ENABLE_FCTL_NAVIGATION                 (0U)
 
+            /** Fuse the nav sensors in the blender */
+            #define C_LOCALDEF__LCCM655__ENABLE_FCTL_BLENDER                    (0U)
+
             /** Control Aux Propulsion */
             #define C_LOCALDEF__LCCM655__ENABLE_AUX_PROPULSION_CONTROL          (0U)
 
@@ -32,7 +32,7 @@ extern Luint8 u8FwdPack__Default_Comp2[];
  * @brief
  * Init the battery temperature measurement devices
  * 
- * @st_funcMD5		86C09833B06FA3BF0A2875528B492BEA
+ * @st_funcMD5		BF496C239A02697D0A3C8C19258C7A81
  * @st_funcID		LCCM653R0.FILE.009.FUNC.001
  */
 void vPWRNODE_BATTTEMP__Init(void)
@@ -45,6 +45,7 @@ void vPWRNODE_BATTTEMP__Init(void)
 	sPWRNODE.sTemp.u16HighestSensorIndex = 0U;
 	sPWRNODE.sTemp.u32TempScanCount = 0U;
 	sPWRNODE.sTemp.eState = BATT_TEMP_STATE__IDLE;
+	vPWRNODE_BATTTEMP_STATS__Init();
 
 #ifndef WIN32
 	//bring up the 1-wire interface
@@ -70,30 +71,25 @@ void vPWRNODE_BATTTEMP__Init(void)
  * @brief
  * Process any battery temp measurement tasks
  * 
- * @st_funcMD5		521412365BC09A1D1CB3B029664377AB
+ * @st_funcMD5		B0DC946206C9ECDBA147FAD26989701F
  * @st_funcID		LCCM653R0.FILE.009.FUNC.002
  */
 void vPWRNODE_BATTTEMP__Process(void)
 {
 	Luint8 u8Test;
-	Luint16 u16Counter;
-	Luint16 u16NumSensors;
-	Luint16 u16User;
-	Lfloat32 f32High;
-	Lfloat32 f32Temp;
-	Lfloat32 f32Sum;
-	Lint16 s16Return;
-	Luint16 u16Mask;
 	Luint32 u32Max;
 	Luint8 *u8PtrPackMem;
 	Luint32 u32Counter;
-	Luint16 u16NumWorkingSensors;
 
 #ifndef WIN32
 	//process any search tasks
 	vDS18B20_ADDX__SearchSM_Process();
 #endif
 
+	//step any queued 1-Wire transactions, one I2C transfer per DS2482S so
+	//the BMS and charger are never held up by the wire.
+	vDS2482S__Process();
+
 	//process the DS18B20 devices.
 	//devices wont start converting until the network search has completed.
 	vDS18B20__Process();
@@ -194,99 +190,14 @@ void vPWRNODE_BATTTEMP__Process(void)
 
 		case BATT_TEMP_STATE__RUN:
 
-			//clear the vars
-			f32High = 0.0F;
-			f32Sum = 0.0F;
-			//do we have any new updates from the DS18B20 subsystem?
+			//the pack high, low, mean and variance are kept up to date by
+			//vPWRNODE_BATTTEMP_STATS__Update() as each reading lands, so all
+			//that is left at the end of a scan is the hot list.
 			u8Test = u8DS18B20__Is_NewDataAvail();
 			if(u8Test == 1U)
 			{
-				//clear the hghest index as it will be recomputed below
-				sPWRNODE.sTemp.u16HighestSensorIndex = 0U;
-
-				//0x2000 onwards is our BMS sensors
-				u16Mask = C_PWRCORE__BMS_TEMP_MASK;
-				u16Mask <<= 8U;
-
-				//get the number of sensors in the pack
-				u16NumSensors = u16DS18B20__Get_NumEnum_Sensors();
-				u16NumWorkingSensors = 0U;
-				for(u16Counter = 0U; u16Counter < u16NumSensors; u16Counter++)
-				{
-
-					//make sure the sensors belong to us.
-					u16User = u162DS18B20__Get_UserIndex(u16Counter);
-
-					//make sure they are in our user group
-					if((u16User & 0xFF00) != u16Mask)
-					{
-
-						//compute the highest
-						f32Temp = f32DS18B20__Get_Temperature_DegC(u16Counter);
-
-						if(f32Temp < 126.0F)
-						{
-
-							//inc the number of working sensors
-							u16NumWorkingSensors ++;
-
-							if(f32Temp > f32High)
-							{
-								//this sensor value is > than the last higest reading, save it
-								f32High = f32Temp;
-								sPWRNODE.sTemp.u16HighestSensorIndex = u16Counter;
-
-							}
-							else
-							{
-								//this sensor was lower than the last sensor
-							}
-
-							//add to the sum
-							f32Sum += f32Temp;
-
-						}
-						else
-						{
-
-						}
-
-
-					}
-					else
-					{
-						//not for us, maybe a BMS sensor
-					}
-
-
-				}//for(u16Counter = 0U; u16Counter < u16NumSensors; u16Counter++)
-
-
-				//divide
-				//math safety
-				if(u16NumWorkingSensors != 0U)
-				{
-					f32Sum /= (Lfloat32)u16NumWorkingSensors;
-				}
-				else
-				{
-					//stay the same
-				}
-#if 0
-				if(u16NumSensors != 0U)
-				{
-					f32Sum /= (Lfloat32)u16NumSensors;
-				}
-				else
-				{
-					//stay the same
-				}
-
-#endif
+				vPWRNODE_BATTTEMP_STATS__Update_Hot();
 
-				//update our internal vars
-				sPWRNODE.sTemp.f32HighestTemp = f32High;
-				sPWRNODE.sTemp.f32AverageTemp = f32Sum;
 				sPWRNODE.sTemp.u8NewTempAvail = 1U;
 
 				//Inc the scan count
@@ -0,0 +1,512 @@
+/**
+ * @file		POWER_CORE__BATTERY_TEMP__STATS.C
+ * @brief		Battery temperature statistics, updated per sensor reading
+ * @author		Lachlan Grogan
+ * @copyright	rLoop Inc.
+ * @st_fileID	LCCM653R0.FILE.036
+ */
+/**
+ * @addtogroup RLOOP
+ * @{ */
+/**
+ * @addtogroup POWER_NODE
+ * @ingroup RLOOP
+ * @{ */
+/**
+ * @addtogroup POWER_NODE__BATTERY_TEMP__STATS
+ * @ingroup POWER_NODE
+ * @{ */
+
+#include "../power_core.h"
+#if C_LOCALDEF__LCCM653__ENABLE_THIS_MODULE == 1U
+#if C_LOCALDEF__LCCM653__ENABLE_BATT_TEMP == 1U
+
+extern struct _strPWRNODE sPWRNODE;
+
+//empty leaves, never win a compare
+#define C_PWRCORE__BATTTEMP_TREE_EMPTY_MAX								(-32767)
+#define C_PWRCORE__BATTTEMP_TREE_EMPTY_MIN								(32767)
+
+//locals
+static void vPWRNODE_BATTTEMP_STATS__Acc_Add(TS_PWR_BATT_TEMP__ACC *pAcc, Lint16 s16Temp);
+static void vPWRNODE_BATTTEMP_STATS__Acc_Remove(TS_PWR_BATT_TEMP__ACC *pAcc, Lint16 s16Temp);
+static void vPWRNODE_BATTTEMP_STATS__Apply(Luint16 u16SensorIndex, Luint8 u8Add);
+static Lint16 s16PWRNODE_BATTTEMP_STATS__Acc_Get(const TS_PWR_BATT_TEMP__ACC *pAcc, Lfloat32 *pf32Mean, Lfloat32 *pf32Variance);
+static void vPWRNODE_BATTTEMP_STATS__Tree_Set(Luint16 u16SensorIndex, Lint16 s16Max, Lint16 s16Min);
+static Luint16 u16PWRNODE_BATTTEMP_STATS__Tree_Find(const Lint16 *ps16Tree, Luint16 u16Node);
+static void vPWRNODE_BATTTEMP_STATS__Publish(void);
+
+
+/***************************************************************************//**
+ * @brief
+ * Clear all the statistics
+ *
+ * @st_funcMD5		63AD240733E51FC48C41F958A4A8976B
+ * @st_funcID		LCCM653R0.FILE.036.FUNC.001
+ */
+void vPWRNODE_BATTTEMP_STATS__Init(void)
+{
+	Luint16 u16Counter;
+
+	for(u16Counter = 0U; u16Counter < C_LOCALDEF__LCCM644__MAX_DEVICES; u16Counter++)
+	{
+		sPWRNODE.sTemp.sStats.sSensor[u16Counter].s16Temp = 0;
+		sPWRNODE.sTemp.sStats.sSensor[u16Counter].u8Valid = 0U;
+		sPWRNODE.sTemp.sStats.sSensor[u16Counter].u8Group = 0U;
+		sPWRNODE.sTemp.sStats.sSensor[u16Counter].u8Bus = 0U;
+	}
+
+	sPWRNODE.sTemp.sStats.sPack.u16Count = 0U;
+	sPWRNODE.sTemp.sStats.sPack.s32Sum = 0;
+	sPWRNODE.sTemp.sStats.sPack.u64SumSq = 0U;
+
+	for(u16Counter = 0U; u16Counter < C_PWRCORE__BATTTEMP_NUM_GROUPS; u16Counter++)
+	{
+		sPWRNODE.sTemp.sStats.sGroup[u16Counter].u16Count = 0U;
+		sPWRNODE.sTemp.sStats.sGroup[u16Counter].s32Sum = 0;
+		sPWRNODE.sTemp.sStats.sGroup[u16Counter].u64SumSq = 0U;
+	}
+
+	for(u16Counter = 0U; u16Counter < C_LOCALDEF__LCCM644__MAX_1WIRE_CHANNELS; u16Counter++)
+	{
+		sPWRNODE.sTemp.sStats.sBus[u16Counter].u16Count = 0U;
+		sPWRNODE.sTemp.sStats.sBus[u16Counter].s32Sum = 0;
+		sPWRNODE.sTemp.sStats.sBus[u16Counter].u64SumSq = 0U;
+	}
+
+	for(u16Counter = 0U; u16Counter < (2U * C_PWRCORE__BATTTEMP_TREE_SIZE); u16Counter++)
+	{
+		sPWRNODE.sTemp.sStats.s16MaxTree[u16Counter] = C_PWRCORE__BATTTEMP_TREE_EMPTY_MAX;
+		sPWRNODE.sTemp.sStats.s16MinTree[u16Counter] = C_PWRCORE__BATTTEMP_TREE_EMPTY_MIN;
+	}
+
+	for(u16Counter = 0U; u16Counter < C_PWRCORE__BATTTEMP_NUM_HOT; u16Counter++)
+	{
+		sPWRNODE.sTemp.sStats.u16HotIndex[u16Counter] = 0U;
+	}
+	sPWRNODE.sTemp.sStats.u8NumHot = 0U;
+
+	sPWRNODE.sTemp.f32LowestTemp = 0.0F;
+	sPWRNODE.sTemp.u16LowestSensorIndex = 0U;
+	sPWRNODE.sTemp.f32TempVariance = 0.0F;
+}
+
+/***************************************************************************//**
+ * @brief
+ * Take a new reading from one DS18B20 into the statistics
+ *
+ * @note
+ * Called from the DS18B20 driver via C_LOCALDEF__LCCM644__TEMP_CALLBACK as each
+ * reading is stored. The sensor's old reading is taken out of the totals and the
+ * new one added, then the max/min trees are updated from the leaf up, so the
+ * cost does not depend on the number of sensors.
+ *
+ * @param[in]		u16SensorIndex			DS18B20 sensor index
+ * @st_funcMD5		73B97C187FF04019D1380BA114F5DB48
+ * @st_funcID		LCCM653R0.FILE.036.FUNC.002
+ */
+void vPWRNODE_BATTTEMP_STATS__Update(Luint16 u16SensorIndex)
+{
+	Lfloat32 f32Temp;
+	Luint16 u16User;
+	Luint8 u8Group;
+
+	if(u16SensorIndex < C_LOCALDEF__LCCM644__MAX_DEVICES)
+	{
+		//take out what this sensor added last time
+		vPWRNODE_BATTTEMP_STATS__Apply(u16SensorIndex, 0U);
+
+		f32Temp = f32DS18B20__Get_Temperature_DegC(u16SensorIndex);
+		u16User = u162DS18B20__Get_UserIndex(u16SensorIndex);
+		u8Group = (Luint8)(u16User >> 8U);
+
+		sPWRNODE.sTemp.sStats.sSensor[u16SensorIndex].u8Group = u8Group;
+		sPWRNODE.sTemp.sStats.sSensor[u16SensorIndex].u8Bus = u82DS18B20__Get_BusIndex(u16SensorIndex);
+		if(f32Temp < C_PWRCORE__BATTTEMP_FAULT_DEGC)
+		{
+			//the driver is never finer than 1/16 degC so this is exact
+			sPWRNODE.sTemp.sStats.sSensor[u16SensorIndex].s16Temp = (Lint16)(f32Temp * 16.0F);
+			sPWRNODE.sTemp.sStats.sSensor[u16SensorIndex].u8Valid = 1U;
+		}
+		else
+		{
+			//faulty sensor, keep it out of the stats
+			sPWRNODE.sTemp.sStats.sSensor[u16SensorIndex].u8Valid = 0U;
+		}
+
+		//put the new reading in
+		vPWRNODE_BATTTEMP_STATS__Apply(u16SensorIndex, 1U);
+
+		//the trees only hold the pack sensors
+		if((sPWRNODE.sTemp.sStats.sSensor[u16SensorIndex].u8Valid == 1U) && (u8Group != C_PWRCORE__BMS_TEMP_MASK))
+		{
+			vPWRNODE_BATTTEMP_STATS__Tree_Set(u16SensorIndex,
+											sPWRNODE.sTemp.sStats.sSensor[u16SensorIndex].s16Temp,
+											sPWRNODE.sTemp.sStats.sSensor[u16SensorIndex].s16Temp);
+		}
+		else
+		{
+			vPWRNODE_BATTTEMP_STATS__Tree_Set(u16SensorIndex, C_PWRCORE__BATTTEMP_TREE_EMPTY_MAX, C_PWRCORE__BATTTEMP_TREE_EMPTY_MIN);
+		}
+
+		vPWRNODE_BATTTEMP_STATS__Publish();
+	}
+	else
+	{
+		//out of range
+	}
+}
+
+/***************************************************************************//**
+ * @brief
+ * Refresh the list of the hottest pack sensors, hottest first
+ *
+ * @note
+ * Walks the max tree best first, each entry costs one path down the tree.
+ *
+ * @st_funcMD5		AD226CBF6E146386C60FDD01B17AA727
+ * @st_funcID		LCCM653R0.FILE.036.FUNC.003
+ */
+void vPWRNODE_BATTTEMP_STATS__Update_Hot(void)
+{
+	//each entry found can leave one sibling per level behind
+	Luint16 u16Cand[1U + (C_PWRCORE__BATTTEMP_NUM_HOT * C_PWRCORE__BATTTEMP_TREE_DEPTH)];
+	Luint16 u16NumCand;
+	Luint16 u16Counter;
+	Luint16 u16Best;
+	Luint16 u16Node;
+	Luint16 u16Left;
+	Luint8 u8NumHot;
+
+	u8NumHot = 0U;
+	u16Cand[0] = 1U;
+	u16NumCand = 1U;
+	while((u8NumHot < C_PWRCORE__BATTTEMP_NUM_HOT) && (u16NumCand > 0U))
+	{
+		//hottest candidate
+		u16Best = 0U;
+		for(u16Counter = 1U; u16Counter < u16NumCand; u16Counter++)
+		{
+			if(sPWRNODE.sTemp.sStats.s16MaxTree[u16Cand[u16Counter]] > sPWRNODE.sTemp.sStats.s16MaxTree[u16Cand[u16Best]])
+			{
+				u16Best = u16Counter;
+			}
+			else
+			{
+				//fall on
+			}
+		}
+		u16Node = u16Cand[u16Best];
+		u16NumCand--;
+		u16Cand[u16Best] = u16Cand[u16NumCand];
+
+		if(sPWRNODE.sTemp.sStats.s16MaxTree[u16Node] == C_PWRCORE__BATTTEMP_TREE_EMPTY_MAX)
+		{
+			//no more working sensors
+			u16NumCand = 0U;
+		}
+		else
+		{
+			//follow the max down, the other side may hold the next hottest
+			while(u16Node < C_PWRCORE__BATTTEMP_TREE_SIZE)
+			{
+				u16Left = u16Node << 1U;
+				if(sPWRNODE.sTemp.sStats.s16MaxTree[u16Left] == sPWRNODE.sTemp.sStats.s16MaxTree[u16Node])
+				{
+					u16Cand[u16NumCand] = u16Left + 1U;
+					u16Node = u16Left;
+				}
+				else
+				{
+					u16Cand[u16NumCand] = u16Left;
+					u16Node = u16Left + 1U;
+				}
+				u16NumCand++;
+			}
+
+			sPWRNODE.sTemp.sStats.u16HotIndex[u8NumHot] = u16Node - C_PWRCORE__BATTTEMP_TREE_SIZE;
+			u8NumHot++;
+		}
+	}
+
+	sPWRNODE.sTemp.sStats.u8NumHot = u8NumHot;
+}
+
+/***************************************************************************//**
+ * @brief
+ * Get the mean and variance of a user group
+ *
+ * @param[in]		u8Group					Upper byte of the user index
+ * @param[out]		*pf32Mean				Mean in degC
+ * @param[out]		*pf32Variance			Variance in degC^2
+ * @return			0 = success\n
+ *					-1 = no working sensors in the group\n
+ *					-2 = group out of range
+ * @st_funcMD5		9E8EDCB64BE72BD7FBCB95EA5B0B1FE2
+ * @st_funcID		LCCM653R0.FILE.036.FUNC.004
+ */
+Lint16 s16PWRNODE_BATTTEMP_STATS__Get_Group(Luint8 u8Group, Lfloat32 *pf32Mean, Lfloat32 *pf32Variance)
+{
+	Lint16 s16Return;
+
+	if(u8Group < C_PWRCORE__BATTTEMP_NUM_GROUPS)
+	{
+		s16Return = s16PWRNODE_BATTTEMP_STATS__Acc_Get(&sPWRNODE.sTemp.sStats.sGroup[u8Group], pf32Mean, pf32Variance);
+	}
+	else
+	{
+		s16Return = -2;
+	}
+
+	return s16Return;
+}
+
+/***************************************************************************//**
+ * @brief
+ * Get the mean and variance of a 1-Wire bus
+ *
+ * @param[in]		u8Bus					1-Wire channel index
+ * @param[out]		*pf32Mean				Mean in degC
+ * @param[out]		*pf32Variance			Variance in degC^2
+ * @return			0 = success\n
+ *					-1 = no working sensors on the bus\n
+ *					-2 = bus out of range
+ * @st_funcMD5		05B15E9F18F6426D1112D3136B1824DB
+ * @st_funcID		LCCM653R0.FILE.036.FUNC.005
+ */
+Lint16 s16PWRNODE_BATTTEMP_STATS__Get_Bus(Luint8 u8Bus, Lfloat32 *pf32Mean, Lfloat32 *pf32Variance)
+{
+	Lint16 s16Return;
+
+	if(u8Bus < C_LOCALDEF__LCCM644__MAX_1WIRE_CHANNELS)
+	{
+		s16Return = s16PWRNODE_BATTTEMP_STATS__Acc_Get(&sPWRNODE.sTemp.sStats.sBus[u8Bus], pf32Mean, pf32Variance);
+	}
+	else
+	{
+		s16Return = -2;
+	}
+
+	return s16Return;
+}
+
+//add or remove what a sensor holds from the pack, group and bus totals
+static void vPWRNODE_BATTTEMP_STATS__Apply(Luint16 u16SensorIndex, Luint8 u8Add)
+{
+	Lint16 s16Temp;
+	Luint8 u8Group;
+	Luint8 u8Bus;
+
+	if(sPWRNODE.sTemp.sStats.sSensor[u16SensorIndex].u8Valid == 1U)
+	{
+		s16Temp = sPWRNODE.sTemp.sStats.sSensor[u16SensorIndex].s16Temp;
+		u8Group = sPWRNODE.sTemp.sStats.sSensor[u16SensorIndex].u8Group;
+		u8Bus = sPWRNODE.sTemp.sStats.sSensor[u16SensorIndex].u8Bus;
+
+		if(u8Add == 1U)
+		{
+			if(u8Group != C_PWRCORE__BMS_TEMP_MASK)
+			{
+				vPWRNODE_BATTTEMP_STATS__Acc_Add(&sPWRNODE.sTemp.sStats.sPack, s16Temp);
+			}
+			else
+			{
+				//BMS sensors are not part of the pack
+			}
+			if(u8Group < C_PWRCORE__BATTTEMP_NUM_GROUPS)
+			{
+				vPWRNODE_BATTTEMP_STATS__Acc_Add(&sPWRNODE.sTemp.sStats.sGroup[u8Group], s16Temp);
+			}
+			else
+			{
+				//fall on
+			}
+			if(u8Bus < C_LOCALDEF__LCCM644__MAX_1WIRE_CHANNELS)
+			{
+				vPWRNODE_BATTTEMP_STATS__Acc_Add(&sPWRNODE.sTemp.sStats.sBus[u8Bus], s16Temp);
+			}
+			else
+			{
+				//fall on
+			}
+		}
+		else
+		{
+			if(u8Group != C_PWRCORE__BMS_TEMP_MASK)
+			{
+				vPWRNODE_BATTTEMP_STATS__Acc_Remove(&sPWRNODE.sTemp.sStats.sPack, s16Temp);
+			}
+			else
+			{
+				//BMS sensors are not part of the pack
+			}
+			if(u8Group < C_PWRCORE__BATTTEMP_NUM_GROUPS)
+			{
+				vPWRNODE_BATTTEMP_STATS__Acc_Remove(&sPWRNODE.sTemp.sStats.sGroup[u8Group], s16Temp);
+			}
+			else
+			{
+				//fall on
+			}
+			if(u8Bus < C_LOCALDEF__LCCM644__MAX_1WIRE_CHANNELS)
+			{
+				vPWRNODE_BATTTEMP_STATS__Acc_Remove(&sPWRNODE.sTemp.sStats.sBus[u8Bus], s16Temp);
+			}
+			else
+			{
+				//fall on
+			}
+		}
+	}
+	else
+	{
+		//nothing counted for this sensor
+	}
+}
+
+//add one reading to a set of totals
+static void vPWRNODE_BATTTEMP_STATS__Acc_Add(TS_PWR_BATT_TEMP__ACC *pAcc, Lint16 s16Temp)
+{
+	pAcc->u16Count++;
+	pAcc->s32Sum += (Lint32)s16Temp;
+	pAcc->u64SumSq += (Luint64)((Lint32)s16Temp * (Lint32)s16Temp);
+}
+
+//take one reading back out of a set of totals
+static void vPWRNODE_BATTTEMP_STATS__Acc_Remove(TS_PWR_BATT_TEMP__ACC *pAcc, Lint16 s16Temp)
+{
+	pAcc->u16Count--;
+	pAcc->s32Sum -= (Lint32)s16Temp;
+	pAcc->u64SumSq -= (Luint64)((Lint32)s16Temp * (Lint32)s16Temp);
+}
+
+//mean and variance in degC from a set of totals
+static Lint16 s16PWRNODE_BATTTEMP_STATS__Acc_Get(const TS_PWR_BATT_TEMP__ACC *pAcc, Lfloat32 *pf32Mean, Lfloat32 *pf32Variance)
+{
+	Lint16 s16Return;
+	Lint64 s64Num;
+	Lfloat32 f32Count;
+
+	if(pAcc->u16Count > 0U)
+	{
+		f32Count = (Lfloat32)pAcc->u16Count;
+		*pf32Mean = ((Lfloat32)pAcc->s32Sum / f32Count) / 16.0F;
+
+		//n.sum(x^2) - sum(x)^2 in integers so nothing cancels in float
+		s64Num = ((Lint64)pAcc->u16Count * (Lint64)pAcc->u64SumSq) - ((Lint64)pAcc->s32Sum * (Lint64)pAcc->s32Sum);
+		*pf32Variance = ((Lfloat32)s64Num / (f32Count * f32Count)) / 256.0F;
+
+		s16Return = 0;
+	}
+	else
+	{
+		*pf32Mean = 0.0F;
+		*pf32Variance = 0.0F;
+		s16Return = -1;
+	}
+
+	return s16Return;
+}
+
+//set a leaf and rebuild its path to the root
+static void vPWRNODE_BATTTEMP_STATS__Tree_Set(Luint16 u16SensorIndex, Lint16 s16Max, Lint16 s16Min)
+{
+	Luint16 u16Node;
+	Luint16 u16Left;
+
+	u16Node = u16SensorIndex + C_PWRCORE__BATTTEMP_TREE_SIZE;
+	sPWRNODE.sTemp.sStats.s16MaxTree[u16Node] = s16Max;
+	sPWRNODE.sTemp.sStats.s16MinTree[u16Node] = s16Min;
+
+	while(u16Node > 1U)
+	{
+		u16Node >>= 1U;
+		u16Left = u16Node << 1U;
+
+		if(sPWRNODE.sTemp.sStats.s16MaxTree[u16Left] >= sPWRNODE.sTemp.sStats.s16MaxTree[u16Left + 1U])
+		{
+			sPWRNODE.sTemp.sStats.s16MaxTree[u16Node] = sPWRNODE.sTemp.sStats.s16MaxTree[u16Left];
+		}
+		else
+		{
+			sPWRNODE.sTemp.sStats.s16MaxTree[u16Node] = sPWRNODE.sTemp.sStats.s16MaxTree[u16Left + 1U];
+		}
+
+		if(sPWRNODE.sTemp.sStats.s16MinTree[u16Left] <= sPWRNODE.sTemp.sStats.s16MinTree[u16Left + 1U])
+		{
+			sPWRNODE.sTemp.sStats.s16MinTree[u16Node] = sPWRNODE.sTemp.sStats.s16MinTree[u16Left];
+		}
+		else
+		{
+			sPWRNODE.sTemp.sStats.s16MinTree[u16Node] = sPWRNODE.sTemp.sStats.s16MinTree[u16Left + 1U];
+		}
+	}
+}
+
+//sensor index holding the value of a node, either tree
+static Luint16 u16PWRNODE_BATTTEMP_STATS__Tree_Find(const Lint16 *ps16Tree, Luint16 u16Node)
+{
+	Luint16 u16Left;
+
+	while(u16Node < C_PWRCORE__BATTTEMP_TREE_SIZE)
+	{
+		u16Left = u16Node << 1U;
+		if(ps16Tree[u16Left] == ps16Tree[u16Node])
+		{
+			u16Node = u16Left;
+		}
+		else
+		{
+			u16Node = u16Left + 1U;
+		}
+	}
+
+	return u16Node - C_PWRCORE__BATTTEMP_TREE_SIZE;
+}
+
+//update the pack figures the rest of the node uses
+static void vPWRNODE_BATTTEMP_STATS__Publish(void)
+{
+	Lfloat32 f32Mean;
+	Lfloat32 f32Variance;
+
+	if(sPWRNODE.sTemp.sStats.s16MaxTree[1] != C_PWRCORE__BATTTEMP_TREE_EMPTY_MAX)
+	{
+		sPWRNODE.sTemp.f32HighestTemp = (Lfloat32)sPWRNODE.sTemp.sStats.s16MaxTree[1] / 16.0F;
+		sPWRNODE.sTemp.u16HighestSensorIndex = u16PWRNODE_BATTTEMP_STATS__Tree_Find(&sPWRNODE.sTemp.sStats.s16MaxTree[0], 1U);
+		sPWRNODE.sTemp.f32LowestTemp = (Lfloat32)sPWRNODE.sTemp.sStats.s16MinTree[1] / 16.0F;
+		sPWRNODE.sTemp.u16LowestSensorIndex = u16PWRNODE_BATTTEMP_STATS__Tree_Find(&sPWRNODE.sTemp.sStats.s16MinTree[0], 1U);
+	}
+	else
+	{
+		//no working pack sensors
+		sPWRNODE.sTemp.f32HighestTemp = 0.0F;
+		sPWRNODE.sTemp.u16HighestSensorIndex = 0U;
+		sPWRNODE.sTemp.f32LowestTemp = 0.0F;
+		sPWRNODE.sTemp.u16LowestSensorIndex = 0U;
+	}
+
+	(void)s16PWRNODE_BATTTEMP_STATS__Acc_Get(&sPWRNODE.sTemp.sStats.sPack, &f32Mean, &f32Variance);
+	sPWRNODE.sTemp.f32AverageTemp = f32Mean;
+	sPWRNODE.sTemp.f32TempVariance = f32Variance;
+}
+
+//safetys
+#if C_LOCALDEF__LCCM644__MAX_DEVICES > C_PWRCORE__BATTTEMP_TREE_SIZE
+	//increase C_PWRCORE__BATTTEMP_TREE_DEPTH
+	#error
+#endif
+#if C_LOCALDEF__LCCM644__ENABLE_TEMP_CALLBACK != 1U
+	//the stats are fed from the DS18B20 driver
+	#error
+#endif
+
+#endif //C_LOCALDEF__LCCM653__ENABLE_BATT_TEMP
+#endif //#if C_LOCALDEF__LCCM653__ENABLE_THIS_MODULE == 1U
+//safetys
+#ifndef C_LOCALDEF__LCCM653__ENABLE_THIS_MODULE
+	#error
+#endif
+/** @} */
+/** @} */
+/** @} */
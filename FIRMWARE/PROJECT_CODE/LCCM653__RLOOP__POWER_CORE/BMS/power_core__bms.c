@@ -23,16 +23,54 @@
 #if C_LOCALDEF__LCCM653__ENABLE_BMS == 1U
 
 extern struct _strPWRNODE sPWRNODE;
+#if C_LOCALDEF__BMS_REVISION == 1U
+	extern struct _str6870 sATA6870;
+#elif C_LOCALDEF__BMS_REVISION == 2U
+	extern TS_BQ76__MAIN sBQ76;
+#else
+	#error
+#endif
+
+//locals
+static void vPWRNODE_BMS__Take_Snapshot(void);
 
 /***************************************************************************//**
  * @brief
  * Init the battery management system
  * 
- * @st_funcMD5		270D9FCF297F4E126AB47ABD1EAA4572
+ * @st_funcMD5		A8F5242F71EF8F823930CDBA132E6DCD
  * @st_funcID		LCCM653R0.FILE.008.FUNC.001
  */
 void vPWRNODE_BMS__Init(void)
 {
+	Luint8 u8Buffer;
+	Luint16 u16Counter;
+
+	//nothing published until the first scan completes
+	for(u8Buffer = 0U; u8Buffer < 2U; u8Buffer++)
+	{
+		sPWRNODE.sBMS.sSnapshot[u8Buffer].u32UpdateCount = 0U;
+		sPWRNODE.sBMS.sSnapshot[u8Buffer].u32Timestamp_x10ms = 0U;
+		for(u16Counter = 0U; u16Counter < C_PWRCORE__BMS_NUM_CELLS; u16Counter++)
+		{
+			sPWRNODE.sBMS.sSnapshot[u8Buffer].f32CellVoltage[u16Counter] = 0.0F;
+		}
+		for(u16Counter = 0U; u16Counter < C_PWRCORE__BMS_NUM_DEVICES; u16Counter++)
+		{
+			sPWRNODE.sBMS.sSnapshot[u8Buffer].f32DeviceTemp[u16Counter] = C_PWRCORE__BMS_DEVICE_TEMP_INVALID;
+		}
+		sPWRNODE.sBMS.sSnapshot[u8Buffer].f32Highest = 0.0F;
+		sPWRNODE.sBMS.sSnapshot[u8Buffer].f32Lowest = 0.0F;
+		sPWRNODE.sBMS.sSnapshot[u8Buffer].u16HighestIndex = 0U;
+		sPWRNODE.sBMS.sSnapshot[u8Buffer].u16LowestIndex = 0U;
+		sPWRNODE.sBMS.sSnapshot[u8Buffer].f32Imbalance = 0.0F;
+		sPWRNODE.sBMS.sSnapshot[u8Buffer].f32PackVoltage = 0.0F;
+	}
+	sPWRNODE.sBMS.u8Published = 0U;
+	sPWRNODE.sBMS.u32Timer_x10ms = 0U;
+
+	//BMS fault tree
+	vSIL3_FAULTTREE__Init(&sPWRNODE.sBMS.sFaultFlags);
 
 #ifndef WIN32
 	#if C_LOCALDEF__BMS_REVISION == 1U
@@ -83,7 +121,7 @@ void vPWRNODE_BMS__Init(void)
  * @brief
  * Process any battery management system items
  * 
- * @st_funcMD5		15B2FAA1BAD482B0EC323B1CBE361248
+ * @st_funcMD5		641B80BEC78A8092158608A5B83E94D3
  * @st_funcID		LCCM653R0.FILE.008.FUNC.002
  */
 void vPWRNODE_BMS__Process(void)
@@ -98,10 +136,27 @@ void vPWRNODE_BMS__Process(void)
 		vATA6870__Process();
 	#elif C_LOCALDEF__BMS_REVISION == 2U
 		vBQ76__Process();
+	#else
+		#error
+	#endif
+
+	//publish each scan once as it completes
+	if(u32PWRNODE_BMS__Get_VoltsUpdateCount() != sPWRNODE.sBMS.sSnapshot[sPWRNODE.sBMS.u8Published].u32UpdateCount)
+	{
+		vPWRNODE_BMS__Take_Snapshot();
+	}
+	else
+	{
+		//no new scan
+	}
+
+	#if C_LOCALDEF__BMS_REVISION == 1U
+		//nothing more
+	#elif C_LOCALDEF__BMS_REVISION == 2U
 		vPWRNODE_BMS_FANS__Process();
 
 		//Verify all cells are above the minimum voltage spec
-		if(f32BQ76_CELLS__Get_LowestVoltage() <= C_PWRCORE__UNDERVOLTAGE_KILL)
+		if(f32PWRNODE_BMS__Cell_Get_LowestVoltage() <= C_PWRCORE__UNDERVOLTAGE_KILL)
 		{
             #if C_LOCALDEF__LCCM653__ENABLE_DC_CONVERTER == 1U
 		        vPWRNODE_DC__Pod_Safe_Go();
@@ -113,7 +168,7 @@ void vPWRNODE_BMS__Process(void)
 		}
 
 		//Verify all cells are below the maximum voltage spec
-        if(f32BQ76_CELLS__Get_HighestVoltage() >= C_PWRCORE__OVERVOLTAGE_KILL)
+        if(f32PWRNODE_BMS__Cell_Get_HighestVoltage() >= C_PWRCORE__OVERVOLTAGE_KILL)
         {
             #if C_LOCALDEF__LCCM653__ENABLE_DC_CONVERTER == 1U
                 vPWRNODE_DC__Pod_Safe_Go();
@@ -124,16 +179,26 @@ void vPWRNODE_BMS__Process(void)
             //TODO: clear fault flag
         }
 
-        //TODO: Check voltage update count
-
-        //Move to 10 ms ISR?
-        f32MaxV = C_PWRCORE__OVERVOLTAGE_KILL-.1;
-        f32MinV = C_PWRCORE__UNDERVOLTAGE_KILL+.1;
-        f32Temp = ((f32PWRNODE_BMS__Cell_Get_LowestVoltage() - f32MinV)/(f32MaxV - f32MinV))*100.0F;
-        if(f32Temp < 0 || f32Temp > 100){
-            //TODO: Fault
-        }else{
-            sPWRNODE.sBMS.f32StateOfCharge = f32Temp;
+        //the kills above are blind if the scan has stalled
+        if(u32PWRNODE_BMS__Get_SnapshotAge_x10ms() > C_PWRCORE__BMS_SNAPSHOT_TIMEOUT_x10ms)
+        {
+            #if C_LOCALDEF__LCCM653__ENABLE_DC_CONVERTER == 1U
+                vPWRNODE_DC__Pod_Safe_Go();
+            #endif
+            vSIL3_FAULTTREE__Set_Flag(&sPWRNODE.sBMS.sFaultFlags, C_BMS__FAULT_INDEX__00);
+            vSIL3_FAULTTREE__Set_Flag(&sPWRNODE.sBMS.sFaultFlags, C_BMS__FAULT_INDEX__03);
+        }
+        else
+        {
+            //Move to 10 ms ISR?
+            f32MaxV = C_PWRCORE__OVERVOLTAGE_KILL-.1;
+            f32MinV = C_PWRCORE__UNDERVOLTAGE_KILL+.1;
+            f32Temp = ((f32PWRNODE_BMS__Cell_Get_LowestVoltage() - f32MinV)/(f32MaxV - f32MinV))*100.0F;
+            if(f32Temp < 0 || f32Temp > 100){
+                //TODO: Fault
+            }else{
+                sPWRNODE.sBMS.f32StateOfCharge = f32Temp;
+            }
         }
 
 	#else
@@ -157,57 +222,38 @@ Luint32 u32PWRNODE_BMS__Get_DeviceFlags(Luint8 u8DeviceIndex)
 
 /***************************************************************************//**
  * @brief
- * Get the highest cell voltage
+ * Get the highest cell voltage from the last snapshot
  * 
- * @st_funcMD5		CCDA9D0AA2A185CC2B0AED32C6C65C05
+ * @st_funcMD5		6B9BC46F1EB653E7A42A2961432C8BF7
  * @st_funcID		LCCM653R0.FILE.008.FUNC.003
  */
 Lfloat32 f32PWRNODE_BMS__Cell_Get_HighestVoltage(void)
 {
-	#if C_LOCALDEF__BMS_REVISION == 1U
-		return f32ATA6870_CELL__Get_HighestVoltage();
-	#elif C_LOCALDEF__BMS_REVISION == 2U
-		return f32BQ76_CELLS__Get_HighestVoltage();
-	#else
-		#error
-	#endif
+	return sPWRNODE.sBMS.sSnapshot[sPWRNODE.sBMS.u8Published].f32Highest;
 }
 
 /***************************************************************************//**
  * @brief
- * Returns the last computed lowest cell voltage.
+ * Returns the lowest cell voltage from the last snapshot.
  * 
- * @st_funcMD5		71C954368FC27625363D95A446DA7B32
+ * @st_funcMD5		4ED8676A3C259B5154B659F1DAD3D6CA
  * @st_funcID		LCCM653R0.FILE.008.FUNC.007
  */
 Lfloat32 f32PWRNODE_BMS__Cell_Get_LowestVoltage(void)
 {
-	#if C_LOCALDEF__BMS_REVISION == 1U
-		return f32ATA6870_CELL__Get_LowestVoltage();
-	#elif C_LOCALDEF__BMS_REVISION == 2U
-		return f32BQ76_CELLS__Get_LowestVoltage();
-	#else
-		#error
-	#endif
+	return sPWRNODE.sBMS.sSnapshot[sPWRNODE.sBMS.u8Published].f32Lowest;
 }
 
 /***************************************************************************//**
  * @brief
- * Returns the entire pack voltage
+ * Returns the entire pack voltage from the last snapshot
  * 
- * @st_funcMD5		1FEB2A9DBECB7ED0651F480855A300D6
+ * @st_funcMD5		5CE4DECB46942D69B5969193E4F7682C
  * @st_funcID		LCCM653R0.FILE.008.FUNC.004
  */
 Lfloat32 f32PWRNODE_BMS__Get_PackVoltage(void)
 {
-
-	#if C_LOCALDEF__BMS_REVISION == 1U
-		return f32ATA6870_CELL__Get_PackVoltage();
-	#elif C_LOCALDEF__BMS_REVISION == 2U
-		return f32BQ76_BATTERY__Get_PackVoltage();
-	#else
-		#error
-	#endif
+	return sPWRNODE.sBMS.sSnapshot[sPWRNODE.sBMS.u8Published].f32PackVoltage;
 }
 
 
@@ -311,6 +357,156 @@ Luint32 u32PWRNODE_BMS__Get_VoltsUpdateCount(void)
 
 }
 
+/***************************************************************************//**
+ * @brief
+ * The last published pack snapshot. It is not written again until two more
+ * scans have completed, so read what you need in the same pass.
+ * 
+ * @return			The published snapshot
+ * @st_funcMD5		576F513FD85DD317F41CA1C1913DC958
+ * @st_funcID		LCCM653R0.FILE.008.FUNC.011
+ */
+const TS_PWR_BMS__SNAPSHOT * pPWRNODE_BMS__Get_Snapshot(void)
+{
+	return &sPWRNODE.sBMS.sSnapshot[sPWRNODE.sBMS.u8Published];
+}
+
+/***************************************************************************//**
+ * @brief
+ * Get one cell voltage from the last snapshot
+ * 
+ * @param[in]		u16CellIndex			Zero based cell index for all cells in the battery
+ * @return			Cell voltage, 0.0 for a bad index
+ * @st_funcMD5		8771F8330F7D4F3D920E9444572AF2A9
+ * @st_funcID		LCCM653R0.FILE.008.FUNC.012
+ */
+Lfloat32 f32PWRNODE_BMS__Cell_Get_Voltage(Luint16 u16CellIndex)
+{
+	Lfloat32 f32Return;
+
+	if(u16CellIndex < C_PWRCORE__BMS_NUM_CELLS)
+	{
+		f32Return = sPWRNODE.sBMS.sSnapshot[sPWRNODE.sBMS.u8Published].f32CellVoltage[u16CellIndex];
+	}
+	else
+	{
+		//error
+		f32Return = 0.0F;
+	}
+
+	return f32Return;
+}
+
+/***************************************************************************//**
+ * @brief
+ * Difference between the highest and lowest cell in the last snapshot
+ * 
+ * @st_funcMD5		1B1F98F2E1F3CE7BFA8DDC997B5888CF
+ * @st_funcID		LCCM653R0.FILE.008.FUNC.013
+ */
+Lfloat32 f32PWRNODE_BMS__Get_Imbalance(void)
+{
+	return sPWRNODE.sBMS.sSnapshot[sPWRNODE.sBMS.u8Published].f32Imbalance;
+}
+
+/***************************************************************************//**
+ * @brief
+ * How long ago the last snapshot was published, lets a consumer spot a
+ * stalled scan.
+ * 
+ * @return			Age in 10ms ticks
+ * @st_funcMD5		C8E0F1FF08F5F807C8EC2BEE612A593A
+ * @st_funcID		LCCM653R0.FILE.008.FUNC.014
+ */
+Luint32 u32PWRNODE_BMS__Get_SnapshotAge_x10ms(void)
+{
+	//unsigned so the wrap falls out
+	return sPWRNODE.sBMS.u32Timer_x10ms - sPWRNODE.sBMS.sSnapshot[sPWRNODE.sBMS.u8Published].u32Timestamp_x10ms;
+}
+
+/***************************************************************************//**
+ * @brief
+ * 10ms timer input for the snapshot timestamps
+ * 
+ * @st_funcMD5		77736643BCBE5654C08BBA8316972340
+ * @st_funcID		LCCM653R0.FILE.008.FUNC.015
+ */
+void vPWRNODE_BMS__10MS_ISR(void)
+{
+	sPWRNODE.sBMS.u32Timer_x10ms++;
+}
+
+//copy the completed scan into the spare snapshot, work out the stats once, then publish it
+static void vPWRNODE_BMS__Take_Snapshot(void)
+{
+	TS_PWR_BMS__SNAPSHOT *pSnapshot;
+	Luint16 u16Counter;
+	Lfloat32 f32Cell;
+
+	//the one readers are not looking at
+	pSnapshot = &sPWRNODE.sBMS.sSnapshot[sPWRNODE.sBMS.u8Published ^ 1U];
+
+	pSnapshot->u32UpdateCount = u32PWRNODE_BMS__Get_VoltsUpdateCount();
+	pSnapshot->u32Timestamp_x10ms = sPWRNODE.sBMS.u32Timer_x10ms;
+
+	pSnapshot->f32Highest = 0.0F;
+	pSnapshot->f32Lowest = 100.0F;
+	pSnapshot->u16HighestIndex = 0U;
+	pSnapshot->u16LowestIndex = 0U;
+
+	for(u16Counter = 0U; u16Counter < C_PWRCORE__BMS_NUM_CELLS; u16Counter++)
+	{
+		#if C_LOCALDEF__BMS_REVISION == 1U
+			f32Cell = sATA6870.f32Voltage[u16Counter];
+		#else
+			f32Cell = sBQ76.sCell[u16Counter].f32CellVoltage;
+		#endif
+
+		pSnapshot->f32CellVoltage[u16Counter] = f32Cell;
+
+		if(f32Cell > pSnapshot->f32Highest)
+		{
+			pSnapshot->f32Highest = f32Cell;
+			pSnapshot->u16HighestIndex = u16Counter;
+		}
+		else
+		{
+			//fall on
+		}
+
+		if(f32Cell < pSnapshot->f32Lowest)
+		{
+			pSnapshot->f32Lowest = f32Cell;
+			pSnapshot->u16LowestIndex = u16Counter;
+		}
+		else
+		{
+			//fall on
+		}
+	}
+
+	pSnapshot->f32Imbalance = pSnapshot->f32Highest - pSnapshot->f32Lowest;
+
+	for(u16Counter = 0U; u16Counter < C_PWRCORE__BMS_NUM_DEVICES; u16Counter++)
+	{
+		#if C_LOCALDEF__BMS_REVISION == 1U
+			pSnapshot->f32DeviceTemp[u16Counter] = sATA6870.f32NTCTemperatureReading[u16Counter];
+		#else
+			//BQ76 thermistor inputs are not read yet
+			pSnapshot->f32DeviceTemp[u16Counter] = C_PWRCORE__BMS_DEVICE_TEMP_INVALID;
+		#endif
+	}
+
+	#if C_LOCALDEF__BMS_REVISION == 1U
+		pSnapshot->f32PackVoltage = f32ATA6870_CELL__Get_PackVoltage();
+	#else
+		pSnapshot->f32PackVoltage = f32BQ76_BATTERY__Get_PackVoltage();
+	#endif
+
+	//publish
+	sPWRNODE.sBMS.u8Published ^= 1U;
+}
+
 
 #endif //C_LOCALDEF__LCCM653__ENABLE_BMS
 
@@ -50,7 +50,7 @@ void vPWR_BMS_ETH__Init(void)
  * Tx an eth packet
  * 
  * @param[in]		ePacketType				The packet type.
- * @st_funcMD5		8F66B9F76D2E197949E7C8F228310ABE
+ * @st_funcMD5		25C039E5C52BFABB4E09E2D88EB3F016
  * @st_funcID		LCCM653R0.FILE.032.FUNC.002
  */
 void vPWR_BMS_ETH__Transmit(E_NET__PACKET_T ePacketType)
@@ -62,6 +62,9 @@ void vPWR_BMS_ETH__Transmit(E_NET__PACKET_T ePacketType)
 	Luint16 u16Length;
 	Luint8 u8Device;
 	Luint8 u8Counter;
+#if C_LOCALDEF__LCCM653__ENABLE_BMS == 1U
+	const TS_PWR_BMS__SNAPSHOT *pSnapshot;
+#endif
 
 	pu8Buffer = 0;
 
@@ -109,6 +112,12 @@ void vPWR_BMS_ETH__Transmit(E_NET__PACKET_T ePacketType)
 
 				//latch status
 				u16Length += 1U;
+
+				//BMS flags, imbalance, high and low cell index
+				u16Length += 12U;
+
+				//cell monitor temps
+				u16Length += (C_LOCALDEF__LCCM715__NUM_DEVICES * 4U);
 			#else
 				#error
 			#endif
@@ -222,7 +231,11 @@ void vPWR_BMS_ETH__Transmit(E_NET__PACKET_T ePacketType)
 						for(u8Counter = 0; u8Counter < C_ATA6870__MAX_CELLS; u8Counter++)
 						{
 							//Cell voltage
-							vSIL3_NUM_CONVERT__Array_F32(pu8Buffer, sATA6870.f32Voltage[(u8Device * C_ATA6870__MAX_CELLS) + u8Counter]);
+							#if C_LOCALDEF__LCCM653__ENABLE_BMS == 1U
+								vSIL3_NUM_CONVERT__Array_F32(pu8Buffer, f32PWRNODE_BMS__Cell_Get_Voltage(((Luint16)u8Device * C_ATA6870__MAX_CELLS) + u8Counter));
+							#else
+								vSIL3_NUM_CONVERT__Array_F32(pu8Buffer, 0.0F);
+							#endif
 							pu8Buffer += 4U;
 						}
 					}
@@ -323,7 +336,11 @@ void vPWR_BMS_ETH__Transmit(E_NET__PACKET_T ePacketType)
 				for(u8Counter = 0; u8Counter < C_BQ76__TOTAL_CELLS; u8Counter++)
 				{
 					//Cell voltage
-					vSIL3_NUM_CONVERT__Array_F32(pu8Buffer, f32BQ76__Get_CellVoltage(u8Counter));
+					#if C_LOCALDEF__LCCM653__ENABLE_BMS == 1U
+						vSIL3_NUM_CONVERT__Array_F32(pu8Buffer, f32PWRNODE_BMS__Cell_Get_Voltage(u8Counter));
+					#else
+						vSIL3_NUM_CONVERT__Array_F32(pu8Buffer, 0.0F);
+					#endif
 					pu8Buffer += 4U;
 
 				}
@@ -430,6 +447,44 @@ void vPWR_BMS_ETH__Transmit(E_NET__PACKET_T ePacketType)
                 pu8Buffer[0] = sPWRNODE.sDC.u8RelayState;
                 pu8Buffer += 1U;
 
+				#if C_LOCALDEF__LCCM653__ENABLE_BMS == 1U
+					//BMS fault flags
+					vSIL3_NUM_CONVERT__Array_U32(pu8Buffer, sPWRNODE.sBMS.sFaultFlags.u32Flags[0]);
+					pu8Buffer += 4U;
+
+					//imbalance
+					vSIL3_NUM_CONVERT__Array_F32(pu8Buffer, f32PWRNODE_BMS__Get_Imbalance());
+					pu8Buffer += 4U;
+
+					//where the highest and lowest cells are
+					pSnapshot = pPWRNODE_BMS__Get_Snapshot();
+					vSIL3_NUM_CONVERT__Array_U16(pu8Buffer, pSnapshot->u16HighestIndex);
+					pu8Buffer += 2U;
+					vSIL3_NUM_CONVERT__Array_U16(pu8Buffer, pSnapshot->u16LowestIndex);
+					pu8Buffer += 2U;
+
+					//cell monitor temps, C_PWRCORE__BMS_DEVICE_TEMP_INVALID until the BQ76 thermistors are read
+					for(u8Device = 0U; u8Device < C_LOCALDEF__LCCM715__NUM_DEVICES; u8Device++)
+					{
+						vSIL3_NUM_CONVERT__Array_F32(pu8Buffer, pSnapshot->f32DeviceTemp[u8Device]);
+						pu8Buffer += 4U;
+					}
+				#else
+					vSIL3_NUM_CONVERT__Array_U32(pu8Buffer, 0xFFFFFFFFU);
+					pu8Buffer += 4U;
+					vSIL3_NUM_CONVERT__Array_F32(pu8Buffer, 0.0F);
+					pu8Buffer += 4U;
+					vSIL3_NUM_CONVERT__Array_U16(pu8Buffer, 0U);
+					pu8Buffer += 2U;
+					vSIL3_NUM_CONVERT__Array_U16(pu8Buffer, 0U);
+					pu8Buffer += 2U;
+					for(u8Device = 0U; u8Device < C_LOCALDEF__LCCM715__NUM_DEVICES; u8Device++)
+					{
+						vSIL3_NUM_CONVERT__Array_F32(pu8Buffer, C_PWRCORE__BMS_DEVICE_TEMP_INVALID);
+						pu8Buffer += 4U;
+					}
+				#endif
+
 				break;
 
 #else
@@ -0,0 +1,528 @@
+#include <localdef.h>
+
+#ifndef C_LOCALDEF__LCCM653__ENABLE_THIS_MODULE
+	#error
+#endif
+
+#if C_LOCALDEF__LCCM653__ENABLE_THIS_MODULE == 1U
+#if C_LOCALDEF__LCCM653__ENABLE_TEST_SPEC == 1U
+#if C_LOCALDEF__LCCM653__ENABLE_BATT_TEMP == 1U
+/*
+VB.NET CALL
+<System.Runtime.InteropServices.DllImport(C_DLL_NAME, CallingConvention:=System.Runtime.InteropServices.CallingConvention.Cdecl)> Private Shared Sub vLCCM653R0_TS_000()
+End Sub
+*/
+extern struct _strDS18B20 sDS18B20;
+
+void vLCCM653R0_TS_000_TCASE_001(void);
+void vLCCM653R0_TS_000_TCASE_002(void);
+
+static void vLCCM653R0_TS_000__Setup(void);
+static void vLCCM653R0_TS_000__Set_Reading(Luint16 u16SensorIndex, Lfloat32 f32Temp);
+static Luint8 u8LCCM653R0_TS_000__Check(void);
+static Luint8 u8LCCM653R0_TS_000__Check_Acc(Lint16 s16Result, Lfloat32 f32Mean, Lfloat32 f32Variance, Luint16 u16Count, Lfloat64 f64Sum, Lfloat64 f64SumSq);
+static Luint8 u8LCCM653R0_TS_000__Is_Pack(Luint16 u16SensorIndex);
+static Luint32 u32LCCM653R0_TS_000__Random(void);
+
+//the driver's reading before a sensor has answered, >= C_PWRCORE__BATTTEMP_FAULT_DEGC
+#define C_TS_000__NO_READING					(127.0F)
+
+//random readings to apply
+#define C_TS_000__NUM_UPDATES					(4000U)
+
+//one reading in this many is a dropout
+#define C_TS_000__DROPOUT_RATE					(8U)
+
+//every sensor with this index modulo is on the BMS
+#define C_TS_000__BMS_SPACING					(13U)
+
+//pack sensor groups used, the BMS group is on top of these
+#define C_TS_000__NUM_PACK_GROUPS				(12U)
+
+//allowed error on a mean in degC, and on a variance relative to its size
+#define C_TS_000__MEAN_TOL						(0.001)
+#define C_TS_000__VARIANCE_TOL					(0.0001)
+
+static Luint32 u32TS_000__Seed;
+
+
+//Function to call the tests for this test specification
+void vLCCM653R0_TS_000(void)
+{
+
+	//Call the test cases
+	vLCCM653R0_TS_000_TCASE_001();
+	vLCCM653R0_TS_000_TCASE_002();
+
+}
+
+//Individual Test Cases can be found below
+/***************************************************************************//**
+ * @st_test_case_id
+ * LCCM653R0.TS.000.TCASE.001
+ * @st_test_desc
+ * Random readings and dropouts across every sensor. After each reading the
+ * pack mean, variance, highest and lowest, the group and bus totals and the
+ * hot list must match a brute force recompute over all the sensors.
+ *
+*/
+void vLCCM653R0_TS_000_TCASE_001(void)
+{
+	Luint32 u32Counter;
+	Luint32 u32Random;
+	Luint16 u16Sensor;
+	Lfloat32 f32Temp;
+	Luint8 u8Test;
+	DEBUG_PRINT("START:LCCM653R0.TS.000.TCASE.001\r\n");
+
+	u8Test = 1U;
+
+	//setup
+	vLCCM653R0_TS_000__Setup();
+
+	for(u32Counter = 0U; u32Counter < C_TS_000__NUM_UPDATES; u32Counter++)
+	{
+		u16Sensor = (Luint16)(u32LCCM653R0_TS_000__Random() % C_LOCALDEF__LCCM644__MAX_DEVICES);
+
+		u32Random = u32LCCM653R0_TS_000__Random();
+		if((u32Random % C_TS_000__DROPOUT_RATE) == 0U)
+		{
+			f32Temp = C_TS_000__NO_READING;
+		}
+		else
+		{
+			//-25 to 125 degC in the driver's 1/16 degC steps
+			f32Temp = (Lfloat32)((Lint32)((u32Random >> 8U) % 2400U) - 400) / 16.0F;
+		}
+
+		//Call the target function
+		vLCCM653R0_TS_000__Set_Reading(u16Sensor, f32Temp);
+
+		if(u8LCCM653R0_TS_000__Check() == 0U)
+		{
+			u8Test = 0U;
+		}
+	}
+
+	if(u8Test == 1U)
+	{
+		DEBUG_PRINT("PASS:LCCM653R0.TS.000.TCASE.001\r\n");
+	}
+	else
+	{
+		DEBUG_PRINT("FAIL:LCCM653R0.TS.000.TCASE.001\r\n");
+	}
+	DEBUG_PRINT("END:LCCM653R0.TS.000.TCASE.001\r\n");
+
+}
+
+/***************************************************************************//**
+ * @st_test_case_id
+ * LCCM653R0.TS.000.TCASE.002
+ * @st_test_desc
+ * Fill every sensor, then drop them out one at a time until no pack sensor
+ * is left, then bring one back. The figures must match a brute force
+ * recompute at each step, an empty pack reads 0 and a single sensor has no
+ * variance.
+ *
+*/
+void vLCCM653R0_TS_000_TCASE_002(void)
+{
+	Luint16 u16Sensor;
+	Lfloat32 f32Mean;
+	Lfloat32 f32Variance;
+	Luint8 u8Test;
+	DEBUG_PRINT("START:LCCM653R0.TS.000.TCASE.002\r\n");
+
+	u8Test = 1U;
+
+	//setup
+	vLCCM653R0_TS_000__Setup();
+	for(u16Sensor = 0U; u16Sensor < C_LOCALDEF__LCCM644__MAX_DEVICES; u16Sensor++)
+	{
+		vLCCM653R0_TS_000__Set_Reading(u16Sensor, (Lfloat32)((u16Sensor * 37U) % 1600U) / 16.0F);
+	}
+	if(u8LCCM653R0_TS_000__Check() == 0U)
+	{
+		u8Test = 0U;
+	}
+
+	//Call the target function
+	for(u16Sensor = 0U; u16Sensor < C_LOCALDEF__LCCM644__MAX_DEVICES; u16Sensor++)
+	{
+		vLCCM653R0_TS_000__Set_Reading(u16Sensor, C_TS_000__NO_READING);
+		if(u8LCCM653R0_TS_000__Check() == 0U)
+		{
+			u8Test = 0U;
+		}
+	}
+
+	//nothing left anywhere
+	if((sPWRNODE.sTemp.f32AverageTemp != 0.0F) || (sPWRNODE.sTemp.f32TempVariance != 0.0F) || (sPWRNODE.sTemp.f32HighestTemp != 0.0F) || (sPWRNODE.sTemp.f32LowestTemp != 0.0F))
+	{
+		u8Test = 0U;
+	}
+	if(s16PWRNODE_BATTTEMP_STATS__Get_Group(1U, &f32Mean, &f32Variance) != -1)
+	{
+		u8Test = 0U;
+	}
+	if(s16PWRNODE_BATTTEMP_STATS__Get_Bus(0U, &f32Mean, &f32Variance) != -1)
+	{
+		u8Test = 0U;
+	}
+	vPWRNODE_BATTTEMP_STATS__Update_Hot();
+	if(sPWRNODE.sTemp.sStats.u8NumHot != 0U)
+	{
+		u8Test = 0U;
+	}
+
+	//one sensor back, sensor 1 is a pack sensor
+	vLCCM653R0_TS_000__Set_Reading(1U, 21.5F);
+	if(u8LCCM653R0_TS_000__Check() == 0U)
+	{
+		u8Test = 0U;
+	}
+	if((sPWRNODE.sTemp.f32HighestTemp != 21.5F) || (sPWRNODE.sTemp.f32LowestTemp != 21.5F) || (sPWRNODE.sTemp.f32TempVariance != 0.0F))
+	{
+		u8Test = 0U;
+	}
+	if((sPWRNODE.sTemp.u16HighestSensorIndex != 1U) || (sPWRNODE.sTemp.u16LowestSensorIndex != 1U))
+	{
+		u8Test = 0U;
+	}
+
+	if(u8Test == 1U)
+	{
+		DEBUG_PRINT("PASS:LCCM653R0.TS.000.TCASE.002\r\n");
+	}
+	else
+	{
+		DEBUG_PRINT("FAIL:LCCM653R0.TS.000.TCASE.002\r\n");
+	}
+	DEBUG_PRINT("END:LCCM653R0.TS.000.TCASE.002\r\n");
+
+}
+
+//every sensor enumerated with no reading yet, groups and buses spread over the sensors
+static void vLCCM653R0_TS_000__Setup(void)
+{
+	Luint8 u8Addx[8];
+	Luint16 u16Sensor;
+	Luint16 u16Group;
+
+	u32TS_000__Seed = 653U;
+	vPWRNODE_BATTTEMP_STATS__Init();
+
+	for(u16Sensor = 0U; u16Sensor < C_LOCALDEF__LCCM644__MAX_DEVICES; u16Sensor++)
+	{
+		if((u16Sensor % C_TS_000__BMS_SPACING) == 0U)
+		{
+			u16Group = C_PWRCORE__BMS_TEMP_MASK;
+		}
+		else
+		{
+			u16Group = 1U + (u16Sensor % C_TS_000__NUM_PACK_GROUPS);
+		}
+
+		u8Addx[0] = 0x28U;
+		u8Addx[1] = (Luint8)u16Sensor;
+		u8Addx[2] = (Luint8)(u16Sensor >> 8U);
+		u8Addx[3] = 0U;
+		u8Addx[4] = 0U;
+		u8Addx[5] = 0U;
+		u8Addx[6] = 0U;
+		u8Addx[7] = 0U;
+		(void)s16DS18B20_ADDX__Upload_Addx2(u16Sensor, (Luint8)(u16Sensor % C_LOCALDEF__LCCM644__MAX_1WIRE_CHANNELS), &u8Addx[0], 12U, (Luint16)((u16Group << 8U) | (u16Sensor & 0xFFU)));
+		sDS18B20.sTemp[u16Sensor].f32Temperature = C_TS_000__NO_READING;
+	}
+}
+
+//store a reading the way the driver does, then make its callback
+static void vLCCM653R0_TS_000__Set_Reading(Luint16 u16SensorIndex, Lfloat32 f32Temp)
+{
+	sDS18B20.sTemp[u16SensorIndex].f32Temperature = f32Temp;
+	vPWRNODE_BATTTEMP_STATS__Update(u16SensorIndex);
+}
+
+//brute force over all the sensors against the live figures
+static Luint8 u8LCCM653R0_TS_000__Check(void)
+{
+	Lfloat64 f64GroupSum[C_PWRCORE__BATTTEMP_NUM_GROUPS];
+	Lfloat64 f64GroupSumSq[C_PWRCORE__BATTTEMP_NUM_GROUPS];
+	Luint16 u16GroupCount[C_PWRCORE__BATTTEMP_NUM_GROUPS];
+	Lfloat64 f64BusSum[C_LOCALDEF__LCCM644__MAX_1WIRE_CHANNELS];
+	Lfloat64 f64BusSumSq[C_LOCALDEF__LCCM644__MAX_1WIRE_CHANNELS];
+	Luint16 u16BusCount[C_LOCALDEF__LCCM644__MAX_1WIRE_CHANNELS];
+	Lfloat64 f64Sum;
+	Lfloat64 f64SumSq;
+	Luint16 u16Count;
+	Lfloat32 f32High;
+	Lfloat32 f32Low;
+	Lfloat32 f32Temp;
+	Lfloat32 f32Mean;
+	Lfloat32 f32Variance;
+	Lint16 s16Result;
+	Luint16 u16Sensor;
+	Luint16 u16Index;
+	Luint8 u8Group;
+	Luint8 u8Bus;
+	Luint8 u8Hot;
+	Luint8 u8InList;
+	Luint8 u8Return;
+
+	u8Return = 1U;
+
+	for(u8Group = 0U; u8Group < C_PWRCORE__BATTTEMP_NUM_GROUPS; u8Group++)
+	{
+		f64GroupSum[u8Group] = 0.0;
+		f64GroupSumSq[u8Group] = 0.0;
+		u16GroupCount[u8Group] = 0U;
+	}
+	for(u8Bus = 0U; u8Bus < C_LOCALDEF__LCCM644__MAX_1WIRE_CHANNELS; u8Bus++)
+	{
+		f64BusSum[u8Bus] = 0.0;
+		f64BusSumSq[u8Bus] = 0.0;
+		u16BusCount[u8Bus] = 0U;
+	}
+	f64Sum = 0.0;
+	f64SumSq = 0.0;
+	u16Count = 0U;
+	f32High = -1000.0F;
+	f32Low = 1000.0F;
+
+	for(u16Sensor = 0U; u16Sensor < C_LOCALDEF__LCCM644__MAX_DEVICES; u16Sensor++)
+	{
+		f32Temp = sDS18B20.sTemp[u16Sensor].f32Temperature;
+		if(f32Temp < C_PWRCORE__BATTTEMP_FAULT_DEGC)
+		{
+			u8Group = (Luint8)(sDS18B20.sDevice[u16Sensor].u16UserIndex >> 8U);
+			u8Bus = sDS18B20.sDevice[u16Sensor].u8ChannelIndex;
+
+			f64GroupSum[u8Group] += (Lfloat64)f32Temp;
+			f64GroupSumSq[u8Group] += (Lfloat64)f32Temp * (Lfloat64)f32Temp;
+			u16GroupCount[u8Group]++;
+			f64BusSum[u8Bus] += (Lfloat64)f32Temp;
+			f64BusSumSq[u8Bus] += (Lfloat64)f32Temp * (Lfloat64)f32Temp;
+			u16BusCount[u8Bus]++;
+
+			if(u8Group != C_PWRCORE__BMS_TEMP_MASK)
+			{
+				f64Sum += (Lfloat64)f32Temp;
+				f64SumSq += (Lfloat64)f32Temp * (Lfloat64)f32Temp;
+				u16Count++;
+				if(f32Temp > f32High)
+				{
+					f32High = f32Temp;
+				}
+				else
+				{
+					//fall on
+				}
+				if(f32Temp < f32Low)
+				{
+					f32Low = f32Temp;
+				}
+				else
+				{
+					//fall on
+				}
+			}
+			else
+			{
+				//BMS sensors are not part of the pack
+			}
+		}
+		else
+		{
+			//dropped out
+		}
+	}
+
+	//pack
+	if(u16Count > 0U)
+	{
+		if(u8LCCM653R0_TS_000__Check_Acc(0, sPWRNODE.sTemp.f32AverageTemp, sPWRNODE.sTemp.f32TempVariance, u16Count, f64Sum, f64SumSq) == 0U)
+		{
+			u8Return = 0U;
+		}
+		if((sPWRNODE.sTemp.f32HighestTemp != f32High) || (sPWRNODE.sTemp.f32LowestTemp != f32Low))
+		{
+			u8Return = 0U;
+		}
+
+		//ties may land on any sensor with the same reading
+		u16Index = sPWRNODE.sTemp.u16HighestSensorIndex;
+		if((u8LCCM653R0_TS_000__Is_Pack(u16Index) == 0U) || (sDS18B20.sTemp[u16Index].f32Temperature != f32High))
+		{
+			u8Return = 0U;
+		}
+		u16Index = sPWRNODE.sTemp.u16LowestSensorIndex;
+		if((u8LCCM653R0_TS_000__Is_Pack(u16Index) == 0U) || (sDS18B20.sTemp[u16Index].f32Temperature != f32Low))
+		{
+			u8Return = 0U;
+		}
+	}
+	else
+	{
+		if((sPWRNODE.sTemp.f32AverageTemp != 0.0F) || (sPWRNODE.sTemp.f32HighestTemp != 0.0F) || (sPWRNODE.sTemp.f32LowestTemp != 0.0F))
+		{
+			u8Return = 0U;
+		}
+	}
+
+	//groups and buses
+	for(u8Group = 0U; u8Group < C_PWRCORE__BATTTEMP_NUM_GROUPS; u8Group++)
+	{
+		s16Result = s16PWRNODE_BATTTEMP_STATS__Get_Group(u8Group, &f32Mean, &f32Variance);
+		if(u8LCCM653R0_TS_000__Check_Acc(s16Result, f32Mean, f32Variance, u16GroupCount[u8Group], f64GroupSum[u8Group], f64GroupSumSq[u8Group]) == 0U)
+		{
+			u8Return = 0U;
+		}
+	}
+	for(u8Bus = 0U; u8Bus < C_LOCALDEF__LCCM644__MAX_1WIRE_CHANNELS; u8Bus++)
+	{
+		s16Result = s16PWRNODE_BATTTEMP_STATS__Get_Bus(u8Bus, &f32Mean, &f32Variance);
+		if(u8LCCM653R0_TS_000__Check_Acc(s16Result, f32Mean, f32Variance, u16BusCount[u8Bus], f64BusSum[u8Bus], f64BusSumSq[u8Bus]) == 0U)
+		{
+			u8Return = 0U;
+		}
+	}
+
+	//hot list, hottest first and nothing left out that is hotter than the last entry
+	vPWRNODE_BATTTEMP_STATS__Update_Hot();
+	if(u16Count < C_PWRCORE__BATTTEMP_NUM_HOT)
+	{
+		if(sPWRNODE.sTemp.sStats.u8NumHot != u16Count)
+		{
+			u8Return = 0U;
+		}
+	}
+	else
+	{
+		if(sPWRNODE.sTemp.sStats.u8NumHot != C_PWRCORE__BATTTEMP_NUM_HOT)
+		{
+			u8Return = 0U;
+		}
+	}
+	f32High = 1000.0F;
+	for(u8Hot = 0U; u8Hot < sPWRNODE.sTemp.sStats.u8NumHot; u8Hot++)
+	{
+		u16Index = sPWRNODE.sTemp.sStats.u16HotIndex[u8Hot];
+		if((u16Index >= C_LOCALDEF__LCCM644__MAX_DEVICES) || (u8LCCM653R0_TS_000__Is_Pack(u16Index) == 0U))
+		{
+			u8Return = 0U;
+		}
+		else if(sDS18B20.sTemp[u16Index].f32Temperature > f32High)
+		{
+			u8Return = 0U;
+		}
+		else
+		{
+			f32High = sDS18B20.sTemp[u16Index].f32Temperature;
+		}
+	}
+	for(u16Sensor = 0U; u16Sensor < C_LOCALDEF__LCCM644__MAX_DEVICES; u16Sensor++)
+	{
+		u8InList = 0U;
+		for(u8Hot = 0U; u8Hot < sPWRNODE.sTemp.sStats.u8NumHot; u8Hot++)
+		{
+			if(sPWRNODE.sTemp.sStats.u16HotIndex[u8Hot] == u16Sensor)
+			{
+				u8InList = 1U;
+			}
+			else
+			{
+				//fall on
+			}
+		}
+		if((u8InList == 0U) && (u8LCCM653R0_TS_000__Is_Pack(u16Sensor) == 1U) && (sDS18B20.sTemp[u16Sensor].f32Temperature > f32High))
+		{
+			u8Return = 0U;
+		}
+		else
+		{
+			//fall on
+		}
+	}
+
+	return u8Return;
+}
+
+//one set of totals against the brute force sums
+static Luint8 u8LCCM653R0_TS_000__Check_Acc(Lint16 s16Result, Lfloat32 f32Mean, Lfloat32 f32Variance, Luint16 u16Count, Lfloat64 f64Sum, Lfloat64 f64SumSq)
+{
+	Lfloat64 f64Mean;
+	Lfloat64 f64Variance;
+	Lfloat64 f64Error;
+	Luint8 u8Return;
+
+	if(u16Count > 0U)
+	{
+		f64Mean = f64Sum / (Lfloat64)u16Count;
+		f64Variance = (f64SumSq / (Lfloat64)u16Count) - (f64Mean * f64Mean);
+
+		u8Return = 1U;
+		if(s16Result != 0)
+		{
+			u8Return = 0U;
+		}
+		else
+		{
+			//fall on
+		}
+
+		f64Error = (Lfloat64)f32Mean - f64Mean;
+		if((f64Error > C_TS_000__MEAN_TOL) || (f64Error < -C_TS_000__MEAN_TOL))
+		{
+			u8Return = 0U;
+		}
+
+		f64Error = (Lfloat64)f32Variance - f64Variance;
+		if((f64Error > (C_TS_000__VARIANCE_TOL * (1.0 + f64Variance))) || (f64Error < -(C_TS_000__VARIANCE_TOL * (1.0 + f64Variance))))
+		{
+			u8Return = 0U;
+		}
+	}
+	else
+	{
+		//nothing counted
+		if(s16Result == -1)
+		{
+			u8Return = 1U;
+		}
+		else
+		{
+			u8Return = 0U;
+		}
+	}
+
+	return u8Return;
+}
+
+//1 = a working sensor outside the BMS group
+static Luint8 u8LCCM653R0_TS_000__Is_Pack(Luint16 u16SensorIndex)
+{
+	Luint8 u8Return;
+
+	if((sDS18B20.sTemp[u16SensorIndex].f32Temperature < C_PWRCORE__BATTTEMP_FAULT_DEGC) && ((sDS18B20.sDevice[u16SensorIndex].u16UserIndex >> 8U) != C_PWRCORE__BMS_TEMP_MASK))
+	{
+		u8Return = 1U;
+	}
+	else
+	{
+		u8Return = 0U;
+	}
+
+	return u8Return;
+}
+
+//LCG, the same sequence on every run
+static Luint32 u32LCCM653R0_TS_000__Random(void)
+{
+	u32TS_000__Seed = (u32TS_000__Seed * 1664525U) + 1013904223U;
+	return u32TS_000__Seed >> 8U;
+}
+
+#endif //#if C_LOCALDEF__LCCM653__ENABLE_BATT_TEMP == 1U
+#endif //#if C_LOCALDEF__LCCM653__ENABLE_TEST_SPEC == 1U
+#endif //#if C_LOCALDEF__LCCM653__ENABLE_THIS_MODULE == 1U
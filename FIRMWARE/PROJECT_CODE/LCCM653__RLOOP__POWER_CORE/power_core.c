@@ -447,7 +447,7 @@ void vPWRNODE__RTI_100MS_ISR(void)
  * @brief
  * 10ms timer
  * 
- * @st_funcMD5		6A863930CAD007EDEE0C5B0179EA027A
+ * @st_funcMD5		CD2EB4C1427D5D33490A9DBA42FC94A5
  * @st_funcID		LCCM653R0.FILE.000.FUNC.004
  */
 void vPWRNODE__RTI_10MS_ISR(void)
@@ -456,6 +456,9 @@ void vPWRNODE__RTI_10MS_ISR(void)
 		#if C_LOCALDEF__LCCM644__USE_10MS_ISR == 1U
 			vDS18B20__10MS_ISR();
 		#endif
+		#if C_LOCALDEF__LCCM641__ENABLE_ASYNC == 1U
+			vDS2482S_ASYNC__10MS_ISR();
+		#endif
 	#endif
 
 	#if C_LOCALDEF__LCCM653__ENABLE_ETHERNET == 1U
@@ -470,6 +473,9 @@ void vPWRNODE__RTI_10MS_ISR(void)
 		#else
 			#error
 		#endif
+
+		//timestamps for the pack snapshots
+		vPWRNODE_BMS__10MS_ISR();
 	#endif
 
 	#if C_LOCALDEF__LCCM653__ENABLE_NODE_PRESS == 1U
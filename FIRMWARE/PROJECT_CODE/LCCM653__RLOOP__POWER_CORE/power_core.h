@@ -41,6 +41,51 @@
 		Structures
 		*******************************************************************************/
 
+		/** Running totals for a set of temp sensors, fixed point 1/16 degC */
+		typedef struct
+		{
+			/** Number of working sensors */
+			Luint16 u16Count;
+
+			/** Sum of the readings */
+			Lint32 s32Sum;
+
+			/** Sum of the squared readings */
+			Luint64 u64SumSq;
+
+		}TS_PWR_BATT_TEMP__ACC;
+
+		#if C_LOCALDEF__LCCM653__ENABLE_BMS == 1U
+		/** One complete BMS scan, written once per scan and not touched after it is published */
+		typedef struct
+		{
+			/** Driver update count the scan was taken at */
+			Luint32 u32UpdateCount;
+
+			/** BMS 10ms tick when published */
+			Luint32 u32Timestamp_x10ms;
+
+			/** Cell voltages, whole pack */
+			Lfloat32 f32CellVoltage[C_PWRCORE__BMS_NUM_CELLS];
+
+			/** Cell monitor temperatures, C_PWRCORE__BMS_DEVICE_TEMP_INVALID where the device has no sensor */
+			Lfloat32 f32DeviceTemp[C_PWRCORE__BMS_NUM_DEVICES];
+
+			/** Highest and lowest cell and where they are */
+			Lfloat32 f32Highest;
+			Lfloat32 f32Lowest;
+			Luint16 u16HighestIndex;
+			Luint16 u16LowestIndex;
+
+			/** Highest - lowest cell */
+			Lfloat32 f32Imbalance;
+
+			/** Sum of the cells as the driver computed it */
+			Lfloat32 f32PackVoltage;
+
+		}TS_PWR_BMS__SNAPSHOT;
+		#endif
+
 		/** Main Power Node Structure */
 		struct _strPWRNODE
 		{
@@ -106,6 +151,56 @@
 				/** Counter of number if times the temp sensor was scanned */
 				Luint32 u32TempScanCount;
 
+				/** Lowest Temp */
+				Lfloat32 f32LowestTemp;
+
+				/** The index of the lowest temperature sensor */
+				Luint16 u16LowestSensorIndex;
+
+				/** Variance of the pack temps in degC^2 */
+				Lfloat32 f32TempVariance;
+
+				/** Statistics, updated as each DS18B20 reading lands */
+				struct
+				{
+					/** What each sensor last added to the totals */
+					struct
+					{
+						/** Reading in 1/16 degC */
+						Lint16 s16Temp;
+
+						/** 1 = working sensor, counted in the totals */
+						Luint8 u8Valid;
+
+						/** Upper byte of the user index */
+						Luint8 u8Group;
+
+						/** 1-Wire bus */
+						Luint8 u8Bus;
+
+					}sSensor[C_LOCALDEF__LCCM644__MAX_DEVICES];
+
+					/** Pack sensors, BMS group excluded */
+					TS_PWR_BATT_TEMP__ACC sPack;
+
+					/** By user group */
+					TS_PWR_BATT_TEMP__ACC sGroup[C_PWRCORE__BATTTEMP_NUM_GROUPS];
+
+					/** By 1-Wire bus */
+					TS_PWR_BATT_TEMP__ACC sBus[C_LOCALDEF__LCCM644__MAX_1WIRE_CHANNELS];
+
+					/** Max and min trees over the pack sensors, leaves are the upper half */
+					Lint16 s16MaxTree[2U * C_PWRCORE__BATTTEMP_TREE_SIZE];
+					Lint16 s16MinTree[2U * C_PWRCORE__BATTTEMP_TREE_SIZE];
+
+					/** Hottest sensors, hottest first */
+					Luint16 u16HotIndex[C_PWRCORE__BATTTEMP_NUM_HOT];
+
+					/** Number of valid entries in u16HotIndex */
+					Luint8 u8NumHot;
+
+				}sStats;
+
 			}sTemp;
 
 			#if C_LOCALDEF__LCCM653__ENABLE_DC_CONVERTER == 1U
@@ -174,6 +269,15 @@
                 /** State of charge **/
                 Lfloat32 f32StateOfCharge;
 
+                /** Pack snapshots, readers only ever see sSnapshot[u8Published] */
+                TS_PWR_BMS__SNAPSHOT sSnapshot[2];
+
+                /** Index of the published snapshot */
+                Luint8 u8Published;
+
+                /** Free running 10ms tick for the snapshot timestamps */
+                Luint32 u32Timer_x10ms;
+
 			}sBMS;
 
             /**BMS cooling fan control **/
@@ -409,6 +513,13 @@
 		void vPWRNODE_BMS__Balance_Stop(void);
 		void vPWRNODE_BMS__Balance_Manual(Luint8 u8CellIndex, Luint8 u8Enable);
 		Luint32 u32PWRNODE_BMS__Get_VoltsUpdateCount(void);
+		void vPWRNODE_BMS__10MS_ISR(void);
+		#if C_LOCALDEF__LCCM653__ENABLE_BMS == 1U
+			const TS_PWR_BMS__SNAPSHOT * pPWRNODE_BMS__Get_Snapshot(void);
+		#endif
+		Lfloat32 f32PWRNODE_BMS__Cell_Get_Voltage(Luint16 u16CellIndex);
+		Lfloat32 f32PWRNODE_BMS__Get_Imbalance(void);
+		Luint32 u32PWRNODE_BMS__Get_SnapshotAge_x10ms(void);
 
 		
 		//eth
@@ -429,6 +540,13 @@
 			void vPWRNODE_BATTEMP_MEM__Set_ROMID(Luint16 u16Index, Luint32 u32ROMID_Upper, Luint32 u32ROMID_Lower);
 			void vPWRNODE_BATTEMP_MEM__Set_UserData(Luint16 u16Index, Luint16 UserIndex, Luint8 u8BusID, Luint8 u8Resolution);
 
+			//statistics
+			void vPWRNODE_BATTTEMP_STATS__Init(void);
+			void vPWRNODE_BATTTEMP_STATS__Update(Luint16 u16SensorIndex);
+			void vPWRNODE_BATTTEMP_STATS__Update_Hot(void);
+			Lint16 s16PWRNODE_BATTTEMP_STATS__Get_Group(Luint8 u8Group, Lfloat32 *pf32Mean, Lfloat32 *pf32Variance);
+			Lint16 s16PWRNODE_BATTTEMP_STATS__Get_Bus(Luint8 u8Bus, Lfloat32 *pf32Mean, Lfloat32 *pf32Variance);
+
 			//eth
 			void vPWRNODE_BAATTEMP_ETH__Transmit(E_NET__PACKET_T ePacketType);
 			void vPWRNODE_BAATTEMP_ETH__Transmit_ROMID(Luint32 u32Index);
@@ -462,6 +580,15 @@
 		DLL_DECLARATION Luint8 u8PWRNODE_WIN32__Get_RepressSolState(void);
 #endif
 
+		#if C_LOCALDEF__LCCM653__ENABLE_TEST_SPEC == 1U
+
+			//only for testing
+			extern struct _strPWRNODE sPWRNODE;
+
+			DLL_DECLARATION void vLCCM653R0_TS_000(void);
+
+		#endif
+
 	#endif //#if C_LOCALDEF__LCCM653__ENABLE_THIS_MODULE == 1U
 	//safetys
 	#ifndef C_LOCALDEF__LCCM653__ENABLE_THIS_MODULE
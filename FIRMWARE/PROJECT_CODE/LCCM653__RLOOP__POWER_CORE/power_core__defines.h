@@ -45,6 +45,19 @@
 
 	#define C_PWRCORE__BMS_TEMP_MASK						(0x20U)
 
+	/** Battery temp stats, one bucket per user group, 0x00 to the BMS group */
+	#define C_PWRCORE__BATTTEMP_NUM_GROUPS					(C_PWRCORE__BMS_TEMP_MASK + 1U)
+
+	/** Depth of the max/min trees, 2^depth leaves must cover all DS18B20 devices */
+	#define C_PWRCORE__BATTTEMP_TREE_DEPTH					(8U)
+	#define C_PWRCORE__BATTTEMP_TREE_SIZE					(1U << C_PWRCORE__BATTTEMP_TREE_DEPTH)
+
+	/** Number of hottest sensors kept */
+	#define C_PWRCORE__BATTTEMP_NUM_HOT						(8U)
+
+	/** Readings at or above this are a sensor fault, not a temperature */
+	#define C_PWRCORE__BATTTEMP_FAULT_DEGC					(126.0F)
+
 	#define C_PWRCORE__BMS_BOARD0_MASK						(0x01U)
 	#define C_PWRCORE__BMS_BOARD1_MASK						(0x02U)
 	#define C_PWRCORE__BMS_BOARD2_MASK						(0x03U)
@@ -108,4 +121,19 @@
     /** 2.99 V Absolute minimum for the cells **/
     #define C_PWRCORE__UNDERVOLTAGE_KILL                        (3.20F)
     #define C_PWRCORE__OVERVOLTAGE_KILL                         (4.21F)
+
+    /** Oldest the published BMS snapshot can get before the scan is faulted as stalled, 10ms ticks */
+    #define C_PWRCORE__BMS_SNAPSHOT_TIMEOUT_x10ms               (200U)
+
+    /** Cell monitor temperature with no sensor behind it, below absolute zero so it can't pass for a reading */
+    #define C_PWRCORE__BMS_DEVICE_TEMP_INVALID                  (-1000.0F)
+
+    /** Cells and cell monitor devices behind the BMS layer for the fitted BMS revision */
+    #if C_LOCALDEF__BMS_REVISION == 1U
+        #define C_PWRCORE__BMS_NUM_CELLS                        (C_ATA6870__TOTAL_CELLS)
+        #define C_PWRCORE__BMS_NUM_DEVICES                      (C_LOCALDEF__LCCM650__NUM_DEVICES)
+    #else
+        #define C_PWRCORE__BMS_NUM_CELLS                        (C_BQ76__TOTAL_CELLS)
+        #define C_PWRCORE__BMS_NUM_DEVICES                      (C_LOCALDEF__LCCM715__NUM_DEVICES)
+    #endif
 #endif /* RLOOP_POWER_CORE__DEFINES_H_ */
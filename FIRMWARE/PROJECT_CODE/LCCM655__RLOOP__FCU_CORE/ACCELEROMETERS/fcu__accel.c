@@ -28,7 +28,7 @@ extern struct _strFCU sFCU;
  * @brief
  * Init the accel subsystem layer
  * 
- * @st_funcMD5		228023E6C160A7BB877AE0116DB9D297
+ * @st_funcMD5		9BA80B6C8C0C0F8D5B39F7F003F756D5
  * @st_funcID		LCCM655R0.FILE.010.FUNC.001
  */
 void vFCU_ACCEL__Init(void)
@@ -85,7 +85,10 @@ void vFCU_ACCEL__Init(void)
 
 	}//for(u8Device = 0U; u8Device < C_LOCALDEF__LCCM418__NUM_DEVICES; u8Device++)
 
-
+#ifdef WIN32
+	//feed the driver from the injected samples
+	vFCU_ACCEL_WIN32__Init();
+#endif
 
 #ifndef WIN32
 
@@ -150,6 +153,10 @@ void vFCU_ACCEL__Init(void)
 		}
 	#endif
 
+	#if C_LOCALDEF__LCCM655__ENABLE_ACCEL_FIFO == 1U
+		//switch the devices over to FIFO and setup the filter chain
+		vFCU_ACCEL_FIFO__Init();
+	#endif
 
 }
 
@@ -158,17 +165,18 @@ void vFCU_ACCEL__Init(void)
  * Process the accel's
  * Call as fast as possible from the main loop
  * 
- * @st_funcMD5		0C7EE7686E457B1E4BDF1E8304B97461
+ * @st_funcMD5		B0D32A8553EA3D885D1D1D81DB32447B
  * @st_funcID		LCCM655R0.FILE.010.FUNC.002
  */
 void vFCU_ACCEL__Process(void)
 {
+#if C_LOCALDEF__LCCM655__ENABLE_ACCEL_FIFO == 0U
+	//the FIFO path keeps its own state
 	Luint32 u32Temp[2];
 	Luint8 u8Test;
 	//Luint8 u8Counter;
 	MMA8451__AXIS_E eTargetAxis;
 	Lint32 s32Axis_To_ms;
-	Lint32 s32Temp;
 	Lfloat32 f32Temp;
 
 	//depending on the orientation of the hardware
@@ -184,12 +192,17 @@ void vFCU_ACCEL__Process(void)
 	#else
 		#error
 	#endif
+#endif
 
 
 	//handle the timer flag
 	if(sFCU.sAccel.u810MS_Flag == 1)
 	{
 
+	#if C_LOCALDEF__LCCM655__ENABLE_ACCEL_FIFO == 1U
+		//drain every device in one pass
+		vFCU_ACCEL_FIFO__Process();
+	#else
 		//check to see what the interrupt is doing
 #ifndef WIN32
 		if(sFCU.sAccel.u8ChannelCounter == 0U)
@@ -357,6 +370,7 @@ void vFCU_ACCEL__Process(void)
 		{
 			//do nothing.
 		}
+	#endif //C_LOCALDEF__LCCM655__ENABLE_ACCEL_FIFO
 
 		//clear the flag
 		sFCU.sAccel.u810MS_Flag = 0U;
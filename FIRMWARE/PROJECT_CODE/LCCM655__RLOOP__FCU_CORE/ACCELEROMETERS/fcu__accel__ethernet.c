@@ -41,7 +41,7 @@ void vFCU_ACCEL_ETH__Init(void)
  * Transmit acceleration data over ethernet
  *
  * @param[in]		u16PacketType			The type of packet to transmit
- * @st_funcMD5		EC29840AA5182F63786383AE8105B0A7
+ * @st_funcMD5		5C070F00B2495EF7E8918ECE6ACB05A4
  * @st_funcID		LCCM655R0.FILE.030.FUNC.001
  */
 void vFCU_ACCEL_ETH__Transmit(E_NET__PACKET_T ePacketType)
@@ -224,6 +224,10 @@ void vFCU_ACCEL_ETH__Transmit(E_NET__PACKET_T ePacketType)
 				}
 				break;
 
+			default:
+				//not one of ours
+				break;
+
 		}//switch(ePacketType)
 
 		//send it
@@ -0,0 +1,503 @@
+#include "../fcu_core.h"
+
+#if C_LOCALDEF__LCCM655__ENABLE_THIS_MODULE == 1U
+#if C_LOCALDEF__LCCM655__ENABLE_ACCEL == 1U
+#if C_LOCALDEF__LCCM655__ENABLE_ACCEL_FIFO == 1U
+
+//the structure
+extern struct _strFCU sFCU;
+
+//locals
+static Luint32 u32FCU_ACCEL_FIFO__Get_Period(Luint8 u8Device);
+static Lint32 s32FCU_ACCEL_FIFO__Filter(Luint8 u8Device, Luint8 u8Axis, Lint16 s16Sample);
+static void vFCU_ACCEL_FIFO__Integrate(Luint8 u8Device, Lint32 s32Accel_mm_ss, Luint64 u64Time);
+
+/***************************************************************************//**
+ * @brief
+ * Setup the filter chain and put the MMA8451's into FIFO mode
+ *
+ * @note
+ * Call after the devices have been through vSIL3_MMA8451__Init()
+ *
+ * @st_funcMD5		A970D4824F22E86AEE15C05BAB9F2BBD
+ * @st_funcID		LCCM655R0.FILE.098.FUNC.001
+ */
+void vFCU_ACCEL_FIFO__Init(void)
+{
+	Luint8 u8Device;
+	Luint8 u8Axis;
+	Luint8 u8Counter;
+#ifndef WIN32
+	Luint8 u8Reg;
+	Lint16 s16Return;
+#endif
+
+	//default chain, boxcar into a light IIR
+	for(u8Counter = 0U; u8Counter < C_FCU__ACCEL_FIR_MAX_TAPS; u8Counter++)
+	{
+		if(u8Counter < C_FCU__ACCEL_FIR_DEFAULT_TAPS)
+		{
+			sFCU.sAccel.sFilter.s16FIR_Coeff_Q15[u8Counter] = (Lint16)(32768U / C_FCU__ACCEL_FIR_DEFAULT_TAPS);
+		}
+		else
+		{
+			sFCU.sAccel.sFilter.s16FIR_Coeff_Q15[u8Counter] = 0;
+		}
+	}
+	sFCU.sAccel.sFilter.u8FIR_Taps = C_FCU__ACCEL_FIR_DEFAULT_TAPS;
+	sFCU.sAccel.sFilter.s16IIR_Alpha_Q15 = C_FCU__ACCEL_IIR_DEFAULT_ALPHA_Q15;
+
+	for(u8Device = 0U; u8Device < C_FCU__NUM_ACCEL_CHIPS; u8Device++)
+	{
+		for(u8Axis = 0U; u8Axis < (Luint8)MMA8451_AXIS__MAX; u8Axis++)
+		{
+			for(u8Counter = 0U; u8Counter < C_FCU__ACCEL_FIR_MAX_TAPS; u8Counter++)
+			{
+				sFCU.sAccel.sChannels[u8Device].sFifo.s16FIR_History[u8Axis][u8Counter] = 0;
+			}
+			sFCU.sAccel.sChannels[u8Device].sFifo.s32IIR_Q8[u8Axis] = 0;
+		}
+		sFCU.sAccel.sChannels[u8Device].sFifo.u8FIR_Index = 0U;
+		sFCU.sAccel.sChannels[u8Device].sFifo.u64LastSample_Time = 0U;
+		sFCU.sAccel.sChannels[u8Device].sFifo.u8Primed = 0U;
+		sFCU.sAccel.sChannels[u8Device].sFifo.s32PrevAccel_mm_ss = 0;
+		sFCU.sAccel.sChannels[u8Device].sFifo.s64VelocSum = 0;
+		sFCU.sAccel.sChannels[u8Device].sFifo.s64DispSum = 0;
+		sFCU.sAccel.sChannels[u8Device].sFifo.s32Veloc_um_s = 0;
+		sFCU.sAccel.sChannels[u8Device].sFifo.s64Disp_um = 0;
+		sFCU.sAccel.sChannels[u8Device].sFifo.u32SampleCount = 0U;
+		sFCU.sAccel.sChannels[u8Device].sFifo.u32OverflowCount = 0U;
+	}
+
+#ifndef WIN32
+	for(u8Device = 0U; u8Device < C_LOCALDEF__LCCM418__NUM_DEVICES; u8Device++)
+	{
+		if(u32SIL3_MMA8451__Get_FaultFlags(u8Device) == 0x00000000U)
+		{
+			//F_SETUP can only be changed in standby
+			s16Return = s16SIL3_MMA8451_LOWLEVEL__ReadByte(u8Device, C_MMA8451__REGISTER__CTRL_REG1_RW, &u8Reg);
+			if(s16Return >= 0)
+			{
+				s16Return = s16SIL3_MMA8451_LOWLEVEL__WriteByte(u8Device, C_MMA8451__REGISTER__CTRL_REG1_RW, u8Reg & 0xFEU);
+			}
+			else
+			{
+				//fall on
+			}
+
+			if(s16Return >= 0)
+			{
+				//circular, we only ever want the latest 32 samples
+				s16Return = s16SIL3_MMA8451_LOWLEVEL__WriteByte(u8Device, C_MMA8451__REGISTER__FIFO_SETUP, C_FCU__ACCEL_FIFO_SETUP__CIRCULAR);
+			}
+			else
+			{
+				//fall on
+			}
+
+			if(s16Return >= 0)
+			{
+				//back to active, F_READ must be clear or the FIFO is bypassed
+				s16Return = s16SIL3_MMA8451_LOWLEVEL__WriteByte(u8Device, C_MMA8451__REGISTER__CTRL_REG1_RW, (u8Reg & 0xFDU) | 0x01U);
+			}
+			else
+			{
+				//fall on
+			}
+
+			if(s16Return < 0)
+			{
+				vSIL3_FAULTTREE__Set_Flag(&sFCU.sAccel.sFaultFlags, C_LCCM655__ACCEL__FAULT_INDEX__00);
+				vSIL3_FAULTTREE__Set_Flag(&sFCU.sAccel.sFaultFlags, C_LCCM655__ACCEL__FAULT_INDEX__01);
+			}
+			else
+			{
+				//fall on
+			}
+		}
+		else
+		{
+			//already faulted at init
+		}
+	}
+#endif //WIN32
+
+}
+
+/***************************************************************************//**
+ * @brief
+ * Drain the FIFO on every device and run each sample through the chain
+ *
+ * @note
+ * One status read and one burst read per device. The burst is timestamped
+ * from the RTI and each sample is placed back one ODR period from the newest.
+ *
+ * @st_funcMD5		5D12C307B889BB780E3022ACFFFF3339
+ * @st_funcID		LCCM655R0.FILE.098.FUNC.002
+ */
+void vFCU_ACCEL_FIFO__Process(void)
+{
+	Luint8 u8Device;
+	Luint8 u8Status;
+	Luint8 u8Count;
+	Luint8 u8Counter;
+	Luint8 u8Axis;
+	Luint16 u16Index;
+	Lint16 s16Return;
+	Lint16 s16XYZ[MMA8451_AXIS__MAX];
+	Luint8 u8Buffer[C_FCU__ACCEL_FIFO_DEPTH * C_FCU__ACCEL_FIFO_SAMPLE_BYTES];
+	Luint64 u64Time;
+	Luint64 u64Sample;
+	Luint32 u32Period;
+	Luint32 u32Temp;
+
+	for(u8Device = 0U; u8Device < C_LOCALDEF__LCCM418__NUM_DEVICES; u8Device++)
+	{
+		u32Temp = u32SIL3_MMA8451__Get_FaultFlags(u8Device);
+		if(u32Temp != 0x00000000U)
+		{
+			if((u32Temp & C_LCCM418__CORE__FAULT_INDEX_MASK__08) != C_LCCM418__CORE__FAULT_INDEX_MASK__08)
+			{
+				sFCU.sAccel.sFaultHandling[u8Device].u8FaultCondition_Active = 1U;
+				vSIL3_FAULTTREE__Set_Flag(&sFCU.sAccel.sFaultFlags, C_LCCM655__ACCEL__FAULT_INDEX__00);
+				vSIL3_FAULTTREE__Set_Flag(&sFCU.sAccel.sFaultFlags, C_LCCM655__ACCEL__FAULT_INDEX__01);
+			}
+			else
+			{
+				//cal in progress
+			}
+		}
+		else
+		{
+			//the newest sample in the FIFO is at most one period old
+			u64Time = u64RM4_RTI__Get_Counter1();
+
+#ifndef WIN32
+			//in FIFO mode the status register is F_STATUS
+			s16Return = s16SIL3_MMA8451_LOWLEVEL__ReadByte(u8Device, C_MMA8451__REGISTER__STATUS_R, &u8Status);
+			u8Count = u8Status & C_FCU__ACCEL_FIFO_STATUS__COUNT_MASK;
+			if((s16Return >= 0) && (u8Count > 0U))
+			{
+				//the address wraps from OUT_Z_LSB to OUT_X_MSB while the FIFO has data, so one burst drains it
+				s16Return = s16SIL3_MMA8451_LOWLEVEL__ReadMultiple(u8Device, C_MMA8451__REGISTER__OUT_X_MSB_R, &u8Buffer[0], u8Count * C_FCU__ACCEL_FIFO_SAMPLE_BYTES);
+			}
+			else
+			{
+				//fall on
+			}
+#else
+			//the sim knows when the newest sample was taken
+			u64Time = sFCU.sAccel.sChannels[u8Device].u64WIN32_FifoTime;
+			u8Status = u8FCU_ACCEL_WIN32__Read_FIFO(u8Device, &u8Buffer[0]);
+			u8Count = u8Status & C_FCU__ACCEL_FIFO_STATUS__COUNT_MASK;
+			s16Return = 0;
+#endif
+
+			if((s16Return >= 0) && (u8Count > 0U))
+			{
+				if((u8Status & C_FCU__ACCEL_FIFO_STATUS__OVERFLOW) != 0U)
+				{
+					//lost samples, the first dt spans the gap
+					sFCU.sAccel.sChannels[u8Device].sFifo.u32OverflowCount++;
+				}
+				else
+				{
+					//fall on
+				}
+
+				u32Period = u32FCU_ACCEL_FIFO__Get_Period(u8Device);
+				u16Index = 0U;
+				for(u8Counter = 0U; u8Counter < u8Count; u8Counter++)
+				{
+					//14 bit left justified, big endian
+					for(u8Axis = 0U; u8Axis < (Luint8)MMA8451_AXIS__MAX; u8Axis++)
+					{
+						s16XYZ[u8Axis] = (Lint16)(((Luint16)u8Buffer[u16Index] << 8U) | (Luint16)u8Buffer[u16Index + 1U]);
+						s16XYZ[u8Axis] /= 4;
+						u16Index += 2U;
+					}
+
+					u64Sample = u64Time - ((Luint64)(u8Count - 1U - u8Counter) * (Luint64)u32Period);
+
+					//read to read jitter must not run time backwards
+					if((sFCU.sAccel.sChannels[u8Device].sFifo.u8Primed == 1U) && (u64Sample <= sFCU.sAccel.sChannels[u8Device].sFifo.u64LastSample_Time))
+					{
+						u64Sample = sFCU.sAccel.sChannels[u8Device].sFifo.u64LastSample_Time + (Luint64)u32Period;
+					}
+					else
+					{
+						//fall on
+					}
+
+					vFCU_ACCEL_FIFO__Add_Sample(u8Device, &s16XYZ[0], u64Sample);
+				}
+			}
+			else
+			{
+				//nothing new, or the bus failed and the driver will fault it
+			}
+		}
+	}
+}
+
+/***************************************************************************//**
+ * @brief
+ * Run one XYZ sample through the filter chain and the integrators
+ *
+ * @param[in]		u64Time					RTI time the sample was taken
+ * @param[in]		ps16XYZ					Raw counts, X, Y, Z
+ * @param[in]		u8Device				Accel device
+ * @st_funcMD5		D003F11461D207476308CD48113C6E43
+ * @st_funcID		LCCM655R0.FILE.098.FUNC.003
+ */
+void vFCU_ACCEL_FIFO__Add_Sample(Luint8 u8Device, const Lint16 *ps16XYZ, Luint64 u64Time)
+{
+	Luint8 u8Axis;
+	MMA8451__AXIS_E eTargetAxis;
+	Lint32 s32Axis_To_ms;
+	Lint32 s32Accel;
+
+	//same orientation as the polled path
+	eTargetAxis = MMA8451_AXIS__Y;
+
+	#if C_LOCALDEF__LCCM418__G_FORCE_RANGE == 2U
+		s32Axis_To_ms = 4096;
+	#elif C_LOCALDEF__LCCM418__G_FORCE_RANGE == 4U
+		s32Axis_To_ms = 2048;
+	#elif C_LOCALDEF__LCCM418__G_FORCE_RANGE == 8U
+		s32Axis_To_ms = 1024;
+	#else
+		#error
+	#endif
+
+	if(u8Device < C_FCU__NUM_ACCEL_CHIPS)
+	{
+		for(u8Axis = 0U; u8Axis < (Luint8)MMA8451_AXIS__MAX; u8Axis++)
+		{
+			sFCU.sAccel.sChannels[u8Device].s16LastSample[u8Axis] = ps16XYZ[u8Axis];
+			sFCU.sAccel.sChannels[u8Device].sFifo.s32IIR_Q8[u8Axis] = s32FCU_ACCEL_FIFO__Filter(u8Device, u8Axis, ps16XYZ[u8Axis]);
+		}
+
+		//the FIR history moves once per sample for all axes
+		sFCU.sAccel.sChannels[u8Device].sFifo.u8FIR_Index++;
+		if(sFCU.sAccel.sChannels[u8Device].sFifo.u8FIR_Index >= C_FCU__ACCEL_FIR_MAX_TAPS)
+		{
+			sFCU.sAccel.sChannels[u8Device].sFifo.u8FIR_Index = 0U;
+		}
+		else
+		{
+			//fall on
+		}
+
+		sFCU.sAccel.sChannels[u8Device].s16FilteredResult = (Lint16)(sFCU.sAccel.sChannels[u8Device].sFifo.s32IIR_Q8[(Luint8)eTargetAxis] / 256);
+
+		//Q8 counts to mm/sec^2, 1G = 9806.65mm/sec^2
+		s32Accel = (Lint32)(((Lint64)sFCU.sAccel.sChannels[u8Device].sFifo.s32IIR_Q8[(Luint8)eTargetAxis] * 980665) / ((Lint64)s32Axis_To_ms * 25600));
+		sFCU.sAccel.sChannels[u8Device].s32CurrentAccel_mm_ss = s32Accel;
+
+		vFCU_ACCEL_FIFO__Integrate(u8Device, s32Accel, u64Time);
+
+		sFCU.sAccel.sChannels[u8Device].sFifo.u32SampleCount++;
+		sFCU.sAccel.sChannels[u8Device].u8NewSampleAvail = 1U;
+	}
+	else
+	{
+		//error
+	}
+}
+
+/***************************************************************************//**
+ * @brief
+ * Load the FIR stage
+ *
+ * @param[in]		u8Taps					Number of taps, 1 to C_FCU__ACCEL_FIR_MAX_TAPS
+ * @param[in]		ps16Coeff_Q15			Taps in Q15, newest sample first
+ * @return			0 = success\n
+ *					-1 = tap count out of range
+ * @st_funcMD5		7197AD488515F5D1D3990A45028F0C5B
+ * @st_funcID		LCCM655R0.FILE.098.FUNC.004
+ */
+Lint16 s16FCU_ACCEL_FIFO__Set_FIR(const Lint16 *ps16Coeff_Q15, Luint8 u8Taps)
+{
+	Luint8 u8Counter;
+	Lint16 s16Return;
+
+	if((u8Taps > 0U) && (u8Taps <= C_FCU__ACCEL_FIR_MAX_TAPS))
+	{
+		for(u8Counter = 0U; u8Counter < C_FCU__ACCEL_FIR_MAX_TAPS; u8Counter++)
+		{
+			if(u8Counter < u8Taps)
+			{
+				sFCU.sAccel.sFilter.s16FIR_Coeff_Q15[u8Counter] = ps16Coeff_Q15[u8Counter];
+			}
+			else
+			{
+				sFCU.sAccel.sFilter.s16FIR_Coeff_Q15[u8Counter] = 0;
+			}
+		}
+		sFCU.sAccel.sFilter.u8FIR_Taps = u8Taps;
+		s16Return = 0;
+	}
+	else
+	{
+		s16Return = -1;
+	}
+
+	return s16Return;
+}
+
+/***************************************************************************//**
+ * @brief
+ * Set the IIR stage coefficient, 32767 is a pass through
+ *
+ * @param[in]		s16Alpha_Q15			y += alpha(x - y), 1 to 32767
+ * @return			0 = success\n
+ *					-1 = out of range
+ * @st_funcMD5		180242586124129DFD6B49B060EC1693
+ * @st_funcID		LCCM655R0.FILE.098.FUNC.005
+ */
+Lint16 s16FCU_ACCEL_FIFO__Set_IIR(Lint16 s16Alpha_Q15)
+{
+	Lint16 s16Return;
+
+	if(s16Alpha_Q15 > 0)
+	{
+		sFCU.sAccel.sFilter.s16IIR_Alpha_Q15 = s16Alpha_Q15;
+		s16Return = 0;
+	}
+	else
+	{
+		s16Return = -1;
+	}
+
+	return s16Return;
+}
+
+//one ODR period in RTI ticks
+static Luint32 u32FCU_ACCEL_FIFO__Get_Period(Luint8 u8Device)
+{
+	Luint32 u32Rate;
+	Luint32 u32Return;
+
+	if(u8Device == 0U)
+	{
+		u32Rate = C_LOCALDEF__LCCM418__DEV0__DATA_RATE_HZ;
+	}
+	else
+	{
+		u32Rate = C_LOCALDEF__LCCM418__DEV1__DATA_RATE_HZ;
+	}
+
+	//the localdef rounds the low rates, the device runs at 12.5, 6.25 and 1.5625Hz
+	switch(u32Rate)
+	{
+		case 12U:
+			u32Return = C_FCU__RTI_COUNTER1_HZ / 25U * 2U;
+			break;
+
+		case 6U:
+			u32Return = C_FCU__RTI_COUNTER1_HZ / 25U * 4U;
+			break;
+
+		case 1U:
+			u32Return = C_FCU__RTI_COUNTER1_HZ / 25U * 16U;
+			break;
+
+		default:
+			u32Return = C_FCU__RTI_COUNTER1_HZ / u32Rate;
+			break;
+	}
+
+	return u32Return;
+}
+
+//FIR then IIR on one axis, returns counts in Q8
+static Lint32 s32FCU_ACCEL_FIFO__Filter(Luint8 u8Device, Luint8 u8Axis, Lint16 s16Sample)
+{
+	Luint8 u8Counter;
+	Luint8 u8Pos;
+	Lint64 s64Acc;
+	Lint32 s32FIR_Q8;
+	Lint32 s32IIR_Q8;
+
+	u8Pos = sFCU.sAccel.sChannels[u8Device].sFifo.u8FIR_Index;
+	sFCU.sAccel.sChannels[u8Device].sFifo.s16FIR_History[u8Axis][u8Pos] = s16Sample;
+
+	//newest sample against tap 0
+	s64Acc = 0;
+	for(u8Counter = 0U; u8Counter < sFCU.sAccel.sFilter.u8FIR_Taps; u8Counter++)
+	{
+		s64Acc += (Lint64)sFCU.sAccel.sFilter.s16FIR_Coeff_Q15[u8Counter] * (Lint64)sFCU.sAccel.sChannels[u8Device].sFifo.s16FIR_History[u8Axis][u8Pos];
+		if(u8Pos == 0U)
+		{
+			u8Pos = C_FCU__ACCEL_FIR_MAX_TAPS - 1U;
+		}
+		else
+		{
+			u8Pos--;
+		}
+	}
+
+	//Q15 down to Q8
+	s32FIR_Q8 = (Lint32)(s64Acc / 128);
+
+	s32IIR_Q8 = sFCU.sAccel.sChannels[u8Device].sFifo.s32IIR_Q8[u8Axis];
+	s32IIR_Q8 += (Lint32)(((Lint64)sFCU.sAccel.sFilter.s16IIR_Alpha_Q15 * (Lint64)(s32FIR_Q8 - s32IIR_Q8)) / 32768);
+
+	return s32IIR_Q8;
+}
+
+//trapezoid accel into velocity and velocity into displacement over the real sample spacing
+static void vFCU_ACCEL_FIFO__Integrate(Luint8 u8Device, Lint32 s32Accel_mm_ss, Luint64 u64Time)
+{
+	Luint64 u64Delta;
+	Lint32 s32Veloc_um_s;
+	Lint64 s64Whole;
+
+	if(sFCU.sAccel.sChannels[u8Device].sFifo.u8Primed == 1U)
+	{
+		if(u64Time > sFCU.sAccel.sChannels[u8Device].sFifo.u64LastSample_Time)
+		{
+			u64Delta = u64Time - sFCU.sAccel.sChannels[u8Device].sFifo.u64LastSample_Time;
+		}
+		else
+		{
+			u64Delta = 0U;
+		}
+
+		//(a0 + a1).dt, mm/sec^2 x 20ns x 2
+		sFCU.sAccel.sChannels[u8Device].sFifo.s64VelocSum += ((Lint64)sFCU.sAccel.sChannels[u8Device].sFifo.s32PrevAccel_mm_ss + (Lint64)s32Accel_mm_ss) * (Lint64)u64Delta;
+		s32Veloc_um_s = (Lint32)((sFCU.sAccel.sChannels[u8Device].sFifo.s64VelocSum * 1000) / ((Lint64)C_FCU__RTI_COUNTER1_HZ * 2));
+
+		//(v0 + v1).dt, um/sec x 20ns x 2, whole um are moved out as we go
+		sFCU.sAccel.sChannels[u8Device].sFifo.s64DispSum += ((Lint64)sFCU.sAccel.sChannels[u8Device].sFifo.s32Veloc_um_s + (Lint64)s32Veloc_um_s) * (Lint64)u64Delta;
+		s64Whole = sFCU.sAccel.sChannels[u8Device].sFifo.s64DispSum / ((Lint64)C_FCU__RTI_COUNTER1_HZ * 2);
+		sFCU.sAccel.sChannels[u8Device].sFifo.s64Disp_um += s64Whole;
+		sFCU.sAccel.sChannels[u8Device].sFifo.s64DispSum -= s64Whole * ((Lint64)C_FCU__RTI_COUNTER1_HZ * 2);
+
+		sFCU.sAccel.sChannels[u8Device].sFifo.s32Veloc_um_s = s32Veloc_um_s;
+	}
+	else
+	{
+		//first sample, nothing to integrate over yet
+		sFCU.sAccel.sChannels[u8Device].sFifo.u8Primed = 1U;
+	}
+
+	sFCU.sAccel.sChannels[u8Device].sFifo.s32PrevAccel_mm_ss = s32Accel_mm_ss;
+	sFCU.sAccel.sChannels[u8Device].sFifo.u64LastSample_Time = u64Time;
+
+	//keep the existing outputs in step
+	sFCU.sAccel.sChannels[u8Device].s32PrevVeloc_mm_s = sFCU.sAccel.sChannels[u8Device].s32CurrentVeloc_mm_s;
+	sFCU.sAccel.sChannels[u8Device].s32CurrentVeloc_mm_s = sFCU.sAccel.sChannels[u8Device].sFifo.s32Veloc_um_s / 1000;
+	sFCU.sAccel.sChannels[u8Device].s32PrevDisplacement_mm = sFCU.sAccel.sChannels[u8Device].s32CurrentDisplacement_mm;
+	sFCU.sAccel.sChannels[u8Device].s32CurrentDisplacement_mm = (Luint32)(sFCU.sAccel.sChannels[u8Device].sFifo.s64Disp_um / 1000);
+}
+
+
+#endif //C_LOCALDEF__LCCM655__ENABLE_ACCEL_FIFO
+#endif //C_LOCALDEF__LCCM655__ENABLE_ACCEL
+#endif //#if C_LOCALDEF__LCCM655__ENABLE_THIS_MODULE == 1U
+//safetys
+#ifndef C_LOCALDEF__LCCM655__ENABLE_THIS_MODULE
+	#error
+#endif
@@ -7,9 +7,189 @@
 //the structure
 extern struct _strFCU sFCU;
 
+//locals
+static void __cdecl vFCU_ACCEL_WIN32__ReadData(Luint8 u8DeviceIndex, Lint16 *ps16X, Lint16 *ps16Y, Lint16 *ps16Z);
+#if C_LOCALDEF__LCCM655__ENABLE_ACCEL_FIFO == 1U
+	static void vFCU_ACCEL_WIN32__Push_FIFO(Luint8 u8DeviceIndex);
+#endif
+
+/***************************************************************************//**
+ * @brief
+ * Point the MMA8451 driver's WIN32 read at our injected samples
+ *
+ * @st_funcMD5		BC9D3F565972D12B99109D3605B58565
+ * @st_funcID		LCCM655R0.FILE.097.FUNC.001
+ */
+void vFCU_ACCEL_WIN32__Init(void)
+{
+	Luint8 u8Device;
+	Luint8 u8Axis;
+
+	for(u8Device = 0U; u8Device < C_FCU__NUM_ACCEL_CHIPS; u8Device++)
+	{
+		for(u8Axis = 0U; u8Axis < (Luint8)MMA8451_AXIS__MAX; u8Axis++)
+		{
+			sFCU.sAccel.sChannels[u8Device].s16WIN32_Raw[u8Axis] = 0;
+		}
+		#if C_LOCALDEF__LCCM655__ENABLE_ACCEL_FIFO == 1U
+			sFCU.sAccel.sChannels[u8Device].u8WIN32_FifoCount = 0U;
+			sFCU.sAccel.sChannels[u8Device].u8WIN32_FifoOverflow = 0U;
+			sFCU.sAccel.sChannels[u8Device].u64WIN32_FifoTime = 0U;
+		#endif
+	}
+
+	vSIL3_MMA8451_WIN32__Set_ReadDataCallback(&vFCU_ACCEL_WIN32__ReadData);
+}
+
+/***************************************************************************//**
+ * @brief
+ * Inject a raw accel sample, the driver reads it as if the device had just
+ * raised its data ready interrupt.
+ *
+ * @note
+ * In FIFO mode the XYZ sample is pushed into the emulated device FIFO
+ * instead, oldest dropped on overflow as the device does in circular mode.
+ *
+ * @param[in]		s32Value				Raw counts, clamped to 14 bits
+ * @param[in]		u8ChannelIndex			MMA8451__AXIS_E
+ * @param[in]		u8DeviceIndex			Accel device
+ * @st_funcMD5		9F9D7C3622D6726C0E4F0E28A7ACD725
+ * @st_funcID		LCCM655R0.FILE.097.FUNC.002
+ */
 void vFCU_ACCEL_WIN32__Set_Raw(Luint8 u8DeviceIndex, Luint8 u8ChannelIndex, Lint32 s32Value)
 {
+	if((u8DeviceIndex < C_FCU__NUM_ACCEL_CHIPS) && (u8ChannelIndex < (Luint8)MMA8451_AXIS__MAX))
+	{
+		//the device is 14 bit
+		if(s32Value > 8191)
+		{
+			s32Value = 8191;
+		}
+		else if(s32Value < -8192)
+		{
+			s32Value = -8192;
+		}
+		else
+		{
+			//fall on
+		}
+
+		sFCU.sAccel.sChannels[u8DeviceIndex].s16WIN32_Raw[u8ChannelIndex] = (Lint16)s32Value;
+
+	#if C_LOCALDEF__LCCM655__ENABLE_ACCEL_FIFO == 1U
+		vFCU_ACCEL_WIN32__Push_FIFO(u8DeviceIndex);
+	#else
+		vSIL3_MMA8451_WIN32__TriggerInterrupt(u8DeviceIndex);
+	#endif
+	}
+	else
+	{
+		//error
+	}
+}
+
+#if C_LOCALDEF__LCCM655__ENABLE_ACCEL_FIFO == 1U
+/***************************************************************************//**
+ * @brief
+ * Drain the emulated FIFO the way the FIFO burst read would
+ *
+ * @param[out]		pu8Buffer				C_FCU__ACCEL_FIFO_DEPTH samples of bus bytes
+ * @param[in]		u8DeviceIndex			Accel device
+ * @return			F_STATUS as the device would report it before the burst
+ * @st_funcMD5		BC8E1B29D203C80FE076BC4D87C9B855
+ * @st_funcID		LCCM655R0.FILE.097.FUNC.003
+ */
+Luint8 u8FCU_ACCEL_WIN32__Read_FIFO(Luint8 u8DeviceIndex, Luint8 *pu8Buffer)
+{
+	Luint8 u8Counter;
+	Luint8 u8Byte;
+	Luint8 u8Return;
 
+	if(u8DeviceIndex < C_FCU__NUM_ACCEL_CHIPS)
+	{
+		u8Return = sFCU.sAccel.sChannels[u8DeviceIndex].u8WIN32_FifoCount;
+		if(sFCU.sAccel.sChannels[u8DeviceIndex].u8WIN32_FifoOverflow == 1U)
+		{
+			u8Return |= C_FCU__ACCEL_FIFO_STATUS__OVERFLOW;
+		}
+		else
+		{
+			//fall on
+		}
+
+		for(u8Counter = 0U; u8Counter < sFCU.sAccel.sChannels[u8DeviceIndex].u8WIN32_FifoCount; u8Counter++)
+		{
+			for(u8Byte = 0U; u8Byte < C_FCU__ACCEL_FIFO_SAMPLE_BYTES; u8Byte++)
+			{
+				pu8Buffer[(u8Counter * C_FCU__ACCEL_FIFO_SAMPLE_BYTES) + u8Byte] = sFCU.sAccel.sChannels[u8DeviceIndex].u8WIN32_Fifo[u8Counter][u8Byte];
+			}
+		}
+
+		sFCU.sAccel.sChannels[u8DeviceIndex].u8WIN32_FifoCount = 0U;
+		sFCU.sAccel.sChannels[u8DeviceIndex].u8WIN32_FifoOverflow = 0U;
+	}
+	else
+	{
+		u8Return = 0U;
+	}
+
+	return u8Return;
+}
+
+//push the current raw XYZ into the emulated FIFO
+static void vFCU_ACCEL_WIN32__Push_FIFO(Luint8 u8DeviceIndex)
+{
+	Luint8 u8Counter;
+	Luint8 u8Byte;
+	Luint8 u8Axis;
+	Luint16 u16Temp;
+
+	if(sFCU.sAccel.sChannels[u8DeviceIndex].u8WIN32_FifoCount >= C_FCU__ACCEL_FIFO_DEPTH)
+	{
+		//circular, lose the oldest
+		for(u8Counter = 1U; u8Counter < C_FCU__ACCEL_FIFO_DEPTH; u8Counter++)
+		{
+			for(u8Byte = 0U; u8Byte < C_FCU__ACCEL_FIFO_SAMPLE_BYTES; u8Byte++)
+			{
+				sFCU.sAccel.sChannels[u8DeviceIndex].u8WIN32_Fifo[u8Counter - 1U][u8Byte] = sFCU.sAccel.sChannels[u8DeviceIndex].u8WIN32_Fifo[u8Counter][u8Byte];
+			}
+		}
+		sFCU.sAccel.sChannels[u8DeviceIndex].u8WIN32_FifoCount = C_FCU__ACCEL_FIFO_DEPTH - 1U;
+		sFCU.sAccel.sChannels[u8DeviceIndex].u8WIN32_FifoOverflow = 1U;
+	}
+	else
+	{
+		//fall on
+	}
+
+	u8Counter = sFCU.sAccel.sChannels[u8DeviceIndex].u8WIN32_FifoCount;
+	for(u8Axis = 0U; u8Axis < (Luint8)MMA8451_AXIS__MAX; u8Axis++)
+	{
+		//14 bit left justified, big endian
+		u16Temp = (Luint16)(sFCU.sAccel.sChannels[u8DeviceIndex].s16WIN32_Raw[u8Axis] * 4);
+		sFCU.sAccel.sChannels[u8DeviceIndex].u8WIN32_Fifo[u8Counter][u8Axis * 2U] = (Luint8)(u16Temp >> 8U);
+		sFCU.sAccel.sChannels[u8DeviceIndex].u8WIN32_Fifo[u8Counter][(u8Axis * 2U) + 1U] = (Luint8)(u16Temp & 0x00FFU);
+	}
+	sFCU.sAccel.sChannels[u8DeviceIndex].u8WIN32_FifoCount++;
+	sFCU.sAccel.sChannels[u8DeviceIndex].u64WIN32_FifoTime = u64RM4_RTI__Get_Counter1();
+}
+#endif //C_LOCALDEF__LCCM655__ENABLE_ACCEL_FIFO
+
+//driver read callback
+static void __cdecl vFCU_ACCEL_WIN32__ReadData(Luint8 u8DeviceIndex, Lint16 *ps16X, Lint16 *ps16Y, Lint16 *ps16Z)
+{
+	if(u8DeviceIndex < C_FCU__NUM_ACCEL_CHIPS)
+	{
+		*ps16X = sFCU.sAccel.sChannels[u8DeviceIndex].s16WIN32_Raw[MMA8451_AXIS__X];
+		*ps16Y = sFCU.sAccel.sChannels[u8DeviceIndex].s16WIN32_Raw[MMA8451_AXIS__Y];
+		*ps16Z = sFCU.sAccel.sChannels[u8DeviceIndex].s16WIN32_Raw[MMA8451_AXIS__Z];
+	}
+	else
+	{
+		*ps16X = 0;
+		*ps16Y = 0;
+		*ps16Z = 0;
+	}
 }
 
 
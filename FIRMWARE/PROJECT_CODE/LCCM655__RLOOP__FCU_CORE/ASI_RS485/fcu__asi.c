@@ -32,6 +32,9 @@ void vFCU_ASI__SetErr(struct _strASICmd *pCmd);
 void vFCU_ASI__MemCopy(Luint8 *pu8Dest, const Luint8 *cpu8Source, Luint32 u32Length);
 Lint16 s16FCU_ASI__SendCommand(void);
 Lint16 s16FCU_ASI__ProcessReply(void);
+static void vFCU_ASI__Issue_Read(void);
+static void vFCU_ASI__Next_Engine(void);
+static void vFCU_ASI__Parse_Block(Luint8 u8EngineIndex);
 
 
 //Because of addx 1 always being responded to, we need to do from address 2 to 9
@@ -92,21 +95,13 @@ void vFCU_ASI__Init(void)
 	}
 
 
-	//setup the command list
-	sFCU.sASI.eCommandList[0] = C_FCU_ASI__FAULTS;
-	sFCU.sASI.eCommandList[1] = C_FCU_ASI__MOTOR_CURRENT;
-	sFCU.sASI.eCommandList[2] = C_FCU_ASI__CONT_TEMP;
-	sFCU.sASI.eCommandList[3] = C_FCU_ASI__MOTOR_RPM;
-	sFCU.sASI.eCommandList[4] = C_FCU_ASI__THROT_VOLTAGE;
-	sFCU.sASI.u8CommandListIndex = 0U;
-
 	//clear our holding data
 	for(u8Counter = 0U; u8Counter < C_FCU__NUM_HOVER_ENGINES; u8Counter++)
 	{
 		//set the slave addx
 		vSIL3_MODBUS_MASTER_SLAVEREGS__Set_SlaveAddx(u8Counter, u8Counter + C_ASI__ADDX_OFFSET);
 
-		//setup the Modbus system to handle the slave data
+		//setup the Modbus system to handle the slave data, all inside the one block read
 		vSIL3_MODBUS_MASTER_SLAVEREGS__Set_RegisterAddx(u8Counter, 0, (C_FCU_ASI__FAULTS));
 		vSIL3_MODBUS_MASTER_SLAVEREGS__Set_RegisterAddx(u8Counter, 1, (C_FCU_ASI__MOTOR_CURRENT));
 		vSIL3_MODBUS_MASTER_SLAVEREGS__Set_RegisterAddx(u8Counter, 2, (C_FCU_ASI__CONT_TEMP));
@@ -124,6 +119,9 @@ void vFCU_ASI__Init(void)
 		sFCU.sASI.u8ThrottleCommand[u8Counter] = 0U;
 		sFCU.sASI.u8SerialNetworkCommand[u8Counter] = 1U;
 		sFCU.sASI.u32TimeoutCounts[u8Counter] = 0U;
+
+		//never seen
+		sFCU.sASI.u32RefreshAge_x10ms[u8Counter] = 0xFFFFFFFFU;
 	}
 
 }
@@ -138,6 +136,7 @@ void vFCU_ASI__Process(void)
 {
 	Luint8 u8Temp;
 	Luint8 u8ByteIndex;
+	Luint8 u8PrevIndex;
 	Lint16 s16Return;
 
 	if(sFCU.sASI.u32Guard1 != 0xABCDABCDU)
@@ -182,7 +181,7 @@ void vFCU_ASI__Process(void)
 	{
 		case ASI_STATE__IDLE:
 
-			//wait 100ms between scans
+			//wait 100ms between sweeps of all the engines
 			if(sFCU.sASI.u810MS_Timer >= sFCU.sASI.u8MaxScanTime)
 			{
 				//change to send a command
@@ -216,16 +215,7 @@ void vFCU_ASI__Process(void)
 			u8Temp = u8SIL3_MODBUS_MASTER__Get_IsBusy();
 			if(u8Temp == 0U)
 			{
-				//set the slave Addx to be n + 1 (i.e. first engine is 1)
-				s16Return = s16SIL3_MODBUS_MASTER_CMD__Slave_Reqest_Read(sFCU.sASI.u8ScanIndex + C_ASI__ADDX_OFFSET,
-																		 MODBUS_FUNCCODE__READ_MULTIPLE_HOLDING_REGS,
-																		 sFCU.sASI.eCommandList[sFCU.sASI.u8CommandListIndex],
-																		 1U);
-				sFCU.sASI.eMainState = ASI_STATE__WAIT_COMMAND_COMPLETE;
-
-				//clear the timeout
-				sFCU.sASI.u32WaitCommandTimeout = 0U;
-
+				vFCU_ASI__Issue_Read();
 			}
 			else
 			{
@@ -246,6 +236,23 @@ void vFCU_ASI__Process(void)
 
 				}
 			}
+
+			//the master stayed busy or kept refusing the request
+			if((sFCU.sASI.eMainState == ASI_STATE__ISSUE_COMMAND) && (sFCU.sASI.u32WaitCommandTimeout > C_ASI__MAX_COMMAND_TIMEOUT))
+			{
+				sFCU.sASI.u32TimeoutCounts[sFCU.sASI.u8ScanIndex]++;
+
+				//move on
+				sFCU.sASI.u32WaitCommandTimeout = 0U;
+				sFCU.sASI.eMainState = ASI_STATE__INC_SCAN_INDEX;
+
+				//set the faults to all 1
+				sFCU.sASI.sHolding[sFCU.sASI.u8ScanIndex].u16Faults = 0xFFFFU;
+			}
+			else
+			{
+				//fall on
+			}
 			break;
 
 		case ASI_STATE__WAIT_COMMAND_COMPLETE:
@@ -255,51 +262,24 @@ void vFCU_ASI__Process(void)
 			{
 
 				s16Return = s16SIL3_MODBUS_MASTER__Get_LastErrorCode();
-				if(s16Return >= 0)
-				{
-					//we passed the read check, now lets look at the packet
-					switch(sFCU.sASI.eCommandList[sFCU.sASI.u8CommandListIndex])
-					{
-
-						case C_FCU_ASI__FAULTS:
-							sFCU.sASI.sHolding[sFCU.sASI.u8ScanIndex].u16Faults = u16SIL3_MODBUS_MASTER_SLAVEREGS__Get_RegisterValue_Addx(sFCU.sASI.u8ScanIndex, C_FCU_ASI__FAULTS);
-							break;
-
-						case C_FCU_ASI__CONT_TEMP:
-							sFCU.sASI.sHolding[sFCU.sASI.u8ScanIndex].f32TempC = (Lfloat32)u16SIL3_MODBUS_MASTER_SLAVEREGS__Get_RegisterValue_Addx(sFCU.sASI.u8ScanIndex, C_FCU_ASI__CONT_TEMP);
-							break;
 
-						case C_FCU_ASI__MOTOR_CURRENT:
-							sFCU.sASI.sHolding[sFCU.sASI.u8ScanIndex].f32MotorCurrentA = (Lfloat32)u16SIL3_MODBUS_MASTER_SLAVEREGS__Get_RegisterValue_Addx(sFCU.sASI.u8ScanIndex, C_FCU_ASI__MOTOR_CURRENT);
-							sFCU.sASI.sHolding[sFCU.sASI.u8ScanIndex].f32MotorCurrentA /= 32.0F;
-							break;
+				//the reply for this engine is held in its own slave registers, so get the
+				//next engine's request on the wire before we parse this one
+				u8PrevIndex = sFCU.sASI.u8ScanIndex;
+				vFCU_ASI__Next_Engine();
 
-						case C_FCU_ASI__MOTOR_RPM:
-							sFCU.sASI.sHolding[sFCU.sASI.u8ScanIndex].u16RPM = u16SIL3_MODBUS_MASTER_SLAVEREGS__Get_RegisterValue_Addx(sFCU.sASI.u8ScanIndex, C_FCU_ASI__MOTOR_RPM);
-							break;
-
-						case C_FCU_ASI__THROT_VOLTAGE:
-							sFCU.sASI.sHolding[sFCU.sASI.u8ScanIndex].f32ThrottleV = u16SIL3_MODBUS_MASTER_SLAVEREGS__Get_RegisterValue_Addx(sFCU.sASI.u8ScanIndex, C_FCU_ASI__THROT_VOLTAGE);
-							sFCU.sASI.sHolding[sFCU.sASI.u8ScanIndex].f32ThrottleV /= 4096.0F;
-							break;
-
-						default:
-							//do nothing
-							break;
-
-					}//switch(sFCU.sASI.eCommandList[sFCU.sASI.u8CommandListIndex])
+				if(s16Return >= 0)
+				{
+					vFCU_ASI__Parse_Block(u8PrevIndex);
 				}
 				else
 				{
 					//probably had a timeout
 
 					//if we did, this is ok as it was detected by the modbus master, lets just flag us so as we know what that was
-					sFCU.sASI.sHolding[sFCU.sASI.u8ScanIndex].u16Faults = 0xFFFFU;
+					sFCU.sASI.sHolding[u8PrevIndex].u16Faults = 0xFFFFU;
 
 				}
-
-				//move on
-				sFCU.sASI.eMainState = ASI_STATE__INC_SCAN_INDEX;
 			}
 			else
 			{
@@ -329,33 +309,8 @@ void vFCU_ASI__Process(void)
 
 		case ASI_STATE__INC_SCAN_INDEX:
 
-			if(sFCU.sASI.u8ScanIndex < C_FCU__NUM_HOVER_ENGINES - 1)
-			{
-				//move to the next scan index
-				sFCU.sASI.u8ScanIndex++;
-			}
-			else
-			{
-				//clear it
-				sFCU.sASI.u8ScanIndex = 0U;
-
-				//inc the command index
-				sFCU.sASI.u8CommandListIndex++;
-				if(sFCU.sASI.u8CommandListIndex >= C_FCU__ASI_COMMAND_LIST_MAX)
-				{
-					sFCU.sASI.u8CommandListIndex = 0U;
-				}
-				else
-				{
-					//fall on
-				}
-
-			}
-
-			//clear the timer
-			sFCU.sASI.u810MS_Timer = 0U;
-
-			sFCU.sASI.eMainState = ASI_STATE__IDLE;
+			//after a timeout, no reply to parse
+			vFCU_ASI__Next_Engine();
 			break;
 
 		case ASI_STATE__INHIBIT:
@@ -376,12 +331,50 @@ void vFCU_ASI__Process(void)
  */
 void vFCU_ASI__10MS_ISR(void)
 {
+	Luint8 u8Counter;
 
 	//tell the modbus layer about our timer.
 	vSIL3_MODBUS__10MS_Timer();
 
 	sFCU.sASI.u810MS_Timer++;
 	sFCU.sASI.u32WaitCommandTimeout++;
+
+	for(u8Counter = 0U; u8Counter < C_FCU__NUM_HOVER_ENGINES; u8Counter++)
+	{
+		if(sFCU.sASI.u32RefreshAge_x10ms[u8Counter] < 0xFFFFFFFFU)
+		{
+			sFCU.sASI.u32RefreshAge_x10ms[u8Counter]++;
+		}
+		else
+		{
+			//saturated, never seen
+		}
+	}
+}
+
+/***************************************************************************//**
+ * @brief
+ * How old the telemetry of an engine is
+ *
+ * @param[in]		u8EngineIndex			The hover engine
+ * @return			10ms ticks since the last good block, 0xFFFFFFFF if never seen
+ * @st_funcMD5		4BA676B6FBAE387107019D654639966D
+ * @st_funcID		LCCM655R0.FILE.102.FUNC.001
+ */
+Luint32 u32FCU_ASI__Get_RefreshAge_x10ms(Luint8 u8EngineIndex)
+{
+	Luint32 u32Return;
+
+	if(u8EngineIndex < C_FCU__NUM_HOVER_ENGINES)
+	{
+		u32Return = sFCU.sASI.u32RefreshAge_x10ms[u8EngineIndex];
+	}
+	else
+	{
+		u32Return = 0xFFFFFFFFU;
+	}
+
+	return u32Return;
 }
 
 Luint16 u16FCU_ASI__ReadMotorRpm(Luint8 u8EngineIndex)
@@ -436,6 +429,88 @@ void vFCU_ASI__Set_Throttle(Luint8 u8Index, Luint16 u16RPM)
 
 }
 
+//read the whole telemetry block of the current scan index in one request,
+//falls back to issue command if the master is busy or refuses it
+static void vFCU_ASI__Issue_Read(void)
+{
+	Luint8 u8Busy;
+	Lint16 s16Return;
+
+	//after a timeout the last transaction may still own the master
+	u8Busy = u8SIL3_MODBUS_MASTER__Get_IsBusy();
+	if(u8Busy == 0U)
+	{
+		//set the slave Addx to be n + offset
+		s16Return = s16SIL3_MODBUS_MASTER_CMD__Slave_Reqest_Read(sFCU.sASI.u8ScanIndex + C_ASI__ADDX_OFFSET,
+																 MODBUS_FUNCCODE__READ_MULTIPLE_HOLDING_REGS,
+																 C_FCU__ASI_BLOCK_START_ADDX,
+																 C_FCU__ASI_BLOCK_NUM_REGS);
+	}
+	else
+	{
+		s16Return = -1;
+	}
+
+	if(s16Return >= 0)
+	{
+		sFCU.sASI.eMainState = ASI_STATE__WAIT_COMMAND_COMPLETE;
+
+		//clear the timeout
+		sFCU.sASI.u32WaitCommandTimeout = 0U;
+	}
+	else
+	{
+		//retry from issue command, keep the timeout running so we move on if it never goes
+		sFCU.sASI.eMainState = ASI_STATE__ISSUE_COMMAND;
+	}
+}
+
+//next engine straight away, or back to idle once the sweep is done
+static void vFCU_ASI__Next_Engine(void)
+{
+	if(sFCU.sASI.u8ScanIndex < (C_FCU__NUM_HOVER_ENGINES - 1U))
+	{
+		//move to the next scan index
+		sFCU.sASI.u8ScanIndex++;
+
+		//setup the channel mux to our next channel
+		//vFCU_ASI_MUX__SelectChannel(sFCU.sASI.u8ScanIndex);
+
+		//fresh timeout for this engine
+		sFCU.sASI.u32WaitCommandTimeout = 0U;
+
+		vFCU_ASI__Issue_Read();
+	}
+	else
+	{
+		//clear it
+		sFCU.sASI.u8ScanIndex = 0U;
+
+		//clear the timer
+		sFCU.sASI.u810MS_Timer = 0U;
+
+		sFCU.sASI.eMainState = ASI_STATE__IDLE;
+	}
+}
+
+//pull the telemetry out of the slave registers
+static void vFCU_ASI__Parse_Block(Luint8 u8EngineIndex)
+{
+	sFCU.sASI.sHolding[u8EngineIndex].u16Faults = u16SIL3_MODBUS_MASTER_SLAVEREGS__Get_RegisterValue_Addx(u8EngineIndex, C_FCU_ASI__FAULTS);
+
+	sFCU.sASI.sHolding[u8EngineIndex].f32TempC = (Lfloat32)u16SIL3_MODBUS_MASTER_SLAVEREGS__Get_RegisterValue_Addx(u8EngineIndex, C_FCU_ASI__CONT_TEMP);
+
+	sFCU.sASI.sHolding[u8EngineIndex].f32MotorCurrentA = (Lfloat32)u16SIL3_MODBUS_MASTER_SLAVEREGS__Get_RegisterValue_Addx(u8EngineIndex, C_FCU_ASI__MOTOR_CURRENT);
+	sFCU.sASI.sHolding[u8EngineIndex].f32MotorCurrentA /= 32.0F;
+
+	sFCU.sASI.sHolding[u8EngineIndex].u16RPM = u16SIL3_MODBUS_MASTER_SLAVEREGS__Get_RegisterValue_Addx(u8EngineIndex, C_FCU_ASI__MOTOR_RPM);
+
+	sFCU.sASI.sHolding[u8EngineIndex].f32ThrottleV = (Lfloat32)u16SIL3_MODBUS_MASTER_SLAVEREGS__Get_RegisterValue_Addx(u8EngineIndex, C_FCU_ASI__THROT_VOLTAGE);
+	sFCU.sASI.sHolding[u8EngineIndex].f32ThrottleV /= 4096.0F;
+
+	sFCU.sASI.u32RefreshAge_x10ms[u8EngineIndex] = 0U;
+}
+
 
 #endif //C_LOCALDEF__LCCM655__ENABLE_ASI_RS485
 #ifndef C_LOCALDEF__LCCM655__ENABLE_ASI_RS485
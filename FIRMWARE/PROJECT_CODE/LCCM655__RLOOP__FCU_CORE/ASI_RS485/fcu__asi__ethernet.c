@@ -41,7 +41,7 @@ void vFCU_ASI_ETH__Init(void)
  * Do the ASI eth transmission
  * 
  * @param[in]		ePacketType				Packet Type
- * @st_funcMD5		260C0787E18A7F41E81D8A4DEDDEB992
+ * @st_funcMD5		5A05F2BA750B90D887E76BC497D2CD60
  * @st_funcID		LCCM655R0.FILE.074.FUNC.002
  */
 void vFCU_ASI_ETH__Transmit(E_NET__PACKET_T ePacketType)
@@ -60,7 +60,7 @@ void vFCU_ASI_ETH__Transmit(E_NET__PACKET_T ePacketType)
 	{
 		case NET_PKT__FCU_ASI__TX_ASI_DATA:
 			u16Length = 8U ;
-			u16Length += (C_FCU__NUM_HOVER_ENGINES * 20U);
+			u16Length += (C_FCU__NUM_HOVER_ENGINES * 24U);
 			break;
 
 
@@ -92,8 +92,8 @@ void vFCU_ASI_ETH__Transmit(E_NET__PACKET_T ePacketType)
 				pu8Buffer[0] = (Luint8)sFCU.sASI.u8ScanIndex;
 				pu8Buffer += 1U;
 
-				//current command being sent
-				vSIL3_NUM_CONVERT__Array_U16(pu8Buffer, (Luint16)sFCU.sASI.eCommandList[sFCU.sASI.u8CommandListIndex]);
+				//first register of the block being read
+				vSIL3_NUM_CONVERT__Array_U16(pu8Buffer, C_FCU__ASI_BLOCK_START_ADDX);
 				pu8Buffer += 2U;
 
 
@@ -123,6 +123,10 @@ void vFCU_ASI_ETH__Transmit(E_NET__PACKET_T ePacketType)
 					vSIL3_NUM_CONVERT__Array_F32(pu8Buffer, sFCU.sThrottle.f32CurrentVolts[u8Counter]);
 					pu8Buffer += 4U;
 
+					//telemetry age, 10ms ticks
+					vSIL3_NUM_CONVERT__Array_U32(pu8Buffer, sFCU.sASI.u32RefreshAge_x10ms[u8Counter]);
+					pu8Buffer += 4U;
+
 
 				}
 				break;
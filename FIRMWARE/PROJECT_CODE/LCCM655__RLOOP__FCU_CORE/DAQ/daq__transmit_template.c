@@ -30,6 +30,14 @@ Lint16 s16SIL3_DAQ_TRANSMIT__Template(Luint16 u16Index, Luint8 *pu8BufferPointer
 	//set the payload length
 	u16Length = u16LengthBytes;
 
+#if C_LOCALDEF__LCCM662__ENABLE_ZERO_COPY_TX == 1U
+	//hand the ring straight to the EMAC, the DAQ holds the slots until the Tx is done
+	#if C_LOCALDEF__LCCM662__ENABLE_USER_PAYLOAD_TYPES == 1U
+	s16R = s16SIL3_DAQ_TRANSMIT_ZC__Tx(sDAQ.u16User_PacketType[u16Index], C_RLOOP_NET_PORT__FCU, pu8BufferPointer, u16Length);
+	#else
+	s16R = s16SIL3_DAQ_TRANSMIT_ZC__Tx((Luint16)NET_PKT__FCU_DAQ__OFFSET_INDEX + u16Index, C_RLOOP_NET_PORT__FCU, pu8BufferPointer, u16Length);
+	#endif
+#else
 
 	//try and precommit to a UDP packet, if successful space then we get a buffer pointer and index
 	//for future transmit
@@ -41,7 +49,7 @@ Lint16 s16SIL3_DAQ_TRANSMIT__Template(Luint16 u16Index, Luint8 *pu8BufferPointer
 	if(s16Return == 0)
 	{
 
-		//do the actual copy, blind for now, DMA in future
+		//do the actual copy, enable C_LOCALDEF__LCCM662__ENABLE_ZERO_COPY_TX to avoid this
 		for(u16Counter = 0U; u16Counter < u16Length; u16Counter++)
 		{
 			pu8Buffer[u16Counter] = pu8BufferPointer[u16Counter];
@@ -58,9 +66,71 @@ Lint16 s16SIL3_DAQ_TRANSMIT__Template(Luint16 u16Index, Luint8 *pu8BufferPointer
 		//maybe the ETH was busy with an ARP or something, come back around and re-try in a minute
 		s16R = -1;
 	}
+#endif //C_LOCALDEF__LCCM662__ENABLE_ZERO_COPY_TX
+
+	return s16R;
+}
+
+#if C_LOCALDEF__LCCM662__ENABLE_ZERO_COPY_TX == 1U
+//transmit a wrapped ring as one packet, the halves are DMA'd into the EMAC buffer
+Lint16 s16SIL3_DAQ_TRANSMIT__Template_Wrapped(Luint16 u16Index, Luint8 *pu8First, Luint16 u16FirstLength, Luint8 *pu8Second, Luint16 u16SecondLength)
+{
+	Lint16 s16R;
+
+	#if C_LOCALDEF__LCCM662__ENABLE_USER_PAYLOAD_TYPES == 1U
+	s16R = s16SIL3_DAQ_TRANSMIT_ZC__Tx_Wrapped(sDAQ.u16User_PacketType[u16Index], C_RLOOP_NET_PORT__FCU, pu8First, u16FirstLength, pu8Second, u16SecondLength);
+	#else
+	s16R = s16SIL3_DAQ_TRANSMIT_ZC__Tx_Wrapped((Luint16)NET_PKT__FCU_DAQ__OFFSET_INDEX + u16Index, C_RLOOP_NET_PORT__FCU, pu8First, u16FirstLength, pu8Second, u16SecondLength);
+	#endif
+
+	return s16R;
+}
+#endif //C_LOCALDEF__LCCM662__ENABLE_ZERO_COPY_TX
+
+#if C_LOCALDEF__LCCM662__ENABLE_PACKED_FRAMES == 1U
+//transmit a packed multi channel frame or its schema
+Lint16 s16SIL3_DAQ_TRANSMIT__Template_Packed(Luint16 u16Type, Luint8 *pu8BufferPointer, Luint16 u16LengthBytes)
+{
+	Lint16 s16R;
+	Lint16 s16Return;
+	Luint16 u16Counter;
+	Luint16 u16PacketType;
+	Luint8 u8BufferIndex;
+	//pointer to the EMAC data allowing us to fill up here.
+	Luint8 *pu8Buffer;
+
+	if(u16Type == (Luint16)DAQ_PACKED__SCHEMA)
+	{
+		u16PacketType = (Luint16)NET_PKT__FCU_DAQ__PACKED_SCHEMA;
+	}
+	else
+	{
+		u16PacketType = (Luint16)NET_PKT__FCU_DAQ__PACKED_FRAME;
+	}
+
+	s16Return = s16SIL3_SAFEUDP_TX__PreCommit(u16LengthBytes, (SAFE_UDP__PACKET_T)u16PacketType, &pu8Buffer, &u8BufferIndex);
+	if(s16Return == 0)
+	{
+		//copy the frame in
+		for(u16Counter = 0U; u16Counter < u16LengthBytes; u16Counter++)
+		{
+			pu8Buffer[u16Counter] = pu8BufferPointer[u16Counter];
+		}
+
+		//send the buffer index, with a payload length, on UDP ports (source and dest port)
+		vSIL3_SAFEUDP_TX__Commit(u8BufferIndex, u16LengthBytes, C_RLOOP_NET_PORT__FCU, C_RLOOP_NET_PORT__FCU);
+
+		s16R = 0;
+	}
+	else
+	{
+		//maybe the ETH was busy with an ARP or something, the DAQ holds the frame and re-tries
+		s16R = -1;
+	}
 
 	return s16R;
 }
+#endif //C_LOCALDEF__LCCM662__ENABLE_PACKED_FRAMES
 
 #endif //C_LOCALDEF__LCCM655__ENABLE_DAQ
 #ifndef C_LOCALDEF__LCCM655__ENABLE_DAQ
@@ -41,7 +41,7 @@ void vFCU_FAULTS_ETH__Init(void)
  * Transmit a faults eth packet
  * 
  * @param[in]		ePacketType				Type
- * @st_funcMD5		A5D2ABDF7597B56B3AB6B6AA520CA7C2
+ * @st_funcMD5		2469960CC82B7BA42E193D91AD1280C7
  * @st_funcID		LCCM655R0.FILE.078.FUNC.002
  */
 void vFCU_FAULTS_ETH__Transmit(E_NET__PACKET_T ePacketType)
@@ -128,8 +128,13 @@ void vFCU_FAULTS_ETH__Transmit(E_NET__PACKET_T ePacketType)
 				#endif
 
 				//DAQ
-				vSIL3_NUM_CONVERT__Array_U32(pu8Buffer, 0U);
-				pu8Buffer += 4U;
+				#if C_LOCALDEF__LCCM662__ENABLE_THIS_MODULE == 1U
+					vSIL3_NUM_CONVERT__Array_U32(pu8Buffer, u32SIL3_DAQ__Get_FaultFlags());
+					pu8Buffer += 4U;
+				#else
+					vSIL3_NUM_CONVERT__Array_U32(pu8Buffer, 0xFFFFFFFFU);
+					pu8Buffer += 4U;
+				#endif
 
 				//laser contrast sensors
 				//Top Level
@@ -2,53 +2,232 @@
 //single point of interface to the flight layer with our primary measurements
 //also allows the track profile to dictate what sensors are used for what measurements.
 
+//The blend is a 2 state Kalman filter, displacement and velocity.
+//Accel is not a state, it is the input to the predict step each 10ms tick.
+//The UpdateFrom functions only latch the values, all the maths happens in
+//Process so the cost per call is fixed: 1 predict and at most 6 scalar updates.
 
 #include "../../fcu_core.h"
 
 #if C_LOCALDEF__LCCM655__ENABLE_THIS_MODULE == 1U
 #if C_LOCALDEF__LCCM655__ENABLE_FLIGHT_CONTROL == 1U
-#if 0
+#if C_LOCALDEF__LCCM655__ENABLE_FCTL_BLENDER == 1U
+
 //the structure
 extern struct _strFCU sFCU;
 
+//locals
+static void vFCU_FCTL_BLENDER__Latch(TE_BLENDER_MEAS__TYPES eMeas, Lint32 s32Value);
+static void vFCU_FCTL_BLENDER__Predict(Luint32 u32Ticks);
+static void vFCU_FCTL_BLENDER__Update(TE_BLENDER_MEAS__TYPES eMeas);
+
+/** Measurement variance for each slot, accel slots are inputs so are not used */
+static const Lfloat32 f32BlenderR[BLENDER_MEAS__NUM] =
+{
+	0.0F,
+	0.0F,
+	0.0F,
+	C_FCU__BLENDER__VELOC_NOISE_ACCEL_MM_S * C_FCU__BLENDER__VELOC_NOISE_ACCEL_MM_S,
+	C_FCU__BLENDER__VELOC_NOISE_LRF_MM_S * C_FCU__BLENDER__VELOC_NOISE_LRF_MM_S,
+	C_FCU__BLENDER__VELOC_NOISE_CONTRAST_MM_S * C_FCU__BLENDER__VELOC_NOISE_CONTRAST_MM_S,
+	C_FCU__BLENDER__DISP_NOISE_ACCEL_MM * C_FCU__BLENDER__DISP_NOISE_ACCEL_MM,
+	C_FCU__BLENDER__DISP_NOISE_LRF_MM * C_FCU__BLENDER__DISP_NOISE_LRF_MM,
+	C_FCU__BLENDER__DISP_NOISE_CONTRAST_MM * C_FCU__BLENDER__DISP_NOISE_CONTRAST_MM
+};
+
 /***************************************************************************//**
  * @brief
- * ToDo
- * 
- * @st_funcMD5		6B43487B4AB4C611614B83DC0EEEBF49
+ * Init the blender, must be called before the 10ms ISR is running
+ *
+ * @st_funcMD5		467BBBB775B8FE4E9058FEA00ABC8DAE
  * @st_funcID		LCCM655R0.FILE.092.FUNC.001
  */
 void vFCU_FCTL_BLENDER__Init(void)
 {
-	//todo: init flight conditions
+	//no target until the track DB or GS tells us
+	sFCU.sFlightControl.sBlender.s32LRF_Target_mm = 0;
+	sFCU.sFlightControl.sBlender.s32LRF_Distance_mm = 0;
+
+	sFCU.sFlightControl.sBlender.u32ISR_Ticks = 0U;
+	sFCU.sFlightControl.sBlender.u32PredictTicks = 0U;
+	sFCU.sFlightControl.sBlender.sFilter.u32RejectCount = 0U;
+
+	//init flight conditions
+	vFCU_FCTL_BLENDER__Reset();
+}
+
+/***************************************************************************//**
+ * @brief
+ * Reset the filter to the pod sitting still at the start of the run
+ *
+ * @st_funcMD5		5FF5962FB70727FDD7683FD7FAB77D37
+ * @st_funcID		LCCM655R0.FILE.092.FUNC.015
+ */
+void vFCU_FCTL_BLENDER__Reset(void)
+{
+	Luint8 u8Counter;
+
+	//we know where we are and that we are stopped
+	sFCU.sFlightControl.sBlender.sFilter.f32Displacement_mm = 0.0F;
+	sFCU.sFlightControl.sBlender.sFilter.f32Veloc_mm_s = 0.0F;
+	sFCU.sFlightControl.sBlender.sFilter.f32Accel_mm_ss = 0.0F;
+
+	//small start uncertainty, 10mm and 10mm/s
+	sFCU.sFlightControl.sBlender.sFilter.f32P00 = 100.0F;
+	sFCU.sFlightControl.sBlender.sFilter.f32P01 = 0.0F;
+	sFCU.sFlightControl.sBlender.sFilter.f32P11 = 100.0F;
+
+	//dump anything waiting
+	for(u8Counter = 0U; u8Counter < (Luint8)BLENDER_MEAS__NUM; u8Counter++)
+	{
+		sFCU.sFlightControl.sBlender.sMeas[u8Counter].f32Sum = 0.0F;
+		sFCU.sFlightControl.sBlender.sMeas[u8Counter].u8Count = 0U;
+		sFCU.sFlightControl.sBlender.sMeas[u8Counter].u8RejectRun = 0U;
+	}
+
+	//the contrast lasers find their offset again on the next stripe
+	for(u8Counter = 0U; u8Counter < (Luint8)LASER_CONT__MAX; u8Counter++)
+	{
+		sFCU.sFlightControl.sBlender.s32Contrast_Offset_mm[u8Counter] = 0;
+		sFCU.sFlightControl.sBlender.u8Contrast_Anchored[u8Counter] = 0U;
+	}
+
+	//don't predict over the time we were stopped
+	sFCU.sFlightControl.sBlender.u32PredictTicks = sFCU.sFlightControl.sBlender.u32ISR_Ticks;
+
 	sFCU.sFlightControl.sBlender.sWorking.s32Accel_mm_ss = 0;
 	sFCU.sFlightControl.sBlender.sWorking.s32Veloc_mm_s = 0;
-	sFCU.sFlightControl.sBlender.sWorking.s32Distance_mm = 0;
+	sFCU.sFlightControl.sBlender.sWorking.s32Displacement_mm = 0;
+	sFCU.sFlightControl.sBlender.sWorking.s32Distance_mm = sFCU.sFlightControl.sBlender.s32LRF_Target_mm;
 }
 
 
 /***************************************************************************//**
  * @brief
- * ToDo
- * 
- * @st_funcMD5		31AE84EF1368AB58CB3EB6C6317023B7
+ * Predict up to now and fuse anything that has been latched since the last call
+ *
+ * @st_funcMD5		EA0F024F3FA377EA0B13EDA8C6BCF99D
  * @st_funcID		LCCM655R0.FILE.092.FUNC.002
  */
 void vFCU_FCTL_BLENDER__Process(void)
 {
-	//todo
-	//determine from the track database what sensors we need
-	//add in any geometry offsets
-	//check things like laser range as its not a displacement from the start of the track
+	Luint32 u32Ticks;
+	Luint32 u32Now;
+	Luint8 u8Counter;
+	Lfloat32 f32Temp;
+
+	//only the ISR writes the tick count, so one read is a safe snapshot
+	u32Now = sFCU.sFlightControl.sBlender.u32ISR_Ticks;
+	u32Ticks = u32Now - sFCU.sFlightControl.sBlender.u32PredictTicks;
+
+	if(u32Ticks > 0U)
+	{
+		//the first source with data is our input, else hold the last accel
+		for(u8Counter = (Luint8)BLENDER_MEAS__ACCEL_FROM_ACCEL; u8Counter <= (Luint8)BLENDER_MEAS__ACCEL_FROM_CONTRAST; u8Counter++)
+		{
+			if(sFCU.sFlightControl.sBlender.sMeas[u8Counter].u8Count > 0U)
+			{
+				f32Temp = sFCU.sFlightControl.sBlender.sMeas[u8Counter].f32Sum;
+				f32Temp /= (Lfloat32)sFCU.sFlightControl.sBlender.sMeas[u8Counter].u8Count;
+				sFCU.sFlightControl.sBlender.sFilter.f32Accel_mm_ss = f32Temp;
+				break;
+			}
+			else
+			{
+				//try the next source
+			}
+		}
+
+		//inputs are used up
+		for(u8Counter = (Luint8)BLENDER_MEAS__ACCEL_FROM_ACCEL; u8Counter <= (Luint8)BLENDER_MEAS__ACCEL_FROM_CONTRAST; u8Counter++)
+		{
+			sFCU.sFlightControl.sBlender.sMeas[u8Counter].f32Sum = 0.0F;
+			sFCU.sFlightControl.sBlender.sMeas[u8Counter].u8Count = 0U;
+		}
+
+		vFCU_FCTL_BLENDER__Predict(u32Ticks);
+		sFCU.sFlightControl.sBlender.u32PredictTicks = u32Now;
+	}
+	else
+	{
+		//no time has passed, keep collecting the accel
+	}
+
+	//the measurements are taken as being at the current time
+	for(u8Counter = (Luint8)BLENDER_MEAS__VELOC_FROM_ACCEL; u8Counter < (Luint8)BLENDER_MEAS__NUM; u8Counter++)
+	{
+		if(sFCU.sFlightControl.sBlender.sMeas[u8Counter].u8Count > 0U)
+		{
+			vFCU_FCTL_BLENDER__Update((TE_BLENDER_MEAS__TYPES)u8Counter);
+
+			sFCU.sFlightControl.sBlender.sMeas[u8Counter].f32Sum = 0.0F;
+			sFCU.sFlightControl.sBlender.sMeas[u8Counter].u8Count = 0U;
+		}
+		else
+		{
+			//nothing new from this source
+		}
+	}
+
 	//determine 3 current values, A, V, D
+	sFCU.sFlightControl.sBlender.sWorking.s32Accel_mm_ss = (Lint32)sFCU.sFlightControl.sBlender.sFilter.f32Accel_mm_ss;
+	sFCU.sFlightControl.sBlender.sWorking.s32Veloc_mm_s = (Lint32)sFCU.sFlightControl.sBlender.sFilter.f32Veloc_mm_s;
+	sFCU.sFlightControl.sBlender.sWorking.s32Displacement_mm = (Lint32)sFCU.sFlightControl.sBlender.sFilter.f32Displacement_mm;
+
+	//with a target we can give a distance remaining that does not wait on the next LRF packet
+	if(sFCU.sFlightControl.sBlender.s32LRF_Target_mm != 0)
+	{
+		sFCU.sFlightControl.sBlender.sWorking.s32Distance_mm = sFCU.sFlightControl.sBlender.s32LRF_Target_mm - sFCU.sFlightControl.sBlender.sWorking.s32Displacement_mm;
+	}
+	else
+	{
+		sFCU.sFlightControl.sBlender.sWorking.s32Distance_mm = sFCU.sFlightControl.sBlender.s32LRF_Distance_mm;
+	}
 
 }
 
+/***************************************************************************//**
+ * @brief
+ * Timebase for the predict step
+ *
+ * @st_funcMD5		9830D506AC787FE9D775367068B83ABF
+ * @st_funcID		LCCM655R0.FILE.092.FUNC.016
+ */
+void vFCU_FCTL_BLENDER__10MS_ISR(void)
+{
+	sFCU.sFlightControl.sBlender.u32ISR_Ticks++;
+}
+
+/***************************************************************************//**
+ * @brief
+ * Set the track position of the target the LRF is looking at.
+ *
+ * @param[in]		s32Target_mm		Position from the start of the run, 0 = LRF is distance only
+ * @st_funcMD5		7582F4744D9A16BF84175BA7EF7A7491
+ * @st_funcID		LCCM655R0.FILE.092.FUNC.017
+ */
+void vFCU_FCTL_BLENDER__Set_LRF_Target(Lint32 s32Target_mm)
+{
+	sFCU.sFlightControl.sBlender.s32LRF_Target_mm = s32Target_mm;
+}
+
+/***************************************************************************//**
+ * @brief
+ * Get the track position of the LRF target, 0 = not known
+ *
+ * @st_funcMD5		DFB54F0A8E67CD823D2F73E1601404E5
+ * @st_funcID		LCCM655R0.FILE.092.FUNC.018
+ */
+Lint32 s32FCU_FCTL_BLENDER__Get_LRF_Target_mm(void)
+{
+	return sFCU.sFlightControl.sBlender.s32LRF_Target_mm;
+}
+
 //return the current values
 /***************************************************************************//**
  * @brief
- * ToDo
- * 
+ * Get the blended accel
+ *
  * @st_funcMD5		04CC27AC99940E871624E78E33672C83
  * @st_funcID		LCCM655R0.FILE.092.FUNC.003
  */
@@ -59,8 +238,8 @@ Lint32 s32FCU_FCTL_BLENDER__Get_Accel_mmss(void)
 
 /***************************************************************************//**
  * @brief
- * ToDo
- * 
+ * Get the blended velocity
+ *
  * @st_funcMD5		7323B04512CB94BB9AE1D2F14756DE75
  * @st_funcID		LCCM655R0.FILE.092.FUNC.004
  */
@@ -71,12 +250,27 @@ Lint32 s32FCU_FCTL_BLENDER__Get_Veloc_mms(void)
 
 /***************************************************************************//**
  * @brief
- * ToDo
- * 
- * @st_funcMD5		EAA5F1CFCA6CE2E031FD233665A309D1
+ * Get the blended displacement from the start of the run
+ *
+ * @st_funcMD5		AAF39615A44A7BD2DFC00F1522FD1EB9
  * @st_funcID		LCCM655R0.FILE.092.FUNC.005
  */
 Lint32 s32FCU_FCTL_BLENDER__Get_Displacement_mm(void)
+{
+	return sFCU.sFlightControl.sBlender.sWorking.s32Displacement_mm;
+}
+
+/***************************************************************************//**
+ * @brief
+ * Get the distance to the LRF target
+ *
+ * @note
+ * If the target is not set this is the last raw LRF distance.
+ *
+ * @st_funcMD5		417421DD8D5A029D23E9E61AA2A5CB90
+ * @st_funcID		LCCM655R0.FILE.092.FUNC.019
+ */
+Lint32 s32FCU_FCTL_BLENDER__Get_Distance_mm(void)
 {
 	return sFCU.sFlightControl.sBlender.sWorking.s32Distance_mm;
 }
@@ -84,144 +278,316 @@ Lint32 s32FCU_FCTL_BLENDER__Get_Displacement_mm(void)
 //update the velocity from the accelometer subystems
 /***************************************************************************//**
  * @brief
- * ToDo
- * 
- * @param[in]		u32Veloc_mms		## Desc ##
- * @param[in]		u8Channel		## Desc ##
- * @st_funcMD5		59777C3CBA664752E7B836BBF31863CA
+ * Velocity integrated by the accel subsystem, weighted low as it drifts
+ *
+ * @param[in]		s32Veloc_mms		Velocity in mm/s
+ * @st_funcMD5		4FA06BC513C1AD91EE90F71BC05B55FF
  * @st_funcID		LCCM655R0.FILE.092.FUNC.006
  */
-void vFCU_FCTL_BLENDER__Veloc_UpdateFrom_Accel(Luint8 u8Channel, Luint32 u32Veloc_mms)
+void vFCU_FCTL_BLENDER__Veloc_UpdateFrom_Accel(Lint32 s32Veloc_mms)
 {
-
+	vFCU_FCTL_BLENDER__Latch(BLENDER_MEAS__VELOC_FROM_ACCEL, s32Veloc_mms);
 }
 
 //update the velocity from the LRF
 /***************************************************************************//**
  * @brief
- * ToDo
- * 
- * @param[in]		u32Veloc_mms		## Desc ##
- * @param[in]		u8Channel		## Desc ##
- * @st_funcMD5		1A965AB11BC3801E8CBD37BA6AF48288
+ * Closing velocity from the LRF
+ *
+ * @param[in]		s32Veloc_mms		Velocity in mm/s, positive towards the target
+ * @st_funcMD5		852CE347A28911F0EE6878F21FC3C34A
  * @st_funcID		LCCM655R0.FILE.092.FUNC.007
  */
-void vFCU_FCTL_BLENDER__Veloc_UpdateFrom_LRF(Luint8 u8Channel, Luint32 u32Veloc_mms)
+void vFCU_FCTL_BLENDER__Veloc_UpdateFrom_LRF(Lint32 s32Veloc_mms)
 {
-
+	vFCU_FCTL_BLENDER__Latch(BLENDER_MEAS__VELOC_FROM_LRF, s32Veloc_mms);
 }
 
 //Update the velocity from the contrast sensor system
 /***************************************************************************//**
  * @brief
- * ToDo
- * 
- * @param[in]		u32Veloc_mms		## Desc ##
- * @param[in]		u8Channel		## Desc ##
- * @st_funcMD5		DA62E13F32AAB193E5867676F9F40554
+ * Stripe to stripe velocity from the contrast sensors
+ *
+ * @param[in]		s32Veloc_mms		Velocity in mm/s
+ * @st_funcMD5		E8CC0EF12A3BAAAF3DE118EA7197AB2F
  * @st_funcID		LCCM655R0.FILE.092.FUNC.008
  */
-void vFCU_FCTL_BLENDER__Veloc_UpdateFrom_Contrast(Luint8 u8Channel, Luint32 u32Veloc_mms)
+void vFCU_FCTL_BLENDER__Veloc_UpdateFrom_Contrast(Lint32 s32Veloc_mms)
 {
-
+	vFCU_FCTL_BLENDER__Latch(BLENDER_MEAS__VELOC_FROM_CONTRAST, s32Veloc_mms);
 }
 
 
 //update the Acceleration from the accelometer subystems
 /***************************************************************************//**
  * @brief
- * ToDo
- * 
- * @param[in]		u32Accel_mmss		## Desc ##
- * @param[in]		u8Channel		## Desc ##
- * @st_funcMD5		D0DDA1FC5BC49388A1AFD578BAEBF3F1
+ * Accel from the accel subsystem, channels are averaged, this is the primary input
+ *
+ * @param[in]		s32Accel_mmss		Accel in mm/s/s
+ * @st_funcMD5		31764919BB6D7E62BB0D3DBC80DD70D0
  * @st_funcID		LCCM655R0.FILE.092.FUNC.009
  */
-void vFCU_FCTL_BLENDER__Accel_UpdateFrom_Accel(Luint8 u8Channel, Luint32 u32Accel_mmss)
+void vFCU_FCTL_BLENDER__Accel_UpdateFrom_Accel(Lint32 s32Accel_mmss)
 {
-
+	vFCU_FCTL_BLENDER__Latch(BLENDER_MEAS__ACCEL_FROM_ACCEL, s32Accel_mmss);
 }
 
 //update the Acceleration from the LRF
 /***************************************************************************//**
  * @brief
- * ToDo
- * 
- * @param[in]		u32Accel_mmss		## Desc ##
- * @param[in]		u8Channel		## Desc ##
- * @st_funcMD5		655026A0D75A99EE8E7EBE3FDBFEFEE3
+ * Accel from the LRF, only used if there is no accel subsystem data
+ *
+ * @param[in]		s32Accel_mmss		Accel in mm/s/s
+ * @st_funcMD5		AA6A67D6C869725770B5B6EF7674C581
  * @st_funcID		LCCM655R0.FILE.092.FUNC.010
  */
-void vFCU_FCTL_BLENDER__Accel_UpdateFrom_LRF(Luint8 u8Channel, Luint32 u32Accel_mmss)
+void vFCU_FCTL_BLENDER__Accel_UpdateFrom_LRF(Lint32 s32Accel_mmss)
 {
-
+	vFCU_FCTL_BLENDER__Latch(BLENDER_MEAS__ACCEL_FROM_LRF, s32Accel_mmss);
 }
 
 //Update the Acceleration from the contrast sensor system
 /***************************************************************************//**
  * @brief
- * ToDo
- * 
- * @param[in]		u32Accel_mmss		## Desc ##
- * @param[in]		u8Channel		## Desc ##
- * @st_funcMD5		B584AA4C4391361450C62BFDE003C99A
+ * Accel from the contrast sensors, only used if there is no other accel data
+ *
+ * @param[in]		s32Accel_mmss		Accel in mm/s/s
+ * @st_funcMD5		EBA7E5FE6D96FDCC04604F77AFEC5ADA
  * @st_funcID		LCCM655R0.FILE.092.FUNC.011
  */
-void vFCU_FCTL_BLENDER__Accel_UpdateFrom_Contrast(Luint8 u8Channel, Luint32 u32Accel_mmss)
+void vFCU_FCTL_BLENDER__Accel_UpdateFrom_Contrast(Lint32 s32Accel_mmss)
 {
-
+	vFCU_FCTL_BLENDER__Latch(BLENDER_MEAS__ACCEL_FROM_CONTRAST, s32Accel_mmss);
 }
 
 
 //update the Displacement from the accelometer subystems
 /***************************************************************************//**
  * @brief
- * ToDo
- * 
- * @param[in]		u32Disp_mm		## Desc ##
- * @param[in]		u8Channel		## Desc ##
- * @st_funcMD5		129388323E9D8D7D2541218E26D05374
+ * Displacement integrated by the accel subsystem, weighted low as it drifts
+ *
+ * @param[in]		s32Disp_mm		Displacement in mm
+ * @st_funcMD5		3B0F71103FC2F1FF95A43F4EC93B9BAF
  * @st_funcID		LCCM655R0.FILE.092.FUNC.012
  */
-void vFCU_FCTL_BLENDER__Displacement_UpdateFrom_Accel(Luint8 u8Channel, Luint32 u32Disp_mm)
+void vFCU_FCTL_BLENDER__Displacement_UpdateFrom_Accel(Lint32 s32Disp_mm)
 {
-
+	vFCU_FCTL_BLENDER__Latch(BLENDER_MEAS__DISP_FROM_ACCEL, s32Disp_mm);
 }
 
 //update the Displacement from the LRF
 //Note: LRF may be distance remaining, need to blend properly
 /***************************************************************************//**
  * @brief
- * ToDo
- * 
- * @param[in]		u32Disp_mm		## Desc ##
- * @param[in]		u8Channel		## Desc ##
- * @st_funcMD5		C1359FA82075785458C825BDCA155672
+ * Distance to the target from the LRF
+ *
+ * @note
+ * The LRF gives distance remaining so it can only be blended once the target
+ * position is known, until then it is just passed out as the distance.
+ *
+ * @param[in]		s32Disp_mm		Distance to the target in mm
+ * @st_funcMD5		2E58AA136DE33DC33CB635EA47D9B4F2
  * @st_funcID		LCCM655R0.FILE.092.FUNC.013
  */
-void vFCU_FCTL_BLENDER__Displacement_UpdateFrom_LRF(Luint8 u8Channel, Luint32 u32Disp_mm)
+void vFCU_FCTL_BLENDER__Displacement_UpdateFrom_LRF(Lint32 s32Disp_mm)
 {
-
+	sFCU.sFlightControl.sBlender.s32LRF_Distance_mm = s32Disp_mm;
+
+	if(sFCU.sFlightControl.sBlender.s32LRF_Target_mm != 0)
+	{
+		vFCU_FCTL_BLENDER__Latch(BLENDER_MEAS__DISP_FROM_LRF, sFCU.sFlightControl.sBlender.s32LRF_Target_mm - s32Disp_mm);
+	}
+	else
+	{
+		//can't convert to a track position yet
+	}
 }
 
 //Update the Displacement from the contrast sensor system
 //Note this may be track elapsed position
 /***************************************************************************//**
  * @brief
- * ToDo
- * 
- * @param[in]		u32Disp_mm		## Desc ##
- * @param[in]		u8Channel		## Desc ##
- * @st_funcMD5		EF8AE94096E136C3DE982D043F64045C
+ * Track elapsed position from the contrast sensor stripes
+ *
+ * @note
+ * Each laser sits at a different point on the pod and we don't know where the
+ * first stripe is, so the first stripe on each laser only sets that laser's
+ * offset to the track position, the stripes after it are blended.
+ *
+ * @param[in]		s32Disp_mm		Displacement in mm
+ * @param[in]		u8Channel		The contrast laser, E_FCU__LASER_CONT_INDEX_T
+ * @st_funcMD5		2253A2080B06DB60180A64E1EC227FD3
  * @st_funcID		LCCM655R0.FILE.092.FUNC.014
  */
-void vFCU_FCTL_BLENDER__Displacement_UpdateFrom_Contrast(Luint8 u8Channel, Luint32 u32Disp_mm)
+void vFCU_FCTL_BLENDER__Displacement_UpdateFrom_Contrast(Luint8 u8Channel, Lint32 s32Disp_mm)
 {
+	if(u8Channel < (Luint8)LASER_CONT__MAX)
+	{
+		if(sFCU.sFlightControl.sBlender.u8Contrast_Anchored[u8Channel] == 1U)
+		{
+			vFCU_FCTL_BLENDER__Latch(BLENDER_MEAS__DISP_FROM_CONTRAST, s32Disp_mm + sFCU.sFlightControl.sBlender.s32Contrast_Offset_mm[u8Channel]);
+		}
+		else
+		{
+			//first stripe for this laser, we don't know where the stripes start so
+			//take our position from the filter and measure from here on
+			sFCU.sFlightControl.sBlender.s32Contrast_Offset_mm[u8Channel] = (Lint32)sFCU.sFlightControl.sBlender.sFilter.f32Displacement_mm - s32Disp_mm;
+			sFCU.sFlightControl.sBlender.u8Contrast_Anchored[u8Channel] = 1U;
+		}
+	}
+	else
+	{
+		//not a contrast laser
+	}
+}
 
+/***************************************************************************//**
+ * @brief
+ * Add a value to a measurement slot, multiple channels are averaged
+ *
+ * @param[in]		s32Value		The value
+ * @param[in]		eMeas			The slot
+ * @st_funcMD5		2D9D90BF5B69F31B36041CBE38293FFF
+ * @st_funcID		LCCM655R0.FILE.092.FUNC.020
+ */
+static void vFCU_FCTL_BLENDER__Latch(TE_BLENDER_MEAS__TYPES eMeas, Lint32 s32Value)
+{
+	//if process has stalled just keep the average we have
+	if(sFCU.sFlightControl.sBlender.sMeas[eMeas].u8Count < 0xFFU)
+	{
+		sFCU.sFlightControl.sBlender.sMeas[eMeas].f32Sum += (Lfloat32)s32Value;
+		sFCU.sFlightControl.sBlender.sMeas[eMeas].u8Count++;
+	}
+	else
+	{
+		//full
+	}
+}
+
+/***************************************************************************//**
+ * @brief
+ * Move the state forward with constant accel
+ *
+ * @param[in]		u32Ticks		Number of 10ms ticks since the last predict
+ * @st_funcMD5		DDE953781093657DD4DB44E053D27226
+ * @st_funcID		LCCM655R0.FILE.092.FUNC.021
+ */
+static void vFCU_FCTL_BLENDER__Predict(Luint32 u32Ticks)
+{
+	Lfloat32 f32DT;
+	Lfloat32 f32DT2;
+	Lfloat32 f32Q;
+	Lfloat32 f32P01;
+	Lfloat32 f32P11;
+
+	if(u32Ticks > C_FCU__BLENDER__MAX_PREDICT_TICKS)
+	{
+		u32Ticks = C_FCU__BLENDER__MAX_PREDICT_TICKS;
+	}
+	else
+	{
+		//fall on
+	}
+
+	f32DT = (Lfloat32)u32Ticks * 0.01F;
+	f32DT2 = f32DT * f32DT;
+
+	//x = F.x + B.a
+	sFCU.sFlightControl.sBlender.sFilter.f32Displacement_mm += (sFCU.sFlightControl.sBlender.sFilter.f32Veloc_mm_s * f32DT) + (0.5F * sFCU.sFlightControl.sBlender.sFilter.f32Accel_mm_ss * f32DT2);
+	sFCU.sFlightControl.sBlender.sFilter.f32Veloc_mm_s += sFCU.sFlightControl.sBlender.sFilter.f32Accel_mm_ss * f32DT;
+
+	//P = F.P.F' + Q, Q from the accel noise
+	f32Q = C_FCU__BLENDER__ACCEL_NOISE_MM_SS * C_FCU__BLENDER__ACCEL_NOISE_MM_SS;
+	f32P01 = sFCU.sFlightControl.sBlender.sFilter.f32P01;
+	f32P11 = sFCU.sFlightControl.sBlender.sFilter.f32P11;
+
+	sFCU.sFlightControl.sBlender.sFilter.f32P00 += (2.0F * f32DT * f32P01) + (f32DT2 * f32P11) + (0.25F * f32Q * f32DT2 * f32DT2);
+	sFCU.sFlightControl.sBlender.sFilter.f32P01 += (f32DT * f32P11) + (0.5F * f32Q * f32DT2 * f32DT);
+	sFCU.sFlightControl.sBlender.sFilter.f32P11 += f32Q * f32DT2;
+}
+
+/***************************************************************************//**
+ * @brief
+ * Scalar Kalman update from one measurement slot
+ *
+ * @param[in]		eMeas			The slot, must be a veloc or disp slot
+ * @st_funcMD5		7FDF5A627398024393C1FE8421D2E76E
+ * @st_funcID		LCCM655R0.FILE.092.FUNC.022
+ */
+static void vFCU_FCTL_BLENDER__Update(TE_BLENDER_MEAS__TYPES eMeas)
+{
+	Lfloat32 f32Z;
+	Lfloat32 f32Y;
+	Lfloat32 f32S;
+	Lfloat32 f32K0;
+	Lfloat32 f32K1;
+	Lfloat32 f32P00;
+	Lfloat32 f32P01;
+	Lfloat32 f32P11;
+	Lfloat32 f32Gate;
+	Luint8 u8IsVeloc;
+
+	f32Z = sFCU.sFlightControl.sBlender.sMeas[eMeas].f32Sum / (Lfloat32)sFCU.sFlightControl.sBlender.sMeas[eMeas].u8Count;
+
+	f32P00 = sFCU.sFlightControl.sBlender.sFilter.f32P00;
+	f32P01 = sFCU.sFlightControl.sBlender.sFilter.f32P01;
+	f32P11 = sFCU.sFlightControl.sBlender.sFilter.f32P11;
+
+	if(eMeas <= BLENDER_MEAS__VELOC_FROM_CONTRAST)
+	{
+		//H = [0 1]
+		u8IsVeloc = 1U;
+		f32Y = f32Z - sFCU.sFlightControl.sBlender.sFilter.f32Veloc_mm_s;
+		f32S = f32P11 + f32BlenderR[eMeas];
+		f32K0 = f32P01 / f32S;
+		f32K1 = f32P11 / f32S;
+	}
+	else
+	{
+		//H = [1 0]
+		u8IsVeloc = 0U;
+		f32Y = f32Z - sFCU.sFlightControl.sBlender.sFilter.f32Displacement_mm;
+		f32S = f32P00 + f32BlenderR[eMeas];
+		f32K0 = f32P00 / f32S;
+		f32K1 = f32P01 / f32S;
+	}
+
+	//innovation gate, y^2 > g^2.S is an outlier
+	f32Gate = C_FCU__BLENDER__GATE_SIGMA * C_FCU__BLENDER__GATE_SIGMA * f32S;
+	if(((f32Y * f32Y) > f32Gate) && (sFCU.sFlightControl.sBlender.sMeas[eMeas].u8RejectRun < C_FCU__BLENDER__MAX_REJECTS))
+	{
+		sFCU.sFlightControl.sBlender.sMeas[eMeas].u8RejectRun++;
+		sFCU.sFlightControl.sBlender.sFilter.u32RejectCount++;
+	}
+	else
+	{
+		sFCU.sFlightControl.sBlender.sMeas[eMeas].u8RejectRun = 0U;
+
+		//x = x + K.y
+		sFCU.sFlightControl.sBlender.sFilter.f32Displacement_mm += f32K0 * f32Y;
+		sFCU.sFlightControl.sBlender.sFilter.f32Veloc_mm_s += f32K1 * f32Y;
+
+		//P = (I - K.H).P
+		if(u8IsVeloc == 1U)
+		{
+			sFCU.sFlightControl.sBlender.sFilter.f32P00 = f32P00 - (f32K0 * f32P01);
+			sFCU.sFlightControl.sBlender.sFilter.f32P01 = f32P01 - (f32K0 * f32P11);
+			sFCU.sFlightControl.sBlender.sFilter.f32P11 = f32P11 - (f32K1 * f32P11);
+		}
+		else
+		{
+			sFCU.sFlightControl.sBlender.sFilter.f32P00 = f32P00 - (f32K0 * f32P00);
+			sFCU.sFlightControl.sBlender.sFilter.f32P01 = f32P01 - (f32K0 * f32P01);
+			sFCU.sFlightControl.sBlender.sFilter.f32P11 = f32P11 - (f32K1 * f32P01);
+		}
+	}
 }
 
 
-#endif //0
+#endif //C_LOCALDEF__LCCM655__ENABLE_FCTL_BLENDER
+#ifndef C_LOCALDEF__LCCM655__ENABLE_FCTL_BLENDER
+	#error
+#endif
 #endif //C_LOCALDEF__LCCM655__ENABLE_FLIGHT_CONTROL
 #ifndef C_LOCALDEF__LCCM655__ENABLE_FLIGHT_CONTROL
 	#error
@@ -233,4 +599,3 @@ void vFCU_FCTL_BLENDER__Displacement_UpdateFrom_Contrast(Luint8 u8Channel, Luint
 	#error
 #endif
 
-
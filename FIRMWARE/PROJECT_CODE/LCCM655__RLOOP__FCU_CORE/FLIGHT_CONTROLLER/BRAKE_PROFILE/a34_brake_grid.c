@@ -0,0 +1,108 @@
+//Generated by BRAKE_TABLES/A34/PROCESSING/brake_grid.py, do not edit
+//I-Beam gap in um for [velocity][drag force]
+//Velocity = 24576 + (row << 11) mm/s
+//Drag = (col << 4) N for col < 32, then 512 + ((col - 32) << 7) N
+#include "../../fcu_core.h"
+#if C_LOCALDEF__LCCM655__ENABLE_THIS_MODULE == 1U
+#if C_LOCALDEF__LCCM655__ENABLE_FLIGHT_CONTROL == 1U
+#if C_LOCALDEF__LCCM655__ENABLE_FCTL_BRAKE_CONTROL == 1U
+
+#if C_FCU__BRAKES__GRID_VELOC_MIN_MMS != 24576U
+	#error
+#endif
+#if C_FCU__BRAKES__GRID_VELOC_SHIFT != 11U
+	#error
+#endif
+#if C_FCU__BRAKES__GRID_NUM_VELOC != 68U
+	#error
+#endif
+#if C_FCU__BRAKES__GRID_FINE_SHIFT != 4U
+	#error
+#endif
+#if C_FCU__BRAKES__GRID_NUM_FINE != 32U
+	#error
+#endif
+#if C_FCU__BRAKES__GRID_DRAG_SHIFT != 7U
+	#error
+#endif
+#if C_FCU__BRAKES__GRID_NUM_DRAG != 108U
+	#error
+#endif
+
+#ifndef WIN32
+const Luint16 u16A34_BrakeGrid[] = {
+#else
+Luint16 u16A34_BrakeGrid[] = {
+#endif
+32000, 31989, 30958, 29959, 28993, 28058, 27154, 26278, 25431, 24611, 23817, 23049, 22306, 21586, 20890, 20217, 19565, 18934, 18323, 17733, 17161, 16607, 16072, 15904, 15794, 15685, 15576, 15469, 15362, 15255, 15150, 15045, 14941, 14133, 13370, 12647, 11964, 11317, 10706, 10127, 9580, 9062, 8572, 8109, 7806, 7557, 7316, 7083, 6857, 6639, 6427, 6222, 6023, 5831, 5645, 5465, 5291, 5122, 4959, 4801, 4648, 4500, 4356, 4217, 4083, 3952, 3826, 3703, 3585, 3470, 3359, 3252, 3147, 3047, 2949, 2855, 2763, 2675, 2589, 2506, 2426, 2349, 2273, 2201, 2130, 2062, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000,
+32000, 31967, 30920, 29908, 28929, 27982, 27065, 26179, 25322, 24493, 23691, 22916, 22166, 21440, 20738, 20059, 19402, 18767, 18153, 17559, 16984, 16428, 15977, 15864, 15753, 15642, 15532, 15423, 15315, 15207, 15101, 14994, 14889, 14073, 13301, 12572, 11882, 11231, 10615, 10033, 9483, 8963, 8471, 8007, 7745, 7495, 7252, 7018, 6791, 6571, 6359, 6153, 5954, 5761, 5575, 5395, 5220, 5051, 4888, 4730, 4577, 4429, 4286, 4147, 4013, 3883, 3757, 3635, 3518, 3404, 3293, 3187, 3083, 2983, 2887, 2793, 2703, 2615, 2530, 2448, 2369, 2292, 2218, 2146, 2077, 2009, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000,
+32000, 31945, 30883, 29857, 28865, 27905, 26978, 26082, 25215, 24377, 23567, 22784, 22027, 21295, 20587, 19903, 19241, 18602, 17984, 17386, 16808, 16250, 15938, 15825, 15712, 15600, 15489, 15378, 15268, 15160, 15052, 14944, 14838, 14012, 13233, 12497, 11802, 11145, 10525, 9940, 9387, 8865, 8371, 7945, 7684, 7432, 7189, 6953, 6725, 6504, 6291, 6085, 5885, 5692, 5505, 5325, 5150, 4981, 4818, 4660, 4507, 4359, 4216, 4078, 3944, 3815, 3690, 3569, 3452, 3338, 3229, 3123, 3021, 2921, 2826, 2733, 2643, 2557, 2473, 2392, 2313, 2237, 2164, 2093, 2024, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000,
+32000, 31923, 30847, 29807, 28801, 27830, 26892, 25985, 25108, 24262, 23443, 22653, 21889, 21151, 20437, 19748, 19082, 18439, 17817, 17216, 16635, 16074, 15900, 15785, 15671, 15557, 15445, 15333, 15222, 15112, 15003, 14894, 14786, 13952, 13165, 12422, 11721, 11060, 10436, 9847, 9292, 8767, 8273, 7886, 7624, 7371, 7126, 6889, 6660, 6438, 6224, 6017, 5817, 5624, 5437, 5256, 5081, 4912, 4749, 4591, 4438, 4291, 4148, 4010, 3877, 3748, 3624, 3503, 3387, 3275, 3166, 3061, 2959, 2861, 2766, 2674, 2585, 2499, 2416, 2336, 2259, 2184, 2111, 2041, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000,
+32000, 31903, 30811, 29757, 28739, 27755, 26806, 25888, 25003, 24147, 23321, 22523, 21752, 21008, 20289, 19595, 18924, 18277, 17651, 17047, 16464, 15979, 15862, 15745, 15630, 15515, 15401, 15288, 15176, 15065, 14954, 14844, 14735, 13892, 13097, 12348, 11642, 10975, 10347, 9755, 9197, 8671, 8175, 7828, 7564, 7309, 7063, 6825, 6595, 6373, 6158, 5950, 5750, 5556, 5369, 5188, 5013, 4844, 4681, 4523, 4370, 4223, 4081, 3943, 3811, 3683, 3559, 3439, 3324, 3212, 3104, 3000, 2899, 2802, 2707, 2616, 2528, 2443, 2361, 2282, 2205, 2131, 2059, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000,
+32000, 31883, 30776, 29708, 28677, 27682, 26721, 25793, 24898, 24034, 23200, 22394, 21617, 20867, 20142, 19443, 18768, 18117, 17488, 16881, 16295, 15942, 15824, 15706, 15589, 15473, 15358, 15244, 15130, 15018, 14906, 14795, 14685, 13833, 13030, 12274, 11562, 10892, 10260, 9665, 9104, 8576, 8078, 7771, 7505, 7249, 7001, 6762, 6531, 6308, 6092, 5884, 5683, 5489, 5302, 5120, 4946, 4777, 4613, 4456, 4304, 4157, 4015, 3878, 3746, 3619, 3496, 3377, 3262, 3151, 3044, 2940, 2840, 2743, 2650, 2560, 2473, 2389, 2308, 2229, 2153, 2080, 2009, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000,
+32000, 31864, 30742, 29660, 28616, 27609, 26637, 25699, 24794, 23922, 23079, 22267, 21483, 20727, 19997, 19293, 18614, 17959, 17327, 16717, 16128, 15906, 15786, 15667, 15549, 15431, 15315, 15199, 15085, 14971, 14858, 14746, 14634, 13774, 12964, 12201, 11484, 10809, 10173, 9575, 9012, 8482, 7990, 7713, 7446, 7189, 6940, 6700, 6468, 6244, 6028, 5819, 5618, 5423, 5235, 5054, 4879, 4710, 4547, 4390, 4238, 4091, 3950, 3814, 3682, 3556, 3433, 3315, 3201, 3091, 2984, 2882, 2782, 2687, 2594, 2505, 2419, 2335, 2255, 2177, 2102, 2030, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000,
+32000, 31845, 30709, 29613, 28556, 27536, 26554, 25606, 24692, 23811, 22961, 22141, 21351, 20589, 19854, 19145, 18462, 17803, 17168, 16555, 15992, 15870, 15749, 15628, 15508, 15390, 15272, 15155, 15039, 14924, 14810, 14697, 14584, 13715, 12898, 12129, 11406, 10726, 10087, 9486, 8920, 8389, 7935, 7657, 7388, 7129, 6879, 6638, 6405, 6180, 5964, 5754, 5553, 5358, 5170, 4989, 4814, 4645, 4482, 4325, 4173, 4027, 3886, 3751, 3620, 3494, 3372, 3255, 3142, 3032, 2927, 2825, 2726, 2631, 2540, 2451, 2366, 2283, 2204, 2127, 2053, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000,
+32000, 31828, 30676, 29566, 28496, 27465, 26471, 25514, 24591, 23701, 22843, 22017, 21220, 20452, 19712, 18999, 18312, 17649, 17011, 16395, 15958, 15834, 15711, 15590, 15469, 15349, 15230, 15111, 14994, 14878, 14763, 14648, 14534, 13657, 12832, 12057, 11329, 10645, 10002, 9398, 8830, 8297, 7881, 7601, 7331, 7070, 6819, 6577, 6343, 6118, 5900, 5691, 5489, 5294, 5106, 4924, 4749, 4580, 4418, 4261, 4109, 3964, 3824, 3689, 3559, 3434, 3313, 3196, 3083, 2975, 2870, 2769, 2671, 2577, 2486, 2399, 2314, 2232, 2154, 2078, 2005, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000,
+32000, 31810, 30644, 29520, 28438, 27395, 26390, 25423, 24491, 23593, 22727, 21894, 21091, 20318, 19573, 18855, 18164, 17498, 16856, 16238, 15924, 15799, 15674, 15551, 15429, 15308, 15187, 15068, 14950, 14832, 14716, 14600, 14485, 13599, 12767, 11986, 11253, 10564, 9918, 9311, 8741, 8207, 7827, 7545, 7274, 7012, 6760, 6517, 6282, 6056, 5838, 5628, 5426, 5230, 5042, 4861, 4686, 4517, 4355, 4198, 4047, 3902, 3763, 3629, 3499, 3375, 3254, 3138, 3026, 2919, 2814, 2714, 2617, 2524, 2434, 2347, 2264, 2183, 2105, 2030, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000,
+32000, 31794, 30613, 29475, 28380, 27326, 26311, 25333, 24392, 23486, 22613, 21773, 20964, 20185, 19435, 18713, 18018, 17348, 16704, 16083, 15890, 15763, 15638, 15513, 15390, 15267, 15146, 15025, 14905, 14787, 14669, 14552, 14436, 13542, 12703, 11915, 11177, 10484, 9835, 9225, 8654, 8118, 7774, 7491, 7218, 6955, 6701, 6457, 6222, 5995, 5777, 5566, 5363, 5168, 4980, 4798, 4623, 4455, 4292, 4136, 3986, 3842, 3703, 3570, 3441, 3317, 3197, 3082, 2971, 2864, 2760, 2661, 2565, 2472, 2383, 2297, 2214, 2134, 2058, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000,
+32000, 31778, 30582, 29431, 28324, 27258, 26232, 25245, 24295, 23380, 22500, 21653, 20838, 20054, 19299, 18573, 17874, 17201, 16554, 15985, 15856, 15729, 15602, 15476, 15351, 15227, 15104, 14982, 14861, 14742, 14623, 14505, 14388, 13485, 12639, 11846, 11102, 10406, 9753, 9141, 8567, 8030, 7721, 7437, 7162, 6898, 6644, 6398, 6162, 5935, 5716, 5505, 5302, 5106, 4918, 4737, 4562, 4394, 4231, 4075, 3926, 3783, 3645, 3512, 3384, 3260, 3141, 3027, 2916, 2810, 2707, 2609, 2514, 2422, 2333, 2248, 2166, 2087, 2011, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000,
+32000, 31764, 30553, 29388, 28268, 27191, 26154, 25158, 24199, 23276, 22389, 21536, 20715, 19925, 19166, 18435, 17733, 17057, 16407, 15954, 15823, 15694, 15566, 15439, 15312, 15187, 15063, 14940, 14818, 14697, 14577, 14458, 14340, 13429, 12576, 11777, 11029, 10328, 9672, 9058, 8482, 7967, 7670, 7383, 7107, 6842, 6586, 6341, 6104, 5876, 5656, 5445, 5242, 5046, 4858, 4676, 4502, 4333, 4172, 4016, 3867, 3725, 3587, 3455, 3328, 3205, 3087, 2973, 2863, 2757, 2656, 2558, 2463, 2373, 2285, 2201, 2120, 2041, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000,
+32000, 31749, 30524, 29346, 28214, 27125, 26078, 25072, 24104, 23174, 22280, 21420, 20593, 19799, 19035, 18300, 17594, 16915, 16262, 15922, 15790, 15660, 15530, 15402, 15274, 15148, 15023, 14898, 14775, 14653, 14532, 14411, 14292, 13373, 12513, 11709, 10956, 10251, 9592, 8975, 8398, 7918, 7618, 7330, 7053, 6787, 6530, 6283, 6046, 5817, 5598, 5386, 5182, 4987, 4798, 4617, 4442, 4274, 4113, 3958, 3810, 3668, 3531, 3400, 3273, 3151, 3033, 2920, 2811, 2706, 2605, 2508, 2415, 2324, 2238, 2154, 2074, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000,
+32000, 31736, 30496, 29305, 28160, 27060, 26003, 24987, 24011, 23073, 22172, 21306, 20474, 19674, 18905, 18167, 17457, 16775, 16120, 15891, 15758, 15626, 15495, 15365, 15237, 15109, 14983, 14857, 14733, 14609, 14487, 14366, 14245, 13318, 12452, 11642, 10884, 10176, 9514, 8895, 8316, 7869, 7568, 7278, 7000, 6732, 6475, 6227, 5989, 5760, 5540, 5328, 5124, 4928, 4740, 4558, 4384, 4216, 4055, 3902, 3754, 3613, 3477, 3345, 3219, 3098, 2981, 2869, 2760, 2656, 2556, 2460, 2367, 2278, 2192, 2109, 2029, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000,
+32000, 31723, 30469, 29265, 28108, 26997, 25929, 24904, 23920, 22974, 22066, 21194, 20356, 19551, 18779, 18036, 17323, 16638, 15996, 15860, 15726, 15593, 15460, 15329, 15199, 15071, 14943, 14816, 14691, 14566, 14443, 14320, 14199, 13264, 12391, 11575, 10813, 10101, 9436, 8815, 8235, 7821, 7518, 7227, 6947, 6679, 6420, 6172, 5933, 5704, 5483, 5271, 5067, 4871, 4682, 4501, 4327, 4160, 3999, 3846, 3700, 3559, 3423, 3292, 3167, 3046, 2930, 2818, 2711, 2607, 2508, 2412, 2320, 2232, 2147, 2065, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000,
+32000, 31711, 30443, 29225, 28056, 26934, 25857, 24823, 23830, 22877, 21962, 21084, 20241, 19431, 18654, 17908, 17192, 16504, 15967, 15830, 15694, 15560, 15426, 15294, 15163, 15033, 14904, 14776, 14649, 14524, 14399, 14276, 14153, 13211, 12331, 11510, 10743, 10028, 9360, 8737, 8155, 7773, 7469, 7177, 6896, 6626, 6367, 6117, 5878, 5648, 5427, 5215, 5011, 4815, 4626, 4445, 4271, 4104, 3944, 3792, 3646, 3506, 3370, 3241, 3116, 2996, 2880, 2769, 2662, 2560, 2461, 2366, 2275, 2187, 2103, 2022, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000,
+32000, 31700, 30417, 29187, 28006, 26873, 25786, 24743, 23742, 22782, 21860, 20976, 20127, 19313, 18532, 17782, 17063, 16373, 15938, 15800, 15663, 15527, 15392, 15259, 15126, 14995, 14865, 14736, 14608, 14482, 14356, 14231, 14108, 13158, 12272, 11445, 10675, 9956, 9286, 8660, 8077, 7726, 7420, 7127, 6845, 6574, 6314, 6064, 5824, 5594, 5372, 5160, 4955, 4759, 4571, 4390, 4216, 4049, 3891, 3739, 3594, 3454, 3319, 3190, 3066, 2946, 2831, 2721, 2615, 2513, 2415, 2321, 2231, 2144, 2060, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000,
+32000, 31689, 30393, 29150, 27957, 26814, 25717, 24665, 23656, 22688, 21760, 20870, 20016, 19197, 18412, 17659, 16936, 16244, 15910, 15771, 15632, 15495, 15359, 15224, 15091, 14958, 14827, 14697, 14568, 14440, 14313, 14188, 14063, 13106, 12214, 11382, 10607, 9885, 9212, 8585, 8000, 7680, 7373, 7078, 6795, 6523, 6262, 6011, 5771, 5540, 5318, 5105, 4901, 4705, 4517, 4336, 4163, 3996, 3839, 3688, 3543, 3403, 3269, 3140, 3017, 2898, 2784, 2674, 2569, 2468, 2371, 2277, 2188, 2102, 2019, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000,
+32000, 31679, 30369, 29113, 27909, 26755, 25649, 24588, 23571, 22596, 21662, 20766, 19907, 19084, 18295, 17538, 16813, 16117, 15883, 15742, 15602, 15464, 15326, 15190, 15056, 14922, 14790, 14658, 14528, 14399, 14272, 14145, 14019, 13055, 12156, 11320, 10541, 9815, 9140, 8511, 7957, 7635, 7326, 7030, 6745, 6473, 6211, 5960, 5719, 5487, 5265, 5052, 4848, 4652, 4464, 4283, 4110, 3945, 3788, 3637, 3493, 3354, 3220, 3092, 2969, 2851, 2738, 2629, 2524, 2424, 2327, 2235, 2146, 2060, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000,
+32000, 31670, 30346, 29078, 27862, 26698, 25582, 24513, 23488, 22506, 21565, 20664, 19800, 18973, 18180, 17420, 16692, 15999, 15855, 15713, 15572, 15432, 15294, 15157, 15021, 14886, 14753, 14620, 14489, 14359, 14230, 14103, 13976, 13004, 12100, 11258, 10475, 9747, 9069, 8438, 7914, 7590, 7280, 6982, 6697, 6423, 6161, 5909, 5667, 5436, 5214, 5000, 4796, 4600, 4412, 4232, 4059, 3895, 3738, 3588, 3444, 3305, 3172, 3045, 2923, 2805, 2692, 2584, 2480, 2381, 2285, 2193, 2105, 2020, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000,
+32000, 31661, 30324, 29043, 27817, 26642, 25517, 24439, 23407, 22418, 21471, 20564, 19696, 18864, 18067, 17304, 16573, 15973, 15828, 15685, 15543, 15402, 15262, 15124, 14987, 14851, 14716, 14583, 14451, 14320, 14190, 14061, 13934, 12955, 12044, 11198, 10411, 9680, 9000, 8367, 7871, 7546, 7235, 6936, 6649, 6375, 6112, 5859, 5617, 5385, 5163, 4950, 4745, 4549, 4361, 4181, 4008, 3846, 3689, 3540, 3396, 3258, 3126, 2999, 2877, 2760, 2648, 2541, 2438, 2339, 2244, 2153, 2065, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000,
+32000, 31653, 30303, 29010, 27772, 26587, 25453, 24367, 23327, 22332, 21379, 20467, 19594, 18758, 17957, 17191, 16458, 15948, 15802, 15657, 15514, 15372, 15231, 15091, 14953, 14816, 14680, 14546, 14413, 14281, 14150, 14020, 13892, 12906, 11990, 11139, 10348, 9614, 8931, 8298, 7830, 7503, 7190, 6890, 6603, 6327, 6063, 5810, 5568, 5336, 5113, 4900, 4695, 4499, 4312, 4132, 3960, 3798, 3642, 3493, 3349, 3212, 3080, 2954, 2833, 2717, 2605, 2499, 2396, 2298, 2204, 2113, 2027, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000,
+32000, 31646, 30282, 28977, 27728, 26534, 25390, 24296, 23249, 22247, 21289, 20371, 19493, 18653, 17850, 17081, 16344, 15923, 15776, 15630, 15485, 15342, 15200, 15059, 14920, 14782, 14645, 14510, 14375, 14242, 14111, 13980, 13851, 12858, 11936, 11081, 10286, 9549, 8865, 8229, 7789, 7461, 7147, 6845, 6557, 6281, 6016, 5762, 5520, 5287, 5064, 4851, 4646, 4451, 4263, 4083, 3913, 3751, 3596, 3447, 3304, 3167, 3036, 2910, 2790, 2674, 2564, 2457, 2356, 2258, 2165, 2075, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000,
+32000, 31639, 30262, 28945, 27686, 26481, 25329, 24227, 23173, 22165, 21200, 20278, 19396, 18552, 17745, 16973, 16234, 15899, 15751, 15603, 15457, 15313, 15170, 15028, 14888, 14749, 14611, 14474, 14339, 14205, 14072, 13941, 13810, 12811, 11884, 11024, 10226, 9486, 8799, 8163, 7749, 7420, 7104, 6801, 6512, 6235, 5970, 5716, 5472, 5239, 5016, 4803, 4599, 4403, 4216, 4036, 3867, 3705, 3550, 3402, 3260, 3123, 2993, 2868, 2748, 2633, 2523, 2417, 2316, 2219, 2127, 2038, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000,
+32000, 31632, 30243, 28915, 27645, 26430, 25270, 24160, 23099, 22084, 21114, 20187, 19300, 18452, 17642, 16867, 16126, 15875, 15725, 15577, 15430, 15284, 15140, 14997, 14856, 14716, 14577, 14439, 14303, 14168, 14034, 13902, 13771, 12765, 11832, 10968, 10167, 9424, 8735, 8097, 7710, 7379, 7062, 6758, 6468, 6190, 5924, 5670, 5426, 5193, 4970, 4756, 4552, 4356, 4169, 3990, 3822, 3661, 3506, 3358, 3216, 3081, 2950, 2826, 2707, 2592, 2483, 2378, 2278, 2182, 2090, 2001, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000,
+32000, 31626, 30225, 28885, 27604, 26381, 25211, 24094, 23026, 22005, 21030, 20098, 19207, 18355, 17542, 16764, 16021, 15852, 15701, 15551, 15403, 15256, 15111, 14967, 14825, 14683, 14543, 14405, 14268, 14132, 13997, 13864, 13732, 12719, 11782, 10913, 10108, 9363, 8673, 8033, 7672, 7339, 7021, 6716, 6425, 6146, 5880, 5625, 5381, 5147, 4924, 4711, 4506, 4311, 4124, 3946, 3778, 3617, 3463, 3315, 3174, 3039, 2909, 2785, 2667, 2553, 2444, 2340, 2240, 2145, 2054, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000,
+32000, 31621, 30207, 28856, 27565, 26332, 25155, 24030, 22955, 21928, 20947, 20010, 19116, 18261, 17444, 16664, 15983, 15829, 15677, 15526, 15377, 15229, 15083, 14937, 14794, 14652, 14511, 14371, 14233, 14096, 13961, 13826, 13693, 12675, 11732, 10859, 10051, 9304, 8612, 7983, 7634, 7300, 6980, 6675, 6383, 6103, 5836, 5581, 5336, 5103, 4880, 4666, 4462, 4267, 4080, 3903, 3735, 3575, 3421, 3274, 3133, 2998, 2869, 2746, 2628, 2515, 2407, 2303, 2204, 2109, 2019, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000,
+32000, 31616, 30190, 28828, 27527, 26285, 25099, 23967, 22885, 21853, 20867, 19925, 19026, 18168, 17348, 16566, 15961, 15807, 15653, 15501, 15351, 15202, 15054, 14908, 14764, 14620, 14479, 14338, 14199, 14061, 13925, 13790, 13656, 12631, 11683, 10807, 9996, 9246, 8552, 7948, 7597, 7261, 6941, 6634, 6341, 6061, 5794, 5538, 5293, 5059, 4836, 4622, 4418, 4223, 4037, 3861, 3693, 3533, 3380, 3233, 3093, 2959, 2830, 2707, 2590, 2478, 2370, 2267, 2169, 2075, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000,
+32000, 31611, 30173, 28800, 27490, 26239, 25045, 23905, 22818, 21779, 20788, 19842, 18940, 18078, 17255, 16470, 15941, 15785, 15630, 15477, 15326, 15176, 15027, 14880, 14734, 14590, 14447, 14306, 14166, 14027, 13890, 13754, 13619, 12588, 11636, 10755, 9941, 9189, 8494, 7913, 7561, 7224, 6902, 6595, 6301, 6020, 5752, 5496, 5251, 5017, 4793, 4580, 4376, 4181, 3995, 3820, 3653, 3493, 3340, 3194, 3054, 2920, 2792, 2670, 2553, 2441, 2334, 2232, 2135, 2041, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000,
+32000, 31607, 30157, 28773, 27453, 26194, 24992, 23845, 22751, 21707, 20712, 19761, 18855, 17990, 17164, 16377, 15920, 15763, 15607, 15453, 15301, 15150, 15000, 14852, 14705, 14560, 14416, 14274, 14133, 13994, 13855, 13719, 13583, 12547, 11589, 10705, 9888, 9133, 8436, 7879, 7525, 7187, 6864, 6556, 6261, 5980, 5711, 5455, 5209, 4975, 4752, 4538, 4334, 4140, 3954, 3780, 3613, 3453, 3301, 3155, 3016, 2883, 2755, 2634, 2517, 2406, 2300, 2198, 2101, 2008, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000,
+32000, 31603, 30141, 28747, 27418, 26150, 24940, 23787, 22687, 21637, 20637, 19682, 18772, 17904, 17076, 16286, 15900, 15742, 15585, 15430, 15276, 15124, 14974, 14825, 14677, 14531, 14386, 14243, 14101, 13961, 13822, 13684, 13548, 12506, 11544, 10656, 9836, 9079, 8381, 7846, 7491, 7151, 6827, 6518, 6222, 5941, 5671, 5414, 5169, 4935, 4711, 4498, 4294, 4099, 3915, 3741, 3574, 3415, 3263, 3118, 2979, 2846, 2719, 2598, 2482, 2372, 2266, 2165, 2069, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000,
+32000, 31599, 30126, 28722, 27383, 26107, 24890, 23730, 22623, 21569, 20563, 19605, 18691, 17820, 16989, 16197, 15880, 15721, 15563, 15407, 15252, 15099, 14948, 14798, 14649, 14502, 14357, 14212, 14070, 13929, 13789, 13650, 13513, 12465, 11499, 10607, 9785, 9026, 8326, 7813, 7457, 7116, 6791, 6481, 6185, 5902, 5632, 5375, 5130, 4895, 4672, 4458, 4255, 4060, 3877, 3703, 3536, 3378, 3226, 3081, 2943, 2810, 2684, 2564, 2448, 2338, 2233, 2133, 2037, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000,
+32000, 31596, 30112, 28697, 27349, 26065, 24840, 23674, 22562, 21502, 20492, 19529, 18612, 17738, 16905, 16111, 15861, 15701, 15542, 15385, 15229, 15075, 14922, 14771, 14622, 14474, 14327, 14183, 14039, 13897, 13756, 13617, 13479, 12426, 11455, 10560, 9735, 8974, 8273, 7782, 7423, 7081, 6755, 6444, 6148, 5865, 5595, 5337, 5091, 4857, 4633, 4420, 4216, 4022, 3840, 3666, 3500, 3341, 3190, 3045, 2907, 2776, 2650, 2530, 2415, 2306, 2202, 2102, 2007, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000,
+32000, 31592, 30097, 28673, 27316, 26023, 24792, 23619, 22501, 21436, 20422, 19456, 18535, 17658, 16822, 16026, 15842, 15681, 15521, 15363, 15206, 15051, 14897, 14746, 14595, 14446, 14299, 14153, 14009, 13866, 13725, 13585, 13446, 12388, 11413, 10514, 9686, 8924, 8221, 7750, 7391, 7048, 6721, 6409, 6111, 5828, 5557, 5300, 5054, 4819, 4595, 4382, 4179, 3985, 3803, 3630, 3464, 3306, 3155, 3011, 2873, 2742, 2617, 2497, 2383, 2274, 2171, 2072, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000,
+32000, 31589, 30083, 28649, 27284, 25983, 24745, 23565, 22442, 21372, 20354, 19383, 18459, 17580, 16742, 15988, 15824, 15661, 15500, 15341, 15183, 15027, 14873, 14720, 14569, 14419, 14271, 14125, 13979, 13836, 13694, 13553, 13414, 12350, 11371, 10469, 9639, 8875, 8171, 7720, 7359, 7015, 6687, 6374, 6076, 5792, 5521, 5263, 5017, 4782, 4559, 4346, 4142, 3949, 3768, 3594, 3429, 3271, 3121, 2977, 2840, 2709, 2585, 2466, 2352, 2244, 2141, 2042, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000,
+32000, 31585, 30069, 28626, 27252, 25944, 24698, 23513, 22384, 21310, 20287, 19313, 18386, 17503, 16663, 15971, 15806, 15642, 15480, 15320, 15161, 15004, 14849, 14695, 14543, 14393, 14244, 14096, 13951, 13806, 13663, 13522, 13382, 12313, 11330, 10425, 9592, 8826, 8121, 7690, 7328, 6983, 6654, 6340, 6042, 5757, 5486, 5227, 4981, 4746, 4523, 4310, 4107, 3915, 3733, 3560, 3395, 3237, 3087, 2944, 2808, 2677, 2553, 2435, 2322, 2214, 2111, 2013, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000,
+32000, 31582, 30056, 28603, 27220, 25905, 24653, 23461, 22327, 21248, 20221, 19244, 18314, 17428, 16586, 15954, 15788, 15623, 15460, 15299, 15140, 14982, 14826, 14671, 14518, 14367, 14217, 14069, 13922, 13777, 13633, 13491, 13351, 12277, 11290, 10382, 9547, 8779, 8073, 7661, 7297, 6951, 6621, 6307, 6008, 5723, 5451, 5193, 4946, 4711, 4488, 4275, 4072, 3881, 3699, 3527, 3362, 3205, 3055, 2912, 2776, 2646, 2523, 2405, 2292, 2185, 2083, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000,
+32000, 31579, 30042, 28580, 27190, 25867, 24608, 23411, 22271, 21188, 20157, 19176, 18243, 17355, 16511, 15938, 15770, 15605, 15441, 15279, 15118, 14960, 14803, 14647, 14494, 14341, 14191, 14042, 13894, 13749, 13604, 13461, 13320, 12242, 11251, 10340, 9503, 8733, 8026, 7632, 7267, 6920, 6589, 6275, 5975, 5689, 5417, 5159, 4912, 4677, 4454, 4241, 4038, 3848, 3667, 3494, 3329, 3173, 3023, 2881, 2745, 2616, 2493, 2376, 2264, 2157, 2056, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000,
+32000, 31575, 30029, 28558, 27159, 25829, 24564, 23361, 22217, 21129, 20094, 19110, 18174, 17284, 16437, 15921, 15753, 15587, 15422, 15259, 15098, 14938, 14780, 14624, 14469, 14316, 14165, 14015, 13867, 13721, 13576, 13432, 13290, 12207, 11212, 10298, 9459, 8688, 7988, 7604, 7238, 6890, 6558, 6243, 5943, 5657, 5384, 5125, 4879, 4644, 4421, 4208, 4005, 3815, 3635, 3462, 3298, 3142, 2993, 2851, 2716, 2587, 2464, 2347, 2236, 2130, 2029, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000,
+32000, 31571, 30015, 28536, 27129, 25792, 24520, 23312, 22163, 21070, 20032, 19044, 18106, 17213, 16365, 15905, 15736, 15569, 15403, 15239, 15077, 14917, 14758, 14601, 14445, 14292, 14140, 13989, 13840, 13693, 13547, 13403, 13261, 12173, 11174, 10258, 9417, 8644, 7962, 7577, 7210, 6860, 6528, 6212, 5911, 5625, 5352, 5093, 4846, 4612, 4388, 4176, 3974, 3784, 3603, 3431, 3267, 3111, 2963, 2821, 2687, 2558, 2436, 2320, 2209, 2103, 2003, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000,
+32000, 31567, 30001, 28513, 27099, 25755, 24478, 23263, 22110, 21013, 19971, 18980, 18039, 17144, 16294, 15890, 15720, 15551, 15385, 15220, 15057, 14896, 14736, 14578, 14422, 14268, 14115, 13964, 13814, 13666, 13520, 13375, 13232, 12140, 11138, 10218, 9375, 8601, 7937, 7550, 7182, 6832, 6498, 6182, 5880, 5594, 5321, 5061, 4815, 4580, 4357, 4144, 3943, 3753, 3573, 3401, 3237, 3082, 2934, 2793, 2658, 2530, 2409, 2293, 2183, 2078, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000,
+32000, 31563, 29988, 28491, 27069, 25719, 24435, 23216, 22057, 20956, 19911, 18917, 17973, 17076, 16224, 15874, 15703, 15534, 15366, 15201, 15037, 14875, 14715, 14556, 14399, 14244, 14090, 13938, 13788, 13640, 13493, 13347, 13203, 12107, 11101, 10180, 9334, 8559, 7912, 7523, 7154, 6803, 6469, 6152, 5850, 5563, 5290, 5030, 4784, 4549, 4326, 4113, 3913, 3723, 3543, 3372, 3208, 3053, 2905, 2765, 2631, 2503, 2382, 2267, 2157, 2053, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000,
+32000, 31558, 29974, 28469, 27040, 25682, 24393, 23168, 22005, 20901, 19851, 18855, 17908, 17009, 16155, 15859, 15687, 15517, 15348, 15182, 15017, 14854, 14693, 14534, 14376, 14220, 14066, 13914, 13763, 13613, 13466, 13320, 13175, 12075, 11066, 10141, 9294, 8518, 7887, 7498, 7127, 6775, 6441, 6123, 5821, 5533, 5260, 5000, 4753, 4519, 4296, 4083, 3883, 3694, 3514, 3343, 3180, 3025, 2878, 2738, 2604, 2477, 2357, 2242, 2132, 2029, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000,
+32000, 31553, 29959, 28446, 27010, 25646, 24351, 23121, 21954, 20845, 19793, 18793, 17844, 16943, 16087, 15844, 15671, 15500, 15331, 15163, 14998, 14834, 14672, 14512, 14354, 14197, 14042, 13889, 13738, 13588, 13439, 13293, 13148, 12043, 11031, 10104, 9255, 8477, 7863, 7472, 7101, 6748, 6413, 6094, 5792, 5504, 5231, 4971, 4724, 4489, 4266, 4054, 3855, 3666, 3486, 3315, 3152, 2998, 2851, 2711, 2578, 2452, 2332, 2217, 2108, 2005, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000,
+32000, 31547, 29944, 28424, 26980, 25610, 24309, 23075, 21903, 20790, 19734, 18732, 17781, 16878, 16020, 15829, 15655, 15483, 15313, 15145, 14979, 14814, 14652, 14491, 14332, 14175, 14019, 13865, 13713, 13562, 13414, 13266, 13121, 12012, 10997, 10067, 9216, 8438, 7839, 7447, 7075, 6721, 6386, 6066, 5763, 5475, 5202, 4942, 4695, 4460, 4237, 4026, 3827, 3638, 3458, 3288, 3126, 2971, 2825, 2685, 2553, 2427, 2307, 2193, 2085, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000,
+32000, 31540, 29929, 28401, 26950, 25573, 24267, 23028, 21852, 20736, 19676, 18671, 17718, 16813, 15990, 15814, 15639, 15466, 15296, 15127, 14960, 14795, 14631, 14470, 14310, 14152, 13996, 13841, 13688, 13537, 13388, 13240, 13094, 11981, 10963, 10031, 9179, 8399, 7815, 7423, 7050, 6695, 6359, 6039, 5736, 5447, 5173, 4913, 4666, 4432, 4209, 3998, 3799, 3611, 3431, 3261, 3099, 2945, 2799, 2660, 2528, 2403, 2284, 2170, 2062, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000,
+32000, 31533, 29913, 28377, 26920, 25537, 24225, 22981, 21801, 20681, 19619, 18611, 17655, 16749, 15976, 15799, 15623, 15450, 15278, 15109, 14941, 14775, 14611, 14449, 14288, 14130, 13973, 13818, 13664, 13513, 13362, 13214, 13067, 11951, 10929, 9996, 9141, 8360, 7792, 7398, 7024, 6669, 6332, 6012, 5708, 5420, 5146, 4886, 4639, 4404, 4182, 3971, 3772, 3584, 3405, 3235, 3074, 2920, 2774, 2636, 2504, 2379, 2260, 2148, 2040, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000,
+32000, 31525, 29897, 28353, 26889, 25500, 24183, 22934, 21750, 20627, 19561, 18551, 17593, 16684, 15962, 15784, 15608, 15434, 15261, 15091, 14922, 14756, 14591, 14428, 14267, 14108, 13950, 13794, 13640, 13488, 13337, 13188, 13041, 11921, 10897, 9960, 9105, 8322, 7770, 7375, 7000, 6644, 6306, 5986, 5681, 5393, 5119, 4858, 4611, 4377, 4155, 3944, 3746, 3558, 3379, 3210, 3049, 2896, 2750, 2612, 2481, 2356, 2238, 2126, 2019, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000,
+32000, 31516, 29880, 28328, 26857, 25463, 24141, 22887, 21699, 20572, 19504, 18491, 17531, 16621, 15948, 15769, 15592, 15417, 15244, 15073, 14904, 14736, 14571, 14407, 14246, 14086, 13927, 13771, 13616, 13464, 13312, 13163, 13015, 11891, 10864, 9926, 9068, 8285, 7747, 7351, 6975, 6619, 6281, 5960, 5655, 5366, 5092, 4832, 4585, 4350, 4128, 3918, 3720, 3533, 3354, 3185, 3024, 2871, 2727, 2589, 2458, 2334, 2216, 2104, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000,
+32000, 31507, 29862, 28303, 26825, 25425, 24098, 22840, 21647, 20517, 19446, 18431, 17469, 16557, 15934, 15754, 15577, 15401, 15227, 15055, 14885, 14717, 14551, 14387, 14224, 14064, 13905, 13748, 13593, 13439, 13288, 13138, 12989, 11862, 10832, 9891, 9032, 8248, 7725, 7328, 6951, 6594, 6255, 5934, 5629, 5340, 5066, 4805, 4558, 4324, 4102, 3893, 3695, 3508, 3330, 3161, 3000, 2848, 2703, 2566, 2436, 2312, 2195, 2084, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000,
+32000, 31496, 29843, 28277, 26793, 25386, 24054, 22792, 21595, 20462, 19388, 18370, 17406, 16493, 15920, 15740, 15561, 15384, 15210, 15037, 14867, 14698, 14531, 14366, 14203, 14042, 13882, 13725, 13569, 13415, 13263, 13112, 12964, 11832, 10800, 9857, 8997, 8212, 7703, 7305, 6928, 6570, 6231, 5909, 5604, 5314, 5040, 4779, 4533, 4298, 4076, 3868, 3670, 3483, 3305, 3137, 2977, 2825, 2681, 2544, 2414, 2291, 2174, 2064, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000,
+32000, 31484, 29823, 28249, 26759, 25347, 24010, 22743, 21543, 20406, 19329, 18310, 17344, 16428, 15906, 15725, 15545, 15368, 15193, 15019, 14848, 14678, 14511, 14345, 14182, 14020, 13860, 13702, 13546, 13391, 13238, 13087, 12938, 11803, 10768, 9823, 8962, 8176, 7681, 7282, 6904, 6546, 6206, 5884, 5578, 5289, 5014, 4754, 4507, 4273, 4051, 3843, 3646, 3459, 3282, 3114, 2954, 2803, 2659, 2523, 2393, 2271, 2154, 2044, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000,
+32000, 31471, 29802, 28221, 26724, 25307, 23964, 22693, 21489, 20350, 19270, 18248, 17280, 16364, 15892, 15710, 15529, 15351, 15175, 15001, 14829, 14659, 14491, 14325, 14160, 13998, 13838, 13679, 13522, 13367, 13214, 13062, 12912, 11774, 10736, 9790, 8927, 8140, 7659, 7260, 6881, 6522, 6182, 5859, 5553, 5264, 4989, 4729, 4482, 4248, 4026, 3819, 3622, 3436, 3259, 3091, 2932, 2781, 2638, 2502, 2373, 2251, 2135, 2025, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000,
+32000, 31457, 29780, 28192, 26688, 25265, 23918, 22643, 21435, 20292, 19210, 18186, 17216, 16298, 15877, 15694, 15513, 15335, 15158, 14983, 14810, 14640, 14471, 14304, 14139, 13976, 13815, 13656, 13498, 13343, 13189, 13037, 12886, 11745, 10704, 9756, 8892, 8104, 7638, 7237, 6858, 6498, 6157, 5834, 5529, 5239, 4964, 4704, 4457, 4223, 4002, 3795, 3599, 3412, 3236, 3068, 2910, 2759, 2616, 2481, 2353, 2231, 2116, 2006, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000,
+32000, 31441, 29756, 28161, 26651, 25223, 23870, 22591, 21380, 20234, 19149, 18123, 17151, 16232, 15863, 15679, 15497, 15318, 15140, 14965, 14791, 14620, 14450, 14283, 14118, 13954, 13792, 13632, 13474, 13318, 13164, 13011, 12861, 11716, 10673, 9722, 8857, 8068, 7616, 7215, 6835, 6474, 6133, 5810, 5504, 5214, 4939, 4679, 4433, 4199, 3978, 3771, 3575, 3390, 3213, 3047, 2888, 2738, 2596, 2461, 2333, 2212, 2097, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000,
+32000, 31425, 29731, 28129, 26613, 25179, 23822, 22538, 21323, 20174, 19087, 18058, 17085, 16164, 15848, 15663, 15481, 15300, 15122, 14946, 14772, 14600, 14430, 14262, 14096, 13932, 13769, 13609, 13450, 13294, 13139, 12986, 12835, 11686, 10641, 9689, 8822, 8033, 7594, 7192, 6812, 6451, 6109, 5786, 5480, 5189, 4915, 4655, 4408, 4175, 3954, 3748, 3553, 3367, 3191, 3025, 2867, 2718, 2576, 2441, 2314, 2193, 2079, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000,
+32000, 31406, 29704, 28095, 26573, 25133, 23771, 22483, 21265, 20113, 19023, 17993, 17018, 16096, 15833, 15647, 15464, 15283, 15104, 14927, 14753, 14580, 14409, 14240, 14074, 13909, 13746, 13585, 13426, 13269, 13114, 12960, 12808, 11657, 10609, 9655, 8787, 7998, 7573, 7170, 6789, 6427, 6085, 5762, 5455, 5165, 4890, 4630, 4384, 4151, 3931, 3725, 3530, 3345, 3170, 3004, 2846, 2697, 2556, 2422, 2295, 2175, 2061, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000,
+32000, 31386, 29676, 28060, 26531, 25086, 23719, 22427, 21206, 20050, 18958, 17925, 16949, 16026, 15817, 15631, 15447, 15265, 15086, 14908, 14733, 14559, 14388, 14219, 14051, 13886, 13723, 13561, 13402, 13244, 13088, 12934, 12782, 11627, 10577, 9621, 8752, 7977, 7551, 7147, 6765, 6404, 6062, 5738, 5431, 5141, 4866, 4606, 4360, 4127, 3908, 3702, 3508, 3323, 3148, 2983, 2826, 2677, 2536, 2403, 2277, 2157, 2044, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000,
+32000, 31364, 29646, 28022, 26488, 25037, 23666, 22369, 21144, 19986, 18891, 17857, 16879, 15990, 15801, 15614, 15430, 15247, 15067, 14889, 14712, 14538, 14367, 14197, 14029, 13863, 13699, 13537, 13377, 13218, 13062, 12908, 12755, 11597, 10544, 9587, 8716, 7956, 7529, 7125, 6742, 6380, 6038, 5714, 5407, 5117, 4842, 4582, 4336, 4103, 3885, 3680, 3485, 3301, 3127, 2962, 2806, 2658, 2517, 2384, 2259, 2139, 2026, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000,
+32000, 31341, 29614, 27983, 26442, 24986, 23610, 22309, 21081, 19920, 18822, 17786, 16806, 15975, 15785, 15597, 15412, 15229, 15047, 14869, 14692, 14517, 14345, 14174, 14006, 13839, 13675, 13512, 13351, 13193, 13036, 12881, 12728, 11566, 10511, 9552, 8680, 7935, 7507, 7102, 6719, 6357, 6014, 5689, 5383, 5092, 4818, 4558, 4312, 4079, 3862, 3657, 3463, 3280, 3106, 2942, 2786, 2638, 2499, 2366, 2241, 2122, 2010, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000,
+32000, 31315, 29581, 27942, 26395, 24933, 23552, 22247, 21015, 19851, 18752, 17713, 16732, 15959, 15768, 15580, 15393, 15209, 15028, 14848, 14671, 14495, 14322, 14151, 13982, 13815, 13650, 13487, 13325, 13166, 13009, 12853, 12700, 11535, 10478, 9517, 8644, 7914, 7485, 7079, 6696, 6333, 5990, 5665, 5358, 5068, 4793, 4533, 4288, 4055, 3839, 3635, 3442, 3259, 3086, 2922, 2766, 2619, 2480, 2348, 2223, 2105, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000,
+32000, 31288, 29545, 27899, 26345, 24877, 23491, 22183, 20947, 19780, 18678, 17638, 16655, 15942, 15751, 15561, 15375, 15190, 15007, 14827, 14649, 14473, 14299, 14127, 13958, 13790, 13624, 13461, 13299, 13139, 12981, 12826, 12671, 11504, 10444, 9481, 8607, 7892, 7462, 7056, 6672, 6309, 5965, 5641, 5334, 5043, 4769, 4509, 4264, 4032, 3816, 3613, 3420, 3238, 3065, 2902, 2747, 2600, 2462, 2330, 2206, 2089, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000,
+32000, 31258, 29506, 27853, 26292, 24819, 23429, 22116, 20877, 19707, 18603, 17560, 16576, 15925, 15733, 15543, 15355, 15170, 14986, 14805, 14627, 14450, 14276, 14103, 13933, 13765, 13598, 13434, 13272, 13112, 12953, 12797, 12642, 11471, 10409, 9445, 8570, 7870, 7439, 7033, 6648, 6285, 5941, 5616, 5309, 5019, 4744, 4485, 4240, 4008, 3793, 3590, 3398, 3217, 3045, 2882, 2728, 2582, 2444, 2313, 2189, 2072, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000,
+32000, 31226, 29466, 27805, 26238, 24759, 23363, 22046, 20803, 19631, 18524, 17480, 16494, 15907, 15714, 15523, 15335, 15149, 14965, 14783, 14604, 14426, 14251, 14078, 13907, 13739, 13572, 13407, 13244, 13083, 12925, 12768, 12613, 11439, 10374, 9408, 8532, 7847, 7416, 7009, 6624, 6260, 5916, 5591, 5284, 4994, 4719, 4460, 4215, 3984, 3770, 3568, 3377, 3196, 3024, 2862, 2708, 2563, 2426, 2296, 2173, 2056, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000,
+32000, 31192, 29423, 27754, 26180, 24695, 23294, 21973, 20727, 19551, 18442, 17396, 16410, 15889, 15695, 15503, 15314, 15127, 14943, 14760, 14580, 14402, 14226, 14053, 13881, 13712, 13544, 13379, 13216, 13054, 12895, 12738, 12582, 11405, 10337, 9370, 8493, 7824, 7393, 6985, 6599, 6235, 5891, 5566, 5259, 4969, 4694, 4435, 4191, 3960, 3747, 3546, 3355, 3175, 3004, 2842, 2690, 2545, 2408, 2279, 2156, 2040, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000,
+32000, 31155, 29377, 27700, 26119, 24628, 23223, 21897, 20647, 19469, 18358, 17310, 16322, 15870, 15675, 15483, 15293, 15105, 14920, 14736, 14556, 14377, 14200, 14026, 13854, 13684, 13516, 13350, 13186, 13024, 12865, 12707, 12551, 11370, 10300, 9331, 8454, 7801, 7368, 6960, 6574, 6210, 5865, 5540, 5233, 4943, 4669, 4410, 4166, 3937, 3724, 3523, 3334, 3154, 2984, 2823, 2671, 2527, 2390, 2262, 2140, 2024, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000,
+32000, 31116, 29328, 27643, 26055, 24558, 23147, 21818, 20564, 19383, 18269, 17220, 16231, 15850, 15654, 15461, 15270, 15082, 14896, 14712, 14530, 14351, 14174, 13999, 13826, 13655, 13487, 13320, 13156, 12994, 12833, 12675, 12518, 11334, 10262, 9292, 8413, 7777, 7344, 6935, 6549, 6184, 5839, 5514, 5207, 4917, 4643, 4385, 4140, 3913, 3701, 3501, 3312, 3133, 2964, 2803, 2652, 2509, 2373, 2245, 2123, 2009, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000};
+
+#endif //C_LOCALDEF__LCCM655__ENABLE_FCTL_BRAKE_CONTROL
+#endif //C_LOCALDEF__LCCM655__ENABLE_FLIGHT_CONTROL
+#endif //C_LOCALDEF__LCCM655__ENABLE_THIS_MODULE
@@ -1,5 +1,6 @@
 #include "../../fcu_core.h"
-#if 0
+//The raw polys, only kept as the reference for the brake grid tests
+#if C_LOCALDEF__LCCM655__ENABLE_TEST_SPEC == 1U
 
 #ifndef WIN32
 const Lfloat32 f32A34_BrakeTable[] = {
@@ -167,5 +168,4 @@ Lfloat32 f32A34_BrakeTable[] = {
 -1.89074765901e-13, 2.34301071659e-09, -1.00305186696e-05, 0.0186369654871,
 -1.90259813623e-13, 2.3528324397e-09, -1.00516046187e-05, 0.0186370258848};
 
-#endif //0
-
+#endif //C_LOCALDEF__LCCM655__ENABLE_TEST_SPEC
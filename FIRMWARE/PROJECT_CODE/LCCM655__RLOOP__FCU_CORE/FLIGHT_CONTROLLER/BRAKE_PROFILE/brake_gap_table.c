@@ -1,18 +1,27 @@
 #include "../../fcu_core.h"
-#if 0
-// The index for this table is the measured velocity (probably scaled by some value)
-// The 4 values in the table are Kp, Ki, Kd, and Ts constants to compute the brake gap
-// TODO: add real values, these are examples
+#if C_LOCALDEF__LCCM655__ENABLE_THIS_MODULE == 1U
+#if C_LOCALDEF__LCCM655__ENABLE_FLIGHT_CONTROL == 1U
+#if C_LOCALDEF__LCCM655__ENABLE_BRAKEPID == 1U
+// The index for this table is the measured velocity in C_FCU__BRAKEPID__GAINS_STEP_MMS steps
+// The 4 values in the table are Kp, Ki, Kd, and Tf constants to compute the drag force demand
+// Kp = N per m/s, Ki = N per m, Kd = N per m/s/s, Tf = derivative filter in seconds
+// Tuned with PYTHON/brake_pid_sim.py, 350kg pod and a 15mm/s actuator
 #ifndef WIN32
 const Lfloat32 f32A34_GainsTable[] = {
 #else
 Lfloat32 f32A34_GainsTable[] = {
 #endif
-0.378, 0.17, 0.206, 0.0183,
-0.378, 0.17, 0.206, 0.0183,
-0.378, 0.17, 0.206, 0.0183,
-0.378, 0.17, 0.206, 0.0183
+2000.0, 1000.0, 40.0, 0.05,	//0 m/s, the grid runs out at 24.6m/s so full brakes below that anyway
+1500.0, 700.0, 30.0, 0.05,	//40 m/s
+1500.0, 700.0, 30.0, 0.05,	//80 m/s
+1000.0, 500.0, 20.0, 0.05,	//120 m/s
+1000.0, 500.0, 20.0, 0.05	//160 m/s
 };
 
-#endif //0
+#if C_FCU__BRAKEPID__GAINS_NUM != 5U
+	#error
+#endif
 
+#endif //C_LOCALDEF__LCCM655__ENABLE_BRAKEPID
+#endif //C_LOCALDEF__LCCM655__ENABLE_FLIGHT_CONTROL
+#endif //C_LOCALDEF__LCCM655__ENABLE_THIS_MODULE
@@ -22,18 +22,10 @@
 #if C_LOCALDEF__LCCM655__ENABLE_THIS_MODULE == 1U
 #if C_LOCALDEF__LCCM655__ENABLE_FLIGHT_CONTROL == 1U
 #if C_LOCALDEF__LCCM655__ENABLE_BRAKEPID == 1U
-#if 0
-
 extern struct _strFCU sFCU;
 
 #ifndef WIN32
-extern const Lfloat32 f32A34_BrakeTable[];
-#else
-extern Lfloat32 f32A34_BrakeTable[];
-#endif
-
-#ifndef WIN32
-extern const Lfloat32 f32A34_BrakeTable[];
+extern const Lfloat32 f32A34_GainsTable[];
 #else
 extern Lfloat32 f32A34_GainsTable[];
 #endif
@@ -44,98 +36,410 @@ extern const Lfloat32 f32A34_SetPointVelocityTable[];
 extern Lfloat32 f32A34_SetPointVelocityTable[];
 #endif
 
-// TODO: add struct to fcu_core.h inside of _strFCU:
-#if C_LOCALDEF__LCCM655__ENABLE_BRAKEPID == 1U
-struct
-{
-	Lfloat32 f32LastError;
-	Lfloat32 f32LastIntegral;
-
-}sBrakesPid;
-#endif
+//locals
+static Lfloat32 f32FCU_FLIGHTCTL_BRAKEPID__Interp(const Lfloat32 *pf32Table, Luint32 u32Stride, Luint32 u32Num, Lfloat32 f32Index);
 
 
 /***************************************************************************//**
  * @brief
- * ToDo
+ * Init the brake PID, it starts disabled
  * 
- * @st_funcMD5		6A4CB84AD7E29F47CCC6C975810677D3
+ * @st_funcMD5		8290180749D4A02B3831E4DB6E34653C
  * @st_funcID		LCCM655R0.FILE.090.FUNC.001
  */
 void vFCU_FLIGHTCTL_BRAKEPID__Init(void)
 {
+	sFCU.sFlightControl.sBrakePID.u8Enabled = 0U;
+	sFCU.sFlightControl.sBrakePID.u32ISR_Ticks = 0U;
+	sFCU.sFlightControl.sBrakePID.u32SlotTicks = 0U;
+	sFCU.sFlightControl.sBrakePID.f32Setpoint_ms = 0.0F;
+	sFCU.sFlightControl.sBrakePID.f32Drag_n = 0.0F;
+	sFCU.sFlightControl.sBrakePID.f32Gap_mm = C_FCU__BRAKES__MAX_IBEAM_DIST_MM;
+
 	// set initial conditions for pid
-	sBrakesPid.f32LastError = 0;
-	sBrakesPid.f32LastIntegral = 0;
+	vFCU_FLIGHTCTL_BRAKEPID__Reset();
+}
+
+/***************************************************************************//**
+ * @brief
+ * Clear the PID history, done each time we are enabled.
+ * 
+ * @st_funcMD5		DEF4B6668E19B3136C8AB9918912CA6C
+ * @st_funcID		LCCM655R0.FILE.090.FUNC.003
+ */
+void vFCU_FLIGHTCTL_BRAKEPID__Reset(void)
+{
+	sFCU.sFlightControl.sBrakePID.f32Integral_n = 0.0F;
+	sFCU.sFlightControl.sBrakePID.f32Derivative_n = 0.0F;
+	sFCU.sFlightControl.sBrakePID.f32LastError_ms = 0.0F;
+	sFCU.sFlightControl.sBrakePID.u8FirstStep = 1U;
+
+	//force the first command out
+	sFCU.sFlightControl.sBrakePID.f32LastCommand_mm = -1.0F;
 }
 
+/***************************************************************************//**
+ * @brief
+ * Start controlling the brakes, called on entry to the brake state
+ * 
+ * @st_funcMD5		2B4E962E432FD72DF68F18119B25BD32
+ * @st_funcID		LCCM655R0.FILE.090.FUNC.004
+ */
+void vFCU_FLIGHTCTL_BRAKEPID__Enable(void)
+{
+	vFCU_FLIGHTCTL_BRAKEPID__Reset();
+
+	//don't act on ticks from before we were enabled
+	sFCU.sFlightControl.sBrakePID.u32SlotTicks = sFCU.sFlightControl.sBrakePID.u32ISR_Ticks;
+	sFCU.sFlightControl.sBrakePID.u8Enabled = 1U;
+}
 
 /***************************************************************************//**
  * @brief
- * ToDo
+ * Stop controlling the brakes, the brakes stay where they are
  * 
- * @st_funcMD5		AD54420EA2E65DED0BE6EF5E1F8175C1
+ * @st_funcMD5		F7F4FCD8F2267EDF8E7DE84C6FF7000A
+ * @st_funcID		LCCM655R0.FILE.090.FUNC.005
+ */
+void vFCU_FLIGHTCTL_BRAKEPID__Disable(void)
+{
+	sFCU.sFlightControl.sBrakePID.u8Enabled = 0U;
+}
+
+/***************************************************************************//**
+ * @brief
+ * Process the brake PID
+ * The control law only runs once per 10ms slot from the ISR, so the gains
+ * are the same no matter how fast the main loop is.
+ * 
+ * @st_funcMD5		5CFCE5F914AA2200A4491DF5BED64493
  * @st_funcID		LCCM655R0.FILE.090.FUNC.002
  */
 void vFCU_FLIGHTCTL_BRAKEPID__Process(void)
 {
-//	Lint32 kp, ki, kd;
-//	Lfloat32 f32MeasDistance, f32MeasVelocity, f32SetPointVelocity;
-//	Lfloat32 f32Error, f32LastError;
-//	Lfloat32 f32Integral, f32Derivative;
-//	Lfloat32 f32BrakeGap, f32BrakePos;
-//
-//	// measured distance and scale it appropriately so can use as index
-//	f32MeasDistance = u32FCU_FCTL_NAV__GetFrontPos();
-//	// scale it so can use as index
-
-//	// look up SetPoint velocity
-//	f32SetPointVelocity = f32A34_SetPointVelocityTable[f32MeasDistance];
-//
-//	// measure velocity
-//	f32MeasVelocity = u32FCU_FCTL_NAV__PodSpeed();
-//	// scale it so can use as index
-//
-//	// compute error
-//	// TODO: check scaling
-//	f32Error = f32SetPointVelocity - f32MeasVelocity;
-//
-//	// compute integral
-//	f32Integral = (f32LastIntegral + f32Error) * C_LOCALDEF__LCCM418__DEV0__DATA_RATE_HZ;
-//
-//	// compute derivative
-//	f32Derivative = (f32Error - f32LastError)/C_LOCALDEF__LCCM418__DEV0__DATA_RATE_HZ;
-//
-//	// look up pid gains
-//	kp = f32A34_GainsTable[s32MeasVelocity];
-//	ki = f32A34_GainsTable[s32MeasVelocity + 1U];
-//	kd = f32A34_GainsTable[s32MeasVelocity + 2U];
-//
-//	// calculate brake position increment (brake gap) from pid equations
-//	// TODO: verify this represents the equation
-//	// u = [ kp + ki * 1/s + kd * (s/(Tf*s + 1) ] * e
-//	f32BreakGap = (kp * f32Error) + (ki * f32Integral) + (kd * f32Derivative);
-//
-//	// get current brake position
-//	//TODO: Clarify this
-//	f32BrakePos = (s32FCU_BRAKES__Get_CurrentPos(FCU_BRAKE__LEFT ) + s32FCU_BRAKES__Get_CurrentPos(FCU_BRAKE__RIGHT )) >> 1U;
-//
-//	// add brake gap to current brake position
-//	f32BrakePos += f32BreakGap;
-//
-//	// set new brake position
-//	// TODO: check units, need in microns for this function
-//	vFCU_BRAKES__Move_IBeam_Distance_mm(Lfloat32 f32BrakePos)
-//
-//	// save current error
-//	f32LastError = f32Error;
-//	f32LastIntegral = f32Integral;
+	Luint32 u32Ticks;
+	Lfloat32 f32Gap_mm;
+	Lfloat32 f32Temp;
+
+	//snapshot the ISR
+	u32Ticks = sFCU.sFlightControl.sBrakePID.u32ISR_Ticks - sFCU.sFlightControl.sBrakePID.u32SlotTicks;
+	if(u32Ticks != 0U)
+	{
+		sFCU.sFlightControl.sBrakePID.u32SlotTicks += u32Ticks;
+
+		if(sFCU.sFlightControl.sBrakePID.u8Enabled == 1U)
+		{
+			//limit the step if the main loop has stalled
+			if(u32Ticks > C_FCU__BRAKEPID__MAX_SLOT_TICKS)
+			{
+				u32Ticks = C_FCU__BRAKEPID__MAX_SLOT_TICKS;
+			}
+			else
+			{
+				//fall on
+			}
+
+			f32Gap_mm = f32FCU_FLIGHTCTL_BRAKEPID__Step(s32FCU_FCTL_NAV__Get_Track_Position_mm(),
+													s32FCU_FCTL_NAV__Get_Veloc_mm_s(),
+													(Lfloat32)u32Ticks * 0.01F);
+
+			//only move the brakes if it is worth it
+			f32Temp = f32Gap_mm - sFCU.sFlightControl.sBrakePID.f32LastCommand_mm;
+			if((f32Temp > C_FCU__BRAKEPID__GAP_DEADBAND_MM) || (f32Temp < -C_FCU__BRAKEPID__GAP_DEADBAND_MM))
+			{
+				#if C_LOCALDEF__LCCM655__ENABLE_BRAKES == 1U
+					vFCU_BRAKES__Move_IBeam_Distance_mm(f32Gap_mm);
+				#endif
+				sFCU.sFlightControl.sBrakePID.f32LastCommand_mm = f32Gap_mm;
+			}
+			else
+			{
+				//inside the deadband
+			}
+		}
+		else
+		{
+			//not controlling
+		}
+	}
+	else
+	{
+		//not our slot yet
+	}
 
 }
 
+/***************************************************************************//**
+ * @brief
+ * One step of the control law.
+ * Error is how much faster we are than the setpoint for our position, the
+ * output is the drag force we want which is turned into a gap with the brake
+ * lookup. The gains are scheduled by velocity.
+ * Anti windup: the integral is only taken if it would not push the output
+ * further into saturation.
+ * 
+ * @param[in]		f32Dt_s					Time since the last step
+ * @param[in]		s32Veloc_mm_s			Pod velocity
+ * @param[in]		s32Position_mm			Pod track position
+ * @return			The I-Beam gap to command in mm
+ * @st_funcMD5		577108CE2327CD351FAE5D4313FD4D59
+ * @st_funcID		LCCM655R0.FILE.090.FUNC.006
+ */
+Lfloat32 f32FCU_FLIGHTCTL_BRAKEPID__Step(Lint32 s32Position_mm, Lint32 s32Veloc_mm_s, Lfloat32 f32Dt_s)
+{
+	Lfloat32 f32Veloc_ms;
+	Lfloat32 f32Error;
+	Lfloat32 f32Kp;
+	Lfloat32 f32Ki;
+	Lfloat32 f32Kd;
+	Lfloat32 f32Tf;
+	Lfloat32 f32Integral;
+	Lfloat32 f32Output;
+	Lfloat32 f32Gap_mm;
+	Lfloat32 f32Temp;
+	Luint32 u32Veloc_mms;
+	Luint32 u32MaxDrag_n;
+	Luint32 u32Gap_um;
+	Lint16 s16Return;
+
+	//we never go backwards while braking
+	if(s32Veloc_mm_s < 0)
+	{
+		u32Veloc_mms = 0U;
+	}
+	else
+	{
+		u32Veloc_mms = (Luint32)s32Veloc_mm_s;
+	}
+	f32Veloc_ms = (Lfloat32)u32Veloc_mms * 0.001F;
+
+	//where should we be
+	if(s32Position_mm < 0)
+	{
+		s32Position_mm = 0;
+	}
+	else
+	{
+		//fall on
+	}
+	sFCU.sFlightControl.sBrakePID.f32Setpoint_ms = f32FCU_FLIGHTCTL_BRAKEPID__Interp(&f32A34_SetPointVelocityTable[0], 1U, C_FCU__BRAKEPID__SETPOINT_NUM,
+																					(Lfloat32)s32Position_mm / (Lfloat32)C_FCU__BRAKEPID__SETPOINT_STEP_MM);
+
+	//positive error = too fast = more brakes
+	f32Error = f32Veloc_ms - sFCU.sFlightControl.sBrakePID.f32Setpoint_ms;
+
+	//schedule the gains
+	f32Temp = (Lfloat32)u32Veloc_mms / (Lfloat32)C_FCU__BRAKEPID__GAINS_STEP_MMS;
+	f32Kp = f32FCU_FLIGHTCTL_BRAKEPID__Interp(&f32A34_GainsTable[0], 4U, C_FCU__BRAKEPID__GAINS_NUM, f32Temp);
+	f32Ki = f32FCU_FLIGHTCTL_BRAKEPID__Interp(&f32A34_GainsTable[1], 4U, C_FCU__BRAKEPID__GAINS_NUM, f32Temp);
+	f32Kd = f32FCU_FLIGHTCTL_BRAKEPID__Interp(&f32A34_GainsTable[2], 4U, C_FCU__BRAKEPID__GAINS_NUM, f32Temp);
+	f32Tf = f32FCU_FLIGHTCTL_BRAKEPID__Interp(&f32A34_GainsTable[3], 4U, C_FCU__BRAKEPID__GAINS_NUM, f32Temp);
+
+	//no kick on the first step
+	if(sFCU.sFlightControl.sBrakePID.u8FirstStep == 1U)
+	{
+		sFCU.sFlightControl.sBrakePID.f32LastError_ms = f32Error;
+		sFCU.sFlightControl.sBrakePID.u8FirstStep = 0U;
+	}
+	else
+	{
+		//fall on
+	}
+
+	//filtered derivative, Kd.s / (Tf.s + 1)
+	sFCU.sFlightControl.sBrakePID.f32Derivative_n = ((f32Tf * sFCU.sFlightControl.sBrakePID.f32Derivative_n) + (f32Kd * (f32Error - sFCU.sFlightControl.sBrakePID.f32LastError_ms)))
+														/ (f32Tf + f32Dt_s);
+	sFCU.sFlightControl.sBrakePID.f32LastError_ms = f32Error;
+
+	//the most the brakes can do right now
+	s16Return = s16FCU_FLIGHTCTL_BRAKES__Drag_Lookup(u32Veloc_mms, (Luint32)(C_FCU__BRAKES__MIN_IBEAM_DIST_MM * 1000.0F), &u32MaxDrag_n);
+	if(s16Return == 0)
+	{
+		f32Integral = sFCU.sFlightControl.sBrakePID.f32Integral_n + (f32Ki * f32Error * f32Dt_s);
+		f32Output = (f32Kp * f32Error) + f32Integral + sFCU.sFlightControl.sBrakePID.f32Derivative_n;
+
+		if(f32Output > (Lfloat32)u32MaxDrag_n)
+		{
+			f32Output = (Lfloat32)u32MaxDrag_n;
+
+			//only wind down
+			if(f32Error < 0.0F)
+			{
+				sFCU.sFlightControl.sBrakePID.f32Integral_n = f32Integral;
+			}
+			else
+			{
+				//hold
+			}
+		}
+		else if(f32Output < 0.0F)
+		{
+			f32Output = 0.0F;
+
+			//only wind up
+			if(f32Error > 0.0F)
+			{
+				sFCU.sFlightControl.sBrakePID.f32Integral_n = f32Integral;
+			}
+			else
+			{
+				//hold
+			}
+		}
+		else
+		{
+			sFCU.sFlightControl.sBrakePID.f32Integral_n = f32Integral;
+		}
 
+		//the integral on its own must also be something the brakes can do
+		if(sFCU.sFlightControl.sBrakePID.f32Integral_n > (Lfloat32)u32MaxDrag_n)
+		{
+			sFCU.sFlightControl.sBrakePID.f32Integral_n = (Lfloat32)u32MaxDrag_n;
+		}
+		else if(sFCU.sFlightControl.sBrakePID.f32Integral_n < 0.0F)
+		{
+			sFCU.sFlightControl.sBrakePID.f32Integral_n = 0.0F;
+		}
+		else
+		{
+			//fall on
+		}
 
-#endif //0
+		sFCU.sFlightControl.sBrakePID.f32Drag_n = f32Output;
+
+		//drag to gap
+		s16Return = s16FCU_FLIGHTCTL_BRAKES__Brake_Lookup(u32Veloc_mms, (Luint32)f32Output, &u32Gap_um);
+	}
+	else
+	{
+		//off the brake grid, below ~25m/s the brakes are full on
+		sFCU.sFlightControl.sBrakePID.f32Drag_n = 0.0F;
+	}
+
+	if(s16Return == 0)
+	{
+		f32Gap_mm = (Lfloat32)u32Gap_um * 0.001F;
+	}
+	else
+	{
+		f32Gap_mm = C_FCU__BRAKES__MIN_IBEAM_DIST_MM;
+	}
+
+	//same limits as the brakes
+	if(f32Gap_mm < C_FCU__BRAKES__MIN_IBEAM_DIST_MM)
+	{
+		f32Gap_mm = C_FCU__BRAKES__MIN_IBEAM_DIST_MM;
+	}
+	else if(f32Gap_mm > C_FCU__BRAKES__MAX_IBEAM_DIST_MM)
+	{
+		f32Gap_mm = C_FCU__BRAKES__MAX_IBEAM_DIST_MM;
+	}
+	else
+	{
+		//fall on
+	}
+
+	sFCU.sFlightControl.sBrakePID.f32Gap_mm = f32Gap_mm;
+	return f32Gap_mm;
+}
+
+/***************************************************************************//**
+ * @brief
+ * Linear interpolation in one column of a table
+ * 
+ * @param[in]		f32Index				Fractional row, clamped to the table
+ * @param[in]		u32Num					Number of rows
+ * @param[in]		u32Stride				Items per row
+ * @param[in]		*pf32Table				First item of the column
+ * @st_funcMD5		AA09641A92F9C1BCFA73682E0630B9F7
+ * @st_funcID		LCCM655R0.FILE.090.FUNC.007
+ */
+static Lfloat32 f32FCU_FLIGHTCTL_BRAKEPID__Interp(const Lfloat32 *pf32Table, Luint32 u32Stride, Luint32 u32Num, Lfloat32 f32Index)
+{
+	Luint32 u32Row;
+	Lfloat32 f32Frac;
+	Lfloat32 f32Return;
+
+	if(f32Index <= 0.0F)
+	{
+		f32Return = pf32Table[0];
+	}
+	else if(f32Index >= (Lfloat32)(u32Num - 1U))
+	{
+		f32Return = pf32Table[(u32Num - 1U) * u32Stride];
+	}
+	else
+	{
+		u32Row = (Luint32)f32Index;
+		f32Frac = f32Index - (Lfloat32)u32Row;
+		f32Return = pf32Table[u32Row * u32Stride];
+		f32Return += (pf32Table[(u32Row + 1U) * u32Stride] - f32Return) * f32Frac;
+	}
+
+	return f32Return;
+}
+
+/***************************************************************************//**
+ * @brief
+ * 10ms timer, sets the PID execution rate
+ * 
+ * @st_funcMD5		613A94FCDAD36E1CAA346CA1D3EB0917
+ * @st_funcID		LCCM655R0.FILE.090.FUNC.008
+ */
+void vFCU_FLIGHTCTL_BRAKEPID__10MS_ISR(void)
+{
+	sFCU.sFlightControl.sBrakePID.u32ISR_Ticks++;
+}
+
+/***************************************************************************//**
+ * @brief
+ * Get the current setpoint velocity in mm/s
+ * 
+ * @st_funcMD5		EE19537FDCF8B8FC2B416BF70E46ACD3
+ * @st_funcID		LCCM655R0.FILE.090.FUNC.009
+ */
+Lint32 s32FCU_FLIGHTCTL_BRAKEPID__Get_Setpoint_mms(void)
+{
+	return (Lint32)(sFCU.sFlightControl.sBrakePID.f32Setpoint_ms * 1000.0F);
+}
+
+/***************************************************************************//**
+ * @brief
+ * Get the drag force the PID is asking for
+ * 
+ * @st_funcMD5		E83D100312FBB830FC0170D5660E0E50
+ * @st_funcID		LCCM655R0.FILE.090.FUNC.010
+ */
+Lint32 s32FCU_FLIGHTCTL_BRAKEPID__Get_Drag_n(void)
+{
+	return (Lint32)sFCU.sFlightControl.sBrakePID.f32Drag_n;
+}
+
+/***************************************************************************//**
+ * @brief
+ * Get the last computed gap in um
+ * 
+ * @st_funcMD5		7B524A2B7E433C01A05D55670EAEBAEA
+ * @st_funcID		LCCM655R0.FILE.090.FUNC.011
+ */
+Lint32 s32FCU_FLIGHTCTL_BRAKEPID__Get_Gap_um(void)
+{
+	return (Lint32)(sFCU.sFlightControl.sBrakePID.f32Gap_mm * 1000.0F);
+}
+
+//safetys
+#if C_LOCALDEF__LCCM655__ENABLE_FCTL_BRAKE_CONTROL != 1U
+	//we need the brake lookup
+	#error
+#endif
+#if C_LOCALDEF__LCCM655__ENABLE_FCTL_NAVIGATION != 1U
+	//we need the track position and velocity
+	#error
+#endif
+#if C_LOCALDEF__LCCM655__ENABLE_BRAKES != 1U
+	//we need to move the brakes
+	#error
+#endif
 
 #endif //C_LOCALDEF__LCCM655__ENABLE_BRAKEPID
 #ifndef C_LOCALDEF__LCCM655__ENABLE_BRAKEPID
@@ -22,16 +22,19 @@
 #if C_LOCALDEF__LCCM655__ENABLE_THIS_MODULE == 1U
 #if C_LOCALDEF__LCCM655__ENABLE_FLIGHT_CONTROL == 1U
 #if C_LOCALDEF__LCCM655__ENABLE_FCTL_BRAKE_CONTROL == 1U
-#if 0
 
 //https://drive.google.com/open?id=0B6nyc_uvAyY0YTdyNmotZ2p6Nlk
 
+//The gap grid, generated from the A34 data by brake_grid.py
 #ifndef WIN32
-extern const Lfloat32 f32A34_BrakeTable[];
+extern const Luint16 u16A34_BrakeGrid[];
 #else
-extern Lfloat32 f32A34_BrakeTable[];
+extern Luint16 u16A34_BrakeGrid[];
 #endif
 
+//locals
+static Luint32 u32FCU_FLIGHTCTL_BRAKES__Row_Drag(Luint32 u32RowIndex, Luint32 u32IBDistance_um);
+
 //the structure
 extern struct _strFCU sFCU;
 
@@ -66,66 +69,100 @@ void vFCU_FLIGHTCTL_BRAKES__Process(void)
 /***************************************************************************//**
  * @brief
  * Peroform a brake lookup.
+ * Bilinear interpolation in the gap grid, integer only and no loops so the
+ * time taken is the same for every call. The drag columns are 16N apart
+ * below 512N and 128N above.
  * 
  * @param[out]		*pu32IBDistance_um			The computed i-beam dist
  * @param[in]		u32DragForce_n				Requested drag force in newtons
  * @param[in]		u32Veloc_mms				The current pod velocity in mm/sec
- * @st_funcMD5		80ED9BD4181D26C7EBA6540781C37E93
+ * @return			0 = success\n
+ * 					-1 = velocity out of range, max braking
+ * @st_funcMD5		83D389BA567AAA8617D79F00C3280F77
  * @st_funcID		LCCM655R0.FILE.051.FUNC.003
  */
 Lint16 s16FCU_FLIGHTCTL_BRAKES__Brake_Lookup(Luint32 u32Veloc_mms, Luint32 u32DragForce_n, Luint32 *pu32IBDistance_um)
 {
-
-	Luint32 u32Veloc_ms;
 	Lint16 s16Return;
-	Luint32 u32LookupIndex;
-	Lfloat32 f32DragPow3;
-	Lfloat32 f32DragPow2;
-	Lfloat32 f32Result;
-
-	//firstly lets convert our mm/sec veloc into whole units of meters/second
-	u32Veloc_ms = u32Veloc_mms;
-	u32Veloc_ms /= 1000U;
-
-	//do a range check on the data, we are hard limited to 160m/s
+	Luint32 u32Row;
+	Luint32 u32Col;
+	Lint32 s32FracV;
+	Lint32 s32FracD;
+	Lint32 s32StepD;
+	Lint32 s32Top;
+	Lint32 s32Bottom;
+	Lint32 s32Temp;
+
+	//do a range check on the data
 	//NOTE: AND CAUTION:
-	//The brake table is only good for values over about 25m/s, below that the polyfitter is unable to produce a good
+	//The brake data is only good for values over about 25m/s, below that the polyfitter is unable to produce a good
 	//brake curve. The controller is designed to go into a "full on" brake mode below 30m/s so this should not be a problem.
 	//Just remember this fact when you are trying to do unit testing below 30m/s
-	if(u32Veloc_ms < 160U)
+	if(u32Veloc_mms >= C_FCU__BRAKES__GRID_VELOC_MIN_MMS)
 	{
+		//the velocity row and how far we are to the next row
+		u32Row = u32Veloc_mms - C_FCU__BRAKES__GRID_VELOC_MIN_MMS;
+		s32FracV = (Lint32)(u32Row & (C_FCU__BRAKES__GRID_VELOC_STEP - 1U));
+		u32Row >>= C_FCU__BRAKES__GRID_VELOC_SHIFT;
+	}
+	else
+	{
+		//too slow
+		u32Row = C_FCU__BRAKES__GRID_NUM_VELOC;
+		s32FracV = 0;
+	}
 
-		//the velocity is the index into our braking table
-		//and there are 4 polynomials per entry so its easy and efficent to compute our lookup position
-		u32LookupIndex = u32Veloc_ms;
-
-		//mult by 4
-		u32LookupIndex <<= 2U;
-
-		//compute the drags's
-		f32DragPow2 = (Lfloat32)u32DragForce_n;
-		f32DragPow2 *= (Lfloat32)u32DragForce_n;
-		f32DragPow3 = f32DragPow2 * (Lfloat32)u32DragForce_n;
-
-		//do the poly calc
-		f32Result = (f32A34_BrakeTable[u32LookupIndex] * f32DragPow3);
-		f32Result += (f32A34_BrakeTable[u32LookupIndex + 1U] * f32DragPow2);
-		f32Result += (f32A34_BrakeTable[u32LookupIndex + 2U] * (Lfloat32)u32DragForce_n);
-		f32Result += f32A34_BrakeTable[u32LookupIndex + 3U];
-
-		//convert to microns from meters
-		f32Result *= 1000000U;
+	if(u32Row < (C_FCU__BRAKES__GRID_NUM_VELOC - 1U))
+	{
+		//the drag column, fine steps at low drag where the gap moves fastest
+		if(u32DragForce_n < C_FCU__BRAKES__GRID_FINE_MAX_N)
+		{
+			u32Col = u32DragForce_n >> C_FCU__BRAKES__GRID_FINE_SHIFT;
+			s32FracD = (Lint32)(u32DragForce_n & (C_FCU__BRAKES__GRID_FINE_STEP - 1U));
+			s32StepD = (Lint32)C_FCU__BRAKES__GRID_FINE_STEP;
+		}
+		else
+		{
+			u32Col = u32DragForce_n - C_FCU__BRAKES__GRID_FINE_MAX_N;
+			s32FracD = (Lint32)(u32Col & (C_FCU__BRAKES__GRID_DRAG_STEP - 1U));
+			s32StepD = (Lint32)C_FCU__BRAKES__GRID_DRAG_STEP;
+			u32Col >>= C_FCU__BRAKES__GRID_DRAG_SHIFT;
+			u32Col += C_FCU__BRAKES__GRID_NUM_FINE;
+		}
 
-		//hard limiting issues here
-		if(f32Result < 0)
+		if(u32Col < (C_FCU__BRAKES__GRID_NUM_DRAG - 1U))
 		{
-			*pu32IBDistance_um = 0U;
+			//fall on
 		}
 		else
 		{
-			*pu32IBDistance_um = (Luint32)f32Result;
+			//more drag than the grid, limit to the last column
+			u32Col = C_FCU__BRAKES__GRID_NUM_DRAG - 2U;
+			s32FracD = (Lint32)C_FCU__BRAKES__GRID_DRAG_STEP;
+			s32StepD = (Lint32)C_FCU__BRAKES__GRID_DRAG_STEP;
 		}
 
+		//index of the top left
+		u32Col += u32Row * C_FCU__BRAKES__GRID_NUM_DRAG;
+
+		//interpolate along the drag on this row
+		s32Top = (Lint32)u16A34_BrakeGrid[u32Col];
+		s32Temp = (Lint32)u16A34_BrakeGrid[u32Col + 1U] - s32Top;
+		s32Top += (s32Temp * s32FracD) / s32StepD;
+
+		//and the next row
+		u32Col += C_FCU__BRAKES__GRID_NUM_DRAG;
+		s32Bottom = (Lint32)u16A34_BrakeGrid[u32Col];
+		s32Temp = (Lint32)u16A34_BrakeGrid[u32Col + 1U] - s32Bottom;
+		s32Bottom += (s32Temp * s32FracD) / s32StepD;
+
+		//then between the rows
+		s32Temp = s32Bottom - s32Top;
+		s32Top += (s32Temp * s32FracV) / (Lint32)C_FCU__BRAKES__GRID_VELOC_STEP;
+
+		//grid is all positive so this is safe
+		*pu32IBDistance_um = (Luint32)s32Top;
+
 		s16Return = 0;
 
 	}
@@ -141,8 +178,140 @@ Lint16 s16FCU_FLIGHTCTL_BRAKES__Brake_Lookup(Luint32 u32Veloc_mms, Luint32 u32Dr
 	return s16Return;
 }
 
+/***************************************************************************//**
+ * @brief
+ * The inverse of the brake lookup, what drag do we get for a gap.
+ * Each grid row is monotonic so we binary search the row, always for
+ * C_FCU__BRAKES__GRID_SEARCH_ITERATIONS so the time is the same for every call.
+ * 
+ * @param[out]		*pu32DragForce_n			The computed drag force in newtons
+ * @param[in]		u32IBDistance_um			The i-beam dist
+ * @param[in]		u32Veloc_mms				The current pod velocity in mm/sec
+ * @return			0 = success\n
+ * 					-1 = velocity out of range
+ * @st_funcMD5		62332E80D4F419CC247B14346218147E
+ * @st_funcID		LCCM655R0.FILE.051.FUNC.004
+ */
+Lint16 s16FCU_FLIGHTCTL_BRAKES__Drag_Lookup(Luint32 u32Veloc_mms, Luint32 u32IBDistance_um, Luint32 *pu32DragForce_n)
+{
+	Lint16 s16Return;
+	Luint32 u32Row;
+	Lint32 s32FracV;
+	Lint32 s32Top;
+	Lint32 s32Bottom;
 
-#endif //0
+	if(u32Veloc_mms >= C_FCU__BRAKES__GRID_VELOC_MIN_MMS)
+	{
+		u32Row = u32Veloc_mms - C_FCU__BRAKES__GRID_VELOC_MIN_MMS;
+		s32FracV = (Lint32)(u32Row & (C_FCU__BRAKES__GRID_VELOC_STEP - 1U));
+		u32Row >>= C_FCU__BRAKES__GRID_VELOC_SHIFT;
+	}
+	else
+	{
+		u32Row = C_FCU__BRAKES__GRID_NUM_VELOC;
+		s32FracV = 0;
+	}
+
+	if(u32Row < (C_FCU__BRAKES__GRID_NUM_VELOC - 1U))
+	{
+		//drag on the two rows either side
+		s32Top = (Lint32)u32FCU_FLIGHTCTL_BRAKES__Row_Drag(u32Row, u32IBDistance_um);
+		s32Bottom = (Lint32)u32FCU_FLIGHTCTL_BRAKES__Row_Drag(u32Row + 1U, u32IBDistance_um);
+
+		//between the rows
+		s32Top += ((s32Bottom - s32Top) * s32FracV) / (Lint32)C_FCU__BRAKES__GRID_VELOC_STEP;
+
+		*pu32DragForce_n = (Luint32)s32Top;
+		s16Return = 0;
+	}
+	else
+	{
+		//out of range
+		*pu32DragForce_n = 0U;
+		s16Return = -1;
+	}
+
+	return s16Return;
+}
+
+/***************************************************************************//**
+ * @brief
+ * Find the drag on one velocity row of the grid for a gap
+ * 
+ * @param[in]		u32IBDistance_um			The i-beam dist
+ * @param[in]		u32RowIndex					Velocity row
+ * @st_funcMD5		F0753E89C086127BDCC1D1ECE01738C1
+ * @st_funcID		LCCM655R0.FILE.051.FUNC.005
+ */
+static Luint32 u32FCU_FLIGHTCTL_BRAKES__Row_Drag(Luint32 u32RowIndex, Luint32 u32IBDistance_um)
+{
+	Luint32 u32Base;
+	Luint32 u32Low;
+	Luint32 u32High;
+	Luint32 u32Mid;
+	Luint32 u32Counter;
+	Luint32 u32Span;
+	Luint32 u32Shift;
+	Luint32 u32Return;
+
+	u32Base = u32RowIndex * C_FCU__BRAKES__GRID_NUM_DRAG;
+
+	//the gap falls as the drag goes up, find the last column with a bigger gap than we have
+	//low always has a bigger gap, high never does
+	u32Low = 0U;
+	u32High = C_FCU__BRAKES__GRID_NUM_DRAG;
+	for(u32Counter = 0U; u32Counter < C_FCU__BRAKES__GRID_SEARCH_ITERATIONS; u32Counter++)
+	{
+		u32Mid = (u32Low + u32High) >> 1U;
+		if((Luint32)u16A34_BrakeGrid[u32Base + u32Mid] > u32IBDistance_um)
+		{
+			u32Low = u32Mid;
+		}
+		else
+		{
+			u32High = u32Mid;
+		}
+	}
+
+	if((Luint32)u16A34_BrakeGrid[u32Base] <= u32IBDistance_um)
+	{
+		//wider than the grid, no drag
+		u32Return = 0U;
+	}
+	else if(u32Low >= (C_FCU__BRAKES__GRID_NUM_DRAG - 1U))
+	{
+		//tighter than the grid, max drag
+		u32Return = C_FCU__BRAKES__GRID_FINE_MAX_N + ((C_FCU__BRAKES__GRID_NUM_DRAG - 1U - C_FCU__BRAKES__GRID_NUM_FINE) << C_FCU__BRAKES__GRID_DRAG_SHIFT);
+	}
+	else
+	{
+		//drag at the low column and the step to the next
+		if(u32Low < C_FCU__BRAKES__GRID_NUM_FINE)
+		{
+			u32Return = u32Low << C_FCU__BRAKES__GRID_FINE_SHIFT;
+			u32Shift = C_FCU__BRAKES__GRID_FINE_SHIFT;
+		}
+		else
+		{
+			u32Return = C_FCU__BRAKES__GRID_FINE_MAX_N + ((u32Low - C_FCU__BRAKES__GRID_NUM_FINE) << C_FCU__BRAKES__GRID_DRAG_SHIFT);
+			u32Shift = C_FCU__BRAKES__GRID_DRAG_SHIFT;
+		}
+
+		//interpolate between low and the next column
+		u32Span = (Luint32)u16A34_BrakeGrid[u32Base + u32Low] - (Luint32)u16A34_BrakeGrid[u32Base + u32Low + 1U];
+		u32Return += (((Luint32)u16A34_BrakeGrid[u32Base + u32Low] - u32IBDistance_um) << u32Shift) / u32Span;
+	}
+
+	return u32Return;
+}
+
+//safetys
+#if (1U << C_FCU__BRAKES__GRID_SEARCH_ITERATIONS) < C_FCU__BRAKES__GRID_NUM_DRAG
+	#error
+#endif
+#if C_FCU__BRAKES__GRID_NUM_FINE >= C_FCU__BRAKES__GRID_NUM_DRAG
+	#error
+#endif
 
 #endif //C_LOCALDEF__LCCM655__ENABLE_FCTL_BRAKE_CONTROL
 #ifndef C_LOCALDEF__LCCM655__ENABLE_FCTL_BRAKE_CONTROL
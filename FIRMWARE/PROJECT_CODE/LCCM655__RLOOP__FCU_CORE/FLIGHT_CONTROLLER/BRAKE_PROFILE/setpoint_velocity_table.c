@@ -1,25 +1,38 @@
 #include "../../fcu_core.h"
-#if 0
-// The index for this table is the measured distance (probably scaled by some value)
-// TODO: add real values, these are examples
+#if C_LOCALDEF__LCCM655__ENABLE_THIS_MODULE == 1U
+#if C_LOCALDEF__LCCM655__ENABLE_FLIGHT_CONTROL == 1U
+#if C_LOCALDEF__LCCM655__ENABLE_BRAKEPID == 1U
+// Setpoint velocity in m/s, the index is the track position in C_FCU__BRAKEPID__SETPOINT_STEP_MM steps
+// v = sqrt(2 x 5m/s/s x (1200m - position)), stop at 1200m with 5m/s/s of braking which
+// leaves margin below the ~7m/s/s the brakes can do at the min gap.
 #ifndef WIN32
 const Lfloat32 f32A34_SetPointVelocityTable[] = {
 #else
 Lfloat32 f32A34_SetPointVelocityTable[] = {
 #endif
-1.1955,
-1.3908,
-1.5861,
-1.7812,
-1.9763,
-2.1712,
-2.3661,
-2.5609,
-2.7556,
-2.9503,
-3.1449,
-3.3394
+109.5445, 109.0871, 108.6278, 108.1665, 107.7033, 107.2381, 106.7708, 106.3015,
+105.8301, 105.3565, 104.8809, 104.4031, 103.9230, 103.4408, 102.9563, 102.4695,
+101.9804, 101.4889, 100.9950, 100.4988, 100.0000, 99.4987, 98.9949, 98.4886,
+97.9796, 97.4679, 96.9536, 96.4365, 95.9166, 95.3939, 94.8683, 94.3398,
+93.8083, 93.2738, 92.7362, 92.1954, 91.6515, 91.1043, 90.5539, 90.0000,
+89.4427, 88.8819, 88.3176, 87.7496, 87.1780, 86.6025, 86.0233, 85.4400,
+84.8528, 84.2615, 83.6660, 83.0662, 82.4621, 81.8535, 81.2404, 80.6226,
+80.0000, 79.3725, 78.7401, 78.1025, 77.4597, 76.8115, 76.1577, 75.4983,
+74.8331, 74.1620, 73.4847, 72.8011, 72.1110, 71.4143, 70.7107, 70.0000,
+69.2820, 68.5565, 67.8233, 67.0820, 66.3325, 65.5744, 64.8074, 64.0312,
+63.2456, 62.4500, 61.6441, 60.8276, 60.0000, 59.1608, 58.3095, 57.4456,
+56.5685, 55.6776, 54.7723, 53.8516, 52.9150, 51.9615, 50.9902, 50.0000,
+48.9898, 47.9583, 46.9042, 45.8258, 44.7214, 43.5890, 42.4264, 41.2311,
+40.0000, 38.7298, 37.4166, 36.0555, 34.6410, 33.1662, 31.6228, 30.0000,
+28.2843, 26.4575, 24.4949, 22.3607, 20.0000, 17.3205, 14.1421, 10.0000,
+0.0000, 0.0000, 0.0000, 0.0000, 0.0000, 0.0000, 0.0000, 0.0000,
+0.0000
 };
 
+#if C_FCU__BRAKEPID__SETPOINT_NUM != 129U
+	#error
+#endif
 
-#endif //0
+#endif //C_LOCALDEF__LCCM655__ENABLE_BRAKEPID
+#endif //C_LOCALDEF__LCCM655__ENABLE_FLIGHT_CONTROL
+#endif //C_LOCALDEF__LCCM655__ENABLE_THIS_MODULE
@@ -31,7 +31,7 @@
 		// are commonly seen with floating point trig.
 
 	 	// trig functions used in this code (search "trig" to find all cases)
-	 		// f32NUMERICAL_Atan()
+	 		// atanf()
 	 		// acos() (pi/2 - asin())
 				// C_NUMERICAL__PI/2 - f32NUMERICAL_Asine
 	 		// f32NUMERICAL_Cosine()
@@ -43,6 +43,8 @@
 #if C_LOCALDEF__LCCM655__ENABLE_FLIGHT_CONTROL == 1U
 #if C_LOCALDEF__LCCM655__ENABLE_FCTL_ORIENTATION == 1U
 
+#include <math.h>
+
 //the structure
 extern struct _strFCU sFCU;
 
@@ -52,9 +54,12 @@ static void vFCU_FLIGHTCTL_LASERORIENT__CalcPitch(void);
 static void vFCU_FLIGHTCTL_LASERORIENT__CalcTwistRoll(void);
 static void vFCU_FLIGHTCTL_LASERORIENT__CalcTwistPitch(void);
 static Lfloat32 f32FCU_FLIGHTCTL_LASERORIENT__PointToPlaneDistance(Lfloat32 f32Position[3]);
-static void vFCU_FLIGHTCTL_LASERORIENT__CalculateGroundPlane(Luint8 u8A, Luint8 u8B, Luint8 u8C, Lfloat32 *pf32PlaneEqnCoeffs);
-static void vFCU_FLIGHTCTL_LASERORIENT__CalcYaw(void);
-static void vFCU_FLIGHTCTL_LASERORIENT__CalcLateral(void);
+static void vFCU_FLIGHTCTL_LASERORIENT__Build_PseudoInv(Luint8 u8Mask);
+static void vFCU_FLIGHTCTL_LASERORIENT__FitGroundPlane(Luint8 u8Mask, Lfloat32 *pf32PlaneEqnCoeffs);
+static Lfloat32 f32FCU_FLIGHTCTL_LASERORIENT__Get_GroundZ(Luint8 u8Laser);
+static Lfloat32 f32FCU_FLIGHTCTL_LASERORIENT__PlaneZ(const Lfloat32 *pf32PlaneEqnCoeffs, Luint8 u8Laser);
+static void vFCU_FLIGHTCTL_LASERORIENT__Set_Position(Lfloat32 *pf32Position, Lfloat32 f32X, Lfloat32 f32Y, Lfloat32 f32Z);
+static void vFCU_FLIGHTCTL_LASERORIENT__CalcYaw_and_Lateral(void);
 
 
 
@@ -66,6 +71,8 @@ static void vFCU_FLIGHTCTL_LASERORIENT__CalcLateral(void);
  */
 void vFCU_FLIGHTCTL_LASERORIENT__Init(void)
 {
+	Luint8 u8Counter;
+
 	// TODO: All positions of components need their positions measured and assigned here.
 		// blocked by installation of the components
 	// TODO: This data should be read in from EEPROM so a rebuild is not necessary to incorporate changes
@@ -73,36 +80,36 @@ void vFCU_FLIGHTCTL_LASERORIENT__Init(void)
 	//Ground Facing Laser Positions
 	 // Laser.f32Position[LASER_ORIENT__Z] is the reading when pod is sitting flat
   	   // (historic def: For the laser positions Z should be the reading when the HDK is sitting flat on the 4 hover engines)
-	sFCU.sFlightControl.sOrient.sGroundLasers[0].f32Position[3] = {888, 888, 888}; // ground laser 1 position {x,y,z}
-	sFCU.sFlightControl.sOrient.sGroundLasers[1].f32Position[3] = {-888, 888, 888}; // ground laser 2 position {x,y,z}
-	sFCU.sFlightControl.sOrient.sGroundLasers[2].f32Position[3] = {888, -888, 888}; // ground laser 3 position {x,y,z}
-	sFCU.sFlightControl.sOrient.sGroundLasers[3].f32Position[3] = {888,888,888}; // ground laser 4 position {x,y,z}
+	vFCU_FLIGHTCTL_LASERORIENT__Set_Position(&sFCU.sFlightControl.sOrient.sGroundLasers[0].f32Position[0], 888, 888, 888); // ground laser 1 position {x,y,z}
+	vFCU_FLIGHTCTL_LASERORIENT__Set_Position(&sFCU.sFlightControl.sOrient.sGroundLasers[1].f32Position[0], -888, 888, 888); // ground laser 2 position {x,y,z}
+	vFCU_FLIGHTCTL_LASERORIENT__Set_Position(&sFCU.sFlightControl.sOrient.sGroundLasers[2].f32Position[0], 888, -888, 888); // ground laser 3 position {x,y,z}
+	vFCU_FLIGHTCTL_LASERORIENT__Set_Position(&sFCU.sFlightControl.sOrient.sGroundLasers[3].f32Position[0], 888, 888, 888); // ground laser 4 position {x,y,z}
 
 	// I-Beam laser positions
 
 	//todo: following laser installation, need to measure the distance between the ibeam lasers and the pod centerline (mount should be orthogonal)
 	//todo: change to a 2 dim array, but for now i'll leave as is to not get biebered
 
-	sFCU.sFlightControl.sOrient.sBeamLasers[0].f32Position[3] = {888, 888, 0};  // i-beam laser 1 position {x,y,z} //todo: first index of this array should have the x separation of the lasers - to be measured on pod
-	sFCU.sFlightControl.sOrient.sBeamLasers[1].f32Position[3] = {0, 888, 0};  // i-beam laser 2 position {x,y,z}
+	vFCU_FLIGHTCTL_LASERORIENT__Set_Position(&sFCU.sFlightControl.sOrient.sBeamLasers[0].f32Position[0], 888, 888, 0);  // i-beam laser 1 position {x,y,z} //todo: first index of this array should have the x separation of the lasers - to be measured on pod
+	vFCU_FLIGHTCTL_LASERORIENT__Set_Position(&sFCU.sFlightControl.sOrient.sBeamLasers[1].f32Position[0], 0, 888, 0);  // i-beam laser 2 position {x,y,z}
 
 	//Hover Engine Positions {x,y,z} (from top view)
-	sFCU.sFlightControl.sOrient.sHoverEngines[0].f32Position[3] = {888, 888, 888}; // Forward Top Left {x,y,z}
-	sFCU.sFlightControl.sOrient.sHoverEngines[1].f32Position[3] = {888, 888, 888}; // Forward Top Right {x,y,z}
-	sFCU.sFlightControl.sOrient.sHoverEngines[2].f32Position[3] = {888, 888, 888}; // Forward Bottom Right {x,y,z}
-	sFCU.sFlightControl.sOrient.sHoverEngines[3].f32Position[3] = {888, 888, 888}; // Forward Bottom Left {x,y,z}
+	vFCU_FLIGHTCTL_LASERORIENT__Set_Position(&sFCU.sFlightControl.sOrient.sHoverEngines[0].f32Position[0], 888, 888, 888); // Forward Top Left {x,y,z}
+	vFCU_FLIGHTCTL_LASERORIENT__Set_Position(&sFCU.sFlightControl.sOrient.sHoverEngines[1].f32Position[0], 888, 888, 888); // Forward Top Right {x,y,z}
+	vFCU_FLIGHTCTL_LASERORIENT__Set_Position(&sFCU.sFlightControl.sOrient.sHoverEngines[2].f32Position[0], 888, 888, 888); // Forward Bottom Right {x,y,z}
+	vFCU_FLIGHTCTL_LASERORIENT__Set_Position(&sFCU.sFlightControl.sOrient.sHoverEngines[3].f32Position[0], 888, 888, 888); // Forward Bottom Left {x,y,z}
 
-	sFCU.sFlightControl.sOrient.sHoverEngines[4].f32Position[3] = {888, 888, 888}; // Rear Top Left {x,y,z}
-	sFCU.sFlightControl.sOrient.sHoverEngines[5].f32Position[3] = {888, 888, 888}; // Rear Top Right {x,y,z}
-	sFCU.sFlightControl.sOrient.sHoverEngines[6].f32Position[3] = {888, 888, 888}; // Rear Bottom Right {x,y,z}
-	sFCU.sFlightControl.sOrient.sHoverEngines[7].f32Position[3] = {888, 888, 888}; // Rear Bottom Left {x,y,z}
+	vFCU_FLIGHTCTL_LASERORIENT__Set_Position(&sFCU.sFlightControl.sOrient.sHoverEngines[4].f32Position[0], 888, 888, 888); // Rear Top Left {x,y,z}
+	vFCU_FLIGHTCTL_LASERORIENT__Set_Position(&sFCU.sFlightControl.sOrient.sHoverEngines[5].f32Position[0], 888, 888, 888); // Rear Top Right {x,y,z}
+	vFCU_FLIGHTCTL_LASERORIENT__Set_Position(&sFCU.sFlightControl.sOrient.sHoverEngines[6].f32Position[0], 888, 888, 888); // Rear Bottom Right {x,y,z}
+	vFCU_FLIGHTCTL_LASERORIENT__Set_Position(&sFCU.sFlightControl.sOrient.sHoverEngines[7].f32Position[0], 888, 888, 888); // Rear Bottom Left {x,y,z}
 
-	Luint8 u8Counter = 0U;
 	// Init measurements and error states to zero
 	for(u8Counter = 0U; u8Counter < C_FCU__NUM_LASERS_GROUND; u8Counter++)
 	{
 		sFCU.sFlightControl.sOrient.sGroundLasers[u8Counter].f32Measurement = 0.0F;
 		sFCU.sFlightControl.sOrient.sGroundLasers[u8Counter].u8Error = 0U;
+		sFCU.sFlightControl.sOrient.sLSQ.f32Residual[u8Counter] = 0.0F;
 	} 
 
 	for(u8Counter = 0U; u8Counter < C_FCU__NUM_LASERS_IBEAM; u8Counter++)
@@ -119,14 +126,60 @@ void vFCU_FLIGHTCTL_LASERORIENT__Init(void)
 	sFCU.sFlightControl.sOrient.s16TwistPitch = 0;
 	sFCU.sFlightControl.sOrient.s16TwistRoll = 0;
 
-	sFCU.sFlightControl.sOrient.f32PlaneCoeffs[4] = {0,0,0,0}; // ground plane coefficients
-	sFCU.sFlightControl.sOrient.f32TwistPlaneCoeffs[4] = {0,0,0,0}; // 2nd ground plane coefficients; compare to latter to get twist parameters
+	for(u8Counter = 0U; u8Counter < 4U; u8Counter++)
+	{
+		sFCU.sFlightControl.sOrient.f32PlaneCoeffs[u8Counter] = 0.0F; // ground plane coefficients
+		sFCU.sFlightControl.sOrient.f32TwistPlaneCoeffs[u8Counter] = 0.0F; // 2nd ground plane coefficients; compare to latter to get twist parameters
+	}
+
+	//the laser geometry is fixed, so is the least squares solution for each set of working lasers
+	for(u8Counter = 0U; u8Counter < C_FCU__LASER_ORIENT__NUM_MASKS; u8Counter++)
+	{
+		vFCU_FLIGHTCTL_LASERORIENT__Build_PseudoInv(u8Counter);
+	}
+
+	//no fit yet, mask 0 is never valid
+	sFCU.sFlightControl.sOrient.sLSQ.u8Mask = 0U;
+	sFCU.sFlightControl.sOrient.sLSQ.u32OutlierCount = 0U;
 
 	sFCU.sFlightControl.sOrient.eState = LASER_ORIENTATION_STATE__INIT;
 
 }
 
 
+/***************************************************************************//**
+ * @brief
+ * Move a ground laser once its mount has been measured, the least squares
+ * solutions are rebuilt for the new geometry.
+ * 
+ * @param[in]		f32Z					Reading when the pod is sitting flat
+ * @param[in]		f32Y					Position across the pod
+ * @param[in]		f32X					Position along the pod
+ * @param[in]		u8Laser					Ground laser index
+ */
+void vFCU_FLIGHTCTL_LASERORIENT__Set_GroundLaser_Position(Luint8 u8Laser, Lfloat32 f32X, Lfloat32 f32Y, Lfloat32 f32Z)
+{
+	Luint8 u8Counter;
+
+	if(u8Laser < C_FCU__NUM_LASERS_GROUND)
+	{
+		vFCU_FLIGHTCTL_LASERORIENT__Set_Position(&sFCU.sFlightControl.sOrient.sGroundLasers[u8Laser].f32Position[0], f32X, f32Y, f32Z);
+
+		for(u8Counter = 0U; u8Counter < C_FCU__LASER_ORIENT__NUM_MASKS; u8Counter++)
+		{
+			vFCU_FLIGHTCTL_LASERORIENT__Build_PseudoInv(u8Counter);
+		}
+
+		//the last plane was fitted with the old geometry
+		sFCU.sFlightControl.sOrient.sLSQ.u8Mask = 0U;
+	}
+	else
+	{
+		//error
+	}
+}
+
+
 /***************************************************************************//**
  * @brief
  * Process the calculation of pod orientation and engine heights.
@@ -134,9 +187,14 @@ void vFCU_FLIGHTCTL_LASERORIENT__Init(void)
  */
 void vFCU_FLIGHTCTL_LASERORIENT__Process(void)
 {
-	Luint8 u8OperationalLasers[C_FCU__NUM_LASERS_GROUND];
 	Luint8 u8OperationalCount = 0U;
 	Luint8 u8Counter;
+	Luint8 u8Mask;
+	Luint8 u8Without;
+	Luint8 u8Jumped;
+	Luint8 u8JumpCount;
+	Lfloat32 f32Temp;
+	Lfloat32 f32Without[4];
 
 
 	//handle the state machine
@@ -156,46 +214,113 @@ void vFCU_FLIGHTCTL_LASERORIENT__Process(void)
 
 			for(u8Counter = 0U; u8Counter < C_FCU__NUM_LASERS_GROUND; u8Counter++)
 			{
-				sFCU.sFlightControl.sOrient.sGroundLasers[u8Counter].f32Measurement = f32FCU_LASEROPTO__Get_Distance(u8Counter);
-				sFCU.sFlightControl.sOrient.sGroundLasers[u8Counter].u8Error = u8FCU_LASEROPTO__Get_Error(u8Counter);
+				sFCU.sFlightControl.sOrient.sGroundLasers[u8Counter].f32Measurement = f32FCU_LASEROPTO__Get_Distance((E_FCU__LASER_OPTO__INDEX_T)u8Counter);
+				sFCU.sFlightControl.sOrient.sGroundLasers[u8Counter].u8Error = u8FCU_LASEROPTO__Get_Error((E_FCU__LASER_OPTO__INDEX_T)u8Counter);
 			} 
 
 			for(u8Counter = 0U; u8Counter < C_FCU__NUM_LASERS_IBEAM; u8Counter++)
 			{
-				sFCU.sFlightControl.sOrient.sBeamLasers[u8Counter].f32Measurement = f32FCU_LASEROPTO__Get_Distance(u8Counter + C_FCU__NUM_LASERS_GROUND); // kinda hacky; consistency in laser/HE numbering should help ground this
-				sFCU.sFlightControl.sOrient.sBeamLasers[u8Counter].u8Error = u8FCU_LASEROPTO__Get_Error(u8Counter + C_FCU__NUM_LASERS_GROUND);
+				sFCU.sFlightControl.sOrient.sBeamLasers[u8Counter].f32Measurement = f32FCU_LASEROPTO__Get_Distance((E_FCU__LASER_OPTO__INDEX_T)(u8Counter + C_FCU__NUM_LASERS_GROUND)); // kinda hacky; consistency in laser/HE numbering should help ground this
+				sFCU.sFlightControl.sOrient.sBeamLasers[u8Counter].u8Error = u8FCU_LASEROPTO__Get_Error((E_FCU__LASER_OPTO__INDEX_T)(u8Counter + C_FCU__NUM_LASERS_GROUND));
 			} 
 
 			sFCU.sFlightControl.sOrient.eState = LASER_ORIENTATION_STATE__RECALCULATE_PITCH_ROLL_TWIST;
 			break;
 
 		case LASER_ORIENTATION_STATE__RECALCULATE_PITCH_ROLL_TWIST:
-			/** count which lasers are not in the error state and append them to array */
-
+			/** build the mask of lasers that are not in the error state */
+			u8Mask = 0U;
 			for(u8Counter = 0U; u8Counter < C_FCU__NUM_LASERS_GROUND; u8Counter++)
 			{
 				if(sFCU.sFlightControl.sOrient.sGroundLasers[u8Counter].u8Error != 1U)
 				{
-					// Laser works, store its index in the array
-					u8OperationalLasers[u8OperationalCount] = u8Counter; 
-					// increment count of operational lasers
-					u8OperationalCount += 1U; 
+					// Laser works, fit with it
+					u8Mask |= (Luint8)(1U << u8Counter);
 				}
 				else
 				{
-					// bad laser; dont append its index to array
+					// bad laser; leave it out of the fit
 				}
 			}
 
-			/** Calculate as many of the pods orientation parameters as possible based on the number of operational lasers */
-			if(u8OperationalCount == 4U)
+			/** A single laser jumping off the last plane is an outlier, all of them moving is the pod */
+			u8Jumped = 0U;
+			u8JumpCount = 0U;
+			if(sFCU.sFlightControl.sOrient.sLSQ.u8Valid[sFCU.sFlightControl.sOrient.sLSQ.u8Mask] == 1U)
 			{
-				// calculate pitch, roll, and twist of the pod
-				// 1st triplet of ground lasers
-			    vFCU_FLIGHTCTL_LASERORIENT__CalculateGroundPlane(0U, 1U, 2U, &sFCU.sFlightControl.sOrient.f32PlaneCoeffs[0]);
+				for(u8Counter = 0U; u8Counter < C_FCU__NUM_LASERS_GROUND; u8Counter++)
+				{
+					if((u8Mask & (Luint8)(1U << u8Counter)) != 0U)
+					{
+						f32Temp = f32FCU_FLIGHTCTL_LASERORIENT__Get_GroundZ(u8Counter) - f32FCU_FLIGHTCTL_LASERORIENT__PlaneZ(&sFCU.sFlightControl.sOrient.f32PlaneCoeffs[0], u8Counter);
+						if(f32SIL3_NUM_FLOAT__ABS(f32Temp) > C_FCU__LASER_ORIENT__OUTLIER_MM)
+						{
+							u8Jumped = u8Counter;
+							u8JumpCount++;
+						}
+						else
+						{
+							//agrees with the last plane
+						}
+					}
+					else
+					{
+						//not in the fit
+					}
+				}
 
-			    // 2nd triplet of ground lasers
-			    vFCU_FLIGHTCTL_LASERORIENT__CalculateGroundPlane(1U, 2U, 3U, &sFCU.sFlightControl.sOrient.f32TwistPlaneCoeffs[0]);
+				if(u8JumpCount == 1U)
+				{
+					u8Without = u8Mask & (Luint8)~(1U << u8Jumped);
+					if(sFCU.sFlightControl.sOrient.sLSQ.u8Valid[u8Without] == 1U)
+					{
+						//the last plane can be stale, only reject the laser if it also
+						//disagrees with the plane through the others right now
+						vFCU_FLIGHTCTL_LASERORIENT__FitGroundPlane(u8Without, &f32Without[0]);
+						f32Temp = f32FCU_FLIGHTCTL_LASERORIENT__Get_GroundZ(u8Jumped) - f32FCU_FLIGHTCTL_LASERORIENT__PlaneZ(&f32Without[0], u8Jumped);
+						if(f32SIL3_NUM_FLOAT__ABS(f32Temp) > C_FCU__LASER_ORIENT__OUTLIER_MM)
+						{
+							u8Mask = u8Without;
+							sFCU.sFlightControl.sOrient.sLSQ.u32OutlierCount++;
+						}
+						else
+						{
+							//the pod moved, the laser agrees with the rest
+						}
+					}
+					else
+					{
+						//can't fit without it, keep it
+					}
+				}
+				else
+				{
+					//no outlier, or the whole pod has moved
+				}
+			}
+			else
+			{
+				//no previous plane to check against
+			}
+
+			/** Calculate as many of the pods orientation parameters as possible based on the lasers we have */
+			if(sFCU.sFlightControl.sOrient.sLSQ.u8Valid[u8Mask] == 1U)
+			{
+				// calculate pitch and roll from the best fit through every good laser
+				vFCU_FLIGHTCTL_LASERORIENT__FitGroundPlane(u8Mask, &sFCU.sFlightControl.sOrient.f32PlaneCoeffs[0]);
+				sFCU.sFlightControl.sOrient.sLSQ.u8Mask = u8Mask;
+
+				for(u8Counter = 0U; u8Counter < C_FCU__NUM_LASERS_GROUND; u8Counter++)
+				{
+					if((u8Mask & (Luint8)(1U << u8Counter)) != 0U)
+					{
+						sFCU.sFlightControl.sOrient.sLSQ.f32Residual[u8Counter] = f32FCU_FLIGHTCTL_LASERORIENT__Get_GroundZ(u8Counter) - f32FCU_FLIGHTCTL_LASERORIENT__PlaneZ(&sFCU.sFlightControl.sOrient.f32PlaneCoeffs[0], u8Counter);
+					}
+					else
+					{
+						sFCU.sFlightControl.sOrient.sLSQ.f32Residual[u8Counter] = 0.0F;
+					}
+				}
 
 			    for(u8Counter = 0U; u8Counter < C_FCU__NUM_HOVER_ENGINES; u8Counter++)
 			    {
@@ -206,31 +331,24 @@ void vFCU_FLIGHTCTL_LASERORIENT__Process(void)
 				vFCU_FLIGHTCTL_LASERORIENT__CalcRoll();
 				vFCU_FLIGHTCTL_LASERORIENT__CalcPitch();
 
-				vFCU_FLIGHTCTL_LASERORIENT__CalcTwistRoll();
-				vFCU_FLIGHTCTL_LASERORIENT__CalcTwistPitch();
-			}
-			else if(u8OperationalCount == 3U)
-			{ 
-				// calculate pitch and roll. cannot calculate twist.
-			    vFCU_FLIGHTCTL_LASERORIENT__CalculateGroundPlane(u8OperationalLasers[0], u8OperationalLasers[1], u8OperationalLasers[2], &sFCU.sFlightControl.sOrient.f32PlaneCoeffs[0]);
+				// twist needs every laser in the fit
+				if((u8Mask == (Luint8)(C_FCU__LASER_ORIENT__NUM_MASKS - 1U)) && (sFCU.sFlightControl.sOrient.sLSQ.u8Valid[0x0EU] == 1U))
+				{
+					// 2nd triplet of ground lasers (1,2,3) against the full fit
+					vFCU_FLIGHTCTL_LASERORIENT__FitGroundPlane(0x0EU, &sFCU.sFlightControl.sOrient.f32TwistPlaneCoeffs[0]);
 
-			    for(u8Counter = 0U; u8Counter < C_FCU__NUM_HOVER_ENGINES; u8Counter++)
-			    {
-			    	// Calc the position of each hover engine
-					sFCU.sFlightControl.sOrient.sHoverEngines[u8Counter].f32Measurement = f32FCU_FLIGHTCTL_LASERORIENT__PointToPlaneDistance(&sFCU.sFlightControl.sOrient.sHoverEngines[u8Counter].f32Position[0]);
+					vFCU_FLIGHTCTL_LASERORIENT__CalcTwistRoll();
+					vFCU_FLIGHTCTL_LASERORIENT__CalcTwistPitch();
+				}
+				else
+				{
+					//cannot calculate twist.
 				}
-
-				vFCU_FLIGHTCTL_LASERORIENT__CalcPitch();
-				vFCU_FLIGHTCTL_LASERORIENT__CalcRoll();
-			}
-			else if(u8OperationalCount == 2U)
-			{
-				// there are 2 operable lasers; can't compute any of the orientation parameters directly, but can infer information from what we have.
-				// TODO write code to infer orientation parameters
 			}
 			else
 			{
-				// there is 1 or fewer operable lasers; can't compute twist/pitch/roll/HE heights.
+				// fewer than 3 usable lasers; can't compute any of the orientation parameters directly, but can infer information from what we have.
+				// TODO write code to infer orientation parameters
 			}
 
 			sFCU.sFlightControl.sOrient.eState = LASER_ORIENTATION_STATE__RECALCULATE_YAW_AND_LATERAL;
@@ -239,21 +357,18 @@ void vFCU_FLIGHTCTL_LASERORIENT__Process(void)
 		case LASER_ORIENTATION_STATE__RECALCULATE_YAW_AND_LATERAL:
 
 			/** count which lasers are not in the error state and append them to array. */
-			Luint8 u8OperationalCount = 0U;
-			Luint8 u8OperationalLasers[C_FCU__NUM_LASERS_IBEAM];
+			u8OperationalCount = 0U;
 
-			for(Luint8 u8Counter = 0U; u8Counter < C_FCU__NUM_LASERS_IBEAM; u8Counter++)
+			for(u8Counter = 0U; u8Counter < C_FCU__NUM_LASERS_IBEAM; u8Counter++)
 			{
 				if(sFCU.sFlightControl.sOrient.sBeamLasers[u8Counter].u8Error != 1U)
 				{
-					// Laser works, store its index in the array
-					u8OperationalLasers[u8OperationalCount] = u8Counter; 
-					// increment count of operational lasers
+					// Laser works, increment count of operational lasers
 					u8OperationalCount += 1U; 
 				}
 				else
 				{
-					// bad laser; dont append its index to array
+					// bad laser; dont count it
 				}
 			}
 
@@ -346,49 +461,162 @@ void vFCU_FLIGHTCTL_LASERORIENT__CalcTwistPitch(void)
 }
 
 
-/** Calculate the ground plane given three points */
+/** Build the least squares pseudo-inverse for one set of ground lasers */
+// fits z = ax + by + c, [a b c] = (AtA)^-1.At.z with A rows of [x y 1]
+void vFCU_FLIGHTCTL_LASERORIENT__Build_PseudoInv(Luint8 u8Mask)
+{
+	Lfloat32 f32A[C_FCU__NUM_LASERS_GROUND * 3U];
+	Lfloat32 f32At[3U * C_FCU__NUM_LASERS_GROUND];
+	Lfloat32 f32AtA[9];
+	Lfloat32 f32Inv[9];
+	Lfloat32 f32P[3U * C_FCU__NUM_LASERS_GROUND];
+	Luint8 u8Index[C_FCU__NUM_LASERS_GROUND];
+	Luint8 u8Rows;
+	Luint8 u8Counter;
+	Luint8 u8Col;
+	Lfloat32 f32MeanX, f32MeanY;
+	Lfloat32 f32Sxx, f32Syy, f32Sxy;
+	Lfloat32 f32DX, f32DY;
+
+	sFCU.sFlightControl.sOrient.sLSQ.u8Valid[u8Mask] = 0U;
+	for(u8Counter = 0U; u8Counter < (3U * C_FCU__NUM_LASERS_GROUND); u8Counter++)
+	{
+		sFCU.sFlightControl.sOrient.sLSQ.f32PseudoInv[u8Mask][u8Counter] = 0.0F;
+	}
+
+	//one row per laser in the mask
+	u8Rows = 0U;
+	f32MeanX = 0.0F;
+	f32MeanY = 0.0F;
+	for(u8Counter = 0U; u8Counter < C_FCU__NUM_LASERS_GROUND; u8Counter++)
+	{
+		if((u8Mask & (Luint8)(1U << u8Counter)) != 0U)
+		{
+			f32A[(u8Rows * 3U) + 0U] = sFCU.sFlightControl.sOrient.sGroundLasers[u8Counter].f32Position[LASER_ORIENT__X];
+			f32A[(u8Rows * 3U) + 1U] = sFCU.sFlightControl.sOrient.sGroundLasers[u8Counter].f32Position[LASER_ORIENT__Y];
+			f32A[(u8Rows * 3U) + 2U] = 1.0F;
+			f32MeanX += f32A[(u8Rows * 3U) + 0U];
+			f32MeanY += f32A[(u8Rows * 3U) + 1U];
+			u8Index[u8Rows] = u8Counter;
+			u8Rows++;
+		}
+		else
+		{
+			//not fitted
+		}
+	}
+
+	if(u8Rows >= 3U)
+	{
+		//AtA is only singular when the lasers are collinear, test the spread
+		//of the lasers about their centre so the test doesn't care about units
+		f32MeanX /= (Lfloat32)u8Rows;
+		f32MeanY /= (Lfloat32)u8Rows;
+		f32Sxx = 0.0F;
+		f32Syy = 0.0F;
+		f32Sxy = 0.0F;
+		for(u8Counter = 0U; u8Counter < u8Rows; u8Counter++)
+		{
+			f32DX = f32A[(u8Counter * 3U) + 0U] - f32MeanX;
+			f32DY = f32A[(u8Counter * 3U) + 1U] - f32MeanY;
+			f32Sxx += f32DX * f32DX;
+			f32Syy += f32DY * f32DY;
+			f32Sxy += f32DX * f32DY;
+
+			//transpose while we are here
+			f32At[(0U * u8Rows) + u8Counter] = f32A[(u8Counter * 3U) + 0U];
+			f32At[(1U * u8Rows) + u8Counter] = f32A[(u8Counter * 3U) + 1U];
+			f32At[(2U * u8Rows) + u8Counter] = f32A[(u8Counter * 3U) + 2U];
+		}
+
+		if(((f32Sxx * f32Syy) - (f32Sxy * f32Sxy)) > (0.001F * (f32Sxx + f32Syy) * (f32Sxx + f32Syy)))
+		{
+			vNUMERICAL_MATRIX__Mult(3U, u8Rows, 3U, &f32AtA[0], &f32At[0], &f32A[0]);
+			vNUMERICAL_MATRIX__Inverse_3X3(&f32Inv[0], &f32AtA[0]);
+			vNUMERICAL_MATRIX__Mult(3U, 3U, u8Rows, &f32P[0], &f32Inv[0], &f32At[0]);
+
+			//spread the columns back out to laser index
+			for(u8Counter = 0U; u8Counter < 3U; u8Counter++)
+			{
+				for(u8Col = 0U; u8Col < u8Rows; u8Col++)
+				{
+					sFCU.sFlightControl.sOrient.sLSQ.f32PseudoInv[u8Mask][(u8Counter * C_FCU__NUM_LASERS_GROUND) + u8Index[u8Col]] = f32P[(u8Counter * u8Rows) + u8Col];
+				}
+			}
+
+			sFCU.sFlightControl.sOrient.sLSQ.u8Valid[u8Mask] = 1U;
+		}
+		else
+		{
+			//collinear, no plane from these
+		}
+	}
+	else
+	{
+		//need 3 lasers for a plane
+	}
+
+}
+
+
+/** Fit the ground plane through the lasers in the mask */
 // uses plane eqn: Ax + By + Cz + D = 0
-void vFCU_FLIGHTCTL_LASERORIENT__CalculateGroundPlane(Luint8 u8A, Luint8 u8B, Luint8 u8C, Lfloat32 *pf32PlaneEqnCoeffs)
+void vFCU_FLIGHTCTL_LASERORIENT__FitGroundPlane(Luint8 u8Mask, Lfloat32 *pf32PlaneEqnCoeffs)
 {
-	Lfloat32 f32Vec1X, f32Vec1Y, f32Vec1Z;
-	Lfloat32 f32Vec2X, f32Vec2Y, f32Vec2Z;
-	Lfloat32 f32XProductX, f32XProductY, f32XProductZ;
-
-	//Calculate two vectors in the plane
-	f32Vec1X = sFCU.sFlightControl.sOrient.sGroundLasers[u8A].f32Position[LASER_ORIENT__X] - sFCU.sFlightControl.sOrient.sGroundLasers[u8B].f32Position[LASER_ORIENT__X];
-	f32Vec1Y = sFCU.sFlightControl.sOrient.sGroundLasers[u8A].f32Position[LASER_ORIENT__Y] - sFCU.sFlightControl.sOrient.sGroundLasers[u8B].f32Position[LASER_ORIENT__Y];
-	f32Vec1Z = (sFCU.sFlightControl.sOrient.sGroundLasers[u8A].f32Position[LASER_ORIENT__Z] - sFCU.sFlightControl.sOrient.sGroundLasers[u8A].f32Measurement) - (sFCU.sFlightControl.sOrient.sGroundLasers[u8B].f32Position[LASER_ORIENT__Z] - sFCU.sFlightControl.sOrient.sGroundLasers[u8B].f32Measurement);
-	f32Vec2X = sFCU.sFlightControl.sOrient.sGroundLasers[u8B].f32Position[LASER_ORIENT__X] - sFCU.sFlightControl.sOrient.sGroundLasers[u8C].f32Position[LASER_ORIENT__X];
-	f32Vec2Y = sFCU.sFlightControl.sOrient.sGroundLasers[u8B].f32Position[LASER_ORIENT__Y] - sFCU.sFlightControl.sOrient.sGroundLasers[u8C].f32Position[LASER_ORIENT__Y];
-	f32Vec2Z = (sFCU.sFlightControl.sOrient.sGroundLasers[u8B].f32Position[LASER_ORIENT__Z] - sFCU.sFlightControl.sOrient.sGroundLasers[u8B].f32Measurement) - (sFCU.sFlightControl.sOrient.sGroundLasers[u8C].f32Position[LASER_ORIENT__Z] - sFCU.sFlightControl.sOrient.sGroundLasers[u8C].f32Measurement);
-
-	//Calculate the cross product of the vectors
-	//to get a vector normal to the plane
-	f32XProductX = f32Vec1Y*f32Vec2Z - f32Vec1Z*f32Vec2Y;
-	f32XProductY = f32Vec1Z*f32Vec2X - f32Vec1X*f32Vec2Z;
-	f32XProductZ = f32Vec1X*f32Vec2Y - f32Vec1Y*f32Vec2X;
-
-	//The normal vector should be pointed in the +Z direction
-	//It affects which side of the plane has negative distances
-	if(f32XProductZ < 0)
+	Lfloat32 f32Z[C_FCU__NUM_LASERS_GROUND];
+	Lfloat32 f32Fit[3];
+	Luint8 u8Counter;
+
+	//ground height under each laser, zero the ones we aren't using so a bad
+	//reading can't get into the sum
+	for(u8Counter = 0U; u8Counter < C_FCU__NUM_LASERS_GROUND; u8Counter++)
 	{
-		f32XProductX *= -1;
-		f32XProductY *= -1;
-		f32XProductZ *= -1;
+		if((u8Mask & (Luint8)(1U << u8Counter)) != 0U)
+		{
+			f32Z[u8Counter] = f32FCU_FLIGHTCTL_LASERORIENT__Get_GroundZ(u8Counter);
+		}
+		else
+		{
+			f32Z[u8Counter] = 0.0F;
+		}
 	}
 
-	//Plane in 3D: Ax + By + Cz + D = 0
-	//A, B, C is the vector normal to the plane
-	//Use one of our original points to calculate D
-	pf32PlaneEqnCoeffs[LASER_ORIENT__A] = f32XProductX;
-	pf32PlaneEqnCoeffs[LASER_ORIENT__B] = f32XProductY;
-	pf32PlaneEqnCoeffs[LASER_ORIENT__C] = f32XProductZ;
+	//[a b c] = pinv.z
+	vNUMERICAL_MATRIX__Mult(3U, C_FCU__NUM_LASERS_GROUND, 1U, &f32Fit[0], &sFCU.sFlightControl.sOrient.sLSQ.f32PseudoInv[u8Mask][0], &f32Z[0]);
 
-	pf32PlaneEqnCoeffs[LASER_ORIENT__D] = -1 * (pf32PlaneEqnCoeffs[LASER_ORIENT__A] * sFCU.sFlightControl.sOrient.sGroundLasers[u8A].f32Position[LASER_ORIENT__X] + pf32PlaneEqnCoeffs[LASER_ORIENT__B] * sFCU.sFlightControl.sOrient.sGroundLasers[u8A].f32Position[LASER_ORIENT__Y] + pf32PlaneEqnCoeffs[LASER_ORIENT__C] * sFCU.sFlightControl.sOrient.sGroundLasers[u8A].f32Position[LASER_ORIENT__Z]);
+	//z = ax + by + c is -ax - by + z - c = 0
+	//The normal vector is already pointed in the +Z direction
+	pf32PlaneEqnCoeffs[LASER_ORIENT__A] = -f32Fit[0];
+	pf32PlaneEqnCoeffs[LASER_ORIENT__B] = -f32Fit[1];
+	pf32PlaneEqnCoeffs[LASER_ORIENT__C] = 1.0F;
+	pf32PlaneEqnCoeffs[LASER_ORIENT__D] = -f32Fit[2];
 
 }
 
 
+/** Height of the ground under a laser */
+Lfloat32 f32FCU_FLIGHTCTL_LASERORIENT__Get_GroundZ(Luint8 u8Laser)
+{
+	return sFCU.sFlightControl.sOrient.sGroundLasers[u8Laser].f32Position[LASER_ORIENT__Z] - sFCU.sFlightControl.sOrient.sGroundLasers[u8Laser].f32Measurement;
+}
+
+
+/** Height of a plane under a laser */
+Lfloat32 f32FCU_FLIGHTCTL_LASERORIENT__PlaneZ(const Lfloat32 *pf32PlaneEqnCoeffs, Luint8 u8Laser)
+{
+	return -1 * (pf32PlaneEqnCoeffs[LASER_ORIENT__A] * sFCU.sFlightControl.sOrient.sGroundLasers[u8Laser].f32Position[LASER_ORIENT__X] + pf32PlaneEqnCoeffs[LASER_ORIENT__B] * sFCU.sFlightControl.sOrient.sGroundLasers[u8Laser].f32Position[LASER_ORIENT__Y] + pf32PlaneEqnCoeffs[LASER_ORIENT__D]) / pf32PlaneEqnCoeffs[LASER_ORIENT__C];
+}
+
+
+/** Set an x,y,z position */
+void vFCU_FLIGHTCTL_LASERORIENT__Set_Position(Lfloat32 *pf32Position, Lfloat32 f32X, Lfloat32 f32Y, Lfloat32 f32Z)
+{
+	pf32Position[LASER_ORIENT__X] = f32X;
+	pf32Position[LASER_ORIENT__Y] = f32Y;
+	pf32Position[LASER_ORIENT__Z] = f32Z;
+}
+
+
 /** Calculate the pod's yaw and lateral translation */
 
 // see documentation: http://confluence.rloop.org/display/SD/2.1.+Determine+Pod+Yaw+and+Lateral+Position+in+Tube
@@ -406,7 +634,7 @@ void vFCU_FLIGHTCTL_LASERORIENT__CalcYaw_and_Lateral(void)
 
 	f32LaserSeparation_X = sFCU.sFlightControl.sOrient.sBeamLasers[0].f32Position[0] - sFCU.sFlightControl.sOrient.sBeamLasers[1].f32Position[0];
 
-	sFCU.sFlightControl.sOrient.s16Yaw = (Lint16)(2 * f32NUMERICAL_Atan((f32LaserSeparation_X - sqrt(f32LaserSeparation_X * f32LaserSeparation_X + f32Y * f32Y - f32BeamThickness * f32BeamThickness)) / (f32BeamThickness - f32Y))); //todo: why is there a *10000 in old code?
+	sFCU.sFlightControl.sOrient.s16Yaw = (Lint16)(2 * atanf((f32LaserSeparation_X - sqrtf(f32LaserSeparation_X * f32LaserSeparation_X + f32Y * f32Y - f32BeamThickness * f32BeamThickness)) / (f32BeamThickness - f32Y))); //todo: why is there a *10000 in old code?
 
 	sFCU.sFlightControl.sOrient.f32Lateral = (f32Y0 - f32Y1) * f32NUMERICAL_Cosine(sFCU.sFlightControl.sOrient.s16Yaw) / 2;
 
@@ -421,37 +649,37 @@ void vFCU_FLIGHTCTL_LASERORIENT__CalcYaw_and_Lateral(void)
 /** Get pod's current Roll */
 Lint16 s16FCU_FLIGHTCTL_LASERORIENT__Get_Roll()
 {
-	return sFCU.sFlightControl.sOrient.s16Roll
+	return sFCU.sFlightControl.sOrient.s16Roll;
 }
 
 /** Get pod's current Pitch */
 Lint16 s16FCU_FLIGHTCTL_LASERORIENT__Get_Pitch()
 {
-	return sFCU.sFlightControl.sOrient.s16Pitch
+	return sFCU.sFlightControl.sOrient.s16Pitch;
 }
 
 /** Get pod's current Yaw */
 Lint16 s16FCU_FLIGHTCTL_LASERORIENT__Get_Yaw()
 {
-	return sFCU.sFlightControl.sOrient.s16Yaw
+	return sFCU.sFlightControl.sOrient.s16Yaw;
 }
 
 /** Get Lateral translation parameter */
 Lfloat32 f32FCU_FLIGHTCTL_LASERORIENT__Get_Lateral()
 {
-	return sFCU.sFlightControl.sOrient.f32Lateral
+	return sFCU.sFlightControl.sOrient.f32Lateral;
 }
 
 /** Get pitch due to lack of perfect structural rigidity */
 Lint16 s16FCU_FLIGHTCTL_LASERORIENT__Get_TwistPitch()
 {
-	return sFCU.sFlightControl.sOrient.s16TwistPitch
+	return sFCU.sFlightControl.sOrient.s16TwistPitch;
 }
 
 /** Get roll due to lack of perfect structural rigidity */
 Lint16 s16FCU_FLIGHTCTL_LASERORIENT__Get_TwistRoll()
 {
-	return sFCU.sFlightControl.sOrient.s16TwistRoll
+	return sFCU.sFlightControl.sOrient.s16TwistRoll;
 }
 
 #endif //C_LOCALDEF__LCCM655__ENABLE_FCTL_ORIENTATION
@@ -79,7 +79,7 @@ void vFCU_FCTL_MAINSM__Init(void)
  * @brief
  * Process the main state machine
  * 
- * @st_funcMD5		2C23D1564E9845C3BED5E00B06C0BBB3
+ * @st_funcMD5		4A96745B396F13913AC3BCD02ECD2E8B
  * @st_funcID		LCCM655R0.FILE.020.FUNC.002
  */
 void vFCU_FCTL_MAINSM__Process(void)
@@ -334,7 +334,12 @@ void vFCU_FCTL_MAINSM__Process(void)
 				vFCU_FCTL__TIMEOUT__Restart(&sFCU.sStateMachine.sTimers.pBrake_To_Spindown_x10ms);
 
 				//shut the brakes.
-				vFCU_BRAKES__Move_IBeam_Distance_mm(8.0F);
+				#if C_LOCALDEF__LCCM655__ENABLE_BRAKEPID == 1U
+					//follow the setpoint profile
+					vFCU_FLIGHTCTL_BRAKEPID__Enable();
+				#else
+					vFCU_BRAKES__Move_IBeam_Distance_mm(8.0F);
+				#endif
 
 			}
 		
@@ -344,7 +349,10 @@ void vFCU_FCTL_MAINSM__Process(void)
 			if(u8FCU_FCTL_MAINSM__Check_IsExiting(sm, POD_STATE__BRAKE) == 1U) 
 			{
 				// We're exiting this state -- perform any exit actions
-				// ...
+				#if C_LOCALDEF__LCCM655__ENABLE_BRAKEPID == 1U
+					//leave the brakes where they are
+					vFCU_FLIGHTCTL_BRAKEPID__Disable();
+				#endif
 			}
 			
 			break;
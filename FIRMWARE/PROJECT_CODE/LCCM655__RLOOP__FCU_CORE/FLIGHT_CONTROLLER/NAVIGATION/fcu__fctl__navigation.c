@@ -19,6 +19,10 @@ void vFCU_FCTL_NAV__Init(void)
 	/** The navigation state machine */
 	sFCU.sNavigation.sStateMachine = NAV_STATE__IDLE;
 
+	#if C_LOCALDEF__LCCM655__ENABLE_FCTL_BLENDER == 1U
+		vFCU_FCTL_BLENDER__Init();
+	#endif
+
 
 }
 
@@ -46,6 +50,12 @@ void vFCU_FCTL_NAV__Process(void)
 			sFCU.sNavigation.u8NewSampleAvail = 0U;
 
 			//also reset anything that relies on us
+			#if C_LOCALDEF__LCCM655__ENABLE_FCTL_BLENDER == 1U
+				vFCU_FCTL_BLENDER__Reset();
+
+				//find the LRF target again at the start of the next run
+				vFCU_FCTL_BLENDER__Set_LRF_Target(0);
+			#endif
 
 
 			//do not move to run mode until instructed
@@ -54,6 +64,68 @@ void vFCU_FCTL_NAV__Process(void)
 		/** Nav run, processing the navigation */
 		case NAV_STATE__RUN:
 
+		#if C_LOCALDEF__LCCM655__ENABLE_FCTL_BLENDER == 1U
+			//feed the blender, the contrast sensors update it themselves
+			u8Test = u8FCU_ACCEL_VALID__Get_New_Sample_Avail();
+			if(u8Test == 1U)
+			{
+				vFCU_FCTL_BLENDER__Accel_UpdateFrom_Accel(sFCU_ACCEL_VALID__Get_Accel_mm_ss());
+				vFCU_FCTL_BLENDER__Veloc_UpdateFrom_Accel(sFCU_ACCEL_VALID__Get_Velocity_mm_s());
+				vFCU_FCTL_BLENDER__Displacement_UpdateFrom_Accel(sFCU_ACCEL_VALID__Get_Displacement_mm());
+
+				//clear it
+				vFCU_ACCEL_VALID__Clear_NewSample_Avail();
+
+				//new data avail
+				sFCU.sNavigation.u8NewSampleAvail = 1U;
+			}
+			else
+			{
+				//no new sample avail yet
+			}
+
+			#if C_LOCALDEF__LCCM655__ENABLE_LASER_DISTANCE == 1U
+			//only the distance, the blender gets a better velocity from the
+			//distance than the LRF's own difference
+			u8Test = u8FCU_LASERDIST__Get_NewDistanceAvail();
+			if(u8Test == 1U)
+			{
+				if(vFCU_LASERDIST_VALID__Get_IsValid() == 1U)
+				{
+					//the target does not move, so the first good distance tells us
+					//where it is on the track
+					if(s32FCU_FCTL_BLENDER__Get_LRF_Target_mm() == 0)
+					{
+						vFCU_FCTL_BLENDER__Set_LRF_Target(s32FCU_LASERDIST_VALID__Get_Distance_mm() + s32FCU_FCTL_BLENDER__Get_Displacement_mm());
+					}
+					else
+					{
+						//fall on
+					}
+
+					vFCU_FCTL_BLENDER__Displacement_UpdateFrom_LRF(s32FCU_LASERDIST_VALID__Get_Distance_mm());
+					sFCU.sNavigation.u8NewSampleAvail = 1U;
+				}
+				else
+				{
+					//out of range or faulted
+				}
+
+				vFCU_LASERDIST__Clear_NewDistanceAvail();
+			}
+			else
+			{
+				//no new distance yet
+			}
+			#endif
+
+			//fixed cost, one predict and the latched updates
+			vFCU_FCTL_BLENDER__Process();
+
+			sFCU.sNavigation.sCalc.s32Accel_mm_ss = s32FCU_FCTL_BLENDER__Get_Accel_mmss();
+			sFCU.sNavigation.sCalc.s32Veloc_mm_s = s32FCU_FCTL_BLENDER__Get_Veloc_mms();
+			sFCU.sNavigation.sCalc.s32Displacement_mm = s32FCU_FCTL_BLENDER__Get_Displacement_mm();
+		#else
 			//determine what source of navigation we have requested, for now just
 			//work on the accel system
 
@@ -76,6 +148,7 @@ void vFCU_FCTL_NAV__Process(void)
 			{
 				//no new sample avail yet
 			}
+		#endif
 
 			//compute the position which depending on how we take pos, could be from the end of the track backwards
 			//for now just assign
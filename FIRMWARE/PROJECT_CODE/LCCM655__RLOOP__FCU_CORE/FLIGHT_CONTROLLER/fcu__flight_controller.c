@@ -32,7 +32,7 @@ extern struct _strFCU sFCU;
  * @brief
  * Init any variables as is needed by the main state machine
  * 
- * @st_funcMD5		61224CE144104FD40882DF507A463938
+ * @st_funcMD5		8021BDAD85BA53263411D0BBE2814358
  * @st_funcID		LCCM655R0.FILE.035.FUNC.001
  */
 void vFCU_FCTL__Init(void)
@@ -40,7 +40,7 @@ void vFCU_FCTL__Init(void)
 
 	#if C_LOCALDEF__LCCM655__ENABLE_FCTL_ORIENTATION == 1U
 		//setup laser orientation module
-		vFCU_FLIGHTCLT_LASERORIENT__Init();
+		vFCU_FLIGHTCTL_LASERORIENT__Init();
 	#endif
 
 	#if C_LOCALDEF__LCCM655__ENABLE_FCTL_CONTRAST_NAV == 1U
@@ -66,6 +66,11 @@ void vFCU_FCTL__Init(void)
 	vFCU_FCTL_NAV__Init();
 #endif
 
+	//brake PID, stays disabled until the main SM wants to brake
+	#if C_LOCALDEF__LCCM655__ENABLE_BRAKEPID == 1U
+		vFCU_FLIGHTCTL_BRAKEPID__Init();
+	#endif
+
 }
 
 
@@ -73,14 +78,14 @@ void vFCU_FCTL__Init(void)
  * @brief
  * Process the flight controller
  * 
- * @st_funcMD5		905B1E3D5EF9A5AECFDF568F73F372C4
+ * @st_funcMD5		EAC48117FE0270A3B224F517354E53AB
  * @st_funcID		LCCM655R0.FILE.035.FUNC.002
  */
 void vFCU_FCTL__Process(void)
 {
 
 	#if C_LOCALDEF__LCCM655__ENABLE_FCTL_ORIENTATION == 1U
-		vFCU_FLIGHTCLT_LASERORIENT__Process();
+		vFCU_FLIGHTCTL_LASERORIENT__Process();
 	#endif
 
 	#if C_LOCALDEF__LCCM655__ENABLE_FCTL_CONTRAST_NAV == 1U
@@ -101,6 +106,11 @@ void vFCU_FCTL__Process(void)
 		vFCU_FCTL_MAINSM__Process();
 	#endif
 
+	//run the brake PID after the main SM so it sees an enable straight away
+	#if C_LOCALDEF__LCCM655__ENABLE_BRAKEPID == 1U
+		vFCU_FLIGHTCTL_BRAKEPID__Process();
+	#endif
+
 }
 
 
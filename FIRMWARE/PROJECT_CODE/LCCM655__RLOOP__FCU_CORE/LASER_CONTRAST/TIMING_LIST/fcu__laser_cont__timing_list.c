@@ -29,7 +29,7 @@ extern struct _strFCU sFCU;
  * @brief
  * Init the timing list
  * 
- * @st_funcMD5		9BA52F4C0FCD64FBCF621D2764E85A47
+ * @st_funcMD5		DD3015C615EF4567C22B1B00E8FE6C65
  * @st_funcID		LCCM655R0.FILE.042.FUNC.001
  */
 void vFCU_LASERCONT_TL__Init(void)
@@ -46,6 +46,8 @@ void vFCU_LASERCONT_TL__Init(void)
 			sFCU.sContrast.sTimingList[u8LaserCount].u64RisingList[u32ListCount] = 0U;
 			sFCU.sContrast.sTimingList[u8LaserCount].u64FallingList[u32ListCount] = 0U;
 			sFCU.sContrast.sTimingList[u8LaserCount].u64ElapsedList_Rising[u32ListCount] = 0U;
+			sFCU.sContrast.sTimingList[u8LaserCount].u64WindowList_Rising[u32ListCount] = 0U;
+			sFCU.sContrast.sTimingList[u8LaserCount].u8WindowCountList_Rising[u32ListCount] = 0U;
 
 		}
 
@@ -55,6 +57,17 @@ void vFCU_LASERCONT_TL__Init(void)
 		sFCU.sContrast.sTimingList[u8LaserCount].u16FallingCount = 0U;
 		sFCU.sContrast.sTimingList[u8LaserCount].u8NewRisingAvail = 0U;
 
+		//clear the ring
+		sFCU.sContrast.sTimingList[u8LaserCount].u16RisingHead = 0U;
+		sFCU.sContrast.sTimingList[u8LaserCount].u16FallingHead = 0U;
+		sFCU.sContrast.sTimingList[u8LaserCount].u64WindowSum = 0U;
+		sFCU.sContrast.sTimingList[u8LaserCount].u8WindowCount = 0U;
+
+		//clear the published velocity
+		sFCU.sContrast.sTimingList[u8LaserCount].u16VelocCount = 0U;
+		sFCU.sContrast.sTimingList[u8LaserCount].u32StripeVeloc_mms = 0U;
+		sFCU.sContrast.sTimingList[u8LaserCount].u32WindowVeloc_mms = 0U;
+
 	}
 
 }
@@ -63,55 +76,57 @@ void vFCU_LASERCONT_TL__Init(void)
  * @brief
  * Process the laser contrast list system
  * 
- * @st_funcMD5		B49F777F22EE331A3A234297EEC04270
+ * @st_funcMD5		C895C6C200C9BA27C67C85426ECC9522
  * @st_funcID		LCCM655R0.FILE.042.FUNC.002
  */
 void vFCU_LASERCONT_TL__Process(void)
 {
-	Luint32 u32ListCount;
 	Luint8 u8LaserCount;
-	Luint64 u64Temp;
-
-	//We need to do a couple of tasks here
+	Luint16 u16Count;
+	Luint16 u16Slot;
+	Luint32 u32Veloc;
 
-	//1.See if we got a new edge
-
-	//2.Compute the time distance between the stripes
-	//This could be run constantly so as we keep a consistent CPU load.
-	//this will also prevent unexpected load if we hit the ripple strips and can't simulate it easy.
+	//The ISR has already computed the time between the stripes and the window sum,
+	//so all we do here is publish the velocity for any laser that has moved on.
+	//This is O(1) per laser no matter how many stripes we have passed.
 	for(u8LaserCount = 0U; u8LaserCount < (Luint8)LASER_CONT__MAX; u8LaserCount++)
 	{
-		//do only up to the last marker -1
-		//because we are +1 internal to the for loop.
-		for(u32ListCount = 0U; u32ListCount < (C_FCU__LASER_CONTRAST__MAX_STRIPES - 1); u32ListCount++)
-		{
-			//here we have to assume that *always* one is greater than the other
-			//but this will chew computing time
-			if(sFCU.sContrast.sTimingList[u8LaserCount].u64RisingList[u32ListCount] < sFCU.sContrast.sTimingList[u8LaserCount].u64RisingList[u32ListCount + 1])
-			{
+		//take a copy, the ISR may fire at any time
+		u16Count = sFCU.sContrast.sTimingList[u8LaserCount].u16RisingCount;
 
-				//get the next entry
-				u64Temp = sFCU.sContrast.sTimingList[u8LaserCount].u64RisingList[u32ListCount + 1];
-
-				//subtract it from the current entry
-				u64Temp -= sFCU.sContrast.sTimingList[u8LaserCount].u64RisingList[u32ListCount];
-
-				//update the elapsed list.
-				sFCU.sContrast.sTimingList[u8LaserCount].u64ElapsedList_Rising[u32ListCount] = u64Temp;
+		if(u16Count != sFCU.sContrast.sTimingList[u8LaserCount].u16VelocCount)
+		{
+			sFCU.sContrast.sTimingList[u8LaserCount].u16VelocCount = u16Count;
 
+			//need two edges before we have a time
+			if(u16Count >= 2U)
+			{
+				//slot of the latest edge
+				u16Slot = (Luint16)((u16Count - 1U) % C_FCU__LASER_CONTRAST__MAX_STRIPES);
+
+				//velocity over the last stripe
+				u32Veloc = u32FCU_LASERCONT_VELOC__Compute(C_FCU__LASER_CONTRAST__STRIPE_SPACING_MM,
+											sFCU.sContrast.sTimingList[u8LaserCount].u64ElapsedList_Rising[u16Slot]);
+				sFCU.sContrast.sTimingList[u8LaserCount].u32StripeVeloc_mms = u32Veloc;
+
+				//velocity over the window, less noisy
+				u32Veloc = u32FCU_LASERCONT_VELOC__Compute(C_FCU__LASER_CONTRAST__STRIPE_SPACING_MM * (Luint32)sFCU.sContrast.sTimingList[u8LaserCount].u8WindowCountList_Rising[u16Slot],
+											sFCU.sContrast.sTimingList[u8LaserCount].u64WindowList_Rising[u16Slot]);
+				sFCU.sContrast.sTimingList[u8LaserCount].u32WindowVeloc_mms = u32Veloc;
 			}
 			else
 			{
-				//big issue here, we are not able to subtract;
+				//first edge, no time yet
 			}
 
-		}//for(u32ListCount = 0U; u32ListCount < (C_FCU__LASER_CONTRAST__MAX_STRIPES - 1); u32ListCount++)
+		}
+		else
+		{
+			//nothing new
+		}
 
 	}//for(u8LaserCount = 0U; u8LaserCount < (Luint8)LASER_CONT__MAX; u8LaserCount++)
 
-	//3. Update a rolling database of markers passed
-
-	//4. Handle any error rejection.
 }
 
 /***************************************************************************//**
@@ -123,12 +138,16 @@ void vFCU_LASERCONT_TL__Process(void)
  *
  * @param[in]		eLaser					The laser
  * @param[in]		u32Register				Snapshot of pin
- * @st_funcMD5		C9E0D08D7A05712DAD2D8ACF97A7DF77
+ * @st_funcMD5		6D830EA40C4CE8D83CED11EA850B91CC
  * @st_funcID		LCCM655R0.FILE.042.FUNC.003
  */
 void vFCU_LASERCONT_TL__ISR(E_FCU__LASER_CONT_INDEX_T eLaser, Luint32 u32Register)
 {
 	Luint32 u32Mask;
+	Luint64 u64Time;
+	Luint64 u64Delta;
+	Luint16 u16Head;
+	Luint16 u16Slot;
 
 	u32Mask = 0U;
 
@@ -159,38 +178,97 @@ void vFCU_LASERCONT_TL__ISR(E_FCU__LASER_CONT_INDEX_T eLaser, Luint32 u32Registe
 
 	if(eLaser < LASER_CONT__MAX)
 	{
-		//here all we can do is save off the next list item and then increment.
+		//grab the timestamp first
+		u64Time = u64RM4_RTI__Get_Counter1();
+
+		//save off the next list item and then increment, the lists are rings
+		//so we never run out of space, we just lose the oldest edge.
 		//rising or falling
 		if((u32Register & u32Mask) == 0U)
 		{
 			//falling
-			//make sure we are safe
-			if(sFCU.sContrast.sTimingList[(Luint8)eLaser].u16FallingCount < C_FCU__LASER_CONTRAST__MAX_STRIPES)
+			u16Head = sFCU.sContrast.sTimingList[(Luint8)eLaser].u16FallingHead;
+			sFCU.sContrast.sTimingList[(Luint8)eLaser].u64FallingList[u16Head] = u64Time;
+
+			//wrap
+			u16Head++;
+			if(u16Head >= C_FCU__LASER_CONTRAST__MAX_STRIPES)
 			{
-				sFCU.sContrast.sTimingList[(Luint8)eLaser].u64FallingList[sFCU.sContrast.sTimingList[(Luint8)eLaser].u16FallingCount] = u64RM4_RTI__Get_Counter1();
-				sFCU.sContrast.sTimingList[(Luint8)eLaser].u16FallingCount++;
+				u16Head = 0U;
 			}
 			else
 			{
-				//BIG ISSUE!
+				//fall on
 			}
+			sFCU.sContrast.sTimingList[(Luint8)eLaser].u16FallingHead = u16Head;
+			sFCU.sContrast.sTimingList[(Luint8)eLaser].u16FallingCount++;
 		}
 		else
 		{
 			//rising
-			//make sure we are safe
-			if(sFCU.sContrast.sTimingList[(Luint8)eLaser].u16RisingCount < C_FCU__LASER_CONTRAST__MAX_STRIPES)
+			u16Head = sFCU.sContrast.sTimingList[(Luint8)eLaser].u16RisingHead;
+
+			//one delta per edge
+			if(sFCU.sContrast.sTimingList[(Luint8)eLaser].u16RisingCount > 0U)
 			{
-				sFCU.sContrast.sTimingList[(Luint8)eLaser].u64RisingList[sFCU.sContrast.sTimingList[(Luint8)eLaser].u16RisingCount] = u64RM4_RTI__Get_Counter1();
-				sFCU.sContrast.sTimingList[(Luint8)eLaser].u16RisingCount++;
+				//slot of the previous edge
+				if(u16Head == 0U)
+				{
+					u16Slot = C_FCU__LASER_CONTRAST__MAX_STRIPES - 1U;
+				}
+				else
+				{
+					u16Slot = u16Head - 1U;
+				}
+				u64Delta = u64Time - sFCU.sContrast.sTimingList[(Luint8)eLaser].u64RisingList[u16Slot];
+
+				//rolling window, drop the oldest delta once full
+				if(sFCU.sContrast.sTimingList[(Luint8)eLaser].u8WindowCount >= C_FCU__LASER_CONTRAST__VELOC_WINDOW)
+				{
+					if(u16Head < C_FCU__LASER_CONTRAST__VELOC_WINDOW)
+					{
+						u16Slot = (u16Head + C_FCU__LASER_CONTRAST__MAX_STRIPES) - C_FCU__LASER_CONTRAST__VELOC_WINDOW;
+					}
+					else
+					{
+						u16Slot = u16Head - C_FCU__LASER_CONTRAST__VELOC_WINDOW;
+					}
+					sFCU.sContrast.sTimingList[(Luint8)eLaser].u64WindowSum -= sFCU.sContrast.sTimingList[(Luint8)eLaser].u64ElapsedList_Rising[u16Slot];
+				}
+				else
+				{
+					sFCU.sContrast.sTimingList[(Luint8)eLaser].u8WindowCount++;
+				}
+				sFCU.sContrast.sTimingList[(Luint8)eLaser].u64WindowSum += u64Delta;
+			}
+			else
+			{
+				//first edge, nothing to compare against
+				u64Delta = 0U;
+			}
+
+			sFCU.sContrast.sTimingList[(Luint8)eLaser].u64RisingList[u16Head] = u64Time;
+			sFCU.sContrast.sTimingList[(Luint8)eLaser].u64ElapsedList_Rising[u16Head] = u64Delta;
+			sFCU.sContrast.sTimingList[(Luint8)eLaser].u64WindowList_Rising[u16Head] = sFCU.sContrast.sTimingList[(Luint8)eLaser].u64WindowSum;
+			sFCU.sContrast.sTimingList[(Luint8)eLaser].u8WindowCountList_Rising[u16Head] = sFCU.sContrast.sTimingList[(Luint8)eLaser].u8WindowCount;
 
-				//update the velocity system
-				sFCU.sContrast.sTimingList[(Luint8)eLaser].u8NewRisingAvail = 1U;
+			//wrap
+			u16Head++;
+			if(u16Head >= C_FCU__LASER_CONTRAST__MAX_STRIPES)
+			{
+				u16Head = 0U;
 			}
 			else
 			{
-				//BIG ISSUE!
+				//fall on
 			}
+			sFCU.sContrast.sTimingList[(Luint8)eLaser].u16RisingHead = u16Head;
+
+			//count is done last so the foreground never sees a half written slot
+			sFCU.sContrast.sTimingList[(Luint8)eLaser].u16RisingCount++;
+
+			//update the velocity system
+			sFCU.sContrast.sTimingList[(Luint8)eLaser].u8NewRisingAvail = 1U;
 		}
 	}
 	else
@@ -204,28 +282,26 @@ void vFCU_LASERCONT_TL__ISR(E_FCU__LASER_CONT_INDEX_T eLaser, Luint32 u32Registe
  * @brief
  * Gets the difference btween the current edge and previous edge.
  * can only use used if new rising edge avail = 1 and there is suitable rising data
+ * The edge must still be in the list, i.e. one of the last MAX_STRIPES edges.
  * 
  * @param[in]		eLaser				The laser index
  * @param[in]		u16CurrentIndex		The current index to compare against
- * @st_funcMD5		A7C670C712B3C8EA0B5451ECAABE9577
+ * @st_funcMD5		5B8F61737CD1658B2E03E613AD9283E8
  * @st_funcID		LCCM655R0.FILE.042.FUNC.006
  */
 Luint64 u64FCU_LASERCONT_TL__Get_TimeDelta(E_FCU__LASER_CONT_INDEX_T eLaser, Luint16 u16CurrentIndex)
 {
 	Luint64 u64Return;
-	Luint16 u16Index0;
-	Luint16 u16Index1;
-
-	//can only do if we have AT LEAST one spot
-	if(u16CurrentIndex >= 1U)
-	{
+	Luint16 u16Age;
 
-		//compute the indexes
-		u16Index0 = u16CurrentIndex;
-		u16Index1 = u16CurrentIndex - 1U;
+	//how many edges ago
+	u16Age = sFCU.sContrast.sTimingList[(Luint8)eLaser].u16RisingCount - u16CurrentIndex;
 
-		u64Return = sFCU.sContrast.sTimingList[(Luint8)eLaser].u64RisingList[u16Index0];
-		u64Return -= sFCU.sContrast.sTimingList[(Luint8)eLaser].u64RisingList[u16Index1];
+	//can only do if we have AT LEAST one spot and the edge has not been overwritten
+	if((u16CurrentIndex >= 1U) && (u16Age >= 1U) && (u16Age <= C_FCU__LASER_CONTRAST__MAX_STRIPES))
+	{
+		//already computed by the ISR
+		u64Return = sFCU.sContrast.sTimingList[(Luint8)eLaser].u64ElapsedList_Rising[u16CurrentIndex % C_FCU__LASER_CONTRAST__MAX_STRIPES];
 	}
 	else
 	{
@@ -235,6 +311,32 @@ Luint64 u64FCU_LASERCONT_TL__Get_TimeDelta(E_FCU__LASER_CONT_INDEX_T eLaser, Lui
 	return u64Return;
 }
 
+/***************************************************************************//**
+ * @brief
+ * Velocity over the last stripe
+ * 
+ * @param[in]		eLaser					The laser index
+ * @st_funcMD5		41FCF7715C2CB9118645B02C14F36354
+ * @st_funcID		LCCM655R0.FILE.042.FUNC.007
+ */
+Luint32 u32FCU_LASERCONT_TL__Get_StripeVeloc_mms(E_FCU__LASER_CONT_INDEX_T eLaser)
+{
+	return sFCU.sContrast.sTimingList[(Luint8)eLaser].u32StripeVeloc_mms;
+}
+
+/***************************************************************************//**
+ * @brief
+ * Velocity averaged over the last C_FCU__LASER_CONTRAST__VELOC_WINDOW stripes
+ * 
+ * @param[in]		eLaser					The laser index
+ * @st_funcMD5		DFEF0465203F4BA15DACEB95163032EE
+ * @st_funcID		LCCM655R0.FILE.042.FUNC.008
+ */
+Luint32 u32FCU_LASERCONT_TL__Get_WindowVeloc_mms(E_FCU__LASER_CONT_INDEX_T eLaser)
+{
+	return sFCU.sContrast.sTimingList[(Luint8)eLaser].u32WindowVeloc_mms;
+}
+
 /***************************************************************************//**
  * @brief
  * Return if a new rising edge has been detected
@@ -261,6 +363,11 @@ void vFCU_LASERCONT_TL__Clear_NewRisingAvail(E_FCU__LASER_CONT_INDEX_T eLaser)
 	sFCU.sContrast.sTimingList[(Luint8)eLaser].u8NewRisingAvail = 0U;
 }
 
+//safety
+#if C_FCU__LASER_CONTRAST__VELOC_WINDOW >= C_FCU__LASER_CONTRAST__MAX_STRIPES
+	#error
+#endif
+
 #endif
 #ifndef C_LOCALDEF__LCCM655__ENABLE_LASER_CONTRAST
 	#error
@@ -28,13 +28,13 @@ extern struct _strFCU sFCU;
  * @brief
  * ToDo
  * 
- * @st_funcMD5		2248CD3745D2D329825B4B41A5F777E9
+ * @st_funcMD5		DF96685AD34D78CFD24745D982B8806B
  * @st_funcID		LCCM655R0.FILE.040.FUNC.001
  */
 void vFCU_LASERCONT_VELOC__Init(void)
 {
 
-	//sFCU.sContrast.sVeloc.u32CurrentVeloc_mms = 0U;;
+	sFCU.sContrast.sComputed.u32CurrentVeloc_mms = 0U;
 
 }
 
@@ -42,14 +42,43 @@ void vFCU_LASERCONT_VELOC__Init(void)
 
 /***************************************************************************//**
  * @brief
- * ToDo
+ * Fuse the per laser window velocities from the timing list into the
+ * computed velocity. Lasers without two edges yet are left out.
  * 
- * @st_funcMD5		A630BB7D8CB5F66027917286E6DE41BC
+ * @st_funcMD5		BB3C8545A007727E684ACA2370402A67
  * @st_funcID		LCCM655R0.FILE.040.FUNC.002
  */
 void vFCU_LASERCONT_VELOC__Process(void)
 {
-	//do nothing.
+	Luint8 u8LaserCount;
+	Luint8 u8Valid;
+	Luint32 u32Sum;
+
+	//the timing list keeps a window velocity per laser, average the lasers that have one
+	u8Valid = 0U;
+	u32Sum = 0U;
+	for(u8LaserCount = 0U; u8LaserCount < (Luint8)LASER_CONT__MAX; u8LaserCount++)
+	{
+		//need two edges before we have a time
+		if(sFCU.sContrast.sTimingList[u8LaserCount].u16VelocCount >= 2U)
+		{
+			u32Sum += sFCU.sContrast.sTimingList[u8LaserCount].u32WindowVeloc_mms;
+			u8Valid++;
+		}
+		else
+		{
+			//no velocity on this laser yet
+		}
+	}
+
+	if(u8Valid != 0U)
+	{
+		sFCU.sContrast.sComputed.u32CurrentVeloc_mms = u32Sum / (Luint32)u8Valid;
+	}
+	else
+	{
+		//hold the last value
+	}
 
 }
 
@@ -58,12 +87,12 @@ void vFCU_LASERCONT_VELOC__Process(void)
  * @brief
  * ToDo
  * 
- * @st_funcMD5		50C036B4AF050E1193B9F57E0B5390FD
+ * @st_funcMD5		4227532E6C6E82817F16CBCAE17C30FF
  * @st_funcID		LCCM655R0.FILE.040.FUNC.003
  */
 Luint32 u32FCU_LASERCONT_VELOC__Get_CurrentVeloc_mms(void)
 {
-	return 0; //sFCU.sContrast.sVeloc.u32CurrentVeloc_mms;
+	return sFCU.sContrast.sComputed.u32CurrentVeloc_mms;
 }
 
 //compute the veloc
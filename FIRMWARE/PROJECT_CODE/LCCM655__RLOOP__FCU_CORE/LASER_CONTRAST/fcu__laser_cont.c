@@ -81,7 +81,7 @@ void vFCU_LASERCONT__Init(void)
  * @brief
  * Process the laser contrast system
  * 
- * @st_funcMD5		5243039BF23965BD12D80A2CE0C8D864
+ * @st_funcMD5		463D07B80E371AB93C2BD9FA64023524
  * @st_funcID		LCCM655R0.FILE.034.FUNC.002
  */
 void vFCU_LASERCONT__Process(void)
@@ -90,6 +90,8 @@ void vFCU_LASERCONT__Process(void)
 	Luint8 u8Test;
 	Luint64 u64Temp;
 	Lint64 s64Temp;
+	Luint16 u16Count;
+	Luint16 u16NewEdges;
 
 	if(sFCU.sContrast.u32Guard1 != 0xAB12AB34U)
 	{
@@ -133,27 +135,31 @@ void vFCU_LASERCONT__Process(void)
 
 		//we have a count of rising edges detected, we should compare this with our current count
 		//if the counts do not match, process it.
-		if (sFCU.sContrast.sTimingList[u8LaserCount].u16RisingCount > sFCU.sContrast.sTimingList[u8LaserCount].u16PrevRisingCount)
+		//the count is free running so use != and let it wrap
+		//use the count the timing list published rather than the live ISR count, so the window velocity
+		//below always belongs to the same edge. Any edge after TL__Process is picked up next pass.
+		u16Count = sFCU.sContrast.sTimingList[u8LaserCount].u16VelocCount;
+		if (u16Count != sFCU.sContrast.sTimingList[u8LaserCount].u16PrevRisingCount)
 		{
 
 			//we know that we have received at least one new rising edge, but we could have 20 new edges
-			//lets just process the most recent one
+			//count them all for distance, but only process the most recent one for veloc
+			u16NewEdges = u16Count - sFCU.sContrast.sTimingList[u8LaserCount].u16PrevRisingCount;
 
 			//we know each stripe is 30.48 meters.
-			sFCU.sContrast.sSensors[u8LaserCount].u32DistElapsed_mm += 30480U;
+			sFCU.sContrast.sSensors[u8LaserCount].u32DistElapsed_mm += C_FCU__LASER_CONTRAST__STRIPE_SPACING_MM * (Luint32)u16NewEdges;
 
 			//same with this, hard coded.
-			sFCU.sContrast.sSensors[u8LaserCount].u32DistLastStripe_mm = 30480U;
+			sFCU.sContrast.sSensors[u8LaserCount].u32DistLastStripe_mm = C_FCU__LASER_CONTRAST__STRIPE_SPACING_MM;
 
 			//we can also hit the first rising edge and call this 0, so just because we have one
 			//edge does not mean we have actually travelled.
 
-			//get the difference in time between pulses.
-			u64Temp = u64FCU_LASERCONT_TL__Get_TimeDelta((E_FCU__LASER_CONT_INDEX_T)u8LaserCount, sFCU.sContrast.sTimingList[u8LaserCount].u16PrevRisingCount);
+			//get the difference in time between the latest pulses, computed by the ISR
+			u64Temp = u64FCU_LASERCONT_TL__Get_TimeDelta((E_FCU__LASER_CONT_INDEX_T)u8LaserCount, u16Count - 1U);
 
 			//use the previous distance to compute our veloc.
-			//Todo: hard coded 100ft mark
-			sFCU.sContrast.sSensors[u8LaserCount].u32CurrentVeloc_mms = u32FCU_LASERCONT_VELOC__Compute(30480U, u64Temp);
+			sFCU.sContrast.sSensors[u8LaserCount].u32CurrentVeloc_mms = u32FCU_LASERCONT_VELOC__Compute(C_FCU__LASER_CONTRAST__STRIPE_SPACING_MM, u64Temp);
 
 			//compute accel from prev
 
@@ -201,8 +207,23 @@ void vFCU_LASERCONT__Process(void)
 			}
 			#endif
 
-			//update now
-			sFCU.sContrast.sTimingList[u8LaserCount].u16PrevRisingCount += 1U;
+			//feed the blender, the stripe distance every edge and the windowed velocity once we have a time
+			#if C_LOCALDEF__LCCM655__ENABLE_FLIGHT_CONTROL == 1U
+			#if C_LOCALDEF__LCCM655__ENABLE_FCTL_BLENDER == 1U
+			vFCU_FCTL_BLENDER__Displacement_UpdateFrom_Contrast(u8LaserCount, (Lint32)sFCU.sContrast.sSensors[u8LaserCount].u32DistElapsed_mm);
+			if(u64Temp != 0U)
+			{
+				vFCU_FCTL_BLENDER__Veloc_UpdateFrom_Contrast((Lint32)u32FCU_LASERCONT_TL__Get_WindowVeloc_mms((E_FCU__LASER_CONT_INDEX_T)u8LaserCount));
+			}
+			else
+			{
+				//first edge
+			}
+			#endif
+			#endif
+
+			//update now, we have caught up with every edge
+			sFCU.sContrast.sTimingList[u8LaserCount].u16PrevRisingCount = u16Count;
 
 		}
 		else
@@ -304,13 +325,18 @@ void vFCU_LASERCONT__Reset(Luint32 u32Key)
  * Interrupt from the RM4 notification system
  * 
  * @param[in]		eLaser					The laser index
- * @st_funcMD5		85A22E789F8036525ED16796EED95EC4
+ * @st_funcMD5		E235978F35EA8955A5E56F863331E35B
  * @st_funcID		LCCM655R0.FILE.034.FUNC.003
  */
 void vFCU_LASERCONT__ISR(E_FCU__LASER_CONT_INDEX_T eLaser, Luint32 u32Register)
 {
 	//pass off to the timing list
 	vFCU_LASERCONT_TL__ISR(eLaser, u32Register);
+
+	//new edge to process
+	#if C_LOCALDEF__LCCM655__ENABLE_SCHEDULER == 1U
+		vFCU_SCHED__Set_Ready(FCU_SCHED__LASERCONT);
+	#endif
 }
 
 //safetys
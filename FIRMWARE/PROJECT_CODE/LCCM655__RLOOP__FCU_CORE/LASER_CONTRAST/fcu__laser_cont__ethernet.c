@@ -29,7 +29,7 @@ extern struct _strFCU sFCU;
  * Transmit a laser contrast eth packet
  * 
  * @param[in]		ePacketType				The packet type
- * @st_funcMD5		476F3897B5D25EF85F91536B756564B7
+ * @st_funcMD5		33F1856AAA07B5CC4EEFD69E6A38C24A
  * @st_funcID		LCCM655R0.FILE.060.FUNC.001
  */
 void vFCU_LASERCONT_ETH__Transmit(E_NET__PACKET_T ePacketType)
@@ -117,6 +117,7 @@ void vFCU_LASERCONT_ETH__Transmit(E_NET__PACKET_T ePacketType)
 
 
 				//send the timing list, rising
+				//the lists are rings, edge n is in slot n % max stripes
 				for(u8Counter2 = 0U; u8Counter2 < C_FCU__LASER_CONTRAST__MAX_STRIPES; u8Counter2++)
 				{
 
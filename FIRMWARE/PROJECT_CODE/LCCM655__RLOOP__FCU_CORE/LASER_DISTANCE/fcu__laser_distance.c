@@ -89,15 +89,15 @@
 extern struct _strFCU sFCU;
 
 //locals
-void vFCU_LASERDIST__Append_Byte(Luint8 u8Value);
-void vFCU_LASERDIST__Process_Packet(void);
+void vFCU_LASERDIST__Append_Byte(Luint8 u8Value, Luint64 u64Time);
+void vFCU_LASERDIST__Process_Packet(Luint64 u64Time);
 
 
 /***************************************************************************//**
  * @brief
  * Init any of the laser distance items
  * 
- * @st_funcMD5		A7E0792439C45DE8B1C6853C1AF2D712
+ * @st_funcMD5		51918C327FD157AFA4E3C46B551CB38D
  * @st_funcID		LCCM655R0.FILE.033.FUNC.001
  */
 void vFCU_LASERDIST__Init(void)
@@ -114,7 +114,6 @@ void vFCU_LASERDIST__Init(void)
 
 	sFCU.sLaserDist.eLaserState = LASERDIST_STATE__RESET;
 	sFCU.sLaserDist.eRxState = LASERDIST_RX__BYTE_D;
-	sFCU.sLaserDist.u8NewPacket = 0U;
 	sFCU.sLaserDist.u8NewDistanceAvail = 0U;
 	sFCU.sLaserDist.u32LaserPOR_Counter = 0U;
 	//just set to some obscene distance
@@ -124,13 +123,17 @@ void vFCU_LASERDIST__Init(void)
 	sFCU.sLaserDist.s32PrevVelocity_mm_s = 0;
 	sFCU.sLaserDist.s32Accel_mm_ss = 0;
 	sFCU.sLaserDist.s32PrevAccel_mm_ss = 0;
-
+	sFCU.sLaserDist.u64Packet_Time = 0U;
+	sFCU.sLaserDist.u64RxISR_Time = 0U;
+	sFCU.sLaserDist.u8RxISR_Pending = 0U;
+	sFCU.sLaserDist.u8PacketHistory = 0U;
 
 	//clear the binary distance mode
 	sFCU.sLaserDist.sBinary.unRx.u32 = 0U;
 	sFCU.sLaserDist.sBinary.u32Counter__MissedStart = 0U;
 	sFCU.sLaserDist.sBinary.u32Counter__BadDistance = 0U;
 	sFCU.sLaserDist.sBinary.u32Counter__ErrorCode = 0U;
+	sFCU.sLaserDist.sBinary.u32Counter__Framing = 0U;
 
 	//setup the filtering
 	vFCU_LASERDIST_FILT__Init();
@@ -143,16 +146,22 @@ void vFCU_LASERDIST__Init(void)
  * @brief
  * Process the laser distance system
  * 
- * @st_funcMD5		68CEF6925DC062A13D4785E601B29F69
+ * @note
+ * Each pass drains everything the SC16 layer has buffered for the laser and
+ * runs it through the packet parser, so any number of packets are handled
+ * per pass. The laser does not tell us when it measured, so each byte is
+ * timestamped back from the drain time by one character per byte queued
+ * behind it.
+ *
+ * @st_funcMD5		9C91A76DFB6E43260D47E659DBD3736A
  * @st_funcID		LCCM655R0.FILE.033.FUNC.002
  */
 void vFCU_LASERDIST__Process(void)
 {
 
-	Luint8 u8Counter;
-	Luint8 u8Temp;
-	Luint8 u8BurstCount;
+	Luint8 u8Count;
 	Luint8 u8Array[4];
+	Luint8 u8Rx[C_FCU__LASERDIST__RX_BURST];
 
 
 
@@ -261,55 +270,28 @@ void vFCU_LASERDIST__Process(void)
 
 		case LASERDIST_STATE__CHECK_NEW_DATA:
 
-			//do a burst here
-			for(u8BurstCount = 0U; u8BurstCount < 3U; u8BurstCount++)
+			//drain the lot, the SC16 ISR and process have already moved the
+			//hardware FIFO into the driver
+			u8Count = 0U;
+			while((u8Count < C_FCU__LASERDIST__RX_BURST) && (u8SIL3_SC16_USER__Get_ByteAvail(C_FCU__SC16_FWD_LASER_INDEX) != 0U))
 			{
+				u8Rx[u8Count] = u8SIL3_SC16_USER__Get_Byte(C_FCU__SC16_FWD_LASER_INDEX);
+				u8Count++;
+			}
 
-				//see if there is at least one byte of data avail in the FIFO's
-				u8Temp = u8SIL3_SC16_USER__Get_ByteAvail(C_FCU__SC16_FWD_LASER_INDEX);
-				if(u8Temp == 0U)
-				{
-
-				}
-				else
-				{
-					//yep some new laser data avail, what to do with it?
-
-					//clear the counter;
-					sFCU.sLaserDist.u32BytesSeen_Counter = 0U;
-
-					//get the byte and send it off for processing if we have enough data
-					u8Temp = u8SIL3_SC16_USER__Get_Byte(C_FCU__SC16_FWD_LASER_INDEX);
-
-					//process the byte.
-					vFCU_LASERDIST__Append_Byte(u8Temp);
-				}
-
-			}//for(u8BurstCount = 0U; u8BurstCount < 3U; u8BurstCount++)
-
-
-			sFCU.sLaserDist.eLaserState = LASERDIST_STATE__CHECK_NEW_PACKET;
-			break;
-
-		case LASERDIST_STATE__CHECK_NEW_PACKET:
-
-			//check the packet state of each laser
-			if(sFCU.sLaserDist.u8NewPacket == 1U)
+			if(u8Count > 0U)
 			{
-				//we have a new laser packet, process it for distance or error code.
-				vFCU_LASERDIST__Process_Packet();
-
-				//clear the flag
-				sFCU.sLaserDist.u8NewPacket = 0U;
+				//clear the counter;
+				sFCU.sLaserDist.u32BytesSeen_Counter = 0U;
 
+				vFCU_LASERDIST__Rx_Bytes(&u8Rx[0], u8Count);
 			}
 			else
 			{
-				//no new packet has arrived, loop around
+				//nothing new
 			}
 
-			//back to check for more data
-			sFCU.sLaserDist.eLaserState = LASERDIST_STATE__CHECK_NEW_DATA;
+			//stay in state
 			break;
 
 		default:
@@ -362,36 +344,129 @@ Lint32 s32FCU_LASERDIST__Get_Distance_mm(void)
 	return sFCU.sLaserDist.s32Distance_mm;
 }
 
+/***************************************************************************//**
+ * @brief
+ * Has a new distance arrived since the last clear
+ * 
+ * @return			1 = new distance
+ * @st_funcMD5		8FB6FAA1979122E66D64E04356840E08
+ * @st_funcID		LCCM655R0.FILE.033.FUNC.009
+ */
+Luint8 u8FCU_LASERDIST__Get_NewDistanceAvail(void)
+{
+	return sFCU.sLaserDist.u8NewDistanceAvail;
+}
 
-//process the binary packet.
 /***************************************************************************//**
  * @brief
- * ToDo
+ * Clear the new distance flag once the distance has been used
  * 
- * @st_funcMD5		089FCC7F1278951692A429D26ED21534
+ * @st_funcMD5		1D4774A07F08E5F848A704D188CB5486
+ * @st_funcID		LCCM655R0.FILE.033.FUNC.010
+ */
+void vFCU_LASERDIST__Clear_NewDistanceAvail(void)
+{
+	sFCU.sLaserDist.u8NewDistanceAvail = 0U;
+}
+
+
+/***************************************************************************//**
+ * @brief
+ * Decode a complete millimetre binary packet and update the distance, veloc
+ * and accel from the real time between packets.
+ * 
+ * @note
+ * Byte 0: 1, error, distance bits 19:14 or the error code
+ * Byte 1: 0, distance bits 13:7 or 'E'
+ * Byte 2: 0, distance bits 6:0 or 'R'
+ *
+ * @param[in]		u64Time				RTI counter 1 time the packet completed
+ * @st_funcMD5		79C3E119642F59239FC5F7545EDF9D4B
  * @st_funcID		LCCM655R0.FILE.033.FUNC.008
  */
-void vFCU_LASERDIST__Process_Packet(void)
+void vFCU_LASERDIST__Process_Packet(Luint64 u64Time)
 {
-	Lfloat32 f32Delta;
+	Luint32 u32Distance;
+	Luint64 u64Delta;
+	Lint64 s64Temp;
 
-	//update
-	sFCU.sLaserDist.s32Distance_mm = (Lint32)sFCU.sLaserDist.sBinary.unRx.u32;
+	if((sFCU.sLaserDist.u8NewByteArray[0] & 0x40U) == 0x40U)
+	{
+		//the laser is reporting an error
+		if((sFCU.sLaserDist.u8NewByteArray[1] == 0x45U) && (sFCU.sLaserDist.u8NewByteArray[2] == 0x52U))
+		{
+			sFCU.sLaserDist.sBinary.u32Counter__ErrorCode++;
+		}
+		else
+		{
+			//framed ok but the error marker is damaged
+			sFCU.sLaserDist.sBinary.u32Counter__BadDistance++;
+		}
+	}
+	else
+	{
+		u32Distance = (Luint32)sFCU.sLaserDist.u8NewByteArray[0] & 0x3FU;
+		u32Distance <<= 7U;
+		u32Distance |= (Luint32)sFCU.sLaserDist.u8NewByteArray[1];
+		u32Distance <<= 7U;
+		u32Distance |= (Luint32)sFCU.sLaserDist.u8NewByteArray[2];
+		sFCU.sLaserDist.sBinary.unRx.u32 = u32Distance;
+
+		if((sFCU.sLaserDist.u8PacketHistory > 0U) && (u64Time == sFCU.sLaserDist.u64Packet_Time))
+		{
+			//more than one packet under the same RX interrupt, only the newest is
+			//on time so it replaces the older one, the prev's stay as they were
+			sFCU.sLaserDist.s32Distance_mm = (Lint32)u32Distance;
+		}
+		else
+		{
+			//save prev
+			sFCU.sLaserDist.s32PrevDistance_mm = sFCU.sLaserDist.s32Distance_mm;
+			sFCU.sLaserDist.s32PrevVelocity_mm_s = sFCU.sLaserDist.s32Velocity_mm_s;
+			sFCU.sLaserDist.s32PrevAccel_mm_ss = sFCU.sLaserDist.s32Accel_mm_ss;
 
-	//compute veloc
-	f32Delta = (Lfloat32)sFCU.sLaserDist.s32PrevDistance_mm;
-	f32Delta -= sFCU.sLaserDist.s32Distance_mm;
+			//update
+			sFCU.sLaserDist.s32Distance_mm = (Lint32)u32Distance;
 
-	//50hz
-	f32Delta *= 0.05F;
+			//the interrupt times only ever move forward, guard anyhow
+			if((sFCU.sLaserDist.u8PacketHistory > 0U) && (u64Time > sFCU.sLaserDist.u64Packet_Time))
+			{
+				u64Delta = u64Time - sFCU.sLaserDist.u64Packet_Time;
 
-	//do it.
-	sFCU.sLaserDist.s32Velocity_mm_s = (Lint32)f32Delta;
+				//closing distance is +ve veloc
+				s64Temp = (Lint64)sFCU.sLaserDist.s32PrevDistance_mm - (Lint64)sFCU.sLaserDist.s32Distance_mm;
+				s64Temp *= (Lint64)C_FCU__RTI_COUNTER1_HZ;
+				s64Temp /= (Lint64)u64Delta;
+				sFCU.sLaserDist.s32Velocity_mm_s = (Lint32)s64Temp;
 
-	//save prev
-	sFCU.sLaserDist.s32PrevDistance_mm = sFCU.sLaserDist.s32Distance_mm;
-	sFCU.sLaserDist.s32PrevVelocity_mm_s = sFCU.sLaserDist.s32Velocity_mm_s;
+				if(sFCU.sLaserDist.u8PacketHistory > 1U)
+				{
+					s64Temp = (Lint64)sFCU.sLaserDist.s32Velocity_mm_s - (Lint64)sFCU.sLaserDist.s32PrevVelocity_mm_s;
+					s64Temp *= (Lint64)C_FCU__RTI_COUNTER1_HZ;
+					s64Temp /= (Lint64)u64Delta;
+					sFCU.sLaserDist.s32Accel_mm_ss = (Lint32)s64Temp;
+				}
+				else
+				{
+					//first veloc, no accel yet
+					sFCU.sLaserDist.u8PacketHistory = 2U;
+				}
+			}
+			else
+			{
+				//first distance
+				sFCU.sLaserDist.u8PacketHistory = 1U;
+			}
+		}
+
+		sFCU.sLaserDist.u64Packet_Time = u64Time;
 
+		//clear the packets seeen counter
+		sFCU.sLaserDist.u32PacketsSeen_Counter = 0U;
+
+		//let the nav know
+		sFCU.sLaserDist.u8NewDistanceAvail = 1U;
+	}
 
 }
 
@@ -401,7 +476,7 @@ void vFCU_LASERDIST__Process_Packet(void)
  * Take the laser packet byte array that has been captured and process it into a length
  * including fault detection
  * 
- * @st_funcMD5		84A305B5BFCD07B007D11374AA3565E8
+ * @st_funcMD5		C051A94364F568E3838522C1DDC9A30B
  * @st_funcID		LCCM655R0.FILE.033.FUNC.004
  */
 void vFCU_LASERDIST__Process_Packet_ASCII(void)
@@ -462,143 +537,136 @@ void vFCU_LASERDIST__Process_Packet_ASCII(void)
 	sFCU.sLaserDist.s32PrevDistance_mm = sFCU.sLaserDist.s32Distance_mm;
 	sFCU.sLaserDist.s32PrevVelocity_mm_s = sFCU.sLaserDist.s32Velocity_mm_s;
 
+	//let the nav know
+	sFCU.sLaserDist.u8NewDistanceAvail = 1U;
+
 }
 
 
 /***************************************************************************//**
  * @brief
- * Append a new byte from the UART into the internal array, handle any error checking
+ * Hand a burst of bytes drained from the SC16 to the packet parser.
  * 
- * @param[in]		u8Value				The new byte
- * @st_funcMD5		708617CB2763AB7FA8B77C62A942DD43
- * @st_funcID		LCCM655R0.FILE.033.FUNC.005
+ * @note
+ * Every packet completed in the burst is stamped with the RX interrupt that
+ * announced the data, not with when the main loop got round to it. If the
+ * SC16 is polled there is no interrupt time and the drain time is used.
+ *
+ * @param[in]		u8Count				Number of bytes
+ * @param[in]		pu8Rx				The bytes in arrival order
+ * @st_funcMD5		D22E948B39814849A8F3DEFFE00DF97E
+ * @st_funcID		LCCM655R0.FILE.033.FUNC.012
  */
-void vFCU_LASERDIST__Append_Byte(Luint8 u8Value)
+void vFCU_LASERDIST__Rx_Bytes(const Luint8 *pu8Rx, Luint8 u8Count)
 {
+	Luint8 u8Counter;
+	Luint64 u64Time;
 
-	//TODO:
-	//NEED TO UPDATE THIS RX STRUCTURE PER DETAILS ON:
-	//https://github.com/rLoopTeam/eng-controls-acc-vs-lrf-test-rig/blob/master/LRF/LRF.ino
-	//document in documents folder.
-
-
-	//handle the laser distance rx states
-	switch(sFCU.sLaserDist.eRxState)
+	if(sFCU.sLaserDist.u8RxISR_Pending == 1U)
 	{
-		case LASERDIST_RX__BYTE_D:
-
-			//make sure the first two bits are valid
-			//todo
-#if 0 // ASCII MODE
-			if(u8Value == 'D')
-			{
-				//wait for byte 2
-				sFCU.sLaserDist.eRxState = LASERDIST_RX__BYTE_1;
-			}
-			else
-			{
-				//we are not at the right point for detection of the packet start, loop back
-
-				//todo: check if we can see a laser error here
-			}
-#endif //
-
-			//check for the start bit
-			if((u8Value & 0x80U) == 0x80U)
-			{
-				//correct distance measurement
-				if((u8Value & 0x40U) == 0x00U)
-				{
-					//correct
-					//distance upper, else error code if bit6 = 1
-					if((u8Value & 0x20U) == 0x20U)
-					{
-						//we have an error code
-						sFCU.sLaserDist.sBinary.u32Counter__ErrorCode++;
-					}
-					else
-					{
-						//we have the MSB value
-						sFCU.sLaserDist.sBinary.unRx.u8[2] = u8Value & 0x3F;
-					}
-
-				}
-				else
-				{
-					//error in distance measurement
-					sFCU.sLaserDist.sBinary.u32Counter__BadDistance++;
-				}
-
-				//in any condition, move on
-				sFCU.sLaserDist.eRxState = LASERDIST_RX__BYTE_0;
+		sFCU.sLaserDist.u8RxISR_Pending = 0U;
+		u64Time = sFCU.sLaserDist.u64RxISR_Time;
+	}
+	else
+	{
+		//polled, best we have is now
+		u64Time = u64RM4_RTI__Get_Counter1();
+	}
 
-			}
-			else
-			{
-				//maybe not for us, stay in state
-				sFCU.sLaserDist.sBinary.u32Counter__MissedStart++;
-			}
+	for(u8Counter = 0U; u8Counter < u8Count; u8Counter++)
+	{
+		vFCU_LASERDIST__Append_Byte(pu8Rx[u8Counter], u64Time);
+	}
+}
 
-			break;
 
-		case LASERDIST_RX__BYTE_0:
+/***************************************************************************//**
+ * @brief
+ * Append a new byte from the UART into the packet, handle framing and process
+ * the packet as soon as it completes.
+ * 
+ * @note
+ * There is no CRC in the millimetre binary format, only bit7 framing. A start
+ * byte seen mid packet means we lost bytes, the partial packet is dropped
+ * and we resync on the new start.
+ *
+ * @param[in]		u64Time				RTI counter 1 time of this byte
+ * @param[in]		u8Value				The new byte
+ * @st_funcMD5		9AC8F836FEB38BF39104D48FC1E7669A
+ * @st_funcID		LCCM655R0.FILE.033.FUNC.005
+ */
+void vFCU_LASERDIST__Append_Byte(Luint8 u8Value, Luint64 u64Time)
+{
 
-			//distance mid
-			// = "E" if there is an error
-			sFCU.sLaserDist.sBinary.unRx.u8[1] = u8Value;
+	if(sFCU.sLaserDist.eRxState == LASERDIST_RX__BYTE_D)
+	{
+		//waiting on a start byte
+		if((u8Value & 0x80U) == 0x80U)
+		{
 			sFCU.sLaserDist.u8NewByteArray[0] = u8Value;
-			sFCU.sLaserDist.eRxState = LASERDIST_RX__BYTE_1;
-			break;
-
-		case LASERDIST_RX__BYTE_1:
-
-			sFCU.sLaserDist.sBinary.unRx.u8[0] = u8Value;
-			sFCU.sLaserDist.u8NewByteArray[1] = u8Value;
-
-			//millimeter binary mode hack
-			sFCU.sLaserDist.u8NewPacket = 1U;
-
-			//go back and rx the next new packet
-			//in binary mode
-			sFCU.sLaserDist.eRxState = LASERDIST_RX__BYTE_D;
-
-			//sFCU.sLaserDist.eRxState = LASERDIST_RX__BYTE_2;
-			break;
-
-		case LASERDIST_RX__BYTE_2:
+			sFCU.sLaserDist.eRxState = LASERDIST_RX__BYTE_0;
+		}
+		else
+		{
+			//maybe not for us, stay in state
+			sFCU.sLaserDist.sBinary.u32Counter__MissedStart++;
+		}
+	}
+	else if((u8Value & 0x80U) == 0x80U)
+	{
+		//start byte mid packet, resync on it
+		sFCU.sLaserDist.sBinary.u32Counter__Framing++;
+		sFCU.sLaserDist.u8NewByteArray[0] = u8Value;
+		sFCU.sLaserDist.eRxState = LASERDIST_RX__BYTE_0;
+	}
+	else
+	{
 
-			sFCU.sLaserDist.u8NewByteArray[2] = u8Value;
-			sFCU.sLaserDist.eRxState = LASERDIST_RX__BYTE_3;
-			break;
+		//handle the laser distance rx states
+		switch(sFCU.sLaserDist.eRxState)
+		{
 
-		case LASERDIST_RX__BYTE_3:
+			case LASERDIST_RX__BYTE_0:
 
-			sFCU.sLaserDist.u8NewByteArray[3] = u8Value;
-			sFCU.sLaserDist.eRxState = LASERDIST_RX__BYTE_4;
-			break;
+				//distance mid
+				// = "E" if there is an error
+				sFCU.sLaserDist.u8NewByteArray[1] = u8Value;
+				sFCU.sLaserDist.eRxState = LASERDIST_RX__BYTE_1;
+				break;
 
-		case LASERDIST_RX__BYTE_4:
+			case LASERDIST_RX__BYTE_1:
 
-			sFCU.sLaserDist.u8NewByteArray[4] = u8Value;
+				//distance low
+				// = "R" if there is an error
+				sFCU.sLaserDist.u8NewByteArray[2] = u8Value;
 
-			//signal that a new packet is ready
-			sFCU.sLaserDist.u8NewPacket = 1U;
+			#if C_FCU__LASERDIST__AMPLITUDE_BYTE == 1U
+				sFCU.sLaserDist.eRxState = LASERDIST_RX__BYTE_2;
+			#else
+				vFCU_LASERDIST__Process_Packet(u64Time);
 
-			//clear the packets seeen counter
-			sFCU.sLaserDist.u32PacketsSeen_Counter = 0U;
+				//go back and rx the next new packet
+				sFCU.sLaserDist.eRxState = LASERDIST_RX__BYTE_D;
+			#endif
+				break;
 
-			//go back and rx the next new packet
-			sFCU.sLaserDist.eRxState = LASERDIST_RX__BYTE_D;
-			break;
+			case LASERDIST_RX__BYTE_2:
 
-		default:
-			//todo, log the error
-			break;
+				//amplitude / 16, not used
+				sFCU.sLaserDist.u8NewByteArray[3] = u8Value;
+				vFCU_LASERDIST__Process_Packet(u64Time);
 
-	}//switch
+				sFCU.sLaserDist.eRxState = LASERDIST_RX__BYTE_D;
+				break;
 
+			default:
+				//ASCII states are not used in binary mode
+				sFCU.sLaserDist.eRxState = LASERDIST_RX__BYTE_D;
+				break;
 
+		}//switch
 
+	}
 
 }
 
@@ -625,18 +693,75 @@ void vFCU_LASERDIST__100MS_ISR(void)
  * On win32, set the raw value only
  * 
  * @param[in]		f32Value				Raw value in laser units
- * @st_funcMD5		DA458286EBCD86D590BBDE6A5D8E372C
+ * @st_funcMD5		6A28056DD48E5DC26E44C57B8409E055
  * @st_funcID		LCCM655R0.FILE.033.FUNC.007
  */
 void vFCU_LASERDIST_WIN32__Set_DistanceRaw(Lint32 s32Value)
 {
 	sFCU.sLaserDist.s32Distance_mm = s32Value;
+	sFCU.sLaserDist.u8NewDistanceAvail = 1U;
+}
+
+/***************************************************************************//**
+ * @brief
+ * On win32, inject a distance as a binary packet received at a given time
+ * so the velocity and accel see the sample spacing
+ * 
+ * @param[in]		u64Time					RTI counter 1 when the packet arrived
+ * @param[in]		s32Value				Distance in mm
+ * @st_funcMD5		66DCF3C3B412E6AA6D6CDEFAA820AD62
+ * @st_funcID		LCCM655R0.FILE.033.FUNC.011
+ */
+void vFCU_LASERDIST_WIN32__Inject_Distance(Lint32 s32Value, Luint64 u64Time)
+{
+	Luint32 u32Distance;
+
+	//20 bits over the three bytes
+	if(s32Value < 0)
+	{
+		u32Distance = 0U;
+	}
+	else if(s32Value > 0x000FFFFF)
+	{
+		u32Distance = 0x000FFFFFU;
+	}
+	else
+	{
+		u32Distance = (Luint32)s32Value;
+	}
+
+	sFCU.sLaserDist.u8NewByteArray[0] = 0x80U | (Luint8)((u32Distance >> 14U) & 0x3FU);
+	sFCU.sLaserDist.u8NewByteArray[1] = (Luint8)((u32Distance >> 7U) & 0x7FU);
+	sFCU.sLaserDist.u8NewByteArray[2] = (Luint8)(u32Distance & 0x7FU);
+	vFCU_LASERDIST__Process_Packet(u64Time);
 }
 
 #endif
 
 
 #endif //C_LOCALDEF__LCCM655__ENABLE_LASER_DISTANCE
+
+#if C_LOCALDEF__LCCM655__ENABLE_THIS_MODULE == 1U
+/***************************************************************************//**
+ * @brief
+ * SC16 RX interrupt for the laser UART, call ahead of the SC16 driver ISR.
+ * The RTI time taken here goes with the packets drained after it.
+ * 
+ * @note
+ * Always present so the board support can wire it whether or not the laser
+ * distance is built in.
+ * 
+ * @st_funcMD5		DC7633F882034E0CD1881813BCAEE17D
+ * @st_funcID		LCCM655R0.FILE.033.FUNC.013
+ */
+void vFCU_LASERDIST__RX_ISR(void)
+{
+#if C_LOCALDEF__LCCM655__ENABLE_LASER_DISTANCE == 1U
+	sFCU.sLaserDist.u64RxISR_Time = u64RM4_RTI__Get_Counter1();
+	sFCU.sLaserDist.u8RxISR_Pending = 1U;
+#endif
+}
+#endif //#if C_LOCALDEF__LCCM655__ENABLE_THIS_MODULE == 1U
 /** @} */
 /** @} */
 /** @} */
@@ -43,7 +43,7 @@ void vFCU_LASERDIST_ETH__Init(void)
  * Transmith a laser distance eth packet
  * 
  * @param[in]		ePacketType				The packet type
- * @st_funcMD5		7CDEE346EA6FD4A5EBF1988276CEC563
+ * @st_funcMD5		8958B8B83FDF6EEA6710CAC38461318B
  * @st_funcID		LCCM655R0.FILE.058.FUNC.002
  */
 void vFCU_LASERDIST_ETH__Transmit(E_NET__PACKET_T ePacketType)
@@ -60,7 +60,7 @@ void vFCU_LASERDIST_ETH__Transmit(E_NET__PACKET_T ePacketType)
 	switch(ePacketType)
 	{
 		case NET_PKT__LASER_DIST__TX_LASER_DATA:
-			u16Length = 28U + 16U;
+			u16Length = 28U + 20U;
 			break;
 
 
@@ -121,6 +121,9 @@ void vFCU_LASERDIST_ETH__Transmit(E_NET__PACKET_T ePacketType)
 				vSIL3_NUM_CONVERT__Array_U32(pu8Buffer, sFCU.sLaserDist.sBinary.u32Counter__ErrorCode);
 				pu8Buffer += 4U;
 
+				vSIL3_NUM_CONVERT__Array_U32(pu8Buffer, sFCU.sLaserDist.sBinary.u32Counter__Framing);
+				pu8Buffer += 4U;
+
 				break;
 
 			default:
@@ -40,7 +40,9 @@
 		/** Force a flush of the DAQ system */
 		NET_PKT__FCU_GEN__DAQ_FLUSH = 0x00FFU,
 
-		/** Flight control data streaming */
+		/** Flight control data streaming
+		 * Block 0 = 1 on, 0 off. Block 1 = packet type, 0 with off stops everything.
+		 * Block 2 = period in ms, 0 = the default period */
 		NET_PKT__FCU_GEN__STREAMING_CONTROL = 0x0100U,
 
 		/** Transmit the mission data */
@@ -61,6 +63,18 @@
 		/** Pod State Machine Force State (FOR DEBUGGING ONLY) */
 		NET_PKT__FCU_GEN__MAINSM_DEBUG_FORCE_STATE = 0x0590U,
 
+		/** Request the main loop scheduler task timing, block 0 = 1 clears the stats instead */
+		NET_PKT__FCU_GEN__REQUEST_SCHED_TIMING = 0x0600U,
+
+		/** Main loop scheduler task timing */
+		NET_PKT__FCU_GEN__TX_SCHED_TIMING = 0x0601U,
+
+		/** Request the per subsystem profile, block 0 = 1 clears the probes instead */
+		NET_PKT__FCU_GEN__REQUEST_PROFILE = 0x0602U,
+
+		/** Per subsystem min/max/mean and log2 histograms, in timer ticks */
+		NET_PKT__FCU_GEN__TX_PROFILE = 0x0603U,
+
 
 		//////////////////////////////////////////////////////
 		//FCU: ACCEL (0x1000)
@@ -411,6 +425,17 @@
 		NET_PKT__LGU_DAQ__OFFSET_INDEX = 0x4300U,
 		NET_PKT__HE_THERM_DAQ__OFFSET_INDEX = 0x4400U,
 
+		//////////////////////////////////////////////////////
+		//DAQ PACKED (0x4800)
+		//////////////////////////////////////////////////////
+
+		/** Flight control DAQ, multi channel packed frame */
+		NET_PKT__FCU_DAQ__PACKED_FRAME = 0x4800U,
+
+		/** Flight control DAQ, schema for decoding the packed frames.
+		 * Sent by the host (no payload) to ask for the schema again */
+		NET_PKT__FCU_DAQ__PACKED_SCHEMA = 0x4801U,
+
 
 		//////////////////////////////////////////////////////
 		//XILINX HYPERLOOP SIMULATION (0x5000)
@@ -77,7 +77,7 @@ void vFCU_NET_RX__RxUDP(Luint8 *pu8Buffer, Luint16 u16Length, Luint16 u16DestPor
  * @param[in]		ePacketType				SafeUDP packet Type
  * @param[in]		u16PayloadLength		Length of only the SafeUDP payload
  * @param[in]		*pu8Payload				Pointer to the payload bytes
- * @st_funcMD5		AE79C707BD4D6398E47FD62875E2B42D
+ * @st_funcMD5		44E470E6637953414ED4E9C2BE30AE2B
  * @st_funcID		LCCM655R0.FILE.018.FUNC.002
  */
 void vFCU_NET_RX__RxSafeUDP(Luint8 *pu8Payload, Luint16 u16PayloadLength, Luint16 ePacketType, Luint16 u16DestPort, Luint16 u16Fault)
@@ -251,22 +251,69 @@ void vFCU_NET_RX__RxSafeUDP(Luint8 *pu8Payload, Luint16 u16PayloadLength, Luint1
 				#endif
 				break;
 
+			case NET_PKT__FCU_DAQ__PACKED_SCHEMA:
+				//host has lost track of the channel layout, send it again before the next frame
+				#if C_LOCALDEF__LCCM662__ENABLE_THIS_MODULE == 1U
+					#if C_LOCALDEF__LCCM662__ENABLE_PACKED_FRAMES == 1U
+						vSIL3_DAQ_PACKED__Request_Schema();
+					#endif
+				#endif
+				break;
+
 			case NET_PKT__FCU_GEN__STREAMING_CONTROL:
 				//if the host wants to stream data packets.
+				//Block 1 is the packet type, block 2 the period in ms (0 = default)
 				if(u32Block[0] == 1U)
 				{
-					//streaming on
-					sFCU.sUDPDiag.eTxStreamingType = (E_NET__PACKET_T)u32Block[1];
+					//streaming on, or a new rate
+					//round the period up to the 10ms tick so a short period never turns into the default
+					if(u32Block[2] > ((Luint32)0xFFFFU * 10U))
+					{
+						u32Block[2] = (Luint32)0xFFFFU * 10U;
+					}
+					else
+					{
+						//fall on
+					}
+					s16FCU_NET_TX__Set_Stream((E_NET__PACKET_T)u32Block[1], (Luint16)((u32Block[2] + 9U) / 10U));
 				}
 				else
 				{
-					//streaming off
-					sFCU.sUDPDiag.eTxStreamingType = NET_PKT__NONE;
+					//streaming off, type 0 = everything
+					vFCU_NET_TX__Stop_Stream((E_NET__PACKET_T)u32Block[1]);
 				}
 
 				break;
 
 
+			case NET_PKT__FCU_GEN__REQUEST_SCHED_TIMING:
+				#if C_LOCALDEF__LCCM655__ENABLE_SCHEDULER == 1U
+					//block 0 = 1 starts a new measurement instead
+					if(u32Block[0] == 1U)
+					{
+						vFCU_SCHED__Reset_Stats();
+					}
+					else
+					{
+						sFCU.sUDPDiag.eTxPacketType = NET_PKT__FCU_GEN__TX_SCHED_TIMING;
+					}
+				#endif
+				break;
+
+			case NET_PKT__FCU_GEN__REQUEST_PROFILE:
+				#if C_LOCALDEF__LCCM655__ENABLE_PROFILE == 1U
+					//block 0 = 1 starts a new measurement instead
+					if(u32Block[0] == 1U)
+					{
+						vFCU_SCHED_PROFILE__Reset();
+					}
+					else
+					{
+						sFCU.sUDPDiag.eTxPacketType = NET_PKT__FCU_GEN__TX_PROFILE;
+					}
+				#endif
+				break;
+
 			case NET_PKT__FCU_ACCEL__REQUEST_CAL_DATA:
 				//Host wants us to transmit the calibration data for the accelerometers system
 				sFCU.sUDPDiag.eTxPacketType = NET_PKT__FCU_ACCEL__TX_CAL_DATA;
@@ -22,22 +22,47 @@
 
 extern struct _strFCU sFCU;
 
+//locals
+static void vFCU_NET_TX__Transmit(E_NET__PACKET_T eType);
+static void vFCU_NET_TX__Update_Streams(void);
+
 /***************************************************************************//**
  * @brief
  * Init any network transmission stuff
  * 
- * @st_funcMD5		3020F529A976A8387FE2B8C35E80C91D
+ * @st_funcMD5		F69A2C5A5CDD32CE337163134E702AD9
  * @st_funcID		LCCM655R0.FILE.019.FUNC.001
  */
 void vFCU_NET_TX__Init(void)
 {
-	//Clear the timer flag
-	sFCU.sUDPDiag.u810MS_Flag = 0U;
-	sFCU.sUDPDiag.u8250MS_Flag = 0U;
+	Luint8 u8Counter;
+
+	//clear the timing
+	sFCU.sUDPDiag.u32ISR_Ticks = 0U;
+	sFCU.sUDPDiag.u32SlotTicks = 0U;
+	sFCU.sUDPDiag.u8RoundRobin = 0U;
 
 	//set our default packet types
 	sFCU.sUDPDiag.eTxPacketType = NET_PKT__NONE;
-	sFCU.sUDPDiag.eTxStreamingType = NET_PKT__FCU_GEN__TX_MISSION_DATA;
+
+	//empty rate table
+	for(u8Counter = 0U; u8Counter < C_FCU__NET_TX__MAX_STREAMS; u8Counter++)
+	{
+		sFCU.sUDPDiag.sStreams[u8Counter].eType = NET_PKT__NONE;
+		sFCU.sUDPDiag.sStreams[u8Counter].u16Period_x10ms = 0U;
+		sFCU.sUDPDiag.sStreams[u8Counter].u8Priority = C_FCU__NET_TX__PRIORITY_DIAG;
+		sFCU.sUDPDiag.sStreams[u8Counter].u8Pending = 0U;
+		sFCU.sUDPDiag.sStreams[u8Counter].u32Due_Ticks = 0U;
+		sFCU.sUDPDiag.sStreams[u8Counter].u32NextDue_Ticks = 0U;
+		sFCU.sUDPDiag.sStreams[u8Counter].u32TxCount = 0U;
+		sFCU.sUDPDiag.sStreams[u8Counter].u32DropCount = 0U;
+		sFCU.sUDPDiag.sStreams[u8Counter].u32LateCount = 0U;
+		sFCU.sUDPDiag.sStreams[u8Counter].u32MaxLate_x10ms = 0U;
+	}
+
+	//mission data and faults always stream unless the host turns them off
+	s16FCU_NET_TX__Set_Stream(NET_PKT__FCU_GEN__TX_MISSION_DATA, C_FCU__NET_TX__MISSION_PERIOD_X10MS);
+	s16FCU_NET_TX__Set_Stream(NET_PKT__FCU_GEN__TX_ALL_FAULT_FLAGS, C_FCU__NET_TX__FAULTS_PERIOD_X10MS);
 
 	#if C_LOCALDEF__LCCM655__ENABLE_SPACEX_TELEMETRY == 1U
 		vFCU_NET_SPACEX_TX__Init();
@@ -49,12 +74,16 @@ void vFCU_NET_TX__Init(void)
  * @brief
  * Process network transmission and do any transmission as required.
  * 
- * @st_funcMD5		EA13ABE6EE5E62C1BD340DD3329C2EB0
+ * @note
+ * One packet goes out per call. The EMAC is busy until that packet has gone,
+ * so anything else due waits for the next time around the main loop.
+ * 
+ * @st_funcMD5		3012BDDDD12D65A36D3687B96894D726
  * @st_funcID		LCCM655R0.FILE.019.FUNC.002
  */
 void vFCU_NET_TX__Process(void)
 {
-	Luint8 u8Flag;
+	Luint8 u8Free;
 	E_NET__PACKET_T eType;
 
 	//Do we need a timed spaceX packet
@@ -62,51 +91,339 @@ void vFCU_NET_TX__Process(void)
 		vFCU_NET_SPACEX_TX__Process();
 	#endif
 
-	//see if we have a streaming flag set
-	if(sFCU.sUDPDiag.eTxStreamingType != NET_PKT__NONE)
+	#ifndef WIN32
+		//don't queue behind a Tx in progress
+		if(u8RM4_EMAC_TX__Get_IsBusy() == 0U)
+		{
+			u8Free = 1U;
+		}
+		else
+		{
+			u8Free = 0U;
+		}
+	#else
+		u8Free = 1U;
+	#endif
+
+	if(u8Free == 1U)
 	{
-		//yes we do
+		//one off requests from the host go first
+		if(sFCU.sUDPDiag.eTxPacketType != NET_PKT__NONE)
+		{
+			eType = sFCU.sUDPDiag.eTxPacketType;
+			sFCU.sUDPDiag.eTxPacketType = NET_PKT__NONE;
+		}
+		else
+		{
+			eType = eFCU_NET_TX__Schedule();
+		}
 
-		//every 250ms broadcast our faults
-		if(sFCU.sUDPDiag.u8250MS_Flag > 25U)
+		if(eType != NET_PKT__NONE)
+		{
+			vFCU_NET_TX__Transmit(eType);
+		}
+		else
 		{
-			eType = NET_PKT__FCU_GEN__TX_ALL_FAULT_FLAGS;
+			//nothing due
+		}
+	}
+	else
+	{
+		//try next time
+	}
+
+}
+
+/***************************************************************************//**
+ * @brief
+ * Add a stream to the rate table, or change its period if it is already there
+ * 
+ * @param[in]		eType					Packet type to stream
+ * @param[in]		u16Period_x10ms			Period in 10ms ticks, 0 = default
+ * @return			0 = success\n
+ *					-1 = rate table is full
+ * @st_funcMD5		0D7A191853DD081348700BC41A6D0E55
+ * @st_funcID		LCCM655R0.FILE.019.FUNC.005
+ */
+Lint16 s16FCU_NET_TX__Set_Stream(E_NET__PACKET_T eType, Luint16 u16Period_x10ms)
+{
+	Luint8 u8Counter;
+	Luint8 u8Index;
+	Lint16 s16Return;
+
+	if(u16Period_x10ms == 0U)
+	{
+		u16Period_x10ms = C_FCU__NET_TX__DEFAULT_PERIOD_X10MS;
+	}
+	else
+	{
+		//fall on
+	}
 
-			//clear now
-			sFCU.sUDPDiag.u8250MS_Flag = 0U;
+	//already streaming, or the first free entry
+	u8Index = C_FCU__NET_TX__MAX_STREAMS;
+	for(u8Counter = 0U; u8Counter < C_FCU__NET_TX__MAX_STREAMS; u8Counter++)
+	{
+		if(sFCU.sUDPDiag.sStreams[u8Counter].eType == eType)
+		{
+			u8Index = u8Counter;
+			break;
+		}
+		else if((sFCU.sUDPDiag.sStreams[u8Counter].eType == NET_PKT__NONE) && (u8Index == C_FCU__NET_TX__MAX_STREAMS))
+		{
+			u8Index = u8Counter;
+		}
+		else
+		{
+			//fall on
+		}
+	}
 
+	if((eType != NET_PKT__NONE) && (u8Index < C_FCU__NET_TX__MAX_STREAMS))
+	{
+		if(sFCU.sUDPDiag.sStreams[u8Index].eType != eType)
+		{
+			//new stream, fresh counters
+			sFCU.sUDPDiag.sStreams[u8Index].u8Pending = 0U;
+			sFCU.sUDPDiag.sStreams[u8Index].u32TxCount = 0U;
+			sFCU.sUDPDiag.sStreams[u8Index].u32DropCount = 0U;
+			sFCU.sUDPDiag.sStreams[u8Index].u32LateCount = 0U;
+			sFCU.sUDPDiag.sStreams[u8Index].u32MaxLate_x10ms = 0U;
 		}
 		else
 		{
+			//just a rate change
+		}
 
-			//do we have a timer flag?
-			if(sFCU.sUDPDiag.u810MS_Flag > 4U)
-			{
-				//set it
-				eType = sFCU.sUDPDiag.eTxStreamingType;
+		switch(eType)
+		{
+			case NET_PKT__FCU_GEN__TX_MISSION_DATA:
+				sFCU.sUDPDiag.sStreams[u8Index].u8Priority = C_FCU__NET_TX__PRIORITY_MISSION;
+				break;
+
+			case NET_PKT__FCU_GEN__TX_ALL_FAULT_FLAGS:
+				sFCU.sUDPDiag.sStreams[u8Index].u8Priority = C_FCU__NET_TX__PRIORITY_FAULTS;
+				break;
+
+			default:
+				sFCU.sUDPDiag.sStreams[u8Index].u8Priority = C_FCU__NET_TX__PRIORITY_DIAG;
+				break;
+		}
+
+		sFCU.sUDPDiag.sStreams[u8Index].u16Period_x10ms = u16Period_x10ms;
+		sFCU.sUDPDiag.sStreams[u8Index].u32NextDue_Ticks = sFCU.sUDPDiag.u32SlotTicks + (Luint32)u16Period_x10ms;
+
+		//set the type last
+		sFCU.sUDPDiag.sStreams[u8Index].eType = eType;
+
+		s16Return = 0;
+	}
+	else
+	{
+		//no room
+		s16Return = -1;
+	}
+
+	return s16Return;
+}
+
+/***************************************************************************//**
+ * @brief
+ * Remove a stream from the rate table
+ * 
+ * @param[in]		eType					Packet type, NET_PKT__NONE stops all streams
+ * @st_funcMD5		6A30584961EC764BA315059632EC74B3
+ * @st_funcID		LCCM655R0.FILE.019.FUNC.006
+ */
+void vFCU_NET_TX__Stop_Stream(E_NET__PACKET_T eType)
+{
+	Luint8 u8Counter;
+
+	for(u8Counter = 0U; u8Counter < C_FCU__NET_TX__MAX_STREAMS; u8Counter++)
+	{
+		if((eType == NET_PKT__NONE) || (sFCU.sUDPDiag.sStreams[u8Counter].eType == eType))
+		{
+			sFCU.sUDPDiag.sStreams[u8Counter].eType = NET_PKT__NONE;
+			sFCU.sUDPDiag.sStreams[u8Counter].u8Pending = 0U;
+		}
+		else
+		{
+			//fall on
+		}
+	}
+}
 
-				//clear the flag now
-				sFCU.sUDPDiag.u810MS_Flag = 0U;
+/***************************************************************************//**
+ * @brief
+ * Pick the next streaming packet to send, if any.
+ * 
+ * @note
+ * The highest priority pending stream wins. At the same priority the one that
+ * has waited longest goes, then round robin from the last one sent, so a fast
+ * stream can't hog the link.
+ * 
+ * @return			The packet type, NET_PKT__NONE if nothing is due
+ * @st_funcMD5		414EC24A15F7B299F85E7BEC69B67002
+ * @st_funcID		LCCM655R0.FILE.019.FUNC.007
+ */
+E_NET__PACKET_T eFCU_NET_TX__Schedule(void)
+{
+	Luint8 u8Counter;
+	Luint8 u8Index;
+	Luint8 u8Best;
+	Luint32 u32Late;
+	E_NET__PACKET_T eType;
+
+	//bring the rate table up to date
+	vFCU_NET_TX__Update_Streams();
+
+	u8Best = C_FCU__NET_TX__MAX_STREAMS;
+	u8Index = sFCU.sUDPDiag.u8RoundRobin;
+	for(u8Counter = 0U; u8Counter < C_FCU__NET_TX__MAX_STREAMS; u8Counter++)
+	{
+		//start one after the last sent
+		u8Index++;
+		if(u8Index >= C_FCU__NET_TX__MAX_STREAMS)
+		{
+			u8Index = 0U;
+		}
+		else
+		{
+			//fall on
+		}
+
+		if(sFCU.sUDPDiag.sStreams[u8Index].u8Pending == 1U)
+		{
+			if(u8Best == C_FCU__NET_TX__MAX_STREAMS)
+			{
+				u8Best = u8Index;
+			}
+			else if(sFCU.sUDPDiag.sStreams[u8Index].u8Priority < sFCU.sUDPDiag.sStreams[u8Best].u8Priority)
+			{
+				u8Best = u8Index;
+			}
+			else if((sFCU.sUDPDiag.sStreams[u8Index].u8Priority == sFCU.sUDPDiag.sStreams[u8Best].u8Priority) &&
+					((Lint32)(sFCU.sUDPDiag.sStreams[u8Index].u32Due_Ticks - sFCU.sUDPDiag.sStreams[u8Best].u32Due_Ticks) < 0))
+			{
+				//same priority, oldest goes first
+				u8Best = u8Index;
 			}
 			else
 			{
-				//nope
-				eType = NET_PKT__NONE;
+				//first one found keeps it
 			}
-
 		}
+		else
+		{
+			//not due
+		}
+	}
 
+	if(u8Best < C_FCU__NET_TX__MAX_STREAMS)
+	{
+		eType = sFCU.sUDPDiag.sStreams[u8Best].eType;
+		sFCU.sUDPDiag.sStreams[u8Best].u8Pending = 0U;
+		sFCU.sUDPDiag.sStreams[u8Best].u32TxCount++;
 
+		//how long did it wait
+		u32Late = sFCU.sUDPDiag.u32SlotTicks - sFCU.sUDPDiag.sStreams[u8Best].u32Due_Ticks;
+		if(u32Late > 0U)
+		{
+			sFCU.sUDPDiag.sStreams[u8Best].u32LateCount++;
+			if(u32Late > sFCU.sUDPDiag.sStreams[u8Best].u32MaxLate_x10ms)
+			{
+				sFCU.sUDPDiag.sStreams[u8Best].u32MaxLate_x10ms = u32Late;
+			}
+			else
+			{
+				//fall on
+			}
+		}
+		else
+		{
+			//on time
+		}
+
+		sFCU.sUDPDiag.u8RoundRobin = u8Best;
 	}
 	else
 	{
-		//no streaming, but just harmlessly set the tx type incase it was
-		//requested by the host
-		eType = sFCU.sUDPDiag.eTxPacketType;
+		eType = NET_PKT__NONE;
 	}
 
+	return eType;
+}
+
+/***************************************************************************//**
+ * @brief
+ * Mark any streams that have come due since the last call.
+ * 
+ * @st_funcMD5		B2D78A6BD3EF0A031C5F6AED17D4E6E9
+ * @st_funcID		LCCM655R0.FILE.019.FUNC.008
+ */
+static void vFCU_NET_TX__Update_Streams(void)
+{
+	Luint8 u8Counter;
+	Luint32 u32Now;
+	Luint32 u32Missed;
+
+	//snapshot the ISR
+	u32Now = sFCU.sUDPDiag.u32ISR_Ticks;
+	if(u32Now != sFCU.sUDPDiag.u32SlotTicks)
+	{
+		sFCU.sUDPDiag.u32SlotTicks = u32Now;
 
-	//detemrine the packet type
+		for(u8Counter = 0U; u8Counter < C_FCU__NET_TX__MAX_STREAMS; u8Counter++)
+		{
+			if(sFCU.sUDPDiag.sStreams[u8Counter].eType != NET_PKT__NONE)
+			{
+				//signed compare so the tick counter can wrap
+				if((Lint32)(u32Now - sFCU.sUDPDiag.sStreams[u8Counter].u32NextDue_Ticks) >= 0)
+				{
+					if(sFCU.sUDPDiag.sStreams[u8Counter].u8Pending == 1U)
+					{
+						//last one never went
+						sFCU.sUDPDiag.sStreams[u8Counter].u32DropCount++;
+					}
+					else
+					{
+						sFCU.sUDPDiag.sStreams[u8Counter].u8Pending = 1U;
+						sFCU.sUDPDiag.sStreams[u8Counter].u32Due_Ticks = sFCU.sUDPDiag.sStreams[u8Counter].u32NextDue_Ticks;
+					}
+
+					//any whole periods we slept through are drops too, don't try to catch up
+					u32Missed = (u32Now - sFCU.sUDPDiag.sStreams[u8Counter].u32NextDue_Ticks) / (Luint32)sFCU.sUDPDiag.sStreams[u8Counter].u16Period_x10ms;
+					sFCU.sUDPDiag.sStreams[u8Counter].u32DropCount += u32Missed;
+					sFCU.sUDPDiag.sStreams[u8Counter].u32NextDue_Ticks += (u32Missed + 1U) * (Luint32)sFCU.sUDPDiag.sStreams[u8Counter].u16Period_x10ms;
+				}
+				else
+				{
+					//not yet
+				}
+			}
+			else
+			{
+				//free entry
+			}
+		}
+	}
+	else
+	{
+		//no new ticks
+	}
+}
+
+/***************************************************************************//**
+ * @brief
+ * Send a packet
+ * 
+ * @param[in]		eType					Packet type
+ * @st_funcMD5		7703C7A336424094171C4B9075CD6F08
+ * @st_funcID		LCCM655R0.FILE.019.FUNC.009
+ */
+static void vFCU_NET_TX__Transmit(E_NET__PACKET_T eType)
+{
+	//hand to the module that owns the packet
 	switch(eType)
 	{
 		case NET_PKT__FCU_GEN__TX_MISSION_DATA:
@@ -115,7 +432,6 @@ void vFCU_NET_TX__Process(void)
 					vFCU_FCTL_ETH__Transmit(eType);
 				#endif
 			#endif
-			sFCU.sUDPDiag.eTxPacketType = NET_PKT__NONE;
 			break;
 
 		case NET_PKT__FCU_GEN__TX_ALL_FAULT_FLAGS:
@@ -124,7 +440,18 @@ void vFCU_NET_TX__Process(void)
 				    vFCU_FAULTS_ETH__Transmit(eType);
                 #endif
 			#endif
-			sFCU.sUDPDiag.eTxPacketType = NET_PKT__NONE;
+			break;
+
+		case NET_PKT__FCU_GEN__TX_SCHED_TIMING:
+			#if C_LOCALDEF__LCCM655__ENABLE_SCHEDULER == 1U
+				vFCU_SCHED_ETH__Transmit(eType);
+			#endif
+			break;
+
+		case NET_PKT__FCU_GEN__TX_PROFILE:
+			#if C_LOCALDEF__LCCM655__ENABLE_PROFILE == 1U
+				vFCU_SCHED_ETH__Transmit(eType);
+			#endif
 			break;
 
 		case NET_PKT__FCU_ACCEL__TX_CAL_DATA:
@@ -132,40 +459,34 @@ void vFCU_NET_TX__Process(void)
 				vFCU_ACCEL_ETH__Transmit(eType);
 			#endif
 
-			sFCU.sUDPDiag.eTxPacketType = NET_PKT__NONE;
 			break;
 
 		case NET_PKT__FCU_ACCEL__TX_FULL_DATA:
 			#if C_LOCALDEF__LCCM655__ENABLE_ACCEL == 1U
 				vFCU_ACCEL_ETH__Transmit(eType);
 			#endif
-			sFCU.sUDPDiag.eTxPacketType = NET_PKT__NONE;
 			break;
 
 		case NET_PKT__LASER_OPTO__TX_LASER_DATA:
 			#if C_LOCALDEF__LCCM655__ENABLE_LASER_OPTONCDT == 1U
 				vFCU_LASEROPTO_ETH__Transmit(eType);
 			#endif
-			sFCU.sUDPDiag.eTxPacketType = NET_PKT__NONE;
 			break;
 
 		case NET_PKT__LASER_DIST__TX_LASER_DATA:
 			#if C_LOCALDEF__LCCM655__ENABLE_LASER_DISTANCE == 1U
 				vFCU_LASERDIST_ETH__Transmit(eType);
 			#endif
-			sFCU.sUDPDiag.eTxPacketType = NET_PKT__NONE;
 			break;
 
 		case NET_PKT__LASER_CONT__TX_LASER_DATA_0:
 			#if C_LOCALDEF__LCCM655__ENABLE_LASER_CONTRAST == 1U
 				vFCU_LASERCONT_ETH__Transmit(eType);
 			#endif
-			sFCU.sUDPDiag.eTxPacketType = NET_PKT__NONE;
 			break;
 
 		case NET_PKT__FCU_NAV__TX_NAV_PROGRESS:
 
-			sFCU.sUDPDiag.eTxPacketType = NET_PKT__NONE;
 			break;
 
 		case NET_PKT__FCU_BRAKES__TX_DATA:
@@ -173,28 +494,24 @@ void vFCU_NET_TX__Process(void)
 			#if C_LOCALDEF__LCCM655__ENABLE_BRAKES == 1U
 				vFCU_BRAKES_ETH__Transmit(eType);
 			#endif
-				sFCU.sUDPDiag.eTxPacketType = NET_PKT__NONE;
-			break;
+				break;
 
 		case NET_PKT__FCU_THROTTLE__TX_DATA:
 			#if C_LOCALDEF__LCCM655__ENABLE_THROTTLE == 1U
 				vFCU_THROTTLE_ETH__Transmit(eType);
 			#endif
-			sFCU.sUDPDiag.eTxPacketType = NET_PKT__NONE;
 			break;
 
 		case NET_PKT__FCU_PUSH__TX_PUSHER_DATA:
 			#if C_LOCALDEF__LCCM655__ENABLE_PUSHER == 1U
 				vFCU_PUSHER_ETH__Transmit(eType);
 			#endif
-			sFCU.sUDPDiag.eTxPacketType = NET_PKT__NONE;
 			break;
 
 		case NET_PKT__FCU_ASI__TX_ASI_DATA:
             #if C_LOCALDEF__LCCM655__ENABLE_ASI_RS485 == 1U
 			    vFCU_ASI_ETH__Transmit(eType);
             #endif
-			sFCU.sUDPDiag.eTxPacketType = NET_PKT__NONE;
 			break;
 
 		default:
@@ -208,15 +525,14 @@ void vFCU_NET_TX__Process(void)
 /***************************************************************************//**
  * @brief
  * To be called from the 10ms timer routine
- * Sets a flag to allow this module to determine that 10ms has elapsed
+ * Counts the ticks the rate table runs from
  * 
- * @st_funcMD5		0E696ED29F4B0A382C0A3760520AA2BE
+ * @st_funcMD5		BABDEC08F2D958F9D0BA57D851425A06
  * @st_funcID		LCCM655R0.FILE.019.FUNC.003
  */
 void vFCU_NET_TX__10MS_ISR(void)
 {
-	sFCU.sUDPDiag.u810MS_Flag ++;
-	sFCU.sUDPDiag.u8250MS_Flag++;
+	sFCU.sUDPDiag.u32ISR_Ticks++;
 }
 
 /***************************************************************************//**
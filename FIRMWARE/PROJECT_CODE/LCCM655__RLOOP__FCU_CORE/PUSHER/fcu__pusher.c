@@ -218,7 +218,7 @@ void vFCU_PUSHER__Process(void)
  * @brief
  * Called from the N2HET notifications that an edge has occurred on Interlock A
  * 
- * @st_funcMD5		F532E783C3D9B9BC924CFEFB16029DC8
+ * @st_funcMD5		7D74FA406D755A90A486DAA9352A7544
  * @st_funcID		LCCM655R0.FILE.012.FUNC.003
  */
 void vFCU_PUSHER__InterlockA_ISR(void)
@@ -226,6 +226,10 @@ void vFCU_PUSHER__InterlockA_ISR(void)
 	#if C_LOCALDEF__LCCM655__ENABLE_PUSHER == 1U
 		//indicate that the pusher interlock A has had an edge and we should re-read the pin
 		sFCU.sPusher.sSwitches[0].u8EdgeFlag = 1U;
+
+		#if C_LOCALDEF__LCCM655__ENABLE_SCHEDULER == 1U
+			vFCU_SCHED__Set_Ready(FCU_SCHED__PUSHER);
+		#endif
 	#endif
 }
 
@@ -233,7 +237,7 @@ void vFCU_PUSHER__InterlockA_ISR(void)
  * @brief
  * Called from the N2HET notifications that an edge has occurred on Interlock B
  * 
- * @st_funcMD5		F66C164179E4FC4101AE1B9F280DA709
+ * @st_funcMD5		BE72D0AC3B2B81D9AF6109B0BB533D87
  * @st_funcID		LCCM655R0.FILE.012.FUNC.004
  */
 void vFCU_PUSHER__InterlockB_ISR(void)
@@ -241,6 +245,10 @@ void vFCU_PUSHER__InterlockB_ISR(void)
 	#if C_LOCALDEF__LCCM655__ENABLE_PUSHER == 1U
 		//indicate that the pusher interlock A has had an edge and we should re-read the pin
 		sFCU.sPusher.sSwitches[1].u8EdgeFlag = 1U;
+
+		#if C_LOCALDEF__LCCM655__ENABLE_SCHEDULER == 1U
+			vFCU_SCHED__Set_Ready(FCU_SCHED__PUSHER);
+		#endif
 	#endif
 }
 
@@ -0,0 +1,506 @@
+/**
+ * @file		FCU__SCHED.C
+ * @brief		Cooperative main loop scheduler
+ * @author		Lachlan Grogan
+ * @copyright	rLoop Inc.
+ */
+/**
+ * @addtogroup RLOOP
+ * @{ */
+/**
+ * @addtogroup FCU
+ * @ingroup RLOOP
+ * @{ */
+/**
+ * @addtogroup FCU__SCHED
+ * @ingroup FCU
+ * @{ */
+
+#include "../fcu_core.h"
+
+#if C_LOCALDEF__LCCM655__ENABLE_THIS_MODULE == 1U
+#if C_LOCALDEF__LCCM655__ENABLE_SCHEDULER == 1U
+
+extern struct _strFCU sFCU;
+
+//locals
+static void vFCU_SCHED__Add_Task(E_FCU_SCHED__TASK_T eTask, void (*pFunc)(void), Luint8 u8Priority, Luint16 u16Period_x10ms, Luint8 u8Critical);
+static void vFCU_SCHED__Sort(void);
+#if C_LOCALDEF__LCCM487__ENABLE_THIS_MODULE == 1U
+	static void vFCU_SCHED__Task_SC16(void);
+#endif
+#if C_LOCALDEF__LCCM655__ENABLE_THROTTLE == 1U
+	static void vFCU_SCHED__Task_Throttle(void);
+#endif
+
+
+/***************************************************************************//**
+ * @brief
+ * Build the task table from what is compiled in.
+ *
+ * @note
+ * Periodic tasks are also run early when an ISR marks them ready. Anything
+ * whose state machine expects to be called every pass is left polled.
+ *
+ * @st_funcMD5		6E7551F5AF0B5AB441B1F03E1C352B09
+ * @st_funcID		LCCM655R0.FILE.099.FUNC.001
+ */
+void vFCU_SCHED__Init(void)
+{
+	Luint8 u8Counter;
+
+	sFCU.sSched.u32ISR_Ticks = 0U;
+
+	for(u8Counter = 0U; u8Counter < (Luint8)FCU_SCHED__MAX; u8Counter++)
+	{
+		vFCU_SCHED__Add_Task((E_FCU_SCHED__TASK_T)u8Counter, 0, C_FCU__SCHED__PRIORITY_BACKGROUND, 0U, 0U);
+	}
+
+#ifndef WIN32
+	#if C_LOCALDEF__LCCM414__ENABLE_THIS_MODULE == 1U
+		vFCU_SCHED__Add_Task(FCU_SCHED__ADC, &vRM4_ADC_USER__Process, C_FCU__SCHED__PRIORITY_SENSOR, 0U, 0U);
+	#endif
+
+	//cycle counter for the task timing
+	_pmuInit_();
+	_pmuEnableCountersGlobal_();
+	_pmuResetCycleCounter_();
+	_pmuStartCounters_(pmuCYCLE_COUNTER);
+#endif
+
+	//the SC16 drain must stay ahead of the laser distance, same priority keeps the table order
+	#if C_LOCALDEF__LCCM487__ENABLE_THIS_MODULE == 1U
+		vFCU_SCHED__Add_Task(FCU_SCHED__SC16, &vFCU_SCHED__Task_SC16, C_FCU__SCHED__PRIORITY_CRITICAL, 0U, 0U);
+	#endif
+
+	#if C_LOCALDEF__LCCM655__ENABLE_LASER_DISTANCE == 1U
+		//9600 baud, 10 bytes per tick at most
+		vFCU_SCHED__Add_Task(FCU_SCHED__LASERDIST, &vFCU_LASERDIST__Process, C_FCU__SCHED__PRIORITY_CRITICAL, 1U, 1U);
+	#endif
+
+	#if C_LOCALDEF__LCCM655__ENABLE_THROTTLE == 1U
+		vFCU_SCHED__Add_Task(FCU_SCHED__THROTTLE, &vFCU_SCHED__Task_Throttle, C_FCU__SCHED__PRIORITY_SENSOR, 0U, 0U);
+	#endif
+
+	#if C_LOCALDEF__LCCM655__ENABLE_ETHERNET == 1U
+		vFCU_SCHED__Add_Task(FCU_SCHED__NET, &vFCU_NET__Process, C_FCU__SCHED__PRIORITY_COMMS, 0U, 0U);
+	#endif
+
+	#if C_LOCALDEF__LCCM655__ENABLE_LASER_OPTONCDT == 1U
+		vFCU_SCHED__Add_Task(FCU_SCHED__LASEROPTO, &vFCU_LASEROPTO__Process, C_FCU__SCHED__PRIORITY_SENSOR, 0U, 0U);
+	#endif
+
+	#if C_LOCALDEF__LCCM655__ENABLE_LASER_CONTRAST == 1U
+		//edges are timestamped in the ISR, the ISR marks us ready
+		vFCU_SCHED__Add_Task(FCU_SCHED__LASERCONT, &vFCU_LASERCONT__Process, C_FCU__SCHED__PRIORITY_CRITICAL, 1U, 1U);
+	#endif
+
+	#if C_LOCALDEF__LCCM655__ENABLE_PUSHER == 1U
+		//switch debounce runs on 10ms ticks anyway, the interlock ISRs mark us ready
+		vFCU_SCHED__Add_Task(FCU_SCHED__PUSHER, &vFCU_PUSHER__Process, C_FCU__SCHED__PRIORITY_SENSOR, 1U, 0U);
+	#endif
+
+	#if C_LOCALDEF__LCCM655__ENABLE_BRAKES == 1U
+		vFCU_SCHED__Add_Task(FCU_SCHED__BRAKES, &vFCU_BRAKES__Process, C_FCU__SCHED__PRIORITY_CRITICAL, 0U, 1U);
+	#endif
+
+	#if C_LOCALDEF__LCCM655__ENABLE_ACCEL == 1U
+		#if C_LOCALDEF__LCCM655__ENABLE_ACCEL_FIFO == 1U
+			//the device FIFO holds more than 10ms
+			vFCU_SCHED__Add_Task(FCU_SCHED__ACCEL, &vFCU_ACCEL__Process, C_FCU__SCHED__PRIORITY_CRITICAL, 1U, 1U);
+		#else
+			vFCU_SCHED__Add_Task(FCU_SCHED__ACCEL, &vFCU_ACCEL__Process, C_FCU__SCHED__PRIORITY_CRITICAL, 0U, 1U);
+		#endif
+	#endif
+
+	#if C_LOCALDEF__LCCM655__ENABLE_ASI_RS485 == 1U
+		vFCU_SCHED__Add_Task(FCU_SCHED__ASI, &vFCU_ASI__Process, C_FCU__SCHED__PRIORITY_COMMS, 0U, 0U);
+	#endif
+
+	#if C_LOCALDEF__LCCM655__ENABLE_FLIGHT_CONTROL == 1U
+		vFCU_SCHED__Add_Task(FCU_SCHED__FCTL, &vFCU_FCTL__Process, C_FCU__SCHED__PRIORITY_CRITICAL, 0U, 1U);
+	#endif
+
+	#if C_LOCALDEF__LCCM662__ENABLE_THIS_MODULE == 1U
+		vFCU_SCHED__Add_Task(FCU_SCHED__DAQ, &vSIL3_DAQ__Process, C_FCU__SCHED__PRIORITY_BACKGROUND, 0U, 0U);
+	#endif
+
+	//fault flags only need to be current for the telemetry
+	vFCU_SCHED__Add_Task(FCU_SCHED__FAULTS, &vFCU_FAULTS__Process, C_FCU__SCHED__PRIORITY_BACKGROUND, 10U, 0U);
+
+	vFCU_SCHED__Sort();
+	vFCU_SCHED__Reset_Stats();
+
+	#if C_LOCALDEF__LCCM655__ENABLE_PROFILE == 1U
+		vFCU_SCHED_PROFILE__Init();
+	#endif
+
+}
+
+
+/***************************************************************************//**
+ * @brief
+ * One pass of the main loop, run whatever is ready in priority order and
+ * time it.
+ *
+ * @st_funcMD5		DED7D8609D1B891FD92D40E84C3080B3
+ * @st_funcID		LCCM655R0.FILE.099.FUNC.002
+ */
+void vFCU_SCHED__Process(void)
+{
+	Luint8 u8Counter;
+	Luint8 u8Task;
+	Luint8 u8Run;
+	Luint32 u32Now;
+	Luint32 u32PassStart;
+	Luint32 u32Start;
+	Luint32 u32Time;
+	Luint32 u32Critical;
+
+	//snapshot so the whole pass sees the same tick
+	u32Now = sFCU.sSched.u32ISR_Ticks;
+	u32Critical = 0U;
+	u32PassStart = u32FCU_SCHED__Get_Timer();
+
+	for(u8Counter = 0U; u8Counter < (Luint8)FCU_SCHED__MAX; u8Counter++)
+	{
+		u8Task = sFCU.sSched.u8Order[u8Counter];
+
+		if(sFCU.sSched.sTasks[u8Task].pFunc != 0)
+		{
+			if(sFCU.sSched.sTasks[u8Task].u16Period_x10ms == 0U)
+			{
+				//polled
+				u8Run = 1U;
+			}
+			else if(sFCU.sSched.sTasks[u8Task].u8Ready == 1U)
+			{
+				//ISR has work for us
+				u8Run = 1U;
+			}
+			else if(u32Now >= sFCU.sSched.sTasks[u8Task].u32NextDue_Ticks)
+			{
+				u8Run = 1U;
+			}
+			else
+			{
+				u8Run = 0U;
+			}
+
+			if(u8Run == 1U)
+			{
+				//clear before the run so an ISR during it is not lost
+				sFCU.sSched.sTasks[u8Task].u8Ready = 0U;
+				sFCU.sSched.sTasks[u8Task].u32NextDue_Ticks = u32Now + (Luint32)sFCU.sSched.sTasks[u8Task].u16Period_x10ms;
+
+				u32Start = u32FCU_SCHED__Get_Timer();
+				#if C_LOCALDEF__LCCM655__ENABLE_PROFILE == 1U
+					//task index is the probe index
+					vFCU_SCHED_PROFILE__Start(u8Task);
+				#endif
+
+				sFCU.sSched.sTasks[u8Task].pFunc();
+
+				#if C_LOCALDEF__LCCM655__ENABLE_PROFILE == 1U
+					vFCU_SCHED_PROFILE__Stop(u8Task);
+				#endif
+				u32Time = u32FCU_SCHED__Get_Timer() - u32Start;
+
+				sFCU.sSched.sTasks[u8Task].u32Runs++;
+				sFCU.sSched.sTasks[u8Task].u32Last_Ticks = u32Time;
+				sFCU.sSched.sTasks[u8Task].u64Total_Ticks += (Luint64)u32Time;
+				if(u32Time > sFCU.sSched.sTasks[u8Task].u32Max_Ticks)
+				{
+					sFCU.sSched.sTasks[u8Task].u32Max_Ticks = u32Time;
+				}
+				else
+				{
+					//fall on
+				}
+				if(u32Time > sFCU.sSched.sTasks[u8Task].u32Budget_Ticks)
+				{
+					sFCU.sSched.sTasks[u8Task].u32Overruns++;
+				}
+				else
+				{
+					//fall on
+				}
+
+				if(sFCU.sSched.sTasks[u8Task].u8Critical == 1U)
+				{
+					u32Critical += u32Time;
+				}
+				else
+				{
+					//fall on
+				}
+			}
+			else
+			{
+				//nothing to do this pass
+			}
+		}
+		else
+		{
+			//not built
+		}
+	}
+
+	sFCU.sSched.u32Pass_Last_Ticks = u32FCU_SCHED__Get_Timer() - u32PassStart;
+	if(sFCU.sSched.u32Pass_Last_Ticks > sFCU.sSched.u32Pass_Max_Ticks)
+	{
+		sFCU.sSched.u32Pass_Max_Ticks = sFCU.sSched.u32Pass_Last_Ticks;
+	}
+	else
+	{
+		//fall on
+	}
+
+	sFCU.sSched.u32Critical_Last_Ticks = u32Critical;
+	if(u32Critical > sFCU.sSched.u32Critical_Max_Ticks)
+	{
+		sFCU.sSched.u32Critical_Max_Ticks = u32Critical;
+	}
+	else
+	{
+		//fall on
+	}
+	if(u32Critical > (C_FCU__SCHED__CRITICAL_BUDGET_US * C_FCU__SCHED__TICKS_PER_US))
+	{
+		sFCU.sSched.u32Critical_Misses++;
+	}
+	else
+	{
+		//fall on
+	}
+
+}
+
+/***************************************************************************//**
+ * @brief
+ * Mark a task as having work, safe to call from an ISR.
+ *
+ * @param[in]		eTask					The task
+ * @st_funcMD5		CB653B7F26ED7D081C814F682F70EEC1
+ * @st_funcID		LCCM655R0.FILE.099.FUNC.003
+ */
+void vFCU_SCHED__Set_Ready(E_FCU_SCHED__TASK_T eTask)
+{
+	if(eTask < FCU_SCHED__MAX)
+	{
+		sFCU.sSched.sTasks[eTask].u8Ready = 1U;
+	}
+	else
+	{
+		//error
+	}
+}
+
+/***************************************************************************//**
+ * @brief
+ * Clear the timing stats
+ *
+ * @st_funcMD5		CB22F44A16A72DC4AFF0119B5E2B6C8E
+ * @st_funcID		LCCM655R0.FILE.099.FUNC.004
+ */
+void vFCU_SCHED__Reset_Stats(void)
+{
+	Luint8 u8Counter;
+
+	for(u8Counter = 0U; u8Counter < (Luint8)FCU_SCHED__MAX; u8Counter++)
+	{
+		sFCU.sSched.sTasks[u8Counter].u32Runs = 0U;
+		sFCU.sSched.sTasks[u8Counter].u32Last_Ticks = 0U;
+		sFCU.sSched.sTasks[u8Counter].u32Max_Ticks = 0U;
+		sFCU.sSched.sTasks[u8Counter].u64Total_Ticks = 0U;
+		sFCU.sSched.sTasks[u8Counter].u32Overruns = 0U;
+	}
+
+	sFCU.sSched.u32Pass_Last_Ticks = 0U;
+	sFCU.sSched.u32Pass_Max_Ticks = 0U;
+	sFCU.sSched.u32Critical_Last_Ticks = 0U;
+	sFCU.sSched.u32Critical_Max_Ticks = 0U;
+	sFCU.sSched.u32Critical_Misses = 0U;
+}
+
+/***************************************************************************//**
+ * @brief
+ * Worst case run time of a task
+ *
+ * @param[in]		eTask					The task
+ * @return			Time in us
+ * @st_funcMD5		C38FF2C12194E0A296FEDBDCDF311B46
+ * @st_funcID		LCCM655R0.FILE.099.FUNC.005
+ */
+Luint32 u32FCU_SCHED__Get_Max_us(E_FCU_SCHED__TASK_T eTask)
+{
+	Luint32 u32Return;
+
+	if(eTask < FCU_SCHED__MAX)
+	{
+		u32Return = sFCU.sSched.sTasks[eTask].u32Max_Ticks / C_FCU__SCHED__TICKS_PER_US;
+	}
+	else
+	{
+		u32Return = 0U;
+	}
+
+	return u32Return;
+}
+
+/***************************************************************************//**
+ * @brief
+ * Average run time of a task
+ *
+ * @param[in]		eTask					The task
+ * @return			Time in us
+ * @st_funcMD5		9A3FB97B2206AE9901A8C698A7C783B2
+ * @st_funcID		LCCM655R0.FILE.099.FUNC.006
+ */
+Luint32 u32FCU_SCHED__Get_Avg_us(E_FCU_SCHED__TASK_T eTask)
+{
+	Luint32 u32Return;
+
+	if(eTask < FCU_SCHED__MAX)
+	{
+		if(sFCU.sSched.sTasks[eTask].u32Runs > 0U)
+		{
+			u32Return = (Luint32)(sFCU.sSched.sTasks[eTask].u64Total_Ticks / (Luint64)sFCU.sSched.sTasks[eTask].u32Runs);
+			u32Return /= C_FCU__SCHED__TICKS_PER_US;
+		}
+		else
+		{
+			u32Return = 0U;
+		}
+	}
+	else
+	{
+		u32Return = 0U;
+	}
+
+	return u32Return;
+}
+
+/***************************************************************************//**
+ * @brief
+ * To be called from the 10ms timer routine
+ *
+ * @st_funcMD5		109B8109111C9D06C3EE6F6A5A940CCB
+ * @st_funcID		LCCM655R0.FILE.099.FUNC.007
+ */
+void vFCU_SCHED__10MS_ISR(void)
+{
+	sFCU.sSched.u32ISR_Ticks++;
+}
+
+/***************************************************************************//**
+ * @brief
+ * Free running timer for the task timing, wraps. C_FCU__SCHED__TICKS_PER_US
+ * ticks per us.
+ *
+ * @return			Timer ticks
+ * @st_funcMD5		71DFC92492425CBF42ACA053234127C5
+ * @st_funcID		LCCM655R0.FILE.099.FUNC.009
+ */
+Luint32 u32FCU_SCHED__Get_Timer(void)
+{
+#ifndef WIN32
+	return _pmuGetCycleCount_();
+#else
+	return (Luint32)u64RM4_RTI__Get_Counter1();
+#endif
+}
+
+#ifdef WIN32
+/***************************************************************************//**
+ * @brief
+ * Replace a task entry so the scheduler can be tested on its own.
+ *
+ * @note
+ * Call vFCU_SCHED__Init() again to get the real table back.
+ *
+ * @param[in]		u8Critical				1 = part of the brake and nav chain
+ * @param[in]		u16Period_x10ms			Run period, 0 = every pass
+ * @param[in]		u8Priority				0 is the highest
+ * @param[in]		pFunc					New function, 0 to remove the task
+ * @param[in]		eTask					The task
+ * @st_funcMD5		1CE45D9786A73AB60A9182A7E8D801A0
+ * @st_funcID		LCCM655R0.FILE.099.FUNC.008
+ */
+void vFCU_SCHED_WIN32__Set_Task(E_FCU_SCHED__TASK_T eTask, void (*pFunc)(void), Luint8 u8Priority, Luint16 u16Period_x10ms, Luint8 u8Critical)
+{
+	if(eTask < FCU_SCHED__MAX)
+	{
+		vFCU_SCHED__Add_Task(eTask, pFunc, u8Priority, u16Period_x10ms, u8Critical);
+		vFCU_SCHED__Sort();
+	}
+	else
+	{
+		//error
+	}
+}
+#endif
+
+//fill in a task entry, due on the first pass
+static void vFCU_SCHED__Add_Task(E_FCU_SCHED__TASK_T eTask, void (*pFunc)(void), Luint8 u8Priority, Luint16 u16Period_x10ms, Luint8 u8Critical)
+{
+	sFCU.sSched.sTasks[eTask].pFunc = pFunc;
+	sFCU.sSched.sTasks[eTask].u8Priority = u8Priority;
+	sFCU.sSched.sTasks[eTask].u8Critical = u8Critical;
+	sFCU.sSched.sTasks[eTask].u16Period_x10ms = u16Period_x10ms;
+	sFCU.sSched.sTasks[eTask].u8Ready = 0U;
+	sFCU.sSched.sTasks[eTask].u32NextDue_Ticks = sFCU.sSched.u32ISR_Ticks;
+	sFCU.sSched.sTasks[eTask].u32Budget_Ticks = C_FCU__SCHED__TASK_BUDGET_US * C_FCU__SCHED__TICKS_PER_US;
+}
+
+//insertion sort on priority, stable so equal priorities keep the table order
+static void vFCU_SCHED__Sort(void)
+{
+	Luint8 u8Counter;
+	Luint8 u8Pos;
+	Luint8 u8Task;
+
+	for(u8Counter = 0U; u8Counter < (Luint8)FCU_SCHED__MAX; u8Counter++)
+	{
+		u8Task = u8Counter;
+		u8Pos = u8Counter;
+		while((u8Pos > 0U) && (sFCU.sSched.sTasks[sFCU.sSched.u8Order[u8Pos - 1U]].u8Priority > sFCU.sSched.sTasks[u8Task].u8Priority))
+		{
+			sFCU.sSched.u8Order[u8Pos] = sFCU.sSched.u8Order[u8Pos - 1U];
+			u8Pos--;
+		}
+		sFCU.sSched.u8Order[u8Pos] = u8Task;
+	}
+}
+
+#if C_LOCALDEF__LCCM487__ENABLE_THIS_MODULE == 1U
+//all the SC16 UART bridges
+static void vFCU_SCHED__Task_SC16(void)
+{
+	Luint8 u8Counter;
+
+	for(u8Counter = 0U; u8Counter < C_LOCALDEF__LCCM487__NUM_DEVICES; u8Counter++)
+	{
+		vSIL3_SC16__Process(u8Counter);
+	}
+}
+#endif
+
+#if C_LOCALDEF__LCCM655__ENABLE_THROTTLE == 1U
+//throttles and the DAC behind them
+static void vFCU_SCHED__Task_Throttle(void)
+{
+	vFCU_THROTTLE__Process();
+	vAMC7812__Process();
+}
+#endif
+
+#endif //C_LOCALDEF__LCCM655__ENABLE_SCHEDULER
+#endif //#if C_LOCALDEF__LCCM655__ENABLE_THIS_MODULE == 1U
+//safetys
+#ifndef C_LOCALDEF__LCCM655__ENABLE_THIS_MODULE
+	#error
+#endif
+/** @} */
+/** @} */
+/** @} */
@@ -0,0 +1,193 @@
+/**
+ * @file		FCU__SCHED__ETHERNET.C
+ * @brief		Ethernet UDP diagnostics for the main loop scheduler
+ * @author		Lachlan Grogan
+ * @copyright	rLoop Inc.
+ */
+/**
+ * @addtogroup RLOOP
+ * @{ */
+/**
+ * @addtogroup FCU
+ * @ingroup RLOOP
+ * @{ */
+/**
+ * @addtogroup FCU__SCHED__ETHERNET
+ * @ingroup FCU
+ * @{ */
+
+#include "../fcu_core.h"
+
+#if C_LOCALDEF__LCCM655__ENABLE_THIS_MODULE == 1U
+#if C_LOCALDEF__LCCM655__ENABLE_SCHEDULER == 1U
+#if C_LOCALDEF__LCCM655__ENABLE_ETHERNET == 1U
+
+extern struct _strFCU sFCU;
+
+/***************************************************************************//**
+ * @brief
+ * Transmit the scheduler timing, all times in us. Or the profiler probes,
+ * all times in timer ticks.
+ *
+ * @param[in]		ePacketType				The packet type
+ * @st_funcMD5		02B2B63181A6C8B2CD42646D40C8EEAB
+ * @st_funcID		LCCM655R0.FILE.100.FUNC.001
+ */
+void vFCU_SCHED_ETH__Transmit(E_NET__PACKET_T ePacketType)
+{
+
+	Lint16 s16Return;
+	Luint8 * pu8Buffer;
+	Luint8 u8BufferIndex;
+	Luint16 u16Length;
+	Luint8 u8Counter;
+#if C_LOCALDEF__LCCM655__ENABLE_PROFILE == 1U
+	Luint8 u8Bin;
+#endif
+
+	pu8Buffer = 0;
+
+	//setup length based on packet.
+	switch(ePacketType)
+	{
+		case NET_PKT__FCU_GEN__TX_SCHED_TIMING:
+			u16Length = 24U + ((Luint16)FCU_SCHED__MAX * 20U);
+			break;
+
+#if C_LOCALDEF__LCCM655__ENABLE_PROFILE == 1U
+		case NET_PKT__FCU_GEN__TX_PROFILE:
+			u16Length = 8U + ((Luint16)C_FCU__PROFILE__NUM_PROBES * (C_FCU__PROFILE__NAME_LENGTH + 16U + (C_FCU__PROFILE__HIST_BINS * 2U)));
+			break;
+#endif
+
+		default:
+			u16Length = 0U;
+			break;
+
+	}//switch(ePacketType)
+
+	//pre-comit
+	s16Return = s16SIL3_SAFEUDP_TX__PreCommit(u16Length, (SAFE_UDP__PACKET_T)ePacketType, &pu8Buffer, &u8BufferIndex);
+	if(s16Return == 0)
+	{
+		//handle the packet
+		switch(ePacketType)
+		{
+			case NET_PKT__FCU_GEN__TX_SCHED_TIMING:
+
+				//timer resolution
+				vSIL3_NUM_CONVERT__Array_U32(pu8Buffer, C_FCU__SCHED__TICKS_PER_US);
+				pu8Buffer += 4U;
+
+				//whole pass
+				vSIL3_NUM_CONVERT__Array_U32(pu8Buffer, sFCU.sSched.u32Pass_Last_Ticks / C_FCU__SCHED__TICKS_PER_US);
+				pu8Buffer += 4U;
+
+				vSIL3_NUM_CONVERT__Array_U32(pu8Buffer, sFCU.sSched.u32Pass_Max_Ticks / C_FCU__SCHED__TICKS_PER_US);
+				pu8Buffer += 4U;
+
+				//brake and nav chain
+				vSIL3_NUM_CONVERT__Array_U32(pu8Buffer, sFCU.sSched.u32Critical_Last_Ticks / C_FCU__SCHED__TICKS_PER_US);
+				pu8Buffer += 4U;
+
+				vSIL3_NUM_CONVERT__Array_U32(pu8Buffer, sFCU.sSched.u32Critical_Max_Ticks / C_FCU__SCHED__TICKS_PER_US);
+				pu8Buffer += 4U;
+
+				vSIL3_NUM_CONVERT__Array_U32(pu8Buffer, sFCU.sSched.u32Critical_Misses);
+				pu8Buffer += 4U;
+
+				//each task in E_FCU_SCHED__TASK_T order
+				for(u8Counter = 0U; u8Counter < (Luint8)FCU_SCHED__MAX; u8Counter++)
+				{
+					vSIL3_NUM_CONVERT__Array_U32(pu8Buffer, sFCU.sSched.sTasks[u8Counter].u32Runs);
+					pu8Buffer += 4U;
+
+					vSIL3_NUM_CONVERT__Array_U32(pu8Buffer, sFCU.sSched.sTasks[u8Counter].u32Last_Ticks / C_FCU__SCHED__TICKS_PER_US);
+					pu8Buffer += 4U;
+
+					vSIL3_NUM_CONVERT__Array_U32(pu8Buffer, u32FCU_SCHED__Get_Max_us((E_FCU_SCHED__TASK_T)u8Counter));
+					pu8Buffer += 4U;
+
+					vSIL3_NUM_CONVERT__Array_U32(pu8Buffer, u32FCU_SCHED__Get_Avg_us((E_FCU_SCHED__TASK_T)u8Counter));
+					pu8Buffer += 4U;
+
+					vSIL3_NUM_CONVERT__Array_U32(pu8Buffer, sFCU.sSched.sTasks[u8Counter].u32Overruns);
+					pu8Buffer += 4U;
+				}
+
+				break;
+
+#if C_LOCALDEF__LCCM655__ENABLE_PROFILE == 1U
+			case NET_PKT__FCU_GEN__TX_PROFILE:
+
+				//everything is in timer ticks, this is the scale
+				vSIL3_NUM_CONVERT__Array_U32(pu8Buffer, C_FCU__SCHED__TICKS_PER_US);
+				pu8Buffer += 4U;
+
+				//so the host can decode without knowing our build
+				pu8Buffer[0] = (Luint8)C_FCU__PROFILE__HIST_SHIFT;
+				pu8Buffer[1] = (Luint8)C_FCU__PROFILE__HIST_BINS;
+				pu8Buffer[2] = (Luint8)C_FCU__PROFILE__NAME_LENGTH;
+				pu8Buffer[3] = (Luint8)C_FCU__PROFILE__NUM_PROBES;
+				pu8Buffer += 4U;
+
+				//probe 0 to FCU_SCHED__MAX - 1 are the tasks, then the RTI ISRs
+				for(u8Counter = 0U; u8Counter < (Luint8)C_FCU__PROFILE__NUM_PROBES; u8Counter++)
+				{
+					for(u8Bin = 0U; u8Bin < C_FCU__PROFILE__NAME_LENGTH; u8Bin++)
+					{
+						pu8Buffer[u8Bin] = sFCU.sSched.sProfile[u8Counter].u8Name[u8Bin];
+					}
+					pu8Buffer += C_FCU__PROFILE__NAME_LENGTH;
+
+					vSIL3_NUM_CONVERT__Array_U32(pu8Buffer, sFCU.sSched.sProfile[u8Counter].u32Count);
+					pu8Buffer += 4U;
+
+					vSIL3_NUM_CONVERT__Array_U32(pu8Buffer, sFCU.sSched.sProfile[u8Counter].u32Min_Ticks);
+					pu8Buffer += 4U;
+
+					vSIL3_NUM_CONVERT__Array_U32(pu8Buffer, sFCU.sSched.sProfile[u8Counter].u32Max_Ticks);
+					pu8Buffer += 4U;
+
+					vSIL3_NUM_CONVERT__Array_U32(pu8Buffer, u32FCU_SCHED_PROFILE__Get_Mean(u8Counter));
+					pu8Buffer += 4U;
+
+					for(u8Bin = 0U; u8Bin < C_FCU__PROFILE__HIST_BINS; u8Bin++)
+					{
+						vSIL3_NUM_CONVERT__Array_U16(pu8Buffer, sFCU.sSched.sProfile[u8Counter].u16Hist[u8Bin]);
+						pu8Buffer += 2U;
+					}
+				}
+
+				break;
+#endif
+
+			default:
+
+				break;
+
+		}//switch(ePacketType)
+
+		//send it
+		vSIL3_SAFEUDP_TX__Commit(u8BufferIndex, u16Length, C_RLOOP_NET_PORT__FCU, C_RLOOP_NET_PORT__FCU);
+
+	}//if(s16Return == 0)
+	else
+	{
+		//fault
+
+	}//else if(s16Return == 0)
+
+}
+
+
+#endif //C_LOCALDEF__LCCM655__ENABLE_ETHERNET
+#endif //C_LOCALDEF__LCCM655__ENABLE_SCHEDULER
+#endif //#if C_LOCALDEF__LCCM655__ENABLE_THIS_MODULE == 1U
+//safetys
+#ifndef C_LOCALDEF__LCCM655__ENABLE_THIS_MODULE
+	#error
+#endif
+/** @} */
+/** @} */
+/** @} */
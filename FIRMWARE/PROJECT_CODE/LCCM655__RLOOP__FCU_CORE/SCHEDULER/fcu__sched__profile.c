@@ -0,0 +1,250 @@
+/**
+ * @file		FCU__SCHED__PROFILE.C
+ * @brief		Named execution time probes with log2 histograms for the scheduler
+ *				tasks and the RTI ISRs
+ * @author		Lachlan Grogan
+ * @copyright	rLoop Inc.
+ */
+/**
+ * @addtogroup RLOOP
+ * @{ */
+/**
+ * @addtogroup FCU
+ * @ingroup RLOOP
+ * @{ */
+/**
+ * @addtogroup FCU__SCHED__PROFILE
+ * @ingroup FCU
+ * @{ */
+
+#include "../fcu_core.h"
+
+#if C_LOCALDEF__LCCM655__ENABLE_THIS_MODULE == 1U
+#if C_LOCALDEF__LCCM655__ENABLE_PROFILE == 1U
+
+extern struct _strFCU sFCU;
+
+//locals
+static Luint8 u8FCU_SCHED_PROFILE__Get_Bin(Luint32 u32Ticks);
+
+//names in E_FCU_SCHED__TASK_T order then the RTI ISRs
+static const Luint8 u8FCU_SCHED_PROFILE__Names[C_FCU__PROFILE__NUM_PROBES][C_FCU__PROFILE__NAME_LENGTH] =
+{
+	"ADC",
+	"SC16",
+	"LDIST",
+	"THROT",
+	"NET",
+	"OPTO",
+	"LCONT",
+	"PUSHER",
+	"BRAKES",
+	"ACCEL",
+	"ASI",
+	"FCTL",
+	"DAQ",
+	"FAULTS",
+	"RTI10MS",
+	"RTI100"
+};
+
+
+/***************************************************************************//**
+ * @brief
+ * Name the probes and clear them.
+ *
+ * @st_funcMD5		F85AE212C9CDF7967A24A16BC18C2CB3
+ * @st_funcID		LCCM655R0.FILE.101.FUNC.001
+ */
+void vFCU_SCHED_PROFILE__Init(void)
+{
+	Luint8 u8Probe;
+	Luint8 u8Counter;
+
+	for(u8Probe = 0U; u8Probe < (Luint8)C_FCU__PROFILE__NUM_PROBES; u8Probe++)
+	{
+		for(u8Counter = 0U; u8Counter < C_FCU__PROFILE__NAME_LENGTH; u8Counter++)
+		{
+			sFCU.sSched.sProfile[u8Probe].u8Name[u8Counter] = u8FCU_SCHED_PROFILE__Names[u8Probe][u8Counter];
+		}
+		sFCU.sSched.sProfile[u8Probe].u32Start_Ticks = 0U;
+		sFCU.sSched.sProfile[u8Probe].u8Running = 0U;
+	}
+
+	vFCU_SCHED_PROFILE__Reset();
+}
+
+/***************************************************************************//**
+ * @brief
+ * Mark the start of a probed section.
+ *
+ * @param[in]		u8Probe					Task index or C_FCU__PROFILE__PROBE_x
+ * @st_funcMD5		1B3CA8F1F7803B3CC73374425CFC98AF
+ * @st_funcID		LCCM655R0.FILE.101.FUNC.002
+ */
+void vFCU_SCHED_PROFILE__Start(Luint8 u8Probe)
+{
+	if(u8Probe < (Luint8)C_FCU__PROFILE__NUM_PROBES)
+	{
+		sFCU.sSched.sProfile[u8Probe].u32Start_Ticks = u32FCU_SCHED__Get_Timer();
+		sFCU.sSched.sProfile[u8Probe].u8Running = 1U;
+	}
+	else
+	{
+		//error
+	}
+}
+
+/***************************************************************************//**
+ * @brief
+ * Mark the end of a probed section and add it to the stats. A stop without a
+ * start is ignored.
+ *
+ * @param[in]		u8Probe					Task index or C_FCU__PROFILE__PROBE_x
+ * @st_funcMD5		EFA60452FCA2933D7CDCC4C64C37D18B
+ * @st_funcID		LCCM655R0.FILE.101.FUNC.003
+ */
+void vFCU_SCHED_PROFILE__Stop(Luint8 u8Probe)
+{
+	Luint32 u32Now;
+	Luint32 u32Ticks;
+	Luint8 u8Bin;
+
+	//read first so our own work is not counted
+	u32Now = u32FCU_SCHED__Get_Timer();
+
+	if(u8Probe < (Luint8)C_FCU__PROFILE__NUM_PROBES)
+	{
+		if(sFCU.sSched.sProfile[u8Probe].u8Running == 1U)
+		{
+			sFCU.sSched.sProfile[u8Probe].u8Running = 0U;
+
+			//unsigned so the wrap falls out
+			u32Ticks = u32Now - sFCU.sSched.sProfile[u8Probe].u32Start_Ticks;
+
+			if((sFCU.sSched.sProfile[u8Probe].u32Count == 0U) || (u32Ticks < sFCU.sSched.sProfile[u8Probe].u32Min_Ticks))
+			{
+				sFCU.sSched.sProfile[u8Probe].u32Min_Ticks = u32Ticks;
+			}
+			else
+			{
+				//fall on
+			}
+
+			if(u32Ticks > sFCU.sSched.sProfile[u8Probe].u32Max_Ticks)
+			{
+				sFCU.sSched.sProfile[u8Probe].u32Max_Ticks = u32Ticks;
+			}
+			else
+			{
+				//fall on
+			}
+
+			sFCU.sSched.sProfile[u8Probe].u64Total_Ticks += (Luint64)u32Ticks;
+			sFCU.sSched.sProfile[u8Probe].u32Count++;
+
+			u8Bin = u8FCU_SCHED_PROFILE__Get_Bin(u32Ticks);
+			if(sFCU.sSched.sProfile[u8Probe].u16Hist[u8Bin] < 0xFFFFU)
+			{
+				sFCU.sSched.sProfile[u8Probe].u16Hist[u8Bin]++;
+			}
+			else
+			{
+				//saturated
+			}
+		}
+		else
+		{
+			//not started
+		}
+	}
+	else
+	{
+		//error
+	}
+}
+
+/***************************************************************************//**
+ * @brief
+ * Clear the stats on all probes, the names stay.
+ *
+ * @st_funcMD5		1719C5D646D68F0F43CC8A5FC256344B
+ * @st_funcID		LCCM655R0.FILE.101.FUNC.004
+ */
+void vFCU_SCHED_PROFILE__Reset(void)
+{
+	Luint8 u8Probe;
+	Luint8 u8Bin;
+
+	for(u8Probe = 0U; u8Probe < (Luint8)C_FCU__PROFILE__NUM_PROBES; u8Probe++)
+	{
+		sFCU.sSched.sProfile[u8Probe].u32Count = 0U;
+		sFCU.sSched.sProfile[u8Probe].u32Min_Ticks = 0U;
+		sFCU.sSched.sProfile[u8Probe].u32Max_Ticks = 0U;
+		sFCU.sSched.sProfile[u8Probe].u64Total_Ticks = 0U;
+
+		for(u8Bin = 0U; u8Bin < C_FCU__PROFILE__HIST_BINS; u8Bin++)
+		{
+			sFCU.sSched.sProfile[u8Probe].u16Hist[u8Bin] = 0U;
+		}
+	}
+}
+
+/***************************************************************************//**
+ * @brief
+ * Mean run time of a probe
+ *
+ * @param[in]		u8Probe					Task index or C_FCU__PROFILE__PROBE_x
+ * @return			Mean in timer ticks, 0 if never run
+ * @st_funcMD5		089E76762CCE81300C39B7BA2FA5468F
+ * @st_funcID		LCCM655R0.FILE.101.FUNC.005
+ */
+Luint32 u32FCU_SCHED_PROFILE__Get_Mean(Luint8 u8Probe)
+{
+	Luint32 u32Return;
+
+	if(u8Probe < (Luint8)C_FCU__PROFILE__NUM_PROBES)
+	{
+		if(sFCU.sSched.sProfile[u8Probe].u32Count != 0U)
+		{
+			u32Return = (Luint32)(sFCU.sSched.sProfile[u8Probe].u64Total_Ticks / (Luint64)sFCU.sSched.sProfile[u8Probe].u32Count);
+		}
+		else
+		{
+			u32Return = 0U;
+		}
+	}
+	else
+	{
+		u32Return = 0U;
+	}
+
+	return u32Return;
+}
+
+//bin 0 is below 2^(SHIFT + 1), then one bin per power of two, the last is open ended
+static Luint8 u8FCU_SCHED_PROFILE__Get_Bin(Luint32 u32Ticks)
+{
+	Luint32 u32Temp;
+	Luint8 u8Bin;
+
+	u32Temp = u32Ticks >> (C_FCU__PROFILE__HIST_SHIFT + 1U);
+	u8Bin = 0U;
+	while((u32Temp != 0U) && (u8Bin < (C_FCU__PROFILE__HIST_BINS - 1U)))
+	{
+		u32Temp >>= 1U;
+		u8Bin++;
+	}
+
+	return u8Bin;
+}
+
+#endif //C_LOCALDEF__LCCM655__ENABLE_PROFILE
+#endif //#if C_LOCALDEF__LCCM655__ENABLE_THIS_MODULE == 1U
+//safetys
+#ifndef C_LOCALDEF__LCCM655__ENABLE_THIS_MODULE
+	#error
+#endif
+/** @} */
+/** @} */
+/** @} */
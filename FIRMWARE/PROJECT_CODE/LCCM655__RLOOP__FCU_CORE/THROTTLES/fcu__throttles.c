@@ -40,6 +40,7 @@ extern struct _strFCU sFCU;
 Lfloat32 f32FCU_THROTTLE__RPM_To_Volts(Luint16 u16RPM);
 Luint16 u16FCU_THROTTLE__Compute_RPM_StepUp(Luint16 u16RPM);
 Luint16 u16FCU_THROTTLE__Compute_RPM_StepDown(Luint16 u16RPM);
+static Luint8 u8FCU_THROTTLE__Run_Engine(Luint8 u8Engine);
 
 #define C_THROTTLE_UPDATE_TIMEOUT  200U
 
@@ -47,7 +48,7 @@ Luint16 u16FCU_THROTTLE__Compute_RPM_StepDown(Luint16 u16RPM);
  * @brief
  * Init any variables
  * 
- * @st_funcMD5		3D83D3CBE94E074C73347E324EE431FB
+ * @st_funcMD5		63E09D616D5A7659DCBFEFADA62CDDF6
  * @st_funcID		LCCM655R0.FILE.006.FUNC.001
  */
 void vFCU_THROTTLE__Init(void)
@@ -63,7 +64,7 @@ void vFCU_THROTTLE__Init(void)
 	sFCU.sThrottle.sDevMode.u8Enabled = 0U;
 
 	sFCU.sThrottle.eState = THROTTLE_STATE__IDLE;
-	sFCU.sThrottle.u8RunIndex = 0U;
+	sFCU.sThrottle.u8NumMoving = 0U;
 	sFCU.sThrottle.u32KeepAlive = 0U;
 
 	vSIL3_FAULTTREE__Init(&sFCU.sThrottle.sFaultFlags);
@@ -93,14 +94,14 @@ void vFCU_THROTTLE__Init(void)
  * @brief
  * Process any Throttle tasks
  * 
- * @st_funcMD5		519F9282320179D5EA89621405D7BACA
+ * @st_funcMD5		0D12511CD60AA0D3B2C43C1D5C2D2EB7
  * @st_funcID		LCCM655R0.FILE.006.FUNC.002
  */
 void vFCU_THROTTLE__Process(void)
 {
-	Lfloat32 f32Temp;
 	Luint32 u32Test;
 	Luint8 u8Counter;
+	Luint8 u8Temp;
 
 	//process the AMC device
 	vAMC7812__Process();
@@ -131,184 +132,152 @@ void vFCU_THROTTLE__Process(void)
 			//Clear the not in run flag
 			vSIL3_FAULTTREE__Clear_Flag(&sFCU.sThrottle.sFaultFlags, C_LCCM655__THROTTLES__FAULT_INDEX__03);
 
-
-			//do we need to do anything with this throttle
-			if(sFCU.sThrottle.u16CurrentRPM[sFCU.sThrottle.u8RunIndex] != sFCU.sThrottle.u16RequestedRPM[sFCU.sThrottle.u8RunIndex])
+			//service every HE in the one pass so the AMC7812 picks up the whole set
+			//and latches them together, rather than skewing the engines by a pass each
+			u8Temp = 0U;
+			for(u8Counter = 0U; u8Counter < C_FCU__NUM_HOVER_ENGINES; u8Counter++)
 			{
-				//we have a difference between the current RPM and the requested RPM
+				u8Temp += u8FCU_THROTTLE__Run_Engine(u8Counter);
+			}
+			sFCU.sThrottle.u8NumMoving = u8Temp;
 
-				//determine what mode the user wanted
-				if(sFCU.sThrottle.eRequestedMode[sFCU.sThrottle.u8RunIndex] == THROTTLE_TYPE__RAMP)
-				{
+			//see what else needs doing
+			sFCU.sThrottle.eState = THROTTLE_STATE__CHECK_KEEPALIVE;
+			break;
 
-					//Determine to spin up or spin down
-					if(sFCU.sThrottle.u16RequestedRPM[sFCU.sThrottle.u8RunIndex] > sFCU.sThrottle.u16CurrentRPM[sFCU.sThrottle.u8RunIndex])
-					{
-						sFCU.sThrottle.eState = THROTTLE_STATE__RAMP_UP;
-					}
-					else
-					{
-						sFCU.sThrottle.eState = THROTTLE_STATE__RAMP_DOWN;
-					}
+		case THROTTLE_STATE__CHECK_KEEPALIVE:
 
-				}
-				else
+			//30 seconds
+			if((sFCU.sThrottle.u32KeepAlive >= C_THROTTLE_UPDATE_TIMEOUT) && (sFCU.sThrottle.u8KeepAliveActive == 0U))
+			{
+				//clear all
+				for(u8Counter = 0U; u8Counter < C_FCU__NUM_HOVER_ENGINES; u8Counter++)
 				{
-					//default to step mode for all other cases
-					sFCU.sThrottle.eState = THROTTLE_STATE__STEP;
+					//set to zero and trip out.
+					vAMC7182__DAC_SetVoltage(u8Counter, 0.0F);
 				}
+
+				sFCU.sThrottle.u8KeepAliveActive = 1U;
 			}
 			else
 			{
-				//no need to service this HE, check again later
-				sFCU.sThrottle.eState = THROTTLE_STATE__INC_INDEX;
+				//safe
 			}
-			break;
-
 
-		case THROTTLE_STATE__STEP:
-
-			//simply supply a step change to the throttle
-
-			//compute the voltage for the corresponding RPM
-			f32Temp = f32FCU_THROTTLE__RPM_To_Volts(sFCU.sThrottle.u16RequestedRPM[sFCU.sThrottle.u8RunIndex]);
-
-			//set DAC
-			sFCU.sThrottle.f32CurrentVolts[sFCU.sThrottle.u8RunIndex] = f32Temp;
-			vAMC7182__DAC_SetVoltage(sFCU.sThrottle.u8RunIndex, f32Temp);
-
-			//update the actual RPM based on the change
-			sFCU.sThrottle.u16CurrentRPM[sFCU.sThrottle.u8RunIndex] = sFCU.sThrottle.u16RequestedRPM[sFCU.sThrottle.u8RunIndex];
-
-			//move onto the next channel to scan
-			sFCU.sThrottle.eState = THROTTLE_STATE__INC_INDEX;
+			sFCU.sThrottle.eState = THROTTLE_STATE__RUN;
 			break;
 
-		case THROTTLE_STATE__RAMP_UP:
-			//compute the ramp change to the throttle
+		case THROTTLE_STATE__ERROR:
+			//some issue
+			break;
 
-			//only do if we have seen a timer
-			if(sFCU.sThrottle.u8100ms_Timer[sFCU.sThrottle.u8RunIndex] == 1U)
-			{
-				//increment the current RPM
-				sFCU.sThrottle.u16CurrentRPM[sFCU.sThrottle.u8RunIndex] = u16FCU_THROTTLE__Compute_RPM_StepUp(sFCU.sThrottle.u16CurrentRPM[sFCU.sThrottle.u8RunIndex]);
+		default:
+			//log the fault
+			break;
 
-				//limit
-				if(sFCU.sThrottle.u16CurrentRPM[sFCU.sThrottle.u8RunIndex] > sFCU.sThrottle.u16RequestedRPM[sFCU.sThrottle.u8RunIndex])
-				{
-					//set to max
-					sFCU.sThrottle.u16CurrentRPM[sFCU.sThrottle.u8RunIndex] = sFCU.sThrottle.u16RequestedRPM[sFCU.sThrottle.u8RunIndex];
-				}
-				else
-				{
-					//ok, fall on
-				}
 
-				//compute the voltage for the corresponding RPM
-				f32Temp = f32FCU_THROTTLE__RPM_To_Volts(sFCU.sThrottle.u16CurrentRPM[sFCU.sThrottle.u8RunIndex]);
+	}//switch(sFCU.sThrottle.eState)
 
-				//set DAC
-				sFCU.sThrottle.f32CurrentVolts[sFCU.sThrottle.u8RunIndex] = f32Temp;
-				vAMC7182__DAC_SetVoltage(sFCU.sThrottle.u8RunIndex, f32Temp);
+}
 
-				//clear the flag
-				sFCU.sThrottle.u8100ms_Timer[sFCU.sThrottle.u8RunIndex] = 0U;
-			}
-			else
-			{
-				//come back around again
-			}
 
-			sFCU.sThrottle.eState = THROTTLE_STATE__INC_INDEX;
-			break;
+//step or ramp one HE towards its requested RPM, returns 1 if it has not arrived yet
+static Luint8 u8FCU_THROTTLE__Run_Engine(Luint8 u8Engine)
+{
+	Lfloat32 f32Temp;
+	Luint8 u8Return;
 
-		case THROTTLE_STATE__RAMP_DOWN:
+	//do we need to do anything with this throttle
+	if(sFCU.sThrottle.u16CurrentRPM[u8Engine] != sFCU.sThrottle.u16RequestedRPM[u8Engine])
+	{
+		//we have a difference between the current RPM and the requested RPM
 
+		//determine what mode the user wanted
+		if(sFCU.sThrottle.eRequestedMode[u8Engine] == THROTTLE_TYPE__RAMP)
+		{
 			//only do if we have seen a timer
-			if(sFCU.sThrottle.u8100ms_Timer[sFCU.sThrottle.u8RunIndex] == 1U)
+			if(sFCU.sThrottle.u8100ms_Timer[u8Engine] == 1U)
 			{
-				//increment the current RPM
-				sFCU.sThrottle.u16CurrentRPM[sFCU.sThrottle.u8RunIndex] = u16FCU_THROTTLE__Compute_RPM_StepDown(sFCU.sThrottle.u16CurrentRPM[sFCU.sThrottle.u8RunIndex]);
-
-				//limit
-				if(sFCU.sThrottle.u16CurrentRPM[sFCU.sThrottle.u8RunIndex] < sFCU.sThrottle.u16RequestedRPM[sFCU.sThrottle.u8RunIndex])
+				//Determine to spin up or spin down
+				if(sFCU.sThrottle.u16RequestedRPM[u8Engine] > sFCU.sThrottle.u16CurrentRPM[u8Engine])
 				{
-					//set to max
-					sFCU.sThrottle.u16CurrentRPM[sFCU.sThrottle.u8RunIndex] = sFCU.sThrottle.u16RequestedRPM[sFCU.sThrottle.u8RunIndex];
+					//increment the current RPM
+					sFCU.sThrottle.u16CurrentRPM[u8Engine] = u16FCU_THROTTLE__Compute_RPM_StepUp(sFCU.sThrottle.u16CurrentRPM[u8Engine]);
+
+					//limit
+					if(sFCU.sThrottle.u16CurrentRPM[u8Engine] > sFCU.sThrottle.u16RequestedRPM[u8Engine])
+					{
+						//set to max
+						sFCU.sThrottle.u16CurrentRPM[u8Engine] = sFCU.sThrottle.u16RequestedRPM[u8Engine];
+					}
+					else
+					{
+						//ok, fall on
+					}
 				}
 				else
 				{
-					//ok, fall on
+					//decrement the current RPM
+					sFCU.sThrottle.u16CurrentRPM[u8Engine] = u16FCU_THROTTLE__Compute_RPM_StepDown(sFCU.sThrottle.u16CurrentRPM[u8Engine]);
+
+					//limit
+					if(sFCU.sThrottle.u16CurrentRPM[u8Engine] < sFCU.sThrottle.u16RequestedRPM[u8Engine])
+					{
+						//set to min
+						sFCU.sThrottle.u16CurrentRPM[u8Engine] = sFCU.sThrottle.u16RequestedRPM[u8Engine];
+					}
+					else
+					{
+						//ok, fall on
+					}
 				}
 
 				//compute the voltage for the corresponding RPM
-				f32Temp = f32FCU_THROTTLE__RPM_To_Volts(sFCU.sThrottle.u16CurrentRPM[sFCU.sThrottle.u8RunIndex]);
+				f32Temp = f32FCU_THROTTLE__RPM_To_Volts(sFCU.sThrottle.u16CurrentRPM[u8Engine]);
 
 				//set DAC
-				sFCU.sThrottle.f32CurrentVolts[sFCU.sThrottle.u8RunIndex] = f32Temp;
-				vAMC7182__DAC_SetVoltage(sFCU.sThrottle.u8RunIndex, f32Temp);
+				sFCU.sThrottle.f32CurrentVolts[u8Engine] = f32Temp;
+				vAMC7182__DAC_SetVoltage(u8Engine, f32Temp);
 
 				//clear the flag
-				sFCU.sThrottle.u8100ms_Timer[sFCU.sThrottle.u8RunIndex] = 0U;
+				sFCU.sThrottle.u8100ms_Timer[u8Engine] = 0U;
 			}
 			else
 			{
 				//come back around again
 			}
+		}
+		else
+		{
+			//default to step mode for all other cases
+			//simply supply a step change to the throttle
 
-			sFCU.sThrottle.eState = THROTTLE_STATE__INC_INDEX;
-			break;
-
-		case THROTTLE_STATE__INC_INDEX:
-			//increment to the next index
-			if(sFCU.sThrottle.u8RunIndex < (C_FCU__NUM_HOVER_ENGINES - 1))
-			{
-				sFCU.sThrottle.u8RunIndex++;
-			}
-			else
-			{
-				//roll around
-				sFCU.sThrottle.u8RunIndex = 0U;
-			}
-
-			//see what else needs doing
-			sFCU.sThrottle.eState = THROTTLE_STATE__CHECK_KEEPALIVE;
-
-			break;
-
-		case THROTTLE_STATE__CHECK_KEEPALIVE:
-
-			//30 seconds
-			if((sFCU.sThrottle.u32KeepAlive >= C_THROTTLE_UPDATE_TIMEOUT) && (sFCU.sThrottle.u8KeepAliveActive == 0U))
-			{
-				//clear all
-				for(u8Counter = 0U; u8Counter < C_FCU__NUM_HOVER_ENGINES; u8Counter++)
-				{
-					//set to zero and trip out.
-					vAMC7182__DAC_SetVoltage(u8Counter, 0.0F);
-				}
-
-				sFCU.sThrottle.u8KeepAliveActive = 1U;
-			}
-			else
-			{
-				//safe
-			}
-
-			sFCU.sThrottle.eState = THROTTLE_STATE__RUN;
-			break;
-
-		case THROTTLE_STATE__ERROR:
-			//some issue
-			break;
+			//compute the voltage for the corresponding RPM
+			f32Temp = f32FCU_THROTTLE__RPM_To_Volts(sFCU.sThrottle.u16RequestedRPM[u8Engine]);
 
-		default:
-			//log the fault
-			break;
+			//set DAC
+			sFCU.sThrottle.f32CurrentVolts[u8Engine] = f32Temp;
+			vAMC7182__DAC_SetVoltage(u8Engine, f32Temp);
 
+			//update the actual RPM based on the change
+			sFCU.sThrottle.u16CurrentRPM[u8Engine] = sFCU.sThrottle.u16RequestedRPM[u8Engine];
+		}
+	}
+	else
+	{
+		//no need to service this HE, check again later
+	}
 
-	}//switch(sFCU.sThrottle.eState)
+	if(sFCU.sThrottle.u16CurrentRPM[u8Engine] != sFCU.sThrottle.u16RequestedRPM[u8Engine])
+	{
+		u8Return = 1U;
+	}
+	else
+	{
+		u8Return = 0U;
+	}
 
+	return u8Return;
 }
 
 
@@ -41,7 +41,7 @@ void vFCU_THROTTLE_ETH__Init(void)
  * Send a throttle eth packet
  * 
  * @param[in]		ePacketType				Packet Type
- * @st_funcMD5		DC68797182C38280A6A3E17149FE6073
+ * @st_funcMD5		8B22AD2908068E819F2554027B352840
  * @st_funcID		LCCM655R0.FILE.073.FUNC.002
  */
 void vFCU_THROTTLE_ETH__Transmit(E_NET__PACKET_T ePacketType)
@@ -115,8 +115,8 @@ void vFCU_THROTTLE_ETH__Transmit(E_NET__PACKET_T ePacketType)
 				pu8Buffer[0] = (Luint8)sFCU.sThrottle.eState;
 				pu8Buffer += 1U;
 
-				//current index
-				pu8Buffer[0] = sFCU.sThrottle.u8RunIndex;
+				//engines not yet at their requested RPM
+				pu8Buffer[0] = sFCU.sThrottle.u8NumMoving;
 				pu8Buffer += 1U;
 
 				//amc state
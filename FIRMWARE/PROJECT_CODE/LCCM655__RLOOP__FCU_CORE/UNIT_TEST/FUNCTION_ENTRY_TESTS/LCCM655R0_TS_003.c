@@ -10,6 +10,7 @@
 
 void vLCCM655R0_TS_003_TCASE_001(void);
 void vLCCM655R0_TS_003_TCASE_002(void);
+void vLCCM655R0_TS_003_TCASE_003(void);
 
 
 //Function to call the tests for this test specification
@@ -20,6 +21,7 @@ void vLCCM655R0_TS_003(void)
 	//vLCCM655R0_TS_003_TCASE_001();
 
 	vLCCM655R0_TS_003_TCASE_002();
+	vLCCM655R0_TS_003_TCASE_003();
 }
 
 //Individual Test Cases can be found below
@@ -207,6 +209,84 @@ void vLCCM655R0_TS_003_TCASE_002(void)
 }
 
 
+/***************************************************************************//**
+ * @st_test_case_id
+ * LCCM655R0.TS.003.TCASE.003
+ * @st_test_desc
+ * More stripes than the list holds at 100ms per stripe, the list must wrap
+ * and keep computing 304800mm/s
+ * 
+*/
+void vLCCM655R0_TS_003_TCASE_003(void)
+{
+	E_FCU__LASER_CONT_INDEX_T eLaser;
+	Luint8 u8Test;
+	Luint32 u32Register;
+	Luint32 u32Counter;
+	Luint32 u32Stripes;
+
+	DEBUG_PRINT("START:LCCM655R0.TS.003.TCASE.003\r\n");
+
+	//setup
+	vFCU_LASERCONT__Init();
+
+	//work on the forward laser only
+	eLaser = LASER_CONT__FWD;
+
+	u32Stripes = C_FCU__LASER_CONTRAST__MAX_STRIPES + 10U;
+
+	//clock the data in, 100ms = 5000000 x 20ns per stripe
+	for (u32Counter = 0U; u32Counter < u32Stripes; u32Counter++)
+	{
+		//rising edge
+		u64RTI_WIN32__Counter1 = 1000U + ((Luint64)u32Counter * 5000000U);
+		u32Register = 1 << 6U;
+		vFCU_LASERCONT_TL__ISR(eLaser, u32Register);
+
+		//falling edge
+		u64RTI_WIN32__Counter1 += 1000U;
+		u32Register = 0 << 6U;
+		vFCU_LASERCONT_TL__ISR(eLaser, u32Register);
+
+		//do some processing here
+		vFCU_LASERCONT__Process();
+	}
+
+	u8Test = 1U;
+
+	if(sFCU.sContrast.sTimingList[(Luint8)eLaser].u16RisingCount != (Luint16)u32Stripes)
+	{
+		u8Test = 0U;
+	}
+	if(u64FCU_LASERCONT_TL__Get_TimeDelta(eLaser, (Luint16)(u32Stripes - 1U)) != 5000000U)
+	{
+		u8Test = 0U;
+	}
+	if(u32FCU_LASERCONT_TL__Get_StripeVeloc_mms(eLaser) != 304800U)
+	{
+		u8Test = 0U;
+	}
+	if(u32FCU_LASERCONT_TL__Get_WindowVeloc_mms(eLaser) != 304800U)
+	{
+		u8Test = 0U;
+	}
+	if(sFCU.sContrast.sSensors[(Luint8)eLaser].u32DistElapsed_mm != (u32Stripes * C_FCU__LASER_CONTRAST__STRIPE_SPACING_MM))
+	{
+		u8Test = 0U;
+	}
+
+	if(u8Test == 1U)
+	{
+		DEBUG_PRINT("PASS:LCCM655R0.TS.003.TCASE.003\r\n");
+	}
+	else
+	{
+		DEBUG_PRINT("FAIL:LCCM655R0.TS.003.TCASE.003\r\n");
+	}
+	DEBUG_PRINT("END:LCCM655R0.TS.003.TCASE.003\r\n");
+
+}
+
 #endif //C_LOCALDEF__LCCM655__ENABLE_LASER_CONTRAST
 #endif
 #ifndef C_LOCALDEF__LCCM655__ENABLE_TEST_SPEC
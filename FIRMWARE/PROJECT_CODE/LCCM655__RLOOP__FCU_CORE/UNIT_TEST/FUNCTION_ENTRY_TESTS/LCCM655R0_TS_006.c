@@ -6,8 +6,20 @@
 
 #if C_LOCALDEF__LCCM655__ENABLE_THIS_MODULE == 1U
 #if C_LOCALDEF__LCCM655__ENABLE_TEST_SPEC == 1U
+#if C_LOCALDEF__LCCM655__ENABLE_FLIGHT_CONTROL == 1U
+#if C_LOCALDEF__LCCM655__ENABLE_FCTL_BRAKE_CONTROL == 1U
 
+#ifdef WIN32
+	#include <stdio.h>
+	#include <time.h>
+#endif
+
+//the raw polys, the reference for the grid
+#ifndef WIN32
+extern const Lfloat32 f32A34_BrakeTable[];
+#else
 extern Lfloat32 f32A34_BrakeTable[];
+#endif
 
 //70 rows of data, 6 entries per row
 
@@ -91,6 +103,9 @@ Lfloat32 f32A34Data[] = {
 
 
 void vLCCM655R0_TS_006_TCASE_001(void);
+void vLCCM655R0_TS_006_TCASE_002(void);
+void vLCCM655R0_TS_006_TCASE_003(void);
+Lint16 s16LCCM655R0_TS_006__Poly_Lookup(Luint32 u32Veloc_mms, Luint32 u32DragForce_n, Luint32 *pu32IBDistance_um);
 
 
 //Function to call the tests for this test specification
@@ -99,6 +114,8 @@ void vLCCM655R0_TS_006(void)
 
 	//Call the test cases
 	vLCCM655R0_TS_006_TCASE_001();
+	vLCCM655R0_TS_006_TCASE_002();
+	vLCCM655R0_TS_006_TCASE_003();
 
 }
 
@@ -138,7 +155,7 @@ void vLCCM655R0_TS_006_TCASE_001(void)
 		u32Veloc_mms = (Luint32)f32Temp;
 
 		//only do above 25m/s
-		if(u32Veloc_mms == 30000)
+		if(u32Veloc_mms >= 30000U)
 		{
 			//get the drag force
 			f32Temp = f32A34Data[u32Index + 1U];
@@ -151,10 +168,16 @@ void vLCCM655R0_TS_006_TCASE_001(void)
 			f32Height = f32A34Data[u32Index + 4U];
 			//meters to microns.
 			f32Height *= 1000000;
-			
-			if (s16Test == 0)
+
+			//within 2%, the raw polys were up to 80% out
+			f32Temp = (Lfloat32)u32IBDistance_um - f32Height;
+			if(f32Temp < 0.0F)
 			{
-				u8Test = 1U;
+				f32Temp = -f32Temp;
+			}
+			if ((s16Test != 0) || (f32Temp > (f32Height * 0.02F)))
+			{
+				u8Test = 0U;
 			}
 		}
 		else
@@ -177,6 +200,183 @@ void vLCCM655R0_TS_006_TCASE_001(void)
 
 }
 
+/***************************************************************************//**
+ * @st_test_case_id
+ * LCCM655R0.TS.006.TCASE.002
+ * @st_test_desc
+ * The drag lookup must undo the brake lookup, and both must be monotonic
+ * 
+*/
+void vLCCM655R0_TS_006_TCASE_002(void)
+{
+	Luint32 u32Veloc_mms;
+	Luint32 u32DragForce_n;
+	Luint32 u32IBDistance_um;
+	Luint32 u32PrevDistance_um;
+	Luint32 u32Drag2_n;
+	Lint32 s32Error;
+	Luint8 u8Test;
+
+	DEBUG_PRINT("START:LCCM655R0.TS.006.TCASE.002\r\n");
+
+	u8Test = 1U;
+
+	for(u32Veloc_mms = 30000U; u32Veloc_mms < 160000U; u32Veloc_mms += 3333U)
+	{
+		u32PrevDistance_um = 0xFFFFFFFFU;
+		for(u32DragForce_n = 50U; u32DragForce_n < 4000U; u32DragForce_n += 37U)
+		{
+			(void)s16FCU_FLIGHTCTL_BRAKES__Brake_Lookup(u32Veloc_mms, u32DragForce_n, &u32IBDistance_um);
+
+			//more drag must never need a wider gap
+			if(u32IBDistance_um > u32PrevDistance_um)
+			{
+				u8Test = 0U;
+			}
+			u32PrevDistance_um = u32IBDistance_um;
+
+			//only where the gap is not at the limit
+			if(u32IBDistance_um > 2000U)
+			{
+				(void)s16FCU_FLIGHTCTL_BRAKES__Drag_Lookup(u32Veloc_mms, u32IBDistance_um, &u32Drag2_n);
+				s32Error = (Lint32)u32Drag2_n - (Lint32)u32DragForce_n;
+
+				//within 2%, the rounding of the grid
+				if((s32Error * 50) > (Lint32)u32DragForce_n || (s32Error * -50) > (Lint32)u32DragForce_n)
+				{
+					u8Test = 0U;
+				}
+			}
+		}
+	}
+
+	//too slow, max brakes
+	if(s16FCU_FLIGHTCTL_BRAKES__Brake_Lookup(10000U, 1000U, &u32IBDistance_um) != -1)
+	{
+		u8Test = 0U;
+	}
+	if(u32IBDistance_um != 0U)
+	{
+		u8Test = 0U;
+	}
+
+	if(u8Test == 1U)
+	{
+		DEBUG_PRINT("PASS:LCCM655R0.TS.006.TCASE.002\r\n");
+	}
+	else
+	{
+		DEBUG_PRINT("FAIL:LCCM655R0.TS.006.TCASE.002\r\n");
+	}
+	DEBUG_PRINT("END:LCCM655R0.TS.006.TCASE.002\r\n");
+
+}
+
+/***************************************************************************//**
+ * @st_test_case_id
+ * LCCM655R0.TS.006.TCASE.003
+ * @st_test_desc
+ * Benchmark the grid against the raw polys, PC only.
+ * Timing depends on the host so this only reports, it has no pass or fail.
+ * 
+*/
+void vLCCM655R0_TS_006_TCASE_003(void)
+{
+#ifdef WIN32
+	Luint32 u32Counter;
+	Luint32 u32IBDistance_um;
+	Luint32 u32Sum;
+	clock_t tStart;
+	clock_t tGrid;
+	clock_t tPoly;
+	char msg[128];
+
+	DEBUG_PRINT("START:LCCM655R0.TS.006.TCASE.003\r\n");
+
+	u32Sum = 0U;
+
+	tStart = clock();
+	for(u32Counter = 0U; u32Counter < 1000000U; u32Counter++)
+	{
+		(void)s16FCU_FLIGHTCTL_BRAKES__Brake_Lookup(30000U + (u32Counter & 0xFFFFU), u32Counter & 0xFFFU, &u32IBDistance_um);
+		u32Sum += u32IBDistance_um;
+	}
+	tGrid = clock() - tStart;
+
+	tStart = clock();
+	for(u32Counter = 0U; u32Counter < 1000000U; u32Counter++)
+	{
+		(void)s16LCCM655R0_TS_006__Poly_Lookup(30000U + (u32Counter & 0xFFFFU), u32Counter & 0xFFFU, &u32IBDistance_um);
+		u32Sum += u32IBDistance_um;
+	}
+	tPoly = clock() - tStart;
+
+	//ns per call
+	sprintf(msg, "INFO:LCCM655R0.TS.006.TCASE.003: grid %u ns, poly %u ns (%u)\r\n",
+			(Luint32)(((Lfloat32)tGrid * 1000.0F) / (Lfloat32)CLOCKS_PER_SEC),
+			(Luint32)(((Lfloat32)tPoly * 1000.0F) / (Lfloat32)CLOCKS_PER_SEC),
+			u32Sum);
+	DEBUG_PRINT(msg);
+
+	DEBUG_PRINT("END:LCCM655R0.TS.006.TCASE.003\r\n");
+#endif
+}
+
+/***************************************************************************//**
+ * @brief
+ * The original lookup, one cubic per whole m/s with no interpolation
+ * 
+ * @param[out]		*pu32IBDistance_um			The computed i-beam dist
+ * @param[in]		u32DragForce_n				Requested drag force in newtons
+ * @param[in]		u32Veloc_mms				The current pod velocity in mm/sec
+ */
+Lint16 s16LCCM655R0_TS_006__Poly_Lookup(Luint32 u32Veloc_mms, Luint32 u32DragForce_n, Luint32 *pu32IBDistance_um)
+{
+	Luint32 u32LookupIndex;
+	Lfloat32 f32DragPow3;
+	Lfloat32 f32DragPow2;
+	Lfloat32 f32Result;
+	Lint16 s16Return;
+
+	//the velocity is the index into our braking table
+	u32LookupIndex = u32Veloc_mms / 1000U;
+	if(u32LookupIndex < 160U)
+	{
+		//4 polys per entry
+		u32LookupIndex <<= 2U;
+
+		f32DragPow2 = (Lfloat32)u32DragForce_n;
+		f32DragPow2 *= (Lfloat32)u32DragForce_n;
+		f32DragPow3 = f32DragPow2 * (Lfloat32)u32DragForce_n;
+
+		f32Result = (f32A34_BrakeTable[u32LookupIndex] * f32DragPow3);
+		f32Result += (f32A34_BrakeTable[u32LookupIndex + 1U] * f32DragPow2);
+		f32Result += (f32A34_BrakeTable[u32LookupIndex + 2U] * (Lfloat32)u32DragForce_n);
+		f32Result += f32A34_BrakeTable[u32LookupIndex + 3U];
+
+		//meters to microns
+		f32Result *= 1000000.0F;
+		if(f32Result < 0.0F)
+		{
+			*pu32IBDistance_um = 0U;
+		}
+		else
+		{
+			*pu32IBDistance_um = (Luint32)f32Result;
+		}
+		s16Return = 0;
+	}
+	else
+	{
+		*pu32IBDistance_um = 0U;
+		s16Return = -1;
+	}
+
+	return s16Return;
+}
+
+#endif //C_LOCALDEF__LCCM655__ENABLE_FCTL_BRAKE_CONTROL
+#endif //C_LOCALDEF__LCCM655__ENABLE_FLIGHT_CONTROL
 #endif
 #ifndef C_LOCALDEF__LCCM655__ENABLE_TEST_SPEC
 	#error
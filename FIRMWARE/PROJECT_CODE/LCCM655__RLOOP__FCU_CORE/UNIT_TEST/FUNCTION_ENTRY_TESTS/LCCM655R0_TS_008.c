@@ -0,0 +1,227 @@
+#include <localdef.h>
+
+#ifndef C_LOCALDEF__LCCM655__ENABLE_THIS_MODULE
+	#error
+#endif
+
+#if C_LOCALDEF__LCCM655__ENABLE_THIS_MODULE == 1U
+#if C_LOCALDEF__LCCM655__ENABLE_TEST_SPEC == 1U
+#if C_LOCALDEF__LCCM655__ENABLE_FLIGHT_CONTROL == 1U
+#if C_LOCALDEF__LCCM655__ENABLE_FCTL_BLENDER == 1U
+
+void vLCCM655R0_TS_008_TCASE_001(void);
+void vLCCM655R0_TS_008_TCASE_002(void);
+void vLCCM655R0_TS_008_TCASE_003(void);
+void vLCCM655R0_TS_008_TCASE_004(void);
+
+
+//Function to call the tests for this test specification
+void vLCCM655R0_TS_008(void)
+{
+
+	//Call the test cases
+	vLCCM655R0_TS_008_TCASE_001();
+	vLCCM655R0_TS_008_TCASE_002();
+	vLCCM655R0_TS_008_TCASE_003();
+	vLCCM655R0_TS_008_TCASE_004();
+
+}
+
+//Individual Test Cases can be found below
+/***************************************************************************//**
+ * @st_test_case_id
+ * LCCM655R0.TS.008.TCASE.001
+ * @st_test_desc
+ * Accel only, 1000mm/s/s for 2 seconds should give 2000mm/s and 2000mm
+ *
+*/
+void vLCCM655R0_TS_008_TCASE_001(void)
+{
+	Luint16 u16Counter;
+	Lint32 s32Veloc;
+	Lint32 s32Disp;
+	DEBUG_PRINT("START:LCCM655R0.TS.008.TCASE.001\r\n");
+
+	vFCU_FCTL_BLENDER__Init();
+
+	for(u16Counter = 0U; u16Counter < 200U; u16Counter++)
+	{
+		vFCU_FCTL_BLENDER__Accel_UpdateFrom_Accel(1000);
+		vFCU_FCTL_BLENDER__10MS_ISR();
+		vFCU_FCTL_BLENDER__Process();
+	}
+
+	s32Veloc = s32FCU_FCTL_BLENDER__Get_Veloc_mms();
+	s32Disp = s32FCU_FCTL_BLENDER__Get_Displacement_mm();
+
+	if((s32Veloc > 1990) && (s32Veloc < 2010) && (s32Disp > 1990) && (s32Disp < 2010))
+	{
+		DEBUG_PRINT("PASS:LCCM655R0.TS.008.TCASE.001\r\n");
+	}
+	else
+	{
+		DEBUG_PRINT("FAIL:LCCM655R0.TS.008.TCASE.001\r\n");
+	}
+	DEBUG_PRINT("END:LCCM655R0.TS.008.TCASE.001\r\n");
+
+}
+
+/***************************************************************************//**
+ * @st_test_case_id
+ * LCCM655R0.TS.008.TCASE.002
+ * @st_test_desc
+ * Accel reads 10% high, the contrast stripes every 500ms must pull the
+ * displacement back to the truth. The first stripe only sets the laser offset.
+ *
+*/
+void vLCCM655R0_TS_008_TCASE_002(void)
+{
+	Luint16 u16Counter;
+	Lfloat32 f32Time;
+	Lint32 s32Truth;
+	Lint32 s32Error;
+	DEBUG_PRINT("START:LCCM655R0.TS.008.TCASE.002\r\n");
+
+	vFCU_FCTL_BLENDER__Init();
+
+	s32Truth = 0;
+	for(u16Counter = 1U; u16Counter <= 500U; u16Counter++)
+	{
+		//truth is 1000mm/s/s
+		vFCU_FCTL_BLENDER__Accel_UpdateFrom_Accel(1100);
+		vFCU_FCTL_BLENDER__10MS_ISR();
+
+		f32Time = (Lfloat32)u16Counter * 0.01F;
+		s32Truth = (Lint32)(500.0F * f32Time * f32Time);
+		if((u16Counter % 50U) == 0U)
+		{
+			vFCU_FCTL_BLENDER__Displacement_UpdateFrom_Contrast(0U, s32Truth);
+		}
+		else
+		{
+			//between stripes
+		}
+
+		vFCU_FCTL_BLENDER__Process();
+	}
+
+	s32Error = s32FCU_FCTL_BLENDER__Get_Displacement_mm() - s32Truth;
+
+	//accel alone would be 1250mm out
+	if((s32Error > -100) && (s32Error < 100))
+	{
+		DEBUG_PRINT("PASS:LCCM655R0.TS.008.TCASE.002\r\n");
+	}
+	else
+	{
+		DEBUG_PRINT("FAIL:LCCM655R0.TS.008.TCASE.002\r\n");
+	}
+	DEBUG_PRINT("END:LCCM655R0.TS.008.TCASE.002\r\n");
+
+}
+
+/***************************************************************************//**
+ * @st_test_case_id
+ * LCCM655R0.TS.008.TCASE.003
+ * @st_test_desc
+ * A single LRF reading 10m out must be thrown away by the gate
+ *
+*/
+void vLCCM655R0_TS_008_TCASE_003(void)
+{
+	Luint16 u16Counter;
+	Lint32 s32Before;
+	Lint32 s32After;
+	DEBUG_PRINT("START:LCCM655R0.TS.008.TCASE.003\r\n");
+
+	vFCU_FCTL_BLENDER__Init();
+	vFCU_FCTL_BLENDER__Set_LRF_Target(100000);
+
+	//sit still for a second with good LRF data
+	for(u16Counter = 0U; u16Counter < 100U; u16Counter++)
+	{
+		vFCU_FCTL_BLENDER__Accel_UpdateFrom_Accel(0);
+		vFCU_FCTL_BLENDER__Displacement_UpdateFrom_LRF(100000);
+		vFCU_FCTL_BLENDER__10MS_ISR();
+		vFCU_FCTL_BLENDER__Process();
+	}
+	s32Before = s32FCU_FCTL_BLENDER__Get_Displacement_mm();
+
+	//bad reflection
+	vFCU_FCTL_BLENDER__Displacement_UpdateFrom_LRF(90000);
+	vFCU_FCTL_BLENDER__Process();
+	s32After = s32FCU_FCTL_BLENDER__Get_Displacement_mm();
+
+	if((s32Before == s32After) && (sFCU.sFlightControl.sBlender.sFilter.u32RejectCount == 1U))
+	{
+		DEBUG_PRINT("PASS:LCCM655R0.TS.008.TCASE.003\r\n");
+	}
+	else
+	{
+		DEBUG_PRINT("FAIL:LCCM655R0.TS.008.TCASE.003\r\n");
+	}
+	DEBUG_PRINT("END:LCCM655R0.TS.008.TCASE.003\r\n");
+
+}
+
+/***************************************************************************//**
+ * @st_test_case_id
+ * LCCM655R0.TS.008.TCASE.004
+ * @st_test_desc
+ * Two contrast lasers count stripes from different starting points, each one
+ * must be offset to the track on its first stripe and then hold the displacement
+ * to the truth against an accel reading 10% high.
+ *
+*/
+void vLCCM655R0_TS_008_TCASE_004(void)
+{
+	Luint16 u16Counter;
+	Lfloat32 f32Time;
+	Lint32 s32Truth;
+	Lint32 s32Error;
+	DEBUG_PRINT("START:LCCM655R0.TS.008.TCASE.004\r\n");
+
+	vFCU_FCTL_BLENDER__Init();
+
+	s32Truth = 0;
+	for(u16Counter = 1U; u16Counter <= 500U; u16Counter++)
+	{
+		//truth is 1000mm/s/s
+		vFCU_FCTL_BLENDER__Accel_UpdateFrom_Accel(1100);
+		vFCU_FCTL_BLENDER__10MS_ISR();
+
+		f32Time = (Lfloat32)u16Counter * 0.01F;
+		s32Truth = (Lint32)(500.0F * f32Time * f32Time);
+		if((u16Counter % 50U) == 0U)
+		{
+			//the aft laser reports 30m more elapsed than the fwd one
+			vFCU_FCTL_BLENDER__Displacement_UpdateFrom_Contrast((Luint8)LASER_CONT__FWD, s32Truth - 1000);
+			vFCU_FCTL_BLENDER__Displacement_UpdateFrom_Contrast((Luint8)LASER_CONT__AFT, s32Truth + 29000);
+		}
+		else
+		{
+			//between stripes
+		}
+
+		vFCU_FCTL_BLENDER__Process();
+	}
+
+	s32Error = s32FCU_FCTL_BLENDER__Get_Displacement_mm() - s32Truth;
+
+	//without the offsets the two lasers would drag us 14m off
+	if((s32Error > -100) && (s32Error < 100) && (sFCU.sFlightControl.sBlender.u8Contrast_Anchored[LASER_CONT__MID] == 0U))
+	{
+		DEBUG_PRINT("PASS:LCCM655R0.TS.008.TCASE.004\r\n");
+	}
+	else
+	{
+		DEBUG_PRINT("FAIL:LCCM655R0.TS.008.TCASE.004\r\n");
+	}
+	DEBUG_PRINT("END:LCCM655R0.TS.008.TCASE.004\r\n");
+
+}
+
+#endif //C_LOCALDEF__LCCM655__ENABLE_FCTL_BLENDER
+#endif //C_LOCALDEF__LCCM655__ENABLE_FLIGHT_CONTROL
+#endif
+#endif
@@ -0,0 +1,205 @@
+#include <localdef.h>
+
+#ifndef C_LOCALDEF__LCCM655__ENABLE_THIS_MODULE
+	#error
+#endif
+
+#if C_LOCALDEF__LCCM655__ENABLE_THIS_MODULE == 1U
+#if C_LOCALDEF__LCCM655__ENABLE_TEST_SPEC == 1U
+#if C_LOCALDEF__LCCM655__ENABLE_FLIGHT_CONTROL == 1U
+#if C_LOCALDEF__LCCM655__ENABLE_BRAKEPID == 1U
+
+void vLCCM655R0_TS_009_TCASE_001(void);
+void vLCCM655R0_TS_009_TCASE_002(void);
+
+static Lfloat32 f32LCCM655R0_TS_009__Plant_Drag(Lfloat32 f32Veloc_ms, Lfloat32 f32Gap_mm);
+
+
+//Function to call the tests for this test specification
+void vLCCM655R0_TS_009(void)
+{
+
+	//Call the test cases
+	vLCCM655R0_TS_009_TCASE_001();
+	vLCCM655R0_TS_009_TCASE_002();
+
+}
+
+//Individual Test Cases can be found below
+/***************************************************************************//**
+ * @st_test_case_id
+ * LCCM655R0.TS.009.TCASE.001
+ * @st_test_desc
+ * Anti windup, 5 seconds well under the setpoint must not build up any
+ * integral and the brakes must come in on the first step over the setpoint.
+ *
+*/
+void vLCCM655R0_TS_009_TCASE_001(void)
+{
+	Luint16 u16Counter;
+	Lfloat32 f32Gap;
+	Lfloat32 f32Integral;
+	DEBUG_PRINT("START:LCCM655R0.TS.009.TCASE.001\r\n");
+
+	vFCU_FLIGHTCTL_BRAKEPID__Init();
+	vFCU_FLIGHTCTL_BRAKEPID__Reset();
+
+	//50m/s at the start of the track, setpoint is ~110m/s
+	f32Gap = 0.0F;
+	for(u16Counter = 0U; u16Counter < 500U; u16Counter++)
+	{
+		f32Gap = f32FCU_FLIGHTCTL_BRAKEPID__Step(0, 50000, 0.01F);
+	}
+	f32Integral = sFCU.sFlightControl.sBrakePID.f32Integral_n;
+
+	//now 1000m, setpoint is ~45m/s
+	f32FCU_FLIGHTCTL_BRAKEPID__Step(1000000, 50000, 0.01F);
+
+	if((f32Gap == C_FCU__BRAKES__MAX_IBEAM_DIST_MM) && (f32Integral == 0.0F) &&
+		(sFCU.sFlightControl.sBrakePID.f32Gap_mm < C_FCU__BRAKES__MAX_IBEAM_DIST_MM))
+	{
+		DEBUG_PRINT("PASS:LCCM655R0.TS.009.TCASE.001\r\n");
+	}
+	else
+	{
+		DEBUG_PRINT("FAIL:LCCM655R0.TS.009.TCASE.001\r\n");
+	}
+	DEBUG_PRINT("END:LCCM655R0.TS.009.TCASE.001\r\n");
+
+}
+
+/***************************************************************************//**
+ * @st_test_case_id
+ * LCCM655R0.TS.009.TCASE.002
+ * @st_test_desc
+ * Closed loop, 350kg pod at 100m/s from 300m with a 15mm/s brake actuator.
+ * Must follow the setpoint once the brakes have caught up and stop short of
+ * the end of the profile.
+ *
+*/
+void vLCCM655R0_TS_009_TCASE_002(void)
+{
+	Luint32 u32Counter;
+	Lfloat32 f32Pos_m;
+	Lfloat32 f32Veloc_ms;
+	Lfloat32 f32Gap_mm;
+	Lfloat32 f32Command_mm;
+	Lfloat32 f32Step;
+	Lfloat32 f32Error;
+	Lfloat32 f32MaxError;
+	DEBUG_PRINT("START:LCCM655R0.TS.009.TCASE.002\r\n");
+
+	vFCU_FLIGHTCTL_BRAKEPID__Init();
+	vFCU_FLIGHTCTL_BRAKEPID__Reset();
+
+	f32Pos_m = 300.0F;
+	f32Veloc_ms = 100.0F;
+	f32Gap_mm = C_FCU__BRAKES__MAX_IBEAM_DIST_MM;
+	f32Command_mm = f32Gap_mm;
+	f32MaxError = 0.0F;
+
+	//1ms plant, 10ms controller, 60s max
+	for(u32Counter = 0U; u32Counter < 60000U; u32Counter++)
+	{
+		if(f32Veloc_ms < 0.05F)
+		{
+			//stopped
+			break;
+		}
+		else
+		{
+			//fall on
+		}
+
+		if((u32Counter % 10U) == 0U)
+		{
+			f32Command_mm = f32FCU_FLIGHTCTL_BRAKEPID__Step((Lint32)(f32Pos_m * 1000.0F), (Lint32)(f32Veloc_ms * 1000.0F), 0.01F);
+
+			//once the brakes have caught up, while the grid is valid
+			if((u32Counter > 5000U) && (f32Veloc_ms > 25.0F))
+			{
+				f32Error = f32Veloc_ms - (sFCU.sFlightControl.sBrakePID.f32Setpoint_ms);
+				if(f32Error < 0.0F)
+				{
+					f32Error = -f32Error;
+				}
+				else
+				{
+					//fall on
+				}
+				if(f32Error > f32MaxError)
+				{
+					f32MaxError = f32Error;
+				}
+				else
+				{
+					//fall on
+				}
+			}
+			else
+			{
+				//fall on
+			}
+		}
+		else
+		{
+			//fall on
+		}
+
+		//slew the actuator
+		f32Step = f32Command_mm - f32Gap_mm;
+		if(f32Step > 0.015F)
+		{
+			f32Step = 0.015F;
+		}
+		else if(f32Step < -0.015F)
+		{
+			f32Step = -0.015F;
+		}
+		else
+		{
+			//fall on
+		}
+		f32Gap_mm += f32Step;
+
+		f32Veloc_ms -= (f32LCCM655R0_TS_009__Plant_Drag(f32Veloc_ms, f32Gap_mm) / 350.0F) * 0.001F;
+		f32Pos_m += f32Veloc_ms * 0.001F;
+	}
+
+	if((f32Veloc_ms < 0.05F) && (f32Pos_m > 1150.0F) && (f32Pos_m < 1210.0F) && (f32MaxError < 1.0F))
+	{
+		DEBUG_PRINT("PASS:LCCM655R0.TS.009.TCASE.002\r\n");
+	}
+	else
+	{
+		DEBUG_PRINT("FAIL:LCCM655R0.TS.009.TCASE.002\r\n");
+	}
+	DEBUG_PRINT("END:LCCM655R0.TS.009.TCASE.002\r\n");
+
+}
+
+//plant drag from the brake grid, below the grid the eddy drag falls off with velocity
+static Lfloat32 f32LCCM655R0_TS_009__Plant_Drag(Lfloat32 f32Veloc_ms, Lfloat32 f32Gap_mm)
+{
+	Luint32 u32Drag;
+	Lfloat32 f32Drag;
+
+	if(f32Veloc_ms * 1000.0F < (Lfloat32)C_FCU__BRAKES__GRID_VELOC_MIN_MMS)
+	{
+		s16FCU_FLIGHTCTL_BRAKES__Drag_Lookup(C_FCU__BRAKES__GRID_VELOC_MIN_MMS, (Luint32)(f32Gap_mm * 1000.0F), &u32Drag);
+		f32Drag = (Lfloat32)u32Drag * f32Veloc_ms * 1000.0F;
+		f32Drag /= (Lfloat32)C_FCU__BRAKES__GRID_VELOC_MIN_MMS;
+	}
+	else
+	{
+		s16FCU_FLIGHTCTL_BRAKES__Drag_Lookup((Luint32)(f32Veloc_ms * 1000.0F), (Luint32)(f32Gap_mm * 1000.0F), &u32Drag);
+		f32Drag = (Lfloat32)u32Drag;
+	}
+
+	return f32Drag;
+}
+
+#endif //C_LOCALDEF__LCCM655__ENABLE_BRAKEPID
+#endif //C_LOCALDEF__LCCM655__ENABLE_FLIGHT_CONTROL
+#endif
+#endif
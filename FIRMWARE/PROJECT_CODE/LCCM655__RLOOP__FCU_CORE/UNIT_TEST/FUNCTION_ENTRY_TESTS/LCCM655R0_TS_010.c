@@ -0,0 +1,182 @@
+#include <localdef.h>
+
+#ifndef C_LOCALDEF__LCCM655__ENABLE_THIS_MODULE
+	#error
+#endif
+
+#if C_LOCALDEF__LCCM655__ENABLE_THIS_MODULE == 1U
+#if C_LOCALDEF__LCCM655__ENABLE_TEST_SPEC == 1U
+#if C_LOCALDEF__LCCM655__ENABLE_ETHERNET == 1U
+
+void vLCCM655R0_TS_010_TCASE_001(void);
+void vLCCM655R0_TS_010_TCASE_002(void);
+
+static void vLCCM655R0_TS_010__Setup(void);
+static void vLCCM655R0_TS_010__Run(Luint16 u16Ticks, Luint8 u8TicksPerPacket);
+
+
+//Function to call the tests for this test specification
+void vLCCM655R0_TS_010(void)
+{
+
+	//Call the test cases
+	vLCCM655R0_TS_010_TCASE_001();
+	vLCCM655R0_TS_010_TCASE_002();
+
+}
+
+//Individual Test Cases can be found below
+/***************************************************************************//**
+ * @st_test_case_id
+ * LCCM655R0.TS.010.TCASE.001
+ * @st_test_desc
+ * 5 streams on a link that can take 1 packet per 10ms, everything must go on
+ * time at its own rate.
+ *
+*/
+void vLCCM655R0_TS_010_TCASE_001(void)
+{
+	Luint8 u8Counter;
+	Luint8 u8Fail;
+	DEBUG_PRINT("START:LCCM655R0.TS.010.TCASE.001\r\n");
+
+	vLCCM655R0_TS_010__Setup();
+
+	//10 seconds
+	vLCCM655R0_TS_010__Run(1000U, 1U);
+
+	u8Fail = 0U;
+	for(u8Counter = 0U; u8Counter < C_FCU__NET_TX__MAX_STREAMS; u8Counter++)
+	{
+		if(sFCU.sUDPDiag.sStreams[u8Counter].eType != NET_PKT__NONE)
+		{
+			if((sFCU.sUDPDiag.sStreams[u8Counter].u32TxCount != (1000U / (Luint32)sFCU.sUDPDiag.sStreams[u8Counter].u16Period_x10ms)) ||
+				(sFCU.sUDPDiag.sStreams[u8Counter].u32DropCount != 0U))
+			{
+				u8Fail = 1U;
+			}
+			else
+			{
+				//fall on
+			}
+		}
+		else
+		{
+			//free
+		}
+	}
+
+	if(u8Fail == 0U)
+	{
+		DEBUG_PRINT("PASS:LCCM655R0.TS.010.TCASE.001\r\n");
+	}
+	else
+	{
+		DEBUG_PRINT("FAIL:LCCM655R0.TS.010.TCASE.001\r\n");
+	}
+	DEBUG_PRINT("END:LCCM655R0.TS.010.TCASE.001\r\n");
+
+}
+
+/***************************************************************************//**
+ * @st_test_case_id
+ * LCCM655R0.TS.010.TCASE.002
+ * @st_test_desc
+ * Same streams with a link that can only take 1 packet per 20ms. Mission data
+ * must never drop, the diag streams share what is left.
+ *
+*/
+void vLCCM655R0_TS_010_TCASE_002(void)
+{
+	Luint8 u8Counter;
+	Luint8 u8Fail;
+	Luint32 u32Drops;
+	DEBUG_PRINT("START:LCCM655R0.TS.010.TCASE.002\r\n");
+
+	vLCCM655R0_TS_010__Setup();
+	vLCCM655R0_TS_010__Run(1000U, 2U);
+
+	u8Fail = 0U;
+	u32Drops = 0U;
+	for(u8Counter = 0U; u8Counter < C_FCU__NET_TX__MAX_STREAMS; u8Counter++)
+	{
+		if(sFCU.sUDPDiag.sStreams[u8Counter].eType == NET_PKT__FCU_GEN__TX_MISSION_DATA)
+		{
+			if((sFCU.sUDPDiag.sStreams[u8Counter].u32TxCount != 200U) || (sFCU.sUDPDiag.sStreams[u8Counter].u32DropCount != 0U))
+			{
+				u8Fail = 1U;
+			}
+			else
+			{
+				//fall on
+			}
+		}
+		else if(sFCU.sUDPDiag.sStreams[u8Counter].eType != NET_PKT__NONE)
+		{
+			//nobody starves
+			if(sFCU.sUDPDiag.sStreams[u8Counter].u32TxCount < 20U)
+			{
+				u8Fail = 1U;
+			}
+			else
+			{
+				//fall on
+			}
+			u32Drops += sFCU.sUDPDiag.sStreams[u8Counter].u32DropCount;
+		}
+		else
+		{
+			//free
+		}
+	}
+
+	//74 packets/sec asked for on a 50 packet/sec link
+	if((u8Fail == 0U) && (u32Drops > 0U))
+	{
+		DEBUG_PRINT("PASS:LCCM655R0.TS.010.TCASE.002\r\n");
+	}
+	else
+	{
+		DEBUG_PRINT("FAIL:LCCM655R0.TS.010.TCASE.002\r\n");
+	}
+	DEBUG_PRINT("END:LCCM655R0.TS.010.TCASE.002\r\n");
+
+}
+
+//mission and faults from init, plus accel, brakes and lasers
+static void vLCCM655R0_TS_010__Setup(void)
+{
+	vFCU_NET_TX__Init();
+	s16FCU_NET_TX__Set_Stream(NET_PKT__FCU_ACCEL__TX_FULL_DATA, 5U);
+	s16FCU_NET_TX__Set_Stream(NET_PKT__FCU_BRAKES__TX_DATA, 5U);
+	s16FCU_NET_TX__Set_Stream(NET_PKT__LASER_OPTO__TX_LASER_DATA, 10U);
+}
+
+//run the ISR and send a packet every n ticks, in place of the EMAC
+static void vLCCM655R0_TS_010__Run(Luint16 u16Ticks, Luint8 u8TicksPerPacket)
+{
+	Luint16 u16Counter;
+
+	for(u16Counter = 0U; u16Counter < u16Ticks; u16Counter++)
+	{
+		vFCU_NET_TX__10MS_ISR();
+		if((u16Counter % (Luint16)u8TicksPerPacket) == 0U)
+		{
+			eFCU_NET_TX__Schedule();
+		}
+		else
+		{
+			//link busy
+		}
+	}
+
+	//let the link catch up on the last tick
+	for(u16Counter = 0U; u16Counter < C_FCU__NET_TX__MAX_STREAMS; u16Counter++)
+	{
+		eFCU_NET_TX__Schedule();
+	}
+}
+
+#endif //C_LOCALDEF__LCCM655__ENABLE_ETHERNET
+#endif
+#endif
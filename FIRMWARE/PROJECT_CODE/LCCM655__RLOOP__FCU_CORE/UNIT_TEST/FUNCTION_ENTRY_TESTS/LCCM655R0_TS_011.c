@@ -0,0 +1,170 @@
+#include <localdef.h>
+
+#ifndef C_LOCALDEF__LCCM655__ENABLE_THIS_MODULE
+	#error
+#endif
+
+#if C_LOCALDEF__LCCM655__ENABLE_THIS_MODULE == 1U
+#if C_LOCALDEF__LCCM655__ENABLE_TEST_SPEC == 1U
+#if C_LOCALDEF__LCCM655__ENABLE_LASER_CONTRAST == 1U
+#if C_LOCALDEF__LCCM666__ENABLE_THIS_MODULE == 1U
+
+void vLCCM655R0_TS_011_TCASE_001(void);
+void vLCCM655R0_TS_011_TCASE_002(void);
+
+static void vLCCM655R0_TS_011__Fly(Luint32 u32Time_ms);
+static Luint16 u16LCCM655R0_TS_011__Stripes_Passed(void);
+
+
+//Function to call the tests for this test specification
+void vLCCM655R0_TS_011(void)
+{
+
+	//Call the test cases
+	vLCCM655R0_TS_011_TCASE_001();
+	vLCCM655R0_TS_011_TCASE_002();
+
+}
+
+//Individual Test Cases can be found below
+/***************************************************************************//**
+ * @st_test_case_id
+ * LCCM655R0.TS.011.TCASE.001
+ * @st_test_desc
+ * Clean run on the track model, 8s in we are coasting at 100m/s. Every
+ * stripe behind us must be in the timing list and the stripe velocity exact.
+ *
+*/
+void vLCCM655R0_TS_011_TCASE_001(void)
+{
+	Luint8 u8Test;
+	Luint32 u32Veloc;
+	DEBUG_PRINT("START:LCCM655R0.TS.011.TCASE.001\r\n");
+
+	vFCU_LASERCONT__Init();
+	vFCU_WIN32__Reset_Timing();
+	vFCU_WIN32__TrackSim_Init();
+	vFCU_WIN32__TrackSim_Start();
+
+	vLCCM655R0_TS_011__Fly(8000U);
+
+	u8Test = 1U;
+	if(eSIMHLOOP_TRACK__Get_State() != TRAKSIM_STATE__COAST)
+	{
+		u8Test = 0U;
+	}
+	if(sFCU.sContrast.sTimingList[(Luint8)LASER_CONT__FWD].u16RisingCount != u16LCCM655R0_TS_011__Stripes_Passed())
+	{
+		u8Test = 0U;
+	}
+
+	//20ns RTI resolution on a 300ms stripe
+	u32Veloc = u32FCU_LASERCONT_TL__Get_StripeVeloc_mms(LASER_CONT__FWD);
+	if((u32Veloc < 99990U) || (u32Veloc > 100010U))
+	{
+		u8Test = 0U;
+	}
+
+	if(u8Test == 1U)
+	{
+		DEBUG_PRINT("PASS:LCCM655R0.TS.011.TCASE.001\r\n");
+	}
+	else
+	{
+		DEBUG_PRINT("FAIL:LCCM655R0.TS.011.TCASE.001\r\n");
+	}
+	DEBUG_PRINT("END:LCCM655R0.TS.011.TCASE.001\r\n");
+
+}
+
+/***************************************************************************//**
+ * @st_test_case_id
+ * LCCM655R0.TS.011.TCASE.002
+ * @st_test_desc
+ * Same run with 500ns of edge jitter, no edges may be lost and the window
+ * velocity must hold within 0.1%.
+ *
+*/
+void vLCCM655R0_TS_011_TCASE_002(void)
+{
+	Luint8 u8Test;
+	Luint32 u32Veloc;
+	DEBUG_PRINT("START:LCCM655R0.TS.011.TCASE.002\r\n");
+
+	vFCU_LASERCONT__Init();
+	vFCU_WIN32__Reset_Timing();
+	vFCU_WIN32__TrackSim_Init();
+	vFCU_WIN32__TrackSim_Set_Noise(5.0F, 0.01F, 500.0F, 0x1234U);
+	vFCU_WIN32__TrackSim_Start();
+
+	vLCCM655R0_TS_011__Fly(8000U);
+
+	u8Test = 1U;
+	if(sFCU.sContrast.sTimingList[(Luint8)LASER_CONT__FWD].u16RisingCount != u16LCCM655R0_TS_011__Stripes_Passed())
+	{
+		u8Test = 0U;
+	}
+	if(sFCU.sContrast.sTimingList[(Luint8)LASER_CONT__FWD].u16FallingCount != u16LCCM655R0_TS_011__Stripes_Passed())
+	{
+		u8Test = 0U;
+	}
+
+	u32Veloc = u32FCU_LASERCONT_TL__Get_WindowVeloc_mms(LASER_CONT__FWD);
+	if((u32Veloc < 99900U) || (u32Veloc > 100100U))
+	{
+		u8Test = 0U;
+	}
+
+	if(u8Test == 1U)
+	{
+		DEBUG_PRINT("PASS:LCCM655R0.TS.011.TCASE.002\r\n");
+	}
+	else
+	{
+		DEBUG_PRINT("FAIL:LCCM655R0.TS.011.TCASE.002\r\n");
+	}
+	DEBUG_PRINT("END:LCCM655R0.TS.011.TCASE.002\r\n");
+
+}
+
+//run the track model and the contrast layer on 10ms ticks
+static void vLCCM655R0_TS_011__Fly(Luint32 u32Time_ms)
+{
+	Luint32 u32Counter;
+
+	for(u32Counter = 10U; u32Counter <= u32Time_ms; u32Counter += 10U)
+	{
+		vSIMHLOOP_TRACK__Run_Until((Luint64)u32Counter * 1000000U);
+		vFCU_LASERCONT__Process();
+	}
+}
+
+//stripes in the database the FWD laser has fully crossed
+static Luint16 u16LCCM655R0_TS_011__Stripes_Passed(void)
+{
+	Luint16 u16Counter;
+	Luint16 u16Return;
+	Lfloat64 f64Pos_mm;
+
+	f64Pos_mm = f64SIMHLOOP_TRACK__Get_Position_m() * 1000.0;
+	u16Return = 0U;
+	for(u16Counter = 0U; u16Counter < C_FCU__LASER_CONTRAST__MAX_STRIPES; u16Counter++)
+	{
+		if((sFCU.sContrast.sTrackDatabase[(Luint8)LASER_CONT__FWD].u32DistanceElapsed_mm[u16Counter] != 0U) &&
+			(((Lfloat64)sFCU.sContrast.sTrackDatabase[(Luint8)LASER_CONT__FWD].u32DistanceElapsed_mm[u16Counter] + 101.6) < f64Pos_mm))
+		{
+			u16Return++;
+		}
+		else
+		{
+			//ahead of us
+		}
+	}
+
+	return u16Return;
+}
+
+#endif //C_LOCALDEF__LCCM666__ENABLE_THIS_MODULE
+#endif //C_LOCALDEF__LCCM655__ENABLE_LASER_CONTRAST
+#endif
+#endif
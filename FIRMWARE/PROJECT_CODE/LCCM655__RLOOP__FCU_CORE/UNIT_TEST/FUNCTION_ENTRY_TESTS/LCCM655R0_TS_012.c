@@ -0,0 +1,236 @@
+#include <localdef.h>
+
+#ifndef C_LOCALDEF__LCCM655__ENABLE_THIS_MODULE
+	#error
+#endif
+
+#if C_LOCALDEF__LCCM655__ENABLE_THIS_MODULE == 1U
+#if C_LOCALDEF__LCCM655__ENABLE_TEST_SPEC == 1U
+#if C_LOCALDEF__LCCM655__ENABLE_ACCEL == 1U
+#if C_LOCALDEF__LCCM655__ENABLE_ACCEL_FIFO == 1U
+
+void vLCCM655R0_TS_012_TCASE_001(void);
+void vLCCM655R0_TS_012_TCASE_002(void);
+void vLCCM655R0_TS_012_TCASE_003(void);
+
+static void vLCCM655R0_TS_012__Feed(Luint32 u32Start, Luint32 u32Samples, Luint32 u32DrainEvery);
+
+//0.5G at the configured range
+#if C_LOCALDEF__LCCM418__G_FORCE_RANGE == 2U
+	#define C_TS_012__HALF_G					(2048)
+#elif C_LOCALDEF__LCCM418__G_FORCE_RANGE == 4U
+	#define C_TS_012__HALF_G					(1024)
+#else
+	#define C_TS_012__HALF_G					(512)
+#endif
+
+
+//Function to call the tests for this test specification
+void vLCCM655R0_TS_012(void)
+{
+
+	//Call the test cases
+	vLCCM655R0_TS_012_TCASE_001();
+	vLCCM655R0_TS_012_TCASE_002();
+	vLCCM655R0_TS_012_TCASE_003();
+
+}
+
+//Individual Test Cases can be found below
+/***************************************************************************//**
+ * @st_test_case_id
+ * LCCM655R0.TS.012.TCASE.001
+ * @st_test_desc
+ * 0.5G for 500 samples drained every 5 samples. Once the chain has settled
+ * the accel must be 4903mm/s^2 and the velocity gain over the last 400
+ * samples must be a.t to within 0.1%, t taken from the sample times.
+ *
+*/
+void vLCCM655R0_TS_012_TCASE_001(void)
+{
+	Luint8 u8Test;
+	Lint32 s32Veloc;
+	Luint64 u64Time;
+	Lfloat32 f32Expected;
+	DEBUG_PRINT("START:LCCM655R0.TS.012.TCASE.001\r\n");
+
+	vFCU_ACCEL__Init();
+
+	//let the chain settle
+	vLCCM655R0_TS_012__Feed(0U, 100U, 5U);
+	s32Veloc = s32FCU_ACCELL__Get_CurrentVeloc_mms(0U);
+	u64Time = sFCU.sAccel.sChannels[0].sFifo.u64LastSample_Time;
+
+	vLCCM655R0_TS_012__Feed(100U, 400U, 5U);
+
+	u8Test = 1U;
+	if((s32FCU_ACCELL__Get_CurrentAccel_mmss(0U) < 4898) || (s32FCU_ACCELL__Get_CurrentAccel_mmss(0U) > 4908))
+	{
+		u8Test = 0U;
+	}
+
+	//v = a.t
+	f32Expected = 4903.325F * (Lfloat32)(sFCU.sAccel.sChannels[0].sFifo.u64LastSample_Time - u64Time) / (Lfloat32)C_FCU__RTI_COUNTER1_HZ;
+	s32Veloc = s32FCU_ACCELL__Get_CurrentVeloc_mms(0U) - s32Veloc;
+	if(((Lfloat32)s32Veloc < (f32Expected * 0.999F)) || ((Lfloat32)s32Veloc > (f32Expected * 1.001F)))
+	{
+		u8Test = 0U;
+	}
+	if(sFCU.sAccel.sChannels[0].sFifo.u32OverflowCount != 0U)
+	{
+		u8Test = 0U;
+	}
+
+	if(u8Test == 1U)
+	{
+		DEBUG_PRINT("PASS:LCCM655R0.TS.012.TCASE.001\r\n");
+	}
+	else
+	{
+		DEBUG_PRINT("FAIL:LCCM655R0.TS.012.TCASE.001\r\n");
+	}
+	DEBUG_PRINT("END:LCCM655R0.TS.012.TCASE.001\r\n");
+
+}
+
+/***************************************************************************//**
+ * @st_test_case_id
+ * LCCM655R0.TS.012.TCASE.002
+ * @st_test_desc
+ * Let the FIFO overflow, 40 samples between drains. The overflow must be
+ * counted and the integration must still span the gap.
+ *
+*/
+void vLCCM655R0_TS_012_TCASE_002(void)
+{
+	Luint8 u8Test;
+	Lint32 s32Veloc;
+	Luint64 u64Time;
+	Lfloat32 f32Expected;
+	DEBUG_PRINT("START:LCCM655R0.TS.012.TCASE.002\r\n");
+
+	vFCU_ACCEL__Init();
+
+	vLCCM655R0_TS_012__Feed(0U, 100U, 5U);
+	s32Veloc = s32FCU_ACCELL__Get_CurrentVeloc_mms(0U);
+	u64Time = sFCU.sAccel.sChannels[0].sFifo.u64LastSample_Time;
+
+	vLCCM655R0_TS_012__Feed(100U, 40U, 40U);
+
+	u8Test = 1U;
+	if(sFCU.sAccel.sChannels[0].sFifo.u32OverflowCount != 1U)
+	{
+		u8Test = 0U;
+	}
+
+	//v = a.t over all 40 samples, within 1%
+	f32Expected = 4903.325F * (Lfloat32)(sFCU.sAccel.sChannels[0].sFifo.u64LastSample_Time - u64Time) / (Lfloat32)C_FCU__RTI_COUNTER1_HZ;
+	s32Veloc = s32FCU_ACCELL__Get_CurrentVeloc_mms(0U) - s32Veloc;
+	if(((Lfloat32)s32Veloc < (f32Expected * 0.99F)) || ((Lfloat32)s32Veloc > (f32Expected * 1.01F)) || (f32Expected < 3800.0F))
+	{
+		u8Test = 0U;
+	}
+
+	if(u8Test == 1U)
+	{
+		DEBUG_PRINT("PASS:LCCM655R0.TS.012.TCASE.002\r\n");
+	}
+	else
+	{
+		DEBUG_PRINT("FAIL:LCCM655R0.TS.012.TCASE.002\r\n");
+	}
+	DEBUG_PRINT("END:LCCM655R0.TS.012.TCASE.002\r\n");
+
+}
+
+/***************************************************************************//**
+ * @st_test_case_id
+ * LCCM655R0.TS.012.TCASE.003
+ * @st_test_desc
+ * Filter setup limits, and a single unity tap with the IIR passed through
+ * must give the raw sample back on the first sample.
+ *
+*/
+void vLCCM655R0_TS_012_TCASE_003(void)
+{
+	Luint8 u8Test;
+	Lint16 s16Coeff[C_FCU__ACCEL_FIR_MAX_TAPS + 1U];
+	Luint8 u8Counter;
+	DEBUG_PRINT("START:LCCM655R0.TS.012.TCASE.003\r\n");
+
+	vFCU_ACCEL__Init();
+
+	for(u8Counter = 0U; u8Counter < (C_FCU__ACCEL_FIR_MAX_TAPS + 1U); u8Counter++)
+	{
+		s16Coeff[u8Counter] = 0;
+	}
+	s16Coeff[0] = 32767;
+
+	u8Test = 1U;
+	if(s16FCU_ACCEL_FIFO__Set_FIR(&s16Coeff[0], 0U) != -1)
+	{
+		u8Test = 0U;
+	}
+	if(s16FCU_ACCEL_FIFO__Set_FIR(&s16Coeff[0], C_FCU__ACCEL_FIR_MAX_TAPS + 1U) != -1)
+	{
+		u8Test = 0U;
+	}
+	if(s16FCU_ACCEL_FIFO__Set_IIR(0) != -1)
+	{
+		u8Test = 0U;
+	}
+	if(s16FCU_ACCEL_FIFO__Set_FIR(&s16Coeff[0], 1U) != 0)
+	{
+		u8Test = 0U;
+	}
+	if(s16FCU_ACCEL_FIFO__Set_IIR(32767) != 0)
+	{
+		u8Test = 0U;
+	}
+
+	//Q15 unity is one LSB short, allow for it
+	vLCCM655R0_TS_012__Feed(0U, 1U, 1U);
+	if((s16FCU_ACCEL__Get_LastSample(0U, (Luint8)MMA8451_AXIS__Y) != C_TS_012__HALF_G) ||
+		(sFCU.sAccel.sChannels[0].s16FilteredResult < (C_TS_012__HALF_G - 1)) ||
+		(sFCU.sAccel.sChannels[0].s16FilteredResult > C_TS_012__HALF_G))
+	{
+		u8Test = 0U;
+	}
+
+	if(u8Test == 1U)
+	{
+		DEBUG_PRINT("PASS:LCCM655R0.TS.012.TCASE.003\r\n");
+	}
+	else
+	{
+		DEBUG_PRINT("FAIL:LCCM655R0.TS.012.TCASE.003\r\n");
+	}
+	DEBUG_PRINT("END:LCCM655R0.TS.012.TCASE.003\r\n");
+
+}
+
+//0.5G into device 0 at the device ODR, with the RTI following the samples
+static void vLCCM655R0_TS_012__Feed(Luint32 u32Start, Luint32 u32Samples, Luint32 u32DrainEvery)
+{
+	Luint32 u32Counter;
+
+	for(u32Counter = u32Start; u32Counter < (u32Start + u32Samples); u32Counter++)
+	{
+		u64RTI_WIN32__Counter1 = (Luint64)u32Counter * (Luint64)(C_FCU__RTI_COUNTER1_HZ / C_LOCALDEF__LCCM418__DEV0__DATA_RATE_HZ);
+		vFCU_ACCEL_WIN32__Set_Raw(0U, (Luint8)MMA8451_AXIS__Y, C_TS_012__HALF_G);
+
+		if(((u32Counter + 1U) % u32DrainEvery) == 0U)
+		{
+			vFCU_ACCEL_FIFO__Process();
+		}
+		else
+		{
+			//fall on
+		}
+	}
+}
+
+#endif //C_LOCALDEF__LCCM655__ENABLE_ACCEL_FIFO
+#endif //C_LOCALDEF__LCCM655__ENABLE_ACCEL
+#endif
+#endif
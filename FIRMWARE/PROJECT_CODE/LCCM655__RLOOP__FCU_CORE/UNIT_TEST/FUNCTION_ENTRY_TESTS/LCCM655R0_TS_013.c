@@ -0,0 +1,350 @@
+#include <localdef.h>
+
+#ifndef C_LOCALDEF__LCCM655__ENABLE_THIS_MODULE
+	#error
+#endif
+
+#if C_LOCALDEF__LCCM655__ENABLE_THIS_MODULE == 1U
+#if C_LOCALDEF__LCCM655__ENABLE_TEST_SPEC == 1U
+#if C_LOCALDEF__LCCM655__ENABLE_SCHEDULER == 1U
+
+void vLCCM655R0_TS_013_TCASE_001(void);
+void vLCCM655R0_TS_013_TCASE_002(void);
+void vLCCM655R0_TS_013_TCASE_003(void);
+#if C_LOCALDEF__LCCM655__ENABLE_PROFILE == 1U
+void vLCCM655R0_TS_013_TCASE_004(void);
+#endif
+
+static void vLCCM655R0_TS_013__Setup(void);
+static void vLCCM655R0_TS_013__Run(E_FCU_SCHED__TASK_T eTask);
+static void vLCCM655R0_TS_013__Task_LaserCont(void);
+static void vLCCM655R0_TS_013__Task_FCTL(void);
+static void vLCCM655R0_TS_013__Task_Faults(void);
+
+//what ran, in order
+static Luint8 u8TS_013__Log[16];
+static Luint8 u8TS_013__LogCount;
+
+//run time of each stub in RTI ticks
+static Luint32 u32TS_013__Cost[(Luint8)FCU_SCHED__MAX];
+
+
+//Function to call the tests for this test specification
+void vLCCM655R0_TS_013(void)
+{
+
+	//Call the test cases
+	vLCCM655R0_TS_013_TCASE_001();
+	vLCCM655R0_TS_013_TCASE_002();
+	vLCCM655R0_TS_013_TCASE_003();
+#if C_LOCALDEF__LCCM655__ENABLE_PROFILE == 1U
+	vLCCM655R0_TS_013_TCASE_004();
+#endif
+
+}
+
+//Individual Test Cases can be found below
+/***************************************************************************//**
+ * @st_test_case_id
+ * LCCM655R0.TS.013.TCASE.001
+ * @st_test_desc
+ * Every task is due on the first pass and must run in priority order with
+ * equal priorities in table order. A second pass in the same tick must only
+ * run the polled task.
+ *
+*/
+void vLCCM655R0_TS_013_TCASE_001(void)
+{
+	Luint8 u8Test;
+	DEBUG_PRINT("START:LCCM655R0.TS.013.TCASE.001\r\n");
+
+	vLCCM655R0_TS_013__Setup();
+
+	vFCU_SCHED__Process();
+
+	u8Test = 1U;
+	if((u8TS_013__LogCount != 3U) ||
+		(u8TS_013__Log[0] != (Luint8)FCU_SCHED__LASERCONT) ||
+		(u8TS_013__Log[1] != (Luint8)FCU_SCHED__FCTL) ||
+		(u8TS_013__Log[2] != (Luint8)FCU_SCHED__FAULTS))
+	{
+		u8Test = 0U;
+	}
+
+	u8TS_013__LogCount = 0U;
+	vFCU_SCHED__Process();
+	if((u8TS_013__LogCount != 1U) || (u8TS_013__Log[0] != (Luint8)FCU_SCHED__FCTL))
+	{
+		u8Test = 0U;
+	}
+
+	if(u8Test == 1U)
+	{
+		DEBUG_PRINT("PASS:LCCM655R0.TS.013.TCASE.001\r\n");
+	}
+	else
+	{
+		DEBUG_PRINT("FAIL:LCCM655R0.TS.013.TCASE.001\r\n");
+	}
+	DEBUG_PRINT("END:LCCM655R0.TS.013.TCASE.001\r\n");
+
+}
+
+/***************************************************************************//**
+ * @st_test_case_id
+ * LCCM655R0.TS.013.TCASE.002
+ * @st_test_desc
+ * A ready flag must run the contrast task straight away, once. After that it
+ * runs on its 10ms period and the faults only every 100ms.
+ *
+*/
+void vLCCM655R0_TS_013_TCASE_002(void)
+{
+	Luint8 u8Test;
+	Luint8 u8Counter;
+	DEBUG_PRINT("START:LCCM655R0.TS.013.TCASE.002\r\n");
+
+	vLCCM655R0_TS_013__Setup();
+	vFCU_SCHED__Process();
+
+	u8Test = 1U;
+
+	//event, same tick
+	vFCU_SCHED__Set_Ready(FCU_SCHED__LASERCONT);
+	vFCU_SCHED__Process();
+	vFCU_SCHED__Process();
+	if(sFCU.sSched.sTasks[FCU_SCHED__LASERCONT].u32Runs != 2U)
+	{
+		u8Test = 0U;
+	}
+
+	//9 ticks, contrast every tick, faults not yet
+	for(u8Counter = 0U; u8Counter < 9U; u8Counter++)
+	{
+		vFCU_SCHED__10MS_ISR();
+		vFCU_SCHED__Process();
+		vFCU_SCHED__Process();
+	}
+	if((sFCU.sSched.sTasks[FCU_SCHED__LASERCONT].u32Runs != 11U) ||
+		(sFCU.sSched.sTasks[FCU_SCHED__FAULTS].u32Runs != 1U) ||
+		(sFCU.sSched.sTasks[FCU_SCHED__FCTL].u32Runs != 21U))
+	{
+		u8Test = 0U;
+	}
+
+	//100ms
+	vFCU_SCHED__10MS_ISR();
+	vFCU_SCHED__Process();
+	if(sFCU.sSched.sTasks[FCU_SCHED__FAULTS].u32Runs != 2U)
+	{
+		u8Test = 0U;
+	}
+
+	if(u8Test == 1U)
+	{
+		DEBUG_PRINT("PASS:LCCM655R0.TS.013.TCASE.002\r\n");
+	}
+	else
+	{
+		DEBUG_PRINT("FAIL:LCCM655R0.TS.013.TCASE.002\r\n");
+	}
+	DEBUG_PRINT("END:LCCM655R0.TS.013.TCASE.002\r\n");
+
+}
+
+/***************************************************************************//**
+ * @st_test_case_id
+ * LCCM655R0.TS.013.TCASE.003
+ * @st_test_desc
+ * Worst case, average and overruns per task, and the brake and nav chain
+ * deadline. Contrast 800us + flight control 300us is over the 1ms chain
+ * budget, flight control alone is over the task budget.
+ *
+*/
+void vLCCM655R0_TS_013_TCASE_003(void)
+{
+	Luint8 u8Test;
+	DEBUG_PRINT("START:LCCM655R0.TS.013.TCASE.003\r\n");
+
+	vLCCM655R0_TS_013__Setup();
+
+	u32TS_013__Cost[FCU_SCHED__LASERCONT] = 800U * C_FCU__SCHED__TICKS_PER_US;
+	u32TS_013__Cost[FCU_SCHED__FCTL] = 300U * C_FCU__SCHED__TICKS_PER_US;
+	u32TS_013__Cost[FCU_SCHED__FAULTS] = 50U * C_FCU__SCHED__TICKS_PER_US;
+	vFCU_SCHED__Process();
+
+	//second pass only flight control, cheaper
+	u32TS_013__Cost[FCU_SCHED__FCTL] = 100U * C_FCU__SCHED__TICKS_PER_US;
+	vFCU_SCHED__Process();
+
+	u8Test = 1U;
+	if((u32FCU_SCHED__Get_Max_us(FCU_SCHED__FCTL) != 300U) || (u32FCU_SCHED__Get_Avg_us(FCU_SCHED__FCTL) != 200U))
+	{
+		u8Test = 0U;
+	}
+	if(sFCU.sSched.sTasks[FCU_SCHED__FCTL].u32Overruns != 1U)
+	{
+		u8Test = 0U;
+	}
+	if(sFCU.sSched.sTasks[FCU_SCHED__FAULTS].u32Overruns != 0U)
+	{
+		u8Test = 0U;
+	}
+
+	//faults is not in the chain
+	if((sFCU.sSched.u32Critical_Max_Ticks != (1100U * C_FCU__SCHED__TICKS_PER_US)) || (sFCU.sSched.u32Critical_Misses != 1U))
+	{
+		u8Test = 0U;
+	}
+	if(sFCU.sSched.u32Pass_Max_Ticks != (1150U * C_FCU__SCHED__TICKS_PER_US))
+	{
+		u8Test = 0U;
+	}
+
+	vFCU_SCHED__Reset_Stats();
+	if((u32FCU_SCHED__Get_Max_us(FCU_SCHED__FCTL) != 0U) || (sFCU.sSched.u32Critical_Misses != 0U))
+	{
+		u8Test = 0U;
+	}
+
+	if(u8Test == 1U)
+	{
+		DEBUG_PRINT("PASS:LCCM655R0.TS.013.TCASE.003\r\n");
+	}
+	else
+	{
+		DEBUG_PRINT("FAIL:LCCM655R0.TS.013.TCASE.003\r\n");
+	}
+	DEBUG_PRINT("END:LCCM655R0.TS.013.TCASE.003\r\n");
+
+}
+
+#if C_LOCALDEF__LCCM655__ENABLE_PROFILE == 1U
+/***************************************************************************//**
+ * @st_test_case_id
+ * LCCM655R0.TS.013.TCASE.004
+ * @st_test_desc
+ * Profiler probes on the tasks. 100 ticks is in bin 0, 1000 in bin 3, 3000
+ * in bin 5 and 2^31 saturates the last bin. A stop without a start is
+ * ignored and a reset keeps the names.
+ *
+*/
+void vLCCM655R0_TS_013_TCASE_004(void)
+{
+	Luint8 u8Test;
+	DEBUG_PRINT("START:LCCM655R0.TS.013.TCASE.004\r\n");
+
+	vLCCM655R0_TS_013__Setup();
+
+	u32TS_013__Cost[FCU_SCHED__LASERCONT] = 100U;
+	u32TS_013__Cost[FCU_SCHED__FCTL] = 1000U;
+	u32TS_013__Cost[FCU_SCHED__FAULTS] = 0x80000000U;
+	vFCU_SCHED__Process();
+
+	u32TS_013__Cost[FCU_SCHED__FCTL] = 3000U;
+	vFCU_SCHED__Process();
+
+	u8Test = 1U;
+	if((sFCU.sSched.sProfile[FCU_SCHED__FCTL].u32Count != 2U) ||
+		(sFCU.sSched.sProfile[FCU_SCHED__FCTL].u32Min_Ticks != 1000U) ||
+		(sFCU.sSched.sProfile[FCU_SCHED__FCTL].u32Max_Ticks != 3000U) ||
+		(u32FCU_SCHED_PROFILE__Get_Mean(FCU_SCHED__FCTL) != 2000U))
+	{
+		u8Test = 0U;
+	}
+	if((sFCU.sSched.sProfile[FCU_SCHED__FCTL].u16Hist[3] != 1U) || (sFCU.sSched.sProfile[FCU_SCHED__FCTL].u16Hist[5] != 1U))
+	{
+		u8Test = 0U;
+	}
+	if(sFCU.sSched.sProfile[FCU_SCHED__LASERCONT].u16Hist[0] != 1U)
+	{
+		u8Test = 0U;
+	}
+	if(sFCU.sSched.sProfile[FCU_SCHED__FAULTS].u16Hist[C_FCU__PROFILE__HIST_BINS - 1U] != 1U)
+	{
+		u8Test = 0U;
+	}
+
+	//not started
+	vFCU_SCHED_PROFILE__Stop(C_FCU__PROFILE__PROBE_RTI_10MS);
+	if(sFCU.sSched.sProfile[C_FCU__PROFILE__PROBE_RTI_10MS].u32Count != 0U)
+	{
+		u8Test = 0U;
+	}
+
+	vFCU_SCHED_PROFILE__Reset();
+	if((sFCU.sSched.sProfile[FCU_SCHED__FCTL].u32Count != 0U) ||
+		(sFCU.sSched.sProfile[FCU_SCHED__FCTL].u16Hist[3] != 0U) ||
+		(u32FCU_SCHED_PROFILE__Get_Mean(FCU_SCHED__FCTL) != 0U) ||
+		(sFCU.sSched.sProfile[FCU_SCHED__FCTL].u8Name[0] != (Luint8)'F'))
+	{
+		u8Test = 0U;
+	}
+
+	if(u8Test == 1U)
+	{
+		DEBUG_PRINT("PASS:LCCM655R0.TS.013.TCASE.004\r\n");
+	}
+	else
+	{
+		DEBUG_PRINT("FAIL:LCCM655R0.TS.013.TCASE.004\r\n");
+	}
+	DEBUG_PRINT("END:LCCM655R0.TS.013.TCASE.004\r\n");
+
+}
+#endif
+
+//just our three stubs in the table, taking no time until told to
+static void vLCCM655R0_TS_013__Setup(void)
+{
+	Luint8 u8Counter;
+
+	u64RTI_WIN32__Counter1 = 0U;
+	vFCU_SCHED__Init();
+
+	for(u8Counter = 0U; u8Counter < (Luint8)FCU_SCHED__MAX; u8Counter++)
+	{
+		vFCU_SCHED_WIN32__Set_Task((E_FCU_SCHED__TASK_T)u8Counter, 0, C_FCU__SCHED__PRIORITY_BACKGROUND, 0U, 0U);
+		u32TS_013__Cost[u8Counter] = 0U;
+	}
+	//event driven with a 10ms backstop, polled, and 100ms
+	vFCU_SCHED_WIN32__Set_Task(FCU_SCHED__LASERCONT, &vLCCM655R0_TS_013__Task_LaserCont, C_FCU__SCHED__PRIORITY_CRITICAL, 1U, 1U);
+	vFCU_SCHED_WIN32__Set_Task(FCU_SCHED__FCTL, &vLCCM655R0_TS_013__Task_FCTL, C_FCU__SCHED__PRIORITY_CRITICAL, 0U, 1U);
+	vFCU_SCHED_WIN32__Set_Task(FCU_SCHED__FAULTS, &vLCCM655R0_TS_013__Task_Faults, C_FCU__SCHED__PRIORITY_BACKGROUND, 10U, 0U);
+
+	u8TS_013__LogCount = 0U;
+}
+
+//log the task and burn its time on the RTI
+static void vLCCM655R0_TS_013__Run(E_FCU_SCHED__TASK_T eTask)
+{
+	if(u8TS_013__LogCount < 16U)
+	{
+		u8TS_013__Log[u8TS_013__LogCount] = (Luint8)eTask;
+		u8TS_013__LogCount++;
+	}
+	else
+	{
+		//full
+	}
+	u64RTI_WIN32__Counter1 += (Luint64)u32TS_013__Cost[eTask];
+}
+
+static void vLCCM655R0_TS_013__Task_LaserCont(void)
+{
+	vLCCM655R0_TS_013__Run(FCU_SCHED__LASERCONT);
+}
+
+static void vLCCM655R0_TS_013__Task_FCTL(void)
+{
+	vLCCM655R0_TS_013__Run(FCU_SCHED__FCTL);
+}
+
+static void vLCCM655R0_TS_013__Task_Faults(void)
+{
+	vLCCM655R0_TS_013__Run(FCU_SCHED__FAULTS);
+}
+
+#endif //C_LOCALDEF__LCCM655__ENABLE_SCHEDULER
+#endif
+#endif
@@ -0,0 +1,245 @@
+#include <localdef.h>
+
+#ifndef C_LOCALDEF__LCCM655__ENABLE_THIS_MODULE
+	#error
+#endif
+
+#if C_LOCALDEF__LCCM655__ENABLE_THIS_MODULE == 1U
+#if C_LOCALDEF__LCCM655__ENABLE_TEST_SPEC == 1U
+#if C_LOCALDEF__LCCM655__ENABLE_LASER_DISTANCE == 1U
+
+void vLCCM655R0_TS_014_TCASE_001(void);
+void vLCCM655R0_TS_014_TCASE_002(void);
+void vLCCM655R0_TS_014_TCASE_003(void);
+
+static Luint8 u8LCCM655R0_TS_014__Packet(Lint32 s32Distance_mm, Luint8 *pu8Buffer);
+
+//10ms between laser packets
+#define C_TS_014__PERIOD							(C_FCU__RTI_COUNTER1_HZ / 100U)
+
+
+//Function to call the tests for this test specification
+void vLCCM655R0_TS_014(void)
+{
+
+	//Call the test cases
+	vLCCM655R0_TS_014_TCASE_001();
+	vLCCM655R0_TS_014_TCASE_002();
+	vLCCM655R0_TS_014_TCASE_003();
+
+}
+
+//Individual Test Cases can be found below
+/***************************************************************************//**
+ * @st_test_case_id
+ * LCCM655R0.TS.014.TCASE.001
+ * @st_test_desc
+ * Packets interrupt every 10ms, 100mm closer each time, but the main loop
+ * drains them 1ms, 7ms then 3ms late. The packet times must be the
+ * interrupt times and the velocity 10000mm/s with no accel.
+ *
+*/
+void vLCCM655R0_TS_014_TCASE_001(void)
+{
+	Luint8 u8Test;
+	Luint8 u8Counter;
+	Luint8 u8Count;
+	Luint8 u8Buffer[8];
+	const Luint32 u32Late[3] = {50000U, 350000U, 150000U};
+	DEBUG_PRINT("START:LCCM655R0.TS.014.TCASE.001\r\n");
+
+	vFCU_LASERDIST__Init();
+
+	u8Test = 1U;
+	for(u8Counter = 0U; u8Counter < 3U; u8Counter++)
+	{
+		u64RTI_WIN32__Counter1 = (Luint64)u8Counter * (Luint64)C_TS_014__PERIOD;
+		vFCU_LASERDIST__RX_ISR();
+
+		u64RTI_WIN32__Counter1 += (Luint64)u32Late[u8Counter];
+		u8Count = u8LCCM655R0_TS_014__Packet(10000 - ((Lint32)u8Counter * 100), &u8Buffer[0]);
+		vFCU_LASERDIST__Rx_Bytes(&u8Buffer[0], u8Count);
+
+		if(sFCU.sLaserDist.u64Packet_Time != ((Luint64)u8Counter * (Luint64)C_TS_014__PERIOD))
+		{
+			u8Test = 0U;
+		}
+		else
+		{
+			//fall on
+		}
+	}
+
+	if((sFCU.sLaserDist.s32Distance_mm != 9800) ||
+		(sFCU.sLaserDist.s32Velocity_mm_s != 10000) ||
+		(sFCU.sLaserDist.s32Accel_mm_ss != 0))
+	{
+		u8Test = 0U;
+	}
+	else
+	{
+		//fall on
+	}
+
+	if(u8Test == 1U)
+	{
+		DEBUG_PRINT("PASS:LCCM655R0.TS.014.TCASE.001\r\n");
+	}
+	else
+	{
+		DEBUG_PRINT("FAIL:LCCM655R0.TS.014.TCASE.001\r\n");
+	}
+	DEBUG_PRINT("END:LCCM655R0.TS.014.TCASE.001\r\n");
+
+}
+
+/***************************************************************************//**
+ * @st_test_case_id
+ * LCCM655R0.TS.014.TCASE.002
+ * @st_test_desc
+ * Two packets drained under one interrupt. The newer one replaces the older
+ * and keeps the veloc, the next packet must then see 10000mm/s from the
+ * newer distance.
+ *
+*/
+void vLCCM655R0_TS_014_TCASE_002(void)
+{
+	Luint8 u8Test;
+	Luint8 u8Count;
+	Luint8 u8Buffer[8];
+	DEBUG_PRINT("START:LCCM655R0.TS.014.TCASE.002\r\n");
+
+	vFCU_LASERDIST__Init();
+
+	u8Test = 1U;
+
+	u64RTI_WIN32__Counter1 = 0U;
+	vFCU_LASERDIST__RX_ISR();
+	u8Count = u8LCCM655R0_TS_014__Packet(10000, &u8Buffer[0]);
+	vFCU_LASERDIST__Rx_Bytes(&u8Buffer[0], u8Count);
+
+	//the loop stalled, two packets under the one interrupt
+	u64RTI_WIN32__Counter1 = (Luint64)C_TS_014__PERIOD;
+	vFCU_LASERDIST__RX_ISR();
+	u8Count = u8LCCM655R0_TS_014__Packet(9900, &u8Buffer[0]);
+	u8Count += u8LCCM655R0_TS_014__Packet(9890, &u8Buffer[u8Count]);
+	vFCU_LASERDIST__Rx_Bytes(&u8Buffer[0], u8Count);
+
+	if((sFCU.sLaserDist.s32Distance_mm != 9890) ||
+		(sFCU.sLaserDist.s32PrevDistance_mm != 10000) ||
+		(sFCU.sLaserDist.s32Velocity_mm_s != 10000))
+	{
+		u8Test = 0U;
+	}
+	else
+	{
+		//fall on
+	}
+
+	u64RTI_WIN32__Counter1 = 2U * (Luint64)C_TS_014__PERIOD;
+	vFCU_LASERDIST__RX_ISR();
+	u8Count = u8LCCM655R0_TS_014__Packet(9790, &u8Buffer[0]);
+	vFCU_LASERDIST__Rx_Bytes(&u8Buffer[0], u8Count);
+
+	if((sFCU.sLaserDist.s32Distance_mm != 9790) ||
+		(sFCU.sLaserDist.s32Velocity_mm_s != 10000) ||
+		(sFCU.sLaserDist.u8PacketHistory != 2U))
+	{
+		u8Test = 0U;
+	}
+	else
+	{
+		//fall on
+	}
+
+	if(u8Test == 1U)
+	{
+		DEBUG_PRINT("PASS:LCCM655R0.TS.014.TCASE.002\r\n");
+	}
+	else
+	{
+		DEBUG_PRINT("FAIL:LCCM655R0.TS.014.TCASE.002\r\n");
+	}
+	DEBUG_PRINT("END:LCCM655R0.TS.014.TCASE.002\r\n");
+
+}
+
+/***************************************************************************//**
+ * @st_test_case_id
+ * LCCM655R0.TS.014.TCASE.003
+ * @st_test_desc
+ * An interrupt time is used once. A drain with no interrupt behind it, as
+ * when the SC16 is polled, is stamped with the drain time.
+ *
+*/
+void vLCCM655R0_TS_014_TCASE_003(void)
+{
+	Luint8 u8Test;
+	Luint8 u8Count;
+	Luint8 u8Buffer[8];
+	DEBUG_PRINT("START:LCCM655R0.TS.014.TCASE.003\r\n");
+
+	vFCU_LASERDIST__Init();
+
+	u8Test = 1U;
+
+	u64RTI_WIN32__Counter1 = 1000U;
+	vFCU_LASERDIST__RX_ISR();
+	u64RTI_WIN32__Counter1 = 2000U;
+	u8Count = u8LCCM655R0_TS_014__Packet(5000, &u8Buffer[0]);
+	vFCU_LASERDIST__Rx_Bytes(&u8Buffer[0], u8Count);
+	if(sFCU.sLaserDist.u64Packet_Time != 1000U)
+	{
+		u8Test = 0U;
+	}
+	else
+	{
+		//fall on
+	}
+
+	u64RTI_WIN32__Counter1 = 3000U + (Luint64)C_TS_014__PERIOD;
+	u8Count = u8LCCM655R0_TS_014__Packet(4900, &u8Buffer[0]);
+	vFCU_LASERDIST__Rx_Bytes(&u8Buffer[0], u8Count);
+	if((sFCU.sLaserDist.u64Packet_Time != (3000U + (Luint64)C_TS_014__PERIOD)) ||
+		(sFCU.sLaserDist.u8RxISR_Pending != 0U))
+	{
+		u8Test = 0U;
+	}
+	else
+	{
+		//fall on
+	}
+
+	if(u8Test == 1U)
+	{
+		DEBUG_PRINT("PASS:LCCM655R0.TS.014.TCASE.003\r\n");
+	}
+	else
+	{
+		DEBUG_PRINT("FAIL:LCCM655R0.TS.014.TCASE.003\r\n");
+	}
+	DEBUG_PRINT("END:LCCM655R0.TS.014.TCASE.003\r\n");
+
+}
+
+//build a binary distance packet as the laser sends it
+static Luint8 u8LCCM655R0_TS_014__Packet(Lint32 s32Distance_mm, Luint8 *pu8Buffer)
+{
+	Luint8 u8Return;
+
+	pu8Buffer[0] = 0x80U | (Luint8)(((Luint32)s32Distance_mm >> 14U) & 0x3FU);
+	pu8Buffer[1] = (Luint8)(((Luint32)s32Distance_mm >> 7U) & 0x7FU);
+	pu8Buffer[2] = (Luint8)((Luint32)s32Distance_mm & 0x7FU);
+	u8Return = 3U;
+
+#if C_FCU__LASERDIST__AMPLITUDE_BYTE == 1U
+	pu8Buffer[3] = 0x10U;
+	u8Return++;
+#endif
+
+	return u8Return;
+}
+
+#endif //C_LOCALDEF__LCCM655__ENABLE_LASER_DISTANCE
+#endif
+#endif
@@ -0,0 +1,181 @@
+#include <localdef.h>
+
+#ifndef C_LOCALDEF__LCCM655__ENABLE_THIS_MODULE
+	#error
+#endif
+
+#if C_LOCALDEF__LCCM655__ENABLE_THIS_MODULE == 1U
+#if C_LOCALDEF__LCCM655__ENABLE_TEST_SPEC == 1U
+#if C_LOCALDEF__LCCM655__ENABLE_FLIGHT_CONTROL == 1U
+#if C_LOCALDEF__LCCM655__ENABLE_FCTL_ORIENTATION == 1U
+
+void vLCCM655R0_TS_015_TCASE_001(void);
+void vLCCM655R0_TS_015_TCASE_002(void);
+
+static void vLCCM655R0_TS_015__Setup(void);
+static void vLCCM655R0_TS_015__Fit(Lfloat32 f32Ground0, Lfloat32 f32Ground1, Lfloat32 f32Ground2, Lfloat32 f32Ground3);
+
+//laser reading with the pod sitting flat
+#define C_TS_015__FLAT_MM						(50.0F)
+
+
+//Function to call the tests for this test specification
+void vLCCM655R0_TS_015(void)
+{
+
+	//Call the test cases
+	vLCCM655R0_TS_015_TCASE_001();
+	vLCCM655R0_TS_015_TCASE_002();
+
+}
+
+//Individual Test Cases can be found below
+/***************************************************************************//**
+ * @st_test_case_id
+ * LCCM655R0.TS.015.TCASE.001
+ * @st_test_desc
+ * Flat ground, then a 10mm spike under laser 2 only. The spike must be left
+ * out of the fit with the plane still flat, and once the reading is good
+ * again the laser must be back in the fit.
+ *
+*/
+void vLCCM655R0_TS_015_TCASE_001(void)
+{
+	Luint8 u8Test;
+	DEBUG_PRINT("START:LCCM655R0.TS.015.TCASE.001\r\n");
+
+	vLCCM655R0_TS_015__Setup();
+
+	u8Test = 1U;
+
+	vLCCM655R0_TS_015__Fit(0.0F, 0.0F, 0.0F, 0.0F);
+	if(sFCU.sFlightControl.sOrient.sLSQ.u8Mask != 0x0FU)
+	{
+		u8Test = 0U;
+	}
+	else
+	{
+		//fall on
+	}
+
+	//spike
+	vLCCM655R0_TS_015__Fit(0.0F, 0.0F, 10.0F, 0.0F);
+	if((sFCU.sFlightControl.sOrient.sLSQ.u8Mask != 0x0BU) ||
+		(sFCU.sFlightControl.sOrient.sLSQ.u32OutlierCount != 1U) ||
+		(f32SIL3_NUM_FLOAT__ABS(sFCU.sFlightControl.sOrient.f32PlaneCoeffs[LASER_ORIENT__D]) > 0.01F))
+	{
+		u8Test = 0U;
+	}
+	else
+	{
+		//fall on
+	}
+
+	//good again
+	vLCCM655R0_TS_015__Fit(0.0F, 0.0F, 0.0F, 0.0F);
+	if((sFCU.sFlightControl.sOrient.sLSQ.u8Mask != 0x0FU) ||
+		(sFCU.sFlightControl.sOrient.sLSQ.u32OutlierCount != 1U))
+	{
+		u8Test = 0U;
+	}
+	else
+	{
+		//fall on
+	}
+
+	if(u8Test == 1U)
+	{
+		DEBUG_PRINT("PASS:LCCM655R0.TS.015.TCASE.001\r\n");
+	}
+	else
+	{
+		DEBUG_PRINT("FAIL:LCCM655R0.TS.015.TCASE.001\r\n");
+	}
+	DEBUG_PRINT("END:LCCM655R0.TS.015.TCASE.001\r\n");
+
+}
+
+/***************************************************************************//**
+ * @st_test_case_id
+ * LCCM655R0.TS.015.TCASE.002
+ * @st_test_desc
+ * The pod tilts so only laser 2 moves more than the outlier limit from the
+ * last plane, but all four are still on one plane. Laser 2 must stay in the
+ * fit and the plane must follow. A whole pod rise of 5mm must not reject
+ * anything either.
+ *
+*/
+void vLCCM655R0_TS_015_TCASE_002(void)
+{
+	Luint8 u8Test;
+	DEBUG_PRINT("START:LCCM655R0.TS.015.TCASE.002\r\n");
+
+	vLCCM655R0_TS_015__Setup();
+
+	u8Test = 1U;
+
+	vLCCM655R0_TS_015__Fit(0.0F, 0.0F, 0.0F, 0.0F);
+
+	//tilt, 3mm at laser 2, 1.5mm at 0 and 3, nothing at 1
+	vLCCM655R0_TS_015__Fit(1.5F, 0.0F, 3.0F, 1.5F);
+	if((sFCU.sFlightControl.sOrient.sLSQ.u8Mask != 0x0FU) ||
+		(sFCU.sFlightControl.sOrient.sLSQ.u32OutlierCount != 0U) ||
+		(f32SIL3_NUM_FLOAT__ABS(sFCU.sFlightControl.sOrient.sLSQ.f32Residual[2]) > 0.01F))
+	{
+		u8Test = 0U;
+	}
+	else
+	{
+		//fall on
+	}
+
+	//rise
+	vLCCM655R0_TS_015__Fit(6.5F, 5.0F, 8.0F, 6.5F);
+	if((sFCU.sFlightControl.sOrient.sLSQ.u8Mask != 0x0FU) ||
+		(sFCU.sFlightControl.sOrient.sLSQ.u32OutlierCount != 0U))
+	{
+		u8Test = 0U;
+	}
+	else
+	{
+		//fall on
+	}
+
+	if(u8Test == 1U)
+	{
+		DEBUG_PRINT("PASS:LCCM655R0.TS.015.TCASE.002\r\n");
+	}
+	else
+	{
+		DEBUG_PRINT("FAIL:LCCM655R0.TS.015.TCASE.002\r\n");
+	}
+	DEBUG_PRINT("END:LCCM655R0.TS.015.TCASE.002\r\n");
+
+}
+
+//four ground lasers on a 2m x 1m rectangle
+static void vLCCM655R0_TS_015__Setup(void)
+{
+	vFCU_FLIGHTCTL_LASERORIENT__Init();
+	vFCU_FLIGHTCTL_LASERORIENT__Set_GroundLaser_Position(0U, 1000.0F, 500.0F, C_TS_015__FLAT_MM);
+	vFCU_FLIGHTCTL_LASERORIENT__Set_GroundLaser_Position(1U, -1000.0F, 500.0F, C_TS_015__FLAT_MM);
+	vFCU_FLIGHTCTL_LASERORIENT__Set_GroundLaser_Position(2U, 1000.0F, -500.0F, C_TS_015__FLAT_MM);
+	vFCU_FLIGHTCTL_LASERORIENT__Set_GroundLaser_Position(3U, -1000.0F, -500.0F, C_TS_015__FLAT_MM);
+}
+
+//ground height under each laser, run one fit
+static void vLCCM655R0_TS_015__Fit(Lfloat32 f32Ground0, Lfloat32 f32Ground1, Lfloat32 f32Ground2, Lfloat32 f32Ground3)
+{
+	sFCU.sFlightControl.sOrient.sGroundLasers[0].f32Measurement = C_TS_015__FLAT_MM - f32Ground0;
+	sFCU.sFlightControl.sOrient.sGroundLasers[1].f32Measurement = C_TS_015__FLAT_MM - f32Ground1;
+	sFCU.sFlightControl.sOrient.sGroundLasers[2].f32Measurement = C_TS_015__FLAT_MM - f32Ground2;
+	sFCU.sFlightControl.sOrient.sGroundLasers[3].f32Measurement = C_TS_015__FLAT_MM - f32Ground3;
+
+	sFCU.sFlightControl.sOrient.eState = LASER_ORIENTATION_STATE__RECALCULATE_PITCH_ROLL_TWIST;
+	vFCU_FLIGHTCTL_LASERORIENT__Process();
+}
+
+#endif //C_LOCALDEF__LCCM655__ENABLE_FCTL_ORIENTATION
+#endif //C_LOCALDEF__LCCM655__ENABLE_FLIGHT_CONTROL
+#endif
+#endif
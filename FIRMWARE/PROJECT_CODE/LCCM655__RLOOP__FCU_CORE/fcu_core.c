@@ -58,7 +58,7 @@ void vFCU__Init(void)
  * @brief
  * Process any FCU tasks.
  * 
- * @st_funcMD5		ACB21F42875995E707CB8B16C0F6F1AD
+ * @st_funcMD5		6333EAF98A476CA6E6B3F77C8720E0DC
  * @st_funcID		LCCM655R0.FILE.000.FUNC.002
  */
 void vFCU__Process(void)
@@ -333,7 +333,7 @@ void vFCU__Process(void)
 				else if(u8Counter == C_FCU__SC16_FWD_LASER_INDEX)
 				{
 					//NOPTEL
-					vSIL3_SC16_BAUD__Set_BaudRate(u8Counter, 1U, 9600U, 1U);
+					vSIL3_SC16_BAUD__Set_BaudRate(u8Counter, 1U, C_FCU__LASERDIST__BAUD, 1U);
 				}
 				else
 				{
@@ -504,6 +504,11 @@ void vFCU__Process(void)
 				vFCU_FCTL__Init();
 			#endif
 
+			//build the main loop task table from what has been started
+			#if C_LOCALDEF__LCCM655__ENABLE_SCHEDULER == 1U
+				vFCU_SCHED__Init();
+			#endif
+
 
 			//move state
 			sFCU.eInitStates = INIT_STATE__RUN;
@@ -531,6 +536,11 @@ void vFCU__Process(void)
 				vRM4_CPULOAD__While_Entry();
 			#endif
 
+			#if C_LOCALDEF__LCCM655__ENABLE_SCHEDULER == 1U
+				//run whatever is ready, in priority order
+				vFCU_SCHED__Process();
+			#else
+
 			#ifndef WIN32
 			#if C_LOCALDEF__LCCM414__ENABLE_THIS_MODULE == 1U
 				//Handle the ADC conversions
@@ -538,11 +548,8 @@ void vFCU__Process(void)
 			#endif
 			#endif //WIN32
 
-			#if C_LOCALDEF__LCCM655__ENABLE_LASER_DISTANCE == 1U
-				vFCU_LASERDIST__Process();
-			#endif
-
 			//process the SC16IS interface always
+			//before the laser distance so it parses what we just drained
 			#if C_LOCALDEF__LCCM487__ENABLE_THIS_MODULE == 1U
 				for(u8Counter = 0U; u8Counter < C_LOCALDEF__LCCM487__NUM_DEVICES; u8Counter++)
 				{
@@ -550,6 +557,10 @@ void vFCU__Process(void)
 				}
 			#endif
 
+			#if C_LOCALDEF__LCCM655__ENABLE_LASER_DISTANCE == 1U
+				vFCU_LASERDIST__Process();
+			#endif
+
 			// process the throttles
 			#if C_LOCALDEF__LCCM655__ENABLE_THROTTLE == 1U
 
@@ -608,6 +619,7 @@ void vFCU__Process(void)
 
 			//update any system fault flags.
 			vFCU_FAULTS__Process();
+			#endif //C_LOCALDEF__LCCM655__ENABLE_SCHEDULER
 
 			#if C_LOCALDEF__LCCM663__ENABLE_THIS_MODULE == 1U
 				//end of while loop
@@ -738,12 +750,16 @@ void vFCU__Process(void)
  * @brief
  * 100ms timer
  * 
- * @st_funcMD5		03503B3F34FAC7AC38ADD5C6CB0C49F6
+ * @st_funcMD5		A5197B820557426A32EEC700ECE188F9
  * @st_funcID		LCCM655R0.FILE.000.FUNC.003
  */
 void vFCU__RTI_100MS_ISR(void)
 {
 
+	#if C_LOCALDEF__LCCM655__ENABLE_PROFILE == 1U
+		vFCU_SCHED_PROFILE__Start(C_FCU__PROFILE__PROBE_RTI_100MS);
+	#endif
+
 	sFCU.u32ResetTimer_100ms++;
 
 	//OptoNCDT Timer
@@ -777,6 +793,10 @@ void vFCU__RTI_100MS_ISR(void)
 	#endif
 	#endif
 
+	#if C_LOCALDEF__LCCM655__ENABLE_PROFILE == 1U
+		vFCU_SCHED_PROFILE__Stop(C_FCU__PROFILE__PROBE_RTI_100MS);
+	#endif
+
 }
 
 
@@ -784,12 +804,20 @@ void vFCU__RTI_100MS_ISR(void)
  * @brief
  * 10ms timer
  * 
- * @st_funcMD5		108C5BC0C716532C2EFC6CA606ACB925
+ * @st_funcMD5		4247FC64E03ECED2C0499D5B18653748
  * @st_funcID		LCCM655R0.FILE.000.FUNC.004
  */
 void vFCU__RTI_10MS_ISR(void)
 {
 
+	#if C_LOCALDEF__LCCM655__ENABLE_PROFILE == 1U
+		vFCU_SCHED_PROFILE__Start(C_FCU__PROFILE__PROBE_RTI_10MS);
+	#endif
+
+	#if C_LOCALDEF__LCCM655__ENABLE_SCHEDULER == 1U
+		vFCU_SCHED__10MS_ISR();
+	#endif
+
 	#if C_LOCALDEF__LCCM655__ENABLE_ETHERNET == 1U
 		vFCU_NET_TX__10MS_ISR();
 	#endif
@@ -819,11 +847,32 @@ void vFCU__RTI_10MS_ISR(void)
 	#if C_LOCALDEF__LCCM655__ENABLE_MAIN_SM == 1U
 		vFCU_FCTL_MAINSM__10MS_ISR();
 	#endif
+	#if C_LOCALDEF__LCCM655__ENABLE_FCTL_BLENDER == 1U
+		vFCU_FCTL_BLENDER__10MS_ISR();
+	#endif
+	#if C_LOCALDEF__LCCM655__ENABLE_BRAKEPID == 1U
+		vFCU_FLIGHTCTL_BRAKEPID__10MS_ISR();
+	#endif
 	#endif
 
+	#if C_LOCALDEF__LCCM655__ENABLE_PROFILE == 1U
+		vFCU_SCHED_PROFILE__Stop(C_FCU__PROFILE__PROBE_RTI_10MS);
+	#endif
 
 }
 
+#ifndef C_LOCALDEF__LCCM655__ENABLE_SCHEDULER
+	#error
+#endif
+#ifndef C_LOCALDEF__LCCM655__ENABLE_PROFILE
+	#error
+#endif
+#if C_LOCALDEF__LCCM655__ENABLE_PROFILE == 1U
+	#if C_LOCALDEF__LCCM655__ENABLE_SCHEDULER == 0U
+		#error
+	#endif
+#endif
+
 #endif //#if C_LOCALDEF__LCCM655__ENABLE_THIS_MODULE == 1U
 //safetys
 #ifndef C_LOCALDEF__LCCM655__ENABLE_THIS_MODULE
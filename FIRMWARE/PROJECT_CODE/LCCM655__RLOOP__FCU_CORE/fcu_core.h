@@ -516,6 +516,53 @@
 					/** Previous displacement */
 					Luint32 s32PrevDisplacement_mm;
 
+					#if C_LOCALDEF__LCCM655__ENABLE_ACCEL_FIFO == 1U
+					/** FIFO acquisition and the filter chain state */
+					struct
+					{
+						/** FIR history per axis, circular */
+						Lint16 s16FIR_History[MMA8451_AXIS__MAX][C_FCU__ACCEL_FIR_MAX_TAPS];
+						Luint8 u8FIR_Index;
+
+						/** IIR stage output per axis, counts in Q8 */
+						Lint32 s32IIR_Q8[MMA8451_AXIS__MAX];
+
+						/** RTI time of the last sample through the chain */
+						Luint64 u64LastSample_Time;
+						Luint8 u8Primed;
+
+						/** Accel at the last sample, for the trapezoid */
+						Lint32 s32PrevAccel_mm_ss;
+
+						/** Trapezoid sums over RTI ticks, (mm/s^2).tick and (um/s).tick, both doubled */
+						Lint64 s64VelocSum;
+						Lint64 s64DispSum;
+						Lint32 s32Veloc_um_s;
+
+						/** Whole um moved off the displacement sum, keeps it from overflowing */
+						Lint64 s64Disp_um;
+
+						/** Diagnostics */
+						Luint32 u32SampleCount;
+						Luint32 u32OverflowCount;
+
+					}sFifo;
+					#endif
+
+					#ifdef WIN32
+						/** Raw sample handed to the driver on its next read */
+						Lint16 s16WIN32_Raw[MMA8451_AXIS__MAX];
+
+						#if C_LOCALDEF__LCCM655__ENABLE_ACCEL_FIFO == 1U
+							/** Emulated device FIFO, laid out as it comes off the bus */
+							Luint8 u8WIN32_Fifo[C_FCU__ACCEL_FIFO_DEPTH][C_FCU__ACCEL_FIFO_SAMPLE_BYTES];
+							Luint8 u8WIN32_FifoCount;
+							Luint8 u8WIN32_FifoOverflow;
+							/** RTI time of the newest sample pushed */
+							Luint64 u64WIN32_FifoTime;
+						#endif
+					#endif
+
 				}sChannels[C_FCU__NUM_ACCEL_CHIPS];
 
 				/** Packet injection*/
@@ -532,6 +579,20 @@
 */
 				#endif
 
+				#if C_LOCALDEF__LCCM655__ENABLE_ACCEL_FIFO == 1U
+				/** Filter chain setup, shared by all channels */
+				struct
+				{
+					/** FIR stage taps in Q15 */
+					Lint16 s16FIR_Coeff_Q15[C_FCU__ACCEL_FIR_MAX_TAPS];
+					Luint8 u8FIR_Taps;
+
+					/** IIR stage, y += alpha(x - y), Q15 */
+					Lint16 s16IIR_Alpha_Q15;
+
+				}sFilter;
+				#endif
+
 				Luint8 u810MS_Flag;
 
 				/** Handle accel faults that we saw.*/
@@ -743,10 +804,6 @@
 				/** Number of 100ms increments the new packets have been seen */
 				Luint32 u32PacketsSeen_Counter;
 
-
-				/** A new packet is available for distance processing */
-				Luint8 u8NewPacket;
-
 				/** Array to hold new bytes received */
 				Luint8 u8NewByteArray[5];
 
@@ -762,6 +819,18 @@
 				Lint32 s32Accel_mm_ss;
 				Lint32 s32PrevAccel_mm_ss;
 
+				/** RTI counter 1 time the last packet finished arriving */
+				Luint64 u64Packet_Time;
+
+				/** RTI counter 1 at the last SC16 RX interrupt, written from the ISR */
+				Luint64 u64RxISR_Time;
+
+				/** An RX interrupt time is waiting to be used by the drain */
+				Luint8 u8RxISR_Pending;
+
+				/** Good packets since init, saturates at 2 once we have a velocity */
+				Luint8 u8PacketHistory;
+
 				/** The final filtered distance*/
 				//Lfloat32 f32DistanceFiltered;
 
@@ -807,6 +876,9 @@
 					/** Error code value counter */
 					Luint32 u32Counter__ErrorCode;
 
+					/** A start byte arrived part way through a packet */
+					Luint32 u32Counter__Framing;
+
 				}sBinary;
 
 			}sLaserDist;
@@ -856,6 +928,27 @@
 						Lfloat32 f32Measurement; // height of hover engine above ground
 					}sHoverEngines[C_FCU__NUM_HOVER_ENGINES];
 
+					/** Least squares ground plane z = ax + by + c, pseudo-inverse of the
+					 * laser geometry per laser mask, built once at init */
+					struct
+					{
+						/** (AtA)^-1.At, columns of masked out lasers are zero */
+						Lfloat32 f32PseudoInv[C_FCU__LASER_ORIENT__NUM_MASKS][3U * C_FCU__NUM_LASERS_GROUND];
+
+						/** 1 = at least 3 non collinear lasers in this mask */
+						Luint8 u8Valid[C_FCU__LASER_ORIENT__NUM_MASKS];
+
+						/** Lasers used in the last fit */
+						Luint8 u8Mask;
+
+						/** Residual of each laser from the last fit */
+						Lfloat32 f32Residual[C_FCU__NUM_LASERS_GROUND];
+
+						/** Number of times a laser has been rejected as an outlier */
+						Luint32 u32OutlierCount;
+
+					}sLSQ;
+
 					E_LASER_ORIENTATION__STATE_T eState;
 
 				}sOrient;
@@ -910,10 +1003,108 @@
 						/** The actual measured distance to the target infront of the pod */
 						Lint32 s32Distance_mm;
 
+						/** Computed displacement from the start of the run */
+						Lint32 s32Displacement_mm;
+
 					}sWorking;
 
+					#if C_LOCALDEF__LCCM655__ENABLE_FCTL_BLENDER == 1U
+					/** Kalman filter, the state is displacement and velocity, accel is the input */
+					struct
+					{
+						/** State */
+						Lfloat32 f32Displacement_mm;
+						Lfloat32 f32Veloc_mm_s;
+
+						/** The accel used for the last predict */
+						Lfloat32 f32Accel_mm_ss;
+
+						/** Covariance, symmetric so we only keep 3 terms */
+						Lfloat32 f32P00;
+						Lfloat32 f32P01;
+						Lfloat32 f32P11;
+
+						/** Total measurements thrown out by the gate */
+						Luint32 u32RejectCount;
+
+					}sFilter;
+
+					/** Measurements waiting for the next process, one per quantity and source */
+					struct
+					{
+						/** Sum of the values from each channel */
+						Lfloat32 f32Sum;
+
+						/** Number of values in the sum */
+						Luint8 u8Count;
+
+						/** Rejects in a row from this slot */
+						Luint8 u8RejectRun;
+
+					}sMeas[BLENDER_MEAS__NUM];
+
+					/** Track position of the LRF target, 0 = not known */
+					Lint32 s32LRF_Target_mm;
+
+					/** The last raw LRF distance */
+					Lint32 s32LRF_Distance_mm;
+
+					/** Per contrast laser, track position minus the stripe distance
+					 * elapsed, taken from the filter at the first stripe */
+					Lint32 s32Contrast_Offset_mm[LASER_CONT__MAX];
+
+					/** 1 = the contrast laser offset has been taken */
+					Luint8 u8Contrast_Anchored[LASER_CONT__MAX];
+
+					/** Free running 10ms ticks from the ISR */
+					Luint32 u32ISR_Ticks;
+
+					/** ISR ticks at the last predict */
+					Luint32 u32PredictTicks;
+					#endif
+
 				}sBlender;
 
+				#if C_LOCALDEF__LCCM655__ENABLE_BRAKEPID == 1U
+				/** Brake PID, tracks the setpoint velocity profile during braking */
+				struct
+				{
+					/** 1 = we are driving the brakes */
+					Luint8 u8Enabled;
+
+					/** Don't compute a derivative on the first step */
+					Luint8 u8FirstStep;
+
+					/** Integral term in N */
+					Lfloat32 f32Integral_n;
+
+					/** Filtered derivative term in N */
+					Lfloat32 f32Derivative_n;
+
+					/** Error at the last step in m/s */
+					Lfloat32 f32LastError_ms;
+
+					/** Setpoint at the last step in m/s */
+					Lfloat32 f32Setpoint_ms;
+
+					/** Drag demand at the last step */
+					Lfloat32 f32Drag_n;
+
+					/** Gap at the last step */
+					Lfloat32 f32Gap_mm;
+
+					/** Last gap sent to the brakes */
+					Lfloat32 f32LastCommand_mm;
+
+					/** Free running 10ms ticks from the ISR */
+					Luint32 u32ISR_Ticks;
+
+					/** ISR ticks at the last slot */
+					Luint32 u32SlotTicks;
+
+				}sBrakePID;
+				#endif
+
 
 			}sFlightControl;
 
@@ -980,7 +1171,9 @@
 
 				Luint32 u32Guard2;
 
-				/** a timing based list to store the rising and falling edges of each laser */
+				/** a timing based list to store the rising and falling edges of each laser
+				 * The lists are rings of the last C_FCU__LASER_CONTRAST__MAX_STRIPES edges,
+				 * the slot for an edge is its count modulo the list size. */
 				struct
 				{
 
@@ -990,21 +1183,44 @@
 					/** Falling edge time stamp */
 					Luint64 u64FallingList[C_FCU__LASER_CONTRAST__MAX_STRIPES];
 
-					/** list of time that has elapsed between sensor marks */
+					/** list of time that has elapsed between sensor marks, computed in the ISR */
 					Luint64 u64ElapsedList_Rising[C_FCU__LASER_CONTRAST__MAX_STRIPES];
 
-					/** Rising edge count */
+					/** Sum of the last C_FCU__LASER_CONTRAST__VELOC_WINDOW elapsed times at each edge */
+					Luint64 u64WindowList_Rising[C_FCU__LASER_CONTRAST__MAX_STRIPES];
+
+					/** Number of elapsed times in the window sum at each edge */
+					Luint8 u8WindowCountList_Rising[C_FCU__LASER_CONTRAST__MAX_STRIPES];
+
+					/** Rising edge count, free running */
 					Luint16 u16RisingCount;
 
 					/** Can maintan a list of prev processed counts */
 					Luint16 u16PrevRisingCount;
 
-					/** Falling edge count */
+					/** Falling edge count, free running */
 					Luint16 u16FallingCount;
 
+					/** Next slot to write, ISR only */
+					Luint16 u16RisingHead;
+					Luint16 u16FallingHead;
+
+					/** Running window sum and count, ISR only */
+					Luint64 u64WindowSum;
+					Luint8 u8WindowCount;
+
 					/** signalled by the rising edge that a new item is avail */
 					Luint8 u8NewRisingAvail;
 
+					/** Rising count the velocity was last published for */
+					Luint16 u16VelocCount;
+
+					/** Velocity over the last stripe */
+					Luint32 u32StripeVeloc_mms;
+
+					/** Velocity over the window */
+					Luint32 u32WindowVeloc_mms;
+
 				}sTimingList[LASER_CONT__MAX];
 
 				Luint32 u32Guard3;
@@ -1048,17 +1264,52 @@
 			struct
 			{
 
-				/** A flag to indicate 10ms has elapsed if we are using timed packets */
-				Luint8 u810MS_Flag;
+				/** The next packet type to transmit, one off request from the host */
+				E_NET__PACKET_T eTxPacketType;
 
-				/** 250ms timer for our fault data */
-				Luint8 u8250MS_Flag;
+				/** Free running 10ms counter from the ISR */
+				Luint32 u32ISR_Ticks;
 
-				/** The next packet type to transmit */
-				E_NET__PACKET_T eTxPacketType;
+				/** ISR tick the rate table has been updated to */
+				Luint32 u32SlotTicks;
+
+				/** Last stream sent, for the round robin */
+				Luint8 u8RoundRobin;
+
+				/** The rate table, each streaming packet type has its own period */
+				struct
+				{
+					/** Packet type, NET_PKT__NONE = free entry */
+					E_NET__PACKET_T eType;
+
+					/** Period in 10ms ticks */
+					Luint16 u16Period_x10ms;
+
+					/** 0 is the highest */
+					Luint8 u8Priority;
+
+					/** Due and waiting for the link */
+					Luint8 u8Pending;
+
+					/** ISR tick the pending packet became due */
+					Luint32 u32Due_Ticks;
+
+					/** ISR tick of the next period */
+					Luint32 u32NextDue_Ticks;
+
+					/** Packets sent */
+					Luint32 u32TxCount;
+
+					/** Periods missed because the last one had not gone yet */
+					Luint32 u32DropCount;
 
-				/** If the user has enabled Tx streaming */
-				E_NET__PACKET_T eTxStreamingType;
+					/** Packets sent at least one tick after they were due */
+					Luint32 u32LateCount;
+
+					/** Worst lateness seen */
+					Luint32 u32MaxLate_x10ms;
+
+				}sStreams[C_FCU__NET_TX__MAX_STREAMS];
 
 				/** Timer for the Drive Pod comms watchdog */
 				Luint32 u32_10MS_GS_COMM_Timer;
@@ -1127,11 +1378,8 @@
 					Luint8 u8MuxChannel;
 				#endif
 
-				/** List of commands to send in round robbin*/
-				E_FCU_ASI_BAC_OBJECT_TYPES__T eCommandList[C_FCU__ASI_COMMAND_LIST_MAX];
-
-				/** Keep track of the command */
-				Luint8 u8CommandListIndex;
+				/** 10ms ticks since each engine last gave a good telemetry block */
+				Luint32 u32RefreshAge_x10ms[C_FCU__NUM_HOVER_ENGINES];
 
 				/** Do we need to issue a throttle command? */
 				Luint8 u8ThrottleCommand[C_FCU__NUM_HOVER_ENGINES];
@@ -1185,8 +1433,8 @@
 				/** A 100ms timer for each ramp increment */
 				Luint8 u8100ms_Timer[C_FCU__NUM_HOVER_ENGINES];
 
-				/** During run keep an index of the last servied HE */
-				Luint8 u8RunIndex;
+				/** Number of HE's still stepping or ramping after the last run pass */
+				Luint8 u8NumMoving;
 
 				/** For development mode */
 				struct
@@ -1241,6 +1489,115 @@
 
 			}sBMS[2];
 
+			#if C_LOCALDEF__LCCM655__ENABLE_SCHEDULER == 1U
+			/** Main loop scheduler */
+			struct
+			{
+				/** 10ms ticks the periodic tasks run from */
+				Luint32 u32ISR_Ticks;
+
+				/** Task indexes sorted by priority */
+				Luint8 u8Order[FCU_SCHED__MAX];
+
+				/** The tasks */
+				struct
+				{
+					/** Process function, 0 if the subsystem is not built */
+					void (*pFunc)(void);
+
+					/** 0 is the highest */
+					Luint8 u8Priority;
+
+					/** Part of the brake and nav chain */
+					Luint8 u8Critical;
+
+					/** Run period in 10ms ticks, 0 = every pass */
+					Luint16 u16Period_x10ms;
+
+					/** Set from an ISR when there is work */
+					Luint8 u8Ready;
+
+					/** Tick the next periodic run is due */
+					Luint32 u32NextDue_Ticks;
+
+					/** Budget for one run in timer ticks */
+					Luint32 u32Budget_Ticks;
+
+					/** Stats, in timer ticks */
+					Luint32 u32Runs;
+					Luint32 u32Last_Ticks;
+					Luint32 u32Max_Ticks;
+					Luint64 u64Total_Ticks;
+
+					/** Runs over the budget */
+					Luint32 u32Overruns;
+
+				}sTasks[FCU_SCHED__MAX];
+
+				/** Whole pass and the brake and nav chain, in timer ticks */
+				Luint32 u32Pass_Last_Ticks;
+				Luint32 u32Pass_Max_Ticks;
+				Luint32 u32Critical_Last_Ticks;
+				Luint32 u32Critical_Max_Ticks;
+
+				/** Passes where the brake and nav chain missed its deadline */
+				Luint32 u32Critical_Misses;
+
+				#if C_LOCALDEF__LCCM655__ENABLE_PROFILE == 1U
+				/** Named probes, the tasks then the RTI ISRs */
+				struct
+				{
+					/** Probe name for the host, not null terminated when full */
+					Luint8 u8Name[C_FCU__PROFILE__NAME_LENGTH];
+
+					/** Timer at the last start */
+					Luint32 u32Start_Ticks;
+
+					/** Set between start and stop */
+					Luint8 u8Running;
+
+					/** Stats, in timer ticks */
+					Luint32 u32Count;
+					Luint32 u32Min_Ticks;
+					Luint32 u32Max_Ticks;
+					Luint64 u64Total_Ticks;
+
+					/** log2 histogram, saturates */
+					Luint16 u16Hist[C_FCU__PROFILE__HIST_BINS];
+
+				}sProfile[C_FCU__PROFILE__NUM_PROBES];
+				#endif
+
+			}sSched;
+			#endif
+
+			#ifdef WIN32
+			/** Host simulated clock runner */
+			struct
+			{
+				/** Simulated time in 10ms ticks */
+				Luint32 u32Ticks_10ms;
+
+				/** Simulated time the software track model was started at */
+				Luint64 u64TrackSimStart_ns;
+
+				/** Cost of each entry point */
+				struct
+				{
+					/** Number of calls timed */
+					Luint32 u32Calls;
+
+					/** Longest call */
+					Luint32 u32Worst_ns;
+
+					/** Sum of all calls for the mean */
+					Luint64 u64Total_ns;
+
+				}sEntry[FCU_SIL_ENTRY__MAX];
+
+			}sSIL;
+			#endif
+
 			/** Structure guard 2*/
 			Luint32 u32Guard2;
 
@@ -1257,6 +1614,26 @@
 		DLL_DECLARATION void vFCU__RTI_100MS_ISR(void);
 		DLL_DECLARATION void vFCU__RTI_10MS_ISR(void);
 
+		#ifdef WIN32
+			//host simulated clock runner
+			DLL_DECLARATION void vFCU_WIN32__Reset_Timing(void);
+			DLL_DECLARATION void vFCU_WIN32__Run(Luint32 u32Ticks_10ms, Luint32 u32LoopsPerTick);
+			DLL_DECLARATION Luint32 u32FCU_WIN32__Get_SimTime_ms(void);
+			DLL_DECLARATION Luint32 u32FCU_WIN32__Get_Worst_ns(Luint8 u8Entry);
+			DLL_DECLARATION Luint32 u32FCU_WIN32__Get_Mean_ns(Luint8 u8Entry);
+
+			#if C_LOCALDEF__LCCM666__ENABLE_THIS_MODULE == 1U
+				//software track model driving the sensors
+				DLL_DECLARATION void vFCU_WIN32__TrackSim_Init(void);
+				DLL_DECLARATION void vFCU_WIN32__TrackSim_Start(void);
+				DLL_DECLARATION void vFCU_WIN32__TrackSim_Set_Profile(Lfloat32 f32Accel_G, Lfloat32 f32CoastVeloc_ms, Lfloat32 f32Decel_G);
+				DLL_DECLARATION void vFCU_WIN32__TrackSim_Set_Noise(Lfloat32 f32Range_mm, Lfloat32 f32Accel_G, Lfloat32 f32EdgeJitter_ns, Luint32 u32Seed);
+				void vFCU_WIN32__TrackSim_Edge(Luint8 u8Laser, Luint8 u8Rising, Luint64 u64Time_ns);
+				void vFCU_WIN32__TrackSim_Range(Lint32 s32Range_mm, Luint64 u64Time_ns);
+				void vFCU_WIN32__TrackSim_Accel(Lfloat32 f32Accel_G, Luint64 u64Time_ns);
+			#endif
+		#endif
+
 #if C_LOCALDEF__LCCM655__ENABLE_FLIGHT_CONTROL == 1U
 		//flight controller
 		void vFCU_FCTL__Init(void);
@@ -1347,6 +1724,27 @@
 			Lint32 s32FCU_FCTL_NAV__Get_Displacement_mm(void);
 			Lint32 s32FCU_FCTL_NAV__Get_Track_Position_mm(void);
 
+			//sensor blender
+			DLL_DECLARATION void vFCU_FCTL_BLENDER__Init(void);
+			DLL_DECLARATION void vFCU_FCTL_BLENDER__Reset(void);
+			DLL_DECLARATION void vFCU_FCTL_BLENDER__Process(void);
+			DLL_DECLARATION void vFCU_FCTL_BLENDER__10MS_ISR(void);
+			DLL_DECLARATION void vFCU_FCTL_BLENDER__Set_LRF_Target(Lint32 s32Target_mm);
+			DLL_DECLARATION Lint32 s32FCU_FCTL_BLENDER__Get_LRF_Target_mm(void);
+			DLL_DECLARATION Lint32 s32FCU_FCTL_BLENDER__Get_Accel_mmss(void);
+			DLL_DECLARATION Lint32 s32FCU_FCTL_BLENDER__Get_Veloc_mms(void);
+			DLL_DECLARATION Lint32 s32FCU_FCTL_BLENDER__Get_Displacement_mm(void);
+			DLL_DECLARATION Lint32 s32FCU_FCTL_BLENDER__Get_Distance_mm(void);
+			DLL_DECLARATION void vFCU_FCTL_BLENDER__Veloc_UpdateFrom_Accel(Lint32 s32Veloc_mms);
+			DLL_DECLARATION void vFCU_FCTL_BLENDER__Veloc_UpdateFrom_LRF(Lint32 s32Veloc_mms);
+			DLL_DECLARATION void vFCU_FCTL_BLENDER__Veloc_UpdateFrom_Contrast(Lint32 s32Veloc_mms);
+			DLL_DECLARATION void vFCU_FCTL_BLENDER__Accel_UpdateFrom_Accel(Lint32 s32Accel_mmss);
+			DLL_DECLARATION void vFCU_FCTL_BLENDER__Accel_UpdateFrom_LRF(Lint32 s32Accel_mmss);
+			DLL_DECLARATION void vFCU_FCTL_BLENDER__Accel_UpdateFrom_Contrast(Lint32 s32Accel_mmss);
+			DLL_DECLARATION void vFCU_FCTL_BLENDER__Displacement_UpdateFrom_Accel(Lint32 s32Disp_mm);
+			DLL_DECLARATION void vFCU_FCTL_BLENDER__Displacement_UpdateFrom_LRF(Lint32 s32Disp_mm);
+			DLL_DECLARATION void vFCU_FCTL_BLENDER__Displacement_UpdateFrom_Contrast(Luint8 u8Channel, Lint32 s32Disp_mm);
+
 
 
 			//drive pod
@@ -1428,6 +1826,7 @@
 			// Laser Orientation
 			void vFCU_FLIGHTCTL_LASERORIENT__Init(void);
 			void vFCU_FLIGHTCTL_LASERORIENT__Process(void);
+			void vFCU_FLIGHTCTL_LASERORIENT__Set_GroundLaser_Position(Luint8 u8Laser, Lfloat32 f32X, Lfloat32 f32Y, Lfloat32 f32Z);
 			Lint16 s16FCU_FLIGHTCTL_LASERORIENT__Get_Roll(void);
 			Lint16 s16FCU_FLIGHTCTL_LASERORIENT__Get_Pitch(void);
 			Lint16 s16FCU_FLIGHTCTL_LASERORIENT__Get_Yaw(void);
@@ -1443,7 +1842,10 @@
 			Luint32 u32FCU_FLIGHTCTL_CONTRASTNAV__Get_FaultFlags(void);
 
 			//brake profiler
-			Lint16 s16FCU_FLIGHTCTL_BRAKES__Brake_Lookup(Luint32 u32Veloc_mms, Luint32 u32DragForce_n, Luint32 *pu32IBDistance_um);
+			void vFCU_FLIGHTCTL_BRAKES__Init(void);
+			void vFCU_FLIGHTCTL_BRAKES__Process(void);
+			DLL_DECLARATION Lint16 s16FCU_FLIGHTCTL_BRAKES__Brake_Lookup(Luint32 u32Veloc_mms, Luint32 u32DragForce_n, Luint32 *pu32IBDistance_um);
+			DLL_DECLARATION Lint16 s16FCU_FLIGHTCTL_BRAKES__Drag_Lookup(Luint32 u32Veloc_mms, Luint32 u32IBDistance_um, Luint32 *pu32DragForce_n);
 
 #endif //C_LOCALDEF__LCCM655__ENABLE_FLIGHT_CONTROL
 
@@ -1460,7 +1862,10 @@
 			//transmit
 			void vFCU_NET_TX__Init(void);
 			void vFCU_NET_TX__Process(void);
-			void vFCU_NET_TX__10MS_ISR(void);
+			DLL_DECLARATION Lint16 s16FCU_NET_TX__Set_Stream(E_NET__PACKET_T eType, Luint16 u16Period_x10ms);
+			DLL_DECLARATION void vFCU_NET_TX__Stop_Stream(E_NET__PACKET_T eType);
+			DLL_DECLARATION E_NET__PACKET_T eFCU_NET_TX__Schedule(void);
+			DLL_DECLARATION void vFCU_NET_TX__10MS_ISR(void);
 			void vFCU_NET_TX__100MS_ISR(void);
 
 			//spaceX specific
@@ -1478,6 +1883,29 @@
 			void vFCU_FAULTS_ETH__Init(void);
 			void vFCU_FAULTS_ETH__Transmit(E_NET__PACKET_T ePacketType);
 
+		//main loop scheduler
+		void vFCU_SCHED__Init(void);
+		void vFCU_SCHED__Process(void);
+		void vFCU_SCHED__Set_Ready(E_FCU_SCHED__TASK_T eTask);
+		DLL_DECLARATION void vFCU_SCHED__Reset_Stats(void);
+		DLL_DECLARATION Luint32 u32FCU_SCHED__Get_Max_us(E_FCU_SCHED__TASK_T eTask);
+		DLL_DECLARATION Luint32 u32FCU_SCHED__Get_Avg_us(E_FCU_SCHED__TASK_T eTask);
+		DLL_DECLARATION void vFCU_SCHED__10MS_ISR(void);
+		Luint32 u32FCU_SCHED__Get_Timer(void);
+		#ifdef WIN32
+			DLL_DECLARATION void vFCU_SCHED_WIN32__Set_Task(E_FCU_SCHED__TASK_T eTask, void (*pFunc)(void), Luint8 u8Priority, Luint16 u16Period_x10ms, Luint8 u8Critical);
+		#endif
+
+			//profiling
+			void vFCU_SCHED_PROFILE__Init(void);
+			void vFCU_SCHED_PROFILE__Start(Luint8 u8Probe);
+			void vFCU_SCHED_PROFILE__Stop(Luint8 u8Probe);
+			DLL_DECLARATION void vFCU_SCHED_PROFILE__Reset(void);
+			DLL_DECLARATION Luint32 u32FCU_SCHED_PROFILE__Get_Mean(Luint8 u8Probe);
+
+			//ethernet
+			void vFCU_SCHED_ETH__Transmit(E_NET__PACKET_T ePacketType);
+
 		//laser contrast sensors
 		void vFCU_LASERCONT__Init(void);
 		void vFCU_LASERCONT__Process(void);
@@ -1491,6 +1919,8 @@
 			Luint8 u8FCU_LASERCONT_TL__Get_NewRisingAvail(E_FCU__LASER_CONT_INDEX_T eLaser);
 			void vFCU_LASERCONT_TL__Clear_NewRisingAvail(E_FCU__LASER_CONT_INDEX_T eLaser);
 			Luint64 u64FCU_LASERCONT_TL__Get_TimeDelta(E_FCU__LASER_CONT_INDEX_T eLaser, Luint16 u16CurrentIndex);
+			Luint32 u32FCU_LASERCONT_TL__Get_StripeVeloc_mms(E_FCU__LASER_CONT_INDEX_T eLaser);
+			Luint32 u32FCU_LASERCONT_TL__Get_WindowVeloc_mms(E_FCU__LASER_CONT_INDEX_T eLaser);
 
 			//velocity
 			void vFCU_LASERCONT_VELOC__Init(void);
@@ -1514,8 +1944,13 @@
 		void vFCU_LASERDIST__Process(void);
 		Lint32 s32FCU_LASERDIST__Get_Distance_mm(void);
 		Lint32 s32FCU_LASERDIST__Get_Velocity_mms(void);
+		Luint8 u8FCU_LASERDIST__Get_NewDistanceAvail(void);
+		void vFCU_LASERDIST__Clear_NewDistanceAvail(void);
 		void vFCU_LASERDIST__100MS_ISR(void);
+		void vFCU_LASERDIST__RX_ISR(void);
+		void vFCU_LASERDIST__Rx_Bytes(const Luint8 *pu8Rx, Luint8 u8Count);
 		DLL_DECLARATION void vFCU_LASERDIST_WIN32__Set_DistanceRaw(Lint32 s32Value);
+		void vFCU_LASERDIST_WIN32__Inject_Distance(Lint32 s32Value, Luint64 u64Time);
 
 			//valid checks
 			void vFCU_LASERDIST_VALID__Init(void);
@@ -1665,8 +2100,19 @@
 			void vFCU_ACCEL_VALID__Clear_NewSample_Avail(void);
 
 
+			//fifo and filter chain
+			void vFCU_ACCEL_FIFO__Init(void);
+			void vFCU_ACCEL_FIFO__Process(void);
+			DLL_DECLARATION void vFCU_ACCEL_FIFO__Add_Sample(Luint8 u8Device, const Lint16 *ps16XYZ, Luint64 u64Time);
+			DLL_DECLARATION Lint16 s16FCU_ACCEL_FIFO__Set_FIR(const Lint16 *ps16Coeff_Q15, Luint8 u8Taps);
+			DLL_DECLARATION Lint16 s16FCU_ACCEL_FIFO__Set_IIR(Lint16 s16Alpha_Q15);
+
 			//win32
-			void vFCU_ACCEL_WIN32__Set_Raw(Luint8 u8DeviceIndex, Luint8 u8ChannelIndex, Lint32 s32Value);
+			#ifdef WIN32
+				void vFCU_ACCEL_WIN32__Init(void);
+				DLL_DECLARATION void vFCU_ACCEL_WIN32__Set_Raw(Luint8 u8DeviceIndex, Luint8 u8ChannelIndex, Lint32 s32Value);
+				Luint8 u8FCU_ACCEL_WIN32__Read_FIFO(Luint8 u8DeviceIndex, Luint8 *pu8Buffer);
+			#endif
 
 		//Pusher interface
 		void vFCU_PUSHER__Init(void);
@@ -1735,6 +2181,7 @@
 		Luint16 u16FCU_ASI__ReadMotorRpm(Luint8 u8EngineIndex);
 		Lfloat32 f32FCU_ASI__ReadMotorCurrent(Luint8 u8EngineIndex);
 		Lfloat32 f32FCU_ASI__ReadControllerTemperature(Luint8 u8EngineIndex);
+		Luint32 u32FCU_ASI__Get_RefreshAge_x10ms(Luint8 u8EngineIndex);
 
 		//drive pod
 		void vFCU_FCTL_DRIVEPOD__10MS_ISR(void);
@@ -1793,7 +2240,18 @@
 		Luint32 u32FCU_FCTL_LASERORIENT__Get_Z_Pos();
 
 		//brake pid
-		void vFCU_FLIGHTCTL_BRAKEPID__Init(void);
+		#if C_LOCALDEF__LCCM655__ENABLE_BRAKEPID == 1U
+			DLL_DECLARATION void vFCU_FLIGHTCTL_BRAKEPID__Init(void);
+			void vFCU_FLIGHTCTL_BRAKEPID__Reset(void);
+			DLL_DECLARATION void vFCU_FLIGHTCTL_BRAKEPID__Enable(void);
+			DLL_DECLARATION void vFCU_FLIGHTCTL_BRAKEPID__Disable(void);
+			void vFCU_FLIGHTCTL_BRAKEPID__Process(void);
+			void vFCU_FLIGHTCTL_BRAKEPID__10MS_ISR(void);
+			DLL_DECLARATION Lfloat32 f32FCU_FLIGHTCTL_BRAKEPID__Step(Lint32 s32Position_mm, Lint32 s32Veloc_mm_s, Lfloat32 f32Dt_s);
+			DLL_DECLARATION Lint32 s32FCU_FLIGHTCTL_BRAKEPID__Get_Setpoint_mms(void);
+			DLL_DECLARATION Lint32 s32FCU_FLIGHTCTL_BRAKEPID__Get_Drag_n(void);
+			DLL_DECLARATION Lint32 s32FCU_FLIGHTCTL_BRAKEPID__Get_Gap_um(void);
+		#endif
 
 		//cooling
 		void vFCU_FCTL_COOLING__Enable(void);
@@ -1810,6 +2268,14 @@
 			DLL_DECLARATION void vLCCM655R0_TS_004(void);
 			DLL_DECLARATION void vLCCM655R0_TS_005(void);
 			DLL_DECLARATION void vLCCM655R0_TS_006(void);
+			DLL_DECLARATION void vLCCM655R0_TS_008(void);
+			DLL_DECLARATION void vLCCM655R0_TS_009(void);
+			DLL_DECLARATION void vLCCM655R0_TS_010(void);
+			DLL_DECLARATION void vLCCM655R0_TS_011(void);
+			DLL_DECLARATION void vLCCM655R0_TS_012(void);
+			DLL_DECLARATION void vLCCM655R0_TS_013(void);
+			DLL_DECLARATION void vLCCM655R0_TS_014(void);
+			DLL_DECLARATION void vLCCM655R0_TS_015(void);
 
 
 			#endif
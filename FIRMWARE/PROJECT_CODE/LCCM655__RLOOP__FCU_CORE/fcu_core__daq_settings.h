@@ -175,13 +175,41 @@ SIL3 - MULTIPURPOSE DAQ MODULE
 		#define C_LOCALDEF__LCCM662__ENABLE_USER_PAYLOAD_TYPES				(0U)
 
 		/** Enable a snapshot of the core timer along with each channel of data
-		* this chews NUM_CHANNELS * 4 worth of bytes and will have a slight performance
-		* penalty */
+		* this chews 4 bytes per ring slot on every channel and will have a slight performance
+		* penalty. The timer is only transmitted with C_LOCALDEF__LCCM662__ENABLE_COMPRESSION
+		* or as the block stamp in C_LOCALDEF__LCCM662__ENABLE_PACKED_FRAMES */
 		#define C_LOCALDEF__LCCM662__ENABLE_TIMER_IN_DATA					(0U)
 
 		/** Transmission notification handler */
 		#define M_LOCALDEF__LCCM662__TX_HANDLER(index, pbuffer, length)		s16SIL3_DAQ_TRANSMIT__Template(index, pbuffer, length)
 
+		/** Zero copy transmit, the ring is handed to the EMAC as an extra buffer
+		 * descriptor and held until the Tx is done. A wrapped ring is gathered into
+		 * one EMAC buffer using two DMA channels (needs LCCM229) */
+		#define C_LOCALDEF__LCCM662__ENABLE_ZERO_COPY_TX					(0U)
+		#define C_LOCALDEF__LCCM662__ZERO_COPY_DMA_CHANNEL_A				(DMA_CH13)
+		#define C_LOCALDEF__LCCM662__ZERO_COPY_DMA_CHANNEL_B				(DMA_CH14)
+
+		/** Zero copy handlers, wrapped transmit and transmit complete check */
+		#define M_LOCALDEF__LCCM662__TX_HANDLER_WRAPPED(index, pbuf1, len1, pbuf2, len2)	s16SIL3_DAQ_TRANSMIT__Template_Wrapped(index, pbuf1, len1, pbuf2, len2)
+		#define M_LOCALDEF__LCCM662__TX_IS_COMPLETE()						u8SIL3_DAQ_TRANSMIT_ZC__Is_Complete()
+
+		/** Pack many channels into one frame (max bytes) instead of one packet per
+		 * channel. A schema packet is sent when streaming starts so the ground station
+		 * can decode the frames. Cannot be used with zero copy, needs
+		 * C_LOCALDEF__LCCM662__ENABLE_TIMER_IN_DATA to stamp each block. */
+		#define C_LOCALDEF__LCCM662__ENABLE_PACKED_FRAMES					(0U)
+		#define C_LOCALDEF__LCCM662__PACKED_FRAME_MAX_BYTES					(1200U)
+
+		/** Packed frame / schema transmit handler, type is E_DAQ__PACKED_TYPES */
+		#define M_LOCALDEF__LCCM662__TX_PACKED_HANDLER(type, pbuffer, length)	s16SIL3_DAQ_TRANSMIT__Template_Packed(type, pbuffer, length)
+
+		/** Delta / zig-zag varint encode each channel (and its timer if enabled)
+		 * before it goes to TX_HANDLER, up to max bytes per packet. The host decodes
+		 * with s16SIL3_DAQ_WIN32__Decode(). Cannot be used with zero copy or packed frames. */
+		#define C_LOCALDEF__LCCM662__ENABLE_COMPRESSION					(0U)
+		#define C_LOCALDEF__LCCM662__COMPRESS_MAX_BYTES						(1200U)
+
 		/** Testing Options */
 		#define C_LOCALDEF__LCCM662__ENABLE_TEST_SPEC						(0U)
 
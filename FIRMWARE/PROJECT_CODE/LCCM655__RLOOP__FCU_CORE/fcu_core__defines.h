@@ -19,6 +19,30 @@
 	/** Accel filtering window */
 	#define C_FCU__ACCEL_FILTER_WINDOW						(16U)
 
+	/** Samples held in each MMA8451 FIFO */
+	#define C_FCU__ACCEL_FIFO_DEPTH							(32U)
+
+	/** Bytes per XYZ sample in a FIFO burst */
+	#define C_FCU__ACCEL_FIFO_SAMPLE_BYTES					(6U)
+
+	/** MMA8451 F_SETUP circular mode, and the F_STATUS fields */
+	#define C_FCU__ACCEL_FIFO_SETUP__CIRCULAR				(0x40U)
+	#define C_FCU__ACCEL_FIFO_STATUS__OVERFLOW				(0x80U)
+	#define C_FCU__ACCEL_FIFO_STATUS__COUNT_MASK			(0x3FU)
+
+	/** Max taps in the accel FIR stage, and the default boxcar length */
+	#define C_FCU__ACCEL_FIR_MAX_TAPS						(16U)
+	#define C_FCU__ACCEL_FIR_DEFAULT_TAPS					(8U)
+
+	/** Default IIR stage coefficient in Q15, 0.5 */
+	#define C_FCU__ACCEL_IIR_DEFAULT_ALPHA_Q15				(16384)
+
+	/** RTI counter 1 rate, RTCLK1 is the RTI clock (MHz) over the counter 1 prescaler */
+	#define C_FCU__RTI_COUNTER1_HZ							((C_LOCALDEF__LCCM124__RTI_CLK_FREQ * 1000000U) / C_LOCALDEF__LCCM124__RTI_COUNTER1_PRESCALER)
+
+	/** RTI counter 1 tick in ns, only used where the rate divides 1GHz */
+	#define C_FCU__RTI_COUNTER1_NS							(1000000000U / C_FCU__RTI_COUNTER1_HZ)
+
 	/** Hover Engines */
 	#define C_FCU__NUM_HOVER_ENGINES						(8U)
 
@@ -34,6 +58,12 @@
 	/** Number of lasers facing down to the ground */
 	#define C_FCU__NUM_LASERS_GROUND						(4U)
 
+	/** One ground plane pseudo-inverse per combination of working ground lasers */
+	#define C_FCU__LASER_ORIENT__NUM_MASKS					(1U << C_FCU__NUM_LASERS_GROUND)
+
+	/** A ground laser this far off the fitted plane is dropped and the plane refitted */
+	#define C_FCU__LASER_ORIENT__OUTLIER_MM					(2.0F)
+
 	/** number of lasers for the i-beam */
 	#define C_FCU__NUM_LASERS_IBEAM							(2U)
 
@@ -55,12 +85,23 @@
 	//fwd looking laser
 	#define C_FCU__SC16_FWD_LASER_INDEX						(6U)
 
+	/** NOPTEL UART baud */
+	#define C_FCU__LASERDIST__BAUD							(9600U)
+
+	/** Max bytes we drain from the laser FIFO per pass */
+	#define C_FCU__LASERDIST__RX_BURST						(64U)
+
+	/** 1 = laser configured to send the amplitude byte after the distance */
+	#define C_FCU__LASERDIST__AMPLITUDE_BYTE				(0U)
+
 
 	/** The SC16 device index for the ASI interface*/
 	#define C_FCU__SC16_ASI_INDEX							(7U)
 
-	/** max number of commands in the round robbin list */
-	#define C_FCU__ASI_COMMAND_LIST_MAX						(5U)
+	/** ASI telemetry block, faults to throttle voltage in one function 0x03 read.
+	 * 13 registers is a 31 byte reply, inside the 32 byte Modbus Rx buffer */
+	#define C_FCU__ASI_BLOCK_START_ADDX						((Luint16)C_FCU_ASI__FAULTS)
+	#define C_FCU__ASI_BLOCK_NUM_REGS						((Luint16)C_FCU_ASI__THROT_VOLTAGE - (Luint16)C_FCU_ASI__FAULTS + 1U)
 
 	/** The max number of contrast laser stripes in the tube
 	 * 1 Mile Tube = 5280ft
@@ -69,12 +110,48 @@
 	 *  */
 	#define C_FCU__LASER_CONTRAST__MAX_STRIPES				(55U)
 
+	/** Spacing between the stripes, 100ft */
+	#define C_FCU__LASER_CONTRAST__STRIPE_SPACING_MM			(30480U)
+
+	/** Number of stripe times averaged for the window velocity */
+	#define C_FCU__LASER_CONTRAST__VELOC_WINDOW				(4U)
+
 
 	/** Min brakes I-Beam Distance */
 	#define C_FCU__BRAKES__MIN_IBEAM_DIST_MM				(5.0F)
 
 	#define C_FCU__BRAKES__MAX_IBEAM_DIST_MM				(22.0F)
 
+	/** Brake gap grid, generated by BRAKE_TABLES/A34/PROCESSING/brake_grid.py
+	 * Velocity rows start at the min and step by 2048mm/s, below the min the
+	 * A34 polys are no good and we use full brakes.
+	 * Drag columns step by 16N up to 512N where the gap moves fastest, then by 128N.
+	 * Checked against the A34 data the grid is within 1.5% on gap. */
+	#define C_FCU__BRAKES__GRID_VELOC_MIN_MMS				(24576U)
+	#define C_FCU__BRAKES__GRID_VELOC_SHIFT					(11U)
+	#define C_FCU__BRAKES__GRID_VELOC_STEP					(1U << C_FCU__BRAKES__GRID_VELOC_SHIFT)
+	#define C_FCU__BRAKES__GRID_NUM_VELOC					(68U)
+	#define C_FCU__BRAKES__GRID_FINE_SHIFT					(4U)
+	#define C_FCU__BRAKES__GRID_FINE_STEP					(1U << C_FCU__BRAKES__GRID_FINE_SHIFT)
+	#define C_FCU__BRAKES__GRID_NUM_FINE					(32U)
+	/** Drag at the first coarse column */
+	#define C_FCU__BRAKES__GRID_FINE_MAX_N					(C_FCU__BRAKES__GRID_NUM_FINE << C_FCU__BRAKES__GRID_FINE_SHIFT)
+	#define C_FCU__BRAKES__GRID_DRAG_SHIFT					(7U)
+	#define C_FCU__BRAKES__GRID_DRAG_STEP					(1U << C_FCU__BRAKES__GRID_DRAG_SHIFT)
+	#define C_FCU__BRAKES__GRID_NUM_DRAG					(108U)
+	/** Binary search iterations, 2^n must be >= C_FCU__BRAKES__GRID_NUM_DRAG */
+	#define C_FCU__BRAKES__GRID_SEARCH_ITERATIONS			(7U)
+
+	/** Brake PID, setpoint rows are by track position and gain rows by velocity */
+	#define C_FCU__BRAKEPID__SETPOINT_STEP_MM				(10000U)
+	#define C_FCU__BRAKEPID__SETPOINT_NUM					(129U)
+	#define C_FCU__BRAKEPID__GAINS_STEP_MMS					(40000U)
+	#define C_FCU__BRAKEPID__GAINS_NUM						(5U)
+	/** Longest step in 10ms ticks if the main loop stalls */
+	#define C_FCU__BRAKEPID__MAX_SLOT_TICKS					(10U)
+	/** Don't bother the brakes with moves smaller than this */
+	#define C_FCU__BRAKEPID__GAP_DEADBAND_MM				(0.05F)
+
 
 	/** Number of geometry items */
 	#define C_FCU__GEOM__NUM_ITEMS_F32						(8U)
@@ -87,6 +164,45 @@
 	/** GS Communication constants */
 	#define C_FCU__GS_COMM_LOSS_DELAY						(1U)		//define exact value
 
+	/** UDP diagnostics rate table, number of streams that can run at once */
+	#define C_FCU__NET_TX__MAX_STREAMS						(8U)
+	/** Default stream periods in 10ms ticks */
+	#define C_FCU__NET_TX__DEFAULT_PERIOD_X10MS				(5U)
+	#define C_FCU__NET_TX__MISSION_PERIOD_X10MS				(5U)
+	#define C_FCU__NET_TX__FAULTS_PERIOD_X10MS				(25U)
+	/** Stream priorities, 0 is the highest */
+	#define C_FCU__NET_TX__PRIORITY_MISSION					(0U)
+	#define C_FCU__NET_TX__PRIORITY_FAULTS					(1U)
+	#define C_FCU__NET_TX__PRIORITY_DIAG					(2U)
+
+	/** Main loop scheduler, timer ticks per us. The PMU cycle counter on the
+	 * RM4, the RTI counter on the host. */
+	#ifndef WIN32
+		#define C_FCU__SCHED__TICKS_PER_US					(C_LOCALDEF__SYSTEM__HCLK_FREQ_MHZ)
+	#else
+		#define C_FCU__SCHED__TICKS_PER_US					(C_FCU__RTI_COUNTER1_HZ / 1000000U)
+	#endif
+	/** Deadline for one pass of the brake and nav chain, us */
+	#define C_FCU__SCHED__CRITICAL_BUDGET_US				(1000U)
+	/** Default per task budget, us */
+	#define C_FCU__SCHED__TASK_BUDGET_US					(250U)
+	/** Task priorities, 0 is the highest */
+	#define C_FCU__SCHED__PRIORITY_CRITICAL					(0U)
+	#define C_FCU__SCHED__PRIORITY_SENSOR					(1U)
+	#define C_FCU__SCHED__PRIORITY_COMMS					(2U)
+	#define C_FCU__SCHED__PRIORITY_BACKGROUND				(3U)
+
+	/** Profiler probes, one per scheduler task then the RTI ISRs */
+	#define C_FCU__PROFILE__PROBE_RTI_10MS					((Luint8)FCU_SCHED__MAX)
+	#define C_FCU__PROFILE__PROBE_RTI_100MS					((Luint8)FCU_SCHED__MAX + 1U)
+	#define C_FCU__PROFILE__NUM_PROBES						((Luint8)FCU_SCHED__MAX + 2U)
+	/** Profiler log2 histogram. Bin 0 holds everything under 2^(SHIFT + 1)
+	 * ticks, bin n from 2^(SHIFT + n), the last bin is open ended. */
+	#define C_FCU__PROFILE__HIST_BINS						(16U)
+	#define C_FCU__PROFILE__HIST_SHIFT						(6U)
+	/** Profiler probe name length */
+	#define C_FCU__PROFILE__NAME_LENGTH						(8U)
+
 	/** Pod Position constants */
 	#define C_FCU__POD_TARGET_POINT_MARGIN_POS				(16U)
 	#define C_FCU__POD_STOP_X_POS							(1600U)	//define exact value
@@ -124,6 +240,21 @@
 	#define C_FCU__NAV_MIN_PUSHER_SPEED						(10U)	//define exact value
 	#define C_FCU__NAV_MIN_PUSHER_ACCEL 						(5000U)
 
+	/** Blender, noise is 1 sigma in mm, mm/s and mm/s/s */
+	#define C_FCU__BLENDER__ACCEL_NOISE_MM_SS				(300.0F)
+	#define C_FCU__BLENDER__VELOC_NOISE_ACCEL_MM_S			(2000.0F)
+	#define C_FCU__BLENDER__VELOC_NOISE_LRF_MM_S			(300.0F)
+	#define C_FCU__BLENDER__VELOC_NOISE_CONTRAST_MM_S		(50.0F)
+	#define C_FCU__BLENDER__DISP_NOISE_ACCEL_MM				(5000.0F)
+	#define C_FCU__BLENDER__DISP_NOISE_LRF_MM				(50.0F)
+	#define C_FCU__BLENDER__DISP_NOISE_CONTRAST_MM			(20.0F)
+	/** Reject a measurement further than this many sigma from the prediction */
+	#define C_FCU__BLENDER__GATE_SIGMA						(5.0F)
+	/** Accept anyway after this many rejects in a row so we can never lock out */
+	#define C_FCU__BLENDER__MAX_REJECTS						(10U)
+	/** Longest predict step in 10ms ticks, protects against a stalled main loop */
+	#define C_FCU__BLENDER__MAX_PREDICT_TICKS				(50U)
+
 	#define C_FCU__NAV_NUM_CONTRAST_SENSORS 					(3U)
 	#define C_FCU__NAV_STARTING_XPOS_LC_FWD 					(55U)
 	#define C_FCU__NAV_STARTING_XPOS_LC_MID 					(55U)
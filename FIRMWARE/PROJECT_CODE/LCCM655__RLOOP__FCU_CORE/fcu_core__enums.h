@@ -286,7 +286,9 @@
 		/** Ramp command(s) to the HEs */
 		THROTTLE_STATE__RAMP_DOWN,
 
-		/** Mode to the next scanning index */
+		/** Mode to the next scanning index
+		 * STEP, RAMP_x and INC_INDEX are no longer entered now RUN services every HE
+		 * in one pass, kept so the state numbering seen by the GUI does not move */
 		THROTTLE_STATE__INC_INDEX,
 
 		/** an error was encountered */
@@ -298,4 +300,49 @@
 	} E_THROTTLE_STATES_T;
 
 
+	//////////////////////////////////////////////////////
+	//HOST SIMULATION
+	//////////////////////////////////////////////////////
+
+	/** Entry points timed by the host simulated clock runner */
+	typedef enum
+	{
+		FCU_SIL_ENTRY__PROCESS = 0U,
+		FCU_SIL_ENTRY__RTI_10MS_ISR,
+		FCU_SIL_ENTRY__RTI_100MS_ISR,
+
+		/** Must be last */
+		FCU_SIL_ENTRY__MAX
+
+	}E_FCU_SIL__ENTRY_T;
+
+
+	//////////////////////////////////////////////////////
+	//MAIN LOOP SCHEDULER
+	//////////////////////////////////////////////////////
+
+	/** Main loop tasks, in the order the loop used to call them */
+	typedef enum
+	{
+		FCU_SCHED__ADC = 0U,
+		FCU_SCHED__SC16,
+		FCU_SCHED__LASERDIST,
+		FCU_SCHED__THROTTLE,
+		FCU_SCHED__NET,
+		FCU_SCHED__LASEROPTO,
+		FCU_SCHED__LASERCONT,
+		FCU_SCHED__PUSHER,
+		FCU_SCHED__BRAKES,
+		FCU_SCHED__ACCEL,
+		FCU_SCHED__ASI,
+		FCU_SCHED__FCTL,
+		FCU_SCHED__DAQ,
+		FCU_SCHED__FAULTS,
+
+		/** Must be last */
+		FCU_SCHED__MAX
+
+	}E_FCU_SCHED__TASK_T;
+
+
 #endif /* RLOOP_LCCM655__RLOOP__FCU_CORE_FCU_CORE__ENUMS_H_ */
@@ -21,6 +21,12 @@ RLOOP - FLIGHT CONTROL UNIT - CORE
 		/** Data Acqusition System */
 		#define C_LOCALDEF__LCCM655__ENABLE_DAQ								(1U)
 
+		/** Run the main loop tasks from the cooperative scheduler with per task timing */
+		#define C_LOCALDEF__LCCM655__ENABLE_SCHEDULER						(1U)
+
+		/** Named probe execution time profiling of the scheduler tasks and RTI ISRs, needs the scheduler */
+		#define C_LOCALDEF__LCCM655__ENABLE_PROFILE							(1U)
+
 		/** Enable the OptoNCDT laser interface */
 		#define C_LOCALDEF__LCCM655__ENABLE_LASER_OPTONCDT					(1U)
 
@@ -33,6 +39,7 @@ RLOOP - FLIGHT CONTROL UNIT - CORE
 		/** Enable accel subsystem */
 		#define C_LOCALDEF__LCCM655__ENABLE_ACCEL							(0U)
 		#define C_LOCALDEF__LCCM655__ENABLE_ACCEL_INJECTION					(0U)
+		#define C_LOCALDEF__LCCM655__ENABLE_ACCEL_FIFO						(0U)
 
 
 		/** Enable the braking subsystems */
@@ -97,6 +104,9 @@ RLOOP - FLIGHT CONTROL UNIT - CORE
 			/** Navigation function */
 			#define C_LOCALDEF__LCCM655__ENABLE_FCTL_NAVIGATION 				(1U)
 
+			/** Fuse the nav sensors in the blender */
+			#define C_LOCALDEF__LCCM655__ENABLE_FCTL_BLENDER					(1U)
+
 			/** Control Aux Propulsion */
 			#define C_LOCALDEF__LCCM655__ENABLE_AUX_PROPULSION_CONTROL 			(1U)
 
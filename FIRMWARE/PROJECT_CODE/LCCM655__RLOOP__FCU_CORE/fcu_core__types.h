@@ -18,6 +18,29 @@
 
 	}TE_NAV_SM__TYPES;
 
+	/** Blender measurement slots, quantity then source */
+	typedef enum
+	{
+		/** Accel, first valid source in this order is the filter input */
+		BLENDER_MEAS__ACCEL_FROM_ACCEL = 0U,
+		BLENDER_MEAS__ACCEL_FROM_LRF,
+		BLENDER_MEAS__ACCEL_FROM_CONTRAST,
+
+		/** Velocity measurements */
+		BLENDER_MEAS__VELOC_FROM_ACCEL,
+		BLENDER_MEAS__VELOC_FROM_LRF,
+		BLENDER_MEAS__VELOC_FROM_CONTRAST,
+
+		/** Displacement measurements */
+		BLENDER_MEAS__DISP_FROM_ACCEL,
+		BLENDER_MEAS__DISP_FROM_LRF,
+		BLENDER_MEAS__DISP_FROM_CONTRAST,
+
+		/** Number of slots */
+		BLENDER_MEAS__NUM
+
+	}TE_BLENDER_MEAS__TYPES;
+
 
 	/** Enum for the Control Hover Engines state machine */
 	typedef enum {
@@ -141,11 +164,8 @@
 		/** Wait until the laser has been initted */
 		LASERDIST_STATE__WAIT_INIT_DONE,
 
-		/** Check if any new data is avail from the laser FIFO's */
-		LASERDIST_STATE__CHECK_NEW_DATA,
-
-		/** Check if a new packet is avail for each laser */
-		LASERDIST_STATE__CHECK_NEW_PACKET
+		/** Drain the laser FIFO and process every packet in it */
+		LASERDIST_STATE__CHECK_NEW_DATA
 
 	}E_FCU_LASERDIST__STATE_T;
 
@@ -0,0 +1,409 @@
+/**
+ * @file		FCU_CORE__WIN32.C
+ * @brief		Host simulated clock runner
+ * @author		Lachlan Grogan
+ * @copyright	rLoop Inc.
+ */
+/**
+ * @addtogroup RLOOP
+ * @{ */
+/**
+ * @addtogroup FCU
+ * @ingroup RLOOP
+ * @{ */
+/**
+ * @addtogroup FCU__CORE_WIN32
+ * @ingroup FCU
+ * @{ */
+
+#include "fcu_core.h"
+
+#if C_LOCALDEF__LCCM655__ENABLE_THIS_MODULE == 1U
+#ifdef WIN32
+
+#if defined(_WIN32)
+	#include <windows.h>
+#else
+	#include <time.h>
+#endif
+
+extern struct _strFCU sFCU;
+
+//locals
+static Luint64 u64FCU_WIN32__Get_Time_ns(void);
+static void vFCU_WIN32__Timed_Call(E_FCU_SIL__ENTRY_T eEntry, void (*pFunc)(void));
+#if C_LOCALDEF__LCCM666__ENABLE_THIS_MODULE == 1U
+static void vFCU_WIN32__TrackSim_Set_Time(Luint64 u64Time_ns);
+#endif
+
+
+/***************************************************************************//**
+ * @brief
+ * Clear the simulated clock and the entry point timing
+ *
+ * @st_funcMD5		FEDF0EFC84259A7653566FCE6E3FC8D2
+ * @st_funcID		LCCM655R0.FILE.096.FUNC.001
+ */
+void vFCU_WIN32__Reset_Timing(void)
+{
+	Luint8 u8Counter;
+
+	sFCU.sSIL.u32Ticks_10ms = 0U;
+	sFCU.sSIL.u64TrackSimStart_ns = 0U;
+	for(u8Counter = 0U; u8Counter < (Luint8)FCU_SIL_ENTRY__MAX; u8Counter++)
+	{
+		sFCU.sSIL.sEntry[u8Counter].u32Calls = 0U;
+		sFCU.sSIL.sEntry[u8Counter].u32Worst_ns = 0U;
+		sFCU.sSIL.sEntry[u8Counter].u64Total_ns = 0U;
+	}
+}
+
+/***************************************************************************//**
+ * @brief
+ * Run the FCU on a simulated clock, as fast as the host can go.
+ *
+ * @note
+ * Each 10ms tick runs the main loop u32LoopsPerTick times then the 10ms ISR,
+ * every 10th tick also runs the 100ms ISR. Nothing here depends on the wall
+ * clock so a run is the same every time, only the timing figures change.
+ * Call vFCU__Init() and vFCU_WIN32__Reset_Timing() first for a fresh flight.
+ *
+ * @param[in]		u32LoopsPerTick			Main loop passes between ISR's
+ * @param[in]		u32Ticks_10ms			Simulated time to run
+ * @st_funcMD5		2A7AF649348C3252A836B2AF25C967CE
+ * @st_funcID		LCCM655R0.FILE.096.FUNC.002
+ */
+void vFCU_WIN32__Run(Luint32 u32Ticks_10ms, Luint32 u32LoopsPerTick)
+{
+	Luint32 u32Tick;
+	Luint32 u32Loop;
+
+	for(u32Tick = 0U; u32Tick < u32Ticks_10ms; u32Tick++)
+	{
+		for(u32Loop = 0U; u32Loop < u32LoopsPerTick; u32Loop++)
+		{
+			vFCU_WIN32__Timed_Call(FCU_SIL_ENTRY__PROCESS, &vFCU__Process);
+		}
+
+		#if C_LOCALDEF__LCCM666__ENABLE_THIS_MODULE == 1U
+			//move the pod on to the end of this tick, the sensors fire as it goes
+			vSIMHLOOP_TRACK__Run_Until((((Luint64)sFCU.sSIL.u32Ticks_10ms + 1U) * 10000000U) - sFCU.sSIL.u64TrackSimStart_ns);
+			u64RTI_WIN32__Counter1 = (((Luint64)sFCU.sSIL.u32Ticks_10ms + 1U) * 10000000U) / C_FCU__RTI_COUNTER1_NS;
+		#endif
+
+		vFCU_WIN32__Timed_Call(FCU_SIL_ENTRY__RTI_10MS_ISR, &vFCU__RTI_10MS_ISR);
+
+		sFCU.sSIL.u32Ticks_10ms++;
+		if((sFCU.sSIL.u32Ticks_10ms % 10U) == 0U)
+		{
+			vFCU_WIN32__Timed_Call(FCU_SIL_ENTRY__RTI_100MS_ISR, &vFCU__RTI_100MS_ISR);
+		}
+		else
+		{
+			//fall on
+		}
+	}
+}
+
+/***************************************************************************//**
+ * @brief
+ * Simulated time since the last reset
+ *
+ * @st_funcMD5		40CA457D9090352B22EC0B40FA6C7F3A
+ * @st_funcID		LCCM655R0.FILE.096.FUNC.003
+ */
+Luint32 u32FCU_WIN32__Get_SimTime_ms(void)
+{
+	return sFCU.sSIL.u32Ticks_10ms * 10U;
+}
+
+/***************************************************************************//**
+ * @brief
+ * Longest host time for one call of an entry point
+ *
+ * @param[in]		u8Entry					E_FCU_SIL__ENTRY_T
+ * @st_funcMD5		0B25A966F5DCDEA2F07E5A2C342A4AE4
+ * @st_funcID		LCCM655R0.FILE.096.FUNC.004
+ */
+Luint32 u32FCU_WIN32__Get_Worst_ns(Luint8 u8Entry)
+{
+	Luint32 u32Return;
+
+	if(u8Entry < (Luint8)FCU_SIL_ENTRY__MAX)
+	{
+		u32Return = sFCU.sSIL.sEntry[u8Entry].u32Worst_ns;
+	}
+	else
+	{
+		u32Return = 0U;
+	}
+
+	return u32Return;
+}
+
+/***************************************************************************//**
+ * @brief
+ * Mean host time for one call of an entry point
+ *
+ * @param[in]		u8Entry					E_FCU_SIL__ENTRY_T
+ * @st_funcMD5		2C05A92B30288F54A81B717796FFA3B5
+ * @st_funcID		LCCM655R0.FILE.096.FUNC.005
+ */
+Luint32 u32FCU_WIN32__Get_Mean_ns(Luint8 u8Entry)
+{
+	Luint32 u32Return;
+
+	if(u8Entry < (Luint8)FCU_SIL_ENTRY__MAX)
+	{
+		if(sFCU.sSIL.sEntry[u8Entry].u32Calls > 0U)
+		{
+			u32Return = (Luint32)(sFCU.sSIL.sEntry[u8Entry].u64Total_ns / (Luint64)sFCU.sSIL.sEntry[u8Entry].u32Calls);
+		}
+		else
+		{
+			u32Return = 0U;
+		}
+	}
+	else
+	{
+		u32Return = 0U;
+	}
+
+	return u32Return;
+}
+
+#if C_LOCALDEF__LCCM666__ENABLE_THIS_MODULE == 1U
+/***************************************************************************//**
+ * @brief
+ * Init the software track model on the same stripes as our track database
+ *
+ * @st_funcMD5		08311AFDAA84E5AC091192AF74F65354
+ * @st_funcID		LCCM655R0.FILE.096.FUNC.006
+ */
+void vFCU_WIN32__TrackSim_Init(void)
+{
+	vSIMHLOOP_TRACK__Init();
+
+	#if C_LOCALDEF__LCCM655__ENABLE_LASER_CONTRAST == 1U
+		//all the lasers share the same database
+		vSIMHLOOP_TRACK__Set_Stripes(&sFCU.sContrast.sTrackDatabase[(Luint8)LASER_CONT__FWD].u32DistanceElapsed_mm[0], C_FCU__LASER_CONTRAST__MAX_STRIPES);
+	#endif
+
+	sFCU.sSIL.u64TrackSimStart_ns = (Luint64)sFCU.sSIL.u32Ticks_10ms * 10000000U;
+}
+
+/***************************************************************************//**
+ * @brief
+ * Put the pod at the start of the track and launch it from the current
+ * simulated time, vFCU_WIN32__Run() then flies it.
+ *
+ * @st_funcMD5		824BDA3568E09F77D14E5A50C4A82C46
+ * @st_funcID		LCCM655R0.FILE.096.FUNC.007
+ */
+void vFCU_WIN32__TrackSim_Start(void)
+{
+	sFCU.sSIL.u64TrackSimStart_ns = (Luint64)sFCU.sSIL.u32Ticks_10ms * 10000000U;
+	vSIMHLOOP_TRACK__Start();
+}
+
+/***************************************************************************//**
+ * @brief
+ * Set the flight profile of the track model
+ *
+ * @param[in]		f32Accel_G				Pusher accel
+ * @param[in]		f32CoastVeloc_ms		Velocity we stop accelerating at
+ * @param[in]		f32Decel_G				Braking, negative
+ * @st_funcMD5		7F2C622B69690D621FAE7F3679CAF127
+ * @st_funcID		LCCM655R0.FILE.096.FUNC.008
+ */
+void vFCU_WIN32__TrackSim_Set_Profile(Lfloat32 f32Accel_G, Lfloat32 f32CoastVeloc_ms, Lfloat32 f32Decel_G)
+{
+	vSIMHLOOP_TRACK__Set_Profile(f32Accel_G, f32CoastVeloc_ms, f32Decel_G);
+}
+
+/***************************************************************************//**
+ * @brief
+ * Set the track model sensor noise, all 1 sigma
+ *
+ * @param[in]		f32Range_mm				Laser range noise
+ * @param[in]		f32Accel_G				Accel noise
+ * @param[in]		f32EdgeJitter_ns		Contrast edge jitter
+ * @param[in]		u32Seed					Same seed, same run
+ * @st_funcMD5		C1C472F50D4E555F5E5464FBF5019275
+ * @st_funcID		LCCM655R0.FILE.096.FUNC.009
+ */
+void vFCU_WIN32__TrackSim_Set_Noise(Lfloat32 f32Range_mm, Lfloat32 f32Accel_G, Lfloat32 f32EdgeJitter_ns, Luint32 u32Seed)
+{
+	vSIMHLOOP_TRACK__Set_Noise(f32Range_mm, f32Accel_G, f32EdgeJitter_ns, u32Seed);
+}
+
+/***************************************************************************//**
+ * @brief
+ * Track model contrast edge, timestamp it on the RTI and run the pin ISR
+ *
+ * @param[in]		u8Laser					E_FCU__LASER_CONT_INDEX_T
+ * @param[in]		u8Rising				1 for the start of a stripe
+ * @param[in]		u64Time_ns				Time since the track model start
+ * @st_funcMD5		0B39F2664B41929FFBB0A5CFC9E77100
+ * @st_funcID		LCCM655R0.FILE.096.FUNC.010
+ */
+void vFCU_WIN32__TrackSim_Edge(Luint8 u8Laser, Luint8 u8Rising, Luint64 u64Time_ns)
+{
+#if C_LOCALDEF__LCCM655__ENABLE_LASER_CONTRAST == 1U
+	//N2HET pins for FWD, MID, AFT
+	const Luint32 u32Pin[LASER_CONT__MAX] = {6U, 7U, 13U};
+	Luint32 u32Register;
+
+	if(u8Laser < (Luint8)LASER_CONT__MAX)
+	{
+		vFCU_WIN32__TrackSim_Set_Time(u64Time_ns);
+
+		if(u8Rising == 1U)
+		{
+			u32Register = 1U << u32Pin[u8Laser];
+		}
+		else
+		{
+			u32Register = 0U;
+		}
+
+		vFCU_LASERCONT_TL__ISR((E_FCU__LASER_CONT_INDEX_T)u8Laser, u32Register);
+	}
+	else
+	{
+		//error
+	}
+#else
+	(void)u8Laser;
+	(void)u8Rising;
+	(void)u64Time_ns;
+#endif
+}
+
+/***************************************************************************//**
+ * @brief
+ * Track model laser range sample
+ *
+ * @param[in]		s32Range_mm				Distance to the end of the tube
+ * @param[in]		u64Time_ns				Time since the track model start
+ * @st_funcMD5		5606ED309128A1A87711AFA0F8BD5A8B
+ * @st_funcID		LCCM655R0.FILE.096.FUNC.011
+ */
+void vFCU_WIN32__TrackSim_Range(Lint32 s32Range_mm, Luint64 u64Time_ns)
+{
+#if C_LOCALDEF__LCCM655__ENABLE_LASER_DISTANCE == 1U
+	vFCU_WIN32__TrackSim_Set_Time(u64Time_ns);
+	vFCU_LASERDIST_WIN32__Inject_Distance(s32Range_mm, u64RM4_RTI__Get_Counter1());
+#else
+	(void)s32Range_mm;
+	(void)u64Time_ns;
+#endif
+}
+
+/***************************************************************************//**
+ * @brief
+ * Track model accel sample, along the tube on Y with gravity on Z
+ *
+ * @param[in]		f32Accel_G				Accel along the tube
+ * @param[in]		u64Time_ns				Time since the track model start
+ * @st_funcMD5		737E72A0513847C5A7AE54041BE9D84B
+ * @st_funcID		LCCM655R0.FILE.096.FUNC.012
+ */
+void vFCU_WIN32__TrackSim_Accel(Lfloat32 f32Accel_G, Luint64 u64Time_ns)
+{
+#if C_LOCALDEF__LCCM655__ENABLE_ACCEL == 1U
+	Luint8 u8Device;
+	Lfloat32 f32Counts_G;
+
+	#if C_LOCALDEF__LCCM418__G_FORCE_RANGE == 2U
+		f32Counts_G = 4096.0F;
+	#elif C_LOCALDEF__LCCM418__G_FORCE_RANGE == 4U
+		f32Counts_G = 2048.0F;
+	#elif C_LOCALDEF__LCCM418__G_FORCE_RANGE == 8U
+		f32Counts_G = 1024.0F;
+	#else
+		#error
+	#endif
+
+	//the driver timestamps the sample off the RTI
+	vFCU_WIN32__TrackSim_Set_Time(u64Time_ns);
+
+	for(u8Device = 0U; u8Device < C_FCU__NUM_ACCEL_CHIPS; u8Device++)
+	{
+		//level pod, the Y write raises the data ready
+		sFCU.sAccel.sChannels[u8Device].s16WIN32_Raw[MMA8451_AXIS__X] = 0;
+		sFCU.sAccel.sChannels[u8Device].s16WIN32_Raw[MMA8451_AXIS__Z] = (Lint16)f32Counts_G;
+		vFCU_ACCEL_WIN32__Set_Raw(u8Device, (Luint8)MMA8451_AXIS__Y, (Lint32)(f32Accel_G * f32Counts_G));
+	}
+#else
+	(void)f32Accel_G;
+	(void)u64Time_ns;
+#endif
+}
+
+//move the RTI to the track model sample time so the sensor paths timestamp it as the ISR would
+static void vFCU_WIN32__TrackSim_Set_Time(Luint64 u64Time_ns)
+{
+	u64RTI_WIN32__Counter1 = (sFCU.sSIL.u64TrackSimStart_ns + u64Time_ns) / C_FCU__RTI_COUNTER1_NS;
+}
+#endif //C_LOCALDEF__LCCM666__ENABLE_THIS_MODULE
+
+//call an entry point and keep its cost
+static void vFCU_WIN32__Timed_Call(E_FCU_SIL__ENTRY_T eEntry, void (*pFunc)(void))
+{
+	Luint64 u64Start;
+	Luint64 u64Time;
+
+	u64Start = u64FCU_WIN32__Get_Time_ns();
+	pFunc();
+	u64Time = u64FCU_WIN32__Get_Time_ns() - u64Start;
+
+	sFCU.sSIL.sEntry[eEntry].u32Calls++;
+	sFCU.sSIL.sEntry[eEntry].u64Total_ns += u64Time;
+	if(u64Time > (Luint64)sFCU.sSIL.sEntry[eEntry].u32Worst_ns)
+	{
+		sFCU.sSIL.sEntry[eEntry].u32Worst_ns = (Luint32)u64Time;
+	}
+	else
+	{
+		//fall on
+	}
+}
+
+//host monotonic time
+static Luint64 u64FCU_WIN32__Get_Time_ns(void)
+{
+	Luint64 u64Return;
+#if defined(_WIN32)
+	LARGE_INTEGER sFreq;
+	LARGE_INTEGER sCount;
+
+	QueryPerformanceFrequency(&sFreq);
+	QueryPerformanceCounter(&sCount);
+	u64Return = ((Luint64)sCount.QuadPart / (Luint64)sFreq.QuadPart) * 1000000000U;
+	u64Return += (((Luint64)sCount.QuadPart % (Luint64)sFreq.QuadPart) * 1000000000U) / (Luint64)sFreq.QuadPart;
+#else
+	struct timespec sTime;
+
+	clock_gettime(CLOCK_MONOTONIC, &sTime);
+	u64Return = ((Luint64)sTime.tv_sec * 1000000000U) + (Luint64)sTime.tv_nsec;
+#endif
+
+	return u64Return;
+}
+
+#endif //WIN32
+#endif //#if C_LOCALDEF__LCCM655__ENABLE_THIS_MODULE == 1U
+//safetys
+#ifndef C_LOCALDEF__LCCM655__ENABLE_THIS_MODULE
+	#error
+#endif
+#ifdef WIN32
+	//the sim clock is in ns, the RTI tick has to divide it
+	#if (1000000000U % C_FCU__RTI_COUNTER1_HZ) != 0U
+		#error
+	#endif
+#endif
+/** @} */
+/** @} */
+/** @} */
@@ -42,6 +42,12 @@ DS2482S - I2C TO 1-WIRE CONVERTER
 		/** When waiting in loops, we need a program loop timeout value */
 		#define C_LOCALDEF__LCCM641__MAX_TIMEOUT_LOOPS						(100000U)
 
+		/** Run 1-Wire transactions from vDS2482S__Process() instead of busy waiting */
+		#define C_LOCALDEF__LCCM641__ENABLE_ASYNC							(0U)
+
+		/** 10ms ticks before an async 1-Wire op is declared hung */
+		#define C_LOCALDEF__LCCM641__ASYNC_TIMEOUT_TICKS					(3U)
+
 		// I2C MACROS
 		#define M_LOCALDEF__LCCM641__I2C_TX_REG(device, reg)				s16RM4_I2C_USER__TxReg(device, reg)
 		#define M_LOCALDEF__LCCM641__I2C_RX_REG(device, reg)				s16RM4_I2C_USER__RxReg(device, reg)
@@ -78,6 +84,12 @@ DS18B20 - 1-Wire Temperature Sensor
          */
         #define C_LOCALDEF__LCCM644__USE_10MS_ISR                           (0U)
 
+        /** Convert and read through the LCCM641 async engine, needs the 10ms ISR */
+        #define C_LOCALDEF__LCCM644__USE_ASYNC                              (0U)
+
+        /** Call C_LOCALDEF__LCCM644__TEMP_CALLBACK(index) as each new reading is stored */
+        #define C_LOCALDEF__LCCM644__ENABLE_TEMP_CALLBACK                   (0U)
+
 		//connectivity options
 		//1-Wire software library
 		#define C_LOCALDEF__LCCM644__CONNECT_LCCM236						(0U)
@@ -0,0 +1,91 @@
+#!/usr/bin/env python
+
+# File:     brake_pid_sim.py
+# Purpose:  Closed loop simulation of the FCU brake PID in the LCCM655 DLL, for tuning without the pod
+# Author:   Lachlan Grogan
+# @see:     FIRMWARE/PROJECT_CODE/LCCM655__RLOOP__FCU_CORE/FLIGHT_CONTROLLER/BRAKE_PROFILE/fcu__fctl__brake_pid.c
+
+# NOTE: This must be done in a 32 bit version of python, same as dll_test.py
+#
+# The plant is a point mass with the eddy brake drag taken from the same A34
+# grid the FCU uses, and a brake actuator that can only slew at a fixed rate.
+# The PID is stepped every 10ms, the plant every 1ms. To tune, edit
+# f32A34_GainsTable in brake_gap_table.c and rebuild the DLL.
+# Output is one row per PID step:
+#    time_s,pos_m,veloc_ms,setpoint_ms,drag_n,command_mm,gap_mm
+#
+#    python brake_pid_sim.py -o run.csv --veloc 100 --pos 300 --slew 10
+
+import argparse
+import csv
+import ctypes
+import os
+
+# must match fcu_core__defines.h
+GRID_VELOC_MIN_MMS = 24576
+MAX_IBEAM_DIST_MM = 22.0
+
+# Command line arguments
+parser = argparse.ArgumentParser(description="Closed loop simulation of the brake PID.")
+parser.add_argument('-o', '--output', help=".csv file for the run", required=True)
+parser.add_argument('-d', '--dll', help="path to the LCCM655 DLL",
+                    default=os.path.join("..", "APPLICATIONS", "PROJECT_CODE", "DLLS", "LDLL174__RLOOP__LCCM655", "bin", "Debug", "LDLL174__RLOOP__LCCM655.dll"))
+parser.add_argument('--mass', help="pod mass in kg", type=float, default=350.0)
+parser.add_argument('--veloc', help="velocity when the brakes are enabled in m/s", type=float, default=100.0)
+parser.add_argument('--pos', help="track position when the brakes are enabled in m", type=float, default=300.0)
+parser.add_argument('--slew', help="brake actuator slew rate in mm/s", type=float, default=15.0)
+parser.add_argument('--time', help="max run time in s", type=float, default=60.0)
+args = parser.parse_args()
+
+lib = ctypes.CDLL(args.dll)
+
+lib.f32FCU_FLIGHTCTL_BRAKEPID__Step.argtypes = [ctypes.c_int32, ctypes.c_int32, ctypes.c_float]
+lib.f32FCU_FLIGHTCTL_BRAKEPID__Step.restype = ctypes.c_float
+lib.s32FCU_FLIGHTCTL_BRAKEPID__Get_Setpoint_mms.restype = ctypes.c_int32
+lib.s32FCU_FLIGHTCTL_BRAKEPID__Get_Drag_n.restype = ctypes.c_int32
+lib.s16FCU_FLIGHTCTL_BRAKES__Drag_Lookup.argtypes = [ctypes.c_uint32, ctypes.c_uint32, ctypes.POINTER(ctypes.c_uint32)]
+lib.s16FCU_FLIGHTCTL_BRAKES__Drag_Lookup.restype = ctypes.c_int16
+
+
+def plant_drag(veloc_ms, gap_mm):
+    # below the grid the eddy drag falls off with velocity
+    drag = ctypes.c_uint32(0)
+    veloc_mms = int(veloc_ms * 1000.0)
+    if veloc_mms < GRID_VELOC_MIN_MMS:
+        lib.s16FCU_FLIGHTCTL_BRAKES__Drag_Lookup(GRID_VELOC_MIN_MMS, int(gap_mm * 1000.0), ctypes.byref(drag))
+        return drag.value * float(veloc_mms) / GRID_VELOC_MIN_MMS
+    lib.s16FCU_FLIGHTCTL_BRAKES__Drag_Lookup(veloc_mms, int(gap_mm * 1000.0), ctypes.byref(drag))
+    return float(drag.value)
+
+
+lib.vFCU_FLIGHTCTL_BRAKEPID__Init()
+
+pos = args.pos
+veloc = args.veloc
+gap = MAX_IBEAM_DIST_MM
+command = gap
+time = 0.0
+tick = 0
+
+with open(args.output, 'w') as output_file:
+    writer = csv.writer(output_file, lineterminator='\n')
+    writer.writerow(['time_s', 'pos_m', 'veloc_ms', 'setpoint_ms', 'drag_n', 'command_mm', 'gap_mm'])
+
+    while veloc > 0.05 and time < args.time:
+        if (tick % 10) == 0:
+            command = lib.f32FCU_FLIGHTCTL_BRAKEPID__Step(int(pos * 1000.0), int(veloc * 1000.0), 0.01)
+            writer.writerow(['{0:.2f}'.format(time), '{0:.3f}'.format(pos), '{0:.3f}'.format(veloc),
+                             '{0:.3f}'.format(lib.s32FCU_FLIGHTCTL_BRAKEPID__Get_Setpoint_mms() / 1000.0),
+                             lib.s32FCU_FLIGHTCTL_BRAKEPID__Get_Drag_n(),
+                             '{0:.2f}'.format(command), '{0:.2f}'.format(gap)])
+
+        # slew the actuator
+        step = max(min(command - gap, args.slew * 0.001), -args.slew * 0.001)
+        gap += step
+
+        veloc -= (plant_drag(veloc, gap) / args.mass) * 0.001
+        pos += veloc * 0.001
+        time += 0.001
+        tick += 1
+
+print("Stopped at {0:.1f}m after {1:.1f}s, written to {2}".format(pos, time, args.output))
@@ -0,0 +1,114 @@
+#!/usr/bin/env python
+
+# File:     fcu_sil_runner.py
+# Purpose:  Headless runner, runs the FCU from the LCCM655 DLL on a simulated clock
+# Author:   Lachlan Grogan
+# @see:     FIRMWARE/PROJECT_CODE/LCCM655__RLOOP__FCU_CORE/fcu_core__win32.c
+
+# NOTE: On Windows this must be done in a 32 bit version of python, same as
+# dll_test.py, and loads the DLL from the VS build. On Linux it loads the .so
+# from the CMake build in APPLICATIONS/PROJECT_CODE/DLLS/LDLL174__RLOOP__LCCM655
+#
+#    cmake -S ../APPLICATIONS/PROJECT_CODE/DLLS/LDLL174__RLOOP__LCCM655 -B ../build/LDLL174
+#    cmake --build ../build/LDLL174
+#
+# Each run is a fresh vFCU__Init() followed by --time seconds of simulated time.
+# The clock is simulated so a run goes as fast as the PC can go. The worst and
+# mean host time of vFCU__Process and the RTI ISR's are printed per run, and
+# the script exits with 1 if any worst case is over --budget-us so CI can fail
+# the build on it.
+#
+#    python fcu_sil_runner.py --runs 1000 --time 60 --budget-us 2000 -o timing.csv
+
+import argparse
+import csv
+import ctypes
+import os
+import sys
+
+# E_FCU_SIL__ENTRY_T
+ENTRIES = ['vFCU__Process', 'vFCU__RTI_10MS_ISR', 'vFCU__RTI_100MS_ISR']
+
+# Default library for this platform
+if sys.platform == 'win32':
+    default_lib = os.path.join("..", "APPLICATIONS", "PROJECT_CODE", "DLLS", "LDLL174__RLOOP__LCCM655", "bin", "Debug", "LDLL174__RLOOP__LCCM655.dll")
+else:
+    default_lib = os.path.join("..", "build", "LDLL174", "LDLL174__RLOOP__LCCM655.so")
+
+# Command line arguments
+parser = argparse.ArgumentParser(description="Run the FCU on a simulated clock.")
+parser.add_argument('-d', '--dll', help="path to the LCCM655 DLL or .so", default=default_lib)
+parser.add_argument('-v', '--verbose', help="print the FCU debug messages", action='store_true')
+parser.add_argument('-o', '--output', help="optional .csv file, one row per run", default=None)
+parser.add_argument('--runs', help="number of runs", type=int, default=1)
+parser.add_argument('--time', help="simulated time per run in s", type=float, default=60.0)
+parser.add_argument('--loops', help="main loop passes per 10ms tick", type=int, default=100)
+parser.add_argument('--budget-us', help="fail if any worst case is over this, 0 = no limit", type=int, default=0)
+args = parser.parse_args()
+
+lib = ctypes.CDLL(args.dll)
+
+# The firmware calls back to the host without checking, these must be set
+# before vFCU__Init(). DEBUG_PRINT goes through this one
+DEBUG_PRINTF_CALLBACK = ctypes.CFUNCTYPE(None, ctypes.c_char_p)
+
+def debug_printf(message):
+    if args.verbose:
+        print(message.decode('ascii', 'replace'))
+
+debug_printf_callback = DEBUG_PRINTF_CALLBACK(debug_printf)
+lib.vSIL3_DEBUG_PRINTF_WIN32__Set_Callback(debug_printf_callback)
+
+# The throttle DAC reports its volts here, there is no GUI to show them
+DAC_VOLTS_CALLBACK = ctypes.CFUNCTYPE(None, ctypes.c_uint8, ctypes.c_float)
+
+def dac_volts(channel, volts):
+    pass
+
+dac_volts_callback = DAC_VOLTS_CALLBACK(dac_volts)
+lib.vAMC7812_WIN32__Set_DACVoltsCallback(dac_volts_callback)
+lib.vFCU_WIN32__Run.argtypes = [ctypes.c_uint32, ctypes.c_uint32]
+lib.u32FCU_WIN32__Get_SimTime_ms.restype = ctypes.c_uint32
+lib.u32FCU_WIN32__Get_Worst_ns.argtypes = [ctypes.c_uint8]
+lib.u32FCU_WIN32__Get_Worst_ns.restype = ctypes.c_uint32
+lib.u32FCU_WIN32__Get_Mean_ns.argtypes = [ctypes.c_uint8]
+lib.u32FCU_WIN32__Get_Mean_ns.restype = ctypes.c_uint32
+
+ticks = int(args.time * 100.0)
+worst = [0] * len(ENTRIES)
+output_file = None
+writer = None
+if args.output is not None:
+    output_file = open(args.output, 'w')
+    writer = csv.writer(output_file, lineterminator='\n')
+    header = ['run', 'sim_time_ms']
+    for name in ENTRIES:
+        header += [name + '_worst_ns', name + '_mean_ns']
+    writer.writerow(header)
+
+for run in range(0, args.runs):
+    lib.vFCU__Init()
+    lib.vFCU_WIN32__Reset_Timing()
+    lib.vFCU_WIN32__Run(ticks, args.loops)
+
+    row = [run, lib.u32FCU_WIN32__Get_SimTime_ms()]
+    for index in range(0, len(ENTRIES)):
+        run_worst = lib.u32FCU_WIN32__Get_Worst_ns(index)
+        worst[index] = max(worst[index], run_worst)
+        row += [run_worst, lib.u32FCU_WIN32__Get_Mean_ns(index)]
+    if writer is not None:
+        writer.writerow(row)
+
+if output_file is not None:
+    output_file.close()
+
+print("{0} runs of {1}s simulated".format(args.runs, args.time))
+failed = False
+for index, name in enumerate(ENTRIES):
+    print("{0:24} worst {1:10.1f}us".format(name, worst[index] / 1000.0))
+    if args.budget_us > 0 and worst[index] > args.budget_us * 1000:
+        failed = True
+
+if failed:
+    print("Over the {0}us budget".format(args.budget_us))
+    sys.exit(1)
@@ -0,0 +1,90 @@
+#!/usr/bin/env python
+
+# File:     nav_blender_replay.py
+# Purpose:  Replay a recorded run through the FCU navigation blender in the LCCM655 DLL
+# Author:   Lachlan Grogan
+# @see:     FIRMWARE/PROJECT_CODE/LCCM655__RLOOP__FCU_CORE/FLIGHT_CONTROLLER/BLENDER/fcu__flight__blender.c
+
+# NOTE: This must be done in a 32 bit version of python, same as dll_test.py
+#
+# Input is a .csv with a header row, any column may be blank if that sensor had
+# no new sample on that row:
+#    time_us,accel_mm_ss,lrf_mm,contrast_veloc_mm_s,contrast_disp_mm
+#
+# The 10ms ISR is called from the timestamps so the replay runs at the same
+# rate as the pod no matter how fast the PC is. Output is one row per input row:
+#    time_us,accel_mm_ss,veloc_mm_s,disp_mm,distance_mm
+#
+#    python nav_blender_replay.py -i run.csv -o fused.csv --lrf-target 1600000
+
+import argparse
+import csv
+import ctypes
+import os
+
+# Command line arguments
+parser = argparse.ArgumentParser(description="Replay a recorded run through the navigation blender.")
+parser.add_argument('-i', '--input', help=".csv file to replay", required=True)
+parser.add_argument('-o', '--output', help=".csv file for the blended output", required=True)
+parser.add_argument('-d', '--dll', help="path to the LCCM655 DLL",
+                    default=os.path.join("..", "APPLICATIONS", "PROJECT_CODE", "DLLS", "LDLL174__RLOOP__LCCM655", "bin", "Debug", "LDLL174__RLOOP__LCCM655.dll"))
+parser.add_argument('--lrf-target', help="track position of the LRF target in mm, 0 = LRF is distance only", type=int, default=0)
+args = parser.parse_args()
+
+lib = ctypes.CDLL(args.dll)
+
+# All the blender update functions are (Luint8 u8Channel, Lint32 value)
+for name in ['vFCU_FCTL_BLENDER__Accel_UpdateFrom_Accel',
+             'vFCU_FCTL_BLENDER__Veloc_UpdateFrom_Contrast',
+             'vFCU_FCTL_BLENDER__Displacement_UpdateFrom_LRF',
+             'vFCU_FCTL_BLENDER__Displacement_UpdateFrom_Contrast']:
+    getattr(lib, name).argtypes = [ctypes.c_uint8, ctypes.c_int32]
+    getattr(lib, name).restype = None
+for name in ['s32FCU_FCTL_BLENDER__Get_Accel_mmss',
+             's32FCU_FCTL_BLENDER__Get_Veloc_mms',
+             's32FCU_FCTL_BLENDER__Get_Displacement_mm',
+             's32FCU_FCTL_BLENDER__Get_Distance_mm']:
+    getattr(lib, name).restype = ctypes.c_int32
+lib.vFCU_FCTL_BLENDER__Set_LRF_Target.argtypes = [ctypes.c_int32]
+
+lib.vFCU_FCTL_BLENDER__Init()
+lib.vFCU_FCTL_BLENDER__Set_LRF_Target(args.lrf_target)
+
+# column -> update function
+updates = [('accel_mm_ss', lib.vFCU_FCTL_BLENDER__Accel_UpdateFrom_Accel),
+           ('lrf_mm', lib.vFCU_FCTL_BLENDER__Displacement_UpdateFrom_LRF),
+           ('contrast_veloc_mm_s', lib.vFCU_FCTL_BLENDER__Veloc_UpdateFrom_Contrast),
+           ('contrast_disp_mm', lib.vFCU_FCTL_BLENDER__Displacement_UpdateFrom_Contrast)]
+
+rows = 0
+next_tick_us = None
+with open(args.input, 'r') as input_file, open(args.output, 'w') as output_file:
+    reader = csv.DictReader(input_file)
+    writer = csv.writer(output_file, lineterminator='\n')
+    writer.writerow(['time_us', 'accel_mm_ss', 'veloc_mm_s', 'disp_mm', 'distance_mm'])
+
+    for row in reader:
+        time_us = int(row['time_us'])
+        if next_tick_us is None:
+            next_tick_us = time_us + 10000
+
+        # catch the ISR up to this row
+        while time_us >= next_tick_us:
+            lib.vFCU_FCTL_BLENDER__10MS_ISR()
+            next_tick_us += 10000
+
+        for column, function in updates:
+            text = row.get(column, '')
+            if text is not None and text.strip() != '':
+                function(0, int(float(text)))
+
+        lib.vFCU_FCTL_BLENDER__Process()
+
+        writer.writerow([time_us,
+                         lib.s32FCU_FCTL_BLENDER__Get_Accel_mmss(),
+                         lib.s32FCU_FCTL_BLENDER__Get_Veloc_mms(),
+                         lib.s32FCU_FCTL_BLENDER__Get_Displacement_mm(),
+                         lib.s32FCU_FCTL_BLENDER__Get_Distance_mm()])
+        rows += 1
+
+print("Replayed {0} rows into {1}".format(rows, args.output))
@@ -0,0 +1,129 @@
+#!/usr/bin/env python
+
+# File:     daq_compression_benchmark.py
+# Purpose:  Report the DAQ delta / zig-zag varint compression ratio on captured Flig_tellog*.csv data
+# Author:   Lachlan Grogan
+# @see:     FIRMWARE/COMMON_CODE/MULTICORE/LCCM662__MULTICORE__DAQ/COMPRESS/daq__compress.c
+
+# Note: the encoder here must match u16SIL3_DAQ_COMPRESS__Encode(), each channel
+#    in the log is treated as a DAQ stream and packed into packets of --samples
+#    (the watermark level) or until --max-bytes is reached, same as the firmware.
+#
+#    python daq_compression_benchmark.py -p "Flig*.csv"
+
+import argparse
+import csv
+import glob
+import struct
+
+# Command line arguments
+parser = argparse.ArgumentParser(description="Report the DAQ compression ratio on Flig_tellog .csv files.")
+input_pattern_group = parser.add_mutually_exclusive_group(required=True)
+input_pattern_group.add_argument('-i', '--input', help=".csv file to import", required=False)
+input_pattern_group.add_argument('-p', '--pattern', help="File matching pattern (e.g. Flig*.csv). Pattern must be in quotes.", required=False)
+parser.add_argument('-s', '--samples', help="samples per packet (C_LOCALDEF__LCCM662__BUFFER_WATERMARK_LEVEL)", type=int, default=64)
+parser.add_argument('-m', '--max-bytes', help="C_LOCALDEF__LCCM662__COMPRESS_MAX_BYTES", type=int, default=1200)
+parser.add_argument('--no-timer', help="as if C_LOCALDEF__LCCM662__ENABLE_TIMER_IN_DATA is 0", action='store_true')
+args = parser.parse_args()
+
+# Setup input files. Make it a list if we just have one to simplify the code
+if args.input:
+    input_filenames = [args.input]
+elif args.pattern:
+    input_filenames = sorted(glob.glob(args.pattern))
+
+COMPRESS_HEADER_BYTES = 4
+COMPRESS_MAX_SAMPLE_BYTES = 10
+TIMER_BYTES = 0 if args.no_timer else 4
+
+
+def varint_len(value):
+    """Bytes taken by an unsigned varint, 7 bits per byte"""
+    count = 1
+    while value > 0x7F:
+        value >>= 7
+        count += 1
+    return count
+
+
+def zigzag(delta):
+    """32 bit delta to zig-zag, matches the firmware"""
+    delta &= 0xFFFFFFFF
+    if delta & 0x80000000:
+        return ((~delta) << 1 | 1) & 0xFFFFFFFF
+    return (delta << 1) & 0xFFFFFFFF
+
+
+def to_raw(type_code, text):
+    """Logged value to the 32 bit pattern the DAQ would delta, and its size in bytes.
+    Type code: high nibble is the size, low nibble 1 = unsigned, 2 = signed, 3 = float"""
+    size = (type_code >> 4) & 0x0F
+    kind = type_code & 0x0F
+    if kind == 3:
+        return struct.unpack('<I', struct.pack('<f', float(text)))[0], size
+    value = int(float(text))
+    return value & 0xFFFFFFFF, size
+
+
+def timestamp_us(text):
+    """HH:MM:SS:usec to microseconds"""
+    hours, minutes, seconds, micros = [int(x) for x in text.split(':')]
+    return (((hours * 60) + minutes) * 60 + seconds) * 1000000 + micros
+
+
+def encode_channel(samples):
+    """Return (raw bytes, encoded bytes) for one channel split into DAQ packets"""
+    raw = 0
+    encoded = 0
+    pos = 0
+    while pos < len(samples):
+        length = COMPRESS_HEADER_BYTES
+        prev_timer = 0
+        prev_value = 0
+        count = 0
+        while (pos < len(samples)) and (count < args.samples) and ((length + COMPRESS_MAX_SAMPLE_BYTES) <= args.max_bytes):
+            timer, value, size = samples[pos]
+            if TIMER_BYTES:
+                length += varint_len((timer - prev_timer) & 0xFFFFFFFF)
+                prev_timer = timer
+            length += varint_len(zigzag(value - prev_value))
+            prev_value = value
+            raw += size + TIMER_BYTES
+            count += 1
+            pos += 1
+        encoded += length
+    return raw, encoded
+
+
+total_raw = 0
+total_encoded = 0
+for input_filename in input_filenames:
+
+    # channel id -> list of (timer, raw value, size)
+    channels = {}
+    with open(input_filename, 'r') as input_file:
+        for row in csv.reader(input_file):
+            if len(row) < 4:
+                continue
+            timer = timestamp_us(row[0])
+            for col in range(1, len(row) - 2, 3):
+                channel = int(row[col])
+                value, size = to_raw(int(row[col + 1], 16), row[col + 2])
+                channels.setdefault(channel, []).append((timer & 0xFFFFFFFF, value, size))
+
+    file_raw = 0
+    file_encoded = 0
+    for channel in channels:
+        raw, encoded = encode_channel(channels[channel])
+        file_raw += raw
+        file_encoded += encoded
+
+    total_raw += file_raw
+    total_encoded += file_encoded
+    if file_encoded > 0:
+        print("{0}: {1} channels, raw {2} bytes, encoded {3} bytes, ratio {4:.2f}".format(
+            input_filename, len(channels), file_raw, file_encoded, float(file_raw) / file_encoded))
+
+if total_encoded > 0:
+    print("TOTAL: raw {0} bytes, encoded {1} bytes, ratio {2:.2f}".format(
+        total_raw, total_encoded, float(total_raw) / total_encoded))